@@ -0,0 +1,247 @@
+#include <iostream>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <cstring>
+#include <iterator>
+#include <string>
+#include <vector>
+#include "../src/resources/AssetPacker.h"
+#include "../src/resources/VirtualFileSystem.h"
+#include "../src/resources/AudioResource.h"
+#include "test_check.h"
+
+using namespace RPGEngine::Resources;
+
+/**
+ * Asset archive test
+ * Packs a directory of generated assets, checks deduplication, compression
+ * and round trips, serves the files through the virtual file system with and
+ * without loose fallback, and compares the startup read of a few hundred
+ * assets from loose files against the packed archive.
+ */
+
+static void writeFile(const std::string& path, const std::string& contents) {
+    std::filesystem::create_directories(std::filesystem::path(path).parent_path());
+    std::ofstream file(path, std::ios::binary);
+    file.write(contents.data(), static_cast<std::streamsize>(contents.size()));
+}
+
+static std::string makeWav(int sampleRate, int samples) {
+    auto u16 = [](std::string& out, int value) {
+        out.push_back(static_cast<char>(value & 0xFF));
+        out.push_back(static_cast<char>((value >> 8) & 0xFF));
+    };
+    auto u32 = [&u16](std::string& out, int value) {
+        u16(out, value & 0xFFFF);
+        u16(out, (value >> 16) & 0xFFFF);
+    };
+
+    std::string wav = "RIFF";
+    u32(wav, 36 + samples * 2);
+    wav += "WAVEfmt ";
+    u32(wav, 16);
+    u16(wav, 1);                // PCM
+    u16(wav, 1);                // Mono
+    u32(wav, sampleRate);
+    u32(wav, sampleRate * 2);
+    u16(wav, 2);
+    u16(wav, 16);
+    wav += "data";
+    u32(wav, samples * 2);
+    for (int i = 0; i < samples; ++i) {
+        u16(wav, (i * 37) & 0xFFFF);
+    }
+    return wav;
+}
+
+static std::string makeNoise(size_t size, uint32_t seed) {
+    std::string data(size, '\0');
+    for (size_t i = 0; i < size; ++i) {
+        seed = seed * 1664525u + 1013904223u;
+        data[i] = static_cast<char>(seed >> 24);
+    }
+    return data;
+}
+
+static std::string makeMap(int index) {
+    std::string map = "<?xml version=\"1.0\"?>\n<map width=\"64\" height=\"64\">\n<data encoding=\"csv\">\n";
+    for (int row = 0; row < 64; ++row) {
+        for (int col = 0; col < 64; ++col) {
+            map += std::to_string((row * col + index) % 8) + ",";
+        }
+        map += "\n";
+    }
+    return map + "</data>\n</map>\n";
+}
+
+int main() {
+    std::cout << "=== Asset Archive Test ===" << std::endl;
+
+    namespace fs = std::filesystem;
+    const fs::path root = fs::temp_directory_path() / "rpg_asset_archive_test";
+    fs::remove_all(root);
+    const std::string looseDir = (root / "assets").string();
+    const std::string archivePath = (root / "assets.rpak").string();
+
+    VirtualFileSystem& vfs = VirtualFileSystem::getInstance();
+    bool allPassed = true;
+
+    // Test 1: packing
+    std::cout << "\n1. Packing a directory..." << std::endl;
+
+    const std::string mapText = makeMap(0);
+    const std::string noise = makeNoise(4096, 7);
+    writeFile(looseDir + "/maps/town.tmx", mapText);
+    writeFile(looseDir + "/maps/town_copy.tmx", mapText);
+    writeFile(looseDir + "/textures/noise.bin", noise);
+    writeFile(looseDir + "/textures/tiles.png", makeMap(1));
+    writeFile(looseDir + "/audio/tone.wav", makeWav(8000, 4000));
+    writeFile(looseDir + "/empty.txt", "");
+
+    AssetPacker packer(AssetPackCompression::Auto);
+    size_t added = packer.addDirectory(looseDir, "assets/");
+    allPassed &= check(added == 6 && packer.write(archivePath), "directory packed");
+
+    const AssetPackerStats& stats = packer.getStats();
+    std::cout << "Input " << stats.inputBytes << " bytes, stored " << stats.storedBytes << " bytes, archive "
+              << stats.archiveBytes << " bytes" << std::endl;
+    allPassed &= check(stats.files == 6 && stats.duplicates == 1 && stats.uniqueBlobs == 5,
+                       "identical files share one blob");
+    std::cout << "Compressed " << stats.compressedBlobs << " of " << stats.uniqueBlobs << " blobs" << std::endl;
+
+    // Test 2: reading the archive directly
+    std::cout << "\n2. Reading the archive..." << std::endl;
+
+    auto archive = AssetArchive::open(archivePath);
+    allPassed &= check(archive != nullptr && archive->getEntryCount() == 6 && archive->getBlobCount() == 5,
+                       "archive opens with every entry");
+    if (!archive) {
+        fs::remove_all(root);
+        return 1;
+    }
+
+    AssetView town = archive->view("assets/maps/town.tmx");
+    AssetView copy = archive->view("assets/maps/town_copy.tmx");
+    AssetView tiles = archive->view("assets/textures/tiles.png");
+    AssetView raw = archive->view("assets/textures/noise.bin");
+    allPassed &= check(town.toString() == mapText && copy.toString() == mapText && tiles.toString() == makeMap(1),
+                       "compressed and deduplicated entries round trip");
+    allPassed &= check(!town.isZeroCopy() && tiles.isZeroCopy(), "text compressed, noise and .png stored zero-copy");
+    allPassed &= check(raw.isZeroCopy() && raw.toString() == noise &&
+                       reinterpret_cast<uintptr_t>(raw.data()) % 16 == 0, "stored entries are aligned spans of the mapping");
+    allPassed &= check(archive->getSize("assets/maps/town.tmx") == mapText.size() &&
+                       archive->view("assets/empty.txt").isValid() && archive->view("assets/empty.txt").size() == 0,
+                       "sizes reported, empty files kept");
+    allPassed &= check(!archive->contains("assets/maps/missing.tmx") && !archive->view("assets/maps/missing.tmx").isValid(),
+                       "missing entries not found");
+
+    // Corrupt blob sizes are rejected at open, before view() allocates them
+    auto corruptBlobSizes = [&](const std::string& path, uint64_t lz4Size, uint64_t storedDelta) {
+        std::ifstream in(archivePath, std::ios::binary);
+        std::vector<char> bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+        ArchiveHeader header;
+        std::memcpy(&header, bytes.data(), sizeof(header));
+        for (uint32_t i = 0; i < header.blobCount; ++i) {
+            char* at = bytes.data() + header.blobsOffset + i * sizeof(ArchiveBlob);
+            ArchiveBlob blob;
+            std::memcpy(&blob, at, sizeof(blob));
+            if (blob.compression == static_cast<uint32_t>(AssetCompression::LZ4)) {
+                blob.size = lz4Size ? lz4Size : blob.size;
+            } else {
+                blob.size += storedDelta;
+            }
+            std::memcpy(at, &blob, sizeof(blob));
+        }
+        std::ofstream(path, std::ios::binary).write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+    };
+    std::string corruptPath = (root / "corrupt.rpak").string();
+    corruptBlobSizes(corruptPath, uint64_t(1) << 60, 0);
+    bool hugeRejected = AssetArchive::open(corruptPath) == nullptr;
+    corruptBlobSizes(corruptPath, 0, 1);
+    allPassed &= check(hugeRejected && AssetArchive::open(corruptPath) == nullptr,
+                       "impossible blob sizes rejected");
+
+    // Test 3: virtual file system
+    std::cout << "\n3. Serving files through the VFS..." << std::endl;
+
+    allPassed &= check(VirtualFileSystem::normalizePath(".\\assets//maps/../maps/./town.tmx") == "assets/maps/town.tmx",
+                       "paths normalized");
+
+    // Loose files live under the temp dir; the game asks for "assets/..."
+    fs::path previousDir = fs::current_path();
+    fs::current_path(root);
+
+    vfs.resetStats();
+    allPassed &= check(vfs.mountArchive(archivePath) && vfs.getArchiveCount() == 1, "archive mounted");
+    allPassed &= check(vfs.isArchived("assets\\textures\\noise.bin") && vfs.open("./assets/textures/noise.bin").isZeroCopy(),
+                       "archived files served zero-copy");
+
+    writeFile("assets/extra.txt", "loose only");
+    std::string text;
+    vfs.setLooseFilesEnabled(true);
+    allPassed &= check(vfs.readText("assets/extra.txt", text) && text == "loose only", "loose fallback in development");
+    vfs.setLooseFilesEnabled(false);
+    allPassed &= check(!vfs.exists("assets/extra.txt") && vfs.exists("assets/maps/town.tmx"),
+                       "shipping mode serves only the archive");
+
+    auto tone = std::make_shared<AudioResource>("tone", "assets/audio/tone.wav");
+    allPassed &= check(tone->load() && tone->getChannels() == 1 && tone->getData().size() == 8000,
+                       "WAV resource loads from the archive");
+    tone->unload();
+
+    VirtualFileSystemStats vfsStats = vfs.getStats();
+    allPassed &= check(vfsStats.archiveReads == 2 && vfsStats.zeroCopyReads == 2 && vfsStats.looseReads == 1,
+                       "reads counted by source");
+
+    AssetView held = vfs.open("assets/textures/noise.bin");
+    vfs.unmountAll();
+    allPassed &= check(held.toString() == noise && !vfs.exists("assets/textures/noise.bin"),
+                       "views outlive unmounting");
+    vfs.setLooseFilesEnabled(true);
+
+    // Test 4: startup read, loose vs packed
+    std::cout << "\n4. Startup read of 300 assets..." << std::endl;
+
+    const int assetCount = 300;
+    AssetPacker startupPacker(AssetPackCompression::Auto);
+    std::vector<std::string> paths;
+    for (int i = 0; i < assetCount; ++i) {
+        std::string path = "assets/startup/" + std::to_string(i) + (i % 3 == 0 ? ".bin" : ".tmx");
+        std::string contents = i % 3 == 0 ? makeNoise(16384, i) : makeMap(i);
+        writeFile(path, contents);
+        startupPacker.addData(path, std::vector<uint8_t>(contents.begin(), contents.end()), AssetPackCompression::Auto);
+        paths.push_back(path);
+    }
+    allPassed &= check(startupPacker.write("startup.rpak"), "startup archive packed");
+
+    auto readAll = [&]() {
+        size_t bytes = 0;
+        for (const auto& path : paths) {
+            AssetView view = vfs.open(path);
+            bytes += view.isValid() ? view.size() : 0;
+        }
+        return bytes;
+    };
+
+    auto start = std::chrono::high_resolution_clock::now();
+    size_t looseBytes = readAll();
+    double looseMs = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+
+    start = std::chrono::high_resolution_clock::now();
+    bool mounted = vfs.mountArchive("startup.rpak");
+    size_t packedBytes = readAll();
+    double packedMs = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+
+    std::cout << "Loose files: " << looseMs << " ms for " << looseBytes << " bytes" << std::endl;
+    std::cout << "Archive: " << packedMs << " ms for " << packedBytes << " bytes, including the mount" << std::endl;
+    allPassed &= check(mounted && looseBytes == packedBytes && vfs.getStats().archiveReads >= static_cast<uint64_t>(assetCount),
+                       "archive serves the same bytes");
+
+    vfs.unmountAll();
+    fs::current_path(previousDir);
+    fs::remove_all(root);
+
+    std::cout << "\n=== Asset Archive Test " << (allPassed ? "Complete" : "FAILED") << " ===" << std::endl;
+    return allPassed ? 0 : 1;
+}
@@ -0,0 +1,75 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include "../src/resources/AssetPacker.h"
+
+using namespace RPGEngine::Resources;
+
+/**
+ * Asset packer
+ * Packs asset directories into an archive for the VirtualFileSystem.
+ *
+ * Usage: AssetPacker [--compression none|auto|always] [--prefix p] output.rpak dir...
+ *
+ * Files are stored as prefix + their path relative to the directory; the
+ * prefix defaults to the directory name plus '/', so "AssetPacker
+ * assets.rpak assets" stores "assets/maps/town.tmx" as the game asks for it.
+ */
+
+int main(int argc, char* argv[]) {
+    AssetPackCompression compression = AssetPackCompression::Auto;
+    std::string prefix;
+    bool hasPrefix = false;
+    std::vector<std::string> positional;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+
+        if (arg == "--compression" && hasValue) {
+            std::string mode = argv[++i];
+            if (mode == "none") {
+                compression = AssetPackCompression::None;
+            } else if (mode == "auto") {
+                compression = AssetPackCompression::Auto;
+            } else if (mode == "always") {
+                compression = AssetPackCompression::Always;
+            } else {
+                std::cerr << "Unknown compression mode: " << mode << std::endl;
+                return 1;
+            }
+        } else if (arg == "--prefix" && hasValue) {
+            prefix = argv[++i];
+            hasPrefix = true;
+        } else {
+            positional.push_back(arg);
+        }
+    }
+
+    if (positional.size() < 2) {
+        std::cerr << "Usage: AssetPacker [--compression none|auto|always] [--prefix p] output.rpak dir..." << std::endl;
+        return 1;
+    }
+
+    AssetPacker packer(compression);
+    for (size_t i = 1; i < positional.size(); ++i) {
+        std::string directory = positional[i];
+        while (directory.size() > 1 && (directory.back() == '/' || directory.back() == '\\')) {
+            directory.pop_back();
+        }
+
+        size_t added = packer.addDirectory(directory, hasPrefix ? prefix : directory + "/");
+        std::cout << "Added " << added << " files from " << directory << std::endl;
+    }
+
+    if (!packer.write(positional[0])) {
+        return 1;
+    }
+
+    const AssetPackerStats& stats = packer.getStats();
+    std::cout << "Wrote " << positional[0] << ": " << stats.files << " files, " << stats.uniqueBlobs << " unique ("
+              << stats.duplicates << " duplicates), " << stats.compressedBlobs << " compressed" << std::endl;
+    std::cout << "Input " << stats.inputBytes << " bytes, stored " << stats.storedBytes << " bytes, archive "
+              << stats.archiveBytes << " bytes" << std::endl;
+    return 0;
+}
@@ -0,0 +1,136 @@
+#include <iostream>
+#include <chrono>
+#include <filesystem>
+#include <string>
+#include <vector>
+#include "../src/save/SaveManager.h"
+#include "../src/save/BinarySaveSerializer.h"
+#include "test_check.h"
+
+using namespace Engine::Save;
+namespace fs = std::filesystem;
+
+/**
+ * Background save test
+ * Compares the game thread cost of a synchronous save against capturing a
+ * snapshot and handing it to SaveManager::saveGameAsync, and checks that
+ * completions arrive through update(), writes stay in order, files are
+ * replaced atomically and failures are reported.
+ */
+
+static SaveData makeSave(int npcs, int level) {
+    SaveData data;
+    data.version = "1.0";
+    data.player.stats.level = level;
+    data.world.currentMap = "forest";
+    for (int i = 0; i < 100; ++i) {
+        PlayerData::InventoryItem item;
+        item.id = "item_" + std::to_string(i);
+        item.quantity = 1 + i % 10;
+        data.player.inventory.push_back(item);
+    }
+    for (int i = 0; i < npcs; ++i) {
+        data.world.gameFlags["flag_" + std::to_string(i)] = (i & 1) != 0;
+        data.world.npcStates["npc_" + std::to_string(i)] = "idle";
+    }
+    return data;
+}
+
+int main() {
+    std::cout << "=== Background Save Test ===" << std::endl;
+    bool allPassed = true;
+
+    const std::string dir = "async_save_tmp";
+    fs::remove_all(dir);
+
+    // The live game state a capture copies from
+    const SaveData live = makeSave(2000, 10);
+
+    SaveManager manager;
+    manager.setCompressionEnabled(true);
+    manager.initialize(dir);
+
+    // Synchronous: everything on the game thread
+    auto syncStart = std::chrono::steady_clock::now();
+    SaveResult syncResult = manager.saveGame(live, "sync");
+    double syncMs = elapsedMs(syncStart);
+
+    // Background: copy the state, queue it, keep going
+    std::vector<std::string> completed;
+    SaveResult asyncResult = SaveResult::FileError;
+    auto captureStart = std::chrono::steady_clock::now();
+    SaveData snapshot = live;
+    bool queued = manager.saveGameAsync(std::move(snapshot), "async", [&](SaveResult result, const std::string& slot) {
+        asyncResult = result;
+        completed.push_back(slot);
+    });
+    double captureMs = elapsedMs(captureStart);
+
+    std::cout << "Synchronous save: " << syncMs << " ms on the game thread" << std::endl;
+    std::cout << "Background save capture: " << captureMs << " ms on the game thread" << std::endl;
+
+    allPassed &= check(syncResult == SaveResult::Success && queued, "both saves accepted");
+    allPassed &= check(completed.empty() && manager.isSaveInProgress(), "completion waits for update()");
+
+    manager.waitForSaves();
+    manager.update();
+    allPassed &= check(completed.size() == 1 && completed[0] == "async" && asyncResult == SaveResult::Success &&
+                       !manager.isSaveInProgress(), "completion delivered by update()");
+
+    SaveData loaded;
+    allPassed &= check(manager.loadGame(loaded, "async") == LoadResult::Success &&
+                       loaded.world.npcStates.size() == live.world.npcStates.size() && !loaded.timestamp.empty(),
+                       "background save loads");
+    allPassed &= check(!fs::exists(dir + "/async.sav.tmp"), "no temporary file left behind");
+
+    // Several saves to one slot land in submission order, with backups
+    completed.clear();
+    for (int level = 11; level <= 13; ++level) {
+        manager.saveGameAsync(makeSave(500, level), "ordered", [&](SaveResult, const std::string& slot) {
+            completed.push_back(slot);
+        });
+    }
+    manager.waitForSaves();
+    manager.update();
+    SaveData ordered;
+    allPassed &= check(completed.size() == 3 && manager.loadGame(ordered, "ordered") == LoadResult::Success &&
+                       ordered.player.stats.level == 13, "saves written in order");
+    allPassed &= check(fs::exists(dir + "/ordered.sav.bak0") && fs::exists(dir + "/ordered.sav.bak1"),
+                       "backups rotated on the worker");
+
+    // Invalid data is rejected before anything is queued
+    SaveData invalid = makeSave(10, 0);
+    bool called = false;
+    allPassed &= check(!manager.saveGameAsync(invalid, "invalid", [&](SaveResult, const std::string&) { called = true; }) &&
+                       !called && !manager.isSaveInProgress(), "validation failure reported immediately");
+
+    // Write failures come back through the callback
+    SaveResult failedResult = SaveResult::Success;
+    manager.saveGameAsync(makeSave(10, 5), "missing_dir/slot", [&](SaveResult result, const std::string&) {
+        failedResult = result;
+    });
+    manager.waitForSaves();
+    manager.update();
+    allPassed &= check(failedResult == SaveResult::FileError && !manager.getLastError().empty(), "write failure reported");
+
+    // The serializer can't change under an in-flight save
+    manager.saveGameAsync(makeSave(2000, 20), "switch");
+    manager.setSerializer(std::make_unique<BinarySaveSerializer>());
+    manager.update();
+    allPassed &= check(!manager.isSaveInProgress(), "serializer change waits for pending saves");
+
+    // Shutdown finishes pending writes
+    manager.saveGameAsync(makeSave(2000, 21), "shutdown");
+    manager.shutdown();
+    SaveManager reader;
+    reader.setSerializer(std::make_unique<BinarySaveSerializer>());
+    reader.initialize(dir);
+    SaveData afterShutdown;
+    allPassed &= check(reader.loadGame(afterShutdown, "shutdown") == LoadResult::Success &&
+                       afterShutdown.player.stats.level == 21, "shutdown completes pending saves");
+
+    fs::remove_all(dir);
+
+    std::cout << "\n=== Background Save Test " << (allPassed ? "Complete" : "FAILED") << " ===" << std::endl;
+    return allPassed ? 0 : 1;
+}
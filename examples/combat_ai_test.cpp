@@ -0,0 +1,236 @@
+#include <iostream>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include "../src/systems/CombatAI.h"
+#include "../src/systems/CombatSystem.h"
+#include "../src/systems/CombatSimulator.h"
+#include "../src/components/ComponentManager.h"
+#include "test_check.h"
+
+using namespace RPGEngine;
+using namespace RPGEngine::Components;
+using namespace RPGEngine::Systems;
+
+/**
+ * Combat AI test
+ * Compares scoring every (skill, target) pair from scratch through
+ * component lookups, as getAIAction and evaluateTargetPriority did for
+ * their one skill, against the utility AI's blackboard in a 20v20
+ * encounter. Checks the response curves and that behaviors, aggression,
+ * MP and status effects steer decisions, and profiles decision time over
+ * simulated 20v20 encounters.
+ */
+
+static CombatSkill makeSkill(const std::string& id, CombatActionType type, float damage, float mpCost, float accuracy) {
+    CombatSkill skill(id, id, type);
+    skill.damage = damage;
+    skill.mpCost = mpCost;
+    skill.accuracy = accuracy;
+    skill.criticalChance = 0.05f;
+    return skill;
+}
+
+static void addFighter(ComponentManager& components, EntityId entity, int strength) {
+    auto stats = components.createComponent<StatsComponent>(Entity(entity));
+    stats->setVerbose(false);
+    stats->setBaseAttribute(AttributeType::Vitality, 12);
+    stats->setBaseAttribute(AttributeType::Strength, strength);
+    stats->setCurrentHP(stats->getMaxHP());
+    stats->setCurrentMP(stats->getMaxMP());
+
+    auto combat = components.createComponent<CombatComponent>(Entity(entity));
+    combat->addSkill(makeSkill("slash", CombatActionType::Attack, 6.0f, 0.0f, 0.9f));
+    CombatSkill venom = makeSkill("venom", CombatActionType::Magic, 10.0f, 15.0f, 0.8f);
+    venom.statusEffects.push_back(StatusEffect(StatusEffectType::Poison, "Poison", 3.0f, 1.0f));
+    combat->addSkill(venom);
+    CombatSkill guard = makeSkill("guard", CombatActionType::Skill, 0.0f, 5.0f, 1.0f);
+    guard.statusEffects.push_back(StatusEffect(StatusEffectType::Shield, "Shield", 3.0f, 1.0f, true));
+    combat->addSkill(guard);
+}
+
+// How getAIAction scored targets before the blackboard, extended to every skill
+static CombatAction legacyChoose(const CombatSystem& combat, const ComponentManager& components, EntityId actor) {
+    CombatAction best(actor, actor, CombatActionType::Defend);
+    float bestScore = 0.0f;
+
+    auto combatComp = components.getComponent<CombatComponent>(Entity(actor));
+    auto actorStats = components.getComponent<StatsComponent>(Entity(actor));
+    for (const auto* skill : combatComp->getAvailableSkills()) {
+        if (skill->mpCost > actorStats->getCurrentMP()) {
+            continue;
+        }
+        for (EntityId target : combat.getValidTargets(actor, *skill)) {
+            auto targetStats = components.getComponent<StatsComponent>(Entity(target));
+            float score = 1.0f - targetStats->getHPPercentage() * 0.5f;
+            if (skill->type == CombatActionType::Attack || skill->type == CombatActionType::Magic) {
+                CombatAction probe(actor, target, skill->type, skill->id);
+                float damage = combat.calculateDamage(probe);
+                score *= combat.calculateHitChance(actor, target, *skill) *
+                         std::min(1.0f, damage / std::max(targetStats->getCurrentHP(), 1.0f));
+            }
+            if (score > bestScore) {
+                bestScore = score;
+                best = CombatAction(actor, target, skill->type, skill->id);
+            }
+        }
+    }
+    return best;
+}
+
+int main() {
+    std::cout << "=== Combat AI Test ===" << std::endl;
+    bool allPassed = true;
+
+    // Response curves
+    ResponseCurve inverse = ResponseCurve::linear(-1.0f, 1.0f);
+    ResponseCurve logistic = ResponseCurve::logistic(10.0f, 0.5f);
+    ResponseCurve quadratic(ResponseCurveType::Polynomial, 1.0f, 2.0f, 0.0f, 0.0f);
+    allPassed &= check(inverse.evaluate(0.25f) == 0.75f && inverse.evaluate(-1.0f) == 1.0f &&
+                       ResponseCurve::linear(2.0f, 0.0f).evaluate(0.75f) == 1.0f &&
+                       ResponseCurve::constant(0.3f).evaluate(0.9f) == 0.3f, "linear curves clamp to [0, 1]");
+    allPassed &= check(std::fabs(logistic.evaluate(0.5f) - 0.5f) < 1e-6f && logistic.evaluate(0.0f) < 0.01f &&
+                       logistic.evaluate(1.0f) > 0.99f && quadratic.evaluate(0.5f) == 0.25f,
+                       "logistic and polynomial curves");
+
+    std::vector<float> inputs;
+    for (int i = 0; i <= 40; ++i) {
+        inputs.push_back(i / 40.0f);
+    }
+    std::vector<float> outputs(inputs.size());
+    bool batchMatches = true;
+    for (const ResponseCurve* curve : {&inverse, &logistic, &quadratic}) {
+        curve->evaluate(inputs.data(), outputs.data(), inputs.size());
+        for (size_t i = 0; i < inputs.size(); ++i) {
+            batchMatches &= outputs[i] == curve->evaluate(inputs[i]);
+        }
+    }
+    allPassed &= check(batchMatches, "batch evaluation matches single evaluation");
+
+    // 20v20 encounter
+    auto components = std::make_shared<ComponentManager>();
+    components->initialize();
+    std::vector<EntityId> heroes, monsters;
+    for (EntityId hero = 1; hero <= 20; ++hero) {
+        addFighter(*components, hero, 10 + static_cast<int>(hero % 6));
+        heroes.push_back(hero);
+    }
+    for (EntityId monster = 101; monster <= 120; ++monster) {
+        addFighter(*components, monster, 10 + static_cast<int>(monster % 6));
+        monsters.push_back(monster);
+    }
+
+    CombatSystem combat;
+    combat.setComponentManager(components);
+    combat.setRandomSeed(7);
+    allPassed &= check(combat.startCombat("arena", heroes, monsters), "20v20 encounter started");
+    const auto& participants = combat.getCurrentEncounter()->participants;
+
+    // Per-pair lookups: every pair looks its components up again
+    const int rounds = 200;
+    EntityId sink = 0;
+    auto legacyStart = std::chrono::steady_clock::now();
+    for (int round = 0; round < rounds; ++round) {
+        for (const auto& participant : participants) {
+            sink += legacyChoose(combat, *components, participant.entity).target;
+        }
+    }
+    double legacyMs = elapsedMs(legacyStart);
+
+    // Blackboard: one per decision
+    auto blackboardStart = std::chrono::steady_clock::now();
+    for (int round = 0; round < rounds; ++round) {
+        for (const auto& participant : participants) {
+            sink += combat.getAIAction(participant.entity).target;
+        }
+    }
+    double blackboardMs = elapsedMs(blackboardStart);
+
+    double decisions = static_cast<double>(rounds) * participants.size();
+    std::cout << "Per-pair component lookups: " << legacyMs * 1000.0 / decisions << " us per decision" << std::endl;
+    std::cout << "Blackboard scoring: " << blackboardMs * 1000.0 / decisions << " us per decision ("
+              << combat.getAI().getBlackboard().enemies.size() << " enemies x 3 skills)" << std::endl;
+    allPassed &= check(sink > 0, "every decision picked a target");
+
+    // Decisions
+    CombatAI ai;
+    EntityId hero = 1;
+    const std::vector<CombatParticipant>& all = participants;
+    auto heroStats = components->getComponent<StatsComponent>(Entity(hero));
+    auto heroCombat = components->getComponent<CombatComponent>(Entity(hero));
+
+    auto weakened = components->getComponent<StatsComponent>(Entity(113));
+    weakened->setCurrentHP(5.0f);
+    CombatAction action = ai.chooseAction(*components, all, hero);
+    allPassed &= check(action.target == 113 && (action.type == CombatActionType::Attack || action.type == CombatActionType::Magic),
+                       "finishes a weakened enemy");
+    allPassed &= check(ai.getTargetScore(113) > ai.getTargetScore(114) && ai.getTargetScore(999) == 0.0f,
+                       "target scores from the last decision");
+    allPassed &= check(combat.evaluateTargetPriority(hero, 113) > combat.evaluateTargetPriority(hero, 114),
+                       "evaluateTargetPriority uses the utility scores");
+    weakened->setCurrentHP(weakened->getMaxHP());
+
+    heroStats->setCurrentMP(0.0f);
+    action = ai.chooseAction(*components, all, hero);
+    allPassed &= check(action.skillId == "slash", "skills without enough MP skipped");
+    heroStats->setCurrentMP(heroStats->getMaxMP());
+
+    heroCombat->setAIBehavior("defensive");
+    heroStats->setCurrentHP(heroStats->getMaxHP() * 0.1f);
+    action = ai.chooseAction(*components, all, hero);
+    allPassed &= check(action.type == CombatActionType::Defend, "defensive behavior guards when hurt");
+    heroCombat->setAggression(1.0f);
+    action = ai.chooseAction(*components, all, hero);
+    allPassed &= check(action.type != CombatActionType::Defend, "aggression overrides guarding");
+    heroCombat->setAggression(0.5f);
+    heroStats->setCurrentHP(heroStats->getMaxHP());
+    action = ai.chooseAction(*components, all, hero);
+    allPassed &= check(action.type == CombatActionType::Attack || action.type == CombatActionType::Magic,
+                       "defensive behavior attacks when healthy");
+
+    auto injured = components->getComponent<StatsComponent>(Entity(7));
+    injured->setCurrentHP(injured->getMaxHP() * 0.2f);
+    heroCombat->setAIBehavior("support");
+    action = ai.chooseAction(*components, all, hero);
+    allPassed &= check(action.skillId == "guard" && action.target == 7, "support behavior shields an injured ally");
+    components->getComponent<CombatComponent>(Entity(7))->addStatusEffect(
+        StatusEffect(StatusEffectType::Shield, "Shield", 3.0f, 1.0f, true));
+    action = ai.chooseAction(*components, all, hero);
+    allPassed &= check(action.target != 7, "support behavior skips allies already shielded");
+    heroCombat->setAIBehavior("default");
+    action = ai.chooseAction(*components, all, hero);
+    allPassed &= check(action.skillId != "guard", "default behavior prefers attacking");
+
+    CombatAIProfile coward;
+    coward.defend = ResponseCurve::constant(1.0f);
+    ai.setProfile("coward", coward);
+    heroCombat->setAIBehavior("coward");
+    allPassed &= check(ai.chooseAction(*components, all, hero).type == CombatActionType::Defend &&
+                       ai.getProfile("unknown").defend.evaluate(0.5f) == 0.0f, "custom and fallback profiles");
+    heroCombat->setAIBehavior("default");
+
+    // Decision time over whole 20v20 encounters
+    combat.endCombat(false);
+    CombatSimulator simulator;
+    for (EntityId entity : heroes) {
+        simulator.addParticipant(*components, entity, true);
+    }
+    for (EntityId entity : monsters) {
+        simulator.addParticipant(*components, entity, false);
+    }
+    CombatSimulationConfig config;
+    config.encounters = 200;
+    config.threads = 1;
+    CombatSimulationResult result = simulator.run(config);
+    std::cout << "Simulated " << result.encounters << " 20v20 encounters in " << result.elapsedMs << " ms: "
+              << result.actions << " decisions, " << result.elapsedMs * 1000.0 / result.actions
+              << " us per decision including its execution, " << result.getAverageRounds() << " rounds on average"
+              << std::endl;
+    allPassed &= check(result.encounters == 200 && result.timeouts == 0 && result.actions > 0, "20v20 encounters finish");
+
+    std::cout << "\n=== Combat AI Test " << (allPassed ? "Complete" : "FAILED") << " ===" << std::endl;
+    return allPassed ? 0 : 1;
+}
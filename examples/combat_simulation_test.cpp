@@ -0,0 +1,150 @@
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+#include <thread>
+#include "../src/systems/CombatSimulator.h"
+#include "../src/components/ComponentManager.h"
+#include "test_check.h"
+
+using namespace RPGEngine;
+using namespace RPGEngine::Components;
+using namespace RPGEngine::Systems;
+
+/**
+ * Combat simulation test
+ * Runs batches of headless 4v4 encounters from a snapshot of party and
+ * monster components. Checks that results are reproducible for a seed
+ * whatever the thread count, that single encounters replay, that the
+ * snapshot leaves the game's components alone and that balance changes
+ * show in the win rate, and reports throughput.
+ */
+
+static CombatSkill makeSkill(const std::string& id, CombatActionType type, float damage, float mpCost, float accuracy) {
+    CombatSkill skill(id, id, type);
+    skill.damage = damage;
+    skill.mpCost = mpCost;
+    skill.accuracy = accuracy;
+    skill.criticalChance = 0.05f;
+    return skill;
+}
+
+static void addFighter(ComponentManager& components, EntityId entity, int vitality, int strength, bool caster) {
+    auto stats = components.createComponent<StatsComponent>(Entity(entity));
+    stats->setBaseAttribute(AttributeType::Vitality, vitality);
+    stats->setBaseAttribute(AttributeType::Strength, strength);
+    stats->setCurrentHP(stats->getMaxHP());
+
+    auto combat = components.createComponent<CombatComponent>(Entity(entity));
+    combat->addSkill(makeSkill("slash", CombatActionType::Attack, 6.0f, 0.0f, 0.9f));
+    if (caster) {
+        CombatSkill venom = makeSkill("venom", CombatActionType::Magic, 10.0f, 15.0f, 0.8f);
+        venom.statusEffects.push_back(StatusEffect(StatusEffectType::Poison, "Poison", 3.0f, 1.0f));
+        combat->addSkill(venom);
+    }
+}
+
+static bool sameResult(const CombatSimulationResult& a, const CombatSimulationResult& b) {
+    return a.encounters == b.encounters && a.victories == b.victories && a.defeats == b.defeats &&
+           a.escapes == b.escapes && a.timeouts == b.timeouts && a.totalRounds == b.totalRounds &&
+           a.minRounds == b.minRounds && a.maxRounds == b.maxRounds && a.roundHistogram == b.roundHistogram &&
+           a.actions == b.actions && a.hits == b.hits && a.misses == b.misses && a.criticals == b.criticals &&
+           a.playerDamage == b.playerDamage && a.enemyDamage == b.enemyDamage && a.damageHistogram == b.damageHistogram;
+}
+
+int main() {
+    std::cout << "=== Combat Simulation Test ===" << std::endl;
+    bool allPassed = true;
+
+    ComponentManager components;
+    components.initialize();
+    for (EntityId hero = 1; hero <= 4; ++hero) {
+        addFighter(components, hero, 12, 14, hero % 2 == 0);
+    }
+    for (EntityId monster = 101; monster <= 104; ++monster) {
+        addFighter(components, monster, 12, 14, monster % 2 == 0);
+    }
+
+    int deathCallbacks = 0;
+    auto firstHero = components.getComponent<StatsComponent>(Entity(1));
+    firstHero->setDeathCallback([&deathCallbacks]() { deathCallbacks++; });
+    float heroHP = firstHero->getCurrentHP();
+
+    CombatSimulator simulator;
+    for (EntityId hero = 1; hero <= 4; ++hero) {
+        simulator.addParticipant(components, hero, true);
+    }
+    for (EntityId monster = 101; monster <= 104; ++monster) {
+        simulator.addParticipant(components, monster, false);
+    }
+    allPassed &= check(simulator.getParticipantCount() == 8 && !simulator.addParticipant(components, 1, true) &&
+                       !simulator.addParticipant(components, 999, false), "participants snapshotted");
+
+    // Same seed, same results, whatever the thread count
+    CombatSimulationConfig config;
+    config.encounters = 3000;
+    config.seed = 42;
+    config.threads = 1;
+    CombatSimulationResult single = simulator.run(config);
+    config.threads = 4;
+    CombatSimulationResult parallel = simulator.run(config);
+    allPassed &= check(sameResult(single, parallel) && parallel.threads == 4, "results independent of thread count");
+    allPassed &= check(single.victories + single.defeats + single.escapes + single.timeouts == single.encounters &&
+                       single.encounters == 3000 && single.timeouts == 0, "every encounter finishes");
+    allPassed &= check(single.getWinRate() > 0.3f && single.getWinRate() < 0.7f && single.hits > 0 &&
+                       single.misses > 0 && single.criticals > 0 && single.playerDamage > 0.0 &&
+                       single.enemyDamage > 0.0, "mirror match is balanced");
+
+    config.seed = 43;
+    CombatSimulationResult reseeded = simulator.run(config);
+    allPassed &= check(reseeded.playerDamage != single.playerDamage, "different seed, different fights");
+
+    // Single encounters replay
+    config.seed = 42;
+    CombatSimulationResult first = simulator.runEncounter(config, 17);
+    CombatSimulationResult again = simulator.runEncounter(config, 17);
+    CombatSimulationResult summed;
+    for (uint64_t i = 0; i < 256; ++i) {
+        summed.merge(simulator.runEncounter(config, i));
+    }
+    config.encounters = 256;
+    CombatSimulationResult batch = simulator.run(config);
+    allPassed &= check(sameResult(first, again) && first.encounters == 1, "encounter replays");
+    allPassed &= check(summed.victories == batch.victories && summed.actions == batch.actions &&
+                       summed.hits == batch.hits && summed.totalRounds == batch.totalRounds,
+                       "replayed encounters match the batch");
+
+    allPassed &= check(deathCallbacks == 0 && firstHero->getCurrentHP() == heroHP, "game components untouched");
+
+    // A buffed party wins more often
+    CombatSimulator buffed;
+    for (EntityId hero = 1; hero <= 4; ++hero) {
+        StatsComponent stats = *components.getComponent<StatsComponent>(Entity(hero));
+        stats.setBaseAttribute(AttributeType::Strength, 18);
+        buffed.addParticipant(hero, true, stats, *components.getComponent<CombatComponent>(Entity(hero)));
+    }
+    for (EntityId monster = 101; monster <= 104; ++monster) {
+        buffed.addParticipant(components, monster, false);
+    }
+    config.encounters = 3000;
+    config.threads = 0;
+    CombatSimulationResult buffedResult = buffed.run(config);
+    allPassed &= check(buffedResult.getWinRate() > single.getWinRate() + 0.2f, "balance change shows in win rate");
+
+    // Throughput
+    config.encounters = 20000;
+    config.threads = 0;
+    CombatSimulationResult timed = simulator.run(config);
+    double perSecond = timed.encounters / (timed.elapsedMs / 1000.0);
+    std::cout << "Simulated " << timed.encounters << " 4v4 encounters on " << timed.threads << " threads in "
+              << timed.elapsedMs << " ms (" << static_cast<uint64_t>(perSecond) << " encounters/s, "
+              << std::thread::hardware_concurrency() << " cores)" << std::endl;
+    std::cout << "1M encounters at this rate: " << 1000000.0 / perSecond << " s" << std::endl;
+    std::cout << "Win rate " << timed.getWinRate() * 100.0f << "%, " << timed.getAverageRounds()
+              << " rounds on average (" << timed.minRounds << "-" << timed.maxRounds << "), hit damage p50 "
+              << timed.getDamagePercentile(0.5f) << " / p95 " << timed.getDamagePercentile(0.95f) << std::endl;
+    allPassed &= check(timed.encounters == 20000, "every timed encounter ran");
+
+    std::cout << "\n=== Combat Simulation Test " << (allPassed ? "Complete" : "FAILED") << " ===" << std::endl;
+    return allPassed ? 0 : 1;
+}
@@ -0,0 +1,387 @@
+#include <iostream>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+#include <atomic>
+#include <cstdlib>
+#include <fstream>
+#include <filesystem>
+#include <new>
+#include "../src/resources/ContentDatabase.h"
+#include "../src/resources/ContentCooker.h"
+#include "../src/components/DialogueComponent.h"
+#include "../src/components/QuestComponent.h"
+#include "../src/tools/DialogueEditor.h"
+#include "test_check.h"
+
+using namespace RPGEngine;
+using namespace RPGEngine::Components;
+using namespace RPGEngine::Resources;
+
+/**
+ * Content database test
+ * Cooks 10k dialogue nodes and a set of quests into a content database and
+ * compares the heap used by NPCs that each copy their dialogue trees
+ * against NPCs sharing trees from the mapped database, with nodes decoded
+ * on demand. Checks decoded content, lazy decoding, tree sharing, dialogue
+ * state kept per component on shared trees, on-demand quest definitions,
+ * rejection of damaged files and export from the dialogue editor.
+ */
+
+// Live heap bytes, counted by the replacement allocator below
+static std::atomic<long long> g_liveBytes{0};
+
+void* operator new(std::size_t size) {
+    void* block = std::malloc(size + sizeof(std::max_align_t));
+    if (!block) {
+        throw std::bad_alloc();
+    }
+    *static_cast<std::size_t*>(block) = size;
+    g_liveBytes += static_cast<long long>(size);
+    return static_cast<char*>(block) + sizeof(std::max_align_t);
+}
+
+void operator delete(void* pointer) noexcept {
+    if (!pointer) {
+        return;
+    }
+    void* block = static_cast<char*>(pointer) - sizeof(std::max_align_t);
+    g_liveBytes -= static_cast<long long>(*static_cast<std::size_t*>(block));
+    std::free(block);
+}
+
+void operator delete(void* pointer, std::size_t) noexcept {
+    operator delete(pointer);
+}
+
+static const int TREE_COUNT = 200;
+static const int NODES_PER_TREE = 50;
+static const int NPC_COUNT = 400;
+static const int TREES_PER_NPC = 4;
+
+static std::string treeName(int tree) {
+    return "npc_dialogue_" + std::to_string(tree);
+}
+
+static std::string nodeName(int node) {
+    return "node_" + std::to_string(node);
+}
+
+static DialogueTree makeTree(int index) {
+    DialogueTree tree(treeName(index), "Villager " + std::to_string(index));
+    tree.description = "Conversation with a villager";
+    tree.startNodeId = nodeName(0);
+    tree.variables["mood"] = "neutral";
+
+    for (int n = 0; n < NODES_PER_TREE; ++n) {
+        bool last = n == NODES_PER_TREE - 1;
+        DialogueNode node(nodeName(n), last ? DialogueNodeType::End : DialogueNodeType::Choice);
+        node.speaker = "Villager " + std::to_string(index);
+        node.text = "The harvest was poor this year, and the roads are not safe after dark. (" +
+                    std::to_string(index) + "." + std::to_string(n) + ")";
+        node.metadata["voice"] = "villager_" + std::to_string(index % 8);
+
+        if (!last) {
+            DialogueChoice onward("onward", "Tell me more.", nodeName(n + 1));
+            onward.actions.push_back(DialogueAction("set_variable", "heard_" + std::to_string(n), "yes"));
+            node.choices.push_back(onward);
+
+            DialogueChoice secret("secret", "I know about the smugglers.", nodeName(NODES_PER_TREE - 1));
+            secret.conditions.push_back(DialogueCondition("flag", "knows_smugglers", "==", "true"));
+            node.choices.push_back(secret);
+
+            node.choices.push_back(DialogueChoice("leave", "Farewell.", nodeName(NODES_PER_TREE - 1)));
+        }
+        tree.addNode(node);
+    }
+    return tree;
+}
+
+static QuestDefinition makeQuest(int index) {
+    QuestDefinition quest("errand_" + std::to_string(index), "Errand " + std::to_string(index));
+    quest.description = "Bring supplies to the village";
+    quest.category = "side";
+    quest.level = 1 + index % 10;
+    quest.isRepeatable = index % 2 == 0;
+    quest.addObjective(QuestObjective("gather", "Gather herbs", ObjectiveType::Collect, "herb", 3 + index % 4));
+    quest.addObjective(QuestObjective("deliver", "Deliver the herbs", ObjectiveType::Talk, "healer"));
+    quest.rewards.push_back(QuestReward("experience", "", 50 + index));
+    return quest;
+}
+
+static bool sameNode(const DialogueNode& a, const DialogueNode& b) {
+    if (a.id != b.id || a.type != b.type || a.speaker != b.speaker || a.text != b.text ||
+        a.nextNodeId != b.nextNodeId || a.metadata != b.metadata || a.choices.size() != b.choices.size()) {
+        return false;
+    }
+    for (size_t i = 0; i < a.choices.size(); ++i) {
+        const DialogueChoice& ca = a.choices[i];
+        const DialogueChoice& cb = b.choices[i];
+        if (ca.id != cb.id || ca.text != cb.text || ca.nextNodeId != cb.nextNodeId || ca.enabled != cb.enabled ||
+            ca.visible != cb.visible || ca.conditions.size() != cb.conditions.size() ||
+            ca.actions.size() != cb.actions.size()) {
+            return false;
+        }
+        for (size_t c = 0; c < ca.conditions.size(); ++c) {
+            if (ca.conditions[c].type != cb.conditions[c].type || ca.conditions[c].target != cb.conditions[c].target ||
+                ca.conditions[c].operation != cb.conditions[c].operation ||
+                ca.conditions[c].value != cb.conditions[c].value || ca.conditions[c].negate != cb.conditions[c].negate) {
+                return false;
+            }
+        }
+        for (size_t c = 0; c < ca.actions.size(); ++c) {
+            if (ca.actions[c].type != cb.actions[c].type || ca.actions[c].target != cb.actions[c].target ||
+                ca.actions[c].value != cb.actions[c].value) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+static bool isAvailable(const DialogueComponent& dialogue, const std::string& choiceId) {
+    std::vector<const DialogueChoice*> choices;
+    dialogue.getAvailableChoices(choices);
+    for (const DialogueChoice* choice : choices) {
+        if (choice->id == choiceId) {
+            return true;
+        }
+    }
+    return false;
+}
+
+static void corruptCopy(const std::string& source, const std::string& target, size_t keepBytes, size_t flipOffset) {
+    std::ifstream in(source, std::ios::binary);
+    std::string bytes((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    if (keepBytes < bytes.size()) {
+        bytes.resize(keepBytes);
+    }
+    if (flipOffset < bytes.size()) {
+        bytes[flipOffset] = static_cast<char>(bytes[flipOffset] ^ 0x5A);
+    }
+    std::ofstream out(target, std::ios::binary | std::ios::trunc);
+    out.write(bytes.data(), bytes.size());
+}
+
+int main() {
+    std::cout << "=== Content Database Test ===" << std::endl;
+    bool allPassed = true;
+
+    std::filesystem::path directory = std::filesystem::temp_directory_path() / "rpg_content_database_test";
+    std::filesystem::create_directories(directory);
+    std::string databasePath = (directory / "content.rpdb").string();
+
+    // Cook
+    {
+        ContentCooker cooker;
+        for (int t = 0; t < TREE_COUNT; ++t) {
+            cooker.addDialogueTree(makeTree(t));
+        }
+        for (int q = 0; q < 50; ++q) {
+            cooker.addQuestDefinition(makeQuest(q));
+        }
+        auto cookStart = std::chrono::steady_clock::now();
+        bool written = cooker.write(databasePath);
+        double cookMs = elapsedMs(cookStart);
+        const ContentCookerStats& stats = cooker.getStats();
+        std::cout << "Cooked " << stats.trees << " trees, " << stats.nodes << " nodes, " << stats.quests
+                  << " quests in " << cookMs << " ms: " << stats.databaseBytes << " bytes, " << stats.strings
+                  << " unique strings of " << stats.stringReferences << " references" << std::endl;
+        allPassed &= check(written && stats.nodes == static_cast<size_t>(TREE_COUNT * NODES_PER_TREE),
+                           "10k nodes cooked");
+        allPassed &= check(stats.strings * 2 < stats.stringReferences, "shared text stored once");
+    }
+
+    // Copied: every NPC copies its trees into its own component
+    long long copiedBytes = 0;
+    {
+        std::vector<DialogueTree> loaded;
+        for (int t = 0; t < TREE_COUNT; ++t) {
+            loaded.push_back(makeTree(t));
+        }
+
+        long long baseline = g_liveBytes;
+        std::vector<std::unique_ptr<DialogueComponent>> npcs;
+        for (int i = 0; i < NPC_COUNT; ++i) {
+            auto npc = std::make_unique<DialogueComponent>(i + 1);
+            for (int k = 0; k < TREES_PER_NPC; ++k) {
+                npc->addDialogueTree(loaded[(i * TREES_PER_NPC + k) % TREE_COUNT]);
+            }
+            npcs.push_back(std::move(npc));
+        }
+        copiedBytes = g_liveBytes - baseline;
+    }
+
+    // Shared: NPCs reference shared trees by ID and visit a few nodes each
+    long long sharedBytes = 0;
+    long long allDecodedBytes = 0;
+    size_t mappedBytes = 0;
+    {
+        long long baseline = g_liveBytes;
+        std::shared_ptr<ContentDatabase> database = ContentDatabase::open(databasePath);
+        allPassed &= check(database && database->getTreeCount() == TREE_COUNT &&
+                           database->getNodeCount() == static_cast<size_t>(TREE_COUNT * NODES_PER_TREE) &&
+                           database->getQuestCount() == 50, "database opened");
+        if (!database) {
+            std::cout << "\n=== Content Database Test FAILED ===" << std::endl;
+            return 1;
+        }
+        mappedBytes = database->getMappedSize();
+
+        std::vector<std::unique_ptr<DialogueComponent>> npcs;
+        for (int i = 0; i < NPC_COUNT; ++i) {
+            auto npc = std::make_unique<DialogueComponent>(i + 1);
+            npc->setDialogueTreeSource([database](const std::string& treeId) {
+                return database->getDialogueTree(treeId);
+            });
+            npc->startDialogue(treeName((i * TREES_PER_NPC) % TREE_COUNT));
+            npc->advanceDialogue("onward");
+            npc->advanceDialogue("onward");
+            npcs.push_back(std::move(npc));
+        }
+        sharedBytes = g_liveBytes - baseline;
+
+        // Every node decoded once is still shared by every component
+        std::vector<std::shared_ptr<const DialogueTree>> trees;
+        for (int t = 0; t < TREE_COUNT; ++t) {
+            trees.push_back(database->getDialogueTree(treeName(t)));
+            for (int n = 0; n < NODES_PER_TREE; ++n) {
+                trees.back()->getNode(nodeName(n));
+            }
+        }
+        allDecodedBytes = g_liveBytes - baseline;
+    }
+
+    std::cout << "Heap with " << NPC_COUNT << " NPCs copying trees: " << copiedBytes / 1024 << " KB" << std::endl;
+    std::cout << "Heap with " << NPC_COUNT << " NPCs sharing mapped trees: " << sharedBytes / 1024
+              << " KB, plus " << mappedBytes / 1024 << " KB mapped" << std::endl;
+    std::cout << "Heap with all 10k nodes decoded once: " << allDecodedBytes / 1024 << " KB" << std::endl;
+    allPassed &= check(sharedBytes * 10 < copiedBytes, "shared lazily decoded trees use a fraction of the heap");
+    allPassed &= check(allDecodedBytes < copiedBytes, "fully decoded database still smaller than per-NPC copies");
+
+    std::shared_ptr<ContentDatabase> database = ContentDatabase::open(databasePath);
+
+    // Decoded content matches the source
+    {
+        DialogueTree source = makeTree(17);
+        bool matches = true;
+        for (int n = 0; n < NODES_PER_TREE; ++n) {
+            DialogueNode decoded;
+            matches &= database->loadDialogueNode(treeName(17), nodeName(n), decoded) &&
+                       sameNode(decoded, *source.getNode(nodeName(n)));
+        }
+        DialogueNode missing;
+        allPassed &= check(matches, "decoded nodes match the cooked nodes");
+        allPassed &= check(!database->loadDialogueNode(treeName(17), "node_999", missing) &&
+                           !database->hasDialogueTree("nobody") && database->hasDialogueTree(treeName(3)),
+                           "missing trees and nodes not found");
+    }
+
+    // Nodes decoded on first use only
+    {
+        std::shared_ptr<const DialogueTree> tree = database->getDialogueTree(treeName(5));
+        allPassed &= check(tree && tree->nodes.empty() && tree->getNodeCount() == NODES_PER_TREE &&
+                           tree->hasNode(nodeName(7)) && tree->name == "Villager 5" &&
+                           tree->variables.at("mood") == "neutral", "tree opened without decoding nodes");
+
+        const DialogueNode* node = tree->getNode(nodeName(7));
+        allPassed &= check(node && tree->nodes.size() == 1 && node->choices.size() == 3 &&
+                           node->choices[1].compiledConditions != DialogueProgram::NO_CONDITIONS &&
+                           node->choices[0].actions[0].op == DialogueActionOp::SetVariable,
+                           "node decoded and compiled on first use");
+        allPassed &= check(tree->getNode(nodeName(7)) == node && tree->nodes.size() == 1 &&
+                           !tree->getNode("node_999"), "decoded node reused");
+    }
+
+    // Trees shared while held, released when no one holds them
+    {
+        auto first = std::make_shared<DialogueComponent>(1);
+        auto second = std::make_shared<DialogueComponent>(2);
+        first->addSharedDialogueTree(database->getDialogueTree(treeName(9)));
+        second->addSharedDialogueTree(database->getDialogueTree(treeName(9)));
+        allPassed &= check(first->getDialogueTree(treeName(9)) == second->getDialogueTree(treeName(9)) &&
+                           database->getLiveTreeCount() == 1 && first->getDialogueTrees().empty(),
+                           "components share one tree");
+
+        // Each component keeps its own state on the shared tree
+        first->startDialogue(treeName(9));
+        second->startDialogue(treeName(9));
+        first->setFlag("knows_smugglers", true);
+        allPassed &= check(isAvailable(*first, "secret") && !isAvailable(*second, "secret") &&
+                           isAvailable(*first, "secret"), "condition results kept per component");
+
+        allPassed &= check(first->advanceDialogue("onward") && first->getVariable("heard_0") == "yes" &&
+                           second->getVariable("heard_0").empty() &&
+                           first->getCurrentNode()->id == nodeName(1), "actions run on shared tree");
+        allPassed &= check(first->advanceDialogue("secret") && first->getCurrentNode()->type == DialogueNodeType::End,
+                           "dialogue walks shared tree");
+
+        first.reset();
+        second.reset();
+        allPassed &= check(database->getLiveTreeCount() == 0, "tree released with its last component");
+    }
+
+    // Quest definitions decoded on first use
+    {
+        database->installQuestDefinitionSource();
+        allPassed &= check(QuestComponent::getQuestDefinitions().count("errand_12") == 0, "quests not loaded up front");
+
+        QuestComponent quests(1);
+        allPassed &= check(quests.startQuest("errand_12"), "quest started from database");
+        const QuestDefinition* definition = QuestComponent::getQuestDefinition("errand_12");
+        allPassed &= check(definition && definition->name == "Errand 12" && definition->level == 3 &&
+                           definition->isRepeatable && definition->objectives.size() == 2 &&
+                           definition->objectives[0].requiredCount == 3 &&
+                           definition->objectives[0].type == ObjectiveType::Collect &&
+                           definition->rewards.size() == 1 && definition->rewards[0].amount == 62,
+                           "quest definition decoded");
+        allPassed &= check(!QuestComponent::getQuestDefinition("errand_99") &&
+                           QuestComponent::getQuestDefinitions().size() == 1, "missing quest not registered");
+        QuestComponent::setQuestDefinitionSource(nullptr);
+    }
+
+    // Damaged files rejected
+    {
+        std::string damagedPath = (directory / "damaged.rpdb").string();
+        corruptCopy(databasePath, damagedPath, static_cast<size_t>(-1), 0);
+        bool badMagic = !ContentDatabase::open(damagedPath);
+        corruptCopy(databasePath, damagedPath, mappedBytes / 2, static_cast<size_t>(-1));
+        bool truncated = !ContentDatabase::open(damagedPath);
+        corruptCopy(databasePath, damagedPath, sizeof(ContentHeader) - 1, static_cast<size_t>(-1));
+        bool headerOnly = !ContentDatabase::open(damagedPath);
+        allPassed &= check(badMagic && truncated && headerOnly && !ContentDatabase::open((directory / "none.rpdb").string()),
+                           "damaged or missing databases rejected");
+    }
+
+    // Cooked from the dialogue editor
+    {
+        Engine::Tools::DialogueEditor editor;
+        editor.createDialogueTree("blacksmith");
+        editor.setCurrentDialogueTree("blacksmith");
+        std::string greeting = editor.createNode(0.0f, 0.0f);
+        std::string farewell = editor.createNode(100.0f, 0.0f);
+        editor.setNodeSpeaker(greeting, "Smith");
+        editor.setNodeText(greeting, "Need a blade sharpened?");
+        editor.setNodeText(farewell, "Come back anytime.");
+        editor.addChoice(greeting, Engine::Tools::DialogueChoice{"Yes, please.", farewell, "gold >= 5", true});
+        editor.addChoice(greeting, Engine::Tools::DialogueChoice{"Not today.", farewell, "", false});
+
+        std::string editorPath = (directory / "editor.rpdb").string();
+        bool exported = editor.exportContentDatabase(editorPath);
+        std::shared_ptr<ContentDatabase> exportedDatabase = ContentDatabase::open(editorPath);
+        std::shared_ptr<const DialogueTree> tree = exportedDatabase ? exportedDatabase->getDialogueTree("blacksmith") : nullptr;
+        const DialogueNode* node = tree ? tree->getNode(tree->startNodeId) : nullptr;
+        allPassed &= check(exported && node && node->speaker == "Smith" && node->type == DialogueNodeType::Choice &&
+                           node->choices.size() == 2 && node->choices[0].nextNodeId == farewell &&
+                           !node->choices[1].enabled && node->metadata.at("condition:choice_0") == "gold >= 5" &&
+                           tree->getNode(farewell) && tree->getNode(farewell)->text == "Come back anytime.",
+                           "editor export opens as a content database");
+    }
+
+    database.reset();
+    std::filesystem::remove_all(directory);
+
+    std::cout << "\n=== Content Database Test " << (allPassed ? "Complete" : "FAILED") << " ===" << std::endl;
+    return allPassed ? 0 : 1;
+}
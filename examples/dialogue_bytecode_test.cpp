@@ -0,0 +1,278 @@
+#include <iostream>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+#include "../src/components/DialogueComponent.h"
+#include "../src/components/QuestComponent.h"
+#include "../src/components/StatsComponent.h"
+#include "../src/components/InventoryComponent.h"
+#include "../src/systems/QuestDialogueIntegration.h"
+#include "test_check.h"
+
+using namespace RPGEngine;
+using namespace RPGEngine::Components;
+
+/**
+ * Dialogue bytecode test
+ * Builds a dialogue tree with many conditional choices and compares the
+ * string-comparing condition evaluation DialogueComponent used to do
+ * against the compiled programs, with and without cached results. Checks
+ * that compiled results match, that caches follow flag, variable and quest
+ * changes, and that QuestDialogueIntegration evaluates compiled quest
+ * conditions.
+ */
+
+// How evaluateCondition compared flags and variables before compilation
+static bool legacyEvaluate(const DialogueState& state, const DialogueCondition& condition) {
+    bool result = false;
+    if (condition.type == "flag") {
+        bool flagValue = state.getFlag(condition.target, false);
+        if (condition.operation == "==" || condition.operation == "equals") {
+            result = flagValue == (condition.value == "true");
+        } else if (condition.operation == "!=" || condition.operation == "not_equals") {
+            result = flagValue != (condition.value == "true");
+        }
+    } else if (condition.type == "variable") {
+        std::string varValue = state.getVariable(condition.target, "");
+        if (condition.operation == "==" || condition.operation == "equals") {
+            result = varValue == condition.value;
+        } else if (condition.operation == "!=" || condition.operation == "not_equals") {
+            result = varValue != condition.value;
+        } else if (condition.operation == "contains") {
+            result = varValue.find(condition.value) != std::string::npos;
+        }
+    }
+    return condition.negate ? !result : result;
+}
+
+static size_t legacyAvailableChoices(const DialogueState& state, const DialogueNode& node) {
+    size_t available = 0;
+    for (const auto& choice : node.choices) {
+        bool passed = true;
+        for (const auto& condition : choice.conditions) {
+            if (!legacyEvaluate(state, condition)) {
+                passed = false;
+                break;
+            }
+        }
+        if (passed) {
+            available++;
+        }
+    }
+    return available;
+}
+
+static DialogueTree makeTavern(int choiceCount) {
+    DialogueTree tree("tavern", "Tavern");
+    tree.startNodeId = "bar";
+
+    DialogueNode bar("bar", DialogueNodeType::Choice);
+    for (int i = 0; i < choiceCount; ++i) {
+        DialogueChoice choice("rumor_" + std::to_string(i), "Ask about rumor " + std::to_string(i), "end");
+        choice.conditions.push_back(DialogueCondition("flag", "met_keeper", "==", "true"));
+        choice.conditions.push_back(DialogueCondition("variable", "rumor_" + std::to_string(i % 5), "!=", "told"));
+        choice.conditions.push_back(DialogueCondition("variable", "reputation", "equals", i % 2 ? "friendly" : "trusted"));
+        choice.conditions.push_back(DialogueCondition("variable", "title", "contains", "Sir", i % 3 == 0));
+        bar.choices.push_back(choice);
+    }
+
+    DialogueChoice greet("greet", "Greet the keeper", "end");
+    greet.conditions.push_back(DialogueCondition("flag", "met_keeper", "!=", "true"));
+    greet.actions.push_back(DialogueAction("set_flag", "met_keeper", "true"));
+    bar.choices.push_back(greet);
+
+    DialogueChoice gamble("gamble", "Play dice", "end");
+    gamble.conditions.push_back(DialogueCondition("variable", "gold", ">=", "50"));
+    bar.choices.push_back(gamble);
+
+    DialogueChoice report("report", "Report the cellar", "end");
+    report.conditions.push_back(DialogueCondition("quest_active", "rats"));
+    report.conditions.push_back(DialogueCondition("objective_completed", "rats:cellar"));
+    report.conditions.push_back(DialogueCondition("quest_variable", "rats:killed", ">", "9"));
+    bar.choices.push_back(report);
+
+    DialogueChoice join("join", "Join the guild", "end");
+    join.conditions.push_back(DialogueCondition("quest_completed", "rats"));
+    bar.choices.push_back(join);
+
+    tree.addNode(bar);
+    tree.addNode(DialogueNode("end", DialogueNodeType::End));
+    return tree;
+}
+
+static bool isAvailable(const DialogueComponent& dialogue, const std::string& choiceId) {
+    std::vector<const DialogueChoice*> choices;
+    dialogue.getAvailableChoices(choices);
+    for (const DialogueChoice* choice : choices) {
+        if (choice->id == choiceId) {
+            return true;
+        }
+    }
+    return false;
+}
+
+int main() {
+    std::cout << "=== Dialogue Bytecode Test ===" << std::endl;
+    bool allPassed = true;
+
+    const int choiceCount = 60;
+    auto dialogue = std::make_shared<DialogueComponent>(1);
+    dialogue->addDialogueTree(makeTavern(choiceCount));
+    const DialogueTree* tree = dialogue->getDialogueTree("tavern");
+    const DialogueNode* bar = tree->getNode("bar");
+    allPassed &= check(tree->program.getListCount() == static_cast<size_t>(choiceCount + 4) &&
+                       bar->choices[0].compiledConditions != DialogueProgram::NO_CONDITIONS &&
+                       bar->choices[choiceCount].actions[0].op == DialogueActionOp::SetFlag, "tree compiled when added");
+
+    dialogue->startDialogue("tavern");
+    dialogue->setFlag("met_keeper", true);
+    dialogue->setVariable("reputation", "friendly");
+    dialogue->setVariable("rumor_2", "told");
+    dialogue->setVariable("title", "Sir Galen");
+
+    // Compiled results match string evaluation across states
+    bool matches = true;
+    size_t totalRumors = 0;
+    const char* reputations[] = {"friendly", "trusted", "hostile"};
+    const char* titles[] = {"Sir Galen", "Galen"};
+    for (const char* reputation : reputations) {
+        for (const char* title : titles) {
+            dialogue->setVariable("reputation", reputation);
+            dialogue->setVariable("title", title);
+            std::vector<const DialogueChoice*> choices;
+            dialogue->getAvailableChoices(choices);
+            size_t compiledRumors = 0;
+            for (const DialogueChoice* choice : choices) {
+                compiledRumors += choice->id.compare(0, 6, "rumor_") == 0 ? 1 : 0;
+            }
+            DialogueNode rumorsOnly = *bar;
+            rumorsOnly.choices.resize(choiceCount);
+            matches &= compiledRumors == legacyAvailableChoices(dialogue->getDialogueState(), rumorsOnly);
+            totalRumors += compiledRumors;
+        }
+    }
+    allPassed &= check(matches && totalRumors > 0, "compiled conditions match string evaluation");
+    dialogue->setVariable("reputation", "friendly");
+    dialogue->setVariable("title", "Sir Galen");
+
+    // String evaluation: every query string-compares every condition of every choice
+    const int queries = 20000;
+    size_t sink = 0;
+    DialogueNode rumorsOnly = *bar;
+    rumorsOnly.choices.resize(choiceCount);
+    auto legacyStart = std::chrono::steady_clock::now();
+    for (int i = 0; i < queries; ++i) {
+        sink += legacyAvailableChoices(dialogue->getDialogueState(), rumorsOnly);
+    }
+    double legacyMs = elapsedMs(legacyStart);
+
+    // Compiled instructions, with the cache dropped before every query
+    auto compiledStart = std::chrono::steady_clock::now();
+    for (int i = 0; i < queries; ++i) {
+        tree->program.invalidateCache();
+        for (int c = 0; c < choiceCount; ++c) {
+            sink += dialogue->evaluateConditions(tree->program, bar->choices[c].compiledConditions) ? 1 : 0;
+        }
+    }
+    double compiledMs = elapsedMs(compiledStart);
+
+    // Unchanged state, results served from the cache
+    auto cachedStart = std::chrono::steady_clock::now();
+    for (int i = 0; i < queries; ++i) {
+        for (int c = 0; c < choiceCount; ++c) {
+            sink += dialogue->evaluateConditions(tree->program, bar->choices[c].compiledConditions) ? 1 : 0;
+        }
+    }
+    double cachedMs = elapsedMs(cachedStart);
+
+    std::cout << "String evaluation: " << legacyMs << " ms for " << queries << " queries of "
+              << choiceCount << " choices" << std::endl;
+    std::cout << "Compiled evaluation: " << compiledMs << " ms" << std::endl;
+    std::cout << "Cached results: " << cachedMs << " ms" << std::endl;
+    allPassed &= check(sink > 0, "timed queries found available choices");
+
+    // Caches follow flags and typed variables
+    dialogue->setVariable("gold", "120");
+    allPassed &= check(isAvailable(*dialogue, "gamble"), "numeric comparison");
+    dialogue->setVariable("gold", "9");
+    allPassed &= check(!isAvailable(*dialogue, "gamble"), "cache dropped when a variable changes");
+    dialogue->setVariable("gold", "lots");
+    allPassed &= check(!isAvailable(*dialogue, "gamble"), "ordering of non-numbers fails");
+
+    dialogue->setFlag("met_keeper", false);
+    allPassed &= check(isAvailable(*dialogue, "greet") && !isAvailable(*dialogue, "rumor_1"), "cache dropped when a flag changes");
+    allPassed &= check(dialogue->advanceDialogue("greet") && dialogue->getFlag("met_keeper"), "compiled action executed");
+
+    DialogueComponent restored(2);
+    restored.addDialogueTree(makeTavern(choiceCount));
+    restored.deserialize(dialogue->serialize());
+    restored.startDialogue("tavern");
+    allPassed &= check(!isAvailable(restored, "greet") && isAvailable(restored, "rumor_1"), "deserialized state used by conditions");
+    allPassed &= check(restored.evaluateCondition(DialogueCondition("variable", "title", "contains", "Sir")) &&
+                       !restored.evaluateCondition(DialogueCondition("flag", "met_keeper", "==", "true", true)),
+                       "single conditions still evaluate");
+
+    // Quest conditions through QuestDialogueIntegration
+    QuestDefinition rats("rats", "Rats in the Cellar");
+    rats.addObjective(QuestObjective("cellar", "Clear the cellar", ObjectiveType::Kill, "rat", 2));
+    QuestComponent::registerQuestDefinition(rats);
+
+    auto quests = std::make_shared<QuestComponent>(1);
+    Systems::QuestDialogueIntegration integration(nullptr);
+    integration.initialize();
+    integration.registerDialogueComponent(1, dialogue);
+    dialogue->startDialogue("tavern");
+    allPassed &= check(!isAvailable(*dialogue, "report"), "no quest component, no quest");
+    integration.registerQuestComponent(1, quests);
+
+    quests->startQuest("rats");
+    quests->trackKill("rat", 2);
+    allPassed &= check(!isAvailable(*dialogue, "report"), "quest variable not set yet");
+    quests->setQuestVariable("rats", "killed", "12");
+    allPassed &= check(isAvailable(*dialogue, "report") && !isAvailable(*dialogue, "join"), "compiled quest conditions");
+    quests->completeQuest("rats");
+    allPassed &= check(!isAvailable(*dialogue, "report") && isAvailable(*dialogue, "join"), "cache dropped when quest state changes");
+    allPassed &= check(integration.handleDialogueCondition(1, DialogueCondition("quest_completed", "rats")) &&
+                       !integration.handleDialogueCondition(1, DialogueCondition("quest_completed", "rats", "==", "", true)),
+                       "external evaluator shares the compiler");
+
+    integration.unregisterQuestComponent(1);
+    allPassed &= check(!isAvailable(*dialogue, "join"), "cache dropped when quest components change");
+
+    // Stat and item conditions read the registered components, uncached
+    DialogueCondition strong("stat", "strength", ">=", "15");
+    DialogueCondition hurt("stat", "hp", "<", "50");
+    DialogueCondition hasKey("item", "cellar_key");
+    DialogueCondition keys("item", "cellar_key", ">", "1");
+    allPassed &= check(!dialogue->evaluateCondition(strong) && !dialogue->evaluateCondition(hasKey) &&
+                       dialogue->evaluateCondition(DialogueCondition("item", "cellar_key", "==", "", true)),
+                       "no stats or inventory, no stat or item");
+
+    auto stats = std::make_shared<StatsComponent>(1);
+    stats->setVerbose(false);
+    stats->setBaseAttribute(AttributeType::Strength, 12);
+    InventoryComponent::registerItemDefinition(ItemDefinition("cellar_key", "Cellar Key", ItemType::Misc, 5));
+    auto inventory = std::make_shared<InventoryComponent>(1);
+    integration.registerStatsComponent(1, stats);
+    integration.registerInventoryComponent(1, inventory);
+    allPassed &= check(!dialogue->evaluateCondition(strong) && !dialogue->evaluateCondition(hasKey), "stat and item below the value");
+    stats->setBaseAttribute(AttributeType::Strength, 15);
+    stats->setCurrentHP(20.0f);
+    inventory->addItem("cellar_key", 1);
+    allPassed &= check(dialogue->evaluateCondition(strong) && dialogue->evaluateCondition(hurt) &&
+                       dialogue->evaluateCondition(hasKey) && !dialogue->evaluateCondition(keys),
+                       "stat and item changes seen without a version");
+    inventory->addItem("cellar_key", 1);
+    allPassed &= check(dialogue->evaluateCondition(keys), "item quantity compared");
+
+    DialogueProgram invalid;
+    int32_t invalidList = invalid.compileConditions({DialogueCondition("stat", "charm", ">", "3"),
+                                                     DialogueCondition("item", "cellar_key", "about", "2")});
+    allPassed &= check(invalid.getInstruction(invalid.getList(invalidList).first).opcode == DialogueOpcode::Constant &&
+                       !dialogue->evaluateConditions(invalid, invalidList), "unknown stats and operations never pass");
+    integration.shutdown();
+
+    std::cout << "\n=== Dialogue Bytecode Test " << (allPassed ? "Complete" : "FAILED") << " ===" << std::endl;
+    return allPassed ? 0 : 1;
+}
@@ -0,0 +1,204 @@
+#include <iostream>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "../src/save/SaveManager.h"
+#include "../src/save/BinarySaveSerializer.h"
+#include "test_check.h"
+
+using namespace Engine::Save;
+namespace fs = std::filesystem;
+
+/**
+ * Journaled save test
+ * Saves a large world once, then compares rewriting the whole save after a
+ * handful of changes against appending those changes with
+ * SaveManager::saveDelta. Checks that loads replay the journal, torn
+ * records from a crash are skipped by loads and cut off by the next append,
+ * loads wait for background saves, stale journals are ignored, and that
+ * compaction folds the journal into a new checkpoint.
+ */
+
+static SaveData makeWorld(int size) {
+    SaveData data;
+    data.version = "1.0";
+    data.player.stats.level = 20;
+    data.world.currentMap = "capital";
+    for (int i = 0; i < size; ++i) {
+        data.world.gameFlags["flag_" + std::to_string(i)] = false;
+        data.world.npcStates["npc_" + std::to_string(i)] = "{\"mood\":\"neutral\",\"node\":" + std::to_string(i % 30) + "}";
+        data.world.discoveredLocations["location_" + std::to_string(i % 500)] = false;
+    }
+    return data;
+}
+
+// A few minutes of play: a quest step, a handful of NPCs, a new map
+static SaveDelta makeChanges(int round) {
+    SaveDelta delta;
+    for (int i = 0; i < 10; ++i) {
+        delta.setFlag("flag_" + std::to_string(round * 10 + i), true);
+        delta.setNpcState("npc_" + std::to_string(round * 7 + i), "{\"mood\":\"friendly\",\"round\":" + std::to_string(round) + "}");
+    }
+    delta.setLocationDiscovered("location_" + std::to_string(round), true);
+    delta.completeQuest("quest_" + std::to_string(round));
+    delta.setCurrentMap("map_" + std::to_string(round));
+    return delta;
+}
+
+static bool sameWorld(const SaveData& a, const SaveData& b) {
+    return a.player.stats.level == b.player.stats.level && a.world.currentMap == b.world.currentMap &&
+           a.world.gameFlags == b.world.gameFlags && a.world.npcStates == b.world.npcStates &&
+           a.world.discoveredLocations == b.world.discoveredLocations &&
+           a.world.completedQuests == b.world.completedQuests && a.customData == b.customData;
+}
+
+int main() {
+    std::cout << "=== Journaled Save Test ===" << std::endl;
+    bool allPassed = true;
+
+    const std::string dir = "journal_save_tmp";
+    fs::remove_all(dir);
+
+    SaveManager manager;
+    manager.setSerializer(std::make_unique<BinarySaveSerializer>());
+    manager.setCompressionEnabled(true);
+    manager.setBackupEnabled(false);
+    manager.initialize(dir);
+
+    const std::string journal = dir + "/world.sav.journal";
+    SaveData expected = makeWorld(30000);
+    allPassed &= check(manager.saveGame(expected, "world") == SaveResult::Success, "checkpoint saved");
+    allPassed &= check(manager.saveDelta(makeChanges(0), "missing") == SaveResult::FileError,
+                       "delta without a checkpoint rejected");
+
+    // Full save: rewrites the whole world
+    SaveDelta first = makeChanges(1);
+    first.applyTo(expected);
+    auto fullStart = std::chrono::steady_clock::now();
+    manager.saveGame(expected, "full");
+    double fullMs = elapsedMs(fullStart);
+    size_t fullBytes = static_cast<size_t>(fs::file_size(dir + "/full.sav"));
+
+    // Delta save: only the changes are appended
+    auto deltaStart = std::chrono::steady_clock::now();
+    SaveResult deltaResult = manager.saveDelta(first, "world");
+    double deltaMs = elapsedMs(deltaStart);
+    size_t deltaBytes = static_cast<size_t>(fs::file_size(journal));
+
+    std::cout << "Full save: " << fullMs << " ms, " << fullBytes << " bytes" << std::endl;
+    std::cout << "Delta save: " << deltaMs << " ms, " << deltaBytes << " bytes of journal" << std::endl;
+
+    allPassed &= check(deltaResult == SaveResult::Success && deltaBytes * 50 < fullBytes, "delta is a small fraction of the save");
+
+    for (int round = 2; round <= 5; ++round) {
+        SaveDelta delta = makeChanges(round);
+        delta.applyTo(expected);
+        manager.saveDelta(delta, "world");
+    }
+    SaveData loaded;
+    allPassed &= check(manager.loadGame(loaded, "world") == LoadResult::Success && sameWorld(loaded, expected) &&
+                       loaded.world.currentMap == "map_5", "load replays the journal");
+
+    SaveDelta repeated;
+    repeated.completeQuest("quest_3");
+    manager.saveDelta(repeated, "world");
+    SaveData afterRepeat;
+    manager.loadGame(afterRepeat, "world");
+    allPassed &= check(afterRepeat.world.completedQuests == expected.world.completedQuests, "completed quests recorded once");
+
+    // Crash mid-append: loads skip the torn record without touching the
+    // journal, and the next append cuts it off
+    size_t goodSize = static_cast<size_t>(fs::file_size(journal));
+    {
+        std::ofstream file(journal, std::ios::binary | std::ios::app);
+        file.write("\x40\x00\x00\x00\x12\x34", 6);
+    }
+    SaveData afterCrash;
+    allPassed &= check(manager.loadGame(afterCrash, "world") == LoadResult::Success && sameWorld(afterCrash, expected) &&
+                       fs::file_size(journal) == goodSize + 6, "torn record skipped on load");
+
+    SaveDelta afterRecovery = makeChanges(6);
+    afterRecovery.applyTo(expected);
+    manager.saveDelta(afterRecovery, "world");
+    SaveData recovered;
+    allPassed &= check(manager.loadGame(recovered, "world") == LoadResult::Success && sameWorld(recovered, expected),
+                       "append cuts off the torn record");
+
+    // Player state is validated like a full save
+    SaveDelta badPlayer;
+    badPlayer.setPlayer(expected.player);
+    badPlayer.player.stats.hp = badPlayer.player.stats.maxHp + 1;
+    allPassed &= check(manager.saveDelta(badPlayer, "world") == SaveResult::ValidationError, "invalid player delta rejected");
+
+    // A full save is a new checkpoint; a journal for the old one is ignored
+    fs::copy_file(journal, dir + "/stale.journal");
+    SaveData reset = makeWorld(100);
+    manager.saveGame(reset, "world");
+    allPassed &= check(!fs::exists(journal), "full save clears the journal");
+    fs::copy_file(dir + "/stale.journal", journal);
+    SaveData afterReset;
+    allPassed &= check(manager.loadGame(afterReset, "world") == LoadResult::Success && sameWorld(afterReset, reset),
+                       "stale journal ignored");
+
+    SaveDelta restarted = makeChanges(7);
+    restarted.applyTo(reset);
+    manager.saveDelta(restarted, "world");
+    SaveData afterRestart;
+    allPassed &= check(manager.loadGame(afterRestart, "world") == LoadResult::Success && sameWorld(afterRestart, reset),
+                       "stale journal restarted on the next delta");
+
+    // Compaction folds the journal into the checkpoint
+    manager.setMaxJournalSize(4096);
+    for (int round = 8; round < 30; ++round) {
+        SaveDelta delta = makeChanges(round);
+        delta.applyTo(reset);
+        allPassed &= delta.isEmpty() || manager.saveDelta(delta, "world") == SaveResult::Success;
+    }
+    SaveData compacted;
+    allPassed &= check(fs::file_size(journal) <= 4096 && manager.loadGame(compacted, "world") == LoadResult::Success &&
+                       sameWorld(compacted, reset), "journal compacted past the size limit");
+
+    allPassed &= check(manager.compactJournal("world") == SaveResult::Success && !fs::exists(journal) &&
+                       manager.loadGame(compacted, "world") == LoadResult::Success && sameWorld(compacted, reset),
+                       "explicit compaction");
+
+    // Background deltas share the save worker with full saves
+    std::vector<std::string> completed;
+    SaveData asyncExpected = makeWorld(1000);
+    manager.saveGameAsync(asyncExpected, "async");
+    for (int round = 0; round < 3; ++round) {
+        SaveDelta delta = makeChanges(round);
+        delta.applyTo(asyncExpected);
+        manager.saveDeltaAsync(delta, "async", [&](SaveResult result, const std::string& slot) {
+            if (result == SaveResult::Success) {
+                completed.push_back(slot);
+            }
+        });
+    }
+    manager.waitForSaves();
+    manager.update();
+    SaveData asyncLoaded;
+    allPassed &= check(completed.size() == 3 && manager.loadGame(asyncLoaded, "async") == LoadResult::Success &&
+                       sameWorld(asyncLoaded, asyncExpected), "background deltas applied in order");
+
+    // Loads wait for queued saves rather than reading a journal mid-append
+    SaveData racedExpected = asyncExpected;
+    for (int round = 3; round < 6; ++round) {
+        SaveDelta delta = makeChanges(round);
+        delta.applyTo(racedExpected);
+        manager.saveDeltaAsync(delta, "async");
+    }
+    SaveData raced;
+    allPassed &= check(manager.loadGame(raced, "async") == LoadResult::Success && sameWorld(raced, racedExpected),
+                       "load waits for background deltas");
+    manager.update();
+
+    allPassed &= check(manager.deleteSave("async") && !fs::exists(dir + "/async.sav.journal"), "delete removes the journal");
+
+    fs::remove_all(dir);
+
+    std::cout << "\n=== Journaled Save Test " << (allPassed ? "Complete" : "FAILED") << " ===" << std::endl;
+    return allPassed ? 0 : 1;
+}
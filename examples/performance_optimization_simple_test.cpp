@@ -2,8 +2,10 @@
 #include <chrono>
 #include <vector>
 #include <random>
+#include <algorithm>
 #include "../src/graphics/FrustumCuller.h"
 #include "../src/graphics/Camera.h"
+#include "../src/graphics/SpatialCuller.h"
 #include "../src/core/ThreadPool.h"
 #include "../src/core/MemoryPool.h"
 
@@ -143,6 +145,61 @@ int main() {
     std::cout << "With culling - processed: " << visibleCount2 << " rectangles in " << cullingDuration.count() << " microseconds" << std::endl;
     std::cout << "Culling efficiency: " << (float)visibleCount2 / visibleCount1 * 100 << "% rectangles visible" << std::endl;
     
+    // Test 4: Spatially indexed culling
+    std::cout << "\n4. Testing Spatially Indexed Culling..." << std::endl;
+    
+    // Large map of decorative props
+    std::uniform_real_distribution<float> worldDist(-20000, 20000);
+    std::vector<Rect> props;
+    props.reserve(50000);
+    for (int i = 0; i < 50000; ++i) {
+        props.push_back(Rect(worldDist(gen), worldDist(gen), 32, 32));
+    }
+    
+    SpatialCuller spatialCuller(256.0f);
+    for (size_t i = 0; i < props.size(); ++i) {
+        spatialCuller.addProxy(props[i], static_cast<uint32_t>(i));
+    }
+    
+    start = std::chrono::high_resolution_clock::now();
+    
+    std::vector<uint32_t> linearVisible;
+    for (size_t i = 0; i < props.size(); ++i) {
+        if (culler.isRectVisible(props[i])) {
+            linearVisible.push_back(static_cast<uint32_t>(i));
+        }
+    }
+    
+    auto linearTime = std::chrono::high_resolution_clock::now();
+    
+    std::vector<uint32_t> indexedVisible;
+    culler.cullIndexed(spatialCuller, indexedVisible);
+    
+    auto indexedTime = std::chrono::high_resolution_clock::now();
+    
+    auto linearDuration = std::chrono::duration_cast<std::chrono::microseconds>(linearTime - start);
+    auto indexedDuration = std::chrono::duration_cast<std::chrono::microseconds>(indexedTime - linearTime);
+    
+    std::cout << "Linear scan - visible: " << linearVisible.size() << " of " << props.size() << " in " << linearDuration.count() << " microseconds" << std::endl;
+    std::cout << "Indexed query - visible: " << indexedVisible.size() << ", candidates tested: " << spatialCuller.getLastCandidateCount() << " in " << indexedDuration.count() << " microseconds" << std::endl;
+    
+    if (linearVisible != indexedVisible) {
+        std::cout << "ERROR: Indexed culling result differs from linear scan" << std::endl;
+        return 1;
+    }
+    
+    // Moving and removing proxies keeps results consistent
+    spatialCuller.updateProxy(0, Rect(0, 0, 32, 32));
+    spatialCuller.removeProxy(1);
+    culler.cullIndexed(spatialCuller, indexedVisible);
+    bool foundMoved = std::find(indexedVisible.begin(), indexedVisible.end(), 0u) != indexedVisible.end();
+    bool foundRemoved = std::find(indexedVisible.begin(), indexedVisible.end(), 1u) != indexedVisible.end();
+    if (!foundMoved || foundRemoved) {
+        std::cout << "ERROR: Proxy update/remove not reflected in culling" << std::endl;
+        return 1;
+    }
+    std::cout << "Indexed culling matches linear scan" << std::endl;
+    
     std::cout << "\n=== Simple Performance Optimization Test Complete ===" << std::endl;
     std::cout << "All optimizations are working correctly!" << std::endl;
     
@@ -0,0 +1,199 @@
+#include <iostream>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "../src/resources/ResourceManager.h"
+#include "../src/resources/PreloadManifest.h"
+#include "test_check.h"
+
+using namespace RPGEngine::Resources;
+
+/**
+ * Preload manifest test
+ * Records the resources a scene loads into a manifest, round-trips it
+ * through a file, and compares the first frame of the scene without a
+ * manifest (every resource loads on first use) against the same frame
+ * after preloading the manifest through the async pipeline.
+ */
+
+/**
+ * Resource with a fixed decode cost, standing in for a texture or sound
+ */
+class SlowResource : public Resource {
+public:
+    SlowResource(const std::string& id, const std::string& path, ResourceCategory category)
+        : Resource(id, path), m_category(category) {}
+
+    bool load() override {
+        std::vector<uint8_t> data(std::filesystem::file_size(getPath()));
+        std::ifstream file(getPath(), std::ios::binary);
+        file.read(reinterpret_cast<char*>(data.data()), static_cast<std::streamsize>(data.size()));
+        return decode(data) && upload();
+    }
+
+    void unload() override {
+        m_data.clear();
+        setState(ResourceState::Unloaded);
+    }
+
+    ResourceCategory getCategory() const override { return m_category; }
+
+    bool supportsStagedLoad() const override { return true; }
+
+    bool decode(std::vector<uint8_t>& fileData) override {
+        std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        m_data.swap(fileData);
+        return true;
+    }
+
+    bool upload() override {
+        setMemorySize(m_data.size());
+        setState(ResourceState::Loaded);
+        return true;
+    }
+
+private:
+    ResourceCategory m_category;
+    std::vector<uint8_t> m_data;
+};
+
+static void writeFile(const std::string& path, const std::string& contents) {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file.write(contents.data(), static_cast<std::streamsize>(contents.size()));
+}
+
+/**
+ * First frame of the scene: touch every resource it uses
+ * @return Time spent in the frame, in milliseconds
+ */
+static double sceneFirstFrame(ResourceManager& manager, const std::vector<std::string>& ids) {
+    auto start = std::chrono::high_resolution_clock::now();
+    for (const auto& id : ids) {
+        manager.loadResource(id);
+    }
+    return std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count();
+}
+
+int main() {
+    std::cout << "=== Preload Manifest Test ===" << std::endl;
+
+    namespace fs = std::filesystem;
+    const fs::path root = fs::temp_directory_path() / "rpg_preload_manifest_test";
+    fs::remove_all(root);
+    fs::create_directories(root);
+    const std::string dir = root.string();
+    bool allPassed = true;
+
+    ResourceManager manager(true, 4);
+    manager.initialize();
+
+    const int resourceCount = 40;
+    std::vector<std::string> sceneIds;
+    for (int i = 0; i < resourceCount; ++i) {
+        std::string id = (i % 4 == 0 ? "sfx_" : "tex_") + std::to_string(i);
+        std::string path = dir + "/" + id + ".dat";
+        writeFile(path, std::string(1024 + i, static_cast<char>('a' + i % 26)));
+        ResourceCategory category = i % 4 == 0 ? ResourceCategory::Audio : ResourceCategory::Texture;
+        manager.addResource(std::make_shared<SlowResource>(id, path, category));
+        sceneIds.push_back(id);
+    }
+    manager.addResource(std::make_shared<SlowResource>("menu_bg", dir + "/tex_1.dat", ResourceCategory::Texture));
+
+    // Test 1: recording
+    std::cout << "\n1. Recording the scene's first run..." << std::endl;
+
+    manager.loadResource("menu_bg");
+    manager.resetFirstUseHitches();
+    manager.beginManifestRecording("town");
+    allPassed &= check(manager.isRecordingManifest(), "recording started");
+
+    double hitchMs = sceneFirstFrame(manager, sceneIds);
+    manager.loadResource(sceneIds[0]);
+    PreloadManifest recorded = manager.endManifestRecording();
+    allPassed &= check(!manager.isRecordingManifest() && recorded.getName() == "town", "recording stopped");
+    allPassed &= check(recorded.size() == static_cast<size_t>(resourceCount) && !recorded.contains("menu_bg"),
+                       "every resource recorded once, nothing from before");
+    allPassed &= check(manager.getFirstUseHitchCount() == static_cast<uint64_t>(resourceCount) &&
+                       manager.getFirstUseHitches().front() == sceneIds.front(), "first uses counted as hitches");
+
+    // Test 2: file round trip
+    std::cout << "\n2. Saving and loading the manifest..." << std::endl;
+
+    const std::string manifestPath = dir + "/town.manifest";
+    allPassed &= check(recorded.saveToFile(manifestPath), "manifest saved");
+
+    PreloadManifest loaded;
+    allPassed &= check(loaded.loadFromFile(manifestPath), "manifest loaded");
+    bool same = loaded.size() == recorded.size();
+    for (size_t i = 0; same && i < loaded.size(); ++i) {
+        const PreloadEntry& a = loaded.getEntries()[i];
+        const PreloadEntry& b = recorded.getEntries()[i];
+        same = a.id == b.id && a.category == b.category && a.path == b.path;
+    }
+    allPassed &= check(same, "entries, categories and paths survive the round trip");
+
+    writeFile(dir + "/edited.manifest", "# hand edited\r\ntexture\tbanner\tui/banner.png\r\nunknown\tblob\t\r\ntexture\tbanner\tdup.png\r\n\r\n");
+    PreloadManifest edited;
+    edited.loadFromFile(dir + "/edited.manifest");
+    allPassed &= check(edited.size() == 2 && edited.getEntries()[0].path == "ui/banner.png" &&
+                       edited.getEntries()[1].category == ResourceCategory::Other && edited.getEntries()[1].path.empty(),
+                       "comments, CRLF, unknown categories and duplicates handled");
+    allPassed &= check(edited.merge(loaded) == loaded.size() && edited.merge(loaded) == 0, "merge adds only new entries");
+    allPassed &= check(!PreloadManifest().loadFromFile(dir + "/missing.manifest"), "missing manifest reported");
+
+    // Test 3: preloading
+    std::cout << "\n3. Preloading before the scene starts..." << std::endl;
+
+    for (const auto& id : sceneIds) {
+        manager.unloadResource(id);
+    }
+    manager.resetFirstUseHitches();
+
+    LoadOptions options;
+    options.priority = LoadPriority::High;
+    options.deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(500);
+    auto preloadStart = std::chrono::high_resolution_clock::now();
+    auto preloading = manager.preload(loaded, options);
+    allPassed &= check(preloading.size() == loaded.size(), "every listed resource requested");
+
+    float lastProgress = 0.0f;
+    bool monotonic = true;
+    int frames = 0;
+    while (true) {
+        manager.update();
+        frames++;
+        size_t done = 0;
+        for (const auto& resource : preloading) {
+            done += resource->isLoaded() || resource->isFailed() ? 1 : 0;
+        }
+        float progress = static_cast<float>(done) / static_cast<float>(preloading.size());
+        monotonic &= progress >= lastProgress;
+        lastProgress = progress;
+        if (done == preloading.size() ||
+            std::chrono::high_resolution_clock::now() - preloadStart > std::chrono::seconds(5)) {
+            break;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    double preloadMs = std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - preloadStart).count();
+    allPassed &= check(lastProgress == 1.0f && monotonic, "progress reaches 1.0 without going back");
+
+    double preloadedMs = sceneFirstFrame(manager, sceneIds);
+    allPassed &= check(manager.getFirstUseHitchCount() == 0, "no first-use hitches after preloading");
+    allPassed &= check(manager.preload(loaded).size() == loaded.size() && manager.getFirstUseHitchCount() == 0,
+                       "preloading loaded resources is a no-op");
+
+    std::cout << "First frame without a manifest: " << hitchMs << " ms, "
+              << resourceCount << " hitches" << std::endl;
+    std::cout << "First frame after preloading: " << preloadedMs << " ms, 0 hitches ("
+              << preloadMs << " ms preload over " << frames << " frames)" << std::endl;
+
+    manager.shutdown();
+    fs::remove_all(root);
+
+    std::cout << "\n=== Preload Manifest Test " << (allPassed ? "Complete" : "FAILED") << " ===" << std::endl;
+    return allPassed ? 0 : 1;
+}
@@ -0,0 +1,198 @@
+#include <iostream>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include "../src/components/QuestComponent.h"
+#include "../src/systems/QuestSystem.h"
+#include "test_check.h"
+
+using namespace RPGEngine;
+using namespace RPGEngine::Components;
+using namespace RPGEngine::Utils::StringIdLiterals;
+
+/**
+ * Quest objective index test
+ * Gives many entities several active quests, then compares tracking kills
+ * by scanning every active quest and objective (how trackKill used to work)
+ * against the objective index. Checks that the index follows quests being
+ * started, completed, abandoned, restored and destroyed, and that
+ * QuestSystem batches a frame's events into one progress report.
+ */
+
+// A copy would be missing from the objective index, or leave stale entries in it
+static_assert(!std::is_copy_constructible<QuestComponent>::value && !std::is_copy_assignable<QuestComponent>::value &&
+              !std::is_move_constructible<QuestComponent>::value && !std::is_move_assignable<QuestComponent>::value,
+              "quest components stay where the objective index points");
+
+static void registerQuests(int questCount) {
+    for (int q = 0; q < questCount; ++q) {
+        QuestDefinition definition("quest_" + std::to_string(q), "Quest " + std::to_string(q));
+        for (int o = 0; o < 5; ++o) {
+            definition.addObjective(QuestObjective("kill_" + std::to_string(o), "Hunt",
+                                                   ObjectiveType::Kill, "enemy_" + std::to_string((q * 5 + o) % 60), 1000000));
+        }
+        definition.addObjective(QuestObjective("visit", "Travel", ObjectiveType::Reach, "town_" + std::to_string(q), 1));
+        QuestComponent::registerQuestDefinition(definition);
+    }
+}
+
+// The loop trackKill ran for every kill before the index
+static int scanKill(std::vector<std::vector<ActiveQuest>>& allQuests, const std::string& enemyType) {
+    int advanced = 0;
+    for (auto& quests : allQuests) {
+        for (auto& quest : quests) {
+            if (quest.status != QuestStatus::Active) continue;
+            for (auto& objective : quest.objectives) {
+                if (objective.type == ObjectiveType::Kill && objective.target == enemyType && !objective.isCompleted) {
+                    objective.addProgress(1);
+                    advanced++;
+                }
+            }
+        }
+    }
+    return advanced;
+}
+
+int main() {
+    std::cout << "=== Quest Objective Index Test ===" << std::endl;
+    bool allPassed = true;
+
+    const int entityCount = 200;
+    const int questsPerEntity = 20;
+    registerQuests(questsPerEntity);
+
+    std::vector<std::unique_ptr<QuestComponent>> components;
+    std::vector<std::vector<ActiveQuest>> scanned;
+    for (int e = 0; e < entityCount; ++e) {
+        components.push_back(std::make_unique<QuestComponent>(static_cast<EntityId>(e + 1)));
+        for (int q = 0; q < questsPerEntity; ++q) {
+            components.back()->startQuest("quest_" + std::to_string(q));
+        }
+        scanned.push_back(components.back()->getActiveQuests());
+    }
+
+    std::vector<std::string> kills;
+    for (int i = 0; i < 2000; ++i) {
+        kills.push_back("enemy_" + std::to_string((i * 7) % 120));
+    }
+
+    // Scan: every kill compares against every objective of every active quest
+    int scanAdvanced = 0;
+    auto scanStart = std::chrono::steady_clock::now();
+    for (const auto& kill : kills) {
+        scanAdvanced += scanKill(scanned, kill);
+    }
+    double scanMs = elapsedMs(scanStart);
+
+    // Index: every kill touches only the objectives waiting on it
+    int indexAdvanced = 0;
+    auto indexStart = std::chrono::steady_clock::now();
+    for (const auto& kill : kills) {
+        indexAdvanced += QuestComponent::dispatchObjectiveEvent(ObjectiveEventKey(ObjectiveType::Kill, Utils::StringId(kill)));
+    }
+    double indexMs = elapsedMs(indexStart);
+
+    std::cout << "Scanning " << entityCount * questsPerEntity << " active quests: " << scanMs << " ms for "
+              << kills.size() << " kills" << std::endl;
+    std::cout << "Objective index: " << indexMs << " ms" << std::endl;
+
+    allPassed &= check(scanAdvanced == indexAdvanced && scanAdvanced > 0, "index advances the same objectives");
+    allPassed &= check(components[3]->getObjectiveProgress("quest_0", "kill_0") ==
+                       scanned[3][0].objectives[0].currentCount, "progress matches the scan");
+
+    // Quests leaving the active list leave the index
+    const ObjectiveEventKey town0(ObjectiveType::Reach, "town_0"_sid);
+    allPassed &= check(QuestComponent::getObjectiveSubscriptionCount(town0) == static_cast<size_t>(entityCount),
+                       "objectives indexed when quests start");
+    components[0]->abandonQuest("quest_0");
+    components[1]->failQuest("quest_0");
+    allPassed &= check(QuestComponent::getObjectiveSubscriptionCount(town0) == static_cast<size_t>(entityCount - 2),
+                       "abandoned and failed quests unindexed");
+    components[2].reset();
+    allPassed &= check(QuestComponent::getObjectiveSubscriptionCount(town0) == static_cast<size_t>(entityCount - 3),
+                       "destroyed components unindexed");
+
+    QuestComponent restored(1000);
+    allPassed &= check(restored.deserialize(components[3]->serialize()) &&
+                       QuestComponent::getObjectiveSubscriptionCount(town0) == static_cast<size_t>(entityCount - 2),
+                       "restored quests indexed");
+    restored.deserialize("");
+    allPassed &= check(QuestComponent::getObjectiveSubscriptionCount(town0) == static_cast<size_t>(entityCount - 3),
+                       "replaced quests unindexed");
+
+    // Completion through the index, including auto-completing quests
+    QuestDefinition errand("errand", "Errand");
+    errand.isAutoComplete = true;
+    errand.isRepeatable = true;
+    errand.addObjective(QuestObjective("wolves", "Kill wolves", ObjectiveType::Kill, "wolf", 2));
+    QuestObjective ritual("ritual", "Ritual", ObjectiveType::Custom, "altar", 1);
+    ritual.parameters["custom_type"] = "pray";
+    errand.addObjective(ritual);
+    QuestComponent::registerQuestDefinition(errand);
+
+    QuestComponent hero(2000);
+    std::vector<std::string> completedObjectives;
+    hero.setObjectiveCompletedCallback([&](const std::string&, const std::string& objectiveId) {
+        completedObjectives.push_back(objectiveId);
+    });
+    hero.startQuest("errand");
+    hero.trackKill("wolf"_sid, 1);
+    hero.trackKill("bear");
+    hero.trackKill(std::string("wolf"));
+    hero.trackCustomObjective("dance", "altar");
+    allPassed &= check(hero.getObjectiveProgress("errand", "wolves") == 2 && completedObjectives.size() == 1 &&
+                       hero.getObjectiveProgress("errand", "ritual") == 0, "component tracking uses the index");
+    hero.trackCustomObjective("pray", "altar");
+    allPassed &= check(hero.isQuestCompleted("errand") &&
+                       QuestComponent::getObjectiveSubscriptionCount(ObjectiveEventKey(ObjectiveType::Kill, "wolf"_sid)) == 0,
+                       "auto-completed quest unindexed");
+
+    // Global tracking is queued and reported once per frame
+    QuestComponent other(3000);
+    hero.startQuest("errand");
+    other.startQuest("errand");
+    Systems::QuestSystem questSystem(nullptr);
+    questSystem.initialize();
+    int batches = 0;
+    std::vector<ObjectiveProgressUpdate> lastBatch;
+    questSystem.setObjectiveProgressCallback([&](const std::vector<ObjectiveProgressUpdate>& updates) {
+        batches++;
+        lastBatch = updates;
+    });
+
+    questSystem.trackKillGlobal("wolf");
+    questSystem.trackKillGlobal("wolf");
+    questSystem.trackCustomObjectiveGlobal("pray", "altar");
+    questSystem.trackKillGlobal("nothing");
+    allPassed &= check(questSystem.getPendingObjectiveEventCount() == 3 && hero.getObjectiveProgress("errand", "wolves") == 0,
+                       "global events queued and merged");
+
+    questSystem.update(0.016f);
+    allPassed &= check(batches == 1 && lastBatch.size() == 4 && hero.isQuestCompleted("errand") &&
+                       !other.isQuestActive("errand") && questSystem.getPendingObjectiveEventCount() == 0,
+                       "one progress batch per frame");
+    questSystem.update(0.016f);
+    allPassed &= check(batches == 1, "no report without progress");
+
+    // Time-limited quests count down on every component the system can see
+    QuestDefinition timed("timed", "Timed");
+    timed.timeLimit = 1;
+    timed.addObjective(QuestObjective("wait", "Wait", ObjectiveType::Custom, "never", 1));
+    QuestComponent::registerQuestDefinition(timed);
+    auto componentManager = std::make_shared<ComponentManager>();
+    componentManager->initialize();
+    auto courier = componentManager->createComponent<QuestComponent>(Entity(4000));
+    courier->startQuest("timed");
+    std::vector<std::string> failed;
+    courier->setQuestFailedCallback([&](const std::string& questId, const std::string&) { failed.push_back(questId); });
+    questSystem.setComponentManager(componentManager);
+    questSystem.update(0.5f);
+    allPassed &= check(courier->isQuestActive("timed") && failed.empty(), "timed quest running");
+    questSystem.update(0.6f);
+    allPassed &= check(!courier->isQuestActive("timed") && failed.size() == 1, "timed quest fails when its time runs out");
+
+    std::cout << "\n=== Quest Objective Index Test " << (allPassed ? "Complete" : "FAILED") << " ===" << std::endl;
+    return allPassed ? 0 : 1;
+}
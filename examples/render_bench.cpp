@@ -0,0 +1,597 @@
+#include <iostream>
+#include <fstream>
+#include <chrono>
+#include <vector>
+#include <random>
+#include <algorithm>
+#include <functional>
+#include <sstream>
+#include <cmath>
+#include <nlohmann/json.hpp>
+#include "../src/graphics/MockGraphicsAPI.h"
+#include "../src/graphics/ShaderManager.h"
+#include "../src/graphics/SpriteRenderer.h"
+#include "../src/graphics/SpatialCuller.h"
+#include "../src/graphics/Texture.h"
+#include "../src/graphics/Camera.h"
+#include "../src/tilemap/TilemapRenderer.h"
+#include "../src/tilemap/TileLayer.h"
+#include "../src/tilemap/Tileset.h"
+#include "../src/ui/UIRenderer.h"
+#include "../src/ui/UITree.h"
+
+using namespace RPGEngine;
+using namespace RPGEngine::Graphics;
+using json = nlohmann::json;
+
+/**
+ * Headless rendering benchmark
+ * Drives SpriteRenderer, TilemapRenderer and UIRenderer through scripted
+ * scenes on MockGraphicsAPI and writes per-frame counters and CPU frame times
+ * as JSON. Pass --compare with the JSON of an earlier run to fail on counter
+ * regressions (draw calls, state changes, uploads, vertices).
+ *
+ * Usage: RenderBench [--frames N] [--warmup N] [--counts 1000,10000,100000]
+ *                    [--scenes sprites,sprites_indexed,tilemap,ui]
+ *                    [--output render_bench.json]
+ *                    [--compare baseline.json] [--tolerance 0.05]
+ */
+
+namespace {
+
+const int SCREEN_WIDTH = 1280;
+const int SCREEN_HEIGHT = 720;
+const int TEXTURE_COUNT = 8;
+
+const GraphicsCounter REPORTED_COUNTERS[] = {
+    GraphicsCounter::DrawCalls,
+    GraphicsCounter::StateChanges,
+    GraphicsCounter::RedundantStateChanges,
+    GraphicsCounter::TextureBinds,
+    GraphicsCounter::ShaderBinds,
+    GraphicsCounter::UniformUpdates,
+    GraphicsCounter::BufferUploads,
+    GraphicsCounter::BytesUploaded,
+    GraphicsCounter::Vertices,
+    GraphicsCounter::Primitives
+};
+
+struct BenchConfig {
+    std::vector<size_t> counts = { 1000, 10000, 100000 };
+    std::vector<std::string> scenes = { "sprites", "sprites_indexed", "tilemap", "ui", "ui_retained" };
+    int frames = 60;
+    int warmupFrames = 5;
+    std::string outputPath = "render_bench.json";
+    std::string comparePath;
+    double tolerance = 0.05;
+};
+
+/**
+ * Shared renderer state for all scenes
+ */
+struct BenchContext {
+    std::shared_ptr<MockGraphicsAPI> graphics;
+    std::shared_ptr<ShaderManager> shaders;
+    std::shared_ptr<SpriteRenderer> spriteRenderer;
+    std::vector<std::shared_ptr<Texture>> textures;
+    Camera camera;
+};
+
+/**
+ * A scripted scene: setup builds the content for a given element count,
+ * frame issues one frame of rendering
+ */
+struct BenchScene {
+    std::function<void(size_t)> setup;
+    std::function<void(int)> frame;
+    std::function<void()> teardown;
+};
+
+std::vector<size_t> parseCounts(const std::string& text) {
+    std::vector<size_t> counts;
+    std::stringstream stream(text);
+    std::string item;
+    while (std::getline(stream, item, ',')) {
+        if (!item.empty()) {
+            counts.push_back(static_cast<size_t>(std::stoul(item)));
+        }
+    }
+    return counts;
+}
+
+std::vector<std::string> parseList(const std::string& text) {
+    std::vector<std::string> items;
+    std::stringstream stream(text);
+    std::string item;
+    while (std::getline(stream, item, ',')) {
+        if (!item.empty()) {
+            items.push_back(item);
+        }
+    }
+    return items;
+}
+
+bool parseArguments(int argc, char* argv[], BenchConfig& config) {
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+
+        if (arg == "--frames" && hasValue) {
+            config.frames = std::max(1, std::atoi(argv[++i]));
+        } else if (arg == "--warmup" && hasValue) {
+            config.warmupFrames = std::max(0, std::atoi(argv[++i]));
+        } else if (arg == "--counts" && hasValue) {
+            config.counts = parseCounts(argv[++i]);
+        } else if (arg == "--scenes" && hasValue) {
+            config.scenes = parseList(argv[++i]);
+        } else if (arg == "--output" && hasValue) {
+            config.outputPath = argv[++i];
+        } else if (arg == "--compare" && hasValue) {
+            config.comparePath = argv[++i];
+        } else if (arg == "--tolerance" && hasValue) {
+            config.tolerance = std::atof(argv[++i]);
+        } else {
+            std::cerr << "Unknown or incomplete argument: " << arg << std::endl;
+            return false;
+        }
+    }
+    return !config.counts.empty() && !config.scenes.empty();
+}
+
+/**
+ * Camera path shared by the world-space scenes: a slow circle around the world center
+ */
+void moveCamera(Camera& camera, float worldSize, int frame) {
+    float angle = frame * 0.05f;
+    float radius = worldSize * 0.25f;
+    camera.setPosition(worldSize * 0.5f + std::cos(angle) * radius,
+                       worldSize * 0.5f + std::sin(angle) * radius);
+}
+
+/**
+ * Random sprites spread over a square world at constant density, so larger
+ * counts mean a larger world with the same amount on screen plus more to cull
+ */
+float buildSprites(BenchContext& context, size_t count, std::vector<Sprite>& sprites) {
+    std::mt19937 gen(static_cast<uint32_t>(count));
+    float worldSize = std::sqrt(static_cast<float>(count)) * 48.0f;
+    std::uniform_real_distribution<float> posDist(0.0f, worldSize);
+    std::uniform_real_distribution<float> unitDist(0.0f, 1.0f);
+
+    sprites.clear();
+    sprites.reserve(count);
+    for (size_t i = 0; i < count; ++i) {
+        // Textures come in runs, like sprites spawned by the same system
+        Sprite sprite(context.textures[(i / 64) % context.textures.size()]);
+        sprite.setTextureRect(Rect(0.0f, 0.0f, 32.0f, 32.0f));
+        sprite.setPosition(posDist(gen), posDist(gen));
+        sprite.setOrigin(0.5f, 0.5f);
+        sprite.setColor(Graphics::Color(unitDist(gen), unitDist(gen), unitDist(gen), 1.0f));
+        if (i % 10 == 0) {
+            sprite.setRotation(unitDist(gen) * 360.0f);
+        }
+        sprites.push_back(sprite);
+    }
+    return worldSize;
+}
+
+BenchScene makeSpriteScene(BenchContext& context, bool indexed) {
+    auto sprites = std::make_shared<std::vector<Sprite>>();
+    auto index = std::make_shared<SpatialCuller>(256.0f);
+    auto worldSize = std::make_shared<float>(0.0f);
+
+    BenchScene scene;
+    scene.setup = [&context, sprites, index, worldSize, indexed](size_t count) {
+        *worldSize = buildSprites(context, count, *sprites);
+        if (indexed) {
+            index->buildFromSprites(*sprites);
+        }
+        context.camera.setViewportSize(SCREEN_WIDTH, SCREEN_HEIGHT);
+        context.spriteRenderer->setCamera(&context.camera);
+    };
+    scene.frame = [&context, sprites, index, worldSize, indexed](int frame) {
+        moveCamera(context.camera, *worldSize, frame);
+        context.camera.update(0.0f);
+        context.spriteRenderer->setViewMatrix(context.camera.getViewMatrix());
+
+        context.spriteRenderer->begin();
+        if (indexed) {
+            context.spriteRenderer->drawSprites(*sprites, *index);
+        } else {
+            context.spriteRenderer->drawSprites(*sprites);
+        }
+        context.spriteRenderer->end();
+    };
+    scene.teardown = [&context, sprites, index]() {
+        context.spriteRenderer->setCamera(nullptr);
+        sprites->clear();
+        index->clear();
+    };
+    return scene;
+}
+
+BenchScene makeTilemapScene(BenchContext& context) {
+    auto renderer = std::make_shared<Tilemap::TilemapRenderer>(context.graphics);
+    auto camera = std::make_shared<Camera>();
+    auto tilesetTexture = std::make_shared<Resources::TextureResource>("bench_tileset", "");
+
+    BenchScene scene;
+    scene.setup = [&context, renderer, camera, tilesetTexture](size_t count) {
+        const int tileSize = 32;
+
+        if (!tilesetTexture->isLoaded()) {
+            TextureHandle handle = context.graphics->createTexture(512, 512, TextureFormat::RGBA, nullptr);
+            tilesetTexture->adoptHandle(handle, 512, 512, 0x1908);
+        }
+
+        auto tileset = std::make_shared<Tilemap::Tileset>("bench", tileSize, tileSize);
+        tileset->setTexture(tilesetTexture);
+
+        // Tiles 0-3 form an animated water strip
+        Tilemap::TileAnimation water;
+        for (uint32_t frame = 0; frame < 4; ++frame) {
+            water.frames.emplace_back(frame, 150);
+        }
+        tileset->setAnimation(0, water);
+
+        // Two square layers that together hold roughly count tiles
+        int side = std::max(1, static_cast<int>(std::sqrt(count / 2.0)));
+        Tilemap::MapProperties properties;
+        properties.width = side;
+        properties.height = side;
+        properties.tileWidth = tileSize;
+        properties.tileHeight = tileSize;
+
+        auto map = std::make_shared<Tilemap::Tilemap>(properties);
+        map->addTileset(tileset);
+
+        std::mt19937 gen(static_cast<uint32_t>(count));
+        std::uniform_int_distribution<uint32_t> tileDist(1, static_cast<uint32_t>(tileset->getTileCount()));
+        for (int layerIndex = 0; layerIndex < 2; ++layerIndex) {
+            auto layer = std::make_shared<Tilemap::TileLayer>(side, side);
+            for (int y = 0; y < side; ++y) {
+                for (int x = 0; x < side; ++x) {
+                    // The detail layer is sparse
+                    if (layerIndex == 1 && (x + y) % 3 != 0) {
+                        continue;
+                    }
+                    uint32_t flags = tileDist(gen) % 7 == 0 ? Tilemap::TileFlags::Solid : Tilemap::TileFlags::None;
+                    layer->setTile(x, y, Tilemap::Tile(tileDist(gen), flags));
+                }
+            }
+            map->addLayer(layer);
+        }
+
+        // The whole map is on screen, so tile count scales the work directly
+        float mapPixels = static_cast<float>(side * tileSize);
+        camera->setViewportSize(static_cast<int>(mapPixels), static_cast<int>(mapPixels));
+        camera->setPosition(mapPixels * 0.5f, mapPixels * 0.5f);
+
+        renderer->setTilemap(map);
+        renderer->setCamera(camera);
+        if (!renderer->isInitialized()) {
+            renderer->initialize();
+        }
+    };
+    scene.frame = [renderer](int /*frame*/) {
+        renderer->update(1.0f / 60.0f);
+    };
+    scene.teardown = [renderer]() {
+        renderer->setTilemap(nullptr);
+    };
+    return scene;
+}
+
+BenchScene makeUIScene(BenchContext& context) {
+    auto ui = std::make_shared<UI::UIRenderer>(context.spriteRenderer, nullptr);
+    auto widgetCount = std::make_shared<size_t>(0);
+
+    BenchScene scene;
+    scene.setup = [ui, widgetCount](size_t count) {
+        *widgetCount = count;
+        if (!ui->isInitialized()) {
+            ui->initialize();
+        }
+    };
+    scene.frame = [&context, ui, widgetCount](int frame) {
+        // Widgets are laid out in a grid of cells, cycling through the widget types
+        const float cellWidth = 160.0f;
+        const float cellHeight = 40.0f;
+        const int columns = static_cast<int>(SCREEN_WIDTH / cellWidth);
+
+        context.spriteRenderer->begin();
+        ui->beginFrame();
+        for (size_t i = 0; i < *widgetCount; ++i) {
+            int column = static_cast<int>(i % columns);
+            int row = static_cast<int>(i / columns);
+            UI::UIRect bounds(column * cellWidth + 4.0f, std::fmod(row * cellHeight, static_cast<float>(SCREEN_HEIGHT)),
+                              cellWidth - 8.0f, cellHeight - 8.0f);
+
+            switch (i % 4) {
+                case 0: ui->drawPanel(bounds); break;
+                case 1: ui->drawButton(bounds, "Button"); break;
+                case 2: ui->drawProgressBar(bounds, static_cast<float>((frame + i) % 100) / 100.0f); break;
+                case 3: ui->drawText(bounds, "Quest log entry"); break;
+            }
+        }
+        ui->endFrame();
+        context.spriteRenderer->end();
+    };
+    scene.teardown = []() {};
+    return scene;
+}
+
+BenchScene makeRetainedUIScene(BenchContext& context) {
+    auto ui = std::make_shared<UI::UIRenderer>(context.spriteRenderer, nullptr);
+    auto tree = std::make_shared<std::shared_ptr<UI::UITree>>();
+    auto progressBars = std::make_shared<std::vector<UI::UIWidget*>>();
+
+    BenchScene scene;
+    scene.setup = [ui, tree, progressBars](size_t count) {
+        if (!ui->isInitialized()) {
+            ui->initialize();
+        }
+
+        // Same grid as the immediate-mode scene, built once
+        const float cellWidth = 160.0f;
+        const float cellHeight = 40.0f;
+        const int columns = static_cast<int>(SCREEN_WIDTH / cellWidth);
+        const UI::UIElementType types[] = {
+            UI::UIElementType::Panel, UI::UIElementType::Button,
+            UI::UIElementType::ProgressBar, UI::UIElementType::Text
+        };
+
+        // Each row gets its own cache through an empty, caching text widget,
+        // so a changed widget only rebuilds its row
+        *tree = ui->createTree();
+        progressBars->clear();
+        std::shared_ptr<UI::UIWidget> rowGroup;
+        for (size_t i = 0; i < count; ++i) {
+            int column = static_cast<int>(i % columns);
+            int row = static_cast<int>(i / columns);
+
+            if (column == 0) {
+                rowGroup = std::make_shared<UI::UIWidget>(UI::UIElementType::Text);
+                rowGroup->setCacheGeometry(true);
+                (*tree)->getRoot()->addChild(rowGroup);
+            }
+
+            auto widget = std::make_shared<UI::UIWidget>(types[i % 4]);
+            widget->setBounds(UI::UIRect(column * cellWidth + 4.0f, std::fmod(row * cellHeight, static_cast<float>(SCREEN_HEIGHT)),
+                                         cellWidth - 8.0f, cellHeight - 8.0f));
+            widget->setText(i % 4 == 1 ? "Button" : "Quest log entry");
+            if (i % 4 == 2) {
+                progressBars->push_back(widget.get());
+            }
+            rowGroup->addChild(widget);
+        }
+    };
+    scene.frame = [&context, ui, tree, progressBars](int frame) {
+        // One bar changes per frame, as a health bar would
+        if (!progressBars->empty()) {
+            UI::UIWidget* bar = (*progressBars)[frame % progressBars->size()];
+            bar->setValue(static_cast<float>(frame % 100) / 100.0f);
+        }
+
+        context.spriteRenderer->begin();
+        ui->beginFrame();
+        ui->drawTree(**tree);
+        ui->endFrame();
+        context.spriteRenderer->end();
+    };
+    scene.teardown = [tree, progressBars]() {
+        progressBars->clear();
+        tree->reset();
+    };
+    return scene;
+}
+
+double percentile(std::vector<double> values, double p) {
+    if (values.empty()) {
+        return 0.0;
+    }
+    std::sort(values.begin(), values.end());
+    size_t index = static_cast<size_t>(p * (values.size() - 1) + 0.5);
+    return values[std::min(index, values.size() - 1)];
+}
+
+json runScene(BenchContext& context, const std::string& name, BenchScene& scene, size_t count, const BenchConfig& config) {
+    scene.setup(count);
+
+    // Warm-up frames fill caches and grow buffers before anything is measured
+    for (int frame = 0; frame < config.warmupFrames; ++frame) {
+        context.graphics->beginFrame();
+        scene.frame(frame);
+        context.graphics->endFrame();
+    }
+    context.graphics->resetStats();
+
+    std::vector<double> frameMs;
+    frameMs.reserve(config.frames);
+    for (int frame = 0; frame < config.frames; ++frame) {
+        auto start = std::chrono::high_resolution_clock::now();
+        context.graphics->beginFrame();
+        scene.frame(config.warmupFrames + frame);
+        context.graphics->endFrame();
+        auto end = std::chrono::high_resolution_clock::now();
+        frameMs.push_back(std::chrono::duration<double, std::milli>(end - start).count());
+    }
+
+    scene.teardown();
+
+    double sum = 0.0;
+    for (double ms : frameMs) {
+        sum += ms;
+    }
+
+    json result;
+    result["scene"] = name;
+    result["count"] = count;
+    result["frames"] = config.frames;
+    result["frameTimeMs"] = {
+        { "mean", sum / frameMs.size() },
+        { "p50", percentile(frameMs, 0.50) },
+        { "p95", percentile(frameMs, 0.95) },
+        { "max", percentile(frameMs, 1.0) }
+    };
+
+    json counters = json::object();
+    for (GraphicsCounter counter : REPORTED_COUNTERS) {
+        GraphicsCounterHistogram histogram = context.graphics->getHistogram(counter);
+        counters[MockGraphicsAPI::getCounterName(counter)] = {
+            { "min", histogram.min },
+            { "max", histogram.max },
+            { "mean", histogram.mean },
+            { "p50", histogram.p50 },
+            { "p95", histogram.p95 },
+            { "p99", histogram.p99 },
+            { "buckets", histogram.buckets }
+        };
+    }
+    result["counters"] = counters;
+
+    std::cout << name << " x" << count << ": "
+              << result["frameTimeMs"]["mean"].get<double>() << " ms/frame, "
+              << counters["drawCalls"]["mean"].get<double>() << " draws, "
+              << counters["stateChanges"]["mean"].get<double>() << " state changes, "
+              << counters["bytesUploaded"]["mean"].get<double>() / 1024.0 << " KiB uploaded, "
+              << counters["vertices"]["mean"].get<double>() << " vertices" << std::endl;
+    return result;
+}
+
+/**
+ * Compare counter means against an earlier run
+ * Frame times are reported but never fail the comparison; they are too noisy
+ * on shared CI machines.
+ * @return Number of counter regressions
+ */
+int compareResults(const json& current, const json& baseline, double tolerance) {
+    int regressions = 0;
+
+    for (const auto& result : current["results"]) {
+        for (const auto& previous : baseline["results"]) {
+            if (previous["scene"] != result["scene"] || previous["count"] != result["count"]) {
+                continue;
+            }
+
+            std::string label = result["scene"].get<std::string>() + " x" + std::to_string(result["count"].get<size_t>());
+
+            for (auto it = result["counters"].begin(); it != result["counters"].end(); ++it) {
+                if (!previous["counters"].contains(it.key())) {
+                    continue;
+                }
+                double now = it.value()["mean"].get<double>();
+                double before = previous["counters"][it.key()]["mean"].get<double>();
+                if (now > before * (1.0 + tolerance) + 0.5) {
+                    std::cout << "REGRESSION " << label << " " << it.key() << ": "
+                              << before << " -> " << now << std::endl;
+                    regressions++;
+                }
+            }
+
+            double nowMs = result["frameTimeMs"]["mean"].get<double>();
+            double beforeMs = previous["frameTimeMs"]["mean"].get<double>();
+            std::cout << label << " frame time: " << beforeMs << " -> " << nowMs << " ms" << std::endl;
+        }
+    }
+
+    return regressions;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    BenchConfig config;
+    if (!parseArguments(argc, argv, config)) {
+        std::cerr << "Usage: RenderBench [--frames N] [--warmup N] [--counts a,b,c] [--scenes a,b]"
+                  << " [--output file] [--compare baseline.json] [--tolerance 0.05]" << std::endl;
+        return 1;
+    }
+
+    std::cout << "=== Render Benchmark ===" << std::endl;
+
+    BenchContext context;
+    context.graphics = std::make_shared<MockGraphicsAPI>();
+    context.graphics->initialize(SCREEN_WIDTH, SCREEN_HEIGHT, "RenderBench", false);
+    context.graphics->setMaxFrameHistory(static_cast<size_t>(config.frames));
+
+    context.shaders = std::make_shared<ShaderManager>(context.graphics);
+    context.shaders->initialize();
+
+    context.spriteRenderer = std::make_shared<SpriteRenderer>(context.graphics, context.shaders);
+    if (!context.spriteRenderer->initialize()) {
+        std::cerr << "Failed to initialize SpriteRenderer" << std::endl;
+        return 1;
+    }
+
+    for (int i = 0; i < TEXTURE_COUNT; ++i) {
+        auto texture = std::make_shared<Texture>(context.graphics);
+        texture->createFromData(256, 256, TextureFormat::RGBA, nullptr);
+        context.textures.push_back(texture);
+    }
+
+    json output;
+    output["benchmark"] = "RenderBench";
+    output["version"] = 1;
+    output["frames"] = config.frames;
+    output["warmupFrames"] = config.warmupFrames;
+    output["results"] = json::array();
+
+    for (const std::string& name : config.scenes) {
+        BenchScene scene;
+        if (name == "sprites") {
+            scene = makeSpriteScene(context, false);
+        } else if (name == "sprites_indexed") {
+            scene = makeSpriteScene(context, true);
+        } else if (name == "tilemap") {
+            scene = makeTilemapScene(context);
+        } else if (name == "ui") {
+            scene = makeUIScene(context);
+        } else if (name == "ui_retained") {
+            scene = makeRetainedUIScene(context);
+        } else {
+            std::cerr << "Unknown scene: " << name << std::endl;
+            return 1;
+        }
+
+        for (size_t count : config.counts) {
+            output["results"].push_back(runScene(context, name, scene, count, config));
+        }
+    }
+
+    std::ofstream file(config.outputPath);
+    if (!file.is_open()) {
+        std::cerr << "Failed to open output file: " << config.outputPath << std::endl;
+        return 1;
+    }
+    file << output.dump(2) << std::endl;
+    std::cout << "\nResults written to " << config.outputPath << std::endl;
+
+    int regressions = 0;
+    if (!config.comparePath.empty()) {
+        std::ifstream baselineFile(config.comparePath);
+        if (!baselineFile.is_open()) {
+            std::cerr << "Failed to open baseline file: " << config.comparePath << std::endl;
+            return 1;
+        }
+
+        json baseline;
+        try {
+            baselineFile >> baseline;
+        } catch (const json::exception& e) {
+            std::cerr << "Failed to parse baseline file: " << e.what() << std::endl;
+            return 1;
+        }
+
+        std::cout << "\nComparing against " << config.comparePath << std::endl;
+        regressions = compareResults(output, baseline, config.tolerance);
+        std::cout << regressions << " counter regression(s)" << std::endl;
+    }
+
+    context.spriteRenderer->shutdown();
+    context.shaders->shutdown();
+    context.graphics->shutdown();
+
+    std::cout << "\n=== Render Benchmark Complete ===" << std::endl;
+    return regressions > 0 ? 1 : 0;
+}
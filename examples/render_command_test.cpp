@@ -0,0 +1,195 @@
+#include <iostream>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+#include "../src/graphics/RenderCommandBuffer.h"
+#include "../src/graphics/MockGraphicsAPI.h"
+#include "../src/core/ThreadPool.h"
+#include "test_check.h"
+
+using namespace RPGEngine;
+using namespace RPGEngine::Graphics;
+
+/**
+ * Render command test
+ * Replays recorded command lists into MockGraphicsAPI and checks that lists
+ * are merged by sort key, that redundant texture, program and blend changes
+ * are skipped, and that recordParallel() records frame N while frame N-1 is
+ * being replayed.
+ */
+
+/**
+ * Mock API that also keeps the order of the calls the queue makes
+ */
+class TracingGraphicsAPI : public MockGraphicsAPI {
+public:
+    void clear(float r, float g, float b, float a) override {
+        trace.push_back("clear " + std::to_string(static_cast<int>(r)));
+        MockGraphicsAPI::clear(r, g, b, a);
+    }
+
+    void bindTexture(TextureHandle handle, uint32_t unit) override {
+        trace.push_back("texture " + std::to_string(handle));
+        MockGraphicsAPI::bindTexture(handle, unit);
+    }
+
+    void useShaderProgram(ShaderProgramHandle handle) override {
+        trace.push_back("program " + std::to_string(handle));
+        MockGraphicsAPI::useShaderProgram(handle);
+    }
+
+    void setBlendMode(BlendMode mode) override {
+        trace.push_back("blend " + std::to_string(static_cast<int>(mode)));
+        MockGraphicsAPI::setBlendMode(mode);
+    }
+
+    void bindVertexArray(VertexArrayHandle handle) override {
+        replaying = true;
+        MockGraphicsAPI::bindVertexArray(handle);
+    }
+
+    void drawElements(PrimitiveType type, int count, uint32_t indexType, int offset) override {
+        trace.push_back("draw " + std::to_string(count / 6));
+        MockGraphicsAPI::drawElements(type, count, indexType, offset);
+    }
+
+    std::vector<std::string> trace;
+    std::atomic<bool> replaying{false};
+};
+
+static void addQuads(RenderCommandList& list, TextureHandle texture, uint32_t count) {
+    float* vertices = list.allocateQuads(texture, count);
+    for (uint32_t i = 0; i < count * RenderCommandList::FLOATS_PER_QUAD; ++i) {
+        vertices[i] = static_cast<float>(i);
+    }
+}
+
+int main() {
+    std::cout << "=== Render Command Test ===" << std::endl;
+    bool allPassed = true;
+
+    auto api = std::make_shared<TracingGraphicsAPI>();
+    api->initialize(800, 600, "render command test", false);
+    RenderCommandQueue queue(api);
+    allPassed &= check(queue.initialize(), "queue initialized");
+
+    ShaderProgramHandle sprites = api->createShaderProgram(api->createShader(ShaderType::Vertex, ""),
+                                                           api->createShader(ShaderType::Fragment, ""));
+    TextureHandle grass = api->createTexture(16, 16, TextureFormat::RGBA, nullptr);
+    TextureHandle stone = api->createTexture(16, 16, TextureFormat::RGBA, nullptr);
+
+    // Test 1: lists replay in sort key order, whatever order they were acquired in
+    std::cout << "\n1. Merging lists by sort key..." << std::endl;
+
+    queue.beginRecording();
+    RenderCommandList& overlay = queue.acquireList(2);
+    overlay.setBlendMode(BlendMode::Alpha);
+    addQuads(overlay, stone, 1);
+
+    RenderCommandList& background = queue.acquireList(0);
+    background.clear(1.0f, 0.0f, 0.0f, 1.0f);
+    background.useShaderProgram(sprites);
+    background.setBlendMode(BlendMode::Alpha);
+    addQuads(background, grass, 2);
+    addQuads(background, grass, 3);
+
+    RenderCommandList& tiles = queue.acquireList(1);
+    tiles.useShaderProgram(sprites);
+    addQuads(tiles, grass, 1);
+    addQuads(tiles, stone, 4);
+    queue.endRecording();
+
+    api->trace.clear();
+    api->beginFrame();
+    queue.submit();
+    api->endFrame();
+
+    const std::vector<std::string> expected = {
+        "clear 1", "program " + std::to_string(sprites), "blend " + std::to_string(static_cast<int>(BlendMode::Alpha)),
+        "texture " + std::to_string(grass), "draw 5",
+        "draw 1",
+        "texture " + std::to_string(stone), "draw 4",
+        "draw 1"
+    };
+    allPassed &= check(api->trace == expected, "calls follow sort key order");
+    allPassed &= check(queue.getStats().commandLists == 3 && queue.getStats().drawCalls == 4 &&
+                       queue.getStats().quads == 11, "same-texture quads merged into one draw");
+
+    // Test 2: redundant state never reaches the API
+    std::cout << "\n2. Skipping redundant state changes..." << std::endl;
+
+    const RenderQueueStats& stats = queue.getStats();
+    GraphicsFrameStats frameStats = api->getLastFrameStats();
+    allPassed &= check(stats.textureBinds == 2 && frameStats.textureBinds == 2, "textures bound once per change");
+    allPassed &= check(frameStats.shaderBinds == 1, "program bound once");
+    // Second program, second blend, grass in the tiles list, stone in the overlay list
+    allPassed &= check(stats.skippedStateChanges == 4, "redundant program, blend and texture changes skipped");
+    allPassed &= check(frameStats.redundantStateChanges == 0, "no redundant calls reached the API");
+
+    // A frame with nothing pending replays nothing
+    api->trace.clear();
+    queue.submit();
+    allPassed &= check(api->trace.empty(), "submitted frame not replayed twice");
+
+    // Test 3: recording frame N overlaps replay of frame N-1
+    std::cout << "\n3. Recording in parallel with submission..." << std::endl;
+
+    Core::ThreadPool threadPool(4);
+    const int frames = 5;
+    const int jobsPerFrame = 4;
+    std::atomic<int> overlapped{0};
+    std::vector<int> replayedFrames;
+
+    for (int frame = 0; frame < frames; ++frame) {
+        api->replaying = false;
+        std::vector<RenderRecordJob> jobs;
+        for (int job = 0; job < jobsPerFrame; ++job) {
+            // Keys in reverse so the merge has to reorder them
+            uint64_t sortKey = static_cast<uint64_t>(jobsPerFrame - job);
+            jobs.emplace_back(sortKey, [&, frame, job](RenderCommandList& list) {
+                // From the second frame on there is a previous frame to replay;
+                // keep recording until its replay has started
+                if (frame > 0) {
+                    auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(2);
+                    while (!api->replaying && std::chrono::steady_clock::now() < deadline) {
+                        std::this_thread::yield();
+                    }
+                    if (api->replaying) {
+                        overlapped++;
+                    }
+                }
+                if (job == jobsPerFrame - 1) {
+                    list.clear(static_cast<float>(frame), 0.0f, 0.0f, 1.0f);
+                }
+                list.useShaderProgram(sprites);
+                addQuads(list, job % 2 ? grass : stone, 8);
+            });
+        }
+
+        api->trace.clear();
+        queue.recordParallel(threadPool, jobs);
+        if (!api->trace.empty()) {
+            replayedFrames.push_back(std::stoi(api->trace.front().substr(6)));
+        }
+    }
+
+    // The last frame is still waiting to be replayed
+    api->trace.clear();
+    queue.submit();
+    bool lastFrameFirst = !api->trace.empty() && api->trace.front() == "clear " + std::to_string(frames - 1);
+    replayedFrames.push_back(lastFrameFirst ? frames - 1 : -1);
+
+    allPassed &= check(overlapped == (frames - 1) * jobsPerFrame, "every job recorded while the previous frame replayed");
+    allPassed &= check(replayedFrames == std::vector<int>({0, 1, 2, 3, 4}), "each recordParallel() replays the frame before it");
+    allPassed &= check(queue.getStats().commandLists == jobsPerFrame && queue.getStats().quads == jobsPerFrame * 8 &&
+                       queue.getStats().skippedStateChanges == jobsPerFrame - 1,
+                       "parallel lists merged with redundant programs skipped");
+
+    queue.shutdown();
+    api->shutdown();
+
+    std::cout << "\n=== Render Command Test " << (allPassed ? "Complete" : "FAILED") << " ===" << std::endl;
+    return allPassed ? 0 : 1;
+}
@@ -0,0 +1,130 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include "../src/resources/ResourceManager.h"
+#include "test_check.h"
+
+using namespace RPGEngine::Resources;
+
+/**
+ * Resource budget test
+ * Loads fake textures and sounds of known size against per-category
+ * budgets and checks that eviction respects references, outside owners,
+ * pins, priorities and recency, then simulates a long session to show
+ * memory stays bounded.
+ */
+
+class SizedResource : public Resource {
+public:
+    SizedResource(const std::string& id, ResourceCategory category, size_t bytes)
+        : Resource(id, id), m_category(category), m_bytes(bytes) {}
+
+    bool load() override {
+        setMemorySize(m_bytes);
+        setState(ResourceState::Loaded);
+        return true;
+    }
+
+    void unload() override {
+        setMemorySize(0);
+        setState(ResourceState::Unloaded);
+    }
+
+    ResourceCategory getCategory() const override { return m_category; }
+
+private:
+    ResourceCategory m_category;
+    size_t m_bytes;
+};
+
+int main() {
+    std::cout << "=== Resource Budget Test ===" << std::endl;
+
+    const size_t KB = 1024;
+    ResourceManager manager(false);
+    manager.initialize();
+    manager.setBudget(ResourceCategory::Texture, 400 * KB);
+    bool allPassed = true;
+
+    // Test 1: accounting
+    std::cout << "\n1. Measuring memory..." << std::endl;
+
+    // Only the manager owns these; a shared_ptr kept here would count as a use
+    std::vector<Resource*> textures;
+    {
+        std::vector<std::shared_ptr<Resource>> created;
+        for (int i = 0; i < 4; ++i) {
+            created.push_back(std::make_shared<SizedResource>("tex" + std::to_string(i), ResourceCategory::Texture, 100 * KB));
+            textures.push_back(created.back().get());
+        }
+        manager.addResources(created);
+    }
+    Resource* music = new SizedResource("music", ResourceCategory::Audio, 2048 * KB);
+    manager.addResource(std::shared_ptr<Resource>(music));
+
+    for (const auto& texture : textures) {
+        manager.loadResource(texture->getId());
+    }
+    manager.loadResource("music");
+    manager.update();
+
+    allPassed &= check(manager.getBudgetStats(ResourceCategory::Texture).used == 400 * KB, "texture bytes counted");
+    allPassed &= check(manager.getBudgetStats(ResourceCategory::Audio).used == 2048 * KB, "audio counted separately");
+    allPassed &= check(manager.getBudgetStats(ResourceCategory::Texture).evictions == 0, "nothing evicted within budget");
+
+    // Test 2: LRU eviction with priorities, pins and references
+    std::cout << "\n2. Going over budget..." << std::endl;
+
+    textures[0]->setPriority(ResourcePriority::Pinned);
+    textures[1]->addReference();
+    textures[3]->setPriority(ResourcePriority::Streaming);
+    manager.getResource("tex2");    // tex2 used more recently than tex3
+    manager.update();
+
+    Resource* extra = new SizedResource("tex4", ResourceCategory::Texture, 150 * KB);
+    manager.addResource(std::shared_ptr<Resource>(extra));
+    manager.loadResource("tex4");
+    manager.update();
+
+    allPassed &= check(!textures[3]->isLoaded(), "streaming texture evicted first");
+    allPassed &= check(textures[0]->isLoaded() && textures[1]->isLoaded(), "pinned and referenced textures kept");
+    allPassed &= check(!textures[2]->isLoaded(), "scene texture evicted next to fit the budget");
+    allPassed &= check(extra->isLoaded(), "resource used this frame kept");
+    allPassed &= check(music->isLoaded(), "unbudgeted category untouched");
+
+    ResourceBudgetStats stats = manager.getBudgetStats(ResourceCategory::Texture);
+    allPassed &= check(stats.used <= stats.budget && stats.evictions == 2 && stats.evictedBytes == 200 * KB,
+                       "stats report use and evictions");
+    allPassed &= check(stats.peak == 550 * KB, "peak records the overshoot");
+
+    // Test 3: long session
+    std::cout << "\n3. Simulating a long session..." << std::endl;
+
+    textures[1]->removeReference();
+    
+    // Held outside the manager, like a tileset texture a map draws every frame
+    auto tileset = std::make_shared<SizedResource>("tileset", ResourceCategory::Texture, 32 * KB);
+    manager.addResource(tileset);
+    manager.loadResource("tileset");
+    
+    size_t maxUsed = 0;
+    for (int frame = 0; frame < 500; ++frame) {
+        std::string id = "map_tex" + std::to_string(frame);
+        manager.addResource(std::make_shared<SizedResource>(id, ResourceCategory::Texture, 64 * KB));
+        manager.loadResource(id);
+        manager.update();
+        maxUsed = std::max(maxUsed, manager.getBudgetStats(ResourceCategory::Texture).used);
+    }
+
+    stats = manager.getBudgetStats(ResourceCategory::Texture);
+    std::cout << "Texture memory after 500 loads: " << stats.used / KB << " KB (budget " << stats.budget / KB
+              << " KB, " << stats.evictions << " evictions)" << std::endl;
+    allPassed &= check(maxUsed <= stats.budget, "memory stays within budget");
+    allPassed &= check(textures[0]->isLoaded(), "pinned texture survives the session");
+    allPassed &= check(tileset->isLoaded(), "texture held outside the manager survives the session");
+
+    manager.shutdown();
+
+    std::cout << "\n=== Resource Budget Test " << (allPassed ? "Complete" : "FAILED") << " ===" << std::endl;
+    return allPassed ? 0 : 1;
+}
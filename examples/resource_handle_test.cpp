@@ -0,0 +1,153 @@
+#include <iostream>
+#include <atomic>
+#include <chrono>
+#include <string>
+#include <thread>
+#include <vector>
+#include "../src/resources/ResourceManager.h"
+#include "test_check.h"
+
+using namespace RPGEngine::Resources;
+
+/**
+ * Resource handle test
+ * Checks generational handles, per-type registries and lock-free lookups
+ * while another thread adds and removes resources, then compares string ID
+ * lookups against resolved handles.
+ */
+
+class TestResource : public Resource {
+public:
+    TestResource(const std::string& id) : Resource(id, id + ".dat") {}
+    bool load() override { setState(ResourceState::Loaded); return true; }
+    void unload() override { setState(ResourceState::Unloaded); }
+};
+
+class AtlasResource : public TestResource {
+public:
+    AtlasResource(const std::string& id) : TestResource(id) {}
+};
+
+class OtherResource : public Resource {
+public:
+    OtherResource(const std::string& id) : Resource(id, id + ".bin") {}
+    bool load() override { setState(ResourceState::Loaded); return true; }
+    void unload() override { setState(ResourceState::Unloaded); }
+};
+
+int main() {
+    std::cout << "=== Resource Handle Test ===" << std::endl;
+
+    ResourceManager manager(false);
+    manager.initialize();
+    bool allPassed = true;
+
+    // Test 1: handles
+    std::cout << "\n1. Resolving handles..." << std::endl;
+
+    std::vector<std::shared_ptr<Resource>> batch;
+    for (int i = 0; i < 1000; ++i) {
+        batch.push_back(std::make_shared<TestResource>("texture" + std::to_string(i)));
+    }
+    batch.push_back(std::make_shared<OtherResource>("sound0"));
+    allPassed &= check(manager.addResources(batch) == batch.size(), "bulk add");
+    allPassed &= check(!manager.addResource(std::make_shared<TestResource>("texture5")), "duplicate IDs rejected");
+
+    ResourceHandle<TestResource> handle = manager.getHandle<TestResource>("texture42");
+    allPassed &= check(!handle.isNull() && manager.get(handle) && manager.get(handle)->getId() == "texture42",
+                       "handle resolves to its resource");
+    allPassed &= check(manager.getHandle<OtherResource>("texture42").isNull(), "wrong type gives a null handle");
+    allPassed &= check(manager.getHandle<TestResource>("missing").isNull(), "unknown ID gives a null handle");
+    allPassed &= check(!manager.getHandle<Resource>("sound0").isNull(), "base type resolves anything");
+
+    // Test 2: generations
+    std::cout << "\n2. Removing and re-adding..." << std::endl;
+
+    allPassed &= check(manager.removeResource("texture42"), "resource removed");
+    allPassed &= check(!manager.isValid(handle) && manager.get(handle) == nullptr, "stale handle resolves to nullptr");
+
+    manager.addResource(std::make_shared<TestResource>("texture42b"));
+    ResourceHandle<TestResource> reused = manager.getHandle<TestResource>("texture42b");
+    allPassed &= check(reused.index == handle.index && reused.generation != handle.generation,
+                       "slot is reused with a new generation");
+    allPassed &= check(manager.get(handle) == nullptr, "old handle stays stale after reuse");
+
+    // Test 3: per-type registries
+    std::cout << "\n3. Listing by type..." << std::endl;
+
+    allPassed &= check(manager.getResourcesOfType<TestResource>().size() == 1000, "textures listed from their registry");
+    allPassed &= check(manager.getResourcesOfType<OtherResource>().size() == 1, "sounds listed from their registry");
+    allPassed &= check(manager.getAllResources().size() == 1001 && manager.getResourceCount() == 1001, "all resources listed");
+
+    manager.addResource(std::make_shared<AtlasResource>("atlas0"));
+    allPassed &= check(manager.getResourcesOfType<TestResource>().size() == 1001 &&
+                       manager.getResourcesOfType<AtlasResource>().size() == 1, "base types list their subclasses");
+    manager.removeResource("atlas0");
+
+    // Test 4: concurrent readers and writers
+    std::cout << "\n4. Reading while the table changes..." << std::endl;
+
+    std::atomic<bool> stop(false);
+    std::atomic<int> badReads(0);
+    std::vector<std::thread> readers;
+    for (int t = 0; t < 3; ++t) {
+        readers.emplace_back([&manager, &stop, &badReads]() {
+            auto stable = manager.getHandle<TestResource>("texture7");
+            while (!stop) {
+                auto resource = manager.get(stable);
+                if (!resource || resource->getId() != "texture7") {
+                    badReads++;
+                }
+                manager.getResource("texture8");
+            }
+        });
+    }
+
+    for (int i = 0; i < 500; ++i) {
+        std::string id = "churn" + std::to_string(i % 50);
+        if (!manager.addResource(std::make_shared<TestResource>(id))) {
+            manager.removeResource(id);
+        }
+        manager.update();
+    }
+    stop = true;
+    for (auto& reader : readers) {
+        reader.join();
+    }
+    allPassed &= check(badReads == 0, "readers always see a consistent table");
+
+    // Test 5: benchmark
+    const int lookups = 2000000;
+    std::cout << "\n5. Benchmarking " << lookups << " lookups..." << std::endl;
+
+    std::vector<std::string> ids;
+    std::vector<ResourceHandle<TestResource>> handles;
+    for (int i = 0; i < 64; ++i) {
+        ids.push_back("texture" + std::to_string(i * 7 + 1));
+        handles.push_back(manager.getHandle<TestResource>(ids.back()));
+    }
+
+    size_t found = 0;
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < lookups; ++i) {
+        found += manager.getResourceOfType<TestResource>(ids[i & 63]) != nullptr;
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    auto stringTime = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+
+    start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < lookups; ++i) {
+        found -= manager.get(handles[i & 63]) != nullptr;
+    }
+    end = std::chrono::high_resolution_clock::now();
+    auto handleTime = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+
+    std::cout << "String ID lookups: " << stringTime.count() << " microseconds" << std::endl;
+    std::cout << "Handle lookups: " << handleTime.count() << " microseconds" << std::endl;
+    allPassed &= check(found == 0, "both paths find the same resources");
+
+    manager.shutdown();
+
+    std::cout << "\n=== Resource Handle Test " << (allPassed ? "Complete" : "FAILED") << " ===" << std::endl;
+    return allPassed ? 0 : 1;
+}
@@ -0,0 +1,324 @@
+#include <iostream>
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+#include "../src/resources/ResourceManager.h"
+#include "../src/resources/AudioResource.h"
+#include "../src/core/ThreadPool.h"
+#include "test_check.h"
+
+using namespace RPGEngine::Resources;
+
+/**
+ * Resource load pipeline test
+ * Loads real files through the batched reader and the job system, then
+ * holds the only decode worker to check that queued requests run by
+ * priority and deadline, merge, cancel cleanly, and that uploads respect
+ * the per-frame budget, and that the pipeline moves onto a shared job
+ * system.
+ */
+
+static std::atomic<bool> g_decodeGate(true);
+static std::mutex g_orderMutex;
+static std::vector<std::string> g_decodeOrder;
+
+/**
+ * Resource with staged loading, controllable decode and upload cost
+ */
+class StagedResource : public Resource {
+public:
+    StagedResource(const std::string& id, const std::string& path, int uploadMs = 0)
+        : Resource(id, path), m_uploadMs(uploadMs) {}
+
+    bool load() override {
+        std::ifstream file(getPath(), std::ios::binary);
+        if (!file.is_open()) {
+            setState(ResourceState::Failed);
+            return false;
+        }
+        setState(ResourceState::Loaded);
+        return true;
+    }
+
+    void unload() override {
+        m_text.clear();
+        setState(ResourceState::Unloaded);
+    }
+
+    bool supportsStagedLoad() const override { return true; }
+
+    bool decode(std::vector<uint8_t>& fileData) override {
+        while (!g_decodeGate) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        {
+            std::lock_guard<std::mutex> lock(g_orderMutex);
+            g_decodeOrder.push_back(getId());
+        }
+        m_decoded.assign(fileData.begin(), fileData.end());
+        return true;
+    }
+
+    bool upload() override {
+        std::this_thread::sleep_for(std::chrono::milliseconds(m_uploadMs));
+        m_text = m_decoded;
+        m_decoded.clear();
+        setMemorySize(m_text.size());
+        setState(ResourceState::Loaded);
+        return true;
+    }
+
+    void discardDecoded() override { m_decoded.clear(); }
+
+    const std::string& getText() const { return m_text; }
+
+private:
+    int m_uploadMs;
+    std::string m_decoded;
+    std::string m_text;
+};
+
+static void writeFile(const std::string& path, const std::string& contents) {
+    std::ofstream file(path, std::ios::binary);
+    file.write(contents.data(), static_cast<std::streamsize>(contents.size()));
+}
+
+static std::string makeWav(int sampleRate, int samples) {
+    auto u16 = [](std::string& out, int value) {
+        out.push_back(static_cast<char>(value & 0xFF));
+        out.push_back(static_cast<char>((value >> 8) & 0xFF));
+    };
+    auto u32 = [&u16](std::string& out, int value) {
+        u16(out, value & 0xFFFF);
+        u16(out, (value >> 16) & 0xFFFF);
+    };
+
+    std::string wav = "RIFF";
+    u32(wav, 36 + samples * 2);
+    wav += "WAVEfmt ";
+    u32(wav, 16);
+    u16(wav, 1);                // PCM
+    u16(wav, 1);                // Mono
+    u32(wav, sampleRate);
+    u32(wav, sampleRate * 2);
+    u16(wav, 2);
+    u16(wav, 16);
+    wav += "data";
+    u32(wav, samples * 2);
+    for (int i = 0; i < samples; ++i) {
+        u16(wav, (i * 37) & 0xFFFF);
+    }
+    return wav;
+}
+
+template<typename Condition>
+static bool pumpUntil(ResourceManager& manager, Condition condition) {
+    auto start = std::chrono::steady_clock::now();
+    while (!condition()) {
+        manager.update();
+        if (std::chrono::steady_clock::now() - start > std::chrono::seconds(5)) {
+            return false;
+        }
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    return true;
+}
+
+int main() {
+    std::cout << "=== Resource Pipeline Test ===" << std::endl;
+
+    const std::string dir = (std::filesystem::temp_directory_path() / "rpg_pipeline_test").string();
+    std::filesystem::create_directories(dir);
+
+    // One decode worker so queued requests line up behind a held decode
+    ResourceManager manager(true, 1);
+    manager.initialize();
+    bool allPassed = true;
+
+    // Test 1: real files
+    std::cout << "\n1. Loading a WAV through the pipeline..." << std::endl;
+
+    writeFile(dir + "/tone.wav", makeWav(8000, 4000));
+    auto tone = std::make_shared<AudioResource>("tone", dir + "/tone.wav");
+    manager.addResource(tone);
+
+    bool toneLoaded = false;
+    manager.loadResourceAsync("tone", [&toneLoaded](std::shared_ptr<Resource> resource) {
+        toneLoaded = resource->isLoaded();
+    });
+    allPassed &= check(pumpUntil(manager, [&]() { return toneLoaded; }), "callback runs after upload");
+    allPassed &= check(tone->getChannels() == 1 && tone->getDuration() > 0.49f && tone->getDuration() < 0.51f &&
+                       tone->getData().size() == 8000, "WAV decoded on a worker");
+    std::cout << "Read " << manager.getPipelineStats().bytesRead << " bytes in "
+              << manager.getPipelineStats().ioBatches << " batch(es)" << std::endl;
+
+    auto missing = std::make_shared<StagedResource>("missing", dir + "/missing.dat");
+    manager.addResource(missing);
+    bool missingCalled = false;
+    manager.loadResourceAsync("missing", [&missingCalled](std::shared_ptr<Resource>) { missingCalled = true; });
+    allPassed &= check(pumpUntil(manager, [&]() { return missingCalled; }) && missing->isFailed(),
+                       "unreadable file fails the load");
+
+    // Test 2: priorities and deadlines
+    std::cout << "\n2. Queueing behind a held decode..." << std::endl;
+
+    std::vector<std::shared_ptr<StagedResource>> staged;
+    uint64_t queuedBytes = 0;
+    for (const char* id : {"blocker", "background", "normal_late", "normal_soon", "high", "critical", "dup", "cancelled"}) {
+        std::string payload = std::string("payload:") + id;
+        writeFile(dir + "/" + id + ".dat", payload);
+        staged.push_back(std::make_shared<StagedResource>(id, dir + "/" + id + ".dat"));
+        queuedBytes += payload.size();
+    }
+    manager.addResources(std::vector<std::shared_ptr<Resource>>(staged.begin(), staged.end()));
+
+    // Hold the only worker in the blocker's decode
+    g_decodeGate = false;
+    g_decodeOrder.clear();
+    const uint64_t bytesBefore = manager.getPipelineStats().bytesRead;
+    manager.requestLoad("blocker", LoadOptions());
+    pumpUntil(manager, [&]() { return manager.getPipelineStats().bytesRead > bytesBefore; });
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+    auto now = std::chrono::steady_clock::now();
+    LoadOptions background;
+    background.priority = LoadPriority::Background;
+    LoadOptions normalLate;
+    normalLate.deadline = now + std::chrono::seconds(10);
+    LoadOptions normalSoon;
+    normalSoon.deadline = now + std::chrono::seconds(5);
+    LoadOptions high;
+    high.priority = LoadPriority::High;
+    LoadOptions critical;
+    critical.priority = LoadPriority::Critical;
+
+    manager.requestLoad("background", background);
+    manager.requestLoad("normal_late", normalLate);
+    manager.requestLoad("normal_soon", normalSoon);
+    manager.requestLoad("high", high);
+    manager.requestLoad("critical", critical);
+
+    // Test 3: merging and cancelling
+    int dupCallbacks = 0;
+    LoadRequestId first = manager.requestLoad("dup", background, [&dupCallbacks](std::shared_ptr<Resource>) { dupCallbacks++; });
+    LoadRequestId second = manager.requestLoad("dup", high, [&dupCallbacks](std::shared_ptr<Resource>) { dupCallbacks++; });
+
+    bool cancelledCalled = false;
+    LoadRequestId cancelId = manager.requestLoad("cancelled", critical, [&cancelledCalled](std::shared_ptr<Resource>) {
+        cancelledCalled = true;
+    });
+    allPassed &= check(staged[7]->isLoading(), "requested resource reports loading");
+    allPassed &= check(manager.cancelLoad(cancelId), "queued request cancelled");
+    allPassed &= check(!manager.cancelLoad(cancelId), "cancelling twice does nothing");
+
+    // Wait until the I/O stage has read every file, then release the worker
+    const size_t queuedFiles = 7;
+    queuedBytes -= std::string("payload:cancelled").size();
+    pumpUntil(manager, [&]() { return manager.getPipelineStats().bytesRead >= bytesBefore + queuedBytes; });
+    std::this_thread::sleep_for(std::chrono::milliseconds(50));
+    g_decodeGate = true;
+
+    allPassed &= check(pumpUntil(manager, [&]() {
+        for (size_t i = 0; i < queuedFiles; ++i) {
+            if (!staged[i]->isLoaded()) {
+                return false;
+            }
+        }
+        return true;
+    }), "all queued resources load");
+
+    std::vector<std::string> expected = {"blocker", "critical", "high", "dup", "normal_soon", "normal_late", "background"};
+    allPassed &= check(g_decodeOrder == expected, "decodes run by priority, then deadline");
+    if (g_decodeOrder != expected) {
+        for (const auto& id : g_decodeOrder) {
+            std::cout << "  decoded " << id << std::endl;
+        }
+    }
+
+    std::cout << "\n3. Merging and cancelling..." << std::endl;
+    allPassed &= check(first == second && dupCallbacks == 2, "duplicate requests merge and both callbacks run");
+    allPassed &= check(!cancelledCalled && staged[7]->getState() == ResourceState::Unloaded,
+                       "cancelled request restores state without a callback");
+    allPassed &= check(staged[1]->getText() == "payload:background", "decoded data is uploaded");
+
+    ResourcePipelineStats stats = manager.getPipelineStats();
+    allPassed &= check(stats.coalesced == 1 && stats.cancelled == 1 && stats.failed == 1, "stats count merges, cancels and failures");
+
+    // Test 4: upload budget
+    std::cout << "\n4. Spreading uploads over frames..." << std::endl;
+
+    std::vector<std::shared_ptr<StagedResource>> slow;
+    for (int i = 0; i < 10; ++i) {
+        std::string id = "slow" + std::to_string(i);
+        writeFile(dir + "/" + id + ".dat", "slow upload");
+        slow.push_back(std::make_shared<StagedResource>(id, dir + "/" + id + ".dat", 3));
+    }
+    manager.addResources(std::vector<std::shared_ptr<Resource>>(slow.begin(), slow.end()));
+    manager.setUploadBudget(4.0f);
+
+    g_decodeGate = true;
+    g_decodeOrder.clear();
+    for (const auto& resource : slow) {
+        manager.requestLoad(resource->getId(), LoadOptions());
+    }
+
+    // Let everything decode before the next update
+    auto decoded = [&]() {
+        std::lock_guard<std::mutex> lock(g_orderMutex);
+        return g_decodeOrder.size() == slow.size();
+    };
+    auto start = std::chrono::steady_clock::now();
+    while (!decoded() && std::chrono::steady_clock::now() - start < std::chrono::seconds(5)) {
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds(20));
+
+    uint64_t uploadsBefore = manager.getPipelineStats().uploads;
+    manager.update();
+    stats = manager.getPipelineStats();
+    std::cout << "First frame: " << stats.uploads - uploadsBefore << " uploads in " << stats.lastUploadMs << " ms" << std::endl;
+    allPassed &= check(stats.uploads - uploadsBefore == 2 && stats.uploadsDeferred > 0, "uploads stop at the budget");
+
+    int frames = 1;
+    pumpUntil(manager, [&]() {
+        frames++;
+        return slow.back()->isLoaded();
+    });
+    allPassed &= check(frames >= 5, "remaining uploads spread over later frames");
+
+    // Test 5: reloads and deadlines
+    std::cout << "\n5. Reloading with a missed deadline..." << std::endl;
+
+    writeFile(dir + "/high.dat", "payload:reloaded");
+    bool reloaded = false;
+    manager.reloadResourceAsync("high", [&reloaded](std::shared_ptr<Resource>) { reloaded = true; });
+    allPassed &= check(staged[4]->isLoaded(), "old version stays loaded during reload");
+    allPassed &= check(pumpUntil(manager, [&]() { return reloaded; }) && staged[4]->getText() == "payload:reloaded",
+                       "reload swaps in the new data");
+
+    manager.unloadResource("normal_soon");
+    LoadOptions overdue;
+    overdue.deadline = std::chrono::steady_clock::now() - std::chrono::milliseconds(1);
+    uint64_t missesBefore = manager.getPipelineStats().deadlineMisses;
+    manager.requestLoad("normal_soon", overdue);
+    pumpUntil(manager, [&]() { return staged[3]->isLoaded(); });
+    allPassed &= check(manager.getPipelineStats().deadlineMisses == missesBefore + 1, "missed deadlines are counted");
+
+    // Moving a running pipeline onto a shared job system
+    auto engineJobs = std::make_shared<RPGEngine::Core::ThreadPool>(2);
+    manager.setJobSystem(engineJobs);
+    manager.unloadResource("high");
+    manager.requestLoad("high", LoadOptions());
+    allPassed &= check(pumpUntil(manager, [&]() { return staged[4]->isLoaded(); }), "loads run on a shared job system");
+
+    manager.shutdown();
+    std::filesystem::remove_all(dir);
+
+    std::cout << "\n=== Resource Pipeline Test " << (allPassed ? "Complete" : "FAILED") << " ===" << std::endl;
+    return allPassed ? 0 : 1;
+}
@@ -0,0 +1,190 @@
+#include <iostream>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+#include "../src/save/SaveManager.h"
+#include "../src/save/JsonSaveSerializer.h"
+#include "../src/save/BinarySaveSerializer.h"
+#include "../src/utils/Crc32c.h"
+#include "test_check.h"
+
+using namespace Engine::Save;
+namespace fs = std::filesystem;
+
+/**
+ * Save compression test
+ * Checks CRC-32C against the reference value and across code paths, saves
+ * a large game with every codec in this build and compares size and write
+ * time against uncompressed saves, and checks that corrupted, truncated and
+ * legacy text-header save files are handled.
+ */
+
+static SaveData makeSave(int npcs) {
+    SaveData data;
+    data.version = "1.0";
+    data.player.stats.level = 12;
+    data.world.currentMap = "harbor";
+    for (int i = 0; i < 200; ++i) {
+        PlayerData::InventoryItem item;
+        item.id = "item_" + std::to_string(i);
+        item.quantity = 1 + i % 20;
+        data.player.inventory.push_back(item);
+    }
+    for (int i = 0; i < npcs; ++i) {
+        data.world.gameFlags["quest_flag_" + std::to_string(i)] = (i % 2) == 0;
+        data.world.npcStates["villager_" + std::to_string(i)] = "{\"mood\":\"content\",\"visited\":" + std::to_string(i % 7) + "}";
+    }
+    return data;
+}
+
+static std::string readFile(const std::string& path) {
+    std::ifstream file(path, std::ios::binary);
+    return std::string((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+}
+
+static void writeFile(const std::string& path, const std::string& contents) {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file.write(contents.data(), static_cast<std::streamsize>(contents.size()));
+}
+
+int main() {
+    std::cout << "=== Save Compression Test ===" << std::endl;
+    bool allPassed = true;
+
+    // CRC-32C reference value and path independence
+    const std::string reference = "123456789";
+    allPassed &= check(RPGEngine::Utils::Crc32c::compute(reference.data(), reference.size()) == 0xE3069283u,
+                       "CRC-32C check value");
+
+    std::vector<uint8_t> noise(100003);
+    std::mt19937 rng(7);
+    for (auto& byte : noise) {
+        byte = static_cast<uint8_t>(rng());
+    }
+    uint32_t whole = RPGEngine::Utils::Crc32c::compute(noise.data(), noise.size());
+    uint32_t running = RPGEngine::Utils::Crc32c::compute(noise.data(), 4001);
+    running = RPGEngine::Utils::Crc32c::compute(noise.data() + 4001, noise.size() - 4001, running);
+    allPassed &= check(whole == RPGEngine::Utils::Crc32c::computeSoftware(noise.data(), noise.size()) && whole == running,
+                       "hardware, table and running checksums agree");
+
+    auto timeCrc = [&](auto function) {
+        auto start = std::chrono::high_resolution_clock::now();
+        uint32_t sink = 0;
+        for (int i = 0; i < 100; ++i) {
+            sink ^= function();
+        }
+        auto end = std::chrono::high_resolution_clock::now();
+        double seconds = std::chrono::duration<double>(end - start).count();
+        return sink == 0xFFFFFFFFu ? 0.0 : noise.size() * 100 / seconds / (1024.0 * 1024.0);
+    };
+    double crcMBs = timeCrc([&]() { return RPGEngine::Utils::Crc32c::compute(noise.data(), noise.size()); });
+    double tableMBs = timeCrc([&]() { return RPGEngine::Utils::Crc32c::computeSoftware(noise.data(), noise.size()); });
+    std::cout << "CRC-32C: " << crcMBs << " MB/s, tables only " << tableMBs << " MB/s" << std::endl;
+
+    const std::string dir = "save_compression_tmp";
+    fs::remove_all(dir);
+
+    SaveData data = makeSave(5000);
+
+    struct CodecCase {
+        const char* name;
+        SaveCompression compression;
+    };
+    const CodecCase codecs[] = {
+        {"none", SaveCompression::None},
+        {"lz4", SaveCompression::LZ4},
+        {"zlib", SaveCompression::Zlib},
+        {"zstd", SaveCompression::Zstd}
+    };
+
+    for (int binary = 0; binary < 2; ++binary) {
+        const std::string format = binary ? "binary" : "json";
+        size_t plainSize = 0;
+        double plainMs = 0.0;
+
+        for (const auto& codec : codecs) {
+            if (!SaveManager::isCompressionSupported(codec.compression)) {
+                std::cout << "SKIP: " << codec.name << " not built in" << std::endl;
+                continue;
+            }
+
+            SaveManager manager;
+            if (binary) {
+                manager.setSerializer(std::make_unique<BinarySaveSerializer>());
+            }
+            manager.setBackupEnabled(false);
+            manager.setCompressionEnabled(codec.compression != SaveCompression::None);
+            manager.setCompression(codec.compression);
+            manager.initialize(dir);
+
+            const std::string slot = format + "_" + codec.name;
+            // Best of several writes, so scheduling noise doesn't dominate the timing
+            double writeMs = 1e9;
+            bool saved = true;
+            for (int i = 0; i < 7; ++i) {
+                auto start = std::chrono::high_resolution_clock::now();
+                saved &= manager.saveGame(data, slot) == SaveResult::Success;
+                writeMs = std::min(writeMs, std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count());
+            }
+            size_t size = static_cast<size_t>(fs::file_size(dir + "/" + slot + ".sav"));
+
+            SaveData loaded;
+            bool loadedOk = manager.loadGame(loaded, slot) == LoadResult::Success;
+            allPassed &= check(saved && loadedOk && loaded.world.npcStates == data.world.npcStates &&
+                               loaded.player.inventory.size() == data.player.inventory.size(),
+                               format + " save round trip with " + codec.name);
+
+            std::cout << "  " << format << "/" << codec.name << ": " << size << " bytes, " << writeMs << " ms per save" << std::endl;
+
+            if (codec.compression == SaveCompression::None) {
+                plainSize = size;
+                plainMs = writeMs;
+            } else {
+                allPassed &= check(size * 2 < plainSize, format + " " + codec.name + " save is under half the size");
+            }
+
+            if (codec.compression == SaveCompression::LZ4) {
+                std::cout << "  " << format << " lz4 write time vs uncompressed: " << writeMs / plainMs << "x" << std::endl;
+            }
+        }
+    }
+
+    // The codec is stored per file, so a manager set to another codec still reads it
+    SaveManager reader;
+    reader.setCompression(SaveCompression::None);
+    reader.initialize(dir);
+    SaveData fromLz4;
+    allPassed &= check(reader.loadGame(fromLz4, "json_lz4") == LoadResult::Success, "codec read from the file header");
+
+    // Corrupt one payload byte
+    std::string corrupted = readFile(dir + "/json_lz4.sav");
+    corrupted[corrupted.size() / 2] ^= 0x40;
+    writeFile(dir + "/corrupted.sav", corrupted);
+    SaveData fromCorrupted;
+    allPassed &= check(reader.loadGame(fromCorrupted, "corrupted") == LoadResult::FileCorrupted, "corrupted payload detected");
+
+    std::string truncated = readFile(dir + "/json_lz4.sav");
+    writeFile(dir + "/truncated.sav", truncated.substr(0, truncated.size() - 10));
+    SaveData fromTruncated;
+    allPassed &= check(reader.loadGame(fromTruncated, "truncated") == LoadResult::FileCorrupted, "truncated payload detected");
+
+    // Text-header saves from before the binary header still load
+    JsonSaveSerializer json;
+    writeFile(dir + "/legacy.sav", "COMPRESSED:0\nDATA:\n" + json.serialize(data));
+    SaveData fromLegacy;
+    allPassed &= check(reader.loadGame(fromLegacy, "legacy") == LoadResult::Success &&
+                       fromLegacy.world.currentMap == "harbor", "legacy text header loads");
+
+    allPassed &= check(SaveManager::isCompressionSupported(SaveCompression::LZ4) &&
+                       (reader.setCompression(SaveCompression::Zstd) == SaveManager::isCompressionSupported(SaveCompression::Zstd)),
+                       "codec availability reported");
+
+    fs::remove_all(dir);
+
+    std::cout << "\n=== Save Compression Test " << (allPassed ? "Complete" : "FAILED") << " ===" << std::endl;
+    return allPassed ? 0 : 1;
+}
@@ -0,0 +1,196 @@
+#include <iostream>
+#include <chrono>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+#include "../src/save/SaveManager.h"
+#include "../src/save/JsonSaveSerializer.h"
+#include "../src/core/ThreadPool.h"
+#include "test_check.h"
+
+using namespace Engine::Save;
+namespace fs = std::filesystem;
+
+/**
+ * Save listing test
+ * Writes 50 save slots with backups and thumbnails, then compares listing
+ * them by loading every save (how getSaveInfo used to work) against
+ * SaveManager::getSaveList reading only the metadata headers, both cold and
+ * through the slot index. Also checks thumbnails, index invalidation, and
+ * that older and damaged files are handled.
+ */
+
+static SaveData makeSave(int slot) {
+    SaveData data;
+    data.version = "1.0";
+    data.player.stats.level = 1 + slot;
+    data.world.currentMap = "map_" + std::to_string(slot % 7);
+    for (int i = 0; i < 3000; ++i) {
+        data.world.gameFlags["flag_" + std::to_string(i)] = ((i + slot) % 3) == 0;
+        data.world.npcStates["npc_" + std::to_string(i)] = "{\"mood\":" + std::to_string((i * slot) % 11) + "}";
+    }
+    if (slot % 2 == 0) {
+        data.thumbnail.width = 64;
+        data.thumbnail.height = 36;
+        data.thumbnail.pixels.resize(64 * 36 * 4);
+        for (size_t i = 0; i < data.thumbnail.pixels.size(); ++i) {
+            data.thumbnail.pixels[i] = static_cast<uint8_t>(i * 7 + slot);
+        }
+    }
+    return data;
+}
+
+static const SaveManager::SaveInfo* findSlot(const std::vector<SaveManager::SaveInfo>& list, const std::string& slot) {
+    for (const auto& info : list) {
+        if (info.slotName == slot) {
+            return &info;
+        }
+    }
+    return nullptr;
+}
+
+int main() {
+    std::cout << "=== Save Listing Test ===" << std::endl;
+    bool allPassed = true;
+
+    const std::string dir = "save_listing_tmp";
+    const int slotCount = 50;
+    fs::remove_all(dir);
+
+    {
+        SaveManager writer;
+        writer.setCompressionEnabled(true);
+        writer.setMaxSaveSlots(slotCount);
+        writer.initialize(dir);
+        for (int slot = 0; slot < slotCount; ++slot) {
+            // Saved twice so every slot has a backup next to it
+            writer.saveGame(makeSave(slot), slot);
+            writer.saveGame(makeSave(slot), slot);
+        }
+    }
+
+    // Full loads: every save loaded in full to show its slot
+    auto fullStart = std::chrono::steady_clock::now();
+    SaveManager loader;
+    loader.setMaxSaveSlots(slotCount);
+    loader.initialize(dir);
+    int loadedSlots = 0;
+    for (const auto& entry : fs::directory_iterator(dir)) {
+        if (entry.path().extension() == ".sav") {
+            SaveData data;
+            loadedSlots += loader.loadGame(data, entry.path().stem().string()) == LoadResult::Success ? 1 : 0;
+        }
+    }
+    double fullMs = elapsedMs(fullStart);
+
+    // Listing: metadata headers only, read in parallel
+    auto jobSystem = std::make_shared<RPGEngine::Core::ThreadPool>(4);
+    SaveManager manager;
+    manager.setMaxSaveSlots(slotCount);
+    manager.setJobSystem(jobSystem);
+    manager.initialize(dir);
+
+    auto coldStart = std::chrono::steady_clock::now();
+    auto list = manager.getSaveList();
+    double coldMs = elapsedMs(coldStart);
+
+    auto warmStart = std::chrono::steady_clock::now();
+    auto warmList = manager.getSaveList();
+    double warmMs = elapsedMs(warmStart);
+
+    // A fresh manager starts from the index file
+    SaveManager reopened;
+    reopened.initialize(dir);
+    auto indexStart = std::chrono::steady_clock::now();
+    auto indexList = reopened.getSaveList();
+    double indexMs = elapsedMs(indexStart);
+
+    std::cout << "Full load of " << loadedSlots << " saves: " << fullMs << " ms" << std::endl;
+    std::cout << "Header listing, cold: " << coldMs << " ms" << std::endl;
+    std::cout << "Header listing, cached: " << warmMs << " ms; from index file: " << indexMs << " ms" << std::endl;
+
+    allPassed &= check(loadedSlots == slotCount && list.size() == static_cast<size_t>(slotCount) &&
+                       warmList.size() == list.size() && indexList.size() == list.size(), "all slots listed");
+    allPassed &= check(fs::exists(dir + "/slots.idx"), "slot index written");
+
+    const SaveManager::SaveInfo* slot7 = findSlot(list, "slot_7");
+    const SaveManager::SaveInfo* slot8 = findSlot(indexList, "slot_8");
+    allPassed &= check(slot7 && slot7->playerLevel == 8 && slot7->currentMap == "map_0" && slot7->version == "1.0" &&
+                       !slot7->timestamp.empty() && !slot7->hasThumbnail() &&
+                       slot7->fileSize == fs::file_size(dir + "/slot_7.sav"), "metadata read from the header");
+    allPassed &= check(slot8 && slot8->playerLevel == 9 && slot8->thumbnailWidth == 64 && slot8->thumbnailHeight == 36,
+                       "metadata read from the index");
+
+    SaveManager::SaveInfo single;
+    allPassed &= check(manager.getSaveInfo(12, single) && single.playerLevel == 13 && single.hasThumbnail(),
+                       "single slot info from the header");
+
+    // Thumbnails are read on demand and come back with a load
+    SaveThumbnail thumbnail;
+    SaveData loaded;
+    allPassed &= check(manager.loadThumbnail("slot_8", thumbnail) && thumbnail.pixels == makeSave(8).thumbnail.pixels,
+                       "thumbnail read from the header");
+    allPassed &= check(!manager.loadThumbnail("slot_7", thumbnail), "slot without a thumbnail");
+    allPassed &= check(manager.loadGame(loaded, 8) == LoadResult::Success && loaded.thumbnail.width == 64 &&
+                       loaded.thumbnail.pixels == makeSave(8).thumbnail.pixels, "thumbnail loaded with the save");
+
+    SaveData badThumbnail = makeSave(1);
+    badThumbnail.thumbnail.width = 10;
+    badThumbnail.thumbnail.height = 10;
+    badThumbnail.thumbnail.pixels.resize(12);
+    allPassed &= check(manager.saveGame(badThumbnail, "bad_thumbnail") == SaveResult::ValidationError,
+                       "thumbnail size validated");
+
+    // Rewriting a slot invalidates its index entry
+    SaveData changed = makeSave(3);
+    changed.player.stats.level = 99;
+    manager.saveGame(changed, 3);
+    const SaveManager::SaveInfo* slot3 = findSlot(manager.getSaveList(), "slot_3");
+    allPassed &= check(slot3 && slot3->playerLevel == 99, "rewritten slot listed with new metadata");
+
+    // Text-header saves have no metadata block and are loaded in full
+    JsonSaveSerializer json;
+    SaveData legacy = makeSave(20);
+    legacy.timestamp = "2020-01-01T00:00:00Z";
+    {
+        std::ofstream file(dir + "/legacy.sav", std::ios::binary);
+        file << "COMPRESSED:0\nDATA:\n" << json.serialize(legacy);
+    }
+
+    // Truncated saves are left out without reading the payload
+    fs::copy_file(dir + "/slot_5.sav", dir + "/truncated.sav");
+    fs::resize_file(dir + "/truncated.sav", fs::file_size(dir + "/truncated.sav") - 100);
+
+    auto mixed = manager.getSaveList();
+    const SaveManager::SaveInfo* legacyInfo = findSlot(mixed, "legacy");
+    allPassed &= check(legacyInfo && legacyInfo->playerLevel == 21 && legacyInfo->timestamp == legacy.timestamp,
+                       "legacy save listed through a full load");
+    allPassed &= check(!findSlot(mixed, "truncated") && mixed.size() == static_cast<size_t>(slotCount + 1),
+                       "truncated save left out");
+
+    // Deleted slots drop out, and a damaged index is rebuilt
+    manager.deleteSave(0);
+    {
+        std::ofstream file(dir + "/slots.idx", std::ios::trunc);
+        file << "not an index\n";
+    }
+    SaveManager afterDamage;
+    afterDamage.initialize(dir);
+    auto rebuilt = afterDamage.getSaveList();
+    allPassed &= check(rebuilt.size() == static_cast<size_t>(slotCount) && !findSlot(rebuilt, "slot_0"),
+                       "damaged index rebuilt");
+
+    SaveManager noIndex;
+    noIndex.setSaveIndexEnabled(false);
+    fs::remove(dir + "/slots.idx");
+    noIndex.initialize(dir);
+    allPassed &= check(noIndex.getSaveList().size() == rebuilt.size() && !fs::exists(dir + "/slots.idx"),
+                       "listing without an index file");
+
+    fs::remove_all(dir);
+
+    std::cout << "\n=== Save Listing Test " << (allPassed ? "Complete" : "FAILED") << " ===" << std::endl;
+    return allPassed ? 0 : 1;
+}
@@ -0,0 +1,268 @@
+#include <iostream>
+#include <chrono>
+#include <filesystem>
+#include <functional>
+#include <string>
+#include <vector>
+#include "../src/save/SaveManager.h"
+#include "../src/save/JsonSaveSerializer.h"
+#include "../src/save/BinarySaveSerializer.h"
+#include "test_check.h"
+
+using namespace Engine::Save;
+
+/**
+ * Save serializer benchmark
+ * Builds a large save (many NPC states and game flags) and compares
+ * JsonSaveSerializer against BinarySaveSerializer: serialize and
+ * deserialize time, size, and a full SaveManager save and load round trip.
+ * Also checks that the binary format round-trips, skips unknown fields and
+ * rejects truncated data.
+ *
+ * Usage: SaveSerializerBench [--npcs N] [--flags N] [--items N] [--iterations N]
+ */
+
+namespace {
+
+double timeMs(int iterations, const std::function<void()>& body) {
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < iterations; ++i) {
+        body();
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    return std::chrono::duration<double, std::milli>(end - start).count() / iterations;
+}
+
+SaveData makeSave(int npcs, int flags, int items) {
+    SaveData data;
+    data.version = "1.0";
+    data.timestamp = "2024-01-01T00:00:00Z";
+    data.player.position.x = 1234.5f;
+    data.player.position.y = -87.25f;
+    data.player.stats.hp = 420;
+    data.player.stats.maxHp = 500;
+    data.player.stats.mp = 75;
+    data.player.stats.maxMp = 120;
+    data.player.stats.level = 37;
+    data.player.stats.experience = 918273;
+    data.player.stats.experienceToNext = 12000;
+
+    for (int i = 0; i < items; ++i) {
+        PlayerData::InventoryItem item;
+        item.id = "item_" + std::to_string(i);
+        item.quantity = 1 + i % 99;
+        data.player.inventory.push_back(item);
+    }
+    data.player.equipment["weapon"] = "item_3";
+    data.player.equipment["armor"] = "item_7";
+
+    data.world.currentMap = "northern_wastes";
+    for (int i = 0; i < flags; ++i) {
+        data.world.gameFlags["flag_" + std::to_string(i)] = (i % 3) == 0;
+    }
+    for (int i = 0; i < npcs; ++i) {
+        data.world.npcStates["npc_" + std::to_string(i)] =
+            "{\"mood\":" + std::to_string(i % 5) + ",\"dialogue\":\"node_" + std::to_string(i % 40) + "\"}";
+    }
+    for (int i = 0; i < npcs / 50; ++i) {
+        data.world.completedQuests.push_back("quest_" + std::to_string(i));
+        data.world.discoveredLocations["location_" + std::to_string(i)] = true;
+    }
+    data.customData["system.weather"] = "{\"type\":\"snow\",\"intensity\":0.7}";
+    data.customData["system.time"] = "{\"day\":112,\"hour\":21}";
+
+    return data;
+}
+
+bool sameSave(const SaveData& a, const SaveData& b) {
+    if (a.version != b.version || a.timestamp != b.timestamp || a.player.position.x != b.player.position.x ||
+        a.player.position.y != b.player.position.y || a.player.stats.hp != b.player.stats.hp ||
+        a.player.stats.maxHp != b.player.stats.maxHp || a.player.stats.mp != b.player.stats.mp ||
+        a.player.stats.maxMp != b.player.stats.maxMp || a.player.stats.level != b.player.stats.level ||
+        a.player.stats.experience != b.player.stats.experience ||
+        a.player.stats.experienceToNext != b.player.stats.experienceToNext ||
+        a.player.inventory.size() != b.player.inventory.size()) {
+        return false;
+    }
+
+    for (size_t i = 0; i < a.player.inventory.size(); ++i) {
+        if (a.player.inventory[i].id != b.player.inventory[i].id ||
+            a.player.inventory[i].quantity != b.player.inventory[i].quantity) {
+            return false;
+        }
+    }
+
+    return a.player.equipment == b.player.equipment && a.world.currentMap == b.world.currentMap &&
+           a.world.completedQuests == b.world.completedQuests && a.world.gameFlags == b.world.gameFlags &&
+           a.world.npcStates == b.world.npcStates && a.world.discoveredLocations == b.world.discoveredLocations &&
+           a.customData == b.customData;
+}
+
+struct SerializerResult {
+    double serializeMs = 0.0;
+    double deserializeMs = 0.0;
+    size_t bytes = 0;
+    double saveMs = 0.0;
+    double loadMs = 0.0;
+    size_t fileBytes = 0;
+    bool roundTrip = false;
+};
+
+SerializerResult runSerializer(const std::string& name, const std::function<std::unique_ptr<ISaveSerializer>()>& create,
+                               const SaveData& data, int iterations, const std::string& directory) {
+    SerializerResult result;
+    auto serializer = create();
+
+    std::string serialized;
+    result.serializeMs = timeMs(iterations, [&]() { serialized = serializer->serialize(data); });
+    result.bytes = serialized.size();
+
+    SaveData loaded;
+    result.deserializeMs = timeMs(iterations, [&]() {
+        loaded = SaveData();
+        serializer->deserialize(serialized, loaded);
+    });
+    result.roundTrip = sameSave(data, loaded);
+
+    // Full SaveManager round trip, including the file header and checksum
+    SaveManager manager;
+    manager.setSerializer(create());
+    manager.setBackupEnabled(false);
+    manager.initialize(directory);
+
+    result.saveMs = timeMs(iterations, [&]() { manager.saveGame(data, name); });
+    result.fileBytes = static_cast<size_t>(std::filesystem::file_size(directory + "/" + name + ".sav"));
+    result.loadMs = timeMs(iterations, [&]() {
+        SaveData fromFile;
+        manager.loadGame(fromFile, name);
+    });
+
+    return result;
+}
+
+void printResult(const std::string& name, const SerializerResult& result) {
+    std::cout << name << ": serialize " << result.serializeMs << " ms, deserialize " << result.deserializeMs
+              << " ms, " << result.bytes << " bytes; SaveManager save " << result.saveMs << " ms, load "
+              << result.loadMs << " ms, " << result.fileBytes << " bytes on disk" << std::endl;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    int npcs = 20000;
+    int flags = 20000;
+    int items = 500;
+    int iterations = 5;
+
+    for (int i = 1; i + 1 < argc; i += 2) {
+        std::string arg = argv[i];
+        int value = std::stoi(argv[i + 1]);
+        if (arg == "--npcs") {
+            npcs = value;
+        } else if (arg == "--flags") {
+            flags = value;
+        } else if (arg == "--items") {
+            items = value;
+        } else if (arg == "--iterations") {
+            iterations = value;
+        }
+    }
+
+    std::cout << "=== Save Serializer Benchmark ===" << std::endl;
+    std::cout << npcs << " NPC states, " << flags << " game flags, " << items << " items, " << iterations
+              << " iterations" << std::endl;
+
+    const std::string directory = "save_bench_tmp";
+    std::filesystem::remove_all(directory);
+
+    SaveData data = makeSave(npcs, flags, items);
+    bool allPassed = true;
+
+    SerializerResult json = runSerializer("json", []() { return std::make_unique<JsonSaveSerializer>(); },
+                                          data, iterations, directory);
+    SerializerResult binary = runSerializer("binary", []() { return std::make_unique<BinarySaveSerializer>(); },
+                                            data, iterations, directory);
+
+    printResult("JSON", json);
+    printResult("Binary", binary);
+
+    allPassed &= check(json.roundTrip, "JSON round trip");
+    allPassed &= check(binary.roundTrip, "binary round trip");
+    allPassed &= check(binary.bytes < json.bytes, "binary is smaller than JSON");
+    std::cout << "Binary vs JSON: serialize " << json.serializeMs / binary.serializeMs << "x, deserialize "
+              << json.deserializeMs / binary.deserializeMs << "x faster" << std::endl;
+
+    SaveManager manager;
+    manager.setSerializer(std::make_unique<BinarySaveSerializer>());
+    manager.setBackupEnabled(false);
+    manager.initialize(directory);
+    SaveData fromFile;
+    LoadResult loadResult = manager.loadGame(fromFile, "binary");
+    fromFile.timestamp = data.timestamp;    // Stamped by saveGame
+    allPassed &= check(loadResult == LoadResult::Success && sameSave(data, fromFile),
+                       "binary save file loads through SaveManager");
+
+    BinarySaveSerializer serializer;
+    std::string small = serializer.serialize(makeSave(10, 10, 2));
+
+    uint16_t schema = 0;
+    std::string version;
+    allPassed &= check(BinarySaveSerializer::readSchemaVersion(small, schema) && schema == BINARY_SAVE_SCHEMA_VERSION &&
+                       BinarySaveSerializer::peekVersion(small, version) && version == "1.0",
+                       "schema and save version read from the header");
+
+    // Migration runs on the decoded data, no text round trip involved
+    SaveData migrated;
+    allPassed &= check(serializer.deserialize(small, migrated) &&
+                       manager.migrateSaveData(migrated, version, "2.0") && migrated.version == "2.0",
+                       "binary save migrates to 2.0");
+
+    // A field from a newer build is skipped
+    std::string extended = small;
+    BinarySaveWriter writer(extended);
+    writer.writeString(99, "added later");
+    size_t marker = writer.beginMessage(98);
+    writer.writeUInt(1, 12345);
+    writer.endMessage(marker);
+    SaveData withUnknown;
+    allPassed &= check(serializer.deserialize(extended, withUnknown) && sameSave(makeSave(10, 10, 2), withUnknown),
+                       "unknown fields skipped");
+
+    SaveData truncated;
+    allPassed &= check(!serializer.deserialize(small.substr(0, small.size() - 3), truncated), "truncated save rejected");
+
+    // Fields whose wire type doesn't match their number are corrupt
+    std::string mistyped = small.substr(0, BINARY_SAVE_HEADER_SIZE);
+    BinarySaveWriter mistypedWriter(mistyped);
+    mistypedWriter.writeString(1, "1.0");
+    size_t playerMarker = mistypedWriter.beginMessage(3);
+    mistypedWriter.writeString(3, "full health");
+    mistypedWriter.endMessage(playerMarker);
+    std::string mistypedDelta;
+    BinarySaveWriter(mistypedDelta).writeUInt(1, 42);
+    SaveData fromMistyped;
+    SaveDelta delta;
+    allPassed &= check(!serializer.deserialize(mistyped, fromMistyped) && !serializer.deserializeDelta(mistypedDelta, delta),
+                       "mismatched wire types rejected");
+
+    std::string newer = small;
+    newer[4] = static_cast<char>(BINARY_SAVE_SCHEMA_VERSION + 1);
+    SaveData fromNewer;
+    allPassed &= check(!serializer.deserialize(newer, fromNewer), "newer schema rejected");
+
+    // Long messages widen their length prefix
+    std::string longMessage;
+    BinarySaveWriter longWriter(longMessage);
+    size_t longMarker = longWriter.beginMessage(1);
+    longWriter.writeString(1, std::string(300, 'x'));
+    longWriter.endMessage(longMarker);
+    BinarySaveReader longReader(longMessage.data(), longMessage.size());
+    BinarySaveReader::Field field;
+    allPassed &= check(longReader.next(field) && field.bytes.size() == 303 && !longReader.next(field) && !longReader.hasError(),
+                       "multi-byte message length");
+
+    std::filesystem::remove_all(directory);
+
+    std::cout << "\n=== Save Serializer Benchmark " << (allPassed ? "Complete" : "FAILED") << " ===" << std::endl;
+    return allPassed ? 0 : 1;
+}
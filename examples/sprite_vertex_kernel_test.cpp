@@ -0,0 +1,182 @@
+#include <iostream>
+#include <chrono>
+#include <vector>
+#include <random>
+#include <cmath>
+#include "../src/graphics/SpriteVertexKernel.h"
+
+using namespace RPGEngine::Graphics;
+
+/**
+ * Sprite vertex kernel test
+ * Checks every available instruction set against the scalar path and
+ * benchmarks vertex throughput against the per-float push_back path that
+ * SpriteRenderer::addSpriteToBatch used before the kernel existed.
+ */
+
+struct SpriteColumns {
+    std::vector<float> x, y, width, height, rotation, originX, originY;
+    std::vector<float> u0, v0, u1, v1, r, g, b, a;
+
+    SpriteTransformSoA view() const {
+        return SpriteTransformSoA{
+            x.data(), y.data(), width.data(), height.data(), rotation.data(),
+            originX.data(), originY.data(), u0.data(), v0.data(), u1.data(), v1.data(),
+            r.data(), g.data(), b.data(), a.data(), x.size()
+        };
+    }
+};
+
+// Previous scalar path: rotation, origin and color pushed one float at a time
+static void legacyAddSprite(std::vector<float>& vertices, const SpriteColumns& s, size_t i) {
+    float originOffsetX = s.width[i] * s.originX[i];
+    float originOffsetY = s.height[i] * s.originY[i];
+    float x0 = -originOffsetX;
+    float y0 = -originOffsetY;
+    float x1 = s.width[i] - originOffsetX;
+    float y1 = s.height[i] - originOffsetY;
+
+    float px[4] = { x0, x1, x1, x0 };
+    float py[4] = { y0, y0, y1, y1 };
+
+    if (s.rotation[i] != 0.0f) {
+        float radians = s.rotation[i] * 3.14159f / 180.0f;
+        float c = std::cos(radians);
+        float sn = std::sin(radians);
+        for (int k = 0; k < 4; ++k) {
+            float rx = c * px[k] - sn * py[k];
+            float ry = sn * px[k] + c * py[k];
+            px[k] = rx;
+            py[k] = ry;
+        }
+    }
+
+    const float u[4] = { s.u0[i], s.u1[i], s.u1[i], s.u0[i] };
+    const float v[4] = { s.v0[i], s.v0[i], s.v1[i], s.v1[i] };
+    for (int k = 0; k < 4; ++k) {
+        vertices.push_back(s.x[i] + px[k]);
+        vertices.push_back(s.y[i] + py[k]);
+        vertices.push_back(0.0f);
+        vertices.push_back(s.r[i]);
+        vertices.push_back(s.g[i]);
+        vertices.push_back(s.b[i]);
+        vertices.push_back(s.a[i]);
+        vertices.push_back(u[k]);
+        vertices.push_back(v[k]);
+    }
+}
+
+int main() {
+    std::cout << "=== Sprite Vertex Kernel Test ===" << std::endl;
+
+    const size_t spriteCount = 100000;
+    const int iterations = 20;
+
+    std::mt19937 gen(1234);
+    std::uniform_real_distribution<float> posDist(-5000.0f, 5000.0f);
+    std::uniform_real_distribution<float> sizeDist(8.0f, 64.0f);
+    std::uniform_real_distribution<float> unitDist(0.0f, 1.0f);
+
+    SpriteColumns columns;
+    for (size_t i = 0; i < spriteCount; ++i) {
+        columns.x.push_back(posDist(gen));
+        columns.y.push_back(posDist(gen));
+        columns.width.push_back(sizeDist(gen));
+        columns.height.push_back(sizeDist(gen));
+        // A quarter of the sprites are rotated
+        columns.rotation.push_back(i % 4 == 0 ? unitDist(gen) * 360.0f : 0.0f);
+        columns.originX.push_back(0.5f);
+        columns.originY.push_back(0.5f);
+        columns.u0.push_back(0.0f);
+        columns.v0.push_back(0.0f);
+        columns.u1.push_back(1.0f);
+        columns.v1.push_back(1.0f);
+        columns.r.push_back(unitDist(gen));
+        columns.g.push_back(unitDist(gen));
+        columns.b.push_back(unitDist(gen));
+        columns.a.push_back(1.0f);
+    }
+
+    SpriteTransformSoA view = columns.view();
+    const size_t floatCount = spriteCount * SpriteVertexKernel::FLOATS_PER_SPRITE;
+
+    // Test 1: correctness of every supported instruction set
+    std::cout << "\n1. Checking kernel output against the legacy path..." << std::endl;
+
+    std::vector<float> reference;
+    reference.reserve(floatCount);
+    for (size_t i = 0; i < spriteCount; ++i) {
+        legacyAddSprite(reference, columns, i);
+    }
+
+    const SpriteKernelISA isas[] = { SpriteKernelISA::Scalar, SpriteKernelISA::SSE, SpriteKernelISA::AVX2 };
+    std::vector<float> output(floatCount);
+    bool allPassed = true;
+
+    for (SpriteKernelISA isa : isas) {
+        if (!SpriteVertexKernel::isSupported(isa)) {
+            std::cout << SpriteVertexKernel::getISAName(isa) << ": not supported, skipped" << std::endl;
+            continue;
+        }
+
+        size_t written = SpriteVertexKernel::generate(isa, view, output.data(), output.size());
+        float maxError = 0.0f;
+        for (size_t i = 0; i < floatCount; ++i) {
+            maxError = std::max(maxError, std::fabs(output[i] - reference[i]));
+        }
+
+        bool passed = written == spriteCount && maxError < 1e-3f;
+        allPassed = allPassed && passed;
+        std::cout << SpriteVertexKernel::getISAName(isa) << ": " << (passed ? "PASS" : "FAIL")
+                  << " (max error " << maxError << ")" << std::endl;
+    }
+
+    // Output span smaller than the input must not be overrun
+    std::vector<float> smallOutput(10 * SpriteVertexKernel::FLOATS_PER_SPRITE + 5, -1.0f);
+    size_t partial = SpriteVertexKernel::generate(view, smallOutput.data(), smallOutput.size());
+    bool spanRespected = partial == 10 && smallOutput.back() == -1.0f;
+    allPassed = allPassed && spanRespected;
+    std::cout << "Output span limit: " << (spanRespected ? "PASS" : "FAIL") << std::endl;
+
+    // Test 2: throughput
+    std::cout << "\n2. Benchmarking vertex generation (" << spriteCount << " sprites x "
+              << iterations << " iterations)..." << std::endl;
+
+    auto report = [&](const char* name, std::chrono::microseconds duration) {
+        double seconds = duration.count() / 1000000.0;
+        double vertices = static_cast<double>(spriteCount) * 4.0 * iterations;
+        std::cout << name << ": " << duration.count() << " microseconds, "
+                  << (seconds > 0.0 ? vertices / seconds / 1000000.0 : 0.0) << " M vertices/s" << std::endl;
+    };
+
+    std::vector<float> legacyVertices;
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int it = 0; it < iterations; ++it) {
+        legacyVertices.clear();
+        for (size_t i = 0; i < spriteCount; ++i) {
+            legacyAddSprite(legacyVertices, columns, i);
+        }
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    report("Legacy push_back", std::chrono::duration_cast<std::chrono::microseconds>(end - start));
+
+    for (SpriteKernelISA isa : isas) {
+        if (!SpriteVertexKernel::isSupported(isa)) {
+            continue;
+        }
+
+        start = std::chrono::high_resolution_clock::now();
+        for (int it = 0; it < iterations; ++it) {
+            SpriteVertexKernel::generate(isa, view, output.data(), output.size());
+        }
+        end = std::chrono::high_resolution_clock::now();
+
+        std::string name = std::string("Kernel ") + SpriteVertexKernel::getISAName(isa);
+        report(name.c_str(), std::chrono::duration_cast<std::chrono::microseconds>(end - start));
+    }
+
+    std::cout << "\nBest available: " << SpriteVertexKernel::getISAName(SpriteVertexKernel::getBestISA()) << std::endl;
+    std::cout << "\n=== Sprite Vertex Kernel Test " << (allPassed ? "Complete" : "FAILED") << " ===" << std::endl;
+
+    return allPassed ? 0 : 1;
+}
@@ -0,0 +1,191 @@
+#include <iostream>
+#include <chrono>
+#include <memory>
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <algorithm>
+#include "../src/components/StatsComponent.h"
+#include "test_check.h"
+
+using namespace RPGEngine;
+using namespace RPGEngine::Components;
+
+/**
+ * Stats cache test
+ * Compares the per-query modifier walk StatsComponent used to do for every
+ * max HP/MP and derived stat read against the cached stat values, over a
+ * frame loop like CombatUI's. Checks that cached values match the
+ * uncached formulas after base value, attribute, modifier, expiry, level
+ * and deserialize changes, and that attribute changes reach the stats
+ * derived from them.
+ */
+
+// How StatsComponent computed stats before caching: hashed lookup and walk per query
+struct LegacyStats {
+    std::unordered_map<Utils::StringId, std::vector<StatModifier>> modifiers;
+    std::unordered_map<AttributeType, int> attributes;
+    float baseMaxHP = 100.0f;
+    float baseMaxMP = 50.0f;
+    float currentHP = 100.0f;
+
+    float modified(float base, Utils::StringId stat) const {
+        auto it = modifiers.find(stat);
+        if (it == modifiers.end()) {
+            return base;
+        }
+        float flat = 0.0f, percentage = 1.0f, multiplier = 1.0f;
+        for (const auto& modifier : it->second) {
+            switch (modifier.type) {
+                case ModifierType::Flat: flat += modifier.value; break;
+                case ModifierType::Percentage: percentage += modifier.value / 100.0f; break;
+                case ModifierType::Multiplier: multiplier *= modifier.value; break;
+            }
+        }
+        return std::max(0.0f, (base + flat) * percentage * multiplier);
+    }
+
+    int attribute(AttributeType type, const char* name) const {
+        return static_cast<int>(modified(static_cast<float>(attributes.at(type)), Utils::StringId(name)));
+    }
+
+    float maxHP() const {
+        return modified(baseMaxHP + attribute(AttributeType::Vitality, "vitality") * 5.0f, Utils::StringId("hp"));
+    }
+
+    float maxMP() const {
+        return modified(baseMaxMP + attribute(AttributeType::Intelligence, "intelligence") * 3.0f, Utils::StringId("mp"));
+    }
+
+    int defense() const {
+        return static_cast<int>(modified(attribute(AttributeType::Vitality, "vitality") * 1.5f, Utils::StringId("defense")));
+    }
+
+    void setCurrentHP(float hp) {
+        currentHP = std::max(0.0f, std::min(hp, maxHP()));
+    }
+};
+
+static void equip(StatsComponent& stats, LegacyStats& legacy, const std::string& stat, const StatModifier& modifier) {
+    stats.addModifier(stat, modifier);
+    legacy.modifiers[Utils::StringId::intern(stat)].push_back(modifier);
+}
+
+int main() {
+    std::cout << "=== Stats Cache Test ===" << std::endl;
+    bool allPassed = true;
+
+    // Participants with a typical spread of equipment and buffs
+    const int participantCount = 40;
+    std::vector<std::unique_ptr<StatsComponent>> participants;
+    std::vector<LegacyStats> legacy(participantCount);
+    for (int i = 0; i < participantCount; ++i) {
+        participants.push_back(std::make_unique<StatsComponent>(i + 1));
+        StatsComponent& stats = *participants.back();
+        stats.setBaseAttribute(AttributeType::Vitality, 10 + i % 7);
+        stats.setBaseAttribute(AttributeType::Intelligence, 8 + i % 5);
+        legacy[i].attributes = stats.getBaseAttributes();
+
+        equip(stats, legacy[i], "hp", StatModifier("armor", "equipment", ModifierType::Flat, 20.0f + i));
+        equip(stats, legacy[i], "hp", StatModifier("ring", "equipment", ModifierType::Percentage, 10.0f));
+        equip(stats, legacy[i], "vitality", StatModifier("amulet", "equipment", ModifierType::Flat, 3.0f));
+        equip(stats, legacy[i], "mp", StatModifier("staff", "equipment", ModifierType::Multiplier, 1.2f));
+        equip(stats, legacy[i], "defense", StatModifier("shield", "equipment", ModifierType::Flat, 8.0f));
+        equip(stats, legacy[i], "strength", StatModifier("rage", "spell", ModifierType::Percentage, 25.0f));
+        equip(stats, legacy[i], "evasion", StatModifier("haste", "spell", ModifierType::Flat, 4.0f));
+        equip(stats, legacy[i], "hp", StatModifier("blessing", "spell", ModifierType::Flat, 15.0f));
+    }
+
+    bool matches = true;
+    for (int i = 0; i < participantCount; ++i) {
+        matches &= participants[i]->getMaxHP() == legacy[i].maxHP() &&
+                   participants[i]->getMaxMP() == legacy[i].maxMP() &&
+                   participants[i]->getDefense() == legacy[i].defense();
+    }
+    allPassed &= check(matches, "cached stats match uncached formulas");
+
+    // Uncached: every read walks the modifiers again
+    const int frames = 20000;
+    float sink = 0.0f;
+    auto legacyStart = std::chrono::steady_clock::now();
+    for (int frame = 0; frame < frames; ++frame) {
+        for (auto& stats : legacy) {
+            stats.setCurrentHP(stats.currentHP - 0.001f);
+            float maxHP = stats.maxHP();
+            sink += stats.currentHP / maxHP + stats.maxMP() + maxHP + static_cast<float>(stats.defense());
+        }
+    }
+    double legacyMs = elapsedMs(legacyStart);
+
+    // Cached: same reads served from the cache
+    auto cachedStart = std::chrono::steady_clock::now();
+    for (int frame = 0; frame < frames; ++frame) {
+        for (auto& stats : participants) {
+            stats->setCurrentHP(stats->getCurrentHP() - 0.001f);
+            sink += stats->getHPPercentage() + stats->getMaxMP() + stats->getMaxHP() +
+                    static_cast<float>(stats->getDefense());
+        }
+    }
+    double cachedMs = elapsedMs(cachedStart);
+
+    std::cout << "Uncached stat reads: " << legacyMs << " ms for " << frames << " frames of "
+              << participantCount << " participants" << std::endl;
+    std::cout << "Cached stat reads: " << cachedMs << " ms" << std::endl;
+    allPassed &= check(sink > 0.0f, "timed reads returned stats");
+
+    // Dependencies invalidate derived stats
+    StatsComponent stats(100);
+    float maxHP = stats.getMaxHP();
+    int defense = stats.getDefense();
+    stats.addModifier("vitality", StatModifier("tonic", "consumable", ModifierType::Flat, 4.0f, 1.0f));
+    allPassed &= check(stats.getMaxHP() == maxHP + 20.0f && stats.getDefense() == defense + 6,
+                       "vitality modifier reaches max HP and defense");
+    stats.updateModifiers(0.5f);
+    allPassed &= check(stats.getMaxHP() == maxHP + 20.0f, "unexpired modifier kept");
+    stats.updateModifiers(0.6f);
+    allPassed &= check(stats.getMaxHP() == maxHP && stats.getDefense() == defense, "expired modifier dropped from cache");
+
+    float maxMP = stats.getMaxMP();
+    int magicPower = stats.getMagicPower();
+    stats.setBaseAttribute(AttributeType::Intelligence, 20);
+    allPassed &= check(stats.getMaxMP() == maxMP + 30.0f && stats.getMagicPower() == magicPower + 20 &&
+                       stats.getMaxHP() == maxHP, "base attribute reaches only its derived stats");
+
+    stats.setBaseMaxHP(200.0f);
+    allPassed &= check(stats.getMaxHP() == maxHP + 100.0f, "base max HP change recomputes max HP");
+
+    // Stacks apply flat, then percentage, then multiplier whatever the order added
+    stats.addModifier("attack_power", StatModifier("fury", "spell", ModifierType::Multiplier, 2.0f));
+    stats.addModifier("attack_power", StatModifier("training", "skill", ModifierType::Percentage, 50.0f));
+    stats.addModifier("attack_power", StatModifier("blade", "equipment", ModifierType::Flat, 10.0f));
+    std::vector<StatModifier> stack = stats.getModifiers("attack_power");
+    allPassed &= check(stack.size() == 3 && stack[0].id == "blade" && stack[1].id == "training" && stack[2].id == "fury" &&
+                       stats.getAttackPower() == static_cast<int>((20.0f + 10.0f) * 1.5f * 2.0f),
+                       "modifiers sorted in application order");
+    stats.addModifier("attack_power", StatModifier("training", "skill", ModifierType::Flat, 5.0f));
+    stack = stats.getModifiers("attack_power");
+    allPassed &= check(stack.size() == 3 && stack[1].id == "training" && stack[2].id == "fury" &&
+                       stats.getAttackPower() == static_cast<int>((20.0f + 15.0f) * 2.0f),
+                       "replaced modifier moves to its new step");
+
+    stats.removeModifiersFromSource("spell");
+    allPassed &= check(stats.getAttackPower() == 35 && !stats.hasModifier("attack_power", "fury"),
+                       "source removal recomputes");
+    allPassed &= check(stats.removeModifier("attack_power", "blade") && stats.getAttackPower() == 25,
+                       "modifier removal recomputes");
+
+    // Level up raises every attribute; deserialize replaces everything
+    int strength = stats.getAttribute(AttributeType::Strength);
+    stats.setLevel(3);
+    allPassed &= check(stats.getAttribute(AttributeType::Strength) == strength + 2 &&
+                       stats.getMaxHP() == 200.0f + (10 + 2) * 5.0f, "level up recomputes attributes");
+
+    StatsComponent restored(101);
+    float restoredBefore = restored.getMaxHP();
+    allPassed &= check(restored.deserialize(stats.serialize()) && restoredBefore != stats.getMaxHP() &&
+                       restored.getMaxHP() == stats.getMaxHP() && restored.getAttackPower() == stats.getAttackPower(),
+                       "deserialize recomputes");
+
+    std::cout << "\n=== Stats Cache Test " << (allPassed ? "Complete" : "FAILED") << " ===" << std::endl;
+    return allPassed ? 0 : 1;
+}
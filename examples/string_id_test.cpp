@@ -0,0 +1,120 @@
+#include <iostream>
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <unordered_map>
+#include <vector>
+#include "../src/utils/StringId.h"
+#include "../src/components/StatsComponent.h"
+#include "../src/components/InventoryComponent.h"
+#include "../src/components/QuestComponent.h"
+#include "test_check.h"
+
+using namespace RPGEngine;
+using namespace RPGEngine::Components;
+using namespace RPGEngine::Utils::StringIdLiterals;
+using Utils::StringId;
+using Utils::StringIdRegistry;
+
+/**
+ * String ID test
+ * Checks that ID literals are compile-time constants matching runtime
+ * hashing, that interned names can be looked up again and collisions are
+ * reported, and compares per-frame lookups by string against lookups by ID.
+ * Also runs the components that now key on IDs: stat modifiers, item
+ * definitions and stacks, and quest kill tracking.
+ */
+
+// Must compile: literals are usable in constant expressions
+static_assert("hp"_sid == StringId(std::string_view("hp")), "literal matches constructor");
+static_assert("hp"_sid.value() == 0x513ad265u, "FNV-1a reference value");
+static_assert(!StringId().isValid() && !""_sid.isValid(), "empty ID is invalid");
+
+int main() {
+    std::cout << "=== String ID Test ===" << std::endl;
+    bool allPassed = true;
+
+    // Reverse lookup
+    const std::string runtimeName = std::string("goblin_") + "chief";
+    StringId chief = StringId::intern(runtimeName);
+    allPassed &= check(chief == "goblin_chief"_sid && chief.str() == "goblin_chief", "interned name looked up by ID");
+    char hex[16];
+    std::snprintf(hex, sizeof(hex), "#%08x", "never_interned"_sid.value());
+    allPassed &= check("never_interned"_sid.str() == hex, "unregistered ID shown as hex");
+
+    // Collisions are reported at registration, re-registering is not one
+    size_t collisionsBefore = StringIdRegistry::getInstance().getCollisionCount();
+    StringId::intern("goblin_chief");
+    allPassed &= check(StringIdRegistry::getInstance().getCollisionCount() == collisionsBefore, "re-interning is not a collision");
+    StringId first = StringId::intern("costarring");
+    StringId second = StringId::intern("liquid");
+    allPassed &= check(first == second && StringIdRegistry::getInstance().getCollisionCount() == collisionsBefore + 1 &&
+                       first.str() == "costarring", "colliding names reported");
+
+    // Actions keyed by name, hashed and compared as strings every query
+    const char* actionNames[] = {"move_up", "move_down", "move_left", "move_right", "interact", "attack", "menu", "inventory"};
+    std::unordered_map<std::string, float> byName;
+    std::unordered_map<StringId, float> byId;
+    for (int i = 0; i < 8; ++i) {
+        byName[actionNames[i]] = static_cast<float>(i);
+        byId[StringId::intern(actionNames[i])] = static_cast<float>(i);
+    }
+
+    const int frames = 200000;
+    float sink = 0.0f;
+    auto nameStart = std::chrono::steady_clock::now();
+    for (int frame = 0; frame < frames; ++frame) {
+        sink += byName.find("move_up")->second + byName.find("move_down")->second + byName.find("move_left")->second +
+                byName.find("move_right")->second + byName.find("interact")->second + byName.find("attack")->second;
+    }
+    double nameMs = elapsedMs(nameStart);
+
+    // IDs hashed at compile time, compared as integers
+    auto idStart = std::chrono::steady_clock::now();
+    for (int frame = 0; frame < frames; ++frame) {
+        sink += byId.find("move_up"_sid)->second + byId.find("move_down"_sid)->second + byId.find("move_left"_sid)->second +
+                byId.find("move_right"_sid)->second + byId.find("interact"_sid)->second + byId.find("attack"_sid)->second;
+    }
+    double idMs = elapsedMs(idStart);
+
+    std::cout << "String lookups: " << nameMs << " ms for " << frames * 6 << " queries" << std::endl;
+    std::cout << "ID lookups: " << idMs << " ms" << std::endl;
+    allPassed &= check(sink > 0.0f, "timed lookups found every action");
+
+    // Stat modifiers keyed by ID, named again for serialization
+    StatsComponent stats(1);
+    int baseStrength = stats.getAttribute(AttributeType::Strength);
+    stats.addModifier("strength", StatModifier("ring", "equipment", ModifierType::Flat, 5.0f));
+    allPassed &= check(stats.getAttribute(AttributeType::Strength) == baseStrength + 5 &&
+                       stats.hasModifier("strength", "ring"), "stat modifier applied by ID");
+    StatsComponent restored(2);
+    allPassed &= check(restored.deserialize(stats.serialize()) &&
+                       restored.getAttribute(AttributeType::Strength) == baseStrength + 5, "stat modifiers round trip");
+    allPassed &= check(stats.removeModifier("strength", "ring") &&
+                       stats.getAttribute(AttributeType::Strength) == baseStrength, "stat modifier removed");
+
+    // Item definitions and stacks
+    InventoryComponent::registerItemDefinition(ItemDefinition("potion", "Potion", ItemType::Consumable, 10));
+    InventoryComponent inventory(3, 5);
+    inventory.addItem("potion", 4);
+    inventory.addItem("potion", 4);
+    allPassed &= check(InventoryComponent::getItemDefinition("potion"_sid) &&
+                       inventory.getItemQuantity("potion") == 8 && inventory.findItemSlot("potion") == 0 &&
+                       inventory.getUsedSlots() == 1, "items stack by ID");
+    allPassed &= check(inventory.removeItem("potion", 3) == 3 && inventory.getItemQuantity("potion") == 5 &&
+                       inventory.addItem("unknown", 1) == 0, "items removed by ID");
+
+    // Kill objectives matched by ID
+    QuestDefinition hunt("hunt", "Hunt");
+    hunt.addObjective(QuestObjective("wolves", "Kill wolves", ObjectiveType::Kill, "wolf", 3));
+    QuestComponent::registerQuestDefinition(hunt);
+    QuestComponent quests(4);
+    quests.startQuest("hunt");
+    quests.trackKill("wolf"_sid, 2);
+    quests.trackKill("bear");
+    quests.trackKill(std::string("wolf"));
+    allPassed &= check(quests.getObjectiveProgress("hunt", "wolves") == 3, "kills tracked by ID");
+
+    std::cout << "\n=== String ID Test " << (allPassed ? "Complete" : "FAILED") << " ===" << std::endl;
+    return allPassed ? 0 : 1;
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include <chrono>
+#include <iostream>
+#include <string>
+
+/**
+ * Helpers shared by the example test programs
+ * Each check prints PASS or FAIL and returns the result, so a test can
+ * report every failure before returning non-zero. Timings are printed for
+ * comparison only; they vary with load, sanitizers and build type, so
+ * tests never fail on them.
+ */
+
+/**
+ * Print and return the result of a check
+ * @param condition Result
+ * @param name What was checked
+ * @return condition
+ */
+inline bool check(bool condition, const std::string& name) {
+    std::cout << (condition ? "PASS: " : "FAIL: ") << name << std::endl;
+    return condition;
+}
+
+/**
+ * Get the time since a start point
+ * @param start Start time
+ * @return Elapsed milliseconds
+ */
+inline double elapsedMs(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
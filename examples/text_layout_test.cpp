@@ -0,0 +1,163 @@
+#include <iostream>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "../src/graphics/Font.h"
+#include "../src/graphics/TextLayout.h"
+#include "../src/graphics/MockGraphicsAPI.h"
+#include "test_check.h"
+
+using namespace RPGEngine::Graphics;
+
+/**
+ * Text layout test
+ * Checks the built-in font atlas, BMFont loading, layout (kerning, line
+ * breaks, word wrap, UTF-8) and the text mesh cache, then compares the cost
+ * of laying out labels every frame against cache hits.
+ */
+
+static bool nearlyEqual(float a, float b) {
+    return std::fabs(a - b) < 1e-4f;
+}
+
+int main() {
+    std::cout << "=== Text Layout Test ===" << std::endl;
+
+    auto graphicsAPI = std::make_shared<MockGraphicsAPI>();
+    graphicsAPI->initialize(800, 600, "TextLayoutTest", false);
+    bool allPassed = true;
+
+    // Test 1: built-in font
+    std::cout << "\n1. Baking the built-in font..." << std::endl;
+
+    Font font(graphicsAPI);
+    allPassed &= check(font.createDefault(), "default font created");
+    allPassed &= check(font.isLoaded() && font.getGlyphCount() == 97, "95 ASCII glyphs plus 2 symbols");
+    allPassed &= check(font.getGlyph('A') && font.getGlyph('A')->codepoint == 'A', "ASCII lookup");
+    allPassed &= check(font.getGlyph(0x4E2D) == font.getGlyph('?'), "missing glyph falls back to '?'");
+
+    float u0, v0, u1, v1;
+    allPassed &= check(font.getWhiteRegion(u0, v0, u1, v1) && u1 > u0 && v1 > v0, "atlas has a white region");
+
+    // Test 2: layout
+    std::cout << "\n2. Laying out text..." << std::endl;
+
+    TextMesh mesh;
+    TextLayout::layout(font, "Hello", 16.0f, 0.0f, mesh);
+    allPassed &= check(mesh.quads.size() == 5 && nearlyEqual(mesh.width, 80.0f) && nearlyEqual(mesh.height, 20.0f),
+                       "single line metrics scale with size");
+
+    TextLayout::layout(font, "a b", 8.0f, 0.0f, mesh);
+    allPassed &= check(mesh.quads.size() == 2 && nearlyEqual(mesh.quads[1].x, 16.0f), "spaces advance without quads");
+
+    TextLayout::layout(font, "ab\ncd", 8.0f, 0.0f, mesh);
+    allPassed &= check(mesh.lineCount == 2 && nearlyEqual(mesh.quads[2].x, 0.0f) && nearlyEqual(mesh.quads[2].y, 10.0f),
+                       "explicit line break");
+
+    TextLayout::layout(font, "aaa bbb", 8.0f, 50.0f, mesh);
+    allPassed &= check(mesh.lineCount == 2 && nearlyEqual(mesh.width, 24.0f) &&
+                       nearlyEqual(mesh.quads[3].x, 0.0f) && nearlyEqual(mesh.quads[3].y, 10.0f),
+                       "word wrap moves the whole word");
+
+    TextLayout::layout(font, "abcdefgh", 8.0f, 20.0f, mesh);
+    allPassed &= check(mesh.lineCount == 4 && mesh.width <= 20.0f, "long words break between characters");
+
+    TextLayout::layout(font, "\xE2\x96\xB2\xE2\x96\xBC", 8.0f, 0.0f, mesh);
+    allPassed &= check(mesh.quads.size() == 2 && mesh.quads[0].u0 != font.getGlyph('?')->u0, "UTF-8 symbols decode");
+
+    TextLayout::layout(font, "", 8.0f, 0.0f, mesh);
+    allPassed &= check(mesh.quads.empty() && mesh.lineCount == 0 && mesh.height == 0.0f, "empty text");
+
+    // Test 3: BMFont loading
+    std::cout << "\n3. Loading a BMFont descriptor..." << std::endl;
+
+    const std::string fontPath = "text_layout_test.fnt";
+    {
+        std::ofstream file(fontPath);
+        file << "info face=\"Test Font\" size=32 bold=0\n"
+             << "common lineHeight=40 base=30 scaleW=256 scaleH=256 pages=1\n"
+             << "page id=0 file=\"text_layout_test.png\"\n"
+             << "chars count=2\n"
+             << "char id=65 x=0 y=0 width=20 height=24 xoffset=1 yoffset=6 xadvance=22 page=0 chnl=15\n"
+             << "char id=86 x=20 y=0 width=20 height=24 xoffset=0 yoffset=6 xadvance=21 page=0 chnl=15\n"
+             << "kernings count=1\n"
+             << "kerning first=65 second=86 amount=-3\n";
+    }
+
+    Font bmFont(graphicsAPI);
+    allPassed &= check(bmFont.loadFromFile(fontPath), "BMFont loaded");
+    allPassed &= check(bmFont.getGlyphCount() == 2 && nearlyEqual(bmFont.getLineHeight(), 40.0f), "glyphs and metrics");
+
+    TextLayout::layout(bmFont, "AV", 32.0f, 0.0f, mesh);
+    allPassed &= check(mesh.quads.size() == 2 && nearlyEqual(mesh.quads[1].x, 19.0f) && nearlyEqual(mesh.quads[0].y, 6.0f),
+                       "kerning and offsets applied");
+    std::remove(fontPath.c_str());
+
+    // Test 4: mesh cache
+    std::cout << "\n4. Caching text meshes..." << std::endl;
+
+    std::vector<std::string> labels;
+    for (int i = 0; i < 200; ++i) {
+        labels.push_back("Inventory slot " + std::to_string(i) + ": Potion of Healing");
+    }
+
+    TextMeshCache cache(256);
+    for (const auto& label : labels) {
+        cache.get(font, label, 14.0f);
+    }
+    cache.nextFrame();
+    allPassed &= check(cache.getStats().misses == labels.size() && cache.getStats().hits == 0, "first frame lays out");
+
+    cache.resetStats();
+    for (const auto& label : labels) {
+        cache.get(font, label, 14.0f);
+    }
+    cache.nextFrame();
+    allPassed &= check(cache.getStats().misses == 0 && cache.getStats().hits == labels.size(), "second frame hits");
+
+    cache.get(font, labels[0], 14.0f, 100.0f);
+    cache.get(font, labels[0], 20.0f);
+    allPassed &= check(cache.getStats().misses == 2, "size and wrap width are part of the key");
+
+    // Grow past capacity, then only the last frame's entries survive
+    for (int i = 0; i < 100; ++i) {
+        cache.get(font, "Overflow " + std::to_string(i), 14.0f);
+    }
+    cache.nextFrame();
+    allPassed &= check(cache.getSize() == 102 && cache.getStats().evictions == 200, "unused entries evicted over capacity");
+
+    // Test 5: benchmark
+    const int frames = 200;
+    std::cout << "\n5. Benchmarking " << labels.size() << " labels x " << frames << " frames..." << std::endl;
+
+    size_t quadCount = 0;
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int frame = 0; frame < frames; ++frame) {
+        for (const auto& label : labels) {
+            TextLayout::layout(font, label, 14.0f, 0.0f, mesh);
+            quadCount += mesh.quads.size();
+        }
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    auto layoutTime = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+
+    start = std::chrono::high_resolution_clock::now();
+    for (int frame = 0; frame < frames; ++frame) {
+        for (const auto& label : labels) {
+            quadCount -= cache.get(font, label, 14.0f).quads.size();
+        }
+        cache.nextFrame();
+    }
+    end = std::chrono::high_resolution_clock::now();
+    auto cachedTime = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+
+    std::cout << "Layout every frame: " << layoutTime.count() << " microseconds" << std::endl;
+    std::cout << "Cached meshes: " << cachedTime.count() << " microseconds" << std::endl;
+    allPassed &= check(quadCount == 0, "cached meshes match fresh layout");
+
+    std::cout << "\n=== Text Layout Test " << (allPassed ? "Complete" : "FAILED") << " ===" << std::endl;
+    return allPassed ? 0 : 1;
+}
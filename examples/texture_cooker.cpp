@@ -0,0 +1,80 @@
+#include <iostream>
+#include <string>
+#include <vector>
+#include "../src/resources/TextureCooker.h"
+
+// The cooker reads any image stb_image can
+#define STB_IMAGE_IMPLEMENTATION
+#include <stb_image.h>
+
+using namespace RPGEngine::Resources;
+
+/**
+ * Texture cooker
+ * Cooks images into ready-to-upload textures for TextureResource.
+ *
+ * Usage: TextureCooker [--format rgba8|bc|etc2] [--straight-alpha] [--no-mipmaps] [-o output.rtex] image...
+ *
+ * Each image is written next to itself with the .rtex extension (so
+ * "tiles.png" becomes "tiles.rtex", which TextureResource loads in its
+ * place) unless -o names the output of a single image.
+ */
+
+int main(int argc, char* argv[]) {
+    TextureCookOptions options;
+    std::string output;
+    std::vector<std::string> inputs;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        bool hasValue = i + 1 < argc;
+
+        if (arg == "--format" && hasValue) {
+            std::string format = argv[++i];
+            if (format == "rgba8") {
+                options.format = TextureCookFormat::RGBA8;
+            } else if (format == "bc") {
+                options.format = TextureCookFormat::BC;
+            } else if (format == "etc2") {
+                options.format = TextureCookFormat::ETC2;
+            } else {
+                std::cerr << "Unknown texture format: " << format << std::endl;
+                return 1;
+            }
+        } else if (arg == "--straight-alpha") {
+            options.premultiplyAlpha = false;
+        } else if (arg == "--no-mipmaps") {
+            options.generateMipmaps = false;
+        } else if (arg == "-o" && hasValue) {
+            output = argv[++i];
+        } else {
+            inputs.push_back(arg);
+        }
+    }
+
+    if (inputs.empty() || (!output.empty() && inputs.size() != 1)) {
+        std::cerr << "Usage: TextureCooker [--format rgba8|bc|etc2] [--straight-alpha] [--no-mipmaps] [-o output.rtex] image..." << std::endl;
+        return 1;
+    }
+
+    TextureCooker cooker(options);
+    int failures = 0;
+    for (const auto& input : inputs) {
+        std::string target = output.empty() ? cookedTexturePath(input) : output;
+        if (!cooker.cookFile(input, target)) {
+            failures++;
+            continue;
+        }
+
+        const TextureCookStats& stats = cooker.getStats();
+        std::cout << "Cooked " << input << " -> " << target << ": " << stats.width << "x" << stats.height << " "
+                  << cookedFormatName(stats.format) << ", " << stats.levels << " levels, " << stats.cookedBytes
+                  << " bytes (" << stats.uncompressedBytes << " as RGBA8)";
+        if (stats.psnr > 0.0) {
+            std::cout << ", PSNR " << stats.psnr << " dB";
+        }
+        std::cout << std::endl;
+    }
+
+    return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,268 @@
+#include <iostream>
+#include <chrono>
+#include <cmath>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+#include "../src/resources/TextureCooker.h"
+#include "../src/resources/TextureResource.h"
+
+// Decodes the PNGs TextureResource loads
+#define STB_IMAGE_IMPLEMENTATION
+#include <stb_image.h>
+#include "test_check.h"
+
+using namespace RPGEngine::Resources;
+
+/**
+ * Texture cooker test
+ * Cooks a tileset atlas to RGBA8, BC and ETC2, checks the container, mip
+ * chain, premultiplied alpha and block compression quality, then compares
+ * loading the PNG (decode, full-size upload, generated mipmaps) against
+ * loading the cooked texture in its place.
+ */
+
+static void writeFile(const std::string& path, const std::vector<uint8_t>& contents) {
+    std::ofstream file(path, std::ios::binary | std::ios::trunc);
+    file.write(reinterpret_cast<const char*>(contents.data()), static_cast<std::streamsize>(contents.size()));
+}
+
+static void putU32(std::vector<uint8_t>& out, uint32_t value) {
+    for (int shift = 24; shift >= 0; shift -= 8) {
+        out.push_back(static_cast<uint8_t>(value >> shift));
+    }
+}
+
+static uint32_t crc32(const uint8_t* data, size_t size) {
+    uint32_t crc = 0xFFFFFFFFu;
+    for (size_t i = 0; i < size; ++i) {
+        crc ^= data[i];
+        for (int bit = 0; bit < 8; ++bit) {
+            crc = (crc >> 1) ^ (0xEDB88320u & (0u - (crc & 1u)));
+        }
+    }
+    return ~crc;
+}
+
+static void putChunk(std::vector<uint8_t>& png, const char* type, const std::vector<uint8_t>& data) {
+    putU32(png, static_cast<uint32_t>(data.size()));
+    std::vector<uint8_t> body(type, type + 4);
+    body.insert(body.end(), data.begin(), data.end());
+    png.insert(png.end(), body.begin(), body.end());
+    putU32(png, crc32(body.data(), body.size()));
+}
+
+/**
+ * Encode RGBA pixels as a PNG (stored deflate blocks; stb_image still
+ * inflates and unfilters it like any PNG)
+ */
+static std::vector<uint8_t> encodePng(const std::vector<uint8_t>& rgba, int width, int height) {
+    std::vector<uint8_t> raw;
+    for (int y = 0; y < height; ++y) {
+        raw.push_back(0);
+        raw.insert(raw.end(), rgba.begin() + static_cast<size_t>(y) * width * 4, rgba.begin() + static_cast<size_t>(y + 1) * width * 4);
+    }
+
+    std::vector<uint8_t> zlib = {0x78, 0x01};
+    for (size_t offset = 0; offset < raw.size(); offset += 65535) {
+        size_t length = std::min<size_t>(65535, raw.size() - offset);
+        zlib.push_back(offset + length == raw.size() ? 1 : 0);
+        zlib.push_back(static_cast<uint8_t>(length));
+        zlib.push_back(static_cast<uint8_t>(length >> 8));
+        zlib.push_back(static_cast<uint8_t>(~length));
+        zlib.push_back(static_cast<uint8_t>(~length >> 8));
+        zlib.insert(zlib.end(), raw.begin() + offset, raw.begin() + offset + length);
+    }
+    uint32_t a = 1, b = 0;
+    for (uint8_t byte : raw) {
+        a = (a + byte) % 65521;
+        b = (b + a) % 65521;
+    }
+    putU32(zlib, (b << 16) | a);
+
+    std::vector<uint8_t> header;
+    putU32(header, static_cast<uint32_t>(width));
+    putU32(header, static_cast<uint32_t>(height));
+    header.insert(header.end(), {8, 6, 0, 0, 0});     // 8-bit RGBA
+
+    std::vector<uint8_t> png = {0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+    putChunk(png, "IHDR", header);
+    putChunk(png, "IDAT", zlib);
+    putChunk(png, "IEND", {});
+    return png;
+}
+
+/**
+ * Tileset atlas: 32x32 tiles with gradients and a transparent border
+ */
+static std::vector<uint8_t> makeAtlas(int size) {
+    std::vector<uint8_t> rgba(static_cast<size_t>(size) * size * 4);
+    for (int y = 0; y < size; ++y) {
+        for (int x = 0; x < size; ++x) {
+            int tile = (y / 32) * (size / 32) + x / 32;
+            int tx = x % 32;
+            int ty = y % 32;
+            uint8_t* pixel = &rgba[(static_cast<size_t>(y) * size + x) * 4];
+            pixel[0] = static_cast<uint8_t>((tile * 37 + tx * 4) & 0xFF);
+            pixel[1] = static_cast<uint8_t>((tile * 91 + ty * 5) & 0xFF);
+            pixel[2] = static_cast<uint8_t>(128 + 60 * std::sin((tx + ty) * 0.2));
+            pixel[3] = (tx < 2 || ty < 2 || tx > 29 || ty > 29) ? 0 : (tx < 4 || ty < 4 ? 128 : 255);
+        }
+    }
+    return rgba;
+}
+
+template<typename Function>
+static double averageMs(int runs, Function function) {
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < runs; ++i) {
+        function();
+    }
+    return std::chrono::duration<double, std::milli>(std::chrono::high_resolution_clock::now() - start).count() / runs;
+}
+
+int main() {
+    std::cout << "=== Texture Cooker Test ===" << std::endl;
+
+    namespace fs = std::filesystem;
+    const fs::path root = fs::temp_directory_path() / "rpg_texture_cooker_test";
+    fs::remove_all(root);
+    fs::create_directories(root);
+    const std::string dir = root.string();
+    bool allPassed = true;
+
+    const int size = 1024;
+    std::vector<uint8_t> atlas = makeAtlas(size);
+
+    // Test 1: container and mip chain
+    std::cout << "\n1. Cooking a " << size << "x" << size << " atlas..." << std::endl;
+
+    TextureCooker rgbaCooker;
+    std::vector<uint8_t> cooked;
+    allPassed &= check(rgbaCooker.cook(atlas.data(), size, size, cooked), "atlas cooked");
+
+    CookedTexture texture;
+    allPassed &= check(parseCookedTexture(cooked.data(), cooked.size(), texture) && texture.levels.size() == 11 &&
+                       texture.levels.back().width == 1 && texture.levels[3].width == 128, "full mip chain down to 1x1");
+    allPassed &= check(texture.isPremultiplied() && texture.levels[0].data[0 * 4 + 3] == 0 &&
+                       texture.levels[0].data[0] == 0, "transparent pixels premultiplied to black");
+
+    const uint8_t* halfAlpha = texture.levels[0].data + (static_cast<size_t>(2) * size + 10) * 4;
+    const uint8_t* source = atlas.data() + (static_cast<size_t>(2) * size + 10) * 4;
+    allPassed &= check(halfAlpha[3] == 128 && halfAlpha[0] == (source[0] * 128 + 127) / 255, "color scaled by alpha");
+
+    std::vector<uint8_t> truncated(cooked.begin(), cooked.begin() + cooked.size() / 2);
+    CookedTexture invalid;
+    allPassed &= check(!parseCookedTexture(truncated.data(), truncated.size(), invalid), "truncated file rejected");
+
+    int oddWidth = 5, oddHeight = 3;
+    std::vector<uint8_t> odd(5 * 3 * 4, 200);
+    std::vector<uint8_t> half = TextureCooker::downsample(odd, oddWidth, oddHeight);
+    allPassed &= check(oddWidth == 2 && oddHeight == 1 && half[0] == 200, "odd sizes downsample");
+
+    // Test 2: block compression
+    std::cout << "\n2. Block compression..." << std::endl;
+
+    struct FormatCase {
+        TextureCookFormat format;
+        CookedTextureFormat expected;
+        const char* name;
+        double minPsnr;         // Hard tile edges; ETC2 shares luminance modifiers per half block
+    };
+    const FormatCase cases[] = {
+        {TextureCookFormat::BC, CookedTextureFormat::BC3, "bc", 30.0},
+        {TextureCookFormat::ETC2, CookedTextureFormat::ETC2_RGBA8, "etc2", 27.0}
+    };
+    for (const auto& formatCase : cases) {
+        TextureCookOptions options;
+        options.format = formatCase.format;
+        TextureCooker cooker(options);
+        std::vector<uint8_t> data;
+        cooker.cook(atlas.data(), size, size, data);
+        writeFile(dir + "/atlas_" + formatCase.name + ".rtex", data);
+
+        const TextureCookStats& stats = cooker.getStats();
+        CookedTexture parsed;
+        allPassed &= check(parseCookedTexture(data.data(), data.size(), parsed) && parsed.format == formatCase.expected,
+                           std::string(formatCase.name) + " picks " + cookedFormatName(formatCase.expected) + " for alpha");
+        allPassed &= check(stats.cookedBytes <= stats.uncompressedBytes / 4 + 64, std::string(formatCase.name) + " is at most a quarter of RGBA8");
+        allPassed &= check(stats.psnr > formatCase.minPsnr, std::string(formatCase.name) + " PSNR above " +
+                           std::to_string(static_cast<int>(formatCase.minPsnr)) + " dB");
+        std::cout << cookedFormatName(stats.format) << ": " << stats.cookedBytes << " bytes, PSNR " << stats.psnr << " dB" << std::endl;
+    }
+
+    // Opaque images get the 8-byte formats; flat blocks survive exactly
+    std::vector<uint8_t> opaque(64 * 64 * 4);
+    for (size_t i = 0; i < opaque.size(); i += 4) {
+        opaque[i] = 255; opaque[i + 1] = 0; opaque[i + 2] = 0; opaque[i + 3] = 255;
+    }
+    for (TextureCookFormat format : {TextureCookFormat::BC, TextureCookFormat::ETC2}) {
+        TextureCookOptions options;
+        options.format = format;
+        TextureCooker cooker(options);
+        std::vector<uint8_t> data;
+        cooker.cook(opaque.data(), 64, 64, data);
+        CookedTexture parsed;
+        parseCookedTexture(data.data(), data.size(), parsed);
+        std::vector<uint8_t> decoded = TextureCooker::decode(parsed.format, parsed.levels[0].data, 64, 64);
+        bool flat = std::abs(decoded[0] - 255) <= 8 && decoded[1] <= 8 && decoded[2] <= 8 && decoded[3] == 255;
+        allPassed &= check((parsed.format == CookedTextureFormat::BC1 || parsed.format == CookedTextureFormat::ETC2_RGB8) &&
+                           parsed.levels[0].size == 16 * 16 * 8 && flat,
+                           std::string(cookedFormatName(parsed.format)) + " for opaque images");
+    }
+
+    // Odd-sized levels pad to whole blocks
+    allPassed &= check(cookedLevelSize(CookedTextureFormat::BC3, 5, 3) == 2 * 16 && cookedLevelSize(CookedTextureFormat::BC1, 1, 1) == 8,
+                       "partial blocks rounded up");
+
+    // Test 3: loading
+    std::cout << "\n3. Loading the PNG vs the cooked texture..." << std::endl;
+
+    std::vector<uint8_t> png = encodePng(atlas, size, size);
+    writeFile(dir + "/tiles.png", png);
+
+    TextureResource pngTexture("tiles_png", dir + "/tiles.png");
+    allPassed &= check(pngTexture.getLoadPath() == dir + "/tiles.png", "PNG loads itself without a cooked file");
+    const int runs = 5;
+    double pngMs = averageMs(runs, [&]() {
+        pngTexture.load();
+        pngTexture.unload();
+    });
+    pngTexture.load();
+    size_t pngBytes = pngTexture.getMemorySize();
+
+    fs::copy_file(dir + "/atlas_bc.rtex", dir + "/tiles.rtex");
+    TextureResource cookedTexture("tiles_cooked", dir + "/tiles.png");
+    allPassed &= check(cookedTexture.getLoadPath() == dir + "/tiles.rtex", "cooked file substituted for the PNG");
+    double cookedMs = averageMs(runs, [&]() {
+        cookedTexture.load();
+        cookedTexture.unload();
+    });
+    cookedTexture.load();
+    allPassed &= check(cookedTexture.isLoaded() && cookedTexture.getWidth() == size && cookedTexture.getLevelCount() == 11 &&
+                       cookedTexture.isPremultipliedAlpha(), "cooked texture loads with its levels");
+    allPassed &= check(cookedTexture.getMemorySize() <= pngBytes / 4 + 256, "BC3 uses a quarter of the VRAM");
+
+    // Staged loading (the async pipeline path) takes the cooked bytes as read
+    std::ifstream cookedFile(dir + "/tiles.rtex", std::ios::binary);
+    std::vector<uint8_t> fileData((std::istreambuf_iterator<char>(cookedFile)), std::istreambuf_iterator<char>());
+    TextureResource staged("tiles_staged", dir + "/tiles.png");
+    allPassed &= check(staged.decode(fileData) && staged.upload() && staged.getLevelCount() == 11 &&
+                       staged.getMemorySize() == cookedTexture.getMemorySize(), "staged load of a cooked texture");
+
+    writeFile(dir + "/broken.rtex", truncated);
+    TextureResource broken("broken", dir + "/broken.png");
+    allPassed &= check(!broken.load() && broken.isFailed(), "invalid cooked texture fails the load");
+
+    std::cout << "PNG: " << pngMs << " ms per load, " << pngBytes << " bytes of VRAM" << std::endl;
+    std::cout << "Cooked BC3: " << cookedMs << " ms per load, " << cookedTexture.getMemorySize() << " bytes of VRAM" << std::endl;
+
+    pngTexture.unload();
+    cookedTexture.unload();
+    staged.unload();
+    fs::remove_all(root);
+
+    std::cout << "\n=== Texture Cooker Test " << (allPassed ? "Complete" : "FAILED") << " ===" << std::endl;
+    return allPassed ? 0 : 1;
+}
@@ -0,0 +1,155 @@
+#include <iostream>
+#include <memory>
+#include <string>
+#include "../src/graphics/MockGraphicsAPI.h"
+#include "../src/graphics/RenderCommandBuffer.h"
+#include "../src/graphics/FrustumCuller.h"
+#include "../src/tilemap/TilemapRenderer.h"
+#include "../src/tilemap/TileLayer.h"
+#include "../src/tilemap/Tileset.h"
+
+// Decoder for TextureResource (the tileset texture here is created in memory)
+#define STB_IMAGE_IMPLEMENTATION
+#include <stb_image.h>
+#include "test_check.h"
+
+using namespace RPGEngine;
+using namespace RPGEngine::Graphics;
+
+/**
+ * Tilemap renderer test
+ * Records a small map with solid tiles on MockGraphicsAPI and checks that
+ * tiles sample the tileset texture while collider outlines are drawn
+ * with the renderer's white texture in the collider color, and that only
+ * the decorative props in view are recorded.
+ */
+
+int main() {
+    std::cout << "=== Tilemap Renderer Test ===" << std::endl;
+    bool allPassed = true;
+
+    auto graphics = std::make_shared<MockGraphicsAPI>();
+    graphics->initialize(320, 240, "TilemapRendererTest", false);
+
+    auto tilesetTexture = std::make_shared<Resources::TextureResource>("test_tileset", "");
+    TextureHandle tilesetHandle = graphics->createTexture(64, 64, TextureFormat::RGBA, nullptr);
+    tilesetTexture->adoptHandle(tilesetHandle, 64, 64, 0x1908);
+
+    auto tileset = std::make_shared<Tilemap::Tileset>("test", 16, 16);
+    tileset->setTexture(tilesetTexture);
+
+    Tilemap::MapProperties properties;
+    properties.width = 4;
+    properties.height = 4;
+    properties.tileWidth = 16;
+    properties.tileHeight = 16;
+    auto map = std::make_shared<Tilemap::Tilemap>(properties);
+    map->addTileset(tileset);
+
+    // A solid wall along the top row, open floor below it
+    auto layer = std::make_shared<Tilemap::TileLayer>(4, 4);
+    for (int y = 0; y < 4; ++y) {
+        for (int x = 0; x < 4; ++x) {
+            layer->setTile(x, y, Tilemap::Tile(1, y == 0 ? Tilemap::TileFlags::Solid : Tilemap::TileFlags::None));
+        }
+    }
+    map->addLayer(layer);
+
+    auto renderer = std::make_shared<Tilemap::TilemapRenderer>(graphics);
+    allPassed &= check(renderer->initialize(), "renderer initialized");
+    renderer->setTilemap(map);
+    renderer->setColliderColor(0x00FF0080);
+
+    TextureHandle colliderTexture = renderer->getColliderTexture();
+    allPassed &= check(colliderTexture != INVALID_HANDLE && colliderTexture != tilesetHandle,
+                       "colliders have their own texture");
+
+    // Tiles
+    RenderCommandList tiles;
+    renderer->recordLayerRows(0, 0, 4, tiles);
+    bool tilesetOnly = tiles.getQuadCount() == 16;
+    for (const auto& command : tiles.getCommands()) {
+        if (command.type == RenderCommandType::DrawQuads) {
+            tilesetOnly &= command.texture == tilesetHandle;
+        }
+    }
+    allPassed &= check(tilesetOnly, "tiles drawn with the tileset texture");
+
+    // Collider outlines
+    RenderCommandList colliders;
+    renderer->recordColliders(0, colliders);
+    bool whiteOnly = colliders.getQuadCount() == 4 * 4 && !colliders.isEmpty();
+    for (const auto& command : colliders.getCommands()) {
+        if (command.type == RenderCommandType::DrawQuads) {
+            whiteOnly &= command.texture == colliderTexture;
+        }
+    }
+    allPassed &= check(whiteOnly, "collider outlines drawn with the white texture");
+
+    const std::vector<float>& vertices = colliders.getVertices();
+    bool colored = !vertices.empty();
+    for (size_t i = 0; i < vertices.size(); i += RenderCommandList::VERTEX_SIZE) {
+        colored &= vertices[i + 3] == 0.0f && vertices[i + 4] == 1.0f && vertices[i + 5] == 0.0f &&
+                   vertices[i + 6] == 128.0f / 255.0f;
+    }
+    allPassed &= check(colored, "collider outlines use the collider color");
+
+    // A full frame submits both
+    renderer->setRenderColliders(true);
+    renderer->update(1.0f / 60.0f);
+    const RenderQueueStats& stats = renderer->getRenderStats();
+    allPassed &= check(stats.quads == 16 + 16 && stats.textureBinds == 2, "frame binds the tileset, then the white texture");
+
+    // Decorative props: a 200x200 grid of them, far larger than the view
+    auto propTexture = std::make_shared<Texture>(graphics);
+    const uint8_t white[4] = { 255, 255, 255, 255 };
+    propTexture->createFromData(1, 1, TextureFormat::RGBA, white);
+    std::vector<Sprite> props;
+    for (int y = 0; y < 200; ++y) {
+        for (int x = 0; x < 200; ++x) {
+            Sprite prop(propTexture);
+            prop.setTextureRect(Rect(0.0f, 0.0f, 16.0f, 16.0f));
+            prop.setPosition(x * 40.0f, y * 40.0f);
+            prop.setOrigin(0.5f, 0.5f);
+            props.push_back(prop);
+        }
+    }
+    renderer->setDecorations(props);
+
+    auto camera = std::make_shared<Camera>();
+    camera->setViewportSize(320, 240);
+    camera->setPosition(2000.0f, 3000.0f);
+    camera->update(0.0f);
+    renderer->setCamera(camera);
+
+    Rect view = camera->getBounds();
+    size_t inView = 0;
+    for (const auto& prop : props) {
+        Rect bounds = FrustumCuller::getSpriteBounds(prop);
+        if (bounds.x < view.x + view.width && bounds.x + bounds.width > view.x &&
+            bounds.y < view.y + view.height && bounds.y + bounds.height > view.y) {
+            ++inView;
+        }
+    }
+
+    RenderCommandList decorations;
+    renderer->recordDecorations(decorations);
+    allPassed &= check(inView > 0 && decorations.getQuadCount() == inView, "only props in view recorded");
+
+    renderer->setUseFrustumCulling(false);
+    decorations.reset(0);
+    renderer->recordDecorations(decorations);
+    allPassed &= check(decorations.getQuadCount() == props.size(), "every prop recorded without culling");
+    renderer->setUseFrustumCulling(true);
+
+    std::vector<RenderRecordJob> jobs;
+    renderer->appendRecordJobs(jobs, 0);
+    allPassed &= check(!jobs.empty() && jobs.back().first == (static_cast<uint64_t>(map->getLayerCount()) << 32),
+                       "props recorded after the last layer");
+
+    renderer->shutdown();
+    graphics->shutdown();
+
+    std::cout << "\n=== Tilemap Renderer Test " << (allPassed ? "Complete" : "FAILED") << " ===" << std::endl;
+    return allPassed ? 0 : 1;
+}
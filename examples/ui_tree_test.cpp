@@ -0,0 +1,217 @@
+#include <iostream>
+#include <chrono>
+#include <string>
+#include <vector>
+#include "../src/graphics/MockGraphicsAPI.h"
+#include "../src/graphics/ShaderManager.h"
+#include "../src/graphics/SpriteRenderer.h"
+#include "../src/ui/UIRenderer.h"
+#include "../src/ui/UITree.h"
+#include "test_check.h"
+
+using namespace RPGEngine;
+using namespace RPGEngine::Graphics;
+using namespace RPGEngine::UI;
+
+/**
+ * Retained UI tree test
+ * Builds an inventory screen with hundreds of slots, checks that unchanged
+ * frames skip layout and geometry generation, that a change only rebuilds
+ * the panel holding it, and that input reaches the right widgets. Then
+ * compares frame cost against drawing the same screen in immediate mode.
+ */
+
+int main() {
+    std::cout << "=== UI Tree Test ===" << std::endl;
+
+    auto graphicsAPI = std::make_shared<MockGraphicsAPI>();
+    graphicsAPI->initialize(1280, 720, "UITreeTest", false);
+    auto shaders = std::make_shared<ShaderManager>(graphicsAPI);
+    shaders->initialize();
+    auto spriteRenderer = std::make_shared<SpriteRenderer>(graphicsAPI, shaders);
+    spriteRenderer->initialize();
+
+    auto ui = std::make_shared<UIRenderer>(spriteRenderer, nullptr);
+    ui->initialize();
+    bool allPassed = true;
+
+    // Test 1: build an inventory of 20 bags x 24 slots
+    std::cout << "\n1. Building the inventory..." << std::endl;
+
+    const int bagCount = 20;
+    const int slotsPerBag = 24;
+    auto tree = ui->createTree();
+
+    auto inventory = std::make_shared<UIWidget>(UIElementType::Panel, "inventory");
+    inventory->setBounds(UIRect(20.0f, 20.0f, 1240.0f, 680.0f));
+    inventory->setChildLayout(UIChildLayout::Grid, 8.0f, 10.0f, 5);
+    tree->getRoot()->addChild(inventory);
+
+    int clicks = 0;
+    for (int bag = 0; bag < bagCount; ++bag) {
+        auto bagPanel = std::make_shared<UIWidget>(UIElementType::Panel, "bag" + std::to_string(bag));
+        bagPanel->setChildLayout(UIChildLayout::Grid, 2.0f, 4.0f, 6);
+        inventory->addChild(bagPanel);
+
+        for (int slot = 0; slot < slotsPerBag; ++slot) {
+            auto slotButton = std::make_shared<UIWidget>(UIElementType::Button,
+                                                         "slot" + std::to_string(bag) + "_" + std::to_string(slot));
+            slotButton->setText(std::to_string(slot % 10));
+            slotButton->setFontSize(8.0f);
+            slotButton->onClick = [&clicks]() { clicks++; };
+            bagPanel->addChild(slotButton);
+        }
+    }
+
+    auto renderFrame = [&]() {
+        graphicsAPI->beginFrame();
+        spriteRenderer->begin();
+        ui->beginFrame();
+        tree->render();
+        ui->endFrame();
+        spriteRenderer->end();
+        graphicsAPI->endFrame();
+    };
+
+    renderFrame();
+    const UITreeStats first = tree->getStats();
+    allPassed &= check(first.geometryRebuilds == static_cast<uint64_t>(bagCount + 2), "first frame builds every cache");
+    allPassed &= check(first.widgetsLaidOut == static_cast<uint64_t>(bagCount + 1), "first frame lays out every container");
+    allPassed &= check(tree->findWidget("slot3_5") != nullptr &&
+                       tree->findWidget("slot3_5")->getBounds().width > 0.0f, "slots receive bounds from the grid");
+
+    // Test 2: unchanged frames
+    std::cout << "\n2. Rendering unchanged frames..." << std::endl;
+
+    tree->resetStats();
+    renderFrame();
+    allPassed &= check(tree->getStats().geometryRebuilds == 0 && tree->getStats().widgetsLaidOut == 0,
+                       "clean frame does no layout or geometry work");
+    allPassed &= check(tree->getStats().quadsSubmitted == first.quadsBuilt, "cached quads are resubmitted");
+    const uint64_t fullBatches = (first.quadsBuilt + 1999) / 2000;
+    allPassed &= check(graphicsAPI->getLastFrameStats().drawCalls == fullBatches, "only full batches split the draw");
+
+    // Test 3: targeted invalidation
+    std::cout << "\n3. Changing single widgets..." << std::endl;
+
+    tree->resetStats();
+    tree->findWidget("slot7_3")->setText("X");
+    renderFrame();
+    allPassed &= check(tree->getStats().geometryRebuilds == 1 && tree->getStats().widgetsLaidOut == 0,
+                       "text change rebuilds only its bag");
+
+    tree->resetStats();
+    tree->findWidget("slot7_3")->setText("X");
+    renderFrame();
+    allPassed &= check(tree->getStats().geometryRebuilds == 0, "setting the same value is free");
+
+    tree->resetStats();
+    tree->findWidget("bag4")->setVisible(false);
+    renderFrame();
+    allPassed &= check(tree->getStats().geometryRebuilds == 0 && tree->getStats().cacheReuses == static_cast<uint64_t>(bagCount + 1),
+                       "hiding a panel skips its cache without rebuilds");
+    tree->findWidget("bag4")->setVisible(true);
+
+    tree->resetStats();
+    inventory->setBounds(UIRect(20.0f, 20.0f, 1000.0f, 680.0f));
+    renderFrame();
+    allPassed &= check(tree->getStats().widgetsLaidOut == static_cast<uint64_t>(bagCount + 1),
+                       "resizing the inventory relays out its subtree");
+
+    // Test 4: input
+    std::cout << "\n4. Routing input..." << std::endl;
+
+    const UIRect slotBounds = tree->findWidget("slot2_0")->getBounds();
+    const float slotX = slotBounds.x + slotBounds.width * 0.5f;
+    const float slotY = slotBounds.y + slotBounds.height * 0.5f;
+
+    tree->updateInput(0.0f, 0.0f, false);
+    tree->resetStats();
+    tree->updateInput(slotX, slotY, false);
+    renderFrame();
+    allPassed &= check(tree->findWidget("slot2_0")->getState() == UIElementState::Hovered &&
+                       tree->getStats().geometryRebuilds == 1, "hover rebuilds only the hovered slot's bag");
+
+    tree->updateInput(slotX, slotY, true);
+    tree->updateInput(slotX, slotY, true);
+    tree->updateInput(slotX, slotY, false);
+    allPassed &= check(clicks == 1, "button clicks once per press");
+
+    auto settings = std::make_shared<UIWidget>(UIElementType::Panel, "settings");
+    settings->setBounds(UIRect(1040.0f, 20.0f, 200.0f, 80.0f));
+    settings->setChildLayout(UIChildLayout::Vertical, 4.0f, 6.0f);
+    auto checkbox = std::make_shared<UIWidget>(UIElementType::Checkbox, "vsync");
+    checkbox->setText("VSync");
+    auto slider = std::make_shared<UIWidget>(UIElementType::Slider, "volume");
+    slider->setRange(0.0f, 100.0f);
+    bool toggled = false;
+    float volume = 0.0f;
+    checkbox->onToggled = [&toggled](bool checked) { toggled = checked; };
+    slider->onChanged = [&volume](float value) { volume = value; };
+    settings->addChild(checkbox);
+    settings->addChild(slider);
+    tree->getRoot()->addChild(settings);
+    renderFrame();
+
+    const UIRect boxBounds = checkbox->getBounds();
+    tree->updateInput(boxBounds.x + 4.0f, boxBounds.y + boxBounds.height * 0.5f, true);
+    tree->updateInput(boxBounds.x + 4.0f, boxBounds.y + boxBounds.height * 0.5f, false);
+    allPassed &= check(checkbox->isChecked() && toggled, "checkbox toggles on press");
+
+    const UIRect sliderBounds = slider->getBounds();
+    tree->updateInput(sliderBounds.x + 1.0f, sliderBounds.y + sliderBounds.height * 0.5f, true);
+    tree->updateInput(sliderBounds.x + sliderBounds.width * 0.75f, sliderBounds.y + sliderBounds.height * 0.5f, true);
+    tree->updateInput(sliderBounds.x + sliderBounds.width * 0.75f, sliderBounds.y + sliderBounds.height * 0.5f, false);
+    allPassed &= check(slider->getValue() > 74.0f && slider->getValue() < 76.0f && volume == slider->getValue(),
+                       "slider follows the drag");
+
+    tree->findWidget("bag2")->removeChild(
+        tree->findWidget("bag2")->getChildren().front());
+    tree->updateInput(slotX + 1.0f, slotY, false);
+    renderFrame();
+    allPassed &= check(tree->findWidget("slot2_0") == nullptr, "removed widgets leave the tree");
+
+    // Test 5: benchmark against immediate mode
+    const int frames = 200;
+    const size_t slotCount = static_cast<size_t>(bagCount * slotsPerBag);
+    std::cout << "\n5. Benchmarking " << slotCount << " slots x " << frames << " frames..." << std::endl;
+
+    std::vector<UIRect> bagBounds;
+    std::vector<UIRect> slotRects;
+    for (const auto& bag : inventory->getChildren()) {
+        bagBounds.push_back(bag->getBounds());
+        for (const auto& slot : bag->getChildren()) {
+            slotRects.push_back(slot->getBounds());
+        }
+    }
+
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int frame = 0; frame < frames; ++frame) {
+        spriteRenderer->begin();
+        ui->beginFrame();
+        ui->drawPanel(inventory->getBounds());
+        for (const auto& bounds : bagBounds) {
+            ui->drawPanel(bounds);
+        }
+        for (size_t i = 0; i < slotRects.size(); ++i) {
+            ui->drawButton(slotRects[i], std::to_string(i % 10));
+        }
+        ui->endFrame();
+        spriteRenderer->end();
+    }
+    auto end = std::chrono::high_resolution_clock::now();
+    auto immediateTime = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+
+    start = std::chrono::high_resolution_clock::now();
+    for (int frame = 0; frame < frames; ++frame) {
+        renderFrame();
+    }
+    end = std::chrono::high_resolution_clock::now();
+    auto retainedTime = std::chrono::duration_cast<std::chrono::microseconds>(end - start);
+
+    std::cout << "Immediate mode: " << immediateTime.count() << " microseconds" << std::endl;
+    std::cout << "Retained tree: " << retainedTime.count() << " microseconds" << std::endl;
+
+    std::cout << "\n=== UI Tree Test " << (allPassed ? "Complete" : "FAILED") << " ===" << std::endl;
+    return allPassed ? 0 : 1;
+}
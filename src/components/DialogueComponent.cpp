@@ -3,13 +3,48 @@
 #include <sstream>
 #include <iostream>
 #include <algorithm>
+#include <atomic>
 #include <regex>
 
 namespace RPGEngine {
 namespace Components {
 
+void DialogueTree::compile() {
+    program.clear();
+    for (auto& pair : nodes) {
+        compileNode(pair.second);
+    }
+}
+
+const DialogueNode* DialogueTree::loadNode(const std::string& nodeId) const {
+    DialogueNode node;
+    if (!nodeSource->loadNode(nodeId, node)) {
+        return nullptr;
+    }
+    
+    compileNode(node);
+    DialogueNode& stored = nodes[nodeId];
+    stored = std::move(node);
+    return &stored;
+}
+
+void DialogueTree::compileNode(DialogueNode& node) const {
+    node.compiledConditions = program.compileConditions(node.conditions);
+    for (auto& action : node.actions) {
+        action.op = DialogueProgram::compileAction(action.type);
+    }
+    
+    for (auto& choice : node.choices) {
+        choice.compiledConditions = program.compileConditions(choice.conditions);
+        for (auto& action : choice.actions) {
+            action.op = DialogueProgram::compileAction(action.type);
+        }
+    }
+}
+
 DialogueComponent::DialogueComponent(EntityId entityId)
     : Component<DialogueComponent>(entityId)
+    , m_valueVersion(nextValueVersion())
 {
 }
 
@@ -47,13 +82,29 @@ bool DialogueComponent::loadDialogueTreeFromFile(const std::string& filePath) {
 }
 
 void DialogueComponent::addDialogueTree(const DialogueTree& tree) {
-    m_dialogueTrees[tree.id] = tree;
+    DialogueTree& stored = m_dialogueTrees[tree.id];
+    stored = tree;
+    stored.compile();
     std::cout << "Added dialogue tree: " << tree.name << " with " << tree.nodes.size() << " nodes" << std::endl;
 }
 
+void DialogueComponent::addSharedDialogueTree(std::shared_ptr<const DialogueTree> tree) {
+    if (!tree) {
+        return;
+    }
+    
+    m_dialogueTrees.erase(tree->id);
+    m_sharedTrees[tree->id] = std::move(tree);
+}
+
 const DialogueTree* DialogueComponent::getDialogueTree(const std::string& treeId) const {
     auto it = m_dialogueTrees.find(treeId);
-    return (it != m_dialogueTrees.end()) ? &it->second : nullptr;
+    if (it != m_dialogueTrees.end()) {
+        return &it->second;
+    }
+    
+    auto shared = m_sharedTrees.find(treeId);
+    return (shared != m_sharedTrees.end()) ? shared->second.get() : nullptr;
 }
 
 bool DialogueComponent::removeDialogueTree(const std::string& treeId) {
@@ -63,11 +114,15 @@ bool DialogueComponent::removeDialogueTree(const std::string& treeId) {
         m_dialogueTrees.erase(it);
         return true;
     }
-    return false;
+    return m_sharedTrees.erase(treeId) > 0;
 }
 
 bool DialogueComponent::startDialogue(const std::string& treeId, const std::string& startNodeId) {
     const DialogueTree* tree = getDialogueTree(treeId);
+    if (!tree && m_dialogueTreeSource) {
+        addSharedDialogueTree(m_dialogueTreeSource(treeId));
+        tree = getDialogueTree(treeId);
+    }
     if (!tree) {
         std::cerr << "Dialogue tree not found: " << treeId << std::endl;
         return false;
@@ -150,7 +205,7 @@ bool DialogueComponent::advanceDialogue(const std::string& choiceId) {
             const DialogueChoice& choice = *it;
             
             // Check if choice is available
-            if (!choice.enabled || !choice.visible || !evaluateConditions(choice.conditions)) {
+            if (!choice.enabled || !choice.visible || !evaluateConditions(tree->program, choice.compiledConditions)) {
                 std::cerr << "Choice not available: " << choiceId << std::endl;
                 return false;
             }
@@ -167,7 +222,7 @@ bool DialogueComponent::advanceDialogue(const std::string& choiceId) {
         
         case DialogueNodeType::Condition: {
             // Evaluate conditions and choose next node
-            if (evaluateConditions(currentNode->conditions)) {
+            if (evaluateConditions(tree->program, currentNode->compiledConditions)) {
                 nextNodeId = currentNode->nextNodeId;
             } else {
                 // Look for alternative path or end dialogue
@@ -203,7 +258,7 @@ bool DialogueComponent::advanceDialogue(const std::string& choiceId) {
     const DialogueNode* nextNode = tree->getNode(nextNodeId);
     if (nextNode) {
         // Check node conditions
-        if (!evaluateConditions(nextNode->conditions)) {
+        if (!evaluateConditions(tree->program, nextNode->compiledConditions)) {
             // Skip this node and try to advance again
             return advanceDialogue();
         }
@@ -234,51 +289,59 @@ const DialogueTree* DialogueComponent::getCurrentTree() const {
     return getDialogueTree(m_state.currentTreeId);
 }
 
+void DialogueComponent::setDialogueState(const DialogueState& state) {
+    m_state = state;
+    rebuildValueCache();
+}
+
 bool DialogueComponent::evaluateCondition(const DialogueCondition& condition) const {
-    bool result = false;
-    
-    if (condition.type == "flag") {
-        bool flagValue = getFlag(condition.target, false);
-        
-        if (condition.operation == "==" || condition.operation == "equals") {
-            result = flagValue == (condition.value == "true");
-        } else if (condition.operation == "!=" || condition.operation == "not_equals") {
-            result = flagValue != (condition.value == "true");
+    std::string key = condition.type + '\n' + condition.target + '\n' + condition.operation + '\n' +
+                      condition.value + (condition.negate ? "\n!" : "\n");
+    
+    auto it = m_conditionLists.find(key);
+    if (it == m_conditionLists.end()) {
+        if (m_conditionLists.size() >= MAX_CACHED_CONDITIONS) {
+            m_conditionLists.clear();
+            m_conditionProgram.clear();
         }
-    } else if (condition.type == "variable") {
-        std::string varValue = getVariable(condition.target, "");
-        
-        if (condition.operation == "==" || condition.operation == "equals") {
-            result = varValue == condition.value;
-        } else if (condition.operation == "!=" || condition.operation == "not_equals") {
-            result = varValue != condition.value;
-        } else if (condition.operation == "contains") {
-            result = varValue.find(condition.value) != std::string::npos;
-        }
-    } else if (condition.type == "stat") {
-        // TODO: Integrate with StatsComponent
-        // For now, just return true
-        result = true;
-    } else if (condition.type == "item") {
-        // TODO: Integrate with InventoryComponent
-        // For now, just return true
-        result = true;
-    } else if (condition.type == "quest_active" || condition.type == "quest_completed" || 
-               condition.type == "objective_completed" || condition.type == "quest_variable") {
-        // Quest-related conditions - delegate to external evaluator
-        if (m_externalConditionEvaluator) {
-            result = m_externalConditionEvaluator(condition);
-        } else {
-            std::cerr << "No external condition evaluator set for quest condition: " << condition.type << std::endl;
+        it = m_conditionLists.emplace(std::move(key), m_conditionProgram.compileConditions({condition})).first;
+    }
+    
+    return evaluateConditions(m_conditionProgram, it->second);
+}
+
+bool DialogueComponent::evaluateConditions(const DialogueProgram& program, int32_t list) const {
+    if (list == DialogueProgram::NO_CONDITIONS) {
+        return true;
+    }
+    
+    const DialogueProgram::ConditionList& conditions = program.getList(list);
+    
+    // Quest state is only cached when there is a version to check it against;
+    // stats and items have none
+    bool cacheable = !conditions.usesUnversioned && (!conditions.usesExternal || m_externalConditionVersion);
+    uint64_t externalVersion = (conditions.usesExternal && m_externalConditionVersion) ? m_externalConditionVersion() : 0;
+    
+    DialogueProgram::CachedResult& cached = program.getCachedResult(list);
+    if (cacheable && cached.valid && cached.version == m_valueVersion && cached.externalVersion == externalVersion) {
+        return cached.result;
+    }
+    
+    bool result = true;
+    for (uint32_t i = 0; i < conditions.count; ++i) {
+        if (!evaluateInstruction(program.getInstruction(conditions.first + i), program)) {
             result = false;
+            break;
         }
-    } else {
-        // Unknown condition type
-        std::cerr << "Unknown condition type: " << condition.type << std::endl;
-        result = false;
     }
     
-    return condition.negate ? !result : result;
+    if (cacheable) {
+        cached.version = m_valueVersion;
+        cached.externalVersion = externalVersion;
+        cached.valid = true;
+        cached.result = result;
+    }
+    return result;
 }
 
 bool DialogueComponent::executeAction(const DialogueAction& action) {
@@ -286,42 +349,51 @@ bool DialogueComponent::executeAction(const DialogueAction& action) {
     
     bool success = false;
     
-    if (action.type == "set_flag") {
-        setFlag(action.target, action.value == "true");
-        success = true;
-    } else if (action.type == "set_variable") {
-        setVariable(action.target, action.value);
-        success = true;
-    } else if (action.type == "give_item") {
-        // TODO: Integrate with InventoryComponent
-        std::cout << "Would give item: " << action.target << " x" << action.value << std::endl;
-        success = true;
-    } else if (action.type == "remove_item") {
-        // TODO: Integrate with InventoryComponent
-        std::cout << "Would remove item: " << action.target << " x" << action.value << std::endl;
-        success = true;
-    } else if (action.type == "modify_stat") {
-        // TODO: Integrate with StatsComponent
-        std::cout << "Would modify stat: " << action.target << " by " << action.value << std::endl;
-        success = true;
-    } else if (action.type == "play_sound") {
-        // TODO: Integrate with AudioManager
-        std::cout << "Would play sound: " << action.target << std::endl;
-        success = true;
-    } else if (action.type == "start_quest" || action.type == "complete_quest" || 
-               action.type == "update_objective" || action.type == "set_quest_variable" ||
-               action.type == "track_npc_interaction" || action.type == "track_location_visit" ||
-               action.type == "track_custom_objective") {
-        // Quest-related actions - delegate to external executor
-        if (m_externalActionExecutor) {
-            success = m_externalActionExecutor(action);
-        } else {
-            std::cerr << "No external action executor set for quest action: " << action.type << std::endl;
+    // Actions of added trees are resolved at compile time
+    DialogueActionOp op = (action.op != DialogueActionOp::Unresolved) ? action.op : DialogueProgram::compileAction(action.type);
+    
+    switch (op) {
+        case DialogueActionOp::SetFlag:
+            setFlag(action.target, action.value == "true");
+            success = true;
+            break;
+        case DialogueActionOp::SetVariable:
+            setVariable(action.target, action.value);
+            success = true;
+            break;
+        case DialogueActionOp::GiveItem:
+            // TODO: Integrate with InventoryComponent
+            std::cout << "Would give item: " << action.target << " x" << action.value << std::endl;
+            success = true;
+            break;
+        case DialogueActionOp::RemoveItem:
+            // TODO: Integrate with InventoryComponent
+            std::cout << "Would remove item: " << action.target << " x" << action.value << std::endl;
+            success = true;
+            break;
+        case DialogueActionOp::ModifyStat:
+            // TODO: Integrate with StatsComponent
+            std::cout << "Would modify stat: " << action.target << " by " << action.value << std::endl;
+            success = true;
+            break;
+        case DialogueActionOp::PlaySound:
+            // TODO: Integrate with AudioManager
+            std::cout << "Would play sound: " << action.target << std::endl;
+            success = true;
+            break;
+        case DialogueActionOp::External:
+            // Quest-related actions - delegate to external executor
+            if (m_externalActionExecutor) {
+                success = m_externalActionExecutor(action);
+            } else {
+                std::cerr << "No external action executor set for quest action: " << action.type << std::endl;
+                success = false;
+            }
+            break;
+        default:
+            std::cerr << "Unknown action type: " << action.type << std::endl;
             success = false;
-        }
-    } else {
-        std::cerr << "Unknown action type: " << action.type << std::endl;
-        success = false;
+            break;
     }
     
     triggerActionExecuted(action);
@@ -329,20 +401,49 @@ bool DialogueComponent::executeAction(const DialogueAction& action) {
 }
 
 std::vector<DialogueChoice> DialogueComponent::getAvailableChoices() const {
-    const DialogueNode* currentNode = getCurrentNode();
-    if (!currentNode || currentNode->type != DialogueNodeType::Choice) {
-        return {};
-    }
+    std::vector<const DialogueChoice*> choices;
+    getAvailableChoices(choices);
     
     std::vector<DialogueChoice> availableChoices;
+    availableChoices.reserve(choices.size());
+    for (const DialogueChoice* choice : choices) {
+        availableChoices.push_back(*choice);
+    }
+    
+    return availableChoices;
+}
+
+void DialogueComponent::getAvailableChoices(std::vector<const DialogueChoice*>& outChoices) const {
+    outChoices.clear();
+    
+    const DialogueTree* tree = getCurrentTree();
+    const DialogueNode* currentNode = tree ? tree->getNode(m_state.currentNodeId) : nullptr;
+    if (!currentNode || currentNode->type != DialogueNodeType::Choice) {
+        return;
+    }
     
     for (const auto& choice : currentNode->choices) {
-        if (choice.visible && choice.enabled && evaluateConditions(choice.conditions)) {
-            availableChoices.push_back(choice);
+        if (choice.visible && choice.enabled && evaluateConditions(tree->program, choice.compiledConditions)) {
+            outChoices.push_back(&choice);
         }
     }
-    
-    return availableChoices;
+}
+
+void DialogueComponent::setFlag(const std::string& flagName, bool value) {
+    m_state.setFlag(flagName, value);
+    m_flagValues[Utils::StringId::intern(flagName)] = value;
+    m_valueVersion = nextValueVersion();
+}
+
+uint64_t DialogueComponent::nextValueVersion() {
+    static std::atomic<uint64_t> s_nextVersion(1);
+    return s_nextVersion.fetch_add(1);
+}
+
+void DialogueComponent::setVariable(const std::string& varName, const std::string& value) {
+    m_state.setVariable(varName, value);
+    m_variableValues[Utils::StringId::intern(varName)] = DialogueValue(value);
+    m_valueVersion = nextValueVersion();
 }
 
 void DialogueComponent::addToHistory(const std::string& text) {
@@ -471,6 +572,7 @@ bool DialogueComponent::deserialize(const std::string& data) {
             }
         }
         
+        rebuildValueCache();
         return true;
     } catch (const std::exception& e) {
         std::cerr << "Failed to deserialize DialogueComponent: " << e.what() << std::endl;
@@ -560,13 +662,64 @@ DialogueAction DialogueComponent::parseJSONAction(const std::string& actionJson)
     return DialogueAction();
 }
 
-bool DialogueComponent::evaluateConditions(const std::vector<DialogueCondition>& conditions) const {
-    for (const auto& condition : conditions) {
-        if (!evaluateCondition(condition)) {
-            return false;
+bool DialogueComponent::evaluateInstruction(const DialogueInstruction& instruction, const DialogueProgram& program) const {
+    bool result = false;
+    
+    switch (instruction.opcode) {
+        case DialogueOpcode::Constant:
+            result = instruction.value != 0;
+            break;
+            
+        case DialogueOpcode::Flag: {
+            auto it = m_flagValues.find(instruction.operand);
+            bool flagValue = (it != m_flagValues.end()) ? it->second : false;
+            bool equal = flagValue == (instruction.value != 0);
+            result = (instruction.compare == DialogueCompare::Equal) ? equal : !equal;
+            break;
+        }
+        
+        case DialogueOpcode::Variable: {
+            static const DialogueValue emptyValue;
+            auto it = m_variableValues.find(instruction.operand);
+            const DialogueValue& varValue = (it != m_variableValues.end()) ? it->second : emptyValue;
+            result = DialogueValue::compare(varValue, instruction.compare, program.getConstant(instruction.value));
+            break;
         }
+        
+        case DialogueOpcode::QuestActive:
+        case DialogueOpcode::QuestCompleted:
+        case DialogueOpcode::ObjectiveCompleted:
+        case DialogueOpcode::QuestVariable:
+        case DialogueOpcode::Stat:
+        case DialogueOpcode::Item:
+            // Quest, stat and item conditions - delegate to external evaluator
+            if (m_compiledConditionEvaluator) {
+                result = m_compiledConditionEvaluator(instruction, program);
+            } else if (m_externalConditionEvaluator) {
+                result = m_externalConditionEvaluator(program.getSource(instruction.source));
+            } else {
+                std::cerr << "No external condition evaluator set for condition: "
+                          << program.getSource(instruction.source).type << std::endl;
+                result = false;
+            }
+            break;
     }
-    return true;
+    
+    return instruction.negate ? !result : result;
+}
+
+void DialogueComponent::rebuildValueCache() {
+    m_flagValues.clear();
+    for (const auto& pair : m_state.flags) {
+        m_flagValues[Utils::StringId::intern(pair.first)] = pair.second;
+    }
+    
+    m_variableValues.clear();
+    for (const auto& pair : m_state.variables) {
+        m_variableValues[Utils::StringId::intern(pair.first)] = DialogueValue(pair.second);
+    }
+    
+    m_valueVersion = nextValueVersion();
 }
 
 bool DialogueComponent::executeActions(const std::vector<DialogueAction>& actions) {
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Component.h"
+#include "DialogueProgram.h"
 #include <string>
 #include <vector>
 #include <unordered_map>
@@ -21,35 +22,6 @@ enum class DialogueNodeType {
     End             // End of dialogue
 };
 
-/**
- * Dialogue condition structure
- */
-struct DialogueCondition {
-    std::string type;           // Condition type (flag, stat, item, etc.)
-    std::string target;         // Target to check (flag name, stat name, etc.)
-    std::string operation;      // Operation (==, !=, >, <, >=, <=)
-    std::string value;          // Value to compare against
-    bool negate;                // Whether to negate the result
-    
-    DialogueCondition(const std::string& condType = "", const std::string& condTarget = "",
-                     const std::string& op = "==", const std::string& val = "", bool neg = false)
-        : type(condType), target(condTarget), operation(op), value(val), negate(neg) {}
-};
-
-/**
- * Dialogue action structure
- */
-struct DialogueAction {
-    std::string type;           // Action type (set_flag, give_item, etc.)
-    std::string target;         // Action target
-    std::string value;          // Action value
-    std::unordered_map<std::string, std::string> parameters; // Additional parameters
-    
-    DialogueAction(const std::string& actionType = "", const std::string& actionTarget = "",
-                  const std::string& actionValue = "")
-        : type(actionType), target(actionTarget), value(actionValue) {}
-};
-
 /**
  * Dialogue choice structure
  */
@@ -61,10 +33,12 @@ struct DialogueChoice {
     std::vector<DialogueAction> actions;    // Actions to execute when chosen
     bool enabled;                           // Whether choice is currently enabled
     bool visible;                           // Whether choice is visible
+    int32_t compiledConditions;             // Compiled condition list, set when the tree is added
     
     DialogueChoice(const std::string& choiceId = "", const std::string& choiceText = "",
                   const std::string& nextNode = "")
-        : id(choiceId), text(choiceText), nextNodeId(nextNode), enabled(true), visible(true) {}
+        : id(choiceId), text(choiceText), nextNodeId(nextNode), enabled(true), visible(true),
+          compiledConditions(DialogueProgram::NO_CONDITIONS) {}
 };
 
 /**
@@ -80,21 +54,58 @@ struct DialogueNode {
     std::vector<DialogueCondition> conditions; // Conditions for node execution
     std::vector<DialogueAction> actions;    // Actions to execute
     std::unordered_map<std::string, std::string> metadata; // Additional metadata
+    int32_t compiledConditions;             // Compiled condition list, set when the tree is added
     
     DialogueNode(const std::string& nodeId = "", DialogueNodeType nodeType = DialogueNodeType::Text)
-        : id(nodeId), type(nodeType) {}
+        : id(nodeId), type(nodeType), compiledConditions(DialogueProgram::NO_CONDITIONS) {}
+};
+
+/**
+ * Source of dialogue nodes decoded on demand
+ * Lets a tree, e.g. one from a ContentDatabase, start without nodes and
+ * decode each node the first time it is asked for.
+ */
+class DialogueNodeSource {
+public:
+    virtual ~DialogueNodeSource() = default;
+    
+    /**
+     * Decode a node
+     * @param nodeId Node ID
+     * @param outNode Receives the node
+     * @return true if the source has the node
+     */
+    virtual bool loadNode(const std::string& nodeId, DialogueNode& outNode) const = 0;
+    
+    /**
+     * Check if the source has a node, without decoding it
+     * @param nodeId Node ID
+     * @return true if the source has the node
+     */
+    virtual bool hasNode(const std::string& nodeId) const = 0;
+    
+    /**
+     * Get the number of nodes in the source
+     * @return Node count
+     */
+    virtual size_t getNodeCount() const = 0;
 };
 
 /**
  * Dialogue tree structure
+ * Trees with a node source fill nodes lazily, so nodes only holds the nodes
+ * decoded so far. Lazy decoding is not thread safe; dialogue runs on the
+ * main thread.
  */
 struct DialogueTree {
     std::string id;                         // Tree ID
     std::string name;                       // Tree name
     std::string description;                // Tree description
     std::string startNodeId;                // Starting node ID
-    std::unordered_map<std::string, DialogueNode> nodes; // All nodes in the tree
+    mutable std::unordered_map<std::string, DialogueNode> nodes; // All nodes in the tree (decoded nodes, with a source)
     std::unordered_map<std::string, std::string> variables; // Tree-specific variables
+    mutable DialogueProgram program;        // Compiled conditions, built when the tree is added or a node decoded
+    std::shared_ptr<const DialogueNodeSource> nodeSource; // Decodes nodes missing from nodes
     
     DialogueTree(const std::string& treeId = "", const std::string& treeName = "")
         : id(treeId), name(treeName) {}
@@ -106,7 +117,10 @@ struct DialogueTree {
      */
     const DialogueNode* getNode(const std::string& nodeId) const {
         auto it = nodes.find(nodeId);
-        return (it != nodes.end()) ? &it->second : nullptr;
+        if (it != nodes.end()) {
+            return &it->second;
+        }
+        return nodeSource ? loadNode(nodeId) : nullptr;
     }
     
     /**
@@ -123,8 +137,35 @@ struct DialogueTree {
      * @return true if node exists
      */
     bool hasNode(const std::string& nodeId) const {
-        return nodes.find(nodeId) != nodes.end();
+        return nodes.find(nodeId) != nodes.end() || (nodeSource && nodeSource->hasNode(nodeId));
+    }
+    
+    /**
+     * Get the number of nodes, decoded or not
+     * @return Node count
+     */
+    size_t getNodeCount() const {
+        return nodeSource ? nodeSource->getNodeCount() : nodes.size();
     }
+    
+    /**
+     * Compile the conditions and actions of all loaded nodes
+     */
+    void compile();
+    
+private:
+    /**
+     * Decode and compile a node from the node source
+     * @param nodeId Node ID
+     * @return Node pointer, or nullptr if the source doesn't have it
+     */
+    const DialogueNode* loadNode(const std::string& nodeId) const;
+    
+    /**
+     * Compile the conditions and actions of one node
+     * @param node Node to compile
+     */
+    void compileNode(DialogueNode& node) const;
 };
 
 /**
@@ -231,6 +272,23 @@ public:
      */
     void addDialogueTree(const DialogueTree& tree);
     
+    /**
+     * Reference a shared dialogue tree without copying it
+     * The tree is compiled by whoever built it, e.g. a ContentDatabase.
+     * @param tree Shared tree
+     */
+    void addSharedDialogueTree(std::shared_ptr<const DialogueTree> tree);
+    
+    /**
+     * Set dialogue tree source
+     * startDialogue asks the source for trees the component doesn't have yet,
+     * so components can reference trees by ID.
+     * @param source Function returning a shared tree, or nullptr if unknown
+     */
+    void setDialogueTreeSource(std::function<std::shared_ptr<const DialogueTree>(const std::string&)> source) {
+        m_dialogueTreeSource = source;
+    }
+    
     /**
      * Get dialogue tree
      * @param treeId Tree ID
@@ -247,6 +305,7 @@ public:
     
     /**
      * Get all dialogue trees
+     * Shared trees are not included.
      * @return Map of tree IDs to trees
      */
     const std::unordered_map<std::string, DialogueTree>& getDialogueTrees() const { return m_dialogueTrees; }
@@ -301,17 +360,28 @@ public:
      * Set dialogue state
      * @param state New dialogue state
      */
-    void setDialogueState(const DialogueState& state) { m_state = state; }
+    void setDialogueState(const DialogueState& state);
     
     // Condition and action evaluation
     
     /**
      * Evaluate condition
+     * Compiled on first use and cached like a node's condition list.
      * @param condition Condition to evaluate
      * @return true if condition is met
      */
     bool evaluateCondition(const DialogueCondition& condition) const;
     
+    /**
+     * Evaluate a compiled condition list
+     * The result is cached in the program until a flag or variable changes,
+     * or, for lists with quest conditions, the external condition version does.
+     * @param program Program the list was compiled into
+     * @param list List index
+     * @return true if all conditions are met
+     */
+    bool evaluateConditions(const DialogueProgram& program, int32_t list) const;
+    
     /**
      * Execute action
      * @param action Action to execute
@@ -325,6 +395,12 @@ public:
      */
     std::vector<DialogueChoice> getAvailableChoices() const;
     
+    /**
+     * Get available choices for current node without copying them
+     * @param outChoices Receives pointers to the available choices; cleared first
+     */
+    void getAvailableChoices(std::vector<const DialogueChoice*>& outChoices) const;
+    
     // Dialogue flags and variables
     
     /**
@@ -332,9 +408,7 @@ public:
      * @param flagName Flag name
      * @param value Flag value
      */
-    void setFlag(const std::string& flagName, bool value) {
-        m_state.setFlag(flagName, value);
-    }
+    void setFlag(const std::string& flagName, bool value);
     
     /**
      * Get dialogue flag
@@ -351,9 +425,7 @@ public:
      * @param varName Variable name
      * @param value Variable value
      */
-    void setVariable(const std::string& varName, const std::string& value) {
-        m_state.setVariable(varName, value);
-    }
+    void setVariable(const std::string& varName, const std::string& value);
     
     /**
      * Get dialogue variable
@@ -424,6 +496,28 @@ public:
      */
     void setExternalConditionEvaluator(std::function<bool(const DialogueCondition&)> evaluator) {
         m_externalConditionEvaluator = evaluator;
+        m_valueVersion = nextValueVersion();
+    }
+    
+    /**
+     * Set compiled condition evaluator
+     * Takes precedence over the external condition evaluator for quest, stat and item conditions.
+     * @param evaluator Function to evaluate compiled quest, stat and item conditions, without negation
+     */
+    void setCompiledConditionEvaluator(std::function<bool(const DialogueInstruction&, const DialogueProgram&)> evaluator) {
+        m_compiledConditionEvaluator = evaluator;
+        m_valueVersion = nextValueVersion();
+    }
+    
+    /**
+     * Set external condition version
+     * Results of condition lists with quest conditions are only cached while
+     * a version is set, and only until it changes.
+     * @param version Function returning a value that changes whenever external state does
+     */
+    void setExternalConditionVersion(std::function<uint64_t()> version) {
+        m_externalConditionVersion = version;
+        m_valueVersion = nextValueVersion();
     }
     
     /**
@@ -486,11 +580,25 @@ private:
     DialogueAction parseJSONAction(const std::string& actionJson) const;
     
     /**
-     * Evaluate conditions list
-     * @param conditions Conditions to evaluate
-     * @return true if all conditions are met
+     * Evaluate one compiled condition
+     * @param instruction Instruction
+     * @param program Program the instruction belongs to
+     * @return true if the condition is met
      */
-    bool evaluateConditions(const std::vector<DialogueCondition>& conditions) const;
+    bool evaluateInstruction(const DialogueInstruction& instruction, const DialogueProgram& program) const;
+    
+    /**
+     * Rebuild the interned flag and variable values from the dialogue state
+     */
+    void rebuildValueCache();
+    
+    /**
+     * Get a value version no other component has used
+     * Compiled results of shared trees are cached per tree, so versions
+     * must tell components apart.
+     * @return New version
+     */
+    static uint64_t nextValueVersion();
     
     /**
      * Execute actions list
@@ -531,8 +639,20 @@ private:
     
     // Dialogue data
     std::unordered_map<std::string, DialogueTree> m_dialogueTrees;
+    std::unordered_map<std::string, std::shared_ptr<const DialogueTree>> m_sharedTrees;
+    std::function<std::shared_ptr<const DialogueTree>(const std::string&)> m_dialogueTreeSource;
     DialogueState m_state;
     
+    // Interned copies of the state's flags and variables, for compiled conditions
+    std::unordered_map<Utils::StringId, bool> m_flagValues;
+    std::unordered_map<Utils::StringId, DialogueValue> m_variableValues;
+    uint64_t m_valueVersion;
+    
+    // Conditions evaluated one at a time, compiled on first use
+    static constexpr size_t MAX_CACHED_CONDITIONS = 256;
+    mutable DialogueProgram m_conditionProgram;
+    mutable std::unordered_map<std::string, int32_t> m_conditionLists;
+    
     // Callbacks
     std::function<void(const std::string&)> m_dialogueStartedCallback;
     std::function<void()> m_dialogueEndedCallback;
@@ -542,6 +662,8 @@ private:
     // External handlers
     std::function<bool(const DialogueCondition&)> m_externalConditionEvaluator;
     std::function<bool(const DialogueAction&)> m_externalActionExecutor;
+    std::function<bool(const DialogueInstruction&, const DialogueProgram&)> m_compiledConditionEvaluator;
+    std::function<uint64_t()> m_externalConditionVersion;
 };
 
 } // namespace Components
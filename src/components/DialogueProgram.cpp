@@ -0,0 +1,270 @@
+#include "DialogueComponent.h"
+#include "StatsComponent.h"
+#include <cstdlib>
+#include <iostream>
+
+namespace RPGEngine {
+namespace Components {
+
+namespace {
+
+bool parseNumber(const std::string& text, double& outNumber) {
+    if (text.empty()) {
+        return false;
+    }
+
+    char* end = nullptr;
+    outNumber = std::strtod(text.c_str(), &end);
+    return end == text.c_str() + text.size();
+}
+
+bool compareNumbers(double lhs, DialogueCompare compare, double rhs) {
+    switch (compare) {
+        case DialogueCompare::Equal: return lhs == rhs;
+        case DialogueCompare::NotEqual: return lhs != rhs;
+        case DialogueCompare::Less: return lhs < rhs;
+        case DialogueCompare::LessEqual: return lhs <= rhs;
+        case DialogueCompare::Greater: return lhs > rhs;
+        case DialogueCompare::GreaterEqual: return lhs >= rhs;
+        case DialogueCompare::Contains: return false;
+    }
+    return false;
+}
+
+bool parseCompare(const std::string& operation, DialogueCompare& outCompare) {
+    if (operation == "==" || operation == "equals") {
+        outCompare = DialogueCompare::Equal;
+    } else if (operation == "!=" || operation == "not_equals") {
+        outCompare = DialogueCompare::NotEqual;
+    } else if (operation == "<") {
+        outCompare = DialogueCompare::Less;
+    } else if (operation == "<=") {
+        outCompare = DialogueCompare::LessEqual;
+    } else if (operation == ">") {
+        outCompare = DialogueCompare::Greater;
+    } else if (operation == ">=") {
+        outCompare = DialogueCompare::GreaterEqual;
+    } else if (operation == "contains") {
+        outCompare = DialogueCompare::Contains;
+    } else {
+        return false;
+    }
+    return true;
+}
+
+} // namespace
+
+DialogueValue::DialogueValue(const std::string& value)
+    : text(value), textId(Utils::StringId::intern(value)), number(0.0), isNumber(parseNumber(value, number)) {
+}
+
+bool DialogueValue::compare(const DialogueValue& lhs, DialogueCompare compare, const DialogueValue& rhs) {
+    if (compare == DialogueCompare::Contains) {
+        return lhs.text.find(rhs.text) != std::string::npos;
+    }
+
+    if (lhs.isNumber && rhs.isNumber) {
+        return compareNumbers(lhs.number, compare, rhs.number);
+    }
+
+    switch (compare) {
+        case DialogueCompare::Equal: return lhs.textId == rhs.textId;
+        case DialogueCompare::NotEqual: return lhs.textId != rhs.textId;
+        default: return false;
+    }
+}
+
+bool DialogueValue::compare(const std::string& lhs, DialogueCompare compare, const DialogueValue& rhs) {
+    if (compare == DialogueCompare::Contains) {
+        return lhs.find(rhs.text) != std::string::npos;
+    }
+
+    double number = 0.0;
+    if (rhs.isNumber && parseNumber(lhs, number)) {
+        return compareNumbers(number, compare, rhs.number);
+    }
+
+    switch (compare) {
+        case DialogueCompare::Equal: return lhs == rhs.text;
+        case DialogueCompare::NotEqual: return lhs != rhs.text;
+        default: return false;
+    }
+}
+
+bool DialogueValue::compare(double lhs, DialogueCompare compare, const DialogueValue& rhs) {
+    return rhs.isNumber && compare != DialogueCompare::Contains && compareNumbers(lhs, compare, rhs.number);
+}
+
+int32_t DialogueProgram::compileConditions(const std::vector<DialogueCondition>& conditions) {
+    if (conditions.empty()) {
+        return NO_CONDITIONS;
+    }
+
+    ConditionList list;
+    list.first = static_cast<uint32_t>(m_instructions.size());
+    list.count = static_cast<uint32_t>(conditions.size());
+    list.usesExternal = false;
+    list.usesUnversioned = false;
+
+    for (const auto& condition : conditions) {
+        uint32_t source = static_cast<uint32_t>(m_sources.size());
+        m_sources.push_back(condition);
+
+        DialogueInstruction instruction = compileCondition(condition, source);
+        if (instruction.opcode != DialogueOpcode::Constant &&
+            instruction.opcode != DialogueOpcode::Flag &&
+            instruction.opcode != DialogueOpcode::Variable) {
+            list.usesExternal = true;
+        }
+        if (instruction.opcode == DialogueOpcode::Stat || instruction.opcode == DialogueOpcode::Item) {
+            list.usesUnversioned = true;
+        }
+        m_instructions.push_back(instruction);
+    }
+
+    m_lists.push_back(list);
+    m_cache.push_back(CachedResult{0, 0, false, false});
+    return static_cast<int32_t>(m_lists.size() - 1);
+}
+
+DialogueActionOp DialogueProgram::compileAction(const std::string& type) {
+    if (type == "set_flag") return DialogueActionOp::SetFlag;
+    if (type == "set_variable") return DialogueActionOp::SetVariable;
+    if (type == "give_item") return DialogueActionOp::GiveItem;
+    if (type == "remove_item") return DialogueActionOp::RemoveItem;
+    if (type == "modify_stat") return DialogueActionOp::ModifyStat;
+    if (type == "play_sound") return DialogueActionOp::PlaySound;
+    if (type == "start_quest" || type == "complete_quest" ||
+        type == "update_objective" || type == "set_quest_variable" ||
+        type == "track_npc_interaction" || type == "track_location_visit" ||
+        type == "track_custom_objective") {
+        return DialogueActionOp::External;
+    }
+    return DialogueActionOp::Unknown;
+}
+
+bool DialogueProgram::compileStat(const std::string& name, uint32_t& outStat) {
+    static const std::unordered_map<std::string, uint32_t> stats = {
+        {"hp", STAT_CURRENT_HP},
+        {"mp", STAT_CURRENT_MP},
+        {"level", STAT_LEVEL},
+        {"experience", STAT_EXPERIENCE},
+        {"strength", static_cast<uint32_t>(StatType::Strength)},
+        {"dexterity", static_cast<uint32_t>(StatType::Dexterity)},
+        {"intelligence", static_cast<uint32_t>(StatType::Intelligence)},
+        {"vitality", static_cast<uint32_t>(StatType::Vitality)},
+        {"luck", static_cast<uint32_t>(StatType::Luck)},
+        {"charisma", static_cast<uint32_t>(StatType::Charisma)},
+        {"max_hp", static_cast<uint32_t>(StatType::MaxHP)},
+        {"max_mp", static_cast<uint32_t>(StatType::MaxMP)},
+        {"attack_power", static_cast<uint32_t>(StatType::AttackPower)},
+        {"magic_power", static_cast<uint32_t>(StatType::MagicPower)},
+        {"defense", static_cast<uint32_t>(StatType::Defense)},
+        {"magic_defense", static_cast<uint32_t>(StatType::MagicDefense)},
+        {"accuracy", static_cast<uint32_t>(StatType::Accuracy)},
+        {"evasion", static_cast<uint32_t>(StatType::Evasion)},
+        {"critical_chance", static_cast<uint32_t>(StatType::CriticalChance)},
+        {"movement_speed", static_cast<uint32_t>(StatType::MovementSpeed)}
+    };
+
+    auto it = stats.find(name);
+    if (it == stats.end()) {
+        return false;
+    }
+    outStat = it->second;
+    return true;
+}
+
+void DialogueProgram::clear() {
+    m_lists.clear();
+    m_instructions.clear();
+    m_constants.clear();
+    m_sources.clear();
+    m_cache.clear();
+}
+
+void DialogueProgram::invalidateCache() const {
+    for (auto& cached : m_cache) {
+        cached.valid = false;
+    }
+}
+
+DialogueInstruction DialogueProgram::compileCondition(const DialogueCondition& condition, uint32_t source) {
+    DialogueInstruction instruction;
+    instruction.opcode = DialogueOpcode::Constant;
+    instruction.compare = DialogueCompare::Equal;
+    instruction.negate = condition.negate;
+    instruction.value = 0;
+    instruction.name = 0;
+    instruction.subName = 0;
+    instruction.source = source;
+
+    DialogueCompare compare = DialogueCompare::Equal;
+    bool knownCompare = parseCompare(condition.operation, compare);
+
+    if (condition.type == "flag") {
+        // Flags compare against a bool; anything but equality never passes
+        instruction.opcode = DialogueOpcode::Flag;
+        instruction.operand = Utils::StringId::intern(condition.target);
+        instruction.compare = compare;
+        instruction.value = (condition.value == "true") ? 1 : 0;
+        if (!knownCompare || (compare != DialogueCompare::Equal && compare != DialogueCompare::NotEqual)) {
+            instruction.opcode = DialogueOpcode::Constant;
+            instruction.value = 0;
+        }
+    } else if (condition.type == "variable") {
+        instruction.opcode = knownCompare ? DialogueOpcode::Variable : DialogueOpcode::Constant;
+        instruction.operand = Utils::StringId::intern(condition.target);
+        instruction.compare = compare;
+        instruction.value = knownCompare ? addConstant(condition.value) : 0;
+    } else if (condition.type == "stat") {
+        uint32_t stat = 0;
+        if (!compileStat(condition.target, stat) || !knownCompare) {
+            std::cerr << "Invalid stat condition: " << condition.target << " " << condition.operation << std::endl;
+        } else {
+            instruction.opcode = DialogueOpcode::Stat;
+            instruction.compare = compare;
+            instruction.name = stat;
+            instruction.value = addConstant(condition.value);
+        }
+    } else if (condition.type == "item") {
+        // Without a quantity, the item only has to be held
+        bool held = condition.value.empty();
+        if (condition.target.empty() || (!held && !knownCompare)) {
+            std::cerr << "Invalid item condition: " << condition.target << " " << condition.operation << std::endl;
+        } else {
+            instruction.opcode = DialogueOpcode::Item;
+            instruction.compare = held ? DialogueCompare::GreaterEqual : compare;
+            instruction.name = addConstant(condition.target);
+            instruction.value = addConstant(held ? "1" : condition.value);
+        }
+    } else if (condition.type == "quest_active" || condition.type == "quest_completed") {
+        instruction.opcode = (condition.type == "quest_active") ? DialogueOpcode::QuestActive : DialogueOpcode::QuestCompleted;
+        instruction.name = addConstant(condition.target);
+    } else if (condition.type == "objective_completed" || condition.type == "quest_variable") {
+        // Targets are "questId:objectiveId" and "questId:variableKey"
+        size_t colonPos = condition.target.find(':');
+        if (colonPos == std::string::npos || (condition.type == "quest_variable" && !knownCompare)) {
+            std::cerr << "Invalid quest condition: " << condition.type << " " << condition.target << std::endl;
+        } else {
+            instruction.opcode = (condition.type == "objective_completed") ? DialogueOpcode::ObjectiveCompleted
+                                                                           : DialogueOpcode::QuestVariable;
+            instruction.compare = compare;
+            instruction.name = addConstant(condition.target.substr(0, colonPos));
+            instruction.subName = addConstant(condition.target.substr(colonPos + 1));
+            instruction.value = addConstant(condition.value);
+        }
+    } else {
+        std::cerr << "Unknown condition type: " << condition.type << std::endl;
+    }
+
+    return instruction;
+}
+
+uint32_t DialogueProgram::addConstant(const std::string& value) {
+    m_constants.emplace_back(value);
+    return static_cast<uint32_t>(m_constants.size() - 1);
+}
+
+} // namespace Components
+} // namespace RPGEngine
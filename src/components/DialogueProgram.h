@@ -0,0 +1,247 @@
+#pragma once
+
+#include "../utils/StringId.h"
+#include <cstdint>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace RPGEngine {
+namespace Components {
+
+/**
+ * Dialogue instruction opcode enumeration
+ */
+enum class DialogueOpcode : uint8_t {
+    Constant,           // Fixed result (invalid conditions, unknown types)
+    Flag,               // Dialogue flag compared against a bool
+    Variable,           // Dialogue variable compared against a value
+    QuestActive,        // Quest is active
+    QuestCompleted,     // Quest is completed
+    ObjectiveCompleted, // Quest objective is completed
+    QuestVariable,      // Quest variable compared against a value
+    Stat,               // Stat (DialogueProgram::STAT_* in name) compared against a value
+    Item                // Quantity of an item held compared against a value
+};
+
+/**
+ * Comparison enumeration
+ */
+enum class DialogueCompare : uint8_t {
+    Equal,
+    NotEqual,
+    Less,
+    LessEqual,
+    Greater,
+    GreaterEqual,
+    Contains
+};
+
+/**
+ * Dialogue action opcode enumeration
+ */
+enum class DialogueActionOp : uint8_t {
+    Unresolved,         // Not compiled yet
+    SetFlag,
+    SetVariable,
+    GiveItem,
+    RemoveItem,
+    ModifyStat,
+    PlaySound,
+    External,           // Quest actions, left to the external executor
+    Unknown
+};
+
+/**
+ * Dialogue condition structure
+ */
+struct DialogueCondition {
+    std::string type;           // Condition type (flag, stat, item, etc.)
+    std::string target;         // Target to check (flag name, stat name, etc.)
+    std::string operation;      // Operation (==, !=, >, <, >=, <=)
+    std::string value;          // Value to compare against
+    bool negate;                // Whether to negate the result
+    
+    DialogueCondition(const std::string& condType = "", const std::string& condTarget = "",
+                     const std::string& op = "==", const std::string& val = "", bool neg = false)
+        : type(condType), target(condTarget), operation(op), value(val), negate(neg) {}
+};
+
+/**
+ * Dialogue action structure
+ */
+struct DialogueAction {
+    std::string type;           // Action type (set_flag, give_item, etc.)
+    std::string target;         // Action target
+    std::string value;          // Action value
+    std::unordered_map<std::string, std::string> parameters; // Additional parameters
+    DialogueActionOp op;        // Resolved action type
+    
+    DialogueAction(const std::string& actionType = "", const std::string& actionTarget = "",
+                  const std::string& actionValue = "")
+        : type(actionType), target(actionTarget), value(actionValue), op(DialogueActionOp::Unresolved) {}
+};
+
+/**
+ * Typed dialogue value
+ * Text with its interned ID, and the number it parses as if it is one.
+ * Parsed once when the value is set or compiled, never while comparing.
+ */
+struct DialogueValue {
+    std::string text;
+    Utils::StringId textId;
+    double number;
+    bool isNumber;
+
+    DialogueValue() : number(0.0), isNumber(false) {}
+    explicit DialogueValue(const std::string& value);
+
+    /**
+     * Compare two values
+     * Numbers compare numerically, anything else by text; ordering
+     * comparisons of non-numbers are false.
+     * @param lhs Left value
+     * @param compare Comparison
+     * @param rhs Right value
+     * @return Comparison result
+     */
+    static bool compare(const DialogueValue& lhs, DialogueCompare compare, const DialogueValue& rhs);
+
+    /**
+     * Compare raw text against a value, parsing the text only if the value is a number
+     * @param lhs Left text
+     * @param compare Comparison
+     * @param rhs Right value
+     * @return Comparison result
+     */
+    static bool compare(const std::string& lhs, DialogueCompare compare, const DialogueValue& rhs);
+
+    /**
+     * Compare a number against a value; false unless the value is a number
+     * @param lhs Left number
+     * @param compare Comparison
+     * @param rhs Right value
+     * @return Comparison result
+     */
+    static bool compare(double lhs, DialogueCompare compare, const DialogueValue& rhs);
+};
+
+/**
+ * Compiled dialogue condition
+ */
+struct DialogueInstruction {
+    DialogueOpcode opcode;
+    DialogueCompare compare;
+    bool negate;
+    Utils::StringId operand;    // Flag or variable name
+    uint32_t value;             // Constant index of the compared value
+    uint32_t name;              // Constant index of the quest ID or item ID, or the stat read
+    uint32_t subName;           // Constant index of the objective ID or quest variable key
+    uint32_t source;            // Index of the source condition
+};
+
+/**
+ * Compiled dialogue conditions
+ * Condition lists are compiled once, when a dialogue tree is loaded, into
+ * a flat instruction stream with interned operands, split quest targets
+ * and pre-parsed constants. Each list keeps a cached result that is valid
+ * while the state versions it was computed against have not changed.
+ */
+class DialogueProgram {
+public:
+    /**
+     * Compiled condition list
+     */
+    struct ConditionList {
+        uint32_t first;         // First instruction
+        uint32_t count;         // Number of instructions, all of which must pass
+        bool usesExternal;      // Whether the result depends on external (quest, stat, item) state
+        bool usesUnversioned;   // Whether it reads stats or items, which have no state version
+    };
+
+    /**
+     * Cached result of a condition list
+     */
+    struct CachedResult {
+        uint64_t version;
+        uint64_t externalVersion;
+        bool valid;
+        bool result;
+    };
+
+    static constexpr int32_t NO_CONDITIONS = -1;
+
+    // Stats a stat condition reads: StatType values (with modifiers), then these
+    static constexpr uint32_t STAT_CURRENT_HP = 0x100;
+    static constexpr uint32_t STAT_CURRENT_MP = 0x101;
+    static constexpr uint32_t STAT_LEVEL = 0x102;
+    static constexpr uint32_t STAT_EXPERIENCE = 0x103;
+
+    /**
+     * Resolve the stat a stat condition names
+     * "hp" and "mp" are the current values; "max_hp" and "max_mp" the maximums.
+     * Attributes and derived stats use their modifier names ("strength", "defense").
+     * @param name Stat name
+     * @param outStat Stat read (StatType value or STAT_*)
+     * @return false if the name is not a stat
+     */
+    static bool compileStat(const std::string& name, uint32_t& outStat);
+
+    /**
+     * Compile a condition list
+     * @param conditions Conditions
+     * @return List index, or NO_CONDITIONS for an empty list
+     */
+    int32_t compileConditions(const std::vector<DialogueCondition>& conditions);
+
+    /**
+     * Resolve the opcode of an action
+     * @param type Action type
+     * @return Action opcode
+     */
+    static DialogueActionOp compileAction(const std::string& type);
+
+    /**
+     * Clear all lists, instructions and constants
+     */
+    void clear();
+
+    /**
+     * Drop all cached results
+     */
+    void invalidateCache() const;
+
+    const ConditionList& getList(int32_t list) const { return m_lists[list]; }
+    const DialogueInstruction& getInstruction(uint32_t index) const { return m_instructions[index]; }
+    const DialogueValue& getConstant(uint32_t index) const { return m_constants[index]; }
+    const DialogueCondition& getSource(uint32_t index) const { return m_sources[index]; }
+    CachedResult& getCachedResult(int32_t list) const { return m_cache[list]; }
+
+    size_t getListCount() const { return m_lists.size(); }
+    size_t getInstructionCount() const { return m_instructions.size(); }
+
+private:
+    /**
+     * Compile one condition
+     * @param condition Condition
+     * @param source Index of the stored source condition
+     * @return Instruction
+     */
+    DialogueInstruction compileCondition(const DialogueCondition& condition, uint32_t source);
+
+    /**
+     * Add a constant
+     * @param value Constant text
+     * @return Constant index
+     */
+    uint32_t addConstant(const std::string& value);
+
+    std::vector<ConditionList> m_lists;
+    std::vector<DialogueInstruction> m_instructions;
+    std::vector<DialogueValue> m_constants;
+    std::vector<DialogueCondition> m_sources;
+    mutable std::vector<CachedResult> m_cache;
+};
+
+} // namespace Components
+} // namespace RPGEngine
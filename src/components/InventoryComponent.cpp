@@ -7,7 +7,7 @@ namespace RPGEngine {
 namespace Components {
 
 // Static member initialization
-std::unordered_map<std::string, ItemDefinition> InventoryComponent::s_itemDefinitions;
+std::unordered_map<Utils::StringId, ItemDefinition> InventoryComponent::s_itemDefinitions;
 
 InventoryComponent::InventoryComponent(EntityId entityId, int capacity)
     : Component<InventoryComponent>(entityId)
@@ -24,11 +24,12 @@ InventoryComponent::~InventoryComponent() {
 }
 
 int InventoryComponent::addItem(const std::string& itemId, int quantity) {
-    if (quantity <= 0 || !hasItemDefinition(itemId)) {
+    if (quantity <= 0) {
         return 0;
     }
     
-    const ItemDefinition* definition = getItemDefinition(itemId);
+    const Utils::StringId itemKey(itemId);
+    const ItemDefinition* definition = getItemDefinition(itemKey);
     if (!definition) {
         return 0;
     }
@@ -39,7 +40,7 @@ int InventoryComponent::addItem(const std::string& itemId, int quantity) {
     // First, try to add to existing stacks
     if (maxStackSize > 1) {
         for (auto& slot : m_slots) {
-            if (!slot.isEmpty && slot.item.itemId == itemId) {
+            if (!slot.isEmpty && slot.item.itemKey == itemKey) {
                 int canAdd = std::min(remainingQuantity, maxStackSize - slot.item.quantity);
                 if (canAdd > 0) {
                     slot.item.quantity += canAdd;
@@ -87,7 +88,7 @@ int InventoryComponent::addItem(const ItemInstance& item) {
         return 0;
     }
     
-    const ItemDefinition* definition = getItemDefinition(item.itemId);
+    const ItemDefinition* definition = getItemDefinition(item.itemKey);
     if (!definition) {
         return 0;
     }
@@ -141,11 +142,12 @@ int InventoryComponent::removeItem(const std::string& itemId, int quantity) {
     }
     
     int remainingToRemove = quantity;
+    const Utils::StringId itemKey(itemId);
     
     // Remove from slots, starting from the end to avoid index issues
     for (int i = static_cast<int>(m_slots.size()) - 1; i >= 0 && remainingToRemove > 0; --i) {
         auto& slot = m_slots[i];
-        if (!slot.isEmpty && slot.item.itemId == itemId) {
+        if (!slot.isEmpty && slot.item.itemKey == itemKey) {
             int canRemove = std::min(remainingToRemove, slot.item.quantity);
             slot.item.quantity -= canRemove;
             remainingToRemove -= canRemove;
@@ -230,9 +232,10 @@ bool InventoryComponent::hasItem(const std::string& itemId, int quantity) const
 
 int InventoryComponent::getItemQuantity(const std::string& itemId) const {
     int totalQuantity = 0;
+    const Utils::StringId itemKey(itemId);
     
     for (const auto& slot : m_slots) {
-        if (!slot.isEmpty && slot.item.itemId == itemId) {
+        if (!slot.isEmpty && slot.item.itemKey == itemKey) {
             totalQuantity += slot.item.quantity;
         }
     }
@@ -241,8 +244,9 @@ int InventoryComponent::getItemQuantity(const std::string& itemId) const {
 }
 
 int InventoryComponent::findItemSlot(const std::string& itemId) const {
+    const Utils::StringId itemKey(itemId);
     for (int i = 0; i < static_cast<int>(m_slots.size()); ++i) {
-        if (!m_slots[i].isEmpty && m_slots[i].item.itemId == itemId) {
+        if (!m_slots[i].isEmpty && m_slots[i].item.itemKey == itemKey) {
             return i;
         }
     }
@@ -336,8 +340,8 @@ void InventoryComponent::sortInventory(bool sortByType) {
     // Sort items
     if (sortByType) {
         std::sort(items.begin(), items.end(), [](const ItemInstance& a, const ItemInstance& b) {
-            const ItemDefinition* defA = getItemDefinition(a.itemId);
-            const ItemDefinition* defB = getItemDefinition(b.itemId);
+            const ItemDefinition* defA = getItemDefinition(a.itemKey);
+            const ItemDefinition* defB = getItemDefinition(b.itemKey);
             
             if (defA && defB) {
                 if (defA->type != defB->type) {
@@ -353,8 +357,8 @@ void InventoryComponent::sortInventory(bool sortByType) {
         });
     } else {
         std::sort(items.begin(), items.end(), [](const ItemInstance& a, const ItemInstance& b) {
-            const ItemDefinition* defA = getItemDefinition(a.itemId);
-            const ItemDefinition* defB = getItemDefinition(b.itemId);
+            const ItemDefinition* defA = getItemDefinition(a.itemKey);
+            const ItemDefinition* defB = getItemDefinition(b.itemKey);
             
             if (defA && defB) {
                 return defA->name < defB->name;
@@ -442,17 +446,21 @@ bool InventoryComponent::unequipItem(EquipmentSlot slot) {
 }
 
 void InventoryComponent::registerItemDefinition(const ItemDefinition& definition) {
-    s_itemDefinitions[definition.id] = definition;
+    s_itemDefinitions[Utils::StringId::intern(definition.id)] = definition;
     std::cout << "Registered item definition: " << definition.name << " (" << definition.id << ")" << std::endl;
 }
 
 const ItemDefinition* InventoryComponent::getItemDefinition(const std::string& itemId) {
-    auto it = s_itemDefinitions.find(itemId);
+    return getItemDefinition(Utils::StringId(itemId));
+}
+
+const ItemDefinition* InventoryComponent::getItemDefinition(Utils::StringId itemKey) {
+    auto it = s_itemDefinitions.find(itemKey);
     return (it != s_itemDefinitions.end()) ? &it->second : nullptr;
 }
 
 bool InventoryComponent::hasItemDefinition(const std::string& itemId) {
-    return s_itemDefinitions.find(itemId) != s_itemDefinitions.end();
+    return s_itemDefinitions.find(Utils::StringId(itemId)) != s_itemDefinitions.end();
 }
 
 std::string InventoryComponent::serialize() const {
@@ -558,7 +566,7 @@ bool InventoryComponent::deserialize(const std::string& data) {
 }
 
 bool InventoryComponent::canStack(const ItemInstance& item1, const ItemInstance& item2) const {
-    if (item1.itemId != item2.itemId) {
+    if (item1.itemKey != item2.itemKey) {
         return false;
     }
     
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "Component.h"
+#include "../utils/StringId.h"
 #include <string>
 #include <unordered_map>
 #include <vector>
@@ -97,6 +98,7 @@ struct ItemDefinition {
  */
 struct ItemInstance {
     std::string itemId;                     // Reference to item definition
+    Utils::StringId itemKey;                // Interned itemId, used for matching
     int quantity;                           // Current quantity
     int durability;                         // Current durability (-1 for no durability)
     int maxDurability;                      // Maximum durability
@@ -105,7 +107,7 @@ struct ItemInstance {
     ItemInstance() : itemId(""), quantity(0), durability(-1), maxDurability(-1) {}
     
     ItemInstance(const std::string& id, int qty = 1, int dur = -1)
-        : itemId(id), quantity(qty), durability(dur), maxDurability(dur) {}
+        : itemId(id), itemKey(Utils::StringId::intern(id)), quantity(qty), durability(dur), maxDurability(dur) {}
     
     /**
      * Check if item is broken
@@ -419,6 +421,13 @@ public:
      */
     static const ItemDefinition* getItemDefinition(const std::string& itemId);
     
+    /**
+     * Get item definition
+     * @param itemKey Interned item ID
+     * @return Item definition, or nullptr if not found
+     */
+    static const ItemDefinition* getItemDefinition(Utils::StringId itemKey);
+    
     /**
      * Check if item definition exists
      * @param itemId Item ID
@@ -546,7 +555,7 @@ private:
     EquipmentSet m_equipment;
     
     // Item definitions (static registry)
-    static std::unordered_map<std::string, ItemDefinition> s_itemDefinitions;
+    static std::unordered_map<Utils::StringId, ItemDefinition> s_itemDefinitions; // keyed by interned item ID
     
     // Callbacks
     std::function<void(const std::string&, int)> m_itemAddedCallback;
@@ -8,13 +8,21 @@ namespace Components {
 
 // Static quest definitions registry
 std::unordered_map<std::string, QuestDefinition> QuestComponent::s_questDefinitions;
+std::function<bool(const std::string&, QuestDefinition&)> QuestComponent::s_questDefinitionSource;
 
-QuestComponent::QuestComponent(EntityId entityId) : Component<QuestComponent>(entityId) {
+// Static objective index
+std::unordered_map<ObjectiveEventKey, std::vector<QuestComponent::ObjectiveSubscription>, ObjectiveEventKeyHash>
+    QuestComponent::s_objectiveIndex;
+
+QuestComponent::QuestComponent(EntityId entityId) : Component<QuestComponent>(entityId), m_stateVersion(0) {
     // Initialize component
 }
 
 QuestComponent::~QuestComponent() {
-    // Cleanup
+    // The index holds pointers to this component
+    for (const auto& quest : m_activeQuests) {
+        unsubscribeObjectives(quest);
+    }
 }
 
 // Quest definition management
@@ -30,11 +38,20 @@ void QuestComponent::registerQuestDefinition(const QuestDefinition& definition)
 
 const QuestDefinition* QuestComponent::getQuestDefinition(const std::string& questId) {
     auto it = s_questDefinitions.find(questId);
-    return (it != s_questDefinitions.end()) ? &it->second : nullptr;
+    if (it != s_questDefinitions.end()) {
+        return &it->second;
+    }
+    
+    // Load on first use
+    QuestDefinition definition;
+    if (s_questDefinitionSource && s_questDefinitionSource(questId, definition) && definition.id == questId) {
+        return &(s_questDefinitions[questId] = std::move(definition));
+    }
+    return nullptr;
 }
 
 bool QuestComponent::hasQuestDefinition(const std::string& questId) {
-    return s_questDefinitions.find(questId) != s_questDefinitions.end();
+    return getQuestDefinition(questId) != nullptr;
 }
 
 // Quest management
@@ -72,6 +89,8 @@ bool QuestComponent::startQuest(const std::string& questId, const std::string& s
     
     // Add to active quests
     m_activeQuests.push_back(activeQuest);
+    subscribeObjectives(activeQuest);
+    m_stateVersion++;
     
     // Trigger quest started event
     triggerQuestStarted(questId);
@@ -213,6 +232,7 @@ bool QuestComponent::updateObjectiveProgress(const std::string& questId, const s
     }
     
     bool wasCompleted = objective->addProgress(amount);
+    m_stateVersion++;
     
     if (wasCompleted) {
         triggerObjectiveCompleted(questId, objectiveId);
@@ -239,6 +259,7 @@ bool QuestComponent::setObjectiveProgress(const std::string& questId, const std:
     }
     
     bool wasCompleted = objective->setProgress(progress);
+    m_stateVersion++;
     
     if (wasCompleted) {
         triggerObjectiveCompleted(questId, objectiveId);
@@ -266,6 +287,7 @@ bool QuestComponent::completeObjective(const std::string& questId, const std::st
     
     objective->currentCount = objective->requiredCount;
     objective->isCompleted = true;
+    m_stateVersion++;
     
     triggerObjectiveCompleted(questId, objectiveId);
     
@@ -301,130 +323,168 @@ int QuestComponent::getObjectiveProgress(const std::string& questId, const std::
 // Quest tracking helpers
 
 void QuestComponent::trackKill(const std::string& enemyType, int count) {
-    for (auto& activeQuest : m_activeQuests) {
-        if (activeQuest.status != QuestStatus::Active) continue;
-        
-        for (auto& objective : activeQuest.objectives) {
-            if (objective.type == ObjectiveType::Kill && 
-                objective.target == enemyType && 
-                !objective.isCompleted) {
-                
-                bool wasCompleted = objective.addProgress(count);
-                if (wasCompleted) {
-                    triggerObjectiveCompleted(activeQuest.questId, objective.id);
-                    
-                    // Check if quest can be auto-completed
-                    const QuestDefinition* definition = getQuestDefinition(activeQuest.questId);
-                    if (definition && definition->isAutoComplete && activeQuest.canComplete()) {
-                        completeQuest(activeQuest.questId, true);
-                        break; // Quest completed, no need to continue
-                    }
-                }
-            }
+    trackKill(Utils::StringId(enemyType), count);
+}
+
+void QuestComponent::trackKill(Utils::StringId enemyType, int count) {
+    trackObjectiveEvent(ObjectiveEventKey(ObjectiveType::Kill, enemyType), count);
+}
+
+void QuestComponent::trackItemCollection(const std::string& itemId, int count) {
+    trackObjectiveEvent(ObjectiveEventKey(ObjectiveType::Collect, Utils::StringId(itemId)), count);
+}
+
+void QuestComponent::trackNPCInteraction(const std::string& npcId) {
+    trackObjectiveEvent(ObjectiveEventKey(ObjectiveType::Talk, Utils::StringId(npcId)), 1);
+}
+
+void QuestComponent::trackLocationVisit(const std::string& locationId) {
+    trackObjectiveEvent(ObjectiveEventKey(ObjectiveType::Reach, Utils::StringId(locationId)), 1);
+}
+
+void QuestComponent::trackCustomObjective(const std::string& objectiveType, const std::string& target, int count) {
+    trackObjectiveEvent(ObjectiveEventKey(ObjectiveType::Custom, Utils::StringId(target), Utils::StringId(objectiveType)), count);
+}
+
+int QuestComponent::dispatchObjectiveEvent(const ObjectiveEventKey& key, int count,
+                                           std::vector<ObjectiveProgressUpdate>* updates) {
+    auto it = s_objectiveIndex.find(key);
+    if (it == s_objectiveIndex.end()) {
+        return 0;
+    }
+    
+    // Completing a quest unsubscribes it, so walk a copy of the list
+    std::vector<ObjectiveSubscription> subscriptions = it->second;
+    
+    int advanced = 0;
+    for (const auto& subscription : subscriptions) {
+        if (subscription.component->advanceObjective(subscription.questKey, subscription.objectiveIndex, count, updates)) {
+            advanced++;
         }
     }
+    
+    return advanced;
 }
 
-void QuestComponent::trackItemCollection(const std::string& itemId, int count) {
-    for (auto& activeQuest : m_activeQuests) {
-        if (activeQuest.status != QuestStatus::Active) continue;
-        
-        for (auto& objective : activeQuest.objectives) {
-            if (objective.type == ObjectiveType::Collect && 
-                objective.target == itemId && 
-                !objective.isCompleted) {
-                
-                bool wasCompleted = objective.addProgress(count);
-                if (wasCompleted) {
-                    triggerObjectiveCompleted(activeQuest.questId, objective.id);
-                    
-                    // Check if quest can be auto-completed
-                    const QuestDefinition* definition = getQuestDefinition(activeQuest.questId);
-                    if (definition && definition->isAutoComplete && activeQuest.canComplete()) {
-                        completeQuest(activeQuest.questId, true);
-                        break; // Quest completed, no need to continue
-                    }
-                }
-            }
+size_t QuestComponent::getObjectiveSubscriptionCount(const ObjectiveEventKey& key) {
+    auto it = s_objectiveIndex.find(key);
+    return (it != s_objectiveIndex.end()) ? it->second.size() : 0;
+}
+
+void QuestComponent::trackObjectiveEvent(const ObjectiveEventKey& key, int count) {
+    auto it = s_objectiveIndex.find(key);
+    if (it == s_objectiveIndex.end()) {
+        return;
+    }
+    
+    std::vector<ObjectiveSubscription> subscriptions;
+    for (const auto& subscription : it->second) {
+        if (subscription.component == this) {
+            subscriptions.push_back(subscription);
         }
     }
+    
+    for (const auto& subscription : subscriptions) {
+        advanceObjective(subscription.questKey, subscription.objectiveIndex, count, nullptr);
+    }
 }
 
-void QuestComponent::trackNPCInteraction(const std::string& npcId) {
-    for (auto& activeQuest : m_activeQuests) {
-        if (activeQuest.status != QuestStatus::Active) continue;
+bool QuestComponent::getObjectiveEventKey(const QuestObjective& objective, ObjectiveEventKey& outKey) {
+    switch (objective.type) {
+        case ObjectiveType::Kill:
+        case ObjectiveType::Collect:
+        case ObjectiveType::Talk:
+        case ObjectiveType::Reach:
+            outKey = ObjectiveEventKey(objective.type, objective.targetId);
+            return true;
         
-        for (auto& objective : activeQuest.objectives) {
-            if (objective.type == ObjectiveType::Talk && 
-                objective.target == npcId && 
-                !objective.isCompleted) {
-                
-                bool wasCompleted = objective.addProgress(1);
-                if (wasCompleted) {
-                    triggerObjectiveCompleted(activeQuest.questId, objective.id);
-                    
-                    // Check if quest can be auto-completed
-                    const QuestDefinition* definition = getQuestDefinition(activeQuest.questId);
-                    if (definition && definition->isAutoComplete && activeQuest.canComplete()) {
-                        completeQuest(activeQuest.questId, true);
-                        break; // Quest completed, no need to continue
-                    }
-                }
+        case ObjectiveType::Custom: {
+            auto it = objective.parameters.find("custom_type");
+            if (it == objective.parameters.end()) {
+                return false;
             }
+            outKey = ObjectiveEventKey(objective.type, objective.targetId, Utils::StringId::intern(it->second));
+            return true;
         }
+        
+        default:
+            return false;
     }
 }
 
-void QuestComponent::trackLocationVisit(const std::string& locationId) {
-    for (auto& activeQuest : m_activeQuests) {
-        if (activeQuest.status != QuestStatus::Active) continue;
+void QuestComponent::subscribeObjectives(const ActiveQuest& quest) {
+    for (size_t i = 0; i < quest.objectives.size(); ++i) {
+        ObjectiveEventKey key;
+        if (!quest.objectives[i].isCompleted && getObjectiveEventKey(quest.objectives[i], key)) {
+            s_objectiveIndex[key].push_back({this, quest.questKey, i});
+        }
+    }
+}
+
+void QuestComponent::unsubscribeObjectives(const ActiveQuest& quest) {
+    for (const auto& objective : quest.objectives) {
+        ObjectiveEventKey key;
+        if (!getObjectiveEventKey(objective, key)) {
+            continue;
+        }
         
-        for (auto& objective : activeQuest.objectives) {
-            if (objective.type == ObjectiveType::Reach && 
-                objective.target == locationId && 
-                !objective.isCompleted) {
-                
-                bool wasCompleted = objective.addProgress(1);
-                if (wasCompleted) {
-                    triggerObjectiveCompleted(activeQuest.questId, objective.id);
-                    
-                    // Check if quest can be auto-completed
-                    const QuestDefinition* definition = getQuestDefinition(activeQuest.questId);
-                    if (definition && definition->isAutoComplete && activeQuest.canComplete()) {
-                        completeQuest(activeQuest.questId, true);
-                        break; // Quest completed, no need to continue
-                    }
-                }
-            }
+        auto it = s_objectiveIndex.find(key);
+        if (it == s_objectiveIndex.end()) {
+            continue;
+        }
+        
+        auto& subscriptions = it->second;
+        subscriptions.erase(std::remove_if(subscriptions.begin(), subscriptions.end(),
+            [this, &quest](const ObjectiveSubscription& subscription) {
+                return subscription.component == this && subscription.questKey == quest.questKey;
+            }), subscriptions.end());
+        
+        if (subscriptions.empty()) {
+            s_objectiveIndex.erase(it);
         }
     }
 }
 
-void QuestComponent::trackCustomObjective(const std::string& objectiveType, const std::string& target, int count) {
-    for (auto& activeQuest : m_activeQuests) {
-        if (activeQuest.status != QuestStatus::Active) continue;
+bool QuestComponent::advanceObjective(Utils::StringId questKey, size_t objectiveIndex, int count,
+                                      std::vector<ObjectiveProgressUpdate>* updates) {
+    auto questIt = std::find_if(m_activeQuests.begin(), m_activeQuests.end(),
+        [questKey](const ActiveQuest& quest) {
+            return quest.questKey == questKey;
+        });
+    
+    if (questIt == m_activeQuests.end() || questIt->status != QuestStatus::Active ||
+        objectiveIndex >= questIt->objectives.size()) {
+        return false;
+    }
+    
+    QuestObjective& objective = questIt->objectives[objectiveIndex];
+    if (objective.isCompleted) {
+        return false;
+    }
+    
+    bool wasCompleted = objective.addProgress(count);
+    m_stateVersion++;
+    
+    if (updates) {
+        updates->push_back({m_entityId, questIt->questId, objective.id,
+                            objective.currentCount, objective.requiredCount, wasCompleted});
+    }
+    
+    if (wasCompleted) {
+        // Copies, as callbacks and completing the quest can change m_activeQuests
+        const std::string questId = questIt->questId;
+        const std::string objectiveId = objective.id;
+        triggerObjectiveCompleted(questId, objectiveId);
         
-        for (auto& objective : activeQuest.objectives) {
-            if (objective.type == ObjectiveType::Custom && 
-                objective.parameters.find("custom_type") != objective.parameters.end() &&
-                objective.parameters.at("custom_type") == objectiveType &&
-                objective.target == target && 
-                !objective.isCompleted) {
-                
-                bool wasCompleted = objective.addProgress(count);
-                if (wasCompleted) {
-                    triggerObjectiveCompleted(activeQuest.questId, objective.id);
-                    
-                    // Check if quest can be auto-completed
-                    const QuestDefinition* definition = getQuestDefinition(activeQuest.questId);
-                    if (definition && definition->isAutoComplete && activeQuest.canComplete()) {
-                        completeQuest(activeQuest.questId, true);
-                        break; // Quest completed, no need to continue
-                    }
-                }
-            }
+        // Check if quest can be auto-completed
+        const QuestDefinition* definition = getQuestDefinition(questId);
+        const ActiveQuest* activeQuest = getActiveQuest(questId);
+        if (definition && definition->isAutoComplete && activeQuest && activeQuest->canComplete()) {
+            completeQuest(questId, true);
         }
     }
+    
+    return true;
 }
 
 // Quest variables
@@ -433,6 +493,7 @@ void QuestComponent::setQuestVariable(const std::string& questId, const std::str
     ActiveQuest* activeQuest = getActiveQuestMutable(questId);
     if (activeQuest) {
         activeQuest->setVariable(key, value);
+        m_stateVersion++;
     }
 }
 
@@ -507,7 +568,9 @@ bool QuestComponent::removeActiveQuest(const std::string& questId) {
         });
     
     if (it != m_activeQuests.end()) {
+        unsubscribeObjectives(*it);
         m_activeQuests.erase(it);
+        m_stateVersion++;
         return true;
     }
     
@@ -591,9 +654,13 @@ bool QuestComponent::deserialize(const std::string& data) {
     std::istringstream iss(data);
     std::string line;
     
+    for (const auto& quest : m_activeQuests) {
+        unsubscribeObjectives(quest);
+    }
     m_activeQuests.clear();
     m_completedQuests.clear();
     m_failedQuests.clear();
+    m_stateVersion++;
     
     try {
         while (std::getline(iss, line)) {
@@ -611,10 +678,10 @@ bool QuestComponent::deserialize(const std::string& data) {
                     
                     if (!std::getline(questStream, questId, ':') ||
                         !std::getline(questStream, statusStr, ':') ||
-                        !std::getline(questStream, timeStr, ':') ||
-                        !std::getline(questStream, startedBy)) {
+                        !std::getline(questStream, timeStr, ':')) {
                         return false;
                     }
+                    std::getline(questStream, startedBy); // Empty if nobody started it
                     
                     ActiveQuest quest(questId, static_cast<QuestStatus>(std::stoi(statusStr)));
                     quest.timeRemaining = std::stof(timeStr);
@@ -678,6 +745,7 @@ bool QuestComponent::deserialize(const std::string& data) {
                     }
                     
                     m_activeQuests.push_back(quest);
+                    subscribeObjectives(quest);
                 }
             }
             else if (line.find("COMPLETED_QUESTS:") == 0) {
@@ -2,6 +2,7 @@
 
 #include "Component.h"
 #include "../entities/Entity.h"
+#include "../utils/StringId.h"
 #include <string>
 #include <vector>
 #include <unordered_map>
@@ -45,6 +46,7 @@ struct QuestObjective {
     std::string description;            // Objective description
     ObjectiveType type;                 // Objective type
     std::string target;                 // Target (enemy type, item ID, NPC ID, etc.)
+    Utils::StringId targetId;           // Interned target, used when tracking progress
     int requiredCount;                  // Required count to complete
     int currentCount;                   // Current progress
     bool isCompleted;                   // Whether objective is completed
@@ -56,9 +58,19 @@ struct QuestObjective {
                    ObjectiveType objType = ObjectiveType::Custom, const std::string& objTarget = "",
                    int required = 1)
         : id(objId), description(desc), type(objType), target(objTarget),
+          targetId(Utils::StringId::intern(objTarget)),
           requiredCount(required), currentCount(0), isCompleted(false),
           isOptional(false), isHidden(false) {}
     
+    /**
+     * Change the objective target
+     * @param objTarget New target
+     */
+    void setTarget(const std::string& objTarget) {
+        target = objTarget;
+        targetId = Utils::StringId::intern(objTarget);
+    }
+    
     /**
      * Get completion percentage
      * @return Completion percentage (0.0 to 1.0)
@@ -177,6 +189,7 @@ struct QuestDefinition {
  */
 struct ActiveQuest {
     std::string questId;                // Quest ID
+    Utils::StringId questKey;           // Interned quest ID
     QuestStatus status;                 // Current status
     std::vector<QuestObjective> objectives; // Current objectives
     float timeRemaining;                // Time remaining (if time limited)
@@ -184,7 +197,7 @@ struct ActiveQuest {
     std::unordered_map<std::string, std::string> variables; // Quest-specific variables
     
     ActiveQuest(const std::string& id = "", QuestStatus questStatus = QuestStatus::NotStarted)
-        : questId(id), status(questStatus), timeRemaining(-1.0f) {}
+        : questId(id), questKey(Utils::StringId::intern(id)), status(questStatus), timeRemaining(-1.0f) {}
     
     /**
      * Get objective by ID
@@ -266,9 +279,53 @@ struct ActiveQuest {
     }
 };
 
+/**
+ * Game event an objective can subscribe to: the objective type, the
+ * interned target and, for custom objectives, the interned "custom_type"
+ * parameter
+ */
+struct ObjectiveEventKey {
+    ObjectiveType type;
+    Utils::StringId target;
+    Utils::StringId customType;
+    
+    ObjectiveEventKey(ObjectiveType eventType = ObjectiveType::Custom, Utils::StringId eventTarget = Utils::StringId(),
+                      Utils::StringId eventCustomType = Utils::StringId())
+        : type(eventType), target(eventTarget), customType(eventCustomType) {}
+    
+    bool operator==(const ObjectiveEventKey& other) const {
+        return type == other.type && target == other.target && customType == other.customType;
+    }
+};
+
+struct ObjectiveEventKeyHash {
+    size_t operator()(const ObjectiveEventKey& key) const {
+        size_t hash = std::hash<Utils::StringId>()(key.target);
+        hash ^= std::hash<Utils::StringId>()(key.customType) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+        return hash ^ (static_cast<size_t>(key.type) << 24);
+    }
+};
+
+/**
+ * Objective progress made by a game event, reported to listeners such as
+ * QuestUI
+ */
+struct ObjectiveProgressUpdate {
+    EntityId entityId;                  // Entity owning the quest
+    std::string questId;                // Quest ID
+    std::string objectiveId;            // Objective ID
+    int currentCount;                   // Progress after the event
+    int requiredCount;                  // Required count
+    bool completed;                     // Whether the event completed the objective
+};
+
 /**
  * Quest component
  * Manages quest tracking, objectives, and completion
+ *
+ * Objectives of active quests are registered in a global index from
+ * ObjectiveEventKey to the objectives waiting on that event, so a kill,
+ * pickup or visit only touches the objectives it can advance.
  */
 class QuestComponent : public Component<QuestComponent> {
 public:
@@ -282,7 +339,14 @@ public:
      * Destructor
      */
     ~QuestComponent();
-    
+
+    // The objective index holds pointers to this component, so it can't be
+    // copied or moved
+    QuestComponent(const QuestComponent&) = delete;
+    QuestComponent& operator=(const QuestComponent&) = delete;
+    QuestComponent(QuestComponent&&) = delete;
+    QuestComponent& operator=(QuestComponent&&) = delete;
+
     // Quest definition management
     
     /**
@@ -298,6 +362,16 @@ public:
      */
     static const QuestDefinition* getQuestDefinition(const std::string& questId);
     
+    /**
+     * Set quest definition source
+     * Definitions that were never registered are asked for from the source
+     * on first use and registered, e.g. to decode them from a ContentDatabase.
+     * @param source Function filling in a definition, returning false if unknown
+     */
+    static void setQuestDefinitionSource(std::function<bool(const std::string&, QuestDefinition&)> source) {
+        s_questDefinitionSource = source;
+    }
+    
     /**
      * Check if quest definition exists
      * @param questId Quest ID
@@ -307,6 +381,7 @@ public:
     
     /**
      * Get all quest definitions
+     * Definitions from the definition source are only included once used.
      * @return Map of quest IDs to definitions
      */
     static const std::unordered_map<std::string, QuestDefinition>& getQuestDefinitions() {
@@ -386,6 +461,15 @@ public:
      */
     const std::vector<std::string>& getCompletedQuests() const { return m_completedQuests; }
     
+    /**
+     * Get quest state version
+     * Changes whenever a quest starts or ends, an objective advances or a
+     * quest variable is set, so results derived from quest state (such as
+     * cached dialogue conditions) can tell when they are stale.
+     * @return State version
+     */
+    uint64_t getStateVersion() const { return m_stateVersion; }
+    
     // Objective management
     
     /**
@@ -439,6 +523,13 @@ public:
      */
     void trackKill(const std::string& enemyType, int count = 1);
     
+    /**
+     * Track kill
+     * @param enemyType Interned enemy type, e.g. "goblin"_sid
+     * @param count Number killed
+     */
+    void trackKill(Utils::StringId enemyType, int count = 1);
+    
     /**
      * Track item collection
      * @param itemId Item ID that was collected
@@ -466,6 +557,23 @@ public:
      */
     void trackCustomObjective(const std::string& objectiveType, const std::string& target, int count = 1);
     
+    /**
+     * Advance every objective of every quest component waiting on an event
+     * @param key Event
+     * @param count Progress amount
+     * @param updates Receives the progress made, if not null
+     * @return Number of objectives advanced
+     */
+    static int dispatchObjectiveEvent(const ObjectiveEventKey& key, int count = 1,
+                                      std::vector<ObjectiveProgressUpdate>* updates = nullptr);
+    
+    /**
+     * Get number of objectives waiting on an event
+     * @param key Event
+     * @return Number of indexed objectives, including completed ones of active quests
+     */
+    static size_t getObjectiveSubscriptionCount(const ObjectiveEventKey& key);
+    
     // Quest variables
     
     /**
@@ -578,6 +686,44 @@ private:
      */
     bool removeActiveQuest(const std::string& questId);
     
+    /**
+     * Get index key of an objective
+     * @param objective Objective
+     * @param outKey Receives the key
+     * @return false if no tracking event can advance the objective
+     */
+    static bool getObjectiveEventKey(const QuestObjective& objective, ObjectiveEventKey& outKey);
+    
+    /**
+     * Add the objectives of an active quest to the objective index
+     * @param quest Active quest
+     */
+    void subscribeObjectives(const ActiveQuest& quest);
+    
+    /**
+     * Remove the objectives of an active quest from the objective index
+     * @param quest Active quest
+     */
+    void unsubscribeObjectives(const ActiveQuest& quest);
+    
+    /**
+     * Advance the indexed objectives of this component waiting on an event
+     * @param key Event
+     * @param count Progress amount
+     */
+    void trackObjectiveEvent(const ObjectiveEventKey& key, int count);
+    
+    /**
+     * Advance one objective from the index
+     * @param questKey Interned quest ID
+     * @param objectiveIndex Objective index in the quest
+     * @param count Progress amount
+     * @param updates Receives the progress made, if not null
+     * @return true if the objective advanced
+     */
+    bool advanceObjective(Utils::StringId questKey, size_t objectiveIndex, int count,
+                          std::vector<ObjectiveProgressUpdate>* updates);
+    
     /**
      * Trigger quest started event
      * @param questId Quest ID
@@ -614,9 +760,19 @@ private:
     std::vector<ActiveQuest> m_activeQuests;
     std::vector<std::string> m_completedQuests;
     std::vector<std::string> m_failedQuests;
+    uint64_t m_stateVersion;
     
     // Quest definitions (static registry)
     static std::unordered_map<std::string, QuestDefinition> s_questDefinitions;
+    static std::function<bool(const std::string&, QuestDefinition&)> s_questDefinitionSource;
+    
+    // Objective index (static, shared by all quest components)
+    struct ObjectiveSubscription {
+        QuestComponent* component;
+        Utils::StringId questKey;
+        size_t objectiveIndex;
+    };
+    static std::unordered_map<ObjectiveEventKey, std::vector<ObjectiveSubscription>, ObjectiveEventKeyHash> s_objectiveIndex;
     
     // Callbacks
     std::function<void(const std::string&)> m_questStartedCallback;
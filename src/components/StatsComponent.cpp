@@ -7,6 +7,56 @@
 namespace RPGEngine {
 namespace Components {
 
+namespace {
+
+using namespace Utils::StringIdLiterals;
+
+// Modifier stat names by StatType, hashed at compile time
+constexpr Utils::StringId STAT_IDS[STAT_TYPE_COUNT] = {
+    "strength"_sid,
+    "dexterity"_sid,
+    "intelligence"_sid,
+    "vitality"_sid,
+    "luck"_sid,
+    "charisma"_sid,
+    "hp"_sid,
+    "mp"_sid,
+    "attack_power"_sid,
+    "magic_power"_sid,
+    "defense"_sid,
+    "magic_defense"_sid,
+    "accuracy"_sid,
+    "evasion"_sid,
+    "critical_chance"_sid,
+    "movement_speed"_sid
+};
+
+constexpr uint32_t statBit(StatType stat) {
+    return 1u << static_cast<uint32_t>(stat);
+}
+
+const uint32_t ALL_STATS = (1u << STAT_TYPE_COUNT) - 1u;
+const size_t ATTRIBUTE_COUNT = static_cast<size_t>(AttributeType::Charisma) + 1;
+
+// Derived stats computed from each attribute, by AttributeType
+const uint32_t ATTRIBUTE_DEPENDENTS[ATTRIBUTE_COUNT] = {
+    statBit(StatType::AttackPower),
+    statBit(StatType::Accuracy) | statBit(StatType::Evasion) | statBit(StatType::MovementSpeed),
+    statBit(StatType::MaxMP) | statBit(StatType::MagicPower) | statBit(StatType::MagicDefense),
+    statBit(StatType::MaxHP) | statBit(StatType::Defense),
+    statBit(StatType::CriticalChance),
+    0u
+};
+
+static_assert(static_cast<size_t>(StatType::Charisma) == static_cast<size_t>(AttributeType::Charisma),
+              "StatType must start with the attributes in AttributeType order");
+
+constexpr StatType attributeStat(AttributeType attribute) {
+    return static_cast<StatType>(attribute);
+}
+
+} // namespace
+
 StatsComponent::StatsComponent(EntityId entityId)
     : Component<StatsComponent>(entityId)
     , m_baseMaxHP(100.0f)
@@ -15,9 +65,13 @@ StatsComponent::StatsComponent(EntityId entityId)
     , m_currentMP(50.0f)
     , m_experienceLevel(1, 100, 0)
     , m_currentExperience(0)
+    , m_dirtyStats(ALL_STATS)
     , m_baseMovementSpeed(100.0f)
     , m_baseCriticalChance(0.05f)
+    , m_verbose(true)
 {
+    m_statCache.fill(0.0f);
+    
     // Initialize default attributes
     m_baseAttributes[AttributeType::Strength] = 10;
     m_baseAttributes[AttributeType::Dexterity] = 10;
@@ -32,13 +86,13 @@ StatsComponent::~StatsComponent() {
 }
 
 float StatsComponent::getMaxHP() const {
-    float baseHP = m_baseMaxHP + (getAttribute(AttributeType::Vitality) * 5.0f);
-    return calculateModifiedStat(baseHP, "hp");
+    return getStat(StatType::MaxHP);
 }
 
 void StatsComponent::setBaseMaxHP(float maxHP) {
     float oldMaxHP = getMaxHP();
     m_baseMaxHP = std::max(1.0f, maxHP);
+    invalidateStats(statBit(StatType::MaxHP));
     
     // Adjust current HP proportionally
     if (oldMaxHP > 0.0f) {
@@ -52,13 +106,13 @@ void StatsComponent::setBaseMaxHP(float maxHP) {
 }
 
 float StatsComponent::getMaxMP() const {
-    float baseMP = m_baseMaxMP + (getAttribute(AttributeType::Intelligence) * 3.0f);
-    return calculateModifiedStat(baseMP, "mp");
+    return getStat(StatType::MaxMP);
 }
 
 void StatsComponent::setBaseMaxMP(float maxMP) {
     float oldMaxMP = getMaxMP();
     m_baseMaxMP = std::max(0.0f, maxMP);
+    invalidateStats(statBit(StatType::MaxMP));
     
     // Adjust current MP proportionally
     if (oldMaxMP > 0.0f) {
@@ -177,20 +231,7 @@ float StatsComponent::getExperiencePercentage() const {
 }
 
 int StatsComponent::getAttribute(AttributeType attribute) const {
-    int baseValue = getBaseAttribute(attribute);
-    
-    // Convert attribute type to string for modifier lookup
-    std::string attributeName;
-    switch (attribute) {
-        case AttributeType::Strength: attributeName = "strength"; break;
-        case AttributeType::Dexterity: attributeName = "dexterity"; break;
-        case AttributeType::Intelligence: attributeName = "intelligence"; break;
-        case AttributeType::Vitality: attributeName = "vitality"; break;
-        case AttributeType::Luck: attributeName = "luck"; break;
-        case AttributeType::Charisma: attributeName = "charisma"; break;
-    }
-    
-    return static_cast<int>(calculateModifiedStat(static_cast<float>(baseValue), attributeName));
+    return static_cast<int>(getStat(attributeStat(attribute)));
 }
 
 int StatsComponent::getBaseAttribute(AttributeType attribute) const {
@@ -201,6 +242,7 @@ int StatsComponent::getBaseAttribute(AttributeType attribute) const {
 void StatsComponent::setBaseAttribute(AttributeType attribute, int value) {
     int oldValue = getBaseAttribute(attribute);
     m_baseAttributes[attribute] = std::max(1, value);
+    invalidateStats(statBit(attributeStat(attribute)));
     
     if (oldValue != value) {
         // Update derived stats that depend on this attribute
@@ -225,7 +267,14 @@ void StatsComponent::modifyBaseAttribute(AttributeType attribute, int amount) {
 }
 
 void StatsComponent::addModifier(const std::string& stat, const StatModifier& modifier) {
-    auto& modifiers = m_modifiers[stat];
+    // Registered so serialize() and stat change events can name the stat
+    Utils::StringId statId = Utils::StringId::intern(stat);
+    StatModifierStack* stack = findModifierStack(statId);
+    if (!stack) {
+        m_modifiers.push_back(StatModifierStack{statId, {}});
+        stack = &m_modifiers.back();
+    }
+    auto& modifiers = stack->modifiers;
     
     // Check if modifier already exists and is not stackable
     if (!modifier.stackable) {
@@ -235,29 +284,29 @@ void StatsComponent::addModifier(const std::string& stat, const StatModifier& mo
             });
         
         if (it != modifiers.end()) {
-            // Replace existing modifier
-            *it = modifier;
-        } else {
-            modifiers.push_back(modifier);
+            // Replace existing modifier, which may now apply at another step
+            modifiers.erase(it);
         }
-    } else {
-        // Add stackable modifier
-        modifiers.push_back(modifier);
     }
+    insertModifier(modifiers, modifier);
     
+    invalidateStat(statId);
     triggerStatChange(stat);
     
-    std::cout << "Added modifier '" << modifier.id << "' to stat '" << stat 
-              << "' (value: " << modifier.value << ")" << std::endl;
+    if (m_verbose) {
+        std::cout << "Added modifier '" << modifier.id << "' to stat '" << stat 
+                  << "' (value: " << modifier.value << ")" << std::endl;
+    }
 }
 
 bool StatsComponent::removeModifier(const std::string& stat, const std::string& modifierId) {
-    auto it = m_modifiers.find(stat);
-    if (it == m_modifiers.end()) {
+    Utils::StringId statId(stat);
+    StatModifierStack* stack = findModifierStack(statId);
+    if (!stack) {
         return false;
     }
     
-    auto& modifiers = it->second;
+    auto& modifiers = stack->modifiers;
     auto modIt = std::find_if(modifiers.begin(), modifiers.end(),
         [&modifierId](const StatModifier& modifier) {
             return modifier.id == modifierId;
@@ -268,12 +317,15 @@ bool StatsComponent::removeModifier(const std::string& stat, const std::string&
         
         // Remove empty modifier list
         if (modifiers.empty()) {
-            m_modifiers.erase(it);
+            m_modifiers.erase(m_modifiers.begin() + (stack - m_modifiers.data()));
         }
         
+        invalidateStat(statId);
         triggerStatChange(stat);
         
-        std::cout << "Removed modifier '" << modifierId << "' from stat '" << stat << "'" << std::endl;
+        if (m_verbose) {
+            std::cout << "Removed modifier '" << modifierId << "' from stat '" << stat << "'" << std::endl;
+        }
         return true;
     }
     
@@ -281,10 +333,10 @@ bool StatsComponent::removeModifier(const std::string& stat, const std::string&
 }
 
 void StatsComponent::removeModifiersFromSource(const std::string& source) {
-    std::vector<std::string> statsToUpdate;
+    std::vector<Utils::StringId> statsToUpdate;
     
-    for (auto& pair : m_modifiers) {
-        auto& modifiers = pair.second;
+    for (auto& stack : m_modifiers) {
+        auto& modifiers = stack.modifiers;
         
         auto it = std::remove_if(modifiers.begin(), modifiers.end(),
             [&source](const StatModifier& modifier) {
@@ -293,42 +345,39 @@ void StatsComponent::removeModifiersFromSource(const std::string& source) {
         
         if (it != modifiers.end()) {
             modifiers.erase(it, modifiers.end());
-            statsToUpdate.push_back(pair.first);
+            statsToUpdate.push_back(stack.stat);
         }
     }
     
     // Remove empty modifier lists
-    auto mapIt = m_modifiers.begin();
-    while (mapIt != m_modifiers.end()) {
-        if (mapIt->second.empty()) {
-            mapIt = m_modifiers.erase(mapIt);
-        } else {
-            ++mapIt;
-        }
-    }
+    m_modifiers.erase(std::remove_if(m_modifiers.begin(), m_modifiers.end(),
+        [](const StatModifierStack& stack) {
+            return stack.modifiers.empty();
+        }), m_modifiers.end());
     
     // Trigger stat change events
     for (const auto& stat : statsToUpdate) {
-        triggerStatChange(stat);
+        invalidateStat(stat);
+        triggerStatChange(stat.str());
     }
     
-    if (!statsToUpdate.empty()) {
+    if (!statsToUpdate.empty() && m_verbose) {
         std::cout << "Removed all modifiers from source '" << source << "'" << std::endl;
     }
 }
 
 std::vector<StatModifier> StatsComponent::getModifiers(const std::string& stat) const {
-    auto it = m_modifiers.find(stat);
-    return (it != m_modifiers.end()) ? it->second : std::vector<StatModifier>();
+    const StatModifierStack* stack = findModifierStack(Utils::StringId(stat));
+    return stack ? stack->modifiers : std::vector<StatModifier>();
 }
 
 bool StatsComponent::hasModifier(const std::string& stat, const std::string& modifierId) const {
-    auto it = m_modifiers.find(stat);
-    if (it == m_modifiers.end()) {
+    const StatModifierStack* stack = findModifierStack(Utils::StringId(stat));
+    if (!stack) {
         return false;
     }
     
-    const auto& modifiers = it->second;
+    const auto& modifiers = stack->modifiers;
     return std::find_if(modifiers.begin(), modifiers.end(),
         [&modifierId](const StatModifier& modifier) {
             return modifier.id == modifierId;
@@ -336,10 +385,10 @@ bool StatsComponent::hasModifier(const std::string& stat, const std::string& mod
 }
 
 void StatsComponent::updateModifiers(float deltaTime) {
-    std::vector<std::string> statsToUpdate;
+    std::vector<Utils::StringId> statsToUpdate;
     
-    for (auto& pair : m_modifiers) {
-        auto& modifiers = pair.second;
+    for (auto& stack : m_modifiers) {
+        auto& modifiers = stack.modifiers;
         
         auto it = std::remove_if(modifiers.begin(), modifiers.end(),
             [deltaTime](StatModifier& modifier) {
@@ -352,64 +401,53 @@ void StatsComponent::updateModifiers(float deltaTime) {
         
         if (it != modifiers.end()) {
             modifiers.erase(it, modifiers.end());
-            statsToUpdate.push_back(pair.first);
+            statsToUpdate.push_back(stack.stat);
         }
     }
     
     // Remove empty modifier lists
-    auto mapIt = m_modifiers.begin();
-    while (mapIt != m_modifiers.end()) {
-        if (mapIt->second.empty()) {
-            mapIt = m_modifiers.erase(mapIt);
-        } else {
-            ++mapIt;
-        }
-    }
+    m_modifiers.erase(std::remove_if(m_modifiers.begin(), m_modifiers.end(),
+        [](const StatModifierStack& stack) {
+            return stack.modifiers.empty();
+        }), m_modifiers.end());
     
     // Trigger stat change events
     for (const auto& stat : statsToUpdate) {
-        triggerStatChange(stat);
+        invalidateStat(stat);
+        triggerStatChange(stat.str());
     }
 }
 
 int StatsComponent::getAttackPower() const {
-    float basePower = getAttribute(AttributeType::Strength) * 2.0f;
-    return static_cast<int>(calculateModifiedStat(basePower, "attack_power"));
+    return static_cast<int>(getStat(StatType::AttackPower));
 }
 
 int StatsComponent::getMagicPower() const {
-    float basePower = getAttribute(AttributeType::Intelligence) * 2.0f;
-    return static_cast<int>(calculateModifiedStat(basePower, "magic_power"));
+    return static_cast<int>(getStat(StatType::MagicPower));
 }
 
 int StatsComponent::getDefense() const {
-    float baseDefense = getAttribute(AttributeType::Vitality) * 1.5f;
-    return static_cast<int>(calculateModifiedStat(baseDefense, "defense"));
+    return static_cast<int>(getStat(StatType::Defense));
 }
 
 int StatsComponent::getMagicDefense() const {
-    float baseDefense = getAttribute(AttributeType::Intelligence) * 1.5f;
-    return static_cast<int>(calculateModifiedStat(baseDefense, "magic_defense"));
+    return static_cast<int>(getStat(StatType::MagicDefense));
 }
 
 int StatsComponent::getAccuracy() const {
-    float baseAccuracy = 75.0f + (getAttribute(AttributeType::Dexterity) * 2.0f);
-    return static_cast<int>(calculateModifiedStat(baseAccuracy, "accuracy"));
+    return static_cast<int>(getStat(StatType::Accuracy));
 }
 
 int StatsComponent::getEvasion() const {
-    float baseEvasion = getAttribute(AttributeType::Dexterity) * 1.5f;
-    return static_cast<int>(calculateModifiedStat(baseEvasion, "evasion"));
+    return static_cast<int>(getStat(StatType::Evasion));
 }
 
 float StatsComponent::getCriticalChance() const {
-    float baseCritical = m_baseCriticalChance + (getAttribute(AttributeType::Luck) * 0.01f);
-    return calculateModifiedStat(baseCritical, "critical_chance");
+    return getStat(StatType::CriticalChance);
 }
 
 float StatsComponent::getMovementSpeed() const {
-    float baseSpeed = m_baseMovementSpeed + (getAttribute(AttributeType::Dexterity) * 2.0f);
-    return calculateModifiedStat(baseSpeed, "movement_speed");
+    return getStat(StatType::MovementSpeed);
 }
 
 std::string StatsComponent::serialize() const {
@@ -426,9 +464,9 @@ std::string StatsComponent::serialize() const {
     oss << ",";
     
     // Serialize modifiers
-    for (const auto& statPair : m_modifiers) {
-        oss << statPair.first << ":";
-        for (const auto& modifier : statPair.second) {
+    for (const auto& stack : m_modifiers) {
+        oss << stack.stat.str() << ":";
+        for (const auto& modifier : stack.modifiers) {
             oss << modifier.id << "|" << modifier.source << "|" 
                 << static_cast<int>(modifier.type) << "|" << modifier.value << "|" 
                 << modifier.duration << "|" << (modifier.stackable ? 1 : 0) << ";";
@@ -490,6 +528,7 @@ bool StatsComponent::deserialize(const std::string& data) {
                 if (colonPos != std::string::npos) {
                     std::string statName = modifierData.substr(0, colonPos);
                     std::string modifiersStr = modifierData.substr(colonPos + 1);
+                    Utils::StringId statId = Utils::StringId::intern(statName);
                     
                     std::istringstream modStream(modifiersStr);
                     std::string modToken;
@@ -514,7 +553,12 @@ bool StatsComponent::deserialize(const std::string& data) {
                                     parts[5] == "1" // stackable
                                 );
                                 
-                                m_modifiers[statName].push_back(modifier);
+                                StatModifierStack* stack = findModifierStack(statId);
+                                if (!stack) {
+                                    m_modifiers.push_back(StatModifierStack{statId, {}});
+                                    stack = &m_modifiers.back();
+                                }
+                                insertModifier(stack->modifiers, modifier);
                             }
                         }
                     }
@@ -527,6 +571,7 @@ bool StatsComponent::deserialize(const std::string& data) {
         m_experienceLevel.experienceRequired = calculateExperienceForLevel(m_experienceLevel.level + 1) - 
                                               calculateExperienceForLevel(m_experienceLevel.level);
         
+        invalidateStats(ALL_STATS);
         return true;
     } catch (const std::exception& e) {
         std::cerr << "Failed to deserialize StatsComponent: " << e.what() << std::endl;
@@ -534,34 +579,133 @@ bool StatsComponent::deserialize(const std::string& data) {
     }
 }
 
-float StatsComponent::calculateModifiedStat(float baseStat, const std::string& stat) const {
-    auto it = m_modifiers.find(stat);
-    if (it == m_modifiers.end()) {
+float StatsComponent::refreshStat(StatType stat) const {
+    size_t index = static_cast<size_t>(stat);
+    m_statCache[index] = computeStat(stat);
+    m_dirtyStats &= ~(1u << index);
+    return m_statCache[index];
+}
+
+float StatsComponent::computeStat(StatType stat) const {
+    float base = 0.0f;
+    switch (stat) {
+        case StatType::Strength:
+        case StatType::Dexterity:
+        case StatType::Intelligence:
+        case StatType::Vitality:
+        case StatType::Luck:
+        case StatType::Charisma:
+            base = static_cast<float>(getBaseAttribute(static_cast<AttributeType>(stat)));
+            break;
+        case StatType::MaxHP:
+            base = m_baseMaxHP + (getAttribute(AttributeType::Vitality) * 5.0f);
+            break;
+        case StatType::MaxMP:
+            base = m_baseMaxMP + (getAttribute(AttributeType::Intelligence) * 3.0f);
+            break;
+        case StatType::AttackPower:
+            base = getAttribute(AttributeType::Strength) * 2.0f;
+            break;
+        case StatType::MagicPower:
+            base = getAttribute(AttributeType::Intelligence) * 2.0f;
+            break;
+        case StatType::Defense:
+            base = getAttribute(AttributeType::Vitality) * 1.5f;
+            break;
+        case StatType::MagicDefense:
+            base = getAttribute(AttributeType::Intelligence) * 1.5f;
+            break;
+        case StatType::Accuracy:
+            base = 75.0f + (getAttribute(AttributeType::Dexterity) * 2.0f);
+            break;
+        case StatType::Evasion:
+            base = getAttribute(AttributeType::Dexterity) * 1.5f;
+            break;
+        case StatType::CriticalChance:
+            base = m_baseCriticalChance + (getAttribute(AttributeType::Luck) * 0.01f);
+            break;
+        case StatType::MovementSpeed:
+            base = m_baseMovementSpeed + (getAttribute(AttributeType::Dexterity) * 2.0f);
+            break;
+        case StatType::Count:
+            return 0.0f;
+    }
+    return calculateModifiedStat(base, STAT_IDS[static_cast<size_t>(stat)]);
+}
+
+void StatsComponent::invalidateStats(uint32_t stats) {
+    uint32_t dirty = stats;
+    for (size_t i = 0; i < ATTRIBUTE_COUNT; ++i) {
+        if (stats & (1u << i)) {
+            dirty |= ATTRIBUTE_DEPENDENTS[i];
+        }
+    }
+    m_dirtyStats |= dirty;
+}
+
+void StatsComponent::invalidateStat(Utils::StringId stat) {
+    // Modifiers on stats nothing derives from need no recomputation
+    for (size_t i = 0; i < STAT_TYPE_COUNT; ++i) {
+        if (STAT_IDS[i] == stat) {
+            invalidateStats(1u << i);
+            return;
+        }
+    }
+}
+
+StatModifierStack* StatsComponent::findModifierStack(Utils::StringId stat) {
+    for (auto& stack : m_modifiers) {
+        if (stack.stat == stat) {
+            return &stack;
+        }
+    }
+    return nullptr;
+}
+
+const StatModifierStack* StatsComponent::findModifierStack(Utils::StringId stat) const {
+    for (const auto& stack : m_modifiers) {
+        if (stack.stat == stat) {
+            return &stack;
+        }
+    }
+    return nullptr;
+}
+
+void StatsComponent::insertModifier(std::vector<StatModifier>& modifiers, const StatModifier& modifier) {
+    // After every modifier applied at the same step or earlier
+    auto position = std::upper_bound(modifiers.begin(), modifiers.end(), modifier.type,
+        [](ModifierType type, const StatModifier& existing) {
+            return type < existing.type;
+        });
+    modifiers.insert(position, modifier);
+}
+
+float StatsComponent::calculateModifiedStat(float baseStat, Utils::StringId stat) const {
+    const StatModifierStack* stack = findModifierStack(stat);
+    if (!stack) {
         return baseStat;
     }
     
-    float result = baseStat;
+    const auto& modifiers = stack->modifiers;
+    size_t count = modifiers.size();
+    size_t i = 0;
     float flatBonus = 0.0f;
     float percentageMultiplier = 1.0f;
     float totalMultiplier = 1.0f;
     
-    // Apply modifiers in order: flat -> percentage -> multiplier
-    for (const auto& modifier : it->second) {
-        switch (modifier.type) {
-            case ModifierType::Flat:
-                flatBonus += modifier.value;
-                break;
-            case ModifierType::Percentage:
-                percentageMultiplier += (modifier.value / 100.0f);
-                break;
-            case ModifierType::Multiplier:
-                totalMultiplier *= modifier.value;
-                break;
-        }
+    // Modifiers are sorted in order: flat -> percentage -> multiplier
+    for (; i < count && modifiers[i].type == ModifierType::Flat; ++i) {
+        flatBonus += modifiers[i].value;
+    }
+    for (; i < count && modifiers[i].type == ModifierType::Percentage; ++i) {
+        percentageMultiplier += (modifiers[i].value / 100.0f);
+    }
+    for (; i < count; ++i) {
+        totalMultiplier *= modifiers[i].value;
     }
     
     // Apply modifiers: (base + flat) * percentage * multiplier
-    result = (result + flatBonus) * percentageMultiplier * totalMultiplier;
+    float result = (baseStat + flatBonus) * percentageMultiplier * totalMultiplier;
     
     return std::max(0.0f, result);
 }
@@ -572,13 +716,16 @@ int StatsComponent::calculateExperienceForLevel(int level) const {
 }
 
 void StatsComponent::triggerLevelUp(int oldLevel, int newLevel) {
-    std::cout << "Level up! " << oldLevel << " -> " << newLevel << std::endl;
+    if (m_verbose) {
+        std::cout << "Level up! " << oldLevel << " -> " << newLevel << std::endl;
+    }
     
     // Increase attributes on level up
     int attributeIncrease = newLevel - oldLevel;
     for (auto& pair : m_baseAttributes) {
         pair.second += attributeIncrease;
     }
+    invalidateStats(ALL_STATS);
     
     // Restore HP and MP on level up
     setCurrentHP(getMaxHP());
@@ -590,7 +737,9 @@ void StatsComponent::triggerLevelUp(int oldLevel, int newLevel) {
 }
 
 void StatsComponent::triggerDeath() {
-    std::cout << "Character has died!" << std::endl;
+    if (m_verbose) {
+        std::cout << "Character has died!" << std::endl;
+    }
     
     if (m_deathCallback) {
         m_deathCallback();
@@ -1,10 +1,13 @@
 #pragma once
 
 #include "Component.h"
+#include "../utils/StringId.h"
 #include <string>
 #include <unordered_map>
 #include <vector>
+#include <array>
 #include <functional>
+#include <cstdint>
 
 namespace RPGEngine {
 namespace Components {
@@ -21,8 +24,36 @@ enum class AttributeType {
     Charisma        // Social interactions and prices
 };
 
+/**
+ * Stat type enumeration
+ * Attributes come first, in AttributeType order, followed by the stats
+ * derived from them. Indexes the cached stat values.
+ */
+enum class StatType : uint8_t {
+    Strength,
+    Dexterity,
+    Intelligence,
+    Vitality,
+    Luck,
+    Charisma,
+    MaxHP,
+    MaxMP,
+    AttackPower,
+    MagicPower,
+    Defense,
+    MagicDefense,
+    Accuracy,
+    Evasion,
+    CriticalChance,
+    MovementSpeed,
+    Count
+};
+
+const size_t STAT_TYPE_COUNT = static_cast<size_t>(StatType::Count);
+
 /**
  * Stat modifier type
+ * Also the order modifiers are applied in.
  */
 enum class ModifierType {
     Flat,           // Flat bonus/penalty (+10 HP)
@@ -47,6 +78,16 @@ struct StatModifier {
           duration(modDuration), stackable(stack) {}
 };
 
+/**
+ * Modifiers of one stat
+ * Sorted in application order: flat, then percentage, then multiplier,
+ * each in the order added.
+ */
+struct StatModifierStack {
+    Utils::StringId stat;
+    std::vector<StatModifier> modifiers;
+};
+
 /**
  * Experience level structure
  */
@@ -62,6 +103,8 @@ struct ExperienceLevel {
 /**
  * Stats component
  * Manages character statistics, attributes, and progression
+ * Attributes and derived stats are cached and only recomputed after a base
+ * value or modifier they depend on changes.
  */
 class StatsComponent : public Component<StatsComponent> {
 public:
@@ -170,6 +213,20 @@ public:
      */
     float getMPPercentage() const;
     
+    /**
+     * Get a stat value (with modifiers)
+     * Served from the cache unless something it depends on changed.
+     * @param stat Stat type
+     * @return Stat value
+     */
+    float getStat(StatType stat) const {
+        size_t index = static_cast<size_t>(stat);
+        if (m_dirtyStats & (1u << index)) {
+            return refreshStat(stat);
+        }
+        return m_statCache[index];
+    }
+    
     // Level and experience
     
     /**
@@ -277,7 +334,7 @@ public:
     /**
      * Get modifiers for stat
      * @param stat Stat name
-     * @return Vector of modifiers
+     * @return Vector of modifiers, in application order
      */
     std::vector<StatModifier> getModifiers(const std::string& stat) const;
     
@@ -371,6 +428,12 @@ public:
         m_statChangeCallback = callback;
     }
     
+    /**
+     * Set whether modifier, level up and death messages are printed
+     * @param verbose true to print (default)
+     */
+    void setVerbose(bool verbose) { m_verbose = verbose; }
+    
     // Serialization
     
     /**
@@ -387,13 +450,54 @@ public:
     bool deserialize(const std::string& data);
     
 private:
+    /**
+     * Recompute a cached stat
+     * @param stat Stat type
+     * @return Stat value
+     */
+    float refreshStat(StatType stat) const;
+    
+    /**
+     * Compute a stat from base values and modifiers
+     * @param stat Stat type
+     * @return Stat value
+     */
+    float computeStat(StatType stat) const;
+    
+    /**
+     * Mark stats and the stats derived from them for recomputation
+     * @param stats Bit mask of stat types
+     */
+    void invalidateStats(uint32_t stats);
+    
+    /**
+     * Mark the stat a modifier applies to for recomputation
+     * @param stat Stat ID
+     */
+    void invalidateStat(Utils::StringId stat);
+    
+    /**
+     * Find the modifier stack of a stat
+     * @param stat Stat ID
+     * @return Stack, or nullptr if the stat has no modifiers
+     */
+    StatModifierStack* findModifierStack(Utils::StringId stat);
+    const StatModifierStack* findModifierStack(Utils::StringId stat) const;
+    
+    /**
+     * Insert a modifier in application order
+     * @param modifiers Stack modifiers
+     * @param modifier Modifier to insert
+     */
+    static void insertModifier(std::vector<StatModifier>& modifiers, const StatModifier& modifier);
+    
     /**
      * Calculate modified stat value
      * @param baseStat Base stat value
-     * @param stat Stat name for modifiers
+     * @param stat Stat ID for modifiers
      * @return Modified stat value
      */
-    float calculateModifiedStat(float baseStat, const std::string& stat) const;
+    float calculateModifiedStat(float baseStat, Utils::StringId stat) const;
     
     /**
      * Calculate experience required for level
@@ -433,8 +537,12 @@ private:
     // Attributes
     std::unordered_map<AttributeType, int> m_baseAttributes;
     
-    // Stat modifiers
-    std::unordered_map<std::string, std::vector<StatModifier>> m_modifiers;
+    // Stat modifiers, one stack per stat with modifiers
+    std::vector<StatModifierStack> m_modifiers;
+    
+    // Cached stat values, valid unless their bit in m_dirtyStats is set
+    mutable std::array<float, STAT_TYPE_COUNT> m_statCache;
+    mutable uint32_t m_dirtyStats;
     
     // Callbacks
     std::function<void(int, int)> m_levelUpCallback;        // (oldLevel, newLevel)
@@ -444,6 +552,7 @@ private:
     // Configuration
     float m_baseMovementSpeed;
     float m_baseCriticalChance;
+    bool m_verbose;
 };
 
 } // namespace Components
@@ -2,7 +2,6 @@
 #include <fstream>
 #include <sstream>
 #include <iostream>
-#include <sys/stat.h>
 
 namespace RPGEngine {
     namespace Core {
@@ -136,6 +135,7 @@ namespace RPGEngine {
         }
 
         ConfigurationManager::~ConfigurationManager() {
+            enableHotReloading(false);
         }
 
         bool ConfigurationManager::loadFromFile(const std::string& filePath) {
@@ -147,7 +147,11 @@ namespace RPGEngine {
 
             try {
                 file >> config_;
-                fileTimestamps_[filePath] = getFileModificationTime(filePath);
+
+                FileWatchId& watch = fileWatches_[filePath];
+                if (hotReloadingEnabled_ && watch == 0) {
+                    watch = watchFile(filePath);
+                }
                 return true;
             } catch (const nlohmann::json::exception& e) {
                 std::cerr << "JSON parsing error in " << filePath << ": " << e.what() << std::endl;
@@ -214,34 +218,44 @@ namespace RPGEngine {
             return get(path).asString(defaultValue);
         }
 
-        void ConfigurationManager::checkForChanges() {
-            if (!hotReloadingEnabled_) {
+        void ConfigurationManager::enableHotReloading(bool enable) {
+            if (enable == hotReloadingEnabled_) {
                 return;
             }
 
-            for (auto& pair : fileTimestamps_) {
-                const std::string& filePath = pair.first;
-                std::time_t& lastModified = pair.second;
-                
-                std::time_t currentModified = getFileModificationTime(filePath);
-                if (currentModified > lastModified) {
-                    std::cout << "Configuration file changed, reloading: " << filePath << std::endl;
-                    
-                    // Store old config for comparison
-                    nlohmann::json oldConfig = config_;
-                    
-                    // Reload file
-                    if (loadFromFile(filePath)) {
-                        lastModified = currentModified;
-                        
-                        // TODO: Compare configs and notify specific path changes
-                        // For now, just notify that the root changed
-                        notifyCallbacks("", ConfigValue(config_));
-                    }
+            hotReloadingEnabled_ = enable;
+            if (enable && !fileWatcher_) {
+                fileWatcher_ = std::make_shared<FileWatcher>();
+                ownsFileWatcher_ = true;
+            }
+
+            for (auto& pair : fileWatches_) {
+                if (enable) {
+                    pair.second = watchFile(pair.first);
+                } else if (pair.second != 0) {
+                    fileWatcher_->unwatch(pair.second);
+                    pair.second = 0;
                 }
             }
         }
 
+        void ConfigurationManager::setFileWatcher(std::shared_ptr<FileWatcher> watcher) {
+            bool enabled = hotReloadingEnabled_;
+            enableHotReloading(false);
+            fileWatcher_ = watcher;
+            ownsFileWatcher_ = false;
+            enableHotReloading(enabled);
+        }
+
+        void ConfigurationManager::checkForChanges() {
+            if (!hotReloadingEnabled_ || !ownsFileWatcher_) {
+                return;
+            }
+
+            // Changed files are reloaded from the watcher callbacks
+            fileWatcher_->update();
+        }
+
         void ConfigurationManager::addChangeCallback(const std::string& path, ConfigChangeCallback callback) {
             changeCallbacks_[path].push_back(callback);
         }
@@ -264,7 +278,12 @@ namespace RPGEngine {
 
         void ConfigurationManager::clear() {
             config_.clear();
-            fileTimestamps_.clear();
+            for (const auto& pair : fileWatches_) {
+                if (pair.second != 0) {
+                    fileWatcher_->unwatch(pair.second);
+                }
+            }
+            fileWatches_.clear();
             changeCallbacks_.clear();
         }
 
@@ -370,12 +389,16 @@ namespace RPGEngine {
             return parts;
         }
 
-        std::time_t ConfigurationManager::getFileModificationTime(const std::string& filename) const {
-            struct stat fileInfo;
-            if (stat(filename.c_str(), &fileInfo) == 0) {
-                return fileInfo.st_mtime;
-            }
-            return 0;
+        FileWatchId ConfigurationManager::watchFile(const std::string& filePath) {
+            return fileWatcher_->watch(filePath, [this](const std::string& path) {
+                std::cout << "Configuration file changed, reloading: " << path << std::endl;
+
+                // TODO: Compare configs and notify specific path changes
+                // For now, just notify that the root changed
+                if (loadFromFile(path)) {
+                    notifyCallbacks("", ConfigValue(config_));
+                }
+            });
         }
 
         void ConfigurationManager::notifyCallbacks(const std::string& path, const ConfigValue& newValue) {
@@ -6,6 +6,7 @@
 #include <functional>
 #include <vector>
 #include <nlohmann/json.hpp>
+#include "FileWatcher.h"
 
 namespace RPGEngine {
     namespace Core {
@@ -95,9 +96,10 @@ namespace RPGEngine {
             float getFloat(const std::string& path, float defaultValue = 0.0f) const;
             std::string getString(const std::string& path, const std::string& defaultValue = "") const;
 
-            // Hot reloading
-            void enableHotReloading(bool enable) { hotReloadingEnabled_ = enable; }
+            // Hot reloading (loaded files reload when they change)
+            void enableHotReloading(bool enable);
             bool isHotReloadingEnabled() const { return hotReloadingEnabled_; }
+            void setFileWatcher(std::shared_ptr<FileWatcher> watcher);
             void checkForChanges();
 
             // Change notifications
@@ -116,7 +118,9 @@ namespace RPGEngine {
 
         private:
             nlohmann::json config_;
-            std::unordered_map<std::string, std::time_t> fileTimestamps_;
+            std::unordered_map<std::string, FileWatchId> fileWatches_;    // 0 = not watched
+            std::shared_ptr<FileWatcher> fileWatcher_;
+            bool ownsFileWatcher_ = false;
             std::unordered_map<std::string, std::vector<ConfigChangeCallback>> changeCallbacks_;
             bool hotReloadingEnabled_;
 
@@ -126,7 +130,7 @@ namespace RPGEngine {
             bool hasValueAtPath(const nlohmann::json& json, const std::string& path) const;
             void removeValueAtPath(nlohmann::json& json, const std::string& path);
             std::vector<std::string> splitPath(const std::string& path) const;
-            std::time_t getFileModificationTime(const std::string& filename) const;
+            FileWatchId watchFile(const std::string& filePath);
             void notifyCallbacks(const std::string& path, const ConfigValue& newValue);
         };
 
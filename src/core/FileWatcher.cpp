@@ -0,0 +1,287 @@
+#include "FileWatcher.h"
+#include <iostream>
+#include <filesystem>
+#include <algorithm>
+
+#if defined(__linux__)
+#define RPG_HAS_INOTIFY 1
+#include <sys/inotify.h>
+#include <unistd.h>
+#include <cerrno>
+#endif
+
+namespace RPGEngine {
+namespace Core {
+
+FileWatcher::FileWatcher(FileWatchBackend backend)
+    : m_backend(FileWatchBackend::Polling)
+    , m_inotify(-1)
+    , m_debounce(100)
+    , m_pollInterval(500)
+    , m_lastPoll(Clock::now())
+    , m_nextId(1)
+{
+#ifdef RPG_HAS_INOTIFY
+    if (backend == FileWatchBackend::Inotify) {
+        m_inotify = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+        if (m_inotify >= 0) {
+            m_backend = FileWatchBackend::Inotify;
+        } else {
+            std::cout << "inotify unavailable, polling watched files" << std::endl;
+        }
+    }
+#else
+    (void)backend;
+#endif
+}
+
+FileWatcher::~FileWatcher() {
+#ifdef RPG_HAS_INOTIFY
+    if (m_inotify >= 0) {
+        close(m_inotify);
+    }
+#endif
+}
+
+FileWatchId FileWatcher::watch(const std::string& path, FileChangeCallback callback) {
+    std::string key = makeKey(path);
+    FileWatchId id = m_nextId++;
+    m_watches[id] = {key, path, std::move(callback)};
+
+    auto it = m_files.find(key);
+    if (it == m_files.end()) {
+        WatchedFile file;
+        readSignature(key, file.modified, file.size);
+        file.directory = watchDirectory(key);
+        it = m_files.emplace(key, std::move(file)).first;
+    }
+    it->second.watches.push_back(id);
+
+    return id;
+}
+
+bool FileWatcher::unwatch(FileWatchId id) {
+    auto watchIt = m_watches.find(id);
+    if (watchIt == m_watches.end()) {
+        return false;
+    }
+
+    auto fileIt = m_files.find(watchIt->second.key);
+    if (fileIt != m_files.end()) {
+        auto& watches = fileIt->second.watches;
+        watches.erase(std::remove(watches.begin(), watches.end(), id), watches.end());
+        if (watches.empty()) {
+            if (fileIt->second.directory >= 0) {
+                releaseDirectory(fileIt->second.directory);
+            }
+            m_files.erase(fileIt);
+        }
+    }
+
+    m_watches.erase(watchIt);
+    return true;
+}
+
+void FileWatcher::unwatchAll() {
+    while (!m_watches.empty()) {
+        unwatch(m_watches.begin()->first);
+    }
+}
+
+void FileWatcher::update() {
+    if (m_inotify >= 0) {
+        readEvents();
+    }
+    pollFiles();
+
+    // Dispatch files that have been quiet for the debounce time
+    Clock::time_point now = Clock::now();
+    std::vector<FileWatchId> ready;
+    for (auto& pair : m_files) {
+        WatchedFile& file = pair.second;
+        if (file.pending && now - file.lastEvent >= m_debounce) {
+            file.pending = false;
+            ready.insert(ready.end(), file.watches.begin(), file.watches.end());
+            m_stats.dispatches++;
+        }
+    }
+
+    // Callbacks may unwatch, so look each watch up again
+    for (FileWatchId id : ready) {
+        auto it = m_watches.find(id);
+        if (it != m_watches.end()) {
+            FileChangeCallback callback = it->second.callback;
+            std::string path = it->second.path;
+            callback(path);
+        }
+    }
+}
+
+const char* FileWatcher::getBackendName() const {
+    return m_backend == FileWatchBackend::Inotify ? "inotify" : "polling";
+}
+
+std::string FileWatcher::makeKey(const std::string& path) {
+    std::error_code error;
+    std::filesystem::path absolute = std::filesystem::absolute(path, error);
+    if (error) {
+        return path;
+    }
+    return absolute.lexically_normal().string();
+}
+
+void FileWatcher::readSignature(const std::string& key, int64_t& modified, int64_t& size) {
+    std::error_code error;
+    auto time = std::filesystem::last_write_time(key, error);
+    if (error) {
+        modified = 0;
+        size = -1;
+        return;
+    }
+
+    modified = static_cast<int64_t>(time.time_since_epoch().count());
+    auto bytes = std::filesystem::file_size(key, error);
+    size = error ? -1 : static_cast<int64_t>(bytes);
+}
+
+int FileWatcher::watchDirectory(const std::string& key) {
+#ifdef RPG_HAS_INOTIFY
+    if (m_inotify < 0) {
+        return -1;
+    }
+
+    std::string directory = std::filesystem::path(key).parent_path().string();
+    auto existing = m_directoriesByPath.find(directory);
+    if (existing != m_directoriesByPath.end()) {
+        m_directories[existing->second].files++;
+        return existing->second;
+    }
+
+    // Editors save in place (close after write) or through a rename
+    int descriptor = inotify_add_watch(m_inotify, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO);
+    if (descriptor < 0) {
+        return -1;
+    }
+
+    // The same directory reached through another path shares the descriptor
+    WatchedDirectory& watched = m_directories[descriptor];
+    if (watched.files == 0) {
+        watched.path = directory;
+    }
+    watched.files++;
+    m_directoriesByPath[directory] = descriptor;
+    return descriptor;
+#else
+    (void)key;
+    return -1;
+#endif
+}
+
+void FileWatcher::releaseDirectory(int descriptor) {
+    auto it = m_directories.find(descriptor);
+    if (it == m_directories.end() || --it->second.files > 0) {
+        return;
+    }
+
+#ifdef RPG_HAS_INOTIFY
+    inotify_rm_watch(m_inotify, descriptor);
+#endif
+    for (auto pathIt = m_directoriesByPath.begin(); pathIt != m_directoriesByPath.end();) {
+        pathIt = pathIt->second == descriptor ? m_directoriesByPath.erase(pathIt) : std::next(pathIt);
+    }
+    m_directories.erase(it);
+}
+
+void FileWatcher::readEvents() {
+#ifdef RPG_HAS_INOTIFY
+    alignas(struct inotify_event) char buffer[4096];
+    Clock::time_point now = Clock::now();
+
+    while (true) {
+        ssize_t length = read(m_inotify, buffer, sizeof(buffer));
+        if (length <= 0) {
+            if (length < 0 && errno == EINTR) {
+                continue;
+            }
+            break;
+        }
+
+        for (ssize_t offset = 0; offset < length;) {
+            const auto* event = reinterpret_cast<const struct inotify_event*>(buffer + offset);
+            offset += sizeof(struct inotify_event) + event->len;
+
+            if (event->mask & IN_Q_OVERFLOW) {
+                // Events were dropped; treat every file as changed
+                for (auto& pair : m_files) {
+                    markChanged(pair.second, now);
+                }
+                continue;
+            }
+
+            auto dirIt = m_directories.find(event->wd);
+            if (dirIt == m_directories.end()) {
+                continue;
+            }
+
+            if (event->mask & IN_IGNORED) {
+                // Directory removed or unmounted; poll its files from now on
+                for (auto& pair : m_files) {
+                    if (pair.second.directory == event->wd) {
+                        pair.second.directory = -1;
+                    }
+                }
+                for (auto pathIt = m_directoriesByPath.begin(); pathIt != m_directoriesByPath.end();) {
+                    pathIt = pathIt->second == event->wd ? m_directoriesByPath.erase(pathIt) : std::next(pathIt);
+                }
+                m_directories.erase(dirIt);
+                continue;
+            }
+
+            if (event->len == 0) {
+                continue;
+            }
+
+            std::filesystem::path file = std::filesystem::path(dirIt->second.path) / event->name;
+            auto fileIt = m_files.find(file.string());
+            if (fileIt != m_files.end()) {
+                markChanged(fileIt->second, now);
+            }
+        }
+    }
+#endif
+}
+
+void FileWatcher::pollFiles() {
+    Clock::time_point now = Clock::now();
+    if (now - m_lastPoll < m_pollInterval) {
+        return;
+    }
+    m_lastPoll = now;
+
+    for (auto& pair : m_files) {
+        WatchedFile& file = pair.second;
+        if (file.directory >= 0) {
+            continue;
+        }
+
+        int64_t modified = 0;
+        int64_t size = -1;
+        readSignature(pair.first, modified, size);
+        m_stats.polls++;
+
+        if (modified != file.modified || size != file.size) {
+            file.modified = modified;
+            file.size = size;
+            markChanged(file, now);
+        }
+    }
+}
+
+void FileWatcher::markChanged(WatchedFile& file, Clock::time_point now) {
+    m_stats.events++;
+    file.pending = true;
+    file.lastEvent = now;
+}
+
+} // namespace Core
+} // namespace RPGEngine
@@ -0,0 +1,239 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <functional>
+#include <chrono>
+#include <cstdint>
+
+namespace RPGEngine {
+namespace Core {
+
+/**
+ * File change callback function type
+ * Receives the path as it was passed to FileWatcher::watch().
+ */
+using FileChangeCallback = std::function<void(const std::string& path)>;
+
+/**
+ * File watch identifier (0 = none)
+ */
+using FileWatchId = uint64_t;
+
+/**
+ * How a file watcher detects changes
+ */
+enum class FileWatchBackend {
+    Inotify,    // Kernel notifications (Linux); a non-blocking read per update
+    Polling     // Modification time and size, checked every poll interval
+};
+
+/**
+ * File watcher statistics
+ */
+struct FileWatcherStats {
+    uint64_t events = 0;        // Change notifications or detected changes, before debouncing
+    uint64_t dispatches = 0;    // Debounced changes delivered to callbacks
+    uint64_t polls = 0;         // Files checked by the polling backend
+};
+
+/**
+ * File watch service for hot reloading
+ *
+ * Watches files and calls their callbacks from update(), on the calling
+ * thread, once a file has stopped changing for the debounce time. Editors
+ * often save in several writes or through a rename; debouncing turns that
+ * into a single reload.
+ *
+ * On Linux, inotify watches each file's directory, so update() costs one
+ * non-blocking read when nothing changed. Elsewhere, or for files whose
+ * directory can't be watched, files are polled every poll interval rather
+ * than every frame.
+ *
+ * Not thread-safe: watch, unwatch and update from the same thread.
+ * Callbacks may watch and unwatch files.
+ *
+ * One watcher can be shared through the setFileWatcher() of each hot
+ * reloading system. ResourceManager::update() then updates it once per
+ * frame for all of them; systems only update watchers they created
+ * themselves. Every system unwatches its files when it is destroyed, so a
+ * shared watcher never calls back into a destroyed system.
+ */
+class FileWatcher {
+public:
+    /**
+     * Constructor
+     * @param backend Preferred backend (falls back to polling if inotify is unavailable)
+     */
+    explicit FileWatcher(FileWatchBackend backend = FileWatchBackend::Inotify);
+
+    /**
+     * Destructor
+     */
+    ~FileWatcher();
+
+    FileWatcher(const FileWatcher&) = delete;
+    FileWatcher& operator=(const FileWatcher&) = delete;
+
+    /**
+     * Watch a file
+     * The file doesn't have to exist yet; creating it counts as a change.
+     * @param path File path
+     * @param callback Called with path after the file changes
+     * @return Watch ID
+     */
+    FileWatchId watch(const std::string& path, FileChangeCallback callback);
+
+    /**
+     * Stop watching
+     * @param id Watch ID
+     * @return true if the watch existed
+     */
+    bool unwatch(FileWatchId id);
+
+    /**
+     * Stop all watches
+     */
+    void unwatchAll();
+
+    /**
+     * Collect changes and call callbacks of files that have settled
+     */
+    void update();
+
+    /**
+     * Set how long a file must be unchanged before its callbacks run
+     * @param debounce Debounce time
+     */
+    void setDebounce(std::chrono::milliseconds debounce) { m_debounce = debounce; }
+
+    /**
+     * Get the debounce time
+     * @return Debounce time
+     */
+    std::chrono::milliseconds getDebounce() const { return m_debounce; }
+
+    /**
+     * Set how often the polling backend checks files
+     * @param interval Poll interval
+     */
+    void setPollInterval(std::chrono::milliseconds interval) { m_pollInterval = interval; }
+
+    /**
+     * Get the backend in use
+     * @return Backend
+     */
+    FileWatchBackend getBackend() const { return m_backend; }
+
+    /**
+     * Get the name of the backend in use
+     * @return Backend name
+     */
+    const char* getBackendName() const;
+
+    /**
+     * Get the number of watches
+     * @return Watch count
+     */
+    size_t getWatchCount() const { return m_watches.size(); }
+
+    /**
+     * Get statistics
+     * @return Statistics
+     */
+    const FileWatcherStats& getStats() const { return m_stats; }
+
+private:
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * Watch registration
+     */
+    struct Watch {
+        std::string key;
+        std::string path;
+        FileChangeCallback callback;
+    };
+
+    /**
+     * Watched file (shared by all watches of the same file)
+     */
+    struct WatchedFile {
+        std::vector<FileWatchId> watches;
+        int directory = -1;             // inotify watch descriptor, -1 if polled
+        int64_t modified = 0;           // Polling signature
+        int64_t size = -1;
+        bool pending = false;
+        Clock::time_point lastEvent;
+    };
+
+    /**
+     * Watched directory (inotify)
+     */
+    struct WatchedDirectory {
+        std::string path;
+        size_t files = 0;
+    };
+
+    /**
+     * Make the lookup key of a path
+     * @param path File path
+     * @return Absolute, normalized path
+     */
+    static std::string makeKey(const std::string& path);
+
+    /**
+     * Read a file's polling signature
+     * @param key File key
+     * @param modified Receives the modification time
+     * @param size Receives the size (-1 if missing)
+     */
+    static void readSignature(const std::string& key, int64_t& modified, int64_t& size);
+
+    /**
+     * Start watching a file's directory
+     * @param key File key
+     * @return Watch descriptor, or -1 to poll the file
+     */
+    int watchDirectory(const std::string& key);
+
+    /**
+     * Release a directory watch
+     * @param descriptor Watch descriptor
+     */
+    void releaseDirectory(int descriptor);
+
+    /**
+     * Read pending inotify events
+     */
+    void readEvents();
+
+    /**
+     * Check polled files if the poll interval has passed
+     */
+    void pollFiles();
+
+    /**
+     * Record a change
+     * @param file Watched file
+     * @param now Current time
+     */
+    void markChanged(WatchedFile& file, Clock::time_point now);
+
+    FileWatchBackend m_backend;
+    int m_inotify;
+    std::chrono::milliseconds m_debounce;
+    std::chrono::milliseconds m_pollInterval;
+    Clock::time_point m_lastPoll;
+
+    std::unordered_map<FileWatchId, Watch> m_watches;
+    std::unordered_map<std::string, WatchedFile> m_files;
+    std::unordered_map<int, WatchedDirectory> m_directories;
+    std::unordered_map<std::string, int> m_directoriesByPath;
+    FileWatchId m_nextId;
+    FileWatcherStats m_stats;
+};
+
+} // namespace Core
+} // namespace RPGEngine
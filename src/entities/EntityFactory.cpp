@@ -5,7 +5,6 @@
 #include "../components/InventoryComponent.h"
 #include <fstream>
 #include <iostream>
-#include <sys/stat.h>
 
 namespace RPGEngine {
     namespace Entities {
@@ -34,6 +33,10 @@ namespace RPGEngine {
             setupDefaultComponentFactories();
         }
 
+        EntityFactory::~EntityFactory() {
+            enableHotReloading(false);
+        }
+
         void EntityFactory::loadTemplatesFromFile(const std::string& filePath) {
             Core::ConfigurationManager config;
             if (!config.loadFromFile(filePath)) {
@@ -42,7 +45,11 @@ namespace RPGEngine {
             }
 
             loadTemplatesFromConfig(config);
-            templateFileTimestamps_[filePath] = getFileModificationTime(filePath);
+
+            Core::FileWatchId& watch = templateFileWatches_[filePath];
+            if (hotReloadingEnabled_ && watch == 0) {
+                watch = watchTemplateFile(filePath);
+            }
         }
 
         void EntityFactory::loadTemplatesFromConfig(const Core::ConfigurationManager& config) {
@@ -180,24 +187,44 @@ namespace RPGEngine {
             return true;
         }
 
-        void EntityFactory::checkForTemplateChanges() {
-            if (!hotReloadingEnabled_) {
+        void EntityFactory::enableHotReloading(bool enable) {
+            if (enable == hotReloadingEnabled_) {
                 return;
             }
 
-            for (auto& pair : templateFileTimestamps_) {
-                const std::string& filePath = pair.first;
-                std::time_t& lastModified = pair.second;
-                
-                std::time_t currentModified = getFileModificationTime(filePath);
-                if (currentModified > lastModified) {
-                    std::cout << "Entity template file changed, reloading: " << filePath << std::endl;
-                    loadTemplatesFromFile(filePath);
-                    lastModified = currentModified;
+            hotReloadingEnabled_ = enable;
+            if (enable && !fileWatcher_) {
+                fileWatcher_ = std::make_shared<Core::FileWatcher>();
+                ownsFileWatcher_ = true;
+            }
+
+            for (auto& pair : templateFileWatches_) {
+                if (enable) {
+                    pair.second = watchTemplateFile(pair.first);
+                } else if (pair.second != 0) {
+                    fileWatcher_->unwatch(pair.second);
+                    pair.second = 0;
                 }
             }
         }
 
+        void EntityFactory::setFileWatcher(std::shared_ptr<Core::FileWatcher> watcher) {
+            bool enabled = hotReloadingEnabled_;
+            enableHotReloading(false);
+            fileWatcher_ = watcher;
+            ownsFileWatcher_ = false;
+            enableHotReloading(enabled);
+        }
+
+        void EntityFactory::checkForTemplateChanges() {
+            if (!hotReloadingEnabled_ || !ownsFileWatcher_) {
+                return;
+            }
+
+            // Changed files are reloaded from the watcher callbacks
+            fileWatcher_->update();
+        }
+
         void* EntityFactory::createComponent(const std::string& componentType, 
                                     Components::EntityId entityId, 
                                     const Core::ConfigValue& config) {
@@ -290,12 +317,11 @@ namespace RPGEngine {
             });
         }
 
-        std::time_t EntityFactory::getFileModificationTime(const std::string& filename) const {
-            struct stat fileInfo;
-            if (stat(filename.c_str(), &fileInfo) == 0) {
-                return fileInfo.st_mtime;
-            }
-            return 0;
+        Core::FileWatchId EntityFactory::watchTemplateFile(const std::string& filePath) {
+            return fileWatcher_->watch(filePath, [this](const std::string& path) {
+                std::cout << "Entity template file changed, reloading: " << path << std::endl;
+                loadTemplatesFromFile(path);
+            });
         }
 
     } // namespace Entities
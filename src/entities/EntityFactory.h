@@ -3,12 +3,12 @@
 #include "Entity.h"
 #include "EntityManager.h"
 #include "../core/ConfigurationManager.h"
+#include "../core/FileWatcher.h"
 #include "../components/Component.h"
 #include <memory>
 #include <functional>
 #include <unordered_map>
 #include <string>
-#include <ctime>
 
 namespace RPGEngine {
     namespace Entities {
@@ -36,7 +36,7 @@ namespace RPGEngine {
         class EntityFactory {
         public:
             EntityFactory(std::shared_ptr<EntityManager> entityManager);
-            ~EntityFactory() = default;
+            ~EntityFactory();
 
             // Template management
             void loadTemplatesFromFile(const std::string& filePath);
@@ -62,15 +62,18 @@ namespace RPGEngine {
             Core::ConfigValue serializeEntity(RPGEngine::EntityId entityId) const;
             bool deserializeEntity(RPGEngine::EntityId entityId, const Core::ConfigValue& config);
 
-            // Hot reloading support
-            void enableHotReloading(bool enable) { hotReloadingEnabled_ = enable; }
+            // Hot reloading support (template files reload when they change)
+            void enableHotReloading(bool enable);
+            void setFileWatcher(std::shared_ptr<Core::FileWatcher> watcher);
             void checkForTemplateChanges();
 
         private:
             std::shared_ptr<EntityManager> entityManager_;
             std::unordered_map<std::string, EntityTemplate> templates_;
             std::unordered_map<std::string, ComponentFactory> componentFactories_;
-            std::unordered_map<std::string, std::time_t> templateFileTimestamps_;
+            std::unordered_map<std::string, Core::FileWatchId> templateFileWatches_; // 0 = not watched
+            std::shared_ptr<Core::FileWatcher> fileWatcher_;
+            bool ownsFileWatcher_ = false;
             bool hotReloadingEnabled_ = false;
 
             // Helper methods
@@ -78,7 +81,7 @@ namespace RPGEngine {
                                 RPGEngine::EntityId entityId, 
                                 const Core::ConfigValue& config);
             void setupDefaultComponentFactories();
-            std::time_t getFileModificationTime(const std::string& filename) const;
+            Core::FileWatchId watchTemplateFile(const std::string& filePath);
         };
 
     } // namespace Entities
@@ -0,0 +1,448 @@
+#include "Font.h"
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+namespace RPGEngine {
+namespace Graphics {
+
+namespace {
+
+/**
+ * Built-in 8x8 bitmap font (public domain font8x8_basic), one byte per row,
+ * bit 0 is the leftmost pixel
+ */
+const uint8_t DEFAULT_FONT_ASCII[95][8] = {
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // ' '
+    { 0x18, 0x3C, 0x3C, 0x18, 0x18, 0x00, 0x18, 0x00 }, // '!'
+    { 0x36, 0x36, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }, // '"'
+    { 0x36, 0x36, 0x7F, 0x36, 0x7F, 0x36, 0x36, 0x00 }, // '#'
+    { 0x0C, 0x3E, 0x03, 0x1E, 0x30, 0x1F, 0x0C, 0x00 }, // '$'
+    { 0x00, 0x63, 0x33, 0x18, 0x0C, 0x66, 0x63, 0x00 }, // '%'
+    { 0x1C, 0x36, 0x1C, 0x6E, 0x3B, 0x33, 0x6E, 0x00 }, // '&'
+    { 0x06, 0x06, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00 }, // '''
+    { 0x18, 0x0C, 0x06, 0x06, 0x06, 0x0C, 0x18, 0x00 }, // '('
+    { 0x06, 0x0C, 0x18, 0x18, 0x18, 0x0C, 0x06, 0x00 }, // ')'
+    { 0x00, 0x66, 0x3C, 0xFF, 0x3C, 0x66, 0x00, 0x00 }, // '*'
+    { 0x00, 0x0C, 0x0C, 0x3F, 0x0C, 0x0C, 0x00, 0x00 }, // '+'
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C, 0x06 }, // ','
+    { 0x00, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x00, 0x00 }, // '-'
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x0C, 0x00 }, // '.'
+    { 0x60, 0x30, 0x18, 0x0C, 0x06, 0x03, 0x01, 0x00 }, // '/'
+    { 0x3E, 0x63, 0x73, 0x7B, 0x6F, 0x67, 0x3E, 0x00 }, // '0'
+    { 0x0C, 0x0E, 0x0C, 0x0C, 0x0C, 0x0C, 0x3F, 0x00 }, // '1'
+    { 0x1E, 0x33, 0x30, 0x1C, 0x06, 0x33, 0x3F, 0x00 }, // '2'
+    { 0x1E, 0x33, 0x30, 0x1C, 0x30, 0x33, 0x1E, 0x00 }, // '3'
+    { 0x38, 0x3C, 0x36, 0x33, 0x7F, 0x30, 0x78, 0x00 }, // '4'
+    { 0x3F, 0x03, 0x1F, 0x30, 0x30, 0x33, 0x1E, 0x00 }, // '5'
+    { 0x1C, 0x06, 0x03, 0x1F, 0x33, 0x33, 0x1E, 0x00 }, // '6'
+    { 0x3F, 0x33, 0x30, 0x18, 0x0C, 0x0C, 0x0C, 0x00 }, // '7'
+    { 0x1E, 0x33, 0x33, 0x1E, 0x33, 0x33, 0x1E, 0x00 }, // '8'
+    { 0x1E, 0x33, 0x33, 0x3E, 0x30, 0x18, 0x0E, 0x00 }, // '9'
+    { 0x00, 0x0C, 0x0C, 0x00, 0x00, 0x0C, 0x0C, 0x00 }, // ':'
+    { 0x00, 0x0C, 0x0C, 0x00, 0x00, 0x0C, 0x0C, 0x06 }, // ';'
+    { 0x18, 0x0C, 0x06, 0x03, 0x06, 0x0C, 0x18, 0x00 }, // '<'
+    { 0x00, 0x00, 0x3F, 0x00, 0x00, 0x3F, 0x00, 0x00 }, // '='
+    { 0x06, 0x0C, 0x18, 0x30, 0x18, 0x0C, 0x06, 0x00 }, // '>'
+    { 0x1E, 0x33, 0x30, 0x18, 0x0C, 0x00, 0x0C, 0x00 }, // '?'
+    { 0x3E, 0x63, 0x7B, 0x7B, 0x7B, 0x03, 0x1E, 0x00 }, // '@'
+    { 0x0C, 0x1E, 0x33, 0x33, 0x3F, 0x33, 0x33, 0x00 }, // 'A'
+    { 0x3F, 0x66, 0x66, 0x3E, 0x66, 0x66, 0x3F, 0x00 }, // 'B'
+    { 0x3C, 0x66, 0x03, 0x03, 0x03, 0x66, 0x3C, 0x00 }, // 'C'
+    { 0x1F, 0x36, 0x66, 0x66, 0x66, 0x36, 0x1F, 0x00 }, // 'D'
+    { 0x7F, 0x46, 0x16, 0x1E, 0x16, 0x46, 0x7F, 0x00 }, // 'E'
+    { 0x7F, 0x46, 0x16, 0x1E, 0x16, 0x06, 0x0F, 0x00 }, // 'F'
+    { 0x3C, 0x66, 0x03, 0x03, 0x73, 0x66, 0x7C, 0x00 }, // 'G'
+    { 0x33, 0x33, 0x33, 0x3F, 0x33, 0x33, 0x33, 0x00 }, // 'H'
+    { 0x1E, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x1E, 0x00 }, // 'I'
+    { 0x78, 0x30, 0x30, 0x30, 0x33, 0x33, 0x1E, 0x00 }, // 'J'
+    { 0x67, 0x66, 0x36, 0x1E, 0x36, 0x66, 0x67, 0x00 }, // 'K'
+    { 0x0F, 0x06, 0x06, 0x06, 0x46, 0x66, 0x7F, 0x00 }, // 'L'
+    { 0x63, 0x77, 0x7F, 0x7F, 0x6B, 0x63, 0x63, 0x00 }, // 'M'
+    { 0x63, 0x67, 0x6F, 0x7B, 0x73, 0x63, 0x63, 0x00 }, // 'N'
+    { 0x1C, 0x36, 0x63, 0x63, 0x63, 0x36, 0x1C, 0x00 }, // 'O'
+    { 0x3F, 0x66, 0x66, 0x3E, 0x06, 0x06, 0x0F, 0x00 }, // 'P'
+    { 0x1E, 0x33, 0x33, 0x33, 0x3B, 0x1E, 0x38, 0x00 }, // 'Q'
+    { 0x3F, 0x66, 0x66, 0x3E, 0x36, 0x66, 0x67, 0x00 }, // 'R'
+    { 0x1E, 0x33, 0x07, 0x0E, 0x38, 0x33, 0x1E, 0x00 }, // 'S'
+    { 0x3F, 0x2D, 0x0C, 0x0C, 0x0C, 0x0C, 0x1E, 0x00 }, // 'T'
+    { 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x3F, 0x00 }, // 'U'
+    { 0x33, 0x33, 0x33, 0x33, 0x33, 0x1E, 0x0C, 0x00 }, // 'V'
+    { 0x63, 0x63, 0x63, 0x6B, 0x7F, 0x77, 0x63, 0x00 }, // 'W'
+    { 0x63, 0x63, 0x36, 0x1C, 0x1C, 0x36, 0x63, 0x00 }, // 'X'
+    { 0x33, 0x33, 0x33, 0x1E, 0x0C, 0x0C, 0x1E, 0x00 }, // 'Y'
+    { 0x7F, 0x63, 0x31, 0x18, 0x4C, 0x66, 0x7F, 0x00 }, // 'Z'
+    { 0x1E, 0x06, 0x06, 0x06, 0x06, 0x06, 0x1E, 0x00 }, // '['
+    { 0x03, 0x06, 0x0C, 0x18, 0x30, 0x60, 0x40, 0x00 }, // '\'
+    { 0x1E, 0x18, 0x18, 0x18, 0x18, 0x18, 0x1E, 0x00 }, // ']'
+    { 0x08, 0x1C, 0x36, 0x63, 0x00, 0x00, 0x00, 0x00 }, // '^'
+    { 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF }, // '_'
+    { 0x0C, 0x0C, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00 }, // '`'
+    { 0x00, 0x00, 0x1E, 0x30, 0x3E, 0x33, 0x6E, 0x00 }, // 'a'
+    { 0x07, 0x06, 0x06, 0x3E, 0x66, 0x66, 0x3B, 0x00 }, // 'b'
+    { 0x00, 0x00, 0x1E, 0x33, 0x03, 0x33, 0x1E, 0x00 }, // 'c'
+    { 0x38, 0x30, 0x30, 0x3E, 0x33, 0x33, 0x6E, 0x00 }, // 'd'
+    { 0x00, 0x00, 0x1E, 0x33, 0x3F, 0x03, 0x1E, 0x00 }, // 'e'
+    { 0x1C, 0x36, 0x06, 0x0F, 0x06, 0x06, 0x0F, 0x00 }, // 'f'
+    { 0x00, 0x00, 0x6E, 0x33, 0x33, 0x3E, 0x30, 0x1F }, // 'g'
+    { 0x07, 0x06, 0x36, 0x6E, 0x66, 0x66, 0x67, 0x00 }, // 'h'
+    { 0x0C, 0x00, 0x0E, 0x0C, 0x0C, 0x0C, 0x1E, 0x00 }, // 'i'
+    { 0x30, 0x00, 0x30, 0x30, 0x30, 0x33, 0x33, 0x1E }, // 'j'
+    { 0x07, 0x06, 0x66, 0x36, 0x1E, 0x36, 0x67, 0x00 }, // 'k'
+    { 0x0E, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x1E, 0x00 }, // 'l'
+    { 0x00, 0x00, 0x33, 0x7F, 0x7F, 0x6B, 0x63, 0x00 }, // 'm'
+    { 0x00, 0x00, 0x1F, 0x33, 0x33, 0x33, 0x33, 0x00 }, // 'n'
+    { 0x00, 0x00, 0x1E, 0x33, 0x33, 0x33, 0x1E, 0x00 }, // 'o'
+    { 0x00, 0x00, 0x3B, 0x66, 0x66, 0x3E, 0x06, 0x0F }, // 'p'
+    { 0x00, 0x00, 0x6E, 0x33, 0x33, 0x3E, 0x30, 0x78 }, // 'q'
+    { 0x00, 0x00, 0x3B, 0x6E, 0x66, 0x06, 0x0F, 0x00 }, // 'r'
+    { 0x00, 0x00, 0x3E, 0x03, 0x1E, 0x30, 0x1F, 0x00 }, // 's'
+    { 0x08, 0x0C, 0x3E, 0x0C, 0x0C, 0x2C, 0x18, 0x00 }, // 't'
+    { 0x00, 0x00, 0x33, 0x33, 0x33, 0x33, 0x6E, 0x00 }, // 'u'
+    { 0x00, 0x00, 0x33, 0x33, 0x33, 0x1E, 0x0C, 0x00 }, // 'v'
+    { 0x00, 0x00, 0x63, 0x6B, 0x7F, 0x7F, 0x36, 0x00 }, // 'w'
+    { 0x00, 0x00, 0x63, 0x36, 0x1C, 0x36, 0x63, 0x00 }, // 'x'
+    { 0x00, 0x00, 0x33, 0x33, 0x33, 0x3E, 0x30, 0x1F }, // 'y'
+    { 0x00, 0x00, 0x3F, 0x19, 0x0C, 0x26, 0x3F, 0x00 }, // 'z'
+    { 0x38, 0x0C, 0x0C, 0x07, 0x0C, 0x0C, 0x38, 0x00 }, // '{'
+    { 0x18, 0x18, 0x18, 0x00, 0x18, 0x18, 0x18, 0x00 }, // '|'
+    { 0x07, 0x0C, 0x0C, 0x38, 0x0C, 0x0C, 0x07, 0x00 }, // '}'
+    { 0x6E, 0x3B, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00 }  // '~'
+};
+
+/**
+ * Non-ASCII glyphs used by the game UIs (scroll indicators)
+ */
+struct ExtraGlyph {
+    uint32_t codepoint;
+    uint8_t rows[8];
+};
+
+const ExtraGlyph DEFAULT_FONT_EXTRA[] = {
+    { 0x25B2, { 0x00, 0x08, 0x1C, 0x3E, 0x7F, 0x7F, 0x00, 0x00 } }, // Black up-pointing triangle
+    { 0x25BC, { 0x00, 0x7F, 0x7F, 0x3E, 0x1C, 0x08, 0x00, 0x00 } }  // Black down-pointing triangle
+};
+
+// Built-in atlas layout: 8x8 glyphs in 10x10 cells so linear filtering never
+// samples a neighbour, and a white block in the top-right corner
+const int DEFAULT_ATLAS_WIDTH = 256;
+const int DEFAULT_ATLAS_HEIGHT = 64;
+const int DEFAULT_CELL_SIZE = 10;
+const int DEFAULT_GLYPH_SIZE = 8;
+const int DEFAULT_COLUMNS = 25;
+const int DEFAULT_WHITE_X = 251;
+const int DEFAULT_WHITE_Y = 1;
+const int DEFAULT_WHITE_SIZE = 4;
+
+uint64_t makeKerningKey(uint32_t first, uint32_t second) {
+    return (static_cast<uint64_t>(first) << 32) | second;
+}
+
+/**
+ * Parse "key=value" pairs from one BMFont line
+ * Quoted values keep their spaces; the quotes are stripped.
+ */
+std::unordered_map<std::string, std::string> parseBMFontLine(std::istringstream& stream) {
+    std::unordered_map<std::string, std::string> values;
+    std::string token;
+
+    while (stream >> token) {
+        size_t equals = token.find('=');
+        if (equals == std::string::npos) {
+            continue;
+        }
+
+        std::string key = token.substr(0, equals);
+        std::string value = token.substr(equals + 1);
+
+        if (!value.empty() && value[0] == '"') {
+            // Read until the closing quote
+            while ((value.size() < 2 || value.back() != '"') && stream.good()) {
+                std::string rest;
+                if (!(stream >> rest)) {
+                    break;
+                }
+                value += " " + rest;
+            }
+            value = value.substr(1, value.size() >= 2 ? value.size() - 2 : 0);
+        }
+
+        values[key] = value;
+    }
+
+    return values;
+}
+
+float getFloat(const std::unordered_map<std::string, std::string>& values, const std::string& key, float defaultValue = 0.0f) {
+    auto it = values.find(key);
+    if (it == values.end()) {
+        return defaultValue;
+    }
+    return static_cast<float>(std::atof(it->second.c_str()));
+}
+
+} // namespace
+
+Font::Font(std::shared_ptr<IGraphicsAPI> graphicsAPI)
+    : m_graphicsAPI(graphicsAPI)
+    , m_texture(nullptr)
+    , m_size(0.0f)
+    , m_lineHeight(0.0f)
+    , m_base(0.0f)
+    , m_hasWhiteRegion(false)
+{
+    m_asciiGlyphs.fill(-1);
+    m_whiteRegion[0] = m_whiteRegion[1] = m_whiteRegion[2] = m_whiteRegion[3] = 0.0f;
+}
+
+Font::~Font() {
+}
+
+bool Font::createDefault() {
+    if (!m_graphicsAPI) {
+        std::cerr << "Graphics API not provided to Font" << std::endl;
+        return false;
+    }
+
+    clear();
+
+    std::vector<uint8_t> pixels(DEFAULT_ATLAS_WIDTH * DEFAULT_ATLAS_HEIGHT * 4, 0);
+
+    auto setPixel = [&](int x, int y) {
+        uint8_t* pixel = &pixels[(y * DEFAULT_ATLAS_WIDTH + x) * 4];
+        pixel[0] = pixel[1] = pixel[2] = pixel[3] = 255;
+    };
+
+    auto bakeGlyph = [&](uint32_t codepoint, const uint8_t* rows, int cell) {
+        int cellX = (cell % DEFAULT_COLUMNS) * DEFAULT_CELL_SIZE + 1;
+        int cellY = (cell / DEFAULT_COLUMNS) * DEFAULT_CELL_SIZE + 1;
+
+        for (int row = 0; row < DEFAULT_GLYPH_SIZE; ++row) {
+            for (int column = 0; column < DEFAULT_GLYPH_SIZE; ++column) {
+                if (rows[row] & (1 << column)) {
+                    setPixel(cellX + column, cellY + row);
+                }
+            }
+        }
+
+        Glyph glyph;
+        glyph.codepoint = codepoint;
+        glyph.u0 = static_cast<float>(cellX) / DEFAULT_ATLAS_WIDTH;
+        glyph.v0 = static_cast<float>(cellY) / DEFAULT_ATLAS_HEIGHT;
+        glyph.u1 = static_cast<float>(cellX + DEFAULT_GLYPH_SIZE) / DEFAULT_ATLAS_WIDTH;
+        glyph.v1 = static_cast<float>(cellY + DEFAULT_GLYPH_SIZE) / DEFAULT_ATLAS_HEIGHT;
+        glyph.width = static_cast<float>(DEFAULT_GLYPH_SIZE);
+        glyph.height = static_cast<float>(DEFAULT_GLYPH_SIZE);
+        glyph.advance = static_cast<float>(DEFAULT_GLYPH_SIZE);
+
+        // Spaces only advance the pen
+        if (codepoint == ' ') {
+            glyph.width = glyph.height = 0.0f;
+        }
+
+        addGlyph(glyph);
+    };
+
+    int cell = 0;
+    for (uint32_t c = 0; c < 95; ++c) {
+        bakeGlyph(c + 32, DEFAULT_FONT_ASCII[c], cell++);
+    }
+    for (const ExtraGlyph& extra : DEFAULT_FONT_EXTRA) {
+        bakeGlyph(extra.codepoint, extra.rows, cell++);
+    }
+
+    for (int y = 0; y < DEFAULT_WHITE_SIZE; ++y) {
+        for (int x = 0; x < DEFAULT_WHITE_SIZE; ++x) {
+            setPixel(DEFAULT_WHITE_X + x, DEFAULT_WHITE_Y + y);
+        }
+    }
+
+    // Sample only the inner texels of the white block
+    m_hasWhiteRegion = true;
+    m_whiteRegion[0] = static_cast<float>(DEFAULT_WHITE_X + 1) / DEFAULT_ATLAS_WIDTH;
+    m_whiteRegion[1] = static_cast<float>(DEFAULT_WHITE_Y + 1) / DEFAULT_ATLAS_HEIGHT;
+    m_whiteRegion[2] = static_cast<float>(DEFAULT_WHITE_X + DEFAULT_WHITE_SIZE - 1) / DEFAULT_ATLAS_WIDTH;
+    m_whiteRegion[3] = static_cast<float>(DEFAULT_WHITE_Y + DEFAULT_WHITE_SIZE - 1) / DEFAULT_ATLAS_HEIGHT;
+
+    m_size = static_cast<float>(DEFAULT_GLYPH_SIZE);
+    m_lineHeight = static_cast<float>(DEFAULT_CELL_SIZE);
+    m_base = 7.0f;
+
+    m_texture = std::make_shared<Texture>(m_graphicsAPI);
+    if (!m_texture->createFromData(DEFAULT_ATLAS_WIDTH, DEFAULT_ATLAS_HEIGHT, TextureFormat::RGBA, pixels.data())) {
+        std::cerr << "Failed to create default font atlas" << std::endl;
+        clear();
+        return false;
+    }
+
+    // Bitmap glyphs stay crisp when scaled up
+    m_texture->setFilter(TextureFilter::Nearest, TextureFilter::Nearest);
+    m_texture->setWrap(TextureWrap::ClampToEdge, TextureWrap::ClampToEdge);
+    return true;
+}
+
+bool Font::loadFromFile(const std::string& filepath) {
+    if (!m_graphicsAPI) {
+        std::cerr << "Graphics API not provided to Font" << std::endl;
+        return false;
+    }
+
+    std::ifstream file(filepath);
+    if (!file.is_open()) {
+        std::cerr << "Failed to open font file: " << filepath << std::endl;
+        return false;
+    }
+
+    clear();
+
+    float scaleW = 0.0f;
+    float scaleH = 0.0f;
+    std::string pageFile;
+    std::string line;
+
+    while (std::getline(file, line)) {
+        std::istringstream stream(line);
+        std::string tag;
+        if (!(stream >> tag)) {
+            continue;
+        }
+
+        auto values = parseBMFontLine(stream);
+
+        if (tag == "info") {
+            // Negative sizes mean "match character height" in BMFont
+            m_size = std::abs(getFloat(values, "size"));
+        } else if (tag == "common") {
+            m_lineHeight = getFloat(values, "lineHeight");
+            m_base = getFloat(values, "base");
+            scaleW = getFloat(values, "scaleW");
+            scaleH = getFloat(values, "scaleH");
+            if (getFloat(values, "pages", 1.0f) > 1.0f) {
+                std::cerr << "Font has multiple pages, only page 0 is used: " << filepath << std::endl;
+            }
+        } else if (tag == "page") {
+            if (getFloat(values, "id") == 0.0f) {
+                pageFile = values["file"];
+            }
+        } else if (tag == "char") {
+            if (scaleW <= 0.0f || scaleH <= 0.0f || getFloat(values, "page") != 0.0f) {
+                continue;
+            }
+
+            float x = getFloat(values, "x");
+            float y = getFloat(values, "y");
+
+            Glyph glyph;
+            glyph.codepoint = static_cast<uint32_t>(getFloat(values, "id"));
+            glyph.width = getFloat(values, "width");
+            glyph.height = getFloat(values, "height");
+            glyph.u0 = x / scaleW;
+            glyph.v0 = y / scaleH;
+            glyph.u1 = (x + glyph.width) / scaleW;
+            glyph.v1 = (y + glyph.height) / scaleH;
+            glyph.offsetX = getFloat(values, "xoffset");
+            glyph.offsetY = getFloat(values, "yoffset");
+            glyph.advance = getFloat(values, "xadvance");
+            addGlyph(glyph);
+        } else if (tag == "kerning") {
+            uint32_t first = static_cast<uint32_t>(getFloat(values, "first"));
+            uint32_t second = static_cast<uint32_t>(getFloat(values, "second"));
+            m_kerning[makeKerningKey(first, second)] = getFloat(values, "amount");
+        }
+    }
+
+    if (m_glyphs.empty() || pageFile.empty()) {
+        std::cerr << "Font file has no glyphs or atlas page: " << filepath << std::endl;
+        clear();
+        return false;
+    }
+
+    if (m_size <= 0.0f) {
+        m_size = m_lineHeight;
+    }
+
+    // The atlas page path is relative to the .fnt file
+    std::string directory;
+    size_t slash = filepath.find_last_of("/\\");
+    if (slash != std::string::npos) {
+        directory = filepath.substr(0, slash + 1);
+    }
+
+    m_texture = std::make_shared<Texture>(m_graphicsAPI);
+    if (!m_texture->loadFromFile(directory + pageFile)) {
+        std::cerr << "Failed to load font atlas: " << directory + pageFile << std::endl;
+        clear();
+        return false;
+    }
+
+    m_texture->setWrap(TextureWrap::ClampToEdge, TextureWrap::ClampToEdge);
+
+    std::cout << "Loaded font: " << filepath << " (" << m_glyphs.size() << " glyphs)" << std::endl;
+    return true;
+}
+
+const Glyph* Font::getGlyph(uint32_t codepoint) const {
+    if (codepoint < m_asciiGlyphs.size()) {
+        int32_t index = m_asciiGlyphs[codepoint];
+        if (index >= 0) {
+            return &m_glyphs[index];
+        }
+    } else {
+        auto it = m_glyphMap.find(codepoint);
+        if (it != m_glyphMap.end()) {
+            return &m_glyphs[it->second];
+        }
+    }
+
+    int32_t fallback = m_asciiGlyphs['?'];
+    return fallback >= 0 ? &m_glyphs[fallback] : nullptr;
+}
+
+float Font::getKerning(uint32_t first, uint32_t second) const {
+    if (m_kerning.empty()) {
+        return 0.0f;
+    }
+
+    auto it = m_kerning.find(makeKerningKey(first, second));
+    return it != m_kerning.end() ? it->second : 0.0f;
+}
+
+bool Font::getWhiteRegion(float& u0, float& v0, float& u1, float& v1) const {
+    if (!m_hasWhiteRegion) {
+        return false;
+    }
+
+    u0 = m_whiteRegion[0];
+    v0 = m_whiteRegion[1];
+    u1 = m_whiteRegion[2];
+    v1 = m_whiteRegion[3];
+    return true;
+}
+
+void Font::addGlyph(const Glyph& glyph) {
+    size_t index = m_glyphs.size();
+    m_glyphs.push_back(glyph);
+
+    if (glyph.codepoint < m_asciiGlyphs.size()) {
+        m_asciiGlyphs[glyph.codepoint] = static_cast<int32_t>(index);
+    } else {
+        m_glyphMap[glyph.codepoint] = index;
+    }
+}
+
+void Font::clear() {
+    m_texture.reset();
+    m_glyphs.clear();
+    m_asciiGlyphs.fill(-1);
+    m_glyphMap.clear();
+    m_kerning.clear();
+    m_size = 0.0f;
+    m_lineHeight = 0.0f;
+    m_base = 0.0f;
+    m_hasWhiteRegion = false;
+}
+
+} // namespace Graphics
+} // namespace RPGEngine
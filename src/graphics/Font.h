@@ -0,0 +1,157 @@
+#pragma once
+
+#include "IGraphicsAPI.h"
+#include "Texture.h"
+#include <array>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace RPGEngine {
+namespace Graphics {
+
+/**
+ * Glyph in a font atlas
+ * Metrics are in font pixels, at the size the font was baked at.
+ */
+struct Glyph {
+    uint32_t codepoint = 0;
+    float u0 = 0.0f;        // Atlas rectangle (normalized)
+    float v0 = 0.0f;
+    float u1 = 0.0f;
+    float v1 = 0.0f;
+    float width = 0.0f;     // Quad size
+    float height = 0.0f;
+    float offsetX = 0.0f;   // Offset from the pen position to the quad's top-left corner
+    float offsetY = 0.0f;
+    float advance = 0.0f;   // Pen advance after the glyph
+};
+
+/**
+ * Pre-rasterized font
+ * Glyphs live in a single atlas texture so a whole UI's text can be drawn
+ * from one sprite batch. The atlas comes either from the built-in 8x8 bitmap
+ * font or from an AngelCode BMFont text file (.fnt) baked offline from a TTF
+ * by BMFont, Hiero or similar tools.
+ */
+class Font {
+public:
+    /**
+     * Constructor
+     * @param graphicsAPI Graphics API used to create the atlas texture
+     */
+    Font(std::shared_ptr<IGraphicsAPI> graphicsAPI);
+
+    /**
+     * Destructor
+     */
+    ~Font();
+
+    /**
+     * Bake the built-in 8x8 bitmap font (printable ASCII) into an atlas
+     * @return true if the atlas was created successfully
+     */
+    bool createDefault();
+
+    /**
+     * Load a BMFont text descriptor and its atlas page
+     * Only single-page fonts are supported.
+     * @param filepath Path to the .fnt file
+     * @return true if the font was loaded successfully
+     */
+    bool loadFromFile(const std::string& filepath);
+
+    /**
+     * Get a glyph
+     * @param codepoint Unicode codepoint
+     * @return Glyph, the '?' glyph if the font has no such glyph, or nullptr if neither exists
+     */
+    const Glyph* getGlyph(uint32_t codepoint) const;
+
+    /**
+     * Get the kerning adjustment between two glyphs
+     * @param first Left codepoint
+     * @param second Right codepoint
+     * @return Pen adjustment in font pixels
+     */
+    float getKerning(uint32_t first, uint32_t second) const;
+
+    /**
+     * Get the size the glyphs were baked at
+     * @return Font size in pixels
+     */
+    float getSize() const { return m_size; }
+
+    /**
+     * Get the distance between baselines
+     * @return Line height in font pixels
+     */
+    float getLineHeight() const { return m_lineHeight; }
+
+    /**
+     * Get the distance from the top of a line to the baseline
+     * @return Base in font pixels
+     */
+    float getBase() const { return m_base; }
+
+    /**
+     * Get the atlas texture
+     * @return Atlas texture
+     */
+    std::shared_ptr<Texture> getTexture() const { return m_texture; }
+
+    /**
+     * Get a solid white region of the atlas
+     * Lets untextured rectangles share the text batch.
+     * @param u0 Left texture coordinate
+     * @param v0 Top texture coordinate
+     * @param u1 Right texture coordinate
+     * @param v1 Bottom texture coordinate
+     * @return true if the atlas has a white region
+     */
+    bool getWhiteRegion(float& u0, float& v0, float& u1, float& v1) const;
+
+    /**
+     * Check if the font is loaded
+     * @return true if the font has an atlas and glyphs
+     */
+    bool isLoaded() const { return m_texture && m_texture->isValid() && !m_glyphs.empty(); }
+
+    /**
+     * Get the number of glyphs
+     * @return Glyph count
+     */
+    size_t getGlyphCount() const { return m_glyphs.size(); }
+
+private:
+    /**
+     * Add a glyph to the lookup tables
+     * @param glyph Glyph to add
+     */
+    void addGlyph(const Glyph& glyph);
+
+    /**
+     * Clear glyphs, kerning and atlas
+     */
+    void clear();
+
+    std::shared_ptr<IGraphicsAPI> m_graphicsAPI;
+    std::shared_ptr<Texture> m_texture;
+
+    // Glyph storage; ASCII is looked up directly, everything else through the map
+    std::vector<Glyph> m_glyphs;
+    std::array<int32_t, 128> m_asciiGlyphs;
+    std::unordered_map<uint32_t, size_t> m_glyphMap;
+    std::unordered_map<uint64_t, float> m_kerning;
+
+    float m_size;
+    float m_lineHeight;
+    float m_base;
+
+    bool m_hasWhiteRegion;
+    float m_whiteRegion[4];
+};
+
+} // namespace Graphics
+} // namespace RPGEngine
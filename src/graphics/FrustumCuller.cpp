@@ -43,7 +43,31 @@ bool FrustumCuller::isSpriteVisible(const Sprite& sprite) const {
         return true; // If frustum is not valid, assume everything is visible
     }
     
-    // Get sprite bounds
+    return isRectVisible(getSpriteBounds(sprite));
+}
+
+void FrustumCuller::cullSprites(const std::vector<Sprite>& sprites, std::vector<const Sprite*>& visibleSprites) const {
+    visibleSprites.clear();
+    visibleSprites.reserve(sprites.size()); // Reserve space to avoid reallocations
+    
+    for (const auto& sprite : sprites) {
+        if (isSpriteVisible(sprite)) {
+            visibleSprites.push_back(&sprite);
+        }
+    }
+}
+
+void FrustumCuller::cullIndexed(const SpatialCuller& index, std::vector<uint32_t>& visibleIndices) const {
+    if (!m_frustumValid) {
+        // No frustum yet: everything is visible
+        index.query(Rect(-1e30f, -1e30f, 2e30f, 2e30f), visibleIndices);
+        return;
+    }
+    
+    index.query(m_frustumBounds, visibleIndices);
+}
+
+Rect FrustumCuller::getSpriteBounds(const Sprite& sprite) {
     float x, y;
     sprite.getPosition(x, y);
     
@@ -53,25 +77,12 @@ bool FrustumCuller::isSpriteVisible(const Sprite& sprite) const {
     const Rect& textureRect = sprite.getTextureRect();
     
     // Calculate sprite bounds in world coordinates
-    Rect spriteBounds(
+    return Rect(
         x - (textureRect.width * scaleX * 0.5f),
         y - (textureRect.height * scaleY * 0.5f),
         textureRect.width * scaleX,
         textureRect.height * scaleY
     );
-    
-    return isRectVisible(spriteBounds);
-}
-
-void FrustumCuller::cullSprites(const std::vector<Sprite>& sprites, std::vector<const Sprite*>& visibleSprites) const {
-    visibleSprites.clear();
-    visibleSprites.reserve(sprites.size()); // Reserve space to avoid reallocations
-    
-    for (const auto& sprite : sprites) {
-        if (isSpriteVisible(sprite)) {
-            visibleSprites.push_back(&sprite);
-        }
-    }
 }
 
 } // namespace Graphics
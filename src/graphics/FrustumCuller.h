@@ -2,6 +2,7 @@
 
 #include "Sprite.h"
 #include "Camera.h"
+#include "SpatialCuller.h"
 #include <vector>
 
 namespace RPGEngine {
@@ -53,6 +54,20 @@ public:
      */
     void cullSprites(const std::vector<Sprite>& sprites, std::vector<const Sprite*>& visibleSprites) const;
     
+    /**
+     * Cull using a spatial index, touching only proxies near the view
+     * @param index Spatial index built over the objects to cull
+     * @param visibleIndices Output list of visible user indices (sorted)
+     */
+    void cullIndexed(const SpatialCuller& index, std::vector<uint32_t>& visibleIndices) const;
+    
+    /**
+     * Get the bounds used to cull a sprite
+     * @param sprite Sprite
+     * @return Sprite bounds in world coordinates
+     */
+    static Rect getSpriteBounds(const Sprite& sprite);
+    
     /**
      * Get the frustum bounds
      * @return Frustum bounds in world coordinates
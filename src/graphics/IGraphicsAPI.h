@@ -47,7 +47,8 @@ enum class BlendMode {
     None,
     Alpha,
     Additive,
-    Multiply
+    Multiply,
+    PremultipliedAlpha      // For cooked textures with premultiplied color
 };
 
 /**
@@ -0,0 +1,498 @@
+#include "MockGraphicsAPI.h"
+#include <algorithm>
+#include <sstream>
+
+namespace RPGEngine {
+namespace Graphics {
+
+namespace {
+
+uint64_t bytesPerPixel(TextureFormat format) {
+    switch (format) {
+        case TextureFormat::RGB:
+        case TextureFormat::BGR:
+            return 3;
+        case TextureFormat::RGBA:
+        case TextureFormat::BGRA:
+            return 4;
+    }
+    return 4;
+}
+
+uint64_t primitiveCount(PrimitiveType type, int count) {
+    if (count <= 0) {
+        return 0;
+    }
+
+    switch (type) {
+        case PrimitiveType::Points:        return count;
+        case PrimitiveType::Lines:         return count / 2;
+        case PrimitiveType::LineStrip:     return count > 1 ? count - 1 : 0;
+        case PrimitiveType::Triangles:     return count / 3;
+        case PrimitiveType::TriangleStrip:
+        case PrimitiveType::TriangleFan:   return count > 2 ? count - 2 : 0;
+    }
+    return 0;
+}
+
+} // namespace
+
+void GraphicsFrameStats::accumulate(const GraphicsFrameStats& other) {
+    drawCalls += other.drawCalls;
+    stateChanges += other.stateChanges;
+    redundantStateChanges += other.redundantStateChanges;
+    textureBinds += other.textureBinds;
+    shaderBinds += other.shaderBinds;
+    vertexArrayBinds += other.vertexArrayBinds;
+    uniformUpdates += other.uniformUpdates;
+    bufferUploads += other.bufferUploads;
+    bytesUploaded += other.bytesUploaded;
+    vertices += other.vertices;
+    primitives += other.primitives;
+}
+
+MockGraphicsAPI::MockGraphicsAPI()
+    : m_width(800)
+    , m_height(600)
+    , m_title("Mock Window")
+    , m_apiName("Mock")
+    , m_apiVersion("1.0")
+    , m_verbose(false)
+    , m_nextHandle(1)
+    , m_boundProgram(INVALID_HANDLE)
+    , m_boundVertexArray(INVALID_HANDLE)
+    , m_blendMode(BlendMode::None)
+    , m_depthTest(false)
+    , m_faceCulling(false)
+    , m_maxFrameHistory(4096)
+{
+    std::fill(m_boundTextures, m_boundTextures + MAX_TEXTURE_UNITS, INVALID_HANDLE);
+    std::fill(m_viewport, m_viewport + 4, 0);
+}
+
+MockGraphicsAPI::~MockGraphicsAPI() {
+}
+
+bool MockGraphicsAPI::initialize(int windowWidth, int windowHeight, const std::string& windowTitle, bool fullscreen) {
+    m_width = windowWidth;
+    m_height = windowHeight;
+    m_title = windowTitle;
+    m_viewport[2] = windowWidth;
+    m_viewport[3] = windowHeight;
+
+    std::cout << "MockGraphicsAPI initialized: " << windowWidth << "x" << windowHeight
+              << " '" << windowTitle << "'" << (fullscreen ? " (fullscreen)" : "") << std::endl;
+    return true;
+}
+
+void MockGraphicsAPI::shutdown() {
+    m_textureBytes.clear();
+    m_bufferBytes.clear();
+    m_shaders.clear();
+    m_programs.clear();
+    m_vertexArrays.clear();
+
+    std::cout << "MockGraphicsAPI shutdown" << std::endl;
+}
+
+void MockGraphicsAPI::beginFrame() {
+    m_currentFrame = GraphicsFrameStats();
+}
+
+void MockGraphicsAPI::endFrame() {
+    m_frameHistory.push_back(m_currentFrame);
+    while (m_frameHistory.size() > m_maxFrameHistory) {
+        m_frameHistory.pop_front();
+    }
+
+    m_currentFrame = GraphicsFrameStats();
+}
+
+void MockGraphicsAPI::clear(float r, float g, float b, float a) {
+    if (m_verbose) {
+        std::ostringstream message;
+        message << "Clear " << r << "," << g << "," << b << "," << a;
+        log(message.str());
+    }
+}
+
+void MockGraphicsAPI::setViewport(int x, int y, int width, int height) {
+    bool changed = m_viewport[0] != x || m_viewport[1] != y || m_viewport[2] != width || m_viewport[3] != height;
+    m_viewport[0] = x;
+    m_viewport[1] = y;
+    m_viewport[2] = width;
+    m_viewport[3] = height;
+    recordStateChange(changed);
+}
+
+TextureHandle MockGraphicsAPI::createTexture(int width, int height, TextureFormat format, const void* data) {
+    if (width <= 0 || height <= 0) {
+        return INVALID_HANDLE;
+    }
+
+    TextureHandle handle = m_nextHandle++;
+    uint64_t bytes = static_cast<uint64_t>(width) * height * bytesPerPixel(format);
+    m_textureBytes[handle] = bytes;
+
+    if (data) {
+        recordUpload(bytes);
+    }
+
+    if (m_verbose) {
+        std::ostringstream message;
+        message << "CreateTexture " << width << "x" << height << " id=" << handle;
+        log(message.str());
+    }
+    return handle;
+}
+
+TextureHandle MockGraphicsAPI::loadTexture(const std::string& filepath) {
+    // Nothing is read from disk; pretend every file is a 1x1 RGBA image
+    static const uint8_t pixel[4] = { 255, 255, 255, 255 };
+    TextureHandle handle = createTexture(1, 1, TextureFormat::RGBA, pixel);
+    log("LoadTexture " + filepath);
+    return handle;
+}
+
+void MockGraphicsAPI::deleteTexture(TextureHandle handle) {
+    m_textureBytes.erase(handle);
+    for (uint32_t unit = 0; unit < MAX_TEXTURE_UNITS; ++unit) {
+        if (m_boundTextures[unit] == handle) {
+            m_boundTextures[unit] = INVALID_HANDLE;
+        }
+    }
+}
+
+void MockGraphicsAPI::bindTexture(TextureHandle handle, uint32_t unit) {
+    if (unit >= MAX_TEXTURE_UNITS) {
+        return;
+    }
+
+    bool changed = m_boundTextures[unit] != handle;
+    m_boundTextures[unit] = handle;
+    recordStateChange(changed);
+
+    if (changed) {
+        m_currentFrame.textureBinds++;
+        m_totalStats.textureBinds++;
+    }
+}
+
+void MockGraphicsAPI::setTextureFilter(TextureHandle /*handle*/, TextureFilter /*minFilter*/, TextureFilter /*magFilter*/) {
+    recordStateChange(true);
+}
+
+void MockGraphicsAPI::setTextureWrap(TextureHandle /*handle*/, TextureWrap /*wrapS*/, TextureWrap /*wrapT*/) {
+    recordStateChange(true);
+}
+
+ShaderHandle MockGraphicsAPI::createShader(ShaderType type, const std::string& /*source*/) {
+    ShaderHandle handle = m_nextHandle++;
+    m_shaders[handle] = type;
+    return handle;
+}
+
+void MockGraphicsAPI::deleteShader(ShaderHandle handle) {
+    m_shaders.erase(handle);
+}
+
+ShaderProgramHandle MockGraphicsAPI::createShaderProgram(ShaderHandle vertexShader, ShaderHandle fragmentShader) {
+    if (m_shaders.find(vertexShader) == m_shaders.end() || m_shaders.find(fragmentShader) == m_shaders.end()) {
+        std::cerr << "MockGraphicsAPI: createShaderProgram called with unknown shaders" << std::endl;
+        return INVALID_HANDLE;
+    }
+
+    ShaderProgramHandle handle = m_nextHandle++;
+    m_programs.insert(handle);
+    return handle;
+}
+
+void MockGraphicsAPI::deleteShaderProgram(ShaderProgramHandle handle) {
+    m_programs.erase(handle);
+    if (m_boundProgram == handle) {
+        m_boundProgram = INVALID_HANDLE;
+    }
+}
+
+void MockGraphicsAPI::useShaderProgram(ShaderProgramHandle handle) {
+    bool changed = m_boundProgram != handle;
+    m_boundProgram = handle;
+    recordStateChange(changed);
+
+    if (changed) {
+        m_currentFrame.shaderBinds++;
+        m_totalStats.shaderBinds++;
+    }
+}
+
+void MockGraphicsAPI::setUniform(ShaderProgramHandle /*handle*/, const std::string& /*name*/, int /*value*/) {
+    recordUniform();
+}
+
+void MockGraphicsAPI::setUniform(ShaderProgramHandle /*handle*/, const std::string& /*name*/, float /*value*/) {
+    recordUniform();
+}
+
+void MockGraphicsAPI::setUniform(ShaderProgramHandle /*handle*/, const std::string& /*name*/, float /*x*/, float /*y*/) {
+    recordUniform();
+}
+
+void MockGraphicsAPI::setUniform(ShaderProgramHandle /*handle*/, const std::string& /*name*/, float /*x*/, float /*y*/, float /*z*/) {
+    recordUniform();
+}
+
+void MockGraphicsAPI::setUniform(ShaderProgramHandle /*handle*/, const std::string& /*name*/, float /*x*/, float /*y*/, float /*z*/, float /*w*/) {
+    recordUniform();
+}
+
+void MockGraphicsAPI::setUniformMatrix4(ShaderProgramHandle /*handle*/, const std::string& /*name*/, const float* /*matrix*/) {
+    recordUniform();
+}
+
+BufferHandle MockGraphicsAPI::createVertexBuffer(const void* data, size_t size, bool /*dynamic*/) {
+    BufferHandle handle = m_nextHandle++;
+    m_bufferBytes[handle] = size;
+
+    if (data) {
+        recordUpload(size);
+    }
+    return handle;
+}
+
+void MockGraphicsAPI::updateVertexBuffer(BufferHandle handle, const void* /*data*/, size_t size) {
+    auto it = m_bufferBytes.find(handle);
+    if (it == m_bufferBytes.end()) {
+        std::cerr << "MockGraphicsAPI: updateVertexBuffer called with unknown buffer " << handle << std::endl;
+        return;
+    }
+
+    it->second = std::max<uint64_t>(it->second, size);
+    recordUpload(size);
+}
+
+void MockGraphicsAPI::deleteVertexBuffer(BufferHandle handle) {
+    m_bufferBytes.erase(handle);
+}
+
+BufferHandle MockGraphicsAPI::createIndexBuffer(const void* data, size_t size, bool dynamic) {
+    return createVertexBuffer(data, size, dynamic);
+}
+
+void MockGraphicsAPI::updateIndexBuffer(BufferHandle handle, const void* data, size_t size) {
+    updateVertexBuffer(handle, data, size);
+}
+
+void MockGraphicsAPI::deleteIndexBuffer(BufferHandle handle) {
+    deleteVertexBuffer(handle);
+}
+
+VertexArrayHandle MockGraphicsAPI::createVertexArray(BufferHandle vertexBuffer, BufferHandle /*indexBuffer*/,
+                                                     const std::vector<VertexAttribute>& /*attributes*/) {
+    if (m_bufferBytes.find(vertexBuffer) == m_bufferBytes.end()) {
+        std::cerr << "MockGraphicsAPI: createVertexArray called with unknown vertex buffer" << std::endl;
+        return INVALID_HANDLE;
+    }
+
+    VertexArrayHandle handle = m_nextHandle++;
+    m_vertexArrays[handle] = vertexBuffer;
+    return handle;
+}
+
+void MockGraphicsAPI::deleteVertexArray(VertexArrayHandle handle) {
+    m_vertexArrays.erase(handle);
+    if (m_boundVertexArray == handle) {
+        m_boundVertexArray = INVALID_HANDLE;
+    }
+}
+
+void MockGraphicsAPI::bindVertexArray(VertexArrayHandle handle) {
+    bool changed = m_boundVertexArray != handle;
+    m_boundVertexArray = handle;
+    recordStateChange(changed);
+
+    if (changed) {
+        m_currentFrame.vertexArrayBinds++;
+        m_totalStats.vertexArrayBinds++;
+    }
+}
+
+void MockGraphicsAPI::drawArrays(PrimitiveType type, int /*start*/, int count) {
+    m_currentFrame.drawCalls++;
+    m_totalStats.drawCalls++;
+
+    uint64_t vertices = count > 0 ? static_cast<uint64_t>(count) : 0;
+    m_currentFrame.vertices += vertices;
+    m_totalStats.vertices += vertices;
+
+    uint64_t primitives = primitiveCount(type, count);
+    m_currentFrame.primitives += primitives;
+    m_totalStats.primitives += primitives;
+}
+
+void MockGraphicsAPI::drawElements(PrimitiveType type, int count, uint32_t /*indexType*/, int offset) {
+    if (m_boundVertexArray == INVALID_HANDLE) {
+        std::cerr << "MockGraphicsAPI: drawElements called without a bound vertex array" << std::endl;
+    }
+
+    drawArrays(type, offset, count);
+}
+
+void MockGraphicsAPI::setBlendMode(BlendMode mode) {
+    bool changed = m_blendMode != mode;
+    m_blendMode = mode;
+    recordStateChange(changed);
+}
+
+void MockGraphicsAPI::setDepthTest(bool enable) {
+    bool changed = m_depthTest != enable;
+    m_depthTest = enable;
+    recordStateChange(changed);
+}
+
+void MockGraphicsAPI::setFaceCulling(bool enable) {
+    bool changed = m_faceCulling != enable;
+    m_faceCulling = enable;
+    recordStateChange(changed);
+}
+
+float MockGraphicsAPI::getAspectRatio() const {
+    return m_height > 0 ? static_cast<float>(m_width) / static_cast<float>(m_height) : 1.0f;
+}
+
+void MockGraphicsAPI::setMaxFrameHistory(size_t maxFrames) {
+    m_maxFrameHistory = std::max<size_t>(1, maxFrames);
+    while (m_frameHistory.size() > m_maxFrameHistory) {
+        m_frameHistory.pop_front();
+    }
+}
+
+GraphicsFrameStats MockGraphicsAPI::getLastFrameStats() const {
+    return m_frameHistory.empty() ? GraphicsFrameStats() : m_frameHistory.back();
+}
+
+GraphicsCounterHistogram MockGraphicsAPI::getHistogram(GraphicsCounter counter) const {
+    GraphicsCounterHistogram histogram;
+    if (m_frameHistory.empty()) {
+        return histogram;
+    }
+
+    std::vector<uint64_t> values;
+    values.reserve(m_frameHistory.size());
+
+    double sum = 0.0;
+    for (const auto& frame : m_frameHistory) {
+        uint64_t value = getCounterValue(frame, counter);
+        values.push_back(value);
+        sum += static_cast<double>(value);
+
+        // Bucket index is the bit width of the value
+        size_t bucket = 0;
+        while (bucket < 64 && (value >> bucket) != 0) {
+            bucket++;
+        }
+        if (histogram.buckets.size() <= bucket) {
+            histogram.buckets.resize(bucket + 1, 0);
+        }
+        histogram.buckets[bucket]++;
+    }
+
+    std::sort(values.begin(), values.end());
+
+    auto percentile = [&values](double p) {
+        size_t index = static_cast<size_t>(p * (values.size() - 1) + 0.5);
+        return values[std::min(index, values.size() - 1)];
+    };
+
+    histogram.min = values.front();
+    histogram.max = values.back();
+    histogram.mean = sum / values.size();
+    histogram.p50 = percentile(0.50);
+    histogram.p95 = percentile(0.95);
+    histogram.p99 = percentile(0.99);
+    return histogram;
+}
+
+void MockGraphicsAPI::resetStats() {
+    m_currentFrame = GraphicsFrameStats();
+    m_totalStats = GraphicsFrameStats();
+    m_frameHistory.clear();
+}
+
+size_t MockGraphicsAPI::getLiveObjectCount() const {
+    return m_textureBytes.size() + m_bufferBytes.size() + m_shaders.size() +
+           m_programs.size() + m_vertexArrays.size();
+}
+
+uint64_t MockGraphicsAPI::getResidentBytes() const {
+    uint64_t total = 0;
+    for (const auto& pair : m_textureBytes) {
+        total += pair.second;
+    }
+    for (const auto& pair : m_bufferBytes) {
+        total += pair.second;
+    }
+    return total;
+}
+
+const char* MockGraphicsAPI::getCounterName(GraphicsCounter counter) {
+    switch (counter) {
+        case GraphicsCounter::DrawCalls:             return "drawCalls";
+        case GraphicsCounter::StateChanges:          return "stateChanges";
+        case GraphicsCounter::RedundantStateChanges: return "redundantStateChanges";
+        case GraphicsCounter::TextureBinds:          return "textureBinds";
+        case GraphicsCounter::ShaderBinds:           return "shaderBinds";
+        case GraphicsCounter::UniformUpdates:        return "uniformUpdates";
+        case GraphicsCounter::BufferUploads:         return "bufferUploads";
+        case GraphicsCounter::BytesUploaded:         return "bytesUploaded";
+        case GraphicsCounter::Vertices:              return "vertices";
+        case GraphicsCounter::Primitives:            return "primitives";
+    }
+    return "unknown";
+}
+
+uint64_t MockGraphicsAPI::getCounterValue(const GraphicsFrameStats& stats, GraphicsCounter counter) {
+    switch (counter) {
+        case GraphicsCounter::DrawCalls:             return stats.drawCalls;
+        case GraphicsCounter::StateChanges:          return stats.stateChanges;
+        case GraphicsCounter::RedundantStateChanges: return stats.redundantStateChanges;
+        case GraphicsCounter::TextureBinds:          return stats.textureBinds;
+        case GraphicsCounter::ShaderBinds:           return stats.shaderBinds;
+        case GraphicsCounter::UniformUpdates:        return stats.uniformUpdates;
+        case GraphicsCounter::BufferUploads:         return stats.bufferUploads;
+        case GraphicsCounter::BytesUploaded:         return stats.bytesUploaded;
+        case GraphicsCounter::Vertices:              return stats.vertices;
+        case GraphicsCounter::Primitives:            return stats.primitives;
+    }
+    return 0;
+}
+
+void MockGraphicsAPI::recordStateChange(bool changed) {
+    if (changed) {
+        m_currentFrame.stateChanges++;
+        m_totalStats.stateChanges++;
+    } else {
+        m_currentFrame.redundantStateChanges++;
+        m_totalStats.redundantStateChanges++;
+    }
+}
+
+void MockGraphicsAPI::recordUpload(size_t bytes) {
+    m_currentFrame.bufferUploads++;
+    m_currentFrame.bytesUploaded += bytes;
+    m_totalStats.bufferUploads++;
+    m_totalStats.bytesUploaded += bytes;
+}
+
+void MockGraphicsAPI::recordUniform() {
+    m_currentFrame.uniformUpdates++;
+    m_totalStats.uniformUpdates++;
+}
+
+void MockGraphicsAPI::log(const std::string& message) const {
+    if (m_verbose) {
+        std::cout << "MockGraphicsAPI: " << message << std::endl;
+    }
+}
+
+} // namespace Graphics
+} // namespace RPGEngine
@@ -1,229 +1,246 @@
 #pragma once
 
 #include "IGraphicsAPI.h"
+#include <unordered_map>
+#include <unordered_set>
+#include <deque>
 #include <iostream>
 
 namespace RPGEngine {
-    namespace Graphics {
-
-        /**
-         * Mock graphics API implementation for testing and platforms without graphics
-         */
-        class MockGraphicsAPI : public IGraphicsAPI {
-        public:
-            MockGraphicsAPI() = default;
-            ~MockGraphicsAPI() override = default;
-
-            // Window management
-            bool initialize(int width, int height, const std::string& title, bool fullscreen) override {
-                std::cout << "MockGraphicsAPI: Initialize " << width << "x" << height << " '" << title << "'" << std::endl;
-                m_width = width;
-                m_height = height;
-                m_title = title;
-                return true;
-            }
-
-            void shutdown() override {
-                std::cout << "MockGraphicsAPI: Shutdown" << std::endl;
-            }
-
-            bool shouldClose() const override {
-                return false; // Never close in mock mode
-            }
-
-            void swapBuffers() {
-                // No-op
-            }
-
-            void pollEvents() override {
-                // No-op
-            }
-
-            // Viewport and clearing
-            void setViewport(int x, int y, int width, int height) override {
-                std::cout << "MockGraphicsAPI: SetViewport " << x << "," << y << " " << width << "x" << height << std::endl;
-            }
-
-            void clear(float r, float g, float b, float a) override {
-                // No-op
-            }
-
-            // Shader management
-            ShaderHandle createShader(ShaderType type, const std::string& source) {
-                static unsigned int nextId = 1;
-                std::cout << "MockGraphicsAPI: CreateShader " << nextId << std::endl;
-                return nextId++;
-            }
-
-            void useShader(unsigned int shaderId) override {
-                std::cout << "MockGraphicsAPI: UseShader " << shaderId << std::endl;
-            }
-
-            void deleteShader(unsigned int shaderId) override {
-                std::cout << "MockGraphicsAPI: DeleteShader " << shaderId << std::endl;
-            }
-
-            // Uniform management
-            int getUniformLocation(unsigned int shaderId, const std::string& name) override {
-                return 0; // Mock location
-            }
-
-            void setUniformMatrix4(int location, const float* matrix) override {
-                // No-op
-            }
-
-            void setUniformFloat(int location, float value) override {
-                // No-op
-            }
-
-            void setUniformInt(int location, int value) override {
-                // No-op
-            }
-
-            void setUniformVec2(int location, float x, float y) override {
-                // No-op
-            }
-
-            void setUniformVec3(int location, float x, float y, float z) override {
-                // No-op
-            }
-
-            void setUniformVec4(int location, float x, float y, float z, float w) override {
-                // No-op
-            }
-
-            // Texture management
-            unsigned int createTexture(int width, int height, const void* data, TextureFormat format) override {
-                static unsigned int nextId = 1;
-                std::cout << "MockGraphicsAPI: CreateTexture " << width << "x" << height << " format=" << static_cast<int>(format) << " id=" << nextId << std::endl;
-                return nextId++;
-            }
-
-            void bindTexture(unsigned int textureId, int slot) override {
-                std::cout << "MockGraphicsAPI: BindTexture " << textureId << " slot=" << slot << std::endl;
-            }
-
-            void deleteTexture(unsigned int textureId) override {
-                std::cout << "MockGraphicsAPI: DeleteTexture " << textureId << std::endl;
-            }
-
-            // Buffer management
-            unsigned int createVertexBuffer(const void* data, size_t size, BufferUsage usage) override {
-                static unsigned int nextId = 1;
-                std::cout << "MockGraphicsAPI: CreateVertexBuffer size=" << size << " usage=" << static_cast<int>(usage) << " id=" << nextId << std::endl;
-                return nextId++;
-            }
-
-            unsigned int createIndexBuffer(const void* data, size_t size, BufferUsage usage) override {
-                static unsigned int nextId = 1;
-                std::cout << "MockGraphicsAPI: CreateIndexBuffer size=" << size << " usage=" << static_cast<int>(usage) << " id=" << nextId << std::endl;
-                return nextId++;
-            }
-
-            void updateBuffer(unsigned int bufferId, const void* data, size_t size, size_t offset) override {
-                std::cout << "MockGraphicsAPI: UpdateBuffer " << bufferId << " size=" << size << " offset=" << offset << std::endl;
-            }
-
-            void bindVertexBuffer(unsigned int bufferId) override {
-                std::cout << "MockGraphicsAPI: BindVertexBuffer " << bufferId << std::endl;
-            }
-
-            void bindIndexBuffer(unsigned int bufferId) override {
-                std::cout << "MockGraphicsAPI: BindIndexBuffer " << bufferId << std::endl;
-            }
-
-            void deleteBuffer(unsigned int bufferId) override {
-                std::cout << "MockGraphicsAPI: DeleteBuffer " << bufferId << std::endl;
-            }
-
-            // Vertex array management
-            unsigned int createVertexArray() override {
-                static unsigned int nextId = 1;
-                std::cout << "MockGraphicsAPI: CreateVertexArray " << nextId << std::endl;
-                return nextId++;
-            }
-
-            void bindVertexArray(unsigned int vaoId) override {
-                std::cout << "MockGraphicsAPI: BindVertexArray " << vaoId << std::endl;
-            }
-
-            void setVertexAttribute(int index, int size, DataType type, bool normalized, int stride, int offset) override {
-                std::cout << "MockGraphicsAPI: SetVertexAttribute " << index << " size=" << size << " type=" << static_cast<int>(type) << std::endl;
-            }
-
-            void enableVertexAttribute(int index) override {
-                std::cout << "MockGraphicsAPI: EnableVertexAttribute " << index << std::endl;
-            }
-
-            void deleteVertexArray(unsigned int vaoId) override {
-                std::cout << "MockGraphicsAPI: DeleteVertexArray " << vaoId << std::endl;
-            }
-
-            // Drawing
-            void drawElements(PrimitiveType type, int count, DataType indexType, const void* indices) override {
-                std::cout << "MockGraphicsAPI: DrawElements type=" << static_cast<int>(type) << " count=" << count << std::endl;
-            }
-
-            void drawArrays(PrimitiveType type, int first, int count) override {
-                std::cout << "MockGraphicsAPI: DrawArrays type=" << static_cast<int>(type) << " first=" << first << " count=" << count << std::endl;
-            }
-
-            // State management
-            void enableBlending() override {
-                std::cout << "MockGraphicsAPI: EnableBlending" << std::endl;
-            }
-
-            void disableBlending() override {
-                std::cout << "MockGraphicsAPI: DisableBlending" << std::endl;
-            }
-
-            void setBlendFunction(BlendFactor srcFactor, BlendFactor dstFactor) override {
-                std::cout << "MockGraphicsAPI: SetBlendFunction src=" << static_cast<int>(srcFactor) << " dst=" << static_cast<int>(dstFactor) << std::endl;
-            }
-
-            void enableDepthTest() override {
-                std::cout << "MockGraphicsAPI: EnableDepthTest" << std::endl;
-            }
-
-            void disableDepthTest() override {
-                std::cout << "MockGraphicsAPI: DisableDepthTest" << std::endl;
-            }
-
-            void enableCulling() override {
-                std::cout << "MockGraphicsAPI: EnableCulling" << std::endl;
-            }
-
-            void disableCulling() override {
-                std::cout << "MockGraphicsAPI: DisableCulling" << std::endl;
-            }
-
-            // Information
-            std::string getVersion() const override {
-                return "MockGraphicsAPI 1.0";
-            }
-
-            std::string getRenderer() const override {
-                return "Mock Renderer";
-            }
-
-            std::string getVendor() const override {
-                return "RPG Engine";
-            }
-
-            // Window properties
-            int getWidth() const override {
-                return m_width;
-            }
-
-            int getHeight() const override {
-                return m_height;
-            }
-
-        private:
-            int m_width = 800;
-            int m_height = 600;
-            std::string m_title = "Mock Window";
-        };
-
-    } // namespace Graphics
-} // namespace RPGEngine
\ No newline at end of file
+namespace Graphics {
+
+/**
+ * Counters recorded by MockGraphicsAPI for one frame (or in total)
+ */
+struct GraphicsFrameStats {
+    uint32_t drawCalls = 0;
+    uint32_t stateChanges = 0;          // State calls that changed the device state
+    uint32_t redundantStateChanges = 0; // State calls that set the current value again
+    uint32_t textureBinds = 0;
+    uint32_t shaderBinds = 0;
+    uint32_t vertexArrayBinds = 0;
+    uint32_t uniformUpdates = 0;
+    uint32_t bufferUploads = 0;
+    uint64_t bytesUploaded = 0;
+    uint64_t vertices = 0;              // Vertices (drawArrays) or indices (drawElements) submitted
+    uint64_t primitives = 0;
+
+    /**
+     * Add another set of counters to this one
+     * @param other Counters to add
+     */
+    void accumulate(const GraphicsFrameStats& other);
+};
+
+/**
+ * Counter selector for per-frame histograms
+ */
+enum class GraphicsCounter {
+    DrawCalls,
+    StateChanges,
+    RedundantStateChanges,
+    TextureBinds,
+    ShaderBinds,
+    UniformUpdates,
+    BufferUploads,
+    BytesUploaded,
+    Vertices,
+    Primitives
+};
+
+/**
+ * Distribution of one counter over the recorded frame history
+ * Bucket 0 counts frames where the value was 0; bucket i counts frames where
+ * the value was in [2^(i-1), 2^i).
+ */
+struct GraphicsCounterHistogram {
+    uint64_t min = 0;
+    uint64_t max = 0;
+    double mean = 0.0;
+    uint64_t p50 = 0;
+    uint64_t p95 = 0;
+    uint64_t p99 = 0;
+    std::vector<uint32_t> buckets;
+};
+
+/**
+ * Mock graphics API for testing and platforms without graphics
+ * Records every call as counters instead of talking to a GPU, so rendering
+ * code can be profiled headless (e.g. in CI). Counters are kept per frame
+ * between beginFrame() and endFrame(), and a history of finished frames is
+ * kept for histograms.
+ */
+class MockGraphicsAPI : public IGraphicsAPI {
+public:
+    MockGraphicsAPI();
+    ~MockGraphicsAPI() override;
+
+    // IGraphicsAPI implementation
+    bool initialize(int windowWidth, int windowHeight, const std::string& windowTitle, bool fullscreen) override;
+    void shutdown() override;
+    void beginFrame() override;
+    void endFrame() override;
+    void clear(float r, float g, float b, float a) override;
+    void setViewport(int x, int y, int width, int height) override;
+
+    TextureHandle createTexture(int width, int height, TextureFormat format, const void* data) override;
+    TextureHandle loadTexture(const std::string& filepath) override;
+    void deleteTexture(TextureHandle handle) override;
+    void bindTexture(TextureHandle handle, uint32_t unit) override;
+    void setTextureFilter(TextureHandle handle, TextureFilter minFilter, TextureFilter magFilter) override;
+    void setTextureWrap(TextureHandle handle, TextureWrap wrapS, TextureWrap wrapT) override;
+
+    ShaderHandle createShader(ShaderType type, const std::string& source) override;
+    void deleteShader(ShaderHandle handle) override;
+    ShaderProgramHandle createShaderProgram(ShaderHandle vertexShader, ShaderHandle fragmentShader) override;
+    void deleteShaderProgram(ShaderProgramHandle handle) override;
+    void useShaderProgram(ShaderProgramHandle handle) override;
+
+    void setUniform(ShaderProgramHandle handle, const std::string& name, int value) override;
+    void setUniform(ShaderProgramHandle handle, const std::string& name, float value) override;
+    void setUniform(ShaderProgramHandle handle, const std::string& name, float x, float y) override;
+    void setUniform(ShaderProgramHandle handle, const std::string& name, float x, float y, float z) override;
+    void setUniform(ShaderProgramHandle handle, const std::string& name, float x, float y, float z, float w) override;
+    void setUniformMatrix4(ShaderProgramHandle handle, const std::string& name, const float* matrix) override;
+
+    BufferHandle createVertexBuffer(const void* data, size_t size, bool dynamic) override;
+    void updateVertexBuffer(BufferHandle handle, const void* data, size_t size) override;
+    void deleteVertexBuffer(BufferHandle handle) override;
+    BufferHandle createIndexBuffer(const void* data, size_t size, bool dynamic) override;
+    void updateIndexBuffer(BufferHandle handle, const void* data, size_t size) override;
+    void deleteIndexBuffer(BufferHandle handle) override;
+
+    VertexArrayHandle createVertexArray(BufferHandle vertexBuffer, BufferHandle indexBuffer,
+                                        const std::vector<VertexAttribute>& attributes) override;
+    void deleteVertexArray(VertexArrayHandle handle) override;
+    void bindVertexArray(VertexArrayHandle handle) override;
+
+    void drawArrays(PrimitiveType type, int start, int count) override;
+    void drawElements(PrimitiveType type, int count, uint32_t indexType, int offset) override;
+
+    void setBlendMode(BlendMode mode) override;
+    void setDepthTest(bool enable) override;
+    void setFaceCulling(bool enable) override;
+
+    bool shouldClose() const override { return false; }
+    int getWindowWidth() const override { return m_width; }
+    int getWindowHeight() const override { return m_height; }
+    float getAspectRatio() const override;
+    void pollEvents() override {}
+    const std::string& getAPIName() const override { return m_apiName; }
+    const std::string& getAPIVersion() const override { return m_apiVersion; }
+
+    /**
+     * Enable logging of every call to stdout
+     * @param verbose Whether to log calls
+     */
+    void setVerbose(bool verbose) { m_verbose = verbose; }
+
+    /**
+     * Set the number of finished frames kept for histograms
+     * @param maxFrames Maximum number of frames in the history
+     */
+    void setMaxFrameHistory(size_t maxFrames);
+
+    /**
+     * Get the counters of the frame in progress
+     * @return Current frame counters
+     */
+    const GraphicsFrameStats& getFrameStats() const { return m_currentFrame; }
+
+    /**
+     * Get the counters of the last finished frame
+     * @return Last frame counters (zero if no frame finished yet)
+     */
+    GraphicsFrameStats getLastFrameStats() const;
+
+    /**
+     * Get the counters accumulated since the last reset
+     * @return Total counters, including calls made outside frames
+     */
+    const GraphicsFrameStats& getTotalStats() const { return m_totalStats; }
+
+    /**
+     * Get the finished frame history, oldest first
+     * @return Frame history
+     */
+    const std::deque<GraphicsFrameStats>& getFrameHistory() const { return m_frameHistory; }
+
+    /**
+     * Build a histogram of one counter over the frame history
+     * @param counter Counter to summarize
+     * @return Histogram (all zero if the history is empty)
+     */
+    GraphicsCounterHistogram getHistogram(GraphicsCounter counter) const;
+
+    /**
+     * Clear all counters and the frame history
+     * Resource and binding state is kept.
+     */
+    void resetStats();
+
+    /**
+     * Get the number of live GPU objects (textures, buffers, shaders, programs, vertex arrays)
+     * @return Live object count
+     */
+    size_t getLiveObjectCount() const;
+
+    /**
+     * Get the bytes held by live textures and buffers
+     * @return Resident bytes
+     */
+    uint64_t getResidentBytes() const;
+
+    /**
+     * Get a printable name for a counter
+     * @param counter Counter
+     * @return Name
+     */
+    static const char* getCounterName(GraphicsCounter counter);
+
+    /**
+     * Read one counter from a set of frame stats
+     * @param stats Frame stats
+     * @param counter Counter
+     * @return Counter value
+     */
+    static uint64_t getCounterValue(const GraphicsFrameStats& stats, GraphicsCounter counter);
+
+private:
+    void recordStateChange(bool changed);
+    void recordUpload(size_t bytes);
+    void recordUniform();
+    void log(const std::string& message) const;
+
+    int m_width;
+    int m_height;
+    std::string m_title;
+    std::string m_apiName;
+    std::string m_apiVersion;
+    bool m_verbose;
+
+    uint32_t m_nextHandle;
+    std::unordered_map<TextureHandle, uint64_t> m_textureBytes;
+    std::unordered_map<BufferHandle, uint64_t> m_bufferBytes;
+    std::unordered_map<ShaderHandle, ShaderType> m_shaders;
+    std::unordered_set<ShaderProgramHandle> m_programs;
+    std::unordered_map<VertexArrayHandle, BufferHandle> m_vertexArrays;
+
+    // Currently bound device state
+    static const uint32_t MAX_TEXTURE_UNITS = 16;
+    TextureHandle m_boundTextures[MAX_TEXTURE_UNITS];
+    ShaderProgramHandle m_boundProgram;
+    VertexArrayHandle m_boundVertexArray;
+    BlendMode m_blendMode;
+    bool m_depthTest;
+    bool m_faceCulling;
+    int m_viewport[4];
+
+    GraphicsFrameStats m_currentFrame;
+    GraphicsFrameStats m_totalStats;
+    std::deque<GraphicsFrameStats> m_frameHistory;
+    size_t m_maxFrameHistory;
+};
+
+} // namespace Graphics
+} // namespace RPGEngine
@@ -650,6 +650,11 @@ void OpenGLAPI::setBlendMode(BlendMode mode) {
             glEnable(GL_BLEND);
             glBlendFunc(GL_DST_COLOR, GL_ZERO);
             break;
+            
+        case BlendMode::PremultipliedAlpha:
+            glEnable(GL_BLEND);
+            glBlendFunc(GL_ONE, GL_ONE_MINUS_SRC_ALPHA);
+            break;
     }
     
     m_currentBlendMode = mode;
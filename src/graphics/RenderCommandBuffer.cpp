@@ -0,0 +1,376 @@
+#include "RenderCommandBuffer.h"
+#include <algorithm>
+#include <future>
+#include <iostream>
+
+namespace RPGEngine {
+namespace Graphics {
+
+RenderCommandList::RenderCommandList(uint64_t sortKey)
+    : m_sortKey(sortKey)
+{
+}
+
+void RenderCommandList::reset(uint64_t sortKey) {
+    m_sortKey = sortKey;
+    m_commands.clear();
+    m_vertices.clear();
+    m_matrices.clear();
+}
+
+RenderCommand& RenderCommandList::pushCommand(RenderCommandType type) {
+    m_commands.emplace_back();
+    RenderCommand& command = m_commands.back();
+    command.type = type;
+    command.blendMode = BlendMode::None;
+    command.texture = INVALID_HANDLE;
+    command.program = INVALID_HANDLE;
+    command.first = 0;
+    command.count = 0;
+    command.params[0] = command.params[1] = command.params[2] = command.params[3] = 0.0f;
+    return command;
+}
+
+void RenderCommandList::clear(float r, float g, float b, float a) {
+    RenderCommand& command = pushCommand(RenderCommandType::Clear);
+    command.params[0] = r;
+    command.params[1] = g;
+    command.params[2] = b;
+    command.params[3] = a;
+}
+
+void RenderCommandList::setViewport(int x, int y, int width, int height) {
+    RenderCommand& command = pushCommand(RenderCommandType::SetViewport);
+    command.params[0] = static_cast<float>(x);
+    command.params[1] = static_cast<float>(y);
+    command.params[2] = static_cast<float>(width);
+    command.params[3] = static_cast<float>(height);
+}
+
+void RenderCommandList::setBlendMode(BlendMode mode) {
+    RenderCommand& command = pushCommand(RenderCommandType::SetBlendMode);
+    command.blendMode = mode;
+}
+
+void RenderCommandList::useShaderProgram(ShaderProgramHandle program) {
+    RenderCommand& command = pushCommand(RenderCommandType::UseShaderProgram);
+    command.program = program;
+}
+
+void RenderCommandList::setViewProjection(const float* projection, const float* view) {
+    if (!projection || !view) {
+        return;
+    }
+
+    RenderCommand& command = pushCommand(RenderCommandType::SetViewProjection);
+    command.first = static_cast<uint32_t>(m_matrices.size());
+    m_matrices.insert(m_matrices.end(), projection, projection + 16);
+    m_matrices.insert(m_matrices.end(), view, view + 16);
+}
+
+float* RenderCommandList::allocateQuads(TextureHandle texture, uint32_t quadCount) {
+    uint32_t firstQuad = getQuadCount();
+
+    // Extend the previous draw if it uses the same texture
+    if (!m_commands.empty() &&
+        m_commands.back().type == RenderCommandType::DrawQuads &&
+        m_commands.back().texture == texture) {
+        m_commands.back().count += quadCount;
+    } else {
+        RenderCommand& command = pushCommand(RenderCommandType::DrawQuads);
+        command.texture = texture;
+        command.first = firstQuad;
+        command.count = quadCount;
+    }
+
+    size_t offset = m_vertices.size();
+    m_vertices.resize(offset + static_cast<size_t>(quadCount) * FLOATS_PER_QUAD);
+    return m_vertices.data() + offset;
+}
+
+RenderCommandQueue::RenderCommandQueue(std::shared_ptr<IGraphicsAPI> graphicsAPI)
+    : m_graphicsAPI(graphicsAPI)
+    , m_recordFrame(0)
+    , m_submitFrame(1)
+    , m_vertexBuffer(INVALID_HANDLE)
+    , m_indexBuffer(INVALID_HANDLE)
+    , m_vertexArray(INVALID_HANDLE)
+    , m_boundTexture(INVALID_HANDLE)
+    , m_boundProgram(INVALID_HANDLE)
+    , m_blendMode(BlendMode::None)
+    , m_blendModeSet(false)
+    , m_initialized(false)
+{
+}
+
+RenderCommandQueue::~RenderCommandQueue() {
+    if (m_initialized) {
+        shutdown();
+    }
+}
+
+bool RenderCommandQueue::initialize() {
+    if (m_initialized) {
+        return true;
+    }
+
+    if (!m_graphicsAPI) {
+        std::cerr << "Graphics API not provided to RenderCommandQueue" << std::endl;
+        return false;
+    }
+
+    // Quad indices never change, so they are generated once up front
+    std::vector<uint16_t> indices;
+    indices.reserve(MAX_QUADS_PER_DRAW * 6);
+    for (uint32_t i = 0; i < MAX_QUADS_PER_DRAW; ++i) {
+        uint16_t base = static_cast<uint16_t>(i * RenderCommandList::VERTICES_PER_QUAD);
+        indices.push_back(base + 0);
+        indices.push_back(base + 1);
+        indices.push_back(base + 2);
+        indices.push_back(base + 0);
+        indices.push_back(base + 2);
+        indices.push_back(base + 3);
+    }
+
+    m_vertexBuffer = m_graphicsAPI->createVertexBuffer(
+        nullptr,
+        MAX_QUADS_PER_DRAW * RenderCommandList::FLOATS_PER_QUAD * sizeof(float),
+        true
+    );
+
+    m_indexBuffer = m_graphicsAPI->createIndexBuffer(
+        indices.data(),
+        indices.size() * sizeof(uint16_t),
+        false
+    );
+
+    const uint32_t stride = RenderCommandList::VERTEX_SIZE * sizeof(float);
+    std::vector<VertexAttribute> attributes = {
+        { "aPos",      0, 3, VertexDataType::Float, false, stride, 0 },
+        { "aColor",    1, 4, VertexDataType::Float, false, stride, 3 * sizeof(float) },
+        { "aTexCoord", 2, 2, VertexDataType::Float, false, stride, 7 * sizeof(float) }
+    };
+
+    m_vertexArray = m_graphicsAPI->createVertexArray(m_vertexBuffer, m_indexBuffer, attributes);
+
+    if (m_vertexBuffer == INVALID_HANDLE || m_indexBuffer == INVALID_HANDLE || m_vertexArray == INVALID_HANDLE) {
+        std::cerr << "Failed to create RenderCommandQueue buffers" << std::endl;
+        shutdown();
+        return false;
+    }
+
+    m_initialized = true;
+    return true;
+}
+
+void RenderCommandQueue::shutdown() {
+    if (m_graphicsAPI) {
+        if (m_vertexArray != INVALID_HANDLE) {
+            m_graphicsAPI->deleteVertexArray(m_vertexArray);
+        }
+        if (m_vertexBuffer != INVALID_HANDLE) {
+            m_graphicsAPI->deleteVertexBuffer(m_vertexBuffer);
+        }
+        if (m_indexBuffer != INVALID_HANDLE) {
+            m_graphicsAPI->deleteIndexBuffer(m_indexBuffer);
+        }
+    }
+
+    m_vertexArray = INVALID_HANDLE;
+    m_vertexBuffer = INVALID_HANDLE;
+    m_indexBuffer = INVALID_HANDLE;
+
+    for (auto& frame : m_frames) {
+        frame.lists.clear();
+        frame.usedLists = 0;
+        frame.pending = false;
+    }
+
+    m_initialized = false;
+}
+
+void RenderCommandQueue::beginRecording() {
+    std::lock_guard<std::mutex> lock(m_listMutex);
+
+    // Lists are kept between frames so their storage is reused
+    Frame& frame = m_frames[m_recordFrame];
+    frame.usedLists = 0;
+    frame.pending = false;
+}
+
+RenderCommandList& RenderCommandQueue::acquireList(uint64_t sortKey) {
+    std::lock_guard<std::mutex> lock(m_listMutex);
+
+    Frame& frame = m_frames[m_recordFrame];
+    if (frame.usedLists == frame.lists.size()) {
+        frame.lists.push_back(std::make_unique<RenderCommandList>(sortKey));
+    }
+
+    RenderCommandList& list = *frame.lists[frame.usedLists++];
+    list.reset(sortKey);
+    return list;
+}
+
+void RenderCommandQueue::endRecording() {
+    std::lock_guard<std::mutex> lock(m_listMutex);
+
+    m_frames[m_recordFrame].pending = true;
+    std::swap(m_recordFrame, m_submitFrame);
+}
+
+void RenderCommandQueue::submit() {
+    Frame& frame = m_frames[m_submitFrame];
+    if (!frame.pending) {
+        return;
+    }
+
+    m_stats = RenderQueueStats();
+
+    if (!m_initialized && !initialize()) {
+        frame.pending = false;
+        return;
+    }
+
+    // Merge lists by sort key; ties keep acquisition order
+    m_sortedLists.clear();
+    for (size_t i = 0; i < frame.usedLists; ++i) {
+        m_sortedLists.push_back(frame.lists[i].get());
+    }
+    std::stable_sort(m_sortedLists.begin(), m_sortedLists.end(),
+        [](const RenderCommandList* a, const RenderCommandList* b) {
+            return a->getSortKey() < b->getSortKey();
+        });
+
+    // State set by other renderers may have changed since the last frame
+    m_boundTexture = INVALID_HANDLE;
+    m_boundProgram = INVALID_HANDLE;
+    m_blendModeSet = false;
+
+    m_graphicsAPI->bindVertexArray(m_vertexArray);
+
+    for (const RenderCommandList* list : m_sortedLists) {
+        if (!list->isEmpty()) {
+            replayList(*list);
+            m_stats.commandLists++;
+        }
+    }
+
+    frame.pending = false;
+}
+
+void RenderCommandQueue::recordParallel(Core::ThreadPool& threadPool, const std::vector<RenderRecordJob>& jobs) {
+    beginRecording();
+
+    std::vector<std::future<void>> futures;
+    futures.reserve(jobs.size());
+
+    for (const auto& job : jobs) {
+        RenderCommandList& list = acquireList(job.first);
+        const auto& record = job.second;
+        futures.push_back(threadPool.submit([&list, &record]() {
+            record(list);
+        }));
+    }
+
+    // Replay the previous frame while this one is being recorded
+    submit();
+
+    for (auto& future : futures) {
+        future.wait();
+    }
+
+    endRecording();
+}
+
+void RenderCommandQueue::replayList(const RenderCommandList& list) {
+    const std::vector<float>& vertices = list.getVertices();
+    const std::vector<float>& matrices = list.getMatrices();
+
+    for (const RenderCommand& command : list.getCommands()) {
+        m_stats.commands++;
+
+        switch (command.type) {
+            case RenderCommandType::Clear:
+                m_graphicsAPI->clear(command.params[0], command.params[1], command.params[2], command.params[3]);
+                break;
+
+            case RenderCommandType::SetViewport:
+                m_graphicsAPI->setViewport(
+                    static_cast<int>(command.params[0]), static_cast<int>(command.params[1]),
+                    static_cast<int>(command.params[2]), static_cast<int>(command.params[3]));
+                break;
+
+            case RenderCommandType::SetBlendMode:
+                if (m_blendModeSet && m_blendMode == command.blendMode) {
+                    m_stats.skippedStateChanges++;
+                    break;
+                }
+                m_graphicsAPI->setBlendMode(command.blendMode);
+                m_blendMode = command.blendMode;
+                m_blendModeSet = true;
+                break;
+
+            case RenderCommandType::UseShaderProgram:
+                if (m_boundProgram == command.program) {
+                    m_stats.skippedStateChanges++;
+                    break;
+                }
+                m_graphicsAPI->useShaderProgram(command.program);
+                m_boundProgram = command.program;
+                break;
+
+            case RenderCommandType::SetViewProjection:
+                if (m_boundProgram != INVALID_HANDLE && command.first + 32 <= matrices.size()) {
+                    m_graphicsAPI->setUniformMatrix4(m_boundProgram, "projection", &matrices[command.first]);
+                    m_graphicsAPI->setUniformMatrix4(m_boundProgram, "view", &matrices[command.first + 16]);
+                }
+                break;
+
+            case RenderCommandType::DrawQuads: {
+                if (command.count == 0) {
+                    break;
+                }
+
+                if (m_boundTexture != command.texture) {
+                    m_graphicsAPI->bindTexture(command.texture, 0);
+                    m_boundTexture = command.texture;
+                    m_stats.textureBinds++;
+                } else {
+                    m_stats.skippedStateChanges++;
+                }
+
+                const float* data = vertices.data() +
+                    static_cast<size_t>(command.first) * RenderCommandList::FLOATS_PER_QUAD;
+                uint32_t remaining = command.count;
+                while (remaining > 0) {
+                    uint32_t quads = std::min(remaining, MAX_QUADS_PER_DRAW);
+                    drawQuads(data, quads);
+                    data += static_cast<size_t>(quads) * RenderCommandList::FLOATS_PER_QUAD;
+                    remaining -= quads;
+                }
+                break;
+            }
+        }
+    }
+}
+
+void RenderCommandQueue::drawQuads(const float* vertices, uint32_t quadCount) {
+    m_graphicsAPI->updateVertexBuffer(
+        m_vertexBuffer,
+        vertices,
+        static_cast<size_t>(quadCount) * RenderCommandList::FLOATS_PER_QUAD * sizeof(float)
+    );
+
+    m_graphicsAPI->drawElements(
+        PrimitiveType::Triangles,
+        static_cast<int>(quadCount * 6),
+        static_cast<uint32_t>(VertexDataType::UnsignedShort),
+        0
+    );
+
+    m_stats.drawCalls++;
+    m_stats.quads += quadCount;
+}
+
+} // namespace Graphics
+} // namespace RPGEngine
@@ -0,0 +1,284 @@
+#pragma once
+
+#include "IGraphicsAPI.h"
+#include "../core/ThreadPool.h"
+#include <memory>
+#include <vector>
+#include <mutex>
+#include <functional>
+#include <cstdint>
+
+namespace RPGEngine {
+namespace Graphics {
+
+/**
+ * Render command type enumeration
+ */
+enum class RenderCommandType : uint8_t {
+    Clear,
+    SetViewport,
+    SetBlendMode,
+    UseShaderProgram,
+    SetViewProjection,
+    DrawQuads
+};
+
+/**
+ * API-agnostic render command
+ * Commands never reference graphics API state directly, so they can be
+ * recorded on any thread and replayed later on the submission thread.
+ */
+struct RenderCommand {
+    RenderCommandType type;
+    BlendMode blendMode;
+    TextureHandle texture;
+    ShaderProgramHandle program;
+    uint32_t first;      // First quad (DrawQuads) or matrix offset (SetViewProjection)
+    uint32_t count;      // Quad count (DrawQuads)
+    float params[4];     // Clear color or viewport rectangle
+};
+
+/**
+ * Render command list
+ * Holds the commands and quad vertex data recorded for one layer or chunk
+ * range. A list is only ever written by a single thread at a time.
+ */
+class RenderCommandList {
+public:
+    // Vertex layout shared with SpriteRenderer: 3 position + 4 color + 2 texcoord
+    static const int VERTEX_SIZE = 9;
+    static const int VERTICES_PER_QUAD = 4;
+    static const int FLOATS_PER_QUAD = VERTEX_SIZE * VERTICES_PER_QUAD;
+
+    /**
+     * Constructor
+     * @param sortKey Key used to order this list when lists are merged
+     */
+    explicit RenderCommandList(uint64_t sortKey = 0);
+
+    /**
+     * Clear all recorded commands while keeping allocated storage
+     * @param sortKey New sort key
+     */
+    void reset(uint64_t sortKey);
+
+    /**
+     * Record a clear command
+     */
+    void clear(float r, float g, float b, float a);
+
+    /**
+     * Record a viewport change
+     */
+    void setViewport(int x, int y, int width, int height);
+
+    /**
+     * Record a blend mode change
+     * @param mode Blend mode
+     */
+    void setBlendMode(BlendMode mode);
+
+    /**
+     * Record a shader program change
+     * @param program Shader program handle
+     */
+    void useShaderProgram(ShaderProgramHandle program);
+
+    /**
+     * Record the projection and view matrices for the current program
+     * @param projection Projection matrix (16 floats)
+     * @param view View matrix (16 floats)
+     */
+    void setViewProjection(const float* projection, const float* view);
+
+    /**
+     * Reserve vertex storage for quads using the given texture
+     * Consecutive allocations with the same texture are merged into one draw.
+     * @param texture Texture handle
+     * @param quadCount Number of quads
+     * @return Pointer to quadCount * FLOATS_PER_QUAD floats to fill in
+     */
+    float* allocateQuads(TextureHandle texture, uint32_t quadCount);
+
+    /**
+     * Get the sort key
+     * @return Sort key
+     */
+    uint64_t getSortKey() const { return m_sortKey; }
+
+    /**
+     * Get the recorded commands
+     * @return Commands in recording order
+     */
+    const std::vector<RenderCommand>& getCommands() const { return m_commands; }
+
+    /**
+     * Get the recorded quad vertex data
+     * @return Vertex data
+     */
+    const std::vector<float>& getVertices() const { return m_vertices; }
+
+    /**
+     * Get the recorded matrix data
+     * @return Matrix data
+     */
+    const std::vector<float>& getMatrices() const { return m_matrices; }
+
+    /**
+     * Get the number of recorded quads
+     * @return Quad count
+     */
+    uint32_t getQuadCount() const { return static_cast<uint32_t>(m_vertices.size() / FLOATS_PER_QUAD); }
+
+    /**
+     * Check if the list has no commands
+     * @return true if the list is empty
+     */
+    bool isEmpty() const { return m_commands.empty(); }
+
+private:
+    RenderCommand& pushCommand(RenderCommandType type);
+
+    uint64_t m_sortKey;
+    std::vector<RenderCommand> m_commands;
+    std::vector<float> m_vertices;
+    std::vector<float> m_matrices;
+};
+
+/**
+ * Recording job: merge sort key plus the function that fills the list
+ */
+using RenderRecordJob = std::pair<uint64_t, std::function<void(RenderCommandList&)>>;
+
+/**
+ * Render queue statistics for the last submitted frame
+ */
+struct RenderQueueStats {
+    uint32_t commandLists;
+    uint32_t commands;
+    uint32_t drawCalls;
+    uint32_t quads;
+    uint32_t textureBinds;
+    uint32_t skippedStateChanges;
+
+    RenderQueueStats()
+        : commandLists(0), commands(0), drawCalls(0), quads(0),
+          textureBinds(0), skippedStateChanges(0) {}
+};
+
+/**
+ * Render command queue
+ * Collects command lists recorded by worker jobs, merges them by sort key and
+ * replays them to the graphics API from a single submission thread. Frames are
+ * double-buffered so that recording frame N can overlap submission of N-1.
+ */
+class RenderCommandQueue {
+public:
+    /**
+     * Maximum quads per draw call (limited by 16-bit indices)
+     */
+    static const uint32_t MAX_QUADS_PER_DRAW = 4096;
+
+    /**
+     * Constructor
+     * @param graphicsAPI Graphics API commands are replayed to
+     */
+    explicit RenderCommandQueue(std::shared_ptr<IGraphicsAPI> graphicsAPI);
+
+    /**
+     * Destructor
+     */
+    ~RenderCommandQueue();
+
+    /**
+     * Create the GPU buffers used for replay
+     * @return true if initialization was successful
+     */
+    bool initialize();
+
+    /**
+     * Release GPU buffers
+     */
+    void shutdown();
+
+    /**
+     * Start recording a new frame
+     */
+    void beginRecording();
+
+    /**
+     * Acquire a command list for the frame being recorded (thread-safe)
+     * @param sortKey Merge order of the list (e.g. layer << 32 | chunk)
+     * @return Command list owned by the queue, valid until the frame is submitted
+     */
+    RenderCommandList& acquireList(uint64_t sortKey);
+
+    /**
+     * Finish recording; the frame becomes the next one to be submitted
+     */
+    void endRecording();
+
+    /**
+     * Replay the most recently completed frame to the graphics API
+     * Must be called from the thread that owns the graphics context.
+     */
+    void submit();
+
+    /**
+     * Record a frame with parallel jobs while submitting the previous one
+     * Each job receives its own command list. The calling thread replays the
+     * previously recorded frame while the jobs run, then waits for them.
+     * @param threadPool Thread pool to run the jobs on
+     * @param jobs Pairs of sort key and recording function
+     */
+    void recordParallel(Core::ThreadPool& threadPool, const std::vector<RenderRecordJob>& jobs);
+
+    /**
+     * Get statistics for the last submitted frame
+     * @return Queue statistics
+     */
+    const RenderQueueStats& getStats() const { return m_stats; }
+
+    /**
+     * Check if the queue is initialized
+     * @return true if the queue is initialized
+     */
+    bool isInitialized() const { return m_initialized; }
+
+private:
+    struct Frame {
+        std::vector<std::unique_ptr<RenderCommandList>> lists;
+        size_t usedLists;
+        bool pending;
+
+        Frame() : usedLists(0), pending(false) {}
+    };
+
+    void replayList(const RenderCommandList& list);
+    void drawQuads(const float* vertices, uint32_t quadCount);
+
+    std::shared_ptr<IGraphicsAPI> m_graphicsAPI;
+
+    Frame m_frames[2];
+    int m_recordFrame;
+    int m_submitFrame;
+    std::mutex m_listMutex;
+
+    // Replay resources
+    BufferHandle m_vertexBuffer;
+    BufferHandle m_indexBuffer;
+    VertexArrayHandle m_vertexArray;
+
+    // Replay state tracking for redundant state elimination
+    TextureHandle m_boundTexture;
+    ShaderProgramHandle m_boundProgram;
+    BlendMode m_blendMode;
+    bool m_blendModeSet;
+
+    std::vector<const RenderCommandList*> m_sortedLists;
+    RenderQueueStats m_stats;
+    bool m_initialized;
+};
+
+} // namespace Graphics
+} // namespace RPGEngine
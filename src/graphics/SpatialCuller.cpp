@@ -0,0 +1,182 @@
+#include "SpatialCuller.h"
+#include "FrustumCuller.h"
+#include <algorithm>
+#include <cmath>
+
+namespace RPGEngine {
+namespace Graphics {
+
+SpatialCuller::SpatialCuller(float cellSize)
+    : m_cellSize(cellSize > 0.0f ? cellSize : 256.0f)
+    , m_maxHalfExtent(0.0f)
+    , m_proxyCount(0)
+    , m_lastCandidateCount(0)
+{
+}
+
+uint32_t SpatialCuller::addProxy(const Rect& bounds, uint32_t userIndex) {
+    uint32_t proxyId;
+    if (!m_freeProxies.empty()) {
+        proxyId = m_freeProxies.back();
+        m_freeProxies.pop_back();
+    } else {
+        proxyId = static_cast<uint32_t>(m_proxies.size());
+        m_proxies.emplace_back();
+    }
+
+    Proxy& proxy = m_proxies[proxyId];
+    proxy.bounds = bounds;
+    proxy.userIndex = userIndex;
+    proxy.alive = true;
+
+    m_maxHalfExtent = std::max(m_maxHalfExtent, std::max(bounds.width, bounds.height) * 0.5f);
+
+    insertIntoCell(proxyId);
+    m_proxyCount++;
+    return proxyId;
+}
+
+void SpatialCuller::updateProxy(uint32_t proxyId, const Rect& bounds) {
+    if (proxyId >= m_proxies.size() || !m_proxies[proxyId].alive) {
+        return;
+    }
+
+    Proxy& proxy = m_proxies[proxyId];
+    proxy.bounds = bounds;
+    m_maxHalfExtent = std::max(m_maxHalfExtent, std::max(bounds.width, bounds.height) * 0.5f);
+
+    // Only touch the cells when the center moved to another cell
+    int64_t key = getCellKey(bounds);
+    if (key != proxy.cellKey) {
+        removeFromCell(proxyId);
+        insertIntoCell(proxyId);
+    }
+}
+
+bool SpatialCuller::removeProxy(uint32_t proxyId) {
+    if (proxyId >= m_proxies.size() || !m_proxies[proxyId].alive) {
+        return false;
+    }
+
+    removeFromCell(proxyId);
+    m_proxies[proxyId].alive = false;
+    m_freeProxies.push_back(proxyId);
+    m_proxyCount--;
+    return true;
+}
+
+void SpatialCuller::clear() {
+    m_proxies.clear();
+    m_freeProxies.clear();
+    m_cells.clear();
+    m_proxyCount = 0;
+    m_maxHalfExtent = 0.0f;
+}
+
+void SpatialCuller::buildFromSprites(const std::vector<Sprite>& sprites) {
+    clear();
+    m_proxies.reserve(sprites.size());
+
+    for (size_t i = 0; i < sprites.size(); ++i) {
+        addProxy(FrustumCuller::getSpriteBounds(sprites[i]), static_cast<uint32_t>(i));
+    }
+}
+
+void SpatialCuller::query(const Rect& view, std::vector<uint32_t>& userIndices) const {
+    userIndices.clear();
+    m_lastCandidateCount = 0;
+
+    if (m_proxyCount == 0) {
+        return;
+    }
+
+    // Centers of overlapping proxies lie within the view grown by the loose margin
+    float margin = m_maxHalfExtent;
+    double minX = std::floor((view.x - margin) / m_cellSize);
+    double minY = std::floor((view.y - margin) / m_cellSize);
+    double maxX = std::floor((view.x + view.width + margin) / m_cellSize);
+    double maxY = std::floor((view.y + view.height + margin) / m_cellSize);
+
+    // Walk the occupied cells instead when the view covers more cells than exist
+    double rangeCells = (maxX - minX + 1.0) * (maxY - minY + 1.0);
+
+    auto testCell = [&](const std::vector<uint32_t>& cell) {
+        for (uint32_t proxyId : cell) {
+            const Rect& bounds = m_proxies[proxyId].bounds;
+            m_lastCandidateCount++;
+
+            if (!(bounds.x + bounds.width < view.x ||
+                  bounds.x > view.x + view.width ||
+                  bounds.y + bounds.height < view.y ||
+                  bounds.y > view.y + view.height)) {
+                userIndices.push_back(m_proxies[proxyId].userIndex);
+            }
+        }
+    };
+
+    if (rangeCells > static_cast<double>(m_cells.size())) {
+        for (const auto& pair : m_cells) {
+            testCell(pair.second);
+        }
+    } else {
+        int minCellX = static_cast<int>(minX);
+        int minCellY = static_cast<int>(minY);
+        int maxCellX = static_cast<int>(maxX);
+        int maxCellY = static_cast<int>(maxY);
+
+        for (int y = minCellY; y <= maxCellY; ++y) {
+            for (int x = minCellX; x <= maxCellX; ++x) {
+                auto it = m_cells.find(makeKey(x, y));
+                if (it != m_cells.end()) {
+                    testCell(it->second);
+                }
+            }
+        }
+    }
+
+    // Keep submission order stable regardless of cell iteration order
+    std::sort(userIndices.begin(), userIndices.end());
+}
+
+int64_t SpatialCuller::getCellKey(const Rect& bounds) const {
+    float centerX = bounds.x + bounds.width * 0.5f;
+    float centerY = bounds.y + bounds.height * 0.5f;
+    return makeKey(static_cast<int>(std::floor(centerX / m_cellSize)),
+                   static_cast<int>(std::floor(centerY / m_cellSize)));
+}
+
+int64_t SpatialCuller::makeKey(int cellX, int cellY) const {
+    return static_cast<int64_t>((static_cast<uint64_t>(static_cast<uint32_t>(cellX)) << 32) | static_cast<uint32_t>(cellY));
+}
+
+void SpatialCuller::insertIntoCell(uint32_t proxyId) {
+    Proxy& proxy = m_proxies[proxyId];
+    proxy.cellKey = getCellKey(proxy.bounds);
+
+    std::vector<uint32_t>& cell = m_cells[proxy.cellKey];
+    proxy.slot = static_cast<uint32_t>(cell.size());
+    cell.push_back(proxyId);
+}
+
+void SpatialCuller::removeFromCell(uint32_t proxyId) {
+    Proxy& proxy = m_proxies[proxyId];
+
+    auto it = m_cells.find(proxy.cellKey);
+    if (it == m_cells.end()) {
+        return;
+    }
+
+    // Swap-remove and fix up the slot of the proxy that moved
+    std::vector<uint32_t>& cell = it->second;
+    uint32_t last = cell.back();
+    cell[proxy.slot] = last;
+    m_proxies[last].slot = proxy.slot;
+    cell.pop_back();
+
+    if (cell.empty()) {
+        m_cells.erase(it);
+    }
+}
+
+} // namespace Graphics
+} // namespace RPGEngine
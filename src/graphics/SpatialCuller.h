@@ -0,0 +1,121 @@
+#pragma once
+
+#include "Sprite.h"
+#include <vector>
+#include <unordered_map>
+#include <cstdint>
+
+namespace RPGEngine {
+namespace Graphics {
+
+/**
+ * Loose grid used to cull render proxies
+ * Each proxy is stored in the single cell that contains its center. Queries
+ * expand the view rectangle by the largest proxy half-extent, so the cost of a
+ * query depends on the number of cells and proxies on screen rather than on
+ * the total number of proxies in the world.
+ */
+class SpatialCuller {
+public:
+    /**
+     * Invalid proxy ID constant
+     */
+    static const uint32_t INVALID_PROXY = 0xFFFFFFFF;
+
+    /**
+     * Constructor
+     * @param cellSize Cell size in world units
+     */
+    explicit SpatialCuller(float cellSize = 256.0f);
+
+    /**
+     * Add a proxy
+     * @param bounds Proxy bounds in world coordinates
+     * @param userIndex Value returned by queries (e.g. index into a sprite array)
+     * @return Proxy ID
+     */
+    uint32_t addProxy(const Rect& bounds, uint32_t userIndex);
+
+    /**
+     * Move or resize a proxy
+     * @param proxyId Proxy ID
+     * @param bounds New bounds in world coordinates
+     */
+    void updateProxy(uint32_t proxyId, const Rect& bounds);
+
+    /**
+     * Remove a proxy
+     * @param proxyId Proxy ID
+     * @return true if the proxy was removed
+     */
+    bool removeProxy(uint32_t proxyId);
+
+    /**
+     * Remove all proxies
+     */
+    void clear();
+
+    /**
+     * Rebuild the grid from a sprite list, using sprite indices as user indices
+     * @param sprites Sprites to index
+     */
+    void buildFromSprites(const std::vector<Sprite>& sprites);
+
+    /**
+     * Collect the user indices of all proxies overlapping a rectangle
+     * @param view Query rectangle in world coordinates
+     * @param userIndices Output list (cleared first, sorted ascending)
+     */
+    void query(const Rect& view, std::vector<uint32_t>& userIndices) const;
+
+    /**
+     * Get the number of proxies
+     * @return Proxy count
+     */
+    size_t getProxyCount() const { return m_proxyCount; }
+
+    /**
+     * Get the number of non-empty cells
+     * @return Cell count
+     */
+    size_t getCellCount() const { return m_cells.size(); }
+
+    /**
+     * Get the number of candidates tested by the last query
+     * @return Candidate count
+     */
+    size_t getLastCandidateCount() const { return m_lastCandidateCount; }
+
+    /**
+     * Get the cell size
+     * @return Cell size
+     */
+    float getCellSize() const { return m_cellSize; }
+
+private:
+    struct Proxy {
+        Rect bounds;
+        uint32_t userIndex;
+        int64_t cellKey;
+        uint32_t slot;      // Index inside the cell's proxy list
+        bool alive;
+    };
+
+    int64_t getCellKey(const Rect& bounds) const;
+    int64_t makeKey(int cellX, int cellY) const;
+    void insertIntoCell(uint32_t proxyId);
+    void removeFromCell(uint32_t proxyId);
+
+    float m_cellSize;
+    float m_maxHalfExtent;
+
+    std::vector<Proxy> m_proxies;
+    std::vector<uint32_t> m_freeProxies;
+    std::unordered_map<int64_t, std::vector<uint32_t>> m_cells;
+    size_t m_proxyCount;
+
+    mutable size_t m_lastCandidateCount;
+};
+
+} // namespace Graphics
+} // namespace RPGEngine
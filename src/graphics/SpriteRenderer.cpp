@@ -1,7 +1,10 @@
 #include "SpriteRenderer.h"
 #include "Texture.h"
+#include "SpriteSoABuffer.h"
 #include <iostream>
 #include <cmath>
+#include <algorithm>
+#include <cstring>
 
 namespace RPGEngine {
 namespace Graphics {
@@ -47,6 +50,7 @@ SpriteRenderer::SpriteRenderer(std::shared_ptr<IGraphicsAPI> graphicsAPI, std::s
     , m_graphicsAPI(graphicsAPI)
     , m_shaderManager(shaderManager)
     , m_currentBatch(nullptr)
+    , m_pendingBatch(nullptr)
     , m_whiteTexture(nullptr)
     , m_shaderName("sprite")
     , m_isDrawing(false)
@@ -116,6 +120,8 @@ void SpriteRenderer::onShutdown() {
     
     m_batches.clear();
     m_currentBatch = nullptr;
+    m_pendingSprites.clear();
+    m_pendingBatch = nullptr;
     
     std::cout << "SpriteRenderer shutdown" << std::endl;
 }
@@ -157,6 +163,9 @@ void SpriteRenderer::end() {
         return;
     }
     
+    // Sorting moves batches, so expand staged sprites first
+    writePendingSprites();
+    
     // Optimize batches before final flush
     optimizeBatches();
     
@@ -184,9 +193,33 @@ void SpriteRenderer::drawSprites(const std::vector<Sprite>& sprites) {
         }
     }
     
-    // Draw visible sprites
+    // Draw visible sprites (already culled, so skip the per-sprite test)
     for (const Sprite* sprite : visibleSprites) {
-        drawSprite(*sprite);
+        addSprite(*sprite);
+    }
+}
+
+void SpriteRenderer::drawSprites(const std::vector<Sprite>& sprites, const SpatialCuller& index) {
+    if (!m_isDrawing) {
+        std::cerr << "SpriteRenderer::drawSprites() called without begin()" << std::endl;
+        return;
+    }
+    
+    // Without a camera nothing is culled; the frustum would be a stale one
+    if (!m_camera) {
+        for (const auto& sprite : sprites) {
+            addSprite(sprite);
+        }
+        return;
+    }
+    
+    // Only the proxies near the view are tested
+    m_frustumCuller.cullIndexed(index, m_visibleIndices);
+    
+    for (uint32_t i : m_visibleIndices) {
+        if (i < sprites.size()) {
+            addSprite(sprites[i]);
+        }
     }
 }
 
@@ -205,6 +238,10 @@ void SpriteRenderer::drawSprite(const Sprite& sprite) {
         return; // Skip invisible sprites
     }
     
+    addSprite(sprite);
+}
+
+void SpriteRenderer::addSprite(const Sprite& sprite) {
     // Get sprite properties
     std::shared_ptr<Texture> texture = sprite.getTexture();
     if (!texture || !texture->isValid()) {
@@ -337,6 +374,103 @@ void SpriteRenderer::drawRectangle(float x, float y, float width, float height,
     }
 }
 
+void SpriteRenderer::drawTextMesh(std::shared_ptr<Texture> atlas, const TextMesh& mesh, float x, float y, const Color& color) {
+    drawTextQuads(atlas, mesh.quads.data(), mesh.quads.size(), x, y, color);
+}
+
+void SpriteRenderer::drawTextQuads(std::shared_ptr<Texture> atlas, const TextQuad* quads, size_t count,
+                                   float x, float y, const Color& color) {
+    if (!m_isDrawing) {
+        std::cerr << "SpriteRenderer::drawTextQuads() called without begin()" << std::endl;
+        return;
+    }
+    
+    if (!atlas || !atlas->isValid() || !quads || count == 0) {
+        return;
+    }
+    
+    // Keep vertex order in step with the indices already written
+    writePendingSprites();
+    
+    SpriteBatch* batch = findBatch(atlas);
+    if (!batch) {
+        batch = createBatch(atlas);
+    }
+    
+    for (size_t i = 0; i < count; ++i) {
+        const TextQuad& quad = quads[i];
+        
+        size_t offset = batch->vertices.size();
+        batch->vertices.resize(offset + VERTICES_PER_SPRITE * VERTEX_SIZE);
+        writeQuadVertices(batch->vertices.data() + offset,
+                          x + quad.x, y + quad.y, quad.width, quad.height,
+                          quad.u0, quad.v0, quad.u1, quad.v1,
+                          color, 0.0f, 0.0f, 0.0f);
+        
+        uint16_t baseIndex = batch->spriteCount * VERTICES_PER_SPRITE;
+        batch->indices.push_back(baseIndex + 0);
+        batch->indices.push_back(baseIndex + 1);
+        batch->indices.push_back(baseIndex + 2);
+        batch->indices.push_back(baseIndex + 0);
+        batch->indices.push_back(baseIndex + 2);
+        batch->indices.push_back(baseIndex + 3);
+        
+        // A full batch is flushed and refilled in place
+        if (++batch->spriteCount >= MAX_SPRITES_PER_BATCH) {
+            flushBatch();
+        }
+    }
+}
+
+void SpriteRenderer::drawQuadVertices(std::shared_ptr<Texture> texture, const float* vertices, size_t quadCount) {
+    if (!m_isDrawing) {
+        std::cerr << "SpriteRenderer::drawQuadVertices() called without begin()" << std::endl;
+        return;
+    }
+    
+    if (!texture || !texture->isValid() || !vertices || quadCount == 0) {
+        return;
+    }
+    
+    // Keep vertex order in step with the indices already written
+    writePendingSprites();
+    
+    SpriteBatch* batch = findBatch(texture);
+    if (!batch) {
+        batch = createBatch(texture);
+    }
+    
+    const size_t quadFloats = VERTICES_PER_SPRITE * VERTEX_SIZE;
+    
+    // Copy as many quads as the batch has room for, flush, and continue
+    while (quadCount > 0) {
+        size_t room = static_cast<size_t>(MAX_SPRITES_PER_BATCH - batch->spriteCount);
+        size_t count = std::min(room, quadCount);
+        
+        size_t offset = batch->vertices.size();
+        batch->vertices.resize(offset + count * quadFloats);
+        std::memcpy(batch->vertices.data() + offset, vertices, count * quadFloats * sizeof(float));
+        
+        for (size_t i = 0; i < count; ++i) {
+            uint16_t baseIndex = static_cast<uint16_t>((batch->spriteCount + i) * VERTICES_PER_SPRITE);
+            batch->indices.push_back(baseIndex + 0);
+            batch->indices.push_back(baseIndex + 1);
+            batch->indices.push_back(baseIndex + 2);
+            batch->indices.push_back(baseIndex + 0);
+            batch->indices.push_back(baseIndex + 2);
+            batch->indices.push_back(baseIndex + 3);
+        }
+        
+        batch->spriteCount += static_cast<int>(count);
+        vertices += count * quadFloats;
+        quadCount -= count;
+        
+        if (batch->spriteCount >= MAX_SPRITES_PER_BATCH) {
+            flushBatch();
+        }
+    }
+}
+
 void SpriteRenderer::setProjectionMatrix(const float* matrix) {
     if (!matrix) {
         return;
@@ -393,6 +527,8 @@ void SpriteRenderer::setOrthographicProjection(float left, float right, float bo
 }
 
 void SpriteRenderer::flushBatch() {
+    writePendingSprites();
+    
     if (!m_currentBatch || m_currentBatch->spriteCount == 0) {
         return;
     }
@@ -439,6 +575,9 @@ SpriteBatch* SpriteRenderer::createBatch(std::shared_ptr<Texture> texture) {
         flushBatch();
     }
     
+    // Growing m_batches moves the batch the staged sprites belong to
+    writePendingSprites();
+    
     // Create new batch
     m_batches.emplace_back();
     SpriteBatch& batch = m_batches.back();
@@ -562,6 +701,52 @@ void SpriteRenderer::addSpriteToBatch(SpriteBatch* batch, float x, float y, floa
         std::swap(texTop, texBottom);
     }
     
+    // Stage the quad; the vertex kernel expands the staged run in one call
+    if (m_pendingBatch != batch) {
+        writePendingSprites();
+        m_pendingBatch = batch;
+    }
+    m_pendingSprites.push(batch->texture ? batch->texture->getHandle() : INVALID_HANDLE,
+                          x, y, width, height, rotation, originX, originY,
+                          texLeft, texTop, texRight, texBottom, color);
+    
+    // Add indices
+    uint16_t baseIndex = batch->spriteCount * VERTICES_PER_SPRITE;
+    batch->indices.push_back(baseIndex + 0);
+    batch->indices.push_back(baseIndex + 1);
+    batch->indices.push_back(baseIndex + 2);
+    batch->indices.push_back(baseIndex + 0);
+    batch->indices.push_back(baseIndex + 2);
+    batch->indices.push_back(baseIndex + 3);
+    
+    // Increment sprite count
+    batch->spriteCount++;
+    
+    // Flush if batch is full
+    if (batch->spriteCount >= MAX_SPRITES_PER_BATCH) {
+        flushBatch();
+    }
+}
+
+void SpriteRenderer::writePendingSprites() {
+    size_t count = m_pendingSprites.size();
+    if (count == 0) {
+        return;
+    }
+    
+    SpriteBatch* batch = m_pendingBatch;
+    size_t offset = batch->vertices.size();
+    batch->vertices.resize(offset + count * SpriteVertexKernel::FLOATS_PER_SPRITE);
+    SpriteVertexKernel::generate(m_pendingSprites.view(0, count), batch->vertices.data() + offset,
+                                 count * SpriteVertexKernel::FLOATS_PER_SPRITE);
+    
+    m_pendingSprites.clear();
+    m_pendingBatch = nullptr;
+}
+
+void SpriteRenderer::writeQuadVertices(float* out, float x, float y, float width, float height,
+                                       float texLeft, float texTop, float texRight, float texBottom,
+                                       const Color& color, float rotation, float originX, float originY) {
     // Calculate vertex positions
     float originOffsetX = width * originX;
     float originOffsetY = height * originY;
@@ -572,135 +757,115 @@ void SpriteRenderer::addSpriteToBatch(SpriteBatch* batch, float x, float y, floa
     float x1 = width - originOffsetX;
     float y1 = height - originOffsetY;
     
+    // Corner positions: bottom-left, bottom-right, top-right, top-left
+    float px[4] = { x0, x1, x1, x0 };
+    float py[4] = { y0, y0, y1, y1 };
+    
     // Apply rotation if needed
     if (rotation != 0.0f) {
         float radians = rotation * 3.14159f / 180.0f;
         float cos = std::cos(radians);
         float sin = std::sin(radians);
         
-        // Rotated positions
-        float rx0 = cos * x0 - sin * y0;
-        float ry0 = sin * x0 + cos * y0;
-        float rx1 = cos * x1 - sin * y0;
-        float ry1 = sin * x1 + cos * y0;
-        float rx2 = cos * x1 - sin * y1;
-        float ry2 = sin * x1 + cos * y1;
-        float rx3 = cos * x0 - sin * y1;
-        float ry3 = sin * x0 + cos * y1;
-        
-        // Update positions
-        x0 = rx0;
-        y0 = ry0;
-        x1 = rx2;
-        y1 = ry2;
-        
-        // Add vertices (position, color, texcoord)
-        // Bottom-left
-        batch->vertices.push_back(x + rx0);
-        batch->vertices.push_back(y + ry0);
-        batch->vertices.push_back(0.0f);
-        batch->vertices.push_back(color.r);
-        batch->vertices.push_back(color.g);
-        batch->vertices.push_back(color.b);
-        batch->vertices.push_back(color.a);
-        batch->vertices.push_back(texLeft);
-        batch->vertices.push_back(texTop);
-        
-        // Bottom-right
-        batch->vertices.push_back(x + rx1);
-        batch->vertices.push_back(y + ry1);
-        batch->vertices.push_back(0.0f);
-        batch->vertices.push_back(color.r);
-        batch->vertices.push_back(color.g);
-        batch->vertices.push_back(color.b);
-        batch->vertices.push_back(color.a);
-        batch->vertices.push_back(texRight);
-        batch->vertices.push_back(texTop);
-        
-        // Top-right
-        batch->vertices.push_back(x + rx2);
-        batch->vertices.push_back(y + ry2);
-        batch->vertices.push_back(0.0f);
-        batch->vertices.push_back(color.r);
-        batch->vertices.push_back(color.g);
-        batch->vertices.push_back(color.b);
-        batch->vertices.push_back(color.a);
-        batch->vertices.push_back(texRight);
-        batch->vertices.push_back(texBottom);
+        for (int i = 0; i < 4; ++i) {
+            float rx = cos * px[i] - sin * py[i];
+            float ry = sin * px[i] + cos * py[i];
+            px[i] = rx;
+            py[i] = ry;
+        }
+    }
+    
+    const float u[4] = { texLeft, texRight, texRight, texLeft };
+    const float v[4] = { texTop, texTop, texBottom, texBottom };
+    
+    // Add vertices (position, color, texcoord)
+    for (int i = 0; i < 4; ++i) {
+        *out++ = x + px[i];
+        *out++ = y + py[i];
+        *out++ = 0.0f;
+        *out++ = color.r;
+        *out++ = color.g;
+        *out++ = color.b;
+        *out++ = color.a;
+        *out++ = u[i];
+        *out++ = v[i];
+    }
+}
+
+void SpriteRenderer::recordViewState(RenderCommandList& list) const {
+    list.useShaderProgram(m_shaderManager ? m_shaderManager->getShader(m_shaderName) : INVALID_HANDLE);
+    list.setViewProjection(m_projectionMatrix, m_viewMatrix);
+    list.setBlendMode(BlendMode::Alpha);
+}
+
+void SpriteRenderer::recordSprites(const std::vector<Sprite>& sprites, RenderCommandList& list) const {
+    recordSprites(sprites, 0, sprites.size(), list);
+}
+
+void SpriteRenderer::recordSprites(const std::vector<Sprite>& sprites, size_t first, size_t count,
+                                   RenderCommandList& list) const {
+    size_t last = std::min(sprites.size(), first + count);
+    if (first >= last) {
+        return;
+    }
+    
+    // Gather visible sprites into SoA arrays for the vertex kernel. Record
+    // jobs run this concurrently, so each worker reuses its own buffer.
+    static thread_local SpriteSoABuffer soa;
+    soa.clear();
+    soa.reserve(last - first);
+    
+    for (size_t i = first; i < last; ++i) {
+        const Sprite& sprite = sprites[i];
         
-        // Top-left
-        batch->vertices.push_back(x + rx3);
-        batch->vertices.push_back(y + ry3);
-        batch->vertices.push_back(0.0f);
-        batch->vertices.push_back(color.r);
-        batch->vertices.push_back(color.g);
-        batch->vertices.push_back(color.b);
-        batch->vertices.push_back(color.a);
-        batch->vertices.push_back(texLeft);
-        batch->vertices.push_back(texBottom);
-    } else {
-        // Add vertices (position, color, texcoord)
-        // Bottom-left
-        batch->vertices.push_back(x + x0);
-        batch->vertices.push_back(y + y0);
-        batch->vertices.push_back(0.0f);
-        batch->vertices.push_back(color.r);
-        batch->vertices.push_back(color.g);
-        batch->vertices.push_back(color.b);
-        batch->vertices.push_back(color.a);
-        batch->vertices.push_back(texLeft);
-        batch->vertices.push_back(texTop);
+        if (!sprite.isVisible()) {
+            continue;
+        }
         
-        // Bottom-right
-        batch->vertices.push_back(x + x1);
-        batch->vertices.push_back(y + y0);
-        batch->vertices.push_back(0.0f);
-        batch->vertices.push_back(color.r);
-        batch->vertices.push_back(color.g);
-        batch->vertices.push_back(color.b);
-        batch->vertices.push_back(color.a);
-        batch->vertices.push_back(texRight);
-        batch->vertices.push_back(texTop);
+        if (m_camera && !m_frustumCuller.isSpriteVisible(sprite)) {
+            continue;
+        }
         
-        // Top-right
-        batch->vertices.push_back(x + x1);
-        batch->vertices.push_back(y + y1);
-        batch->vertices.push_back(0.0f);
-        batch->vertices.push_back(color.r);
-        batch->vertices.push_back(color.g);
-        batch->vertices.push_back(color.b);
-        batch->vertices.push_back(color.a);
-        batch->vertices.push_back(texRight);
-        batch->vertices.push_back(texBottom);
+        std::shared_ptr<Texture> texture = sprite.getTexture();
+        if (!texture || !texture->isValid()) {
+            continue;
+        }
         
-        // Top-left
-        batch->vertices.push_back(x + x0);
-        batch->vertices.push_back(y + y1);
-        batch->vertices.push_back(0.0f);
-        batch->vertices.push_back(color.r);
-        batch->vertices.push_back(color.g);
-        batch->vertices.push_back(color.b);
-        batch->vertices.push_back(color.a);
-        batch->vertices.push_back(texLeft);
-        batch->vertices.push_back(texBottom);
+        soa.push(sprite, *texture);
     }
     
-    // Add indices
-    uint16_t baseIndex = batch->spriteCount * VERTICES_PER_SPRITE;
-    batch->indices.push_back(baseIndex + 0);
-    batch->indices.push_back(baseIndex + 1);
-    batch->indices.push_back(baseIndex + 2);
-    batch->indices.push_back(baseIndex + 0);
-    batch->indices.push_back(baseIndex + 2);
-    batch->indices.push_back(baseIndex + 3);
+    soa.record(list);
+}
+
+void SpriteRenderer::recordSprites(const std::vector<Sprite>& sprites, const SpatialCuller& index,
+                                   RenderCommandList& list) const {
+    if (!m_camera) {
+        recordSprites(sprites, list);
+        return;
+    }
     
-    // Increment sprite count
-    batch->spriteCount++;
+    static thread_local std::vector<uint32_t> visibleIndices;
+    visibleIndices.clear();
+    m_frustumCuller.cullIndexed(index, visibleIndices);
     
-    // Flush if batch is full
-    if (batch->spriteCount >= MAX_SPRITES_PER_BATCH) {
-        flushBatch();
+    static thread_local SpriteSoABuffer soa;
+    soa.clear();
+    soa.reserve(visibleIndices.size());
+    
+    for (uint32_t i : visibleIndices) {
+        if (i >= sprites.size() || !sprites[i].isVisible()) {
+            continue;
+        }
+        
+        std::shared_ptr<Texture> texture = sprites[i].getTexture();
+        if (!texture || !texture->isValid()) {
+            continue;
+        }
+        
+        soa.push(sprites[i], *texture);
     }
+    
+    soa.record(list);
 }
 
 bool SpriteRenderer::createWhiteTexture() {
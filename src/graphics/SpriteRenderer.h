@@ -4,6 +4,9 @@
 #include "ShaderManager.h"
 #include "Sprite.h"
 #include "FrustumCuller.h"
+#include "RenderCommandBuffer.h"
+#include "TextLayout.h"
+#include "SpriteSoABuffer.h"
 #include "../systems/System.h"
 #include "../core/MemoryPool.h"
 #include <memory>
@@ -36,6 +39,10 @@ struct SpriteBatch {
  */
 class SpriteRenderer : public System {
 public:
+    // Vertex layout written by writeQuadVertices
+    static const int VERTICES_PER_SPRITE = 4;
+    static const int VERTEX_SIZE = 9; // 3 position + 4 color + 2 texcoord
+    
     /**
      * Constructor
      * @param graphicsAPI Graphics API to use
@@ -89,6 +96,15 @@ public:
      */
     void drawSprites(const std::vector<Sprite>& sprites);
     
+    /**
+     * Draw the sprites a spatial index reports as visible
+     * Culling cost scales with what is on screen rather than the world size.
+     * Without a camera every sprite is drawn.
+     * @param sprites Sprites the index was built over
+     * @param index Spatial index whose user indices refer to sprites
+     */
+    void drawSprites(const std::vector<Sprite>& sprites, const SpatialCuller& index);
+    
     /**
      * Set the camera for frustum culling
      * @param camera Camera to use for culling
@@ -133,6 +149,65 @@ public:
      */
     void drawRectangle(float x, float y, float width, float height, const Color& color, bool filled = true);
     
+    /**
+     * Draw laid out text
+     * Glyph quads go into the atlas texture's batch, so text and anything
+     * else drawn from the same atlas share draw calls.
+     * @param atlas Font atlas texture
+     * @param mesh Laid out text
+     * @param x X position of the text block's top-left corner
+     * @param y Y position of the text block's top-left corner
+     * @param color Text color
+     */
+    void drawTextMesh(std::shared_ptr<Texture> atlas, const TextMesh& mesh, float x, float y, const Color& color = Color::White);
+    
+    /**
+     * Draw quads from an atlas with normalized texture coordinates
+     * @param atlas Atlas texture
+     * @param quads Quads relative to (x, y)
+     * @param count Number of quads
+     * @param x X offset
+     * @param y Y offset
+     * @param color Color
+     */
+    void drawTextQuads(std::shared_ptr<Texture> atlas, const TextQuad* quads, size_t count,
+                       float x, float y, const Color& color = Color::White);
+    
+    /**
+     * Draw prebuilt quad vertices
+     * Lets callers cache generated geometry and resubmit it unchanged.
+     * @param texture Texture the quads sample
+     * @param vertices quadCount * VERTICES_PER_SPRITE * VERTEX_SIZE floats (see writeQuadVertices)
+     * @param quadCount Number of quads
+     */
+    void drawQuadVertices(std::shared_ptr<Texture> texture, const float* vertices, size_t quadCount);
+    
+    /**
+     * Write the four vertices of a quad
+     * @param out Output for VERTICES_PER_SPRITE * VERTEX_SIZE floats
+     * @param x X position
+     * @param y Y position
+     * @param width Width
+     * @param height Height
+     * @param texLeft Left texture coordinate (normalized, flip applied)
+     * @param texTop Top texture coordinate
+     * @param texRight Right texture coordinate
+     * @param texBottom Bottom texture coordinate
+     * @param color Color
+     * @param rotation Rotation angle
+     * @param originX Origin X (0-1)
+     * @param originY Origin Y (0-1)
+     */
+    static void writeQuadVertices(float* out, float x, float y, float width, float height,
+                                  float texLeft, float texTop, float texRight, float texBottom,
+                                  const Color& color, float rotation, float originX, float originY);
+    
+    /**
+     * Get the graphics API used by the renderer
+     * @return Graphics API
+     */
+    std::shared_ptr<IGraphicsAPI> getGraphicsAPI() const { return m_graphicsAPI; }
+    
     /**
      * Set the projection matrix
      * @param matrix Projection matrix
@@ -156,7 +231,47 @@ public:
      */
     void setOrthographicProjection(float left, float right, float bottom, float top, float near = -1.0f, float far = 1.0f);
     
+    /**
+     * Record the shader, matrices and blend state used for sprites
+     * @param list Command list to record into
+     */
+    void recordViewState(RenderCommandList& list) const;
+    
+    /**
+     * Record sprites into a command list without touching the graphics API
+     * Safe to call from worker threads, one list per thread.
+     * @param sprites Sprites to record (culled against the current camera)
+     * @param list Command list to record into
+     */
+    void recordSprites(const std::vector<Sprite>& sprites, RenderCommandList& list) const;
+    
+    /**
+     * Record a range of sprites into a command list
+     * @param sprites Sprites to record
+     * @param first Index of the first sprite
+     * @param count Number of sprites
+     * @param list Command list to record into
+     */
+    void recordSprites(const std::vector<Sprite>& sprites, size_t first, size_t count,
+                       RenderCommandList& list) const;
+    
+    /**
+     * Record the sprites a spatial index reports as visible
+     * Without a camera every sprite is recorded.
+     * @param sprites Sprites the index was built over
+     * @param index Spatial index whose user indices refer to sprites
+     * @param list Command list to record into
+     */
+    void recordSprites(const std::vector<Sprite>& sprites, const SpatialCuller& index,
+                       RenderCommandList& list) const;
+    
 private:
+    /**
+     * Add a sprite to its batch without culling
+     * @param sprite Sprite to add
+     */
+    void addSprite(const Sprite& sprite);
+    
     /**
      * Flush the current batch
      */
@@ -205,6 +320,11 @@ private:
                          float originX = 0.5f, float originY = 0.5f,
                          bool flipX = false, bool flipY = false);
     
+    /**
+     * Generate vertices for the staged sprites into their batch
+     */
+    void writePendingSprites();
+    
     /**
      * Create a white texture for drawing shapes
      * @return true if texture was created successfully
@@ -230,9 +350,14 @@ private:
     // Current batch
     SpriteBatch* m_currentBatch;
     
+    // Sprites staged for the vertex kernel, all in one batch
+    SpriteSoABuffer m_pendingSprites;
+    SpriteBatch* m_pendingBatch;
+    
     // Frustum culling
     FrustumCuller m_frustumCuller;
     const Camera* m_camera;
+    std::vector<uint32_t> m_visibleIndices;
     
     // Memory pools for optimization
     Core::MemoryPool<float> m_vertexPool;
@@ -250,9 +375,7 @@ private:
     
     // Batch settings (increased for better performance)
     static const int MAX_SPRITES_PER_BATCH = 2000;
-    static const int VERTICES_PER_SPRITE = 4;
     static const int INDICES_PER_SPRITE = 6;
-    static const int VERTEX_SIZE = 9; // 3 position + 4 color + 2 texcoord
     
     // Rendering state
     bool m_isDrawing;
@@ -0,0 +1,108 @@
+#include "SpriteSoABuffer.h"
+#include "Texture.h"
+#include "RenderCommandBuffer.h"
+#include <algorithm>
+
+namespace RPGEngine {
+namespace Graphics {
+
+void SpriteSoABuffer::reserve(size_t count) {
+    for (auto* column : { &x, &y, &width, &height, &rotation, &originX, &originY,
+                          &u0, &v0, &u1, &v1, &r, &g, &b, &a }) {
+        column->reserve(count);
+    }
+    textures.reserve(count);
+}
+
+void SpriteSoABuffer::clear() {
+    for (auto* column : { &x, &y, &width, &height, &rotation, &originX, &originY,
+                          &u0, &v0, &u1, &v1, &r, &g, &b, &a }) {
+        column->clear();
+    }
+    textures.clear();
+}
+
+void SpriteSoABuffer::push(const Sprite& sprite, const Texture& texture) {
+    float px, py, scaleX, scaleY, ox, oy;
+    bool flipX, flipY;
+    sprite.getPosition(px, py);
+    sprite.getScale(scaleX, scaleY);
+    sprite.getOrigin(ox, oy);
+    sprite.getFlip(flipX, flipY);
+    
+    const Rect& textureRect = sprite.getTextureRect();
+    
+    float texW = static_cast<float>(texture.getWidth());
+    float texH = static_cast<float>(texture.getHeight());
+    float texLeft = textureRect.x;
+    float texTop = textureRect.y;
+    float texRight = textureRect.x + textureRect.width;
+    float texBottom = textureRect.y + textureRect.height;
+    
+    if (texW > 0 && texH > 0) {
+        texLeft /= texW;
+        texRight /= texW;
+        texTop /= texH;
+        texBottom /= texH;
+    }
+    
+    if (flipX) {
+        std::swap(texLeft, texRight);
+    }
+    
+    if (flipY) {
+        std::swap(texTop, texBottom);
+    }
+    
+    push(texture.getHandle(), px, py, textureRect.width * scaleX, textureRect.height * scaleY,
+         sprite.getRotation(), ox, oy, texLeft, texTop, texRight, texBottom, sprite.getColor());
+}
+
+void SpriteSoABuffer::push(TextureHandle texture, float px, float py, float w, float h, float rot, float ox, float oy,
+                           float texLeft, float texTop, float texRight, float texBottom, const Color& color) {
+    x.push_back(px);
+    y.push_back(py);
+    width.push_back(w);
+    height.push_back(h);
+    rotation.push_back(rot);
+    originX.push_back(ox);
+    originY.push_back(oy);
+    u0.push_back(texLeft);
+    v0.push_back(texTop);
+    u1.push_back(texRight);
+    v1.push_back(texBottom);
+    r.push_back(color.r);
+    g.push_back(color.g);
+    b.push_back(color.b);
+    a.push_back(color.a);
+    textures.push_back(texture);
+}
+
+SpriteTransformSoA SpriteSoABuffer::view(size_t first, size_t count) const {
+    return SpriteTransformSoA{
+        x.data() + first, y.data() + first, width.data() + first, height.data() + first,
+        rotation.data() + first, originX.data() + first, originY.data() + first,
+        u0.data() + first, v0.data() + first, u1.data() + first, v1.data() + first,
+        r.data() + first, g.data() + first, b.data() + first, a.data() + first, count
+    };
+}
+
+void SpriteSoABuffer::record(RenderCommandList& list) const {
+    // One kernel call per run of sprites sharing a texture
+    size_t runStart = 0;
+    while (runStart < textures.size()) {
+        size_t runEnd = runStart + 1;
+        while (runEnd < textures.size() && textures[runEnd] == textures[runStart]) {
+            ++runEnd;
+        }
+        
+        uint32_t runCount = static_cast<uint32_t>(runEnd - runStart);
+        float* out = list.allocateQuads(textures[runStart], runCount);
+        SpriteVertexKernel::generate(view(runStart, runCount), out,
+                                     static_cast<size_t>(runCount) * SpriteVertexKernel::FLOATS_PER_SPRITE);
+        runStart = runEnd;
+    }
+}
+
+} // namespace Graphics
+} // namespace RPGEngine
@@ -0,0 +1,83 @@
+#pragma once
+
+#include "Sprite.h"
+#include "SpriteVertexKernel.h"
+#include "IGraphicsAPI.h"
+#include <vector>
+
+namespace RPGEngine {
+namespace Graphics {
+
+class RenderCommandList;
+
+/**
+ * Growable SoA storage for sprite transforms fed to SpriteVertexKernel
+ * Sprites are gathered with their texture handles, then recorded with one
+ * kernel call per run of sprites sharing a texture. Clearing keeps the
+ * capacity, so a buffer reused every frame stops allocating.
+ */
+struct SpriteSoABuffer {
+    std::vector<float> x, y, width, height, rotation, originX, originY;
+    std::vector<float> u0, v0, u1, v1, r, g, b, a;
+    std::vector<TextureHandle> textures;
+    
+    /**
+     * Reserve room for sprites
+     * @param count Number of sprites
+     */
+    void reserve(size_t count);
+    
+    /**
+     * Remove all sprites, keeping the capacity
+     */
+    void clear();
+    
+    /**
+     * Get the number of sprites
+     * @return Sprite count
+     */
+    size_t size() const { return x.size(); }
+    
+    /**
+     * Add a sprite
+     * @param sprite Sprite
+     * @param texture Texture the sprite samples (normalizes its texture rect)
+     */
+    void push(const Sprite& sprite, const Texture& texture);
+    
+    /**
+     * Add a quad
+     * @param texture Texture handle
+     * @param px X position
+     * @param py Y position
+     * @param w Width
+     * @param h Height
+     * @param rot Rotation angle
+     * @param ox Origin X (0-1)
+     * @param oy Origin Y (0-1)
+     * @param texLeft Left texture coordinate (normalized, flip applied)
+     * @param texTop Top texture coordinate
+     * @param texRight Right texture coordinate
+     * @param texBottom Bottom texture coordinate
+     * @param color Color
+     */
+    void push(TextureHandle texture, float px, float py, float w, float h, float rot, float ox, float oy,
+              float texLeft, float texTop, float texRight, float texBottom, const Color& color);
+    
+    /**
+     * Get the kernel input for a range of sprites
+     * @param first Index of the first sprite
+     * @param count Number of sprites
+     * @return Kernel input
+     */
+    SpriteTransformSoA view(size_t first, size_t count) const;
+    
+    /**
+     * Record every sprite into a command list
+     * @param list Command list to record into
+     */
+    void record(RenderCommandList& list) const;
+};
+
+} // namespace Graphics
+} // namespace RPGEngine
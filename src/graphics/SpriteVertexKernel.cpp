@@ -0,0 +1,295 @@
+#include "SpriteVertexKernel.h"
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define RPG_SPRITE_KERNEL_SSE 1
+#include <immintrin.h>
+#endif
+
+// AVX2 is compiled per function on GCC/Clang and selected at runtime
+#if defined(RPG_SPRITE_KERNEL_SSE) && (defined(__GNUC__) || defined(__clang__))
+#define RPG_SPRITE_KERNEL_AVX2 1
+#define RPG_TARGET_AVX2 __attribute__((target("avx2")))
+#elif defined(RPG_SPRITE_KERNEL_SSE) && defined(__AVX2__)
+#define RPG_SPRITE_KERNEL_AVX2 1
+#define RPG_TARGET_AVX2
+#endif
+
+namespace RPGEngine {
+namespace Graphics {
+
+namespace {
+
+const float DEG_TO_RAD = 3.14159f / 180.0f;
+
+/**
+ * Write one sprite's four vertices from precomputed corner positions
+ */
+inline void writeSprite(float* out, const float* cornerX, const float* cornerY, size_t stride,
+                        const SpriteTransformSoA& s, size_t i) {
+    const float u[4] = { s.u0[i], s.u1[i], s.u1[i], s.u0[i] };
+    const float v[4] = { s.v0[i], s.v0[i], s.v1[i], s.v1[i] };
+
+    for (int corner = 0; corner < 4; ++corner) {
+        out[0] = cornerX[corner * stride];
+        out[1] = cornerY[corner * stride];
+        out[2] = 0.0f;
+        out[3] = s.r[i];
+        out[4] = s.g[i];
+        out[5] = s.b[i];
+        out[6] = s.a[i];
+        out[7] = u[corner];
+        out[8] = v[corner];
+        out += SpriteVertexKernel::VERTEX_SIZE;
+    }
+}
+
+#ifdef RPG_SPRITE_KERNEL_SSE
+
+/**
+ * Same as writeSprite, but stores the color and position with vector stores
+ * The fourth lane of the position store rewrites the red channel, so the two
+ * stores can overlap without masking.
+ */
+inline void writeSpriteSSE(float* out, const float* cornerX, const float* cornerY, size_t stride,
+                           const SpriteTransformSoA& s, size_t i) {
+    const __m128 color = _mm_setr_ps(s.r[i], s.g[i], s.b[i], s.a[i]);
+    const float u[4] = { s.u0[i], s.u1[i], s.u1[i], s.u0[i] };
+    const float v[4] = { s.v0[i], s.v0[i], s.v1[i], s.v1[i] };
+
+    for (int corner = 0; corner < 4; ++corner) {
+        float* vertex = out + corner * SpriteVertexKernel::VERTEX_SIZE;
+        _mm_storeu_ps(vertex + 3, color);
+        vertex[7] = u[corner];
+        vertex[8] = v[corner];
+        _mm_storeu_ps(vertex, _mm_setr_ps(cornerX[corner * stride], cornerY[corner * stride], 0.0f, s.r[i]));
+    }
+}
+
+#endif
+
+} // namespace
+
+size_t SpriteVertexKernel::generate(const SpriteTransformSoA& sprites, float* out, size_t outSize) {
+    return generate(getBestISA(), sprites, out, outSize);
+}
+
+size_t SpriteVertexKernel::generate(SpriteKernelISA isa, const SpriteTransformSoA& sprites, float* out, size_t outSize) {
+    if (!out) {
+        return 0;
+    }
+
+    size_t count = sprites.count;
+    if (count * FLOATS_PER_SPRITE > outSize) {
+        count = outSize / FLOATS_PER_SPRITE;
+    }
+
+    if (!isSupported(isa)) {
+        isa = SpriteKernelISA::Scalar;
+    }
+
+    size_t done = 0;
+    switch (isa) {
+        case SpriteKernelISA::AVX2: {
+            size_t wide = count - count % 8;
+            generateAVX2(sprites, 0, wide, out);
+            done = wide;
+            break;
+        }
+        case SpriteKernelISA::SSE: {
+            size_t wide = count - count % 4;
+            generateSSE(sprites, 0, wide, out);
+            done = wide;
+            break;
+        }
+        case SpriteKernelISA::Scalar:
+            break;
+    }
+
+    // Remainder that does not fill a whole vector
+    generateScalar(sprites, done, count, out + done * FLOATS_PER_SPRITE);
+    return count;
+}
+
+SpriteKernelISA SpriteVertexKernel::getBestISA() {
+    static const SpriteKernelISA best =
+        isSupported(SpriteKernelISA::AVX2) ? SpriteKernelISA::AVX2 :
+        isSupported(SpriteKernelISA::SSE) ? SpriteKernelISA::SSE :
+        SpriteKernelISA::Scalar;
+    return best;
+}
+
+bool SpriteVertexKernel::isSupported(SpriteKernelISA isa) {
+    switch (isa) {
+        case SpriteKernelISA::Scalar:
+            return true;
+        case SpriteKernelISA::SSE:
+#ifdef RPG_SPRITE_KERNEL_SSE
+            return true;
+#else
+            return false;
+#endif
+        case SpriteKernelISA::AVX2:
+#if defined(RPG_SPRITE_KERNEL_AVX2) && (defined(__GNUC__) || defined(__clang__))
+            return __builtin_cpu_supports("avx2");
+#elif defined(RPG_SPRITE_KERNEL_AVX2)
+            return true;
+#else
+            return false;
+#endif
+    }
+    return false;
+}
+
+const char* SpriteVertexKernel::getISAName(SpriteKernelISA isa) {
+    switch (isa) {
+        case SpriteKernelISA::Scalar: return "Scalar";
+        case SpriteKernelISA::SSE:    return "SSE";
+        case SpriteKernelISA::AVX2:   return "AVX2";
+    }
+    return "Unknown";
+}
+
+void SpriteVertexKernel::generateScalar(const SpriteTransformSoA& s, size_t first, size_t last, float* out) {
+    for (size_t i = first; i < last; ++i) {
+        float originOffsetX = s.width[i] * s.originX[i];
+        float originOffsetY = s.height[i] * s.originY[i];
+
+        float x0 = -originOffsetX;
+        float y0 = -originOffsetY;
+        float x1 = s.width[i] - originOffsetX;
+        float y1 = s.height[i] - originOffsetY;
+
+        float localX[4] = { x0, x1, x1, x0 };
+        float localY[4] = { y0, y0, y1, y1 };
+        float cornerX[4];
+        float cornerY[4];
+
+        float radians = s.rotation[i] * DEG_TO_RAD;
+        float c = radians != 0.0f ? std::cos(radians) : 1.0f;
+        float sn = radians != 0.0f ? std::sin(radians) : 0.0f;
+
+        for (int corner = 0; corner < 4; ++corner) {
+            cornerX[corner] = s.x[i] + (c * localX[corner] - sn * localY[corner]);
+            cornerY[corner] = s.y[i] + (sn * localX[corner] + c * localY[corner]);
+        }
+
+        writeSprite(out, cornerX, cornerY, 1, s, i);
+        out += FLOATS_PER_SPRITE;
+    }
+}
+
+#ifdef RPG_SPRITE_KERNEL_SSE
+
+void SpriteVertexKernel::generateSSE(const SpriteTransformSoA& s, size_t first, size_t last, float* out) {
+    alignas(16) float cosines[4];
+    alignas(16) float sines[4];
+    alignas(16) float cornerX[4][4];
+    alignas(16) float cornerY[4][4];
+
+    for (size_t i = first; i < last; i += 4) {
+        // Trigonometry stays scalar; most sprites are unrotated and skip it
+        for (int lane = 0; lane < 4; ++lane) {
+            float radians = s.rotation[i + lane] * DEG_TO_RAD;
+            cosines[lane] = radians != 0.0f ? std::cos(radians) : 1.0f;
+            sines[lane] = radians != 0.0f ? std::sin(radians) : 0.0f;
+        }
+
+        __m128 c = _mm_load_ps(cosines);
+        __m128 sn = _mm_load_ps(sines);
+        __m128 w = _mm_loadu_ps(s.width + i);
+        __m128 h = _mm_loadu_ps(s.height + i);
+        __m128 px = _mm_loadu_ps(s.x + i);
+        __m128 py = _mm_loadu_ps(s.y + i);
+
+        __m128 offX = _mm_mul_ps(w, _mm_loadu_ps(s.originX + i));
+        __m128 offY = _mm_mul_ps(h, _mm_loadu_ps(s.originY + i));
+
+        __m128 x0 = _mm_sub_ps(_mm_setzero_ps(), offX);
+        __m128 y0 = _mm_sub_ps(_mm_setzero_ps(), offY);
+        __m128 x1 = _mm_sub_ps(w, offX);
+        __m128 y1 = _mm_sub_ps(h, offY);
+
+        const __m128 localX[4] = { x0, x1, x1, x0 };
+        const __m128 localY[4] = { y0, y0, y1, y1 };
+
+        for (int corner = 0; corner < 4; ++corner) {
+            __m128 rx = _mm_sub_ps(_mm_mul_ps(c, localX[corner]), _mm_mul_ps(sn, localY[corner]));
+            __m128 ry = _mm_add_ps(_mm_mul_ps(sn, localX[corner]), _mm_mul_ps(c, localY[corner]));
+            _mm_store_ps(cornerX[corner], _mm_add_ps(px, rx));
+            _mm_store_ps(cornerY[corner], _mm_add_ps(py, ry));
+        }
+
+        for (int lane = 0; lane < 4; ++lane) {
+            writeSpriteSSE(out, &cornerX[0][lane], &cornerY[0][lane], 4, s, i + lane);
+            out += FLOATS_PER_SPRITE;
+        }
+    }
+}
+
+#else
+
+void SpriteVertexKernel::generateSSE(const SpriteTransformSoA& s, size_t first, size_t last, float* out) {
+    generateScalar(s, first, last, out);
+}
+
+#endif
+
+#ifdef RPG_SPRITE_KERNEL_AVX2
+
+RPG_TARGET_AVX2
+void SpriteVertexKernel::generateAVX2(const SpriteTransformSoA& s, size_t first, size_t last, float* out) {
+    alignas(32) float cosines[8];
+    alignas(32) float sines[8];
+    alignas(32) float cornerX[4][8];
+    alignas(32) float cornerY[4][8];
+
+    for (size_t i = first; i < last; i += 8) {
+        for (int lane = 0; lane < 8; ++lane) {
+            float radians = s.rotation[i + lane] * DEG_TO_RAD;
+            cosines[lane] = radians != 0.0f ? std::cos(radians) : 1.0f;
+            sines[lane] = radians != 0.0f ? std::sin(radians) : 0.0f;
+        }
+
+        __m256 c = _mm256_load_ps(cosines);
+        __m256 sn = _mm256_load_ps(sines);
+        __m256 w = _mm256_loadu_ps(s.width + i);
+        __m256 h = _mm256_loadu_ps(s.height + i);
+        __m256 px = _mm256_loadu_ps(s.x + i);
+        __m256 py = _mm256_loadu_ps(s.y + i);
+
+        __m256 offX = _mm256_mul_ps(w, _mm256_loadu_ps(s.originX + i));
+        __m256 offY = _mm256_mul_ps(h, _mm256_loadu_ps(s.originY + i));
+
+        __m256 x0 = _mm256_sub_ps(_mm256_setzero_ps(), offX);
+        __m256 y0 = _mm256_sub_ps(_mm256_setzero_ps(), offY);
+        __m256 x1 = _mm256_sub_ps(w, offX);
+        __m256 y1 = _mm256_sub_ps(h, offY);
+
+        const __m256 localX[4] = { x0, x1, x1, x0 };
+        const __m256 localY[4] = { y0, y0, y1, y1 };
+
+        for (int corner = 0; corner < 4; ++corner) {
+            __m256 rx = _mm256_sub_ps(_mm256_mul_ps(c, localX[corner]), _mm256_mul_ps(sn, localY[corner]));
+            __m256 ry = _mm256_add_ps(_mm256_mul_ps(sn, localX[corner]), _mm256_mul_ps(c, localY[corner]));
+            _mm256_store_ps(cornerX[corner], _mm256_add_ps(px, rx));
+            _mm256_store_ps(cornerY[corner], _mm256_add_ps(py, ry));
+        }
+
+        for (int lane = 0; lane < 8; ++lane) {
+            writeSpriteSSE(out, &cornerX[0][lane], &cornerY[0][lane], 8, s, i + lane);
+            out += FLOATS_PER_SPRITE;
+        }
+    }
+}
+
+#else
+
+void SpriteVertexKernel::generateAVX2(const SpriteTransformSoA& s, size_t first, size_t last, float* out) {
+    generateSSE(s, first, last, out);
+}
+
+#endif
+
+} // namespace Graphics
+} // namespace RPGEngine
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace RPGEngine {
+namespace Graphics {
+
+/**
+ * Structure-of-arrays input for batched sprite vertex generation
+ * Every pointer refers to an array of at least count elements. Texture
+ * coordinates are normalized and already have flipping applied.
+ */
+struct SpriteTransformSoA {
+    const float* x;
+    const float* y;
+    const float* width;
+    const float* height;
+    const float* rotation;   // Degrees
+    const float* originX;    // 0-1
+    const float* originY;    // 0-1
+    const float* u0;
+    const float* v0;
+    const float* u1;
+    const float* v1;
+    const float* r;
+    const float* g;
+    const float* b;
+    const float* a;
+    size_t count;
+};
+
+/**
+ * Instruction set used by the sprite vertex kernel
+ */
+enum class SpriteKernelISA {
+    Scalar,
+    SSE,
+    AVX2
+};
+
+/**
+ * Sprite vertex generation kernel
+ * Emits four interleaved vertices per sprite in the sprite vertex format
+ * (3 position + 4 color + 2 texcoord), in bottom-left, bottom-right,
+ * top-right, top-left order.
+ */
+class SpriteVertexKernel {
+public:
+    static const int VERTEX_SIZE = 9;
+    static const int FLOATS_PER_SPRITE = VERTEX_SIZE * 4;
+
+    /**
+     * Generate vertices with the best instruction set available at runtime
+     * @param sprites Input sprite transforms
+     * @param out Output span start
+     * @param outSize Output span size in floats
+     * @return Number of sprites written (limited by the output span)
+     */
+    static size_t generate(const SpriteTransformSoA& sprites, float* out, size_t outSize);
+
+    /**
+     * Generate vertices with a specific instruction set
+     * Falls back to the scalar path if the instruction set is unavailable.
+     * @param isa Instruction set to use
+     * @param sprites Input sprite transforms
+     * @param out Output span start
+     * @param outSize Output span size in floats
+     * @return Number of sprites written
+     */
+    static size_t generate(SpriteKernelISA isa, const SpriteTransformSoA& sprites, float* out, size_t outSize);
+
+    /**
+     * Get the instruction set chosen by generate()
+     * @return Best supported instruction set
+     */
+    static SpriteKernelISA getBestISA();
+
+    /**
+     * Check if an instruction set is supported on this CPU and build
+     * @param isa Instruction set
+     * @return true if supported
+     */
+    static bool isSupported(SpriteKernelISA isa);
+
+    /**
+     * Get a printable name for an instruction set
+     * @param isa Instruction set
+     * @return Name
+     */
+    static const char* getISAName(SpriteKernelISA isa);
+
+private:
+    static void generateScalar(const SpriteTransformSoA& sprites, size_t first, size_t last, float* out);
+    static void generateSSE(const SpriteTransformSoA& sprites, size_t first, size_t last, float* out);
+    static void generateAVX2(const SpriteTransformSoA& sprites, size_t first, size_t last, float* out);
+};
+
+} // namespace Graphics
+} // namespace RPGEngine
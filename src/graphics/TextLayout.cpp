@@ -0,0 +1,238 @@
+#include "TextLayout.h"
+#include <algorithm>
+#include <cstring>
+
+namespace RPGEngine {
+namespace Graphics {
+
+void TextMesh::clear() {
+    quads.clear();
+    width = 0.0f;
+    height = 0.0f;
+    lineCount = 0;
+}
+
+void TextLayout::layout(const Font& font, const std::string& text, float size, float wrapWidth, TextMesh& mesh) {
+    mesh.clear();
+
+    if (text.empty() || font.getSize() <= 0.0f) {
+        return;
+    }
+
+    const float scale = size / font.getSize();
+    const float lineHeight = font.getLineHeight() * scale;
+    const size_t NO_BREAK = static_cast<size_t>(-1);
+
+    float penX = 0.0f;
+    float penY = 0.0f;
+    size_t lineStart = 0;          // First quad of the current line
+    size_t breakQuad = NO_BREAK;   // First quad after the last space on the line
+    float breakPenX = 0.0f;        // Pen position after that space
+    uint32_t previous = 0;
+    mesh.lineCount = 1;
+
+    // Close the line made of quads [lineStart, end)
+    auto finishLine = [&](size_t end) {
+        for (size_t i = lineStart; i < end; ++i) {
+            mesh.width = std::max(mesh.width, mesh.quads[i].x + mesh.quads[i].width);
+        }
+    };
+
+    size_t index = 0;
+    while (index < text.size()) {
+        uint32_t codepoint = decodeUTF8(text, index);
+
+        if (codepoint == '\n') {
+            finishLine(mesh.quads.size());
+            penX = 0.0f;
+            penY += lineHeight;
+            lineStart = mesh.quads.size();
+            breakQuad = NO_BREAK;
+            previous = 0;
+            mesh.lineCount++;
+            continue;
+        }
+
+        if (codepoint == '\r') {
+            continue;
+        }
+
+        const Glyph* glyph = font.getGlyph(codepoint);
+        if (!glyph) {
+            continue;
+        }
+
+        if (previous != 0) {
+            penX += font.getKerning(previous, codepoint) * scale;
+        }
+        previous = codepoint;
+
+        if (codepoint == ' ' || codepoint == '\t') {
+            penX += glyph->advance * scale * (codepoint == '\t' ? 4.0f : 1.0f);
+            breakQuad = mesh.quads.size();
+            breakPenX = penX;
+            continue;
+        }
+
+        float right = penX + (glyph->offsetX + glyph->width) * scale;
+        if (wrapWidth > 0.0f && right > wrapWidth && mesh.quads.size() > lineStart) {
+            if (breakQuad != NO_BREAK && breakQuad > lineStart) {
+                // Move the current word to the next line
+                finishLine(breakQuad);
+                for (size_t i = breakQuad; i < mesh.quads.size(); ++i) {
+                    mesh.quads[i].x -= breakPenX;
+                    mesh.quads[i].y += lineHeight;
+                }
+                penX -= breakPenX;
+                lineStart = breakQuad;
+            } else {
+                // A single word wider than the line breaks between characters
+                finishLine(mesh.quads.size());
+                penX = 0.0f;
+                lineStart = mesh.quads.size();
+            }
+
+            penY += lineHeight;
+            breakQuad = NO_BREAK;
+            mesh.lineCount++;
+        }
+
+        if (glyph->width > 0.0f && glyph->height > 0.0f) {
+            TextQuad quad;
+            quad.x = penX + glyph->offsetX * scale;
+            quad.y = penY + glyph->offsetY * scale;
+            quad.width = glyph->width * scale;
+            quad.height = glyph->height * scale;
+            quad.u0 = glyph->u0;
+            quad.v0 = glyph->v0;
+            quad.u1 = glyph->u1;
+            quad.v1 = glyph->v1;
+            mesh.quads.push_back(quad);
+        }
+
+        penX += glyph->advance * scale;
+    }
+
+    finishLine(mesh.quads.size());
+    mesh.height = mesh.lineCount * lineHeight;
+}
+
+uint32_t TextLayout::decodeUTF8(const std::string& text, size_t& index) {
+    const unsigned char first = static_cast<unsigned char>(text[index]);
+
+    if (first < 0x80) {
+        index++;
+        return first;
+    }
+
+    size_t length = 0;
+    uint32_t codepoint = 0;
+    if ((first & 0xE0) == 0xC0) {
+        length = 2;
+        codepoint = first & 0x1F;
+    } else if ((first & 0xF0) == 0xE0) {
+        length = 3;
+        codepoint = first & 0x0F;
+    } else if ((first & 0xF8) == 0xF0) {
+        length = 4;
+        codepoint = first & 0x07;
+    } else {
+        index++;
+        return 0xFFFD;
+    }
+
+    if (index + length > text.size()) {
+        index++;
+        return 0xFFFD;
+    }
+
+    for (size_t i = 1; i < length; ++i) {
+        const unsigned char next = static_cast<unsigned char>(text[index + i]);
+        if ((next & 0xC0) != 0x80) {
+            index++;
+            return 0xFFFD;
+        }
+        codepoint = (codepoint << 6) | (next & 0x3F);
+    }
+
+    index += length;
+    return codepoint;
+}
+
+TextMeshCache::TextMeshCache(size_t maxEntries)
+    : m_maxEntries(maxEntries)
+    , m_frame(0)
+{
+}
+
+const TextMesh& TextMeshCache::get(const Font& font, const std::string& text, float size, float wrapWidth) {
+    uint64_t key = makeKey(font, text, size, wrapWidth);
+
+    // Strings whose keys collide are kept side by side, so a mesh returned
+    // earlier this frame is never laid out again for another string
+    auto range = m_entries.equal_range(key);
+    for (auto it = range.first; it != range.second; ++it) {
+        Entry& entry = it->second;
+        if (entry.font == &font && entry.size == size && entry.wrapWidth == wrapWidth && entry.text == text) {
+            entry.lastUsedFrame = m_frame;
+            m_stats.hits++;
+            return entry.mesh;
+        }
+    }
+
+    Entry& entry = m_entries.emplace(key, Entry())->second;
+    entry.font = &font;
+    entry.text = text;
+    entry.size = size;
+    entry.wrapWidth = wrapWidth;
+    entry.lastUsedFrame = m_frame;
+    TextLayout::layout(font, text, size, wrapWidth, entry.mesh);
+    m_stats.misses++;
+    return entry.mesh;
+}
+
+void TextMeshCache::nextFrame() {
+    if (m_entries.size() > m_maxEntries) {
+        // Keep only what the frame that just ended used
+        for (auto it = m_entries.begin(); it != m_entries.end();) {
+            if (it->second.lastUsedFrame < m_frame) {
+                it = m_entries.erase(it);
+                m_stats.evictions++;
+            } else {
+                ++it;
+            }
+        }
+    }
+
+    m_frame++;
+}
+
+void TextMeshCache::clear() {
+    m_entries.clear();
+}
+
+uint64_t TextMeshCache::makeKey(const Font& font, const std::string& text, float size, float wrapWidth) {
+    // FNV-1a over the text, then the remaining key fields
+    uint64_t hash = 14695981039346656037ULL;
+    auto mix = [&hash](uint64_t value) {
+        hash ^= value;
+        hash *= 1099511628211ULL;
+    };
+
+    for (char c : text) {
+        mix(static_cast<unsigned char>(c));
+    }
+
+    uint32_t sizeBits = 0;
+    uint32_t wrapBits = 0;
+    std::memcpy(&sizeBits, &size, sizeof(sizeBits));
+    std::memcpy(&wrapBits, &wrapWidth, sizeof(wrapBits));
+
+    mix(sizeBits);
+    mix(wrapBits);
+    mix(static_cast<uint64_t>(reinterpret_cast<uintptr_t>(&font)));
+    return hash;
+}
+
+} // namespace Graphics
+} // namespace RPGEngine
@@ -0,0 +1,158 @@
+#pragma once
+
+#include "Font.h"
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace RPGEngine {
+namespace Graphics {
+
+/**
+ * One glyph quad of laid out text
+ * Positions are relative to the top-left corner of the text block.
+ */
+struct TextQuad {
+    float x;
+    float y;
+    float width;
+    float height;
+    float u0;
+    float v0;
+    float u1;
+    float v1;
+};
+
+/**
+ * Laid out text, ready to be copied into a sprite batch
+ */
+struct TextMesh {
+    std::vector<TextQuad> quads;
+    float width = 0.0f;
+    float height = 0.0f;
+    uint32_t lineCount = 0;
+
+    /**
+     * Remove all quads and reset the metrics
+     */
+    void clear();
+};
+
+/**
+ * Text layout engine
+ * Turns UTF-8 strings into glyph quads with kerning, explicit line breaks
+ * and word wrapping.
+ */
+class TextLayout {
+public:
+    /**
+     * Lay out text
+     * @param font Font to use
+     * @param text UTF-8 text
+     * @param size Font size in pixels
+     * @param wrapWidth Maximum line width in pixels (0 disables wrapping)
+     * @param mesh Output mesh (cleared first)
+     */
+    static void layout(const Font& font, const std::string& text, float size, float wrapWidth, TextMesh& mesh);
+
+    /**
+     * Decode one UTF-8 codepoint
+     * Invalid sequences decode to U+FFFD and consume one byte.
+     * @param text UTF-8 text
+     * @param index Byte index, advanced past the codepoint
+     * @return Codepoint
+     */
+    static uint32_t decodeUTF8(const std::string& text, size_t& index);
+};
+
+/**
+ * Text mesh cache statistics
+ */
+struct TextMeshCacheStats {
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    uint64_t evictions = 0;
+};
+
+/**
+ * Cache of laid out text meshes
+ * Keyed by font, string, size and wrap width, so unchanged labels skip the
+ * layout pass and a cache hit allocates nothing. Entries that were not used
+ * in the last frame are evicted once the cache grows past its capacity.
+ */
+class TextMeshCache {
+public:
+    /**
+     * Constructor
+     * @param maxEntries Number of entries kept before unused ones are evicted
+     */
+    explicit TextMeshCache(size_t maxEntries = 1024);
+
+    /**
+     * Get the mesh for a string, laying it out on a miss
+     * The reference stays valid until the next nextFrame() or clear().
+     * @param font Font to use
+     * @param text UTF-8 text
+     * @param size Font size in pixels
+     * @param wrapWidth Maximum line width in pixels (0 disables wrapping)
+     * @return Laid out mesh
+     */
+    const TextMesh& get(const Font& font, const std::string& text, float size, float wrapWidth = 0.0f);
+
+    /**
+     * Start a new frame and evict unused entries if over capacity
+     */
+    void nextFrame();
+
+    /**
+     * Remove all entries
+     */
+    void clear();
+
+    /**
+     * Set the capacity
+     * @param maxEntries Number of entries kept before unused ones are evicted
+     */
+    void setMaxEntries(size_t maxEntries) { m_maxEntries = maxEntries; }
+
+    /**
+     * Get the number of cached meshes
+     * @return Entry count
+     */
+    size_t getSize() const { return m_entries.size(); }
+
+    /**
+     * Get the cache statistics
+     * @return Statistics
+     */
+    const TextMeshCacheStats& getStats() const { return m_stats; }
+
+    /**
+     * Reset the cache statistics
+     */
+    void resetStats() { m_stats = TextMeshCacheStats(); }
+
+private:
+    struct Entry {
+        const Font* font;
+        std::string text;
+        float size;
+        float wrapWidth;
+        uint64_t lastUsedFrame;
+        TextMesh mesh;
+    };
+
+    /**
+     * Hash the lookup key
+     * @return 64-bit key
+     */
+    static uint64_t makeKey(const Font& font, const std::string& text, float size, float wrapWidth);
+
+    std::unordered_multimap<uint64_t, Entry> m_entries;   // Colliding keys get separate entries
+    size_t m_maxEntries;
+    uint64_t m_frame;
+    TextMeshCacheStats m_stats;
+};
+
+} // namespace Graphics
+} // namespace RPGEngine
@@ -0,0 +1,97 @@
+#include "TextRenderer.h"
+#include <iostream>
+
+namespace RPGEngine {
+namespace Graphics {
+
+TextRenderer::TextRenderer(std::shared_ptr<SpriteRenderer> spriteRenderer, std::shared_ptr<Font> font)
+    : m_spriteRenderer(spriteRenderer)
+    , m_font(font)
+{
+}
+
+TextRenderer::~TextRenderer() {
+}
+
+bool TextRenderer::initialize() {
+    if (isReady()) {
+        return true;
+    }
+
+    if (!m_spriteRenderer || !m_spriteRenderer->getGraphicsAPI()) {
+        std::cerr << "TextRenderer requires a sprite renderer with a graphics API" << std::endl;
+        return false;
+    }
+
+    auto font = std::make_shared<Font>(m_spriteRenderer->getGraphicsAPI());
+    if (!font->createDefault()) {
+        std::cerr << "Failed to create default font" << std::endl;
+        return false;
+    }
+
+    setFont(font);
+    return true;
+}
+
+void TextRenderer::setFont(std::shared_ptr<Font> font) {
+    m_font = font;
+    m_cache.clear();
+}
+
+const TextMesh& TextRenderer::layoutText(const std::string& text, float size, float wrapWidth) {
+    if (!m_font || text.empty()) {
+        return m_emptyMesh;
+    }
+
+    return m_cache.get(*m_font, text, size, wrapWidth);
+}
+
+std::pair<float, float> TextRenderer::measureText(const std::string& text, float size, float wrapWidth) {
+    if (!m_font || text.empty()) {
+        return std::make_pair(0.0f, 0.0f);
+    }
+
+    // Measuring is often done on throwaway strings (e.g. while wrapping), so
+    // it uses a scratch mesh instead of filling the cache
+    TextLayout::layout(*m_font, text, size, wrapWidth, m_scratchMesh);
+    return std::make_pair(m_scratchMesh.width, m_scratchMesh.height);
+}
+
+float TextRenderer::drawText(const std::string& text, float x, float y, float size, const Color& color, float wrapWidth) {
+    const TextMesh& mesh = layoutText(text, size, wrapWidth);
+    drawMesh(mesh, x, y, color);
+    return mesh.height;
+}
+
+void TextRenderer::drawMesh(const TextMesh& mesh, float x, float y, const Color& color) {
+    if (!m_spriteRenderer || !m_font || mesh.quads.empty()) {
+        return;
+    }
+
+    m_spriteRenderer->drawTextMesh(m_font->getTexture(), mesh, x, y, color);
+}
+
+bool TextRenderer::drawRectangle(float x, float y, float width, float height, const Color& color) {
+    if (!m_spriteRenderer || !m_font) {
+        return false;
+    }
+
+    TextQuad quad;
+    if (!m_font->getWhiteRegion(quad.u0, quad.v0, quad.u1, quad.v1)) {
+        return false;
+    }
+
+    quad.x = 0.0f;
+    quad.y = 0.0f;
+    quad.width = width;
+    quad.height = height;
+    m_spriteRenderer->drawTextQuads(m_font->getTexture(), &quad, 1, x, y, color);
+    return true;
+}
+
+void TextRenderer::nextFrame() {
+    m_cache.nextFrame();
+}
+
+} // namespace Graphics
+} // namespace RPGEngine
@@ -0,0 +1,130 @@
+#pragma once
+
+#include "SpriteRenderer.h"
+#include "Font.h"
+#include "TextLayout.h"
+#include <memory>
+#include <string>
+#include <utility>
+
+namespace RPGEngine {
+namespace Graphics {
+
+/**
+ * Text renderer
+ * Draws text from a font atlas through the sprite renderer, reusing cached
+ * text meshes for strings that did not change since the last frame. One
+ * instance can be shared by every UI so all text lands in the same batch.
+ */
+class TextRenderer {
+public:
+    /**
+     * Constructor
+     * @param spriteRenderer Sprite renderer to draw with
+     * @param font Font to use (the built-in font is created on initialize() if null)
+     */
+    TextRenderer(std::shared_ptr<SpriteRenderer> spriteRenderer, std::shared_ptr<Font> font = nullptr);
+
+    /**
+     * Destructor
+     */
+    ~TextRenderer();
+
+    /**
+     * Initialize the text renderer
+     * @return true if a usable font is available
+     */
+    bool initialize();
+
+    /**
+     * Set the font
+     * Clears the mesh cache.
+     * @param font Font to use
+     */
+    void setFont(std::shared_ptr<Font> font);
+
+    /**
+     * Get the font
+     * @return Font
+     */
+    std::shared_ptr<Font> getFont() const { return m_font; }
+
+    /**
+     * Get the laid out mesh for a string
+     * @param text UTF-8 text
+     * @param size Font size in pixels
+     * @param wrapWidth Maximum line width in pixels (0 disables wrapping)
+     * @return Cached mesh (empty if no font is loaded)
+     */
+    const TextMesh& layoutText(const std::string& text, float size, float wrapWidth = 0.0f);
+
+    /**
+     * Measure a string without caching its mesh
+     * @param text UTF-8 text
+     * @param size Font size in pixels
+     * @param wrapWidth Maximum line width in pixels (0 disables wrapping)
+     * @return Text dimensions (width, height)
+     */
+    std::pair<float, float> measureText(const std::string& text, float size, float wrapWidth = 0.0f);
+
+    /**
+     * Draw a string
+     * @param text UTF-8 text
+     * @param x X position of the top-left corner
+     * @param y Y position of the top-left corner
+     * @param size Font size in pixels
+     * @param color Text color
+     * @param wrapWidth Maximum line width in pixels (0 disables wrapping)
+     * @return Height of the drawn text
+     */
+    float drawText(const std::string& text, float x, float y, float size, const Color& color, float wrapWidth = 0.0f);
+
+    /**
+     * Draw an already laid out mesh
+     * @param mesh Laid out text
+     * @param x X position of the top-left corner
+     * @param y Y position of the top-left corner
+     * @param color Text color
+     */
+    void drawMesh(const TextMesh& mesh, float x, float y, const Color& color);
+
+    /**
+     * Draw a filled rectangle from the atlas' white region
+     * Keeps UI panels in the same batch as their text.
+     * @param x X position of the top-left corner
+     * @param y Y position of the top-left corner
+     * @param width Width
+     * @param height Height
+     * @param color Color
+     * @return false if the font has no white region (nothing was drawn)
+     */
+    bool drawRectangle(float x, float y, float width, float height, const Color& color);
+
+    /**
+     * Advance the mesh cache to the next frame
+     * Call once per frame.
+     */
+    void nextFrame();
+
+    /**
+     * Get the mesh cache
+     * @return Mesh cache
+     */
+    TextMeshCache& getCache() { return m_cache; }
+
+    /**
+     * Check if the text renderer can draw
+     * @return true if a font is loaded
+     */
+    bool isReady() const { return m_font && m_font->isLoaded(); }
+
+private:
+    std::shared_ptr<SpriteRenderer> m_spriteRenderer;
+    std::shared_ptr<Font> m_font;
+    TextMeshCache m_cache;
+    TextMesh m_emptyMesh;
+    TextMesh m_scratchMesh;
+};
+
+} // namespace Graphics
+} // namespace RPGEngine
@@ -227,10 +227,9 @@ bool InputManager::createAction(const std::string& name) {
     }
     
     // Create action
-    m_actions.emplace(name, InputAction(name));
-    
-    // Create empty bindings list
-    m_bindings[name] = std::vector<InputBinding>();
+    InputAction action(name);
+    m_bindings[action.id] = std::vector<InputBinding>();
+    m_actions.emplace(action.id, std::move(action));
     
     return true;
 }
@@ -246,15 +245,16 @@ bool InputManager::removeAction(const std::string& name) {
     }
     
     // Remove action
-    m_actions.erase(name);
+    const Utils::StringId id(name);
+    m_actions.erase(id);
     
     // Remove bindings
-    m_bindings.erase(name);
+    m_bindings.erase(id);
     
     // Remove callbacks for this action
     auto it = m_actionCallbacks.begin();
     while (it != m_actionCallbacks.end()) {
-        if (it->second.actionName == name) {
+        if (it->second.actionId == id) {
             it = m_actionCallbacks.erase(it);
         } else {
             ++it;
@@ -265,11 +265,15 @@ bool InputManager::removeAction(const std::string& name) {
 }
 
 bool InputManager::hasAction(const std::string& name) const {
-    return m_actions.find(name) != m_actions.end();
+    return m_actions.find(Utils::StringId(name)) != m_actions.end();
 }
 
 const InputAction* InputManager::getAction(const std::string& name) const {
-    auto it = m_actions.find(name);
+    return getAction(Utils::StringId(name));
+}
+
+const InputAction* InputManager::getAction(Utils::StringId id) const {
+    auto it = m_actions.find(id);
     if (it != m_actions.end()) {
         return &it->second;
     }
@@ -297,6 +301,26 @@ float InputManager::getActionValue(const std::string& name) const {
     return action ? action->value : 0.0f;
 }
 
+bool InputManager::isActionActive(Utils::StringId id) const {
+    auto action = getAction(id);
+    return action ? action->active : false;
+}
+
+bool InputManager::isActionJustActivated(Utils::StringId id) const {
+    auto action = getAction(id);
+    return action ? action->justActivated : false;
+}
+
+bool InputManager::isActionJustDeactivated(Utils::StringId id) const {
+    auto action = getAction(id);
+    return action ? action->justDeactivated : false;
+}
+
+float InputManager::getActionValue(Utils::StringId id) const {
+    auto action = getAction(id);
+    return action ? action->value : 0.0f;
+}
+
 bool InputManager::bindKeyToAction(const std::string& actionName, KeyCode key, float scale) {
     // Create action if it doesn't exist
     if (!hasAction(actionName)) {
@@ -304,7 +328,7 @@ bool InputManager::bindKeyToAction(const std::string& actionName, KeyCode key, f
     }
     
     // Add binding
-    m_bindings[actionName].emplace_back(
+    m_bindings[Utils::StringId(actionName)].emplace_back(
         actionName,
         InputBindingType::KeyboardKey,
         static_cast<int>(key),
@@ -321,7 +345,7 @@ bool InputManager::bindMouseButtonToAction(const std::string& actionName, MouseB
     }
     
     // Add binding
-    m_bindings[actionName].emplace_back(
+    m_bindings[Utils::StringId(actionName)].emplace_back(
         actionName,
         InputBindingType::MouseButton,
         static_cast<int>(button),
@@ -338,7 +362,7 @@ bool InputManager::bindMouseAxisToAction(const std::string& actionName, int axis
     }
     
     // Add binding
-    m_bindings[actionName].emplace_back(
+    m_bindings[Utils::StringId(actionName)].emplace_back(
         actionName,
         InputBindingType::MouseAxis,
         axis,
@@ -362,7 +386,7 @@ bool InputManager::bindGamepadButtonToAction(const std::string& actionName, Game
         binding.code |= (gamepadId << 16);
     }
     
-    m_bindings[actionName].push_back(binding);
+    m_bindings[Utils::StringId(actionName)].push_back(binding);
     
     return true;
 }
@@ -381,7 +405,7 @@ bool InputManager::bindGamepadAxisToAction(const std::string& actionName, Gamepa
         binding.code |= (gamepadId << 16);
     }
     
-    m_bindings[actionName].push_back(binding);
+    m_bindings[Utils::StringId(actionName)].push_back(binding);
     
     return true;
 }
@@ -392,7 +416,7 @@ bool InputManager::removeActionBindings(const std::string& actionName) {
     }
     
     // Clear bindings
-    m_bindings[actionName].clear();
+    m_bindings[Utils::StringId(actionName)].clear();
     
     return true;
 }
@@ -402,7 +426,7 @@ bool InputManager::removeBinding(const std::string& actionName, InputBindingType
         return false;
     }
     
-    auto& bindings = m_bindings[actionName];
+    auto& bindings = m_bindings[Utils::StringId(actionName)];
     
     // Find and remove binding
     auto it = std::remove_if(bindings.begin(), bindings.end(),
@@ -464,7 +488,7 @@ bool InputManager::loadBindingsFromFile(const std::string& filepath) {
                 }
                 
                 // Add binding
-                m_bindings[actionName].emplace_back(actionName, type, code, scale);
+                m_bindings[Utils::StringId(actionName)].emplace_back(actionName, type, code, scale);
             }
         }
         
@@ -484,7 +508,7 @@ bool InputManager::saveBindingsToFile(const std::string& filepath) {
         
         // Add actions and bindings
         for (const auto& pair : m_bindings) {
-            const std::string& actionName = pair.first;
+            const std::string actionName = pair.first.str();
             const std::vector<InputBinding>& bindings = pair.second;
             
             json actionJson;
@@ -552,7 +576,7 @@ int InputManager::registerActionCallback(const std::string& actionName,
     }
     
     int callbackId = m_nextCallbackId++;
-    m_actionCallbacks[callbackId] = {actionName, callback};
+    m_actionCallbacks[callbackId] = {Utils::StringId(actionName), callback};
     return callbackId;
 }
 
@@ -571,25 +595,15 @@ bool InputManager::unregisterActionCallback(int callbackId) {
 }
 
 void InputManager::updateActions() {
-    // Store previous action states
-    std::unordered_map<std::string, bool> previousActiveStates;
-    for (const auto& pair : m_actions) {
-        previousActiveStates[pair.first] = pair.second.active;
-    }
-    
-    // Reset just activated/deactivated flags
-    for (auto& pair : m_actions) {
-        pair.second.justActivated = false;
-        pair.second.justDeactivated = false;
-    }
-    
     // Update each action based on its bindings
     for (auto& pair : m_actions) {
-        const std::string& actionName = pair.first;
         InputAction& action = pair.second;
+        bool previouslyActive = action.active;
+        action.justActivated = false;
+        action.justDeactivated = false;
         
         // Get bindings for this action
-        auto bindingsIt = m_bindings.find(actionName);
+        auto bindingsIt = m_bindings.find(pair.first);
         if (bindingsIt != m_bindings.end()) {
             updateAction(action, bindingsIt->second);
         } else {
@@ -599,7 +613,6 @@ void InputManager::updateActions() {
         }
         
         // Update just activated/deactivated flags
-        bool previouslyActive = previousActiveStates[actionName];
         if (action.active && !previouslyActive) {
             action.justActivated = true;
         } else if (!action.active && previouslyActive) {
@@ -609,8 +622,7 @@ void InputManager::updateActions() {
     
     // Notify callbacks
     for (const auto& pair : m_actionCallbacks) {
-        const std::string& actionName = pair.second.actionName;
-        auto actionIt = m_actions.find(actionName);
+        auto actionIt = m_actions.find(pair.second.actionId);
         
         if (actionIt != m_actions.end()) {
             const InputAction& action = actionIt->second;
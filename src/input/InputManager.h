@@ -5,6 +5,7 @@
 #include "MouseDevice.h"
 #include "GamepadDevice.h"
 #include "../systems/System.h"
+#include "../utils/StringId.h"
 #include <memory>
 #include <unordered_map>
 #include <string>
@@ -23,13 +24,14 @@ namespace Input {
  */
 struct InputAction {
     std::string name;
+    Utils::StringId id;
     bool active;
     bool justActivated;
     bool justDeactivated;
     float value;
     
     InputAction(const std::string& name)
-        : name(name), active(false), justActivated(false), justDeactivated(false), value(0.0f) {}
+        : name(name), id(Utils::StringId::intern(name)), active(false), justActivated(false), justDeactivated(false), value(0.0f) {}
 };
 
 /**
@@ -209,6 +211,43 @@ public:
      */
     float getActionValue(const std::string& name) const;
     
+    /**
+     * Get an input action by interned name
+     * Per-frame queries should prefer these overloads with a literal such as
+     * "jump"_sid, which skip hashing the name.
+     * @param id Action ID
+     * @return Pointer to the input action, or nullptr if not found
+     */
+    const InputAction* getAction(Utils::StringId id) const;
+    
+    /**
+     * Check if an input action is active
+     * @param id Action ID
+     * @return true if the action is active
+     */
+    bool isActionActive(Utils::StringId id) const;
+    
+    /**
+     * Check if an input action was just activated this frame
+     * @param id Action ID
+     * @return true if the action was just activated
+     */
+    bool isActionJustActivated(Utils::StringId id) const;
+    
+    /**
+     * Check if an input action was just deactivated this frame
+     * @param id Action ID
+     * @return true if the action was just deactivated
+     */
+    bool isActionJustDeactivated(Utils::StringId id) const;
+    
+    /**
+     * Get the value of an input action
+     * @param id Action ID
+     * @return Action value (0.0-1.0 for buttons, -1.0-1.0 for axes)
+     */
+    float getActionValue(Utils::StringId id) const;
+    
     /**
      * Bind a keyboard key to an input action
      * @param actionName Action name
@@ -324,13 +363,13 @@ private:
     std::vector<std::shared_ptr<GamepadDevice>> m_gamepadDevices;
     std::vector<std::shared_ptr<IInputDevice>> m_devices;
     
-    // Input actions and bindings
-    std::unordered_map<std::string, InputAction> m_actions;
-    std::unordered_map<std::string, std::vector<InputBinding>> m_bindings;
+    // Input actions and bindings, keyed by interned action name
+    std::unordered_map<Utils::StringId, InputAction> m_actions;
+    std::unordered_map<Utils::StringId, std::vector<InputBinding>> m_bindings;
     
     // Action callbacks
     struct ActionCallback {
-        std::string actionName;
+        Utils::StringId actionId;
         std::function<void(const InputAction&)> callback;
     };
     std::unordered_map<int, ActionCallback> m_actionCallbacks;
@@ -0,0 +1,240 @@
+#include "AssetArchive.h"
+#include "../utils/Lz4.h"
+#include <iostream>
+#include <fstream>
+#include <algorithm>
+#include <cstring>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define RPG_HAS_MMAP 1
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace RPGEngine {
+namespace Resources {
+
+uint64_t hashAssetPath(const std::string& path) {
+    return hashAssetData(reinterpret_cast<const uint8_t*>(path.data()), path.size());
+}
+
+uint64_t hashAssetData(const uint8_t* data, size_t size) {
+    uint64_t hash = 14695981039346656037ull;
+    for (size_t i = 0; i < size; ++i) {
+        hash ^= data[i];
+        hash *= 1099511628211ull;
+    }
+    return hash;
+}
+
+MappedFile::~MappedFile() {
+#ifdef RPG_HAS_MMAP
+    if (m_mapped) {
+        munmap(const_cast<uint8_t*>(m_data), m_size);
+    }
+#endif
+}
+
+std::shared_ptr<MappedFile> MappedFile::open(const std::string& path) {
+    std::shared_ptr<MappedFile> file(new MappedFile());
+
+#ifdef RPG_HAS_MMAP
+    int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0) {
+        return nullptr;
+    }
+
+    struct stat info;
+    if (fstat(fd, &info) != 0) {
+        close(fd);
+        return nullptr;
+    }
+
+    file->m_size = static_cast<size_t>(info.st_size);
+    if (file->m_size > 0) {
+        void* address = mmap(nullptr, file->m_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (address != MAP_FAILED) {
+            file->m_data = static_cast<const uint8_t*>(address);
+            file->m_mapped = true;
+        }
+    }
+    close(fd);
+
+    if (file->m_mapped || file->m_size == 0) {
+        return file;
+    }
+#endif
+
+    // No mmap: read the whole file
+    std::ifstream stream(path, std::ios::binary | std::ios::ate);
+    if (!stream.is_open()) {
+        return nullptr;
+    }
+    file->m_size = static_cast<size_t>(stream.tellg());
+    stream.seekg(0, std::ios::beg);
+    file->m_buffer.resize(file->m_size);
+    if (file->m_size > 0 && !stream.read(reinterpret_cast<char*>(file->m_buffer.data()), file->m_size)) {
+        return nullptr;
+    }
+    file->m_data = file->m_buffer.data();
+    return file;
+}
+
+AssetView AssetView::fromMapping(std::shared_ptr<const MappedFile> mapping, const uint8_t* data, size_t size) {
+    AssetView view;
+    view.m_valid = true;
+    view.m_data = data;
+    view.m_size = size;
+    view.m_mapping = std::move(mapping);
+    return view;
+}
+
+AssetView AssetView::fromBuffer(std::vector<uint8_t> buffer) {
+    AssetView view;
+    view.m_valid = true;
+    view.m_size = buffer.size();
+    view.m_owned = std::move(buffer);
+    return view;
+}
+
+std::shared_ptr<AssetArchive> AssetArchive::open(const std::string& path) {
+    std::shared_ptr<AssetArchive> archive(new AssetArchive());
+    archive->m_path = path;
+    archive->m_file = MappedFile::open(path);
+    if (!archive->m_file) {
+        std::cerr << "Failed to open asset archive: " << path << std::endl;
+        return nullptr;
+    }
+
+    if (!archive->validate()) {
+        std::cerr << "Invalid asset archive: " << path << std::endl;
+        return nullptr;
+    }
+
+    return archive;
+}
+
+bool AssetArchive::validate() {
+    const uint8_t* base = m_file->data();
+    const size_t size = m_file->size();
+
+    if (size < sizeof(ArchiveHeader)) {
+        return false;
+    }
+
+    m_header = reinterpret_cast<const ArchiveHeader*>(base);
+    if (std::memcmp(m_header->magic, ASSET_ARCHIVE_MAGIC, 4) != 0 || m_header->version != ASSET_ARCHIVE_VERSION) {
+        return false;
+    }
+
+    auto fits = [size](uint64_t offset, uint64_t bytes) {
+        return offset <= size && bytes <= size - offset;
+    };
+
+    if (!fits(m_header->entriesOffset, uint64_t(m_header->entryCount) * sizeof(ArchiveEntry)) ||
+        !fits(m_header->blobsOffset, uint64_t(m_header->blobCount) * sizeof(ArchiveBlob)) ||
+        !fits(m_header->stringsOffset, m_header->stringsSize)) {
+        return false;
+    }
+
+    m_entries = reinterpret_cast<const ArchiveEntry*>(base + m_header->entriesOffset);
+    m_blobs = reinterpret_cast<const ArchiveBlob*>(base + m_header->blobsOffset);
+    m_strings = reinterpret_cast<const char*>(base + m_header->stringsOffset);
+
+    // Check every reference once so lookups don't have to
+    for (uint32_t i = 0; i < m_header->entryCount; ++i) {
+        const ArchiveEntry& entry = m_entries[i];
+        if (entry.blob >= m_header->blobCount ||
+            uint64_t(entry.pathOffset) + entry.pathLength > m_header->stringsSize) {
+            return false;
+        }
+    }
+    for (uint32_t i = 0; i < m_header->blobCount; ++i) {
+        const ArchiveBlob& blob = m_blobs[i];
+        if (!fits(blob.offset, blob.storedSize)) {
+            return false;
+        }
+        // LZ4 expands at most 255x, so a larger size can only come from a
+        // corrupt header and would otherwise be allocated by view()
+        switch (static_cast<AssetCompression>(blob.compression)) {
+            case AssetCompression::None:
+                if (blob.size != blob.storedSize) {
+                    return false;
+                }
+                break;
+            case AssetCompression::LZ4:
+                if (blob.size > blob.storedSize * 255 + 16) {
+                    return false;
+                }
+                break;
+            default:
+                break;
+        }
+    }
+
+    return true;
+}
+
+const ArchiveEntry* AssetArchive::findEntry(const std::string& path) const {
+    const uint64_t hash = hashAssetPath(path);
+    const ArchiveEntry* end = m_entries + m_header->entryCount;
+    const ArchiveEntry* it = std::lower_bound(m_entries, end, hash, [](const ArchiveEntry& entry, uint64_t value) {
+        return entry.pathHash < value;
+    });
+
+    // Compare the strings in case two paths share a hash
+    for (; it != end && it->pathHash == hash; ++it) {
+        if (it->pathLength == path.size() && std::memcmp(m_strings + it->pathOffset, path.data(), path.size()) == 0) {
+            return it;
+        }
+    }
+
+    return nullptr;
+}
+
+AssetView AssetArchive::view(const std::string& path) const {
+    const ArchiveEntry* entry = findEntry(path);
+    if (!entry) {
+        return AssetView();
+    }
+
+    const ArchiveBlob& blob = m_blobs[entry->blob];
+    const uint8_t* stored = m_file->data() + blob.offset;
+
+    switch (static_cast<AssetCompression>(blob.compression)) {
+        case AssetCompression::None:
+            return AssetView::fromMapping(m_file, stored, static_cast<size_t>(blob.storedSize));
+
+        case AssetCompression::LZ4: {
+            std::vector<uint8_t> data;
+            if (!Utils::Lz4::decompress(stored, static_cast<size_t>(blob.storedSize), static_cast<size_t>(blob.size), data)) {
+                std::cerr << "Corrupt compressed asset: " << path << " in " << m_path << std::endl;
+                return AssetView();
+            }
+            return AssetView::fromBuffer(std::move(data));
+        }
+
+        default:
+            std::cerr << "Unknown compression for asset: " << path << " in " << m_path << std::endl;
+            return AssetView();
+    }
+}
+
+size_t AssetArchive::getSize(const std::string& path) const {
+    const ArchiveEntry* entry = findEntry(path);
+    return entry ? static_cast<size_t>(m_blobs[entry->blob].size) : 0;
+}
+
+std::vector<std::string> AssetArchive::listPaths() const {
+    std::vector<std::string> paths;
+    paths.reserve(m_header->entryCount);
+    for (uint32_t i = 0; i < m_header->entryCount; ++i) {
+        paths.emplace_back(m_strings + m_entries[i].pathOffset, m_entries[i].pathLength);
+    }
+    return paths;
+}
+
+} // namespace Resources
+} // namespace RPGEngine
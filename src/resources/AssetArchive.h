@@ -0,0 +1,223 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <cstdint>
+#include <cstddef>
+
+namespace RPGEngine {
+namespace Resources {
+
+/**
+ * Packed asset archive layout (little endian)
+ *
+ *   ArchiveHeader
+ *   ArchiveEntry[entryCount]     sorted by pathHash
+ *   ArchiveBlob[blobCount]
+ *   path strings                 not terminated, referenced by entries
+ *   blob data                    each blob 16-byte aligned
+ *
+ * Entries map paths to blobs. Identical files share one blob, so the
+ * archive is content-addressed by ArchiveBlob::contentHash.
+ */
+const char ASSET_ARCHIVE_MAGIC[4] = {'R', 'P', 'A', 'K'};
+const uint32_t ASSET_ARCHIVE_VERSION = 1;
+
+/**
+ * Blob compression
+ */
+enum class AssetCompression : uint32_t {
+    None = 0,
+    LZ4 = 1
+};
+
+struct ArchiveHeader {
+    char magic[4];
+    uint32_t version;
+    uint32_t entryCount;
+    uint32_t blobCount;
+    uint64_t entriesOffset;
+    uint64_t blobsOffset;
+    uint64_t stringsOffset;
+    uint64_t stringsSize;
+};
+
+struct ArchiveEntry {
+    uint64_t pathHash;          // hashAssetPath() of the normalized path
+    uint32_t pathOffset;        // Into the string table
+    uint32_t pathLength;
+    uint32_t blob;
+    uint32_t reserved;
+};
+
+struct ArchiveBlob {
+    uint64_t offset;            // From the start of the archive
+    uint64_t storedSize;        // Bytes in the archive
+    uint64_t size;              // Bytes once decompressed
+    uint64_t contentHash;       // hashAssetData() of the uncompressed bytes
+    uint32_t compression;       // AssetCompression
+    uint32_t reserved;
+};
+
+/**
+ * Hash a normalized asset path (64-bit FNV-1a)
+ * @param path Path
+ * @return Hash
+ */
+uint64_t hashAssetPath(const std::string& path);
+
+/**
+ * Hash asset contents (64-bit FNV-1a)
+ * @param data Data
+ * @param size Size
+ * @return Hash
+ */
+uint64_t hashAssetData(const uint8_t* data, size_t size);
+
+/**
+ * Read-only memory mapping of a whole file
+ * Falls back to reading the file into memory where mmap is unavailable.
+ */
+class MappedFile {
+public:
+    ~MappedFile();
+
+    /**
+     * Map a file
+     * @param path File path
+     * @return Mapping, or nullptr if the file can't be opened
+     */
+    static std::shared_ptr<MappedFile> open(const std::string& path);
+
+    const uint8_t* data() const { return m_data; }
+    size_t size() const { return m_size; }
+
+private:
+    MappedFile() = default;
+
+    const uint8_t* m_data = nullptr;
+    size_t m_size = 0;
+    bool m_mapped = false;
+    std::vector<uint8_t> m_buffer;      // Used without mmap
+};
+
+/**
+ * Contents of an asset
+ * Either points straight into a mapped archive (zero-copy) or owns a
+ * buffer for compressed entries and loose files. A view keeps the archive
+ * mapping alive, so it stays valid after the archive is unmounted.
+ */
+class AssetView {
+public:
+    AssetView() = default;
+
+    /**
+     * Check if the asset was found
+     * @return true if the view holds data
+     */
+    bool isValid() const { return m_valid; }
+
+    /**
+     * Check if the view points into a mapped archive
+     * @return true if no copy was made
+     */
+    bool isZeroCopy() const { return m_valid && m_owned.empty() && m_mapping != nullptr; }
+
+    const uint8_t* data() const { return m_owned.empty() ? m_data : m_owned.data(); }
+    size_t size() const { return m_size; }
+
+    /**
+     * Copy the contents into a string (for text assets)
+     * @return Contents
+     */
+    std::string toString() const { return std::string(reinterpret_cast<const char*>(data()), m_size); }
+
+    /**
+     * Make a view of a mapped range
+     */
+    static AssetView fromMapping(std::shared_ptr<const MappedFile> mapping, const uint8_t* data, size_t size);
+
+    /**
+     * Make a view owning a buffer
+     */
+    static AssetView fromBuffer(std::vector<uint8_t> buffer);
+
+private:
+    bool m_valid = false;
+    const uint8_t* m_data = nullptr;
+    size_t m_size = 0;
+    std::vector<uint8_t> m_owned;
+    std::shared_ptr<const MappedFile> m_mapping;
+};
+
+/**
+ * Memory-mapped packed asset archive (read side)
+ */
+class AssetArchive {
+public:
+    /**
+     * Open an archive
+     * @param path Archive path
+     * @return Archive, or nullptr if the file is missing or invalid
+     */
+    static std::shared_ptr<AssetArchive> open(const std::string& path);
+
+    /**
+     * Find an entry
+     * @param path Normalized asset path
+     * @return Entry, or nullptr if the archive doesn't contain the path
+     */
+    const ArchiveEntry* findEntry(const std::string& path) const;
+
+    /**
+     * Check if the archive contains a path
+     * @param path Normalized asset path
+     * @return true if found
+     */
+    bool contains(const std::string& path) const { return findEntry(path) != nullptr; }
+
+    /**
+     * Get the contents of an asset
+     * Uncompressed blobs are returned without copying.
+     * @param path Normalized asset path
+     * @return View (invalid if not found or corrupt)
+     */
+    AssetView view(const std::string& path) const;
+
+    /**
+     * Get the uncompressed size of an asset
+     * @param path Normalized asset path
+     * @return Size, or 0 if not found
+     */
+    size_t getSize(const std::string& path) const;
+
+    /**
+     * List the paths in the archive
+     * @return Paths in index order
+     */
+    std::vector<std::string> listPaths() const;
+
+    size_t getEntryCount() const { return m_header->entryCount; }
+    size_t getBlobCount() const { return m_header->blobCount; }
+    const std::string& getPath() const { return m_path; }
+
+private:
+    AssetArchive() = default;
+
+    /**
+     * Check the header and tables fit the file
+     * @return true if the archive is usable
+     */
+    bool validate();
+
+    std::string m_path;
+    std::shared_ptr<MappedFile> m_file;
+    const ArchiveHeader* m_header = nullptr;
+    const ArchiveEntry* m_entries = nullptr;
+    const ArchiveBlob* m_blobs = nullptr;
+    const char* m_strings = nullptr;
+};
+
+} // namespace Resources
+} // namespace RPGEngine
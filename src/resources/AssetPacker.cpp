@@ -0,0 +1,224 @@
+#include "AssetPacker.h"
+#include "VirtualFileSystem.h"
+#include "../utils/Lz4.h"
+#include <iostream>
+#include <fstream>
+#include <filesystem>
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+
+namespace RPGEngine {
+namespace Resources {
+
+namespace {
+    const uint64_t BLOB_ALIGNMENT = 16;
+
+    uint64_t alignUp(uint64_t value) {
+        return (value + BLOB_ALIGNMENT - 1) & ~(BLOB_ALIGNMENT - 1);
+    }
+}
+
+AssetPacker::AssetPacker(AssetPackCompression compression)
+    : m_compression(compression)
+{
+}
+
+bool AssetPacker::addFile(const std::string& diskPath, const std::string& archivePath) {
+    std::ifstream file(diskPath, std::ios::binary | std::ios::ate);
+    if (!file.is_open()) {
+        std::cerr << "Failed to open file for packing: " << diskPath << std::endl;
+        return false;
+    }
+
+    std::vector<uint8_t> data(static_cast<size_t>(file.tellg()));
+    file.seekg(0, std::ios::beg);
+    if (!data.empty() && !file.read(reinterpret_cast<char*>(data.data()), data.size())) {
+        std::cerr << "Failed to read file for packing: " << diskPath << std::endl;
+        return false;
+    }
+
+    addData(archivePath, std::move(data), m_compression);
+    return true;
+}
+
+void AssetPacker::addData(const std::string& archivePath, std::vector<uint8_t> data, AssetPackCompression compression) {
+    const std::string path = VirtualFileSystem::normalizePath(archivePath);
+    const uint64_t hash = hashAssetData(data.data(), data.size());
+    m_stats.files++;
+    m_stats.inputBytes += data.size();
+
+    // Reuse an identical blob
+    uint32_t blobIndex = static_cast<uint32_t>(m_blobs.size());
+    auto range = m_blobsByHash.equal_range(hash);
+    for (auto it = range.first; it != range.second; ++it) {
+        if (m_blobs[it->second].original == data) {
+            blobIndex = it->second;
+            m_stats.duplicates++;
+            break;
+        }
+    }
+
+    if (blobIndex == m_blobs.size()) {
+        Blob blob;
+        blob.size = data.size();
+        blob.contentHash = hash;
+
+        if (shouldTryCompression(path, compression) && !data.empty()) {
+            std::vector<uint8_t> compressed = Utils::Lz4::compress(data.data(), data.size());
+            bool worthIt = compression == AssetPackCompression::Always
+                ? compressed.size() < data.size()
+                : compressed.size() * 10 <= data.size() * 9;
+            if (worthIt) {
+                blob.data = std::move(compressed);
+                blob.compression = AssetCompression::LZ4;
+            }
+        }
+
+        if (blob.compression == AssetCompression::None) {
+            blob.data = data;
+        }
+        blob.original = std::move(data);
+
+        m_blobs.push_back(std::move(blob));
+        m_blobsByHash.emplace(hash, blobIndex);
+    }
+
+    // Adding a path twice replaces the earlier file
+    auto existing = m_entriesByPath.find(path);
+    if (existing != m_entriesByPath.end()) {
+        m_entries[existing->second].blob = blobIndex;
+        return;
+    }
+
+    m_entriesByPath[path] = m_entries.size();
+    m_entries.push_back({path, blobIndex});
+}
+
+size_t AssetPacker::addDirectory(const std::string& directory, const std::string& prefix) {
+    namespace fs = std::filesystem;
+
+    std::error_code error;
+    if (!fs::is_directory(directory, error)) {
+        std::cerr << "Not a directory: " << directory << std::endl;
+        return 0;
+    }
+
+    // Sort so archives are reproducible
+    std::vector<fs::path> files;
+    for (const auto& item : fs::recursive_directory_iterator(directory, error)) {
+        if (item.is_regular_file()) {
+            files.push_back(item.path());
+        }
+    }
+    std::sort(files.begin(), files.end());
+
+    size_t added = 0;
+    for (const auto& file : files) {
+        std::string relative = fs::relative(file, directory).generic_string();
+        if (addFile(file.string(), prefix + relative)) {
+            added++;
+        }
+    }
+
+    return added;
+}
+
+bool AssetPacker::write(const std::string& outputPath) {
+    // Index sorted by path hash for binary search, ties by path
+    std::vector<Entry> entries = m_entries;
+    std::sort(entries.begin(), entries.end(), [](const Entry& a, const Entry& b) {
+        uint64_t hashA = hashAssetPath(a.path);
+        uint64_t hashB = hashAssetPath(b.path);
+        return hashA != hashB ? hashA < hashB : a.path < b.path;
+    });
+
+    std::string strings;
+    std::vector<ArchiveEntry> entryTable(entries.size());
+    for (size_t i = 0; i < entries.size(); ++i) {
+        entryTable[i].pathHash = hashAssetPath(entries[i].path);
+        entryTable[i].pathOffset = static_cast<uint32_t>(strings.size());
+        entryTable[i].pathLength = static_cast<uint32_t>(entries[i].path.size());
+        entryTable[i].blob = entries[i].blob;
+        entryTable[i].reserved = 0;
+        strings += entries[i].path;
+    }
+
+    ArchiveHeader header;
+    std::memcpy(header.magic, ASSET_ARCHIVE_MAGIC, 4);
+    header.version = ASSET_ARCHIVE_VERSION;
+    header.entryCount = static_cast<uint32_t>(entryTable.size());
+    header.blobCount = static_cast<uint32_t>(m_blobs.size());
+    header.entriesOffset = sizeof(ArchiveHeader);
+    header.blobsOffset = header.entriesOffset + entryTable.size() * sizeof(ArchiveEntry);
+    header.stringsOffset = header.blobsOffset + m_blobs.size() * sizeof(ArchiveBlob);
+    header.stringsSize = strings.size();
+
+    std::vector<ArchiveBlob> blobTable(m_blobs.size());
+    uint64_t offset = alignUp(header.stringsOffset + header.stringsSize);
+    m_stats.uniqueBlobs = m_blobs.size();
+    m_stats.compressedBlobs = 0;
+    m_stats.storedBytes = 0;
+    for (size_t i = 0; i < m_blobs.size(); ++i) {
+        blobTable[i].offset = offset;
+        blobTable[i].storedSize = m_blobs[i].data.size();
+        blobTable[i].size = m_blobs[i].size;
+        blobTable[i].contentHash = m_blobs[i].contentHash;
+        blobTable[i].compression = static_cast<uint32_t>(m_blobs[i].compression);
+        blobTable[i].reserved = 0;
+        offset = alignUp(offset + m_blobs[i].data.size());
+
+        m_stats.storedBytes += m_blobs[i].data.size();
+        if (m_blobs[i].compression != AssetCompression::None) {
+            m_stats.compressedBlobs++;
+        }
+    }
+
+    std::ofstream file(outputPath, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        std::cerr << "Failed to create asset archive: " << outputPath << std::endl;
+        return false;
+    }
+
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(entryTable.data()), entryTable.size() * sizeof(ArchiveEntry));
+    file.write(reinterpret_cast<const char*>(blobTable.data()), blobTable.size() * sizeof(ArchiveBlob));
+    file.write(strings.data(), strings.size());
+
+    static const char padding[BLOB_ALIGNMENT] = {};
+    uint64_t written = header.stringsOffset + header.stringsSize;
+    for (size_t i = 0; i < m_blobs.size(); ++i) {
+        file.write(padding, blobTable[i].offset - written);
+        file.write(reinterpret_cast<const char*>(m_blobs[i].data.data()), m_blobs[i].data.size());
+        written = blobTable[i].offset + m_blobs[i].data.size();
+    }
+
+    if (!file) {
+        std::cerr << "Failed to write asset archive: " << outputPath << std::endl;
+        return false;
+    }
+
+    m_stats.archiveBytes = written;
+    return true;
+}
+
+bool AssetPacker::shouldTryCompression(const std::string& path, AssetPackCompression policy) {
+    if (policy == AssetPackCompression::None) {
+        return false;
+    }
+    if (policy == AssetPackCompression::Always) {
+        return true;
+    }
+
+    // Formats that are compressed already gain nothing
+    size_t dot = path.find_last_of('.');
+    if (dot == std::string::npos) {
+        return true;
+    }
+    std::string ext = path.substr(dot + 1);
+    std::transform(ext.begin(), ext.end(), ext.begin(), [](unsigned char c) { return std::tolower(c); });
+    return ext != "png" && ext != "jpg" && ext != "jpeg" && ext != "ogg" && ext != "mp3" && ext != "rpak";
+}
+
+} // namespace Resources
+} // namespace RPGEngine
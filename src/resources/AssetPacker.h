@@ -0,0 +1,122 @@
+#pragma once
+
+#include "AssetArchive.h"
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <cstdint>
+
+namespace RPGEngine {
+namespace Resources {
+
+/**
+ * How the packer compresses entries
+ */
+enum class AssetPackCompression {
+    None,       // Store everything as is (every read is zero-copy)
+    Auto,       // LZ4 where it saves at least 10%, skipping formats that are already compressed
+    Always      // LZ4 wherever it makes the entry smaller
+};
+
+/**
+ * Packer statistics
+ */
+struct AssetPackerStats {
+    size_t files = 0;
+    size_t uniqueBlobs = 0;
+    size_t duplicates = 0;          // Files stored as a reference to an identical blob
+    size_t compressedBlobs = 0;
+    uint64_t inputBytes = 0;        // Total size of all files
+    uint64_t storedBytes = 0;       // Blob bytes written
+    uint64_t archiveBytes = 0;      // Whole archive
+};
+
+/**
+ * Asset archive builder
+ * Collects files, deduplicates identical contents and writes a packed
+ * archive for the VirtualFileSystem to mount.
+ */
+class AssetPacker {
+public:
+    /**
+     * Constructor
+     * @param compression Default compression policy
+     */
+    explicit AssetPacker(AssetPackCompression compression = AssetPackCompression::Auto);
+
+    /**
+     * Add a file from disk
+     * @param diskPath File to read
+     * @param archivePath Path to store it under (normalized)
+     * @return true if the file was read
+     */
+    bool addFile(const std::string& diskPath, const std::string& archivePath);
+
+    /**
+     * Add a file from memory
+     * @param archivePath Path to store it under (normalized)
+     * @param data Contents
+     * @param compression Compression policy for this entry
+     */
+    void addData(const std::string& archivePath, std::vector<uint8_t> data, AssetPackCompression compression);
+
+    /**
+     * Add a directory recursively
+     * Files are stored as prefix + their path relative to the directory.
+     * @param directory Directory to read
+     * @param prefix Archive path prefix (e.g. "assets/")
+     * @return Number of files added
+     */
+    size_t addDirectory(const std::string& directory, const std::string& prefix);
+
+    /**
+     * Write the archive
+     * @param outputPath Archive path
+     * @return true if the archive was written
+     */
+    bool write(const std::string& outputPath);
+
+    /**
+     * Get statistics of the last write
+     * @return Statistics
+     */
+    const AssetPackerStats& getStats() const { return m_stats; }
+
+private:
+    /**
+     * Pending blob
+     */
+    struct Blob {
+        std::vector<uint8_t> data;      // Stored bytes (compressed if compression != None)
+        uint64_t size = 0;
+        uint64_t contentHash = 0;
+        AssetCompression compression = AssetCompression::None;
+        std::vector<uint8_t> original;  // Kept to confirm duplicates byte for byte
+    };
+
+    /**
+     * Pending entry
+     */
+    struct Entry {
+        std::string path;
+        uint32_t blob = 0;
+    };
+
+    /**
+     * Decide whether an entry should be compressed
+     * @param path Archive path
+     * @param policy Compression policy
+     * @return true if LZ4 should be tried
+     */
+    static bool shouldTryCompression(const std::string& path, AssetPackCompression policy);
+
+    AssetPackCompression m_compression;
+    std::vector<Blob> m_blobs;
+    std::vector<Entry> m_entries;
+    std::unordered_map<std::string, size_t> m_entriesByPath;
+    std::unordered_multimap<uint64_t, uint32_t> m_blobsByHash;
+    AssetPackerStats m_stats;
+};
+
+} // namespace Resources
+} // namespace RPGEngine
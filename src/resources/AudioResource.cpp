@@ -1,6 +1,6 @@
 #include "AudioResource.h"
+#include "VirtualFileSystem.h"
 #include <iostream>
-#include <fstream>
 #include <algorithm>
 #include <cctype>
 
@@ -54,16 +54,23 @@ bool AudioResource::load() {
     
     // Load based on format
     bool success = false;
+    DecodedAudio decoded;
     
     switch (m_format) {
-        case AudioFormat::WAV:
-            success = loadWAV();
+        case AudioFormat::WAV: {
+            AssetView file = VirtualFileSystem::getInstance().open(getPath());
+            if (!file.isValid()) {
+                std::cerr << "Failed to open WAV file: " << getPath() << std::endl;
+                break;
+            }
+            success = parseWAV(file.data(), file.size(), decoded);
             break;
+        }
         case AudioFormat::OGG:
-            success = loadOGG();
+            success = loadOGG(decoded);
             break;
         case AudioFormat::MP3:
-            success = loadMP3();
+            success = loadMP3(decoded);
             break;
         default:
             std::cerr << "Unsupported audio format: " << getPath() << std::endl;
@@ -76,6 +83,48 @@ bool AudioResource::load() {
         return false;
     }
     
+    commitDecoded(decoded);
+    
+    // Set state to loaded
+    setState(ResourceState::Loaded);
+    
+    std::cout << "Loaded audio: " << getPath() << " (" << m_duration << "s, " << m_channels << " channels, " 
+              << m_sampleRate << " Hz, " << (m_streaming ? "streaming" : "static") << ")" << std::endl;
+    
+    return true;
+}
+
+bool AudioResource::decode(std::vector<uint8_t>& fileData) {
+    return parseWAV(fileData.data(), fileData.size(), m_decoded);
+}
+
+bool AudioResource::upload() {
+    if (m_decoded.data.empty()) {
+        return false;
+    }
+    
+    // Replace the version being reloaded
+    if (isLoaded()) {
+        unload();
+    }
+    
+    commitDecoded(m_decoded);
+    discardDecoded();
+    
+    setState(ResourceState::Loaded);
+    return true;
+}
+
+void AudioResource::discardDecoded() {
+    m_decoded = DecodedAudio();
+}
+
+void AudioResource::commitDecoded(DecodedAudio& decoded) {
+    m_data = std::move(decoded.data);
+    m_duration = decoded.duration;
+    m_sampleRate = decoded.sampleRate;
+    m_channels = decoded.channels;
+    
     // Generate OpenAL buffer if not streaming
     if (!m_streaming) {
         alGenBuffers(1, &m_bufferHandle);
@@ -87,13 +136,7 @@ bool AudioResource::load() {
         alBufferData(m_bufferHandle, format, m_data.data(), static_cast<int>(m_data.size()), m_sampleRate);
     }
     
-    // Set state to loaded
-    setState(ResourceState::Loaded);
-    
-    std::cout << "Loaded audio: " << getPath() << " (" << m_duration << "s, " << m_channels << " channels, " 
-              << m_sampleRate << " Hz, " << (m_streaming ? "streaming" : "static") << ")" << std::endl;
-    
-    return true;
+    setMemorySize(m_data.capacity());
 }
 
 void AudioResource::unload() {
@@ -116,6 +159,7 @@ void AudioResource::unload() {
     m_duration = 0.0f;
     m_sampleRate = 0;
     m_channels = 0;
+    setMemorySize(0);
     
     // Set state to unloaded
     setState(ResourceState::Unloaded);
@@ -147,17 +191,13 @@ AudioFormat AudioResource::determineFormat(const std::string& path) {
     return AudioFormat::Unknown;
 }
 
-bool AudioResource::loadWAV() {
-    // Open file
-    std::ifstream file(getPath(), std::ios::binary);
-    if (!file.is_open()) {
-        std::cerr << "Failed to open WAV file: " << getPath() << std::endl;
+bool AudioResource::parseWAV(const uint8_t* fileData, size_t fileSize, DecodedAudio& decoded) {
+    // Read WAV header
+    if (fileSize < 44) {
+        std::cerr << "Invalid WAV file (truncated header): " << getPath() << std::endl;
         return false;
     }
-    
-    // Read WAV header
-    char header[44];
-    file.read(header, 44);
+    const uint8_t* header = fileData;
     
     // Check RIFF header
     if (header[0] != 'R' || header[1] != 'I' || header[2] != 'F' || header[3] != 'F') {
@@ -185,10 +225,10 @@ bool AudioResource::loadWAV() {
     }
     
     // Get channels
-    m_channels = header[22] | (header[23] << 8);
+    decoded.channels = header[22] | (header[23] << 8);
     
     // Get sample rate
-    m_sampleRate = header[24] | (header[25] << 8) | (header[26] << 16) | (header[27] << 24);
+    decoded.sampleRate = header[24] | (header[25] << 8) | (header[26] << 16) | (header[27] << 24);
     
     // Get bits per sample
     int bitsPerSample = header[34] | (header[35] << 8);
@@ -200,60 +240,59 @@ bool AudioResource::loadWAV() {
     }
     
     // Get data size
-    int dataSize = header[40] | (header[41] << 8) | (header[42] << 16) | (header[43] << 24);
-    
-    // Calculate duration
-    int bytesPerSample = bitsPerSample / 8;
-    int bytesPerSecond = m_sampleRate * m_channels * bytesPerSample;
-    m_duration = static_cast<float>(dataSize) / bytesPerSecond;
+    uint32_t dataSize = header[40] | (header[41] << 8) | (header[42] << 16) | (static_cast<uint32_t>(header[43]) << 24);
     
-    // Read audio data
-    m_data.resize(dataSize);
-    file.read(reinterpret_cast<char*>(m_data.data()), dataSize);
-    
-    // Check if read was successful
-    if (file.gcount() != dataSize) {
+    // Check the data is all there
+    if (fileSize - 44 < dataSize) {
         std::cerr << "Failed to read WAV data: " << getPath() << std::endl;
         return false;
     }
     
+    // Calculate duration
+    int bytesPerSample = bitsPerSample / 8;
+    int bytesPerSecond = decoded.sampleRate * decoded.channels * bytesPerSample;
+    decoded.duration = bytesPerSecond > 0 ? static_cast<float>(dataSize) / bytesPerSecond : 0.0f;
+    
+    // Copy audio data
+    decoded.data.assign(fileData + 44, fileData + 44 + dataSize);
+    
     return true;
 }
 
-bool AudioResource::loadOGG() {
+bool AudioResource::loadOGG(DecodedAudio& decoded) {
     // In a real implementation, this would use a library like libvorbis
     // For this example, we'll just simulate loading an OGG file
     
     std::cout << "Simulating OGG loading: " << getPath() << std::endl;
     
     // Simulate audio properties
-    m_channels = 2;
-    m_sampleRate = 44100;
-    m_duration = 30.0f; // 30 seconds
+    decoded.channels = 2;
+    decoded.sampleRate = 44100;
+    decoded.duration = 30.0f; // 30 seconds
     
     // Simulate audio data (1 second of silence)
     int bytesPerSample = 2; // 16-bit
-    int dataSize = m_sampleRate * m_channels * bytesPerSample;
-    m_data.resize(dataSize, 0);
+    int dataSize = decoded.sampleRate * decoded.channels * bytesPerSample;
+    decoded.data.resize(dataSize, 0);
     
     return true;
 }
 
-bool AudioResource::loadMP3() {
+bool AudioResource::loadMP3(DecodedAudio& decoded) {
     // In a real implementation, this would use a library like libmpg123
     // For this example, we'll just simulate loading an MP3 file
     
     std::cout << "Simulating MP3 loading: " << getPath() << std::endl;
     
     // Simulate audio properties
-    m_channels = 2;
-    m_sampleRate = 44100;
-    m_duration = 60.0f; // 60 seconds
+    decoded.channels = 2;
+    decoded.sampleRate = 44100;
+    decoded.duration = 60.0f; // 60 seconds
     
     // Simulate audio data (1 second of silence)
     int bytesPerSample = 2; // 16-bit
-    int dataSize = m_sampleRate * m_channels * bytesPerSample;
-    m_data.resize(dataSize, 0);
+    int dataSize = decoded.sampleRate * decoded.channels * bytesPerSample;
+    decoded.data.resize(dataSize, 0);
     
     return true;
 }
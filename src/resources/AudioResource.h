@@ -48,6 +48,19 @@ public:
      */
     void unload() override;
     
+    /**
+     * Get the budget category
+     * @return ResourceCategory::Audio
+     */
+    ResourceCategory getCategory() const override { return ResourceCategory::Audio; }
+    
+    // Staged loading: WAV files are parsed on a worker and committed by upload().
+    // OGG and MP3 decoding is simulated without reading the file, so they load directly.
+    bool supportsStagedLoad() const override { return m_format == AudioFormat::WAV; }
+    bool decode(std::vector<uint8_t>& fileData) override;
+    bool upload() override;
+    void discardDecoded() override;
+    
     /**
      * Get the audio format
      * @return Audio format
@@ -97,6 +110,16 @@ public:
     unsigned int getBufferHandle() const { return m_bufferHandle; }
     
 private:
+    /**
+     * Audio decoded off the main thread, waiting to be committed
+     */
+    struct DecodedAudio {
+        std::vector<uint8_t> data;
+        float duration = 0.0f;
+        int sampleRate = 0;
+        int channels = 0;
+    };
+    
     /**
      * Determine the audio format from the file extension
      * @param path File path
@@ -105,22 +128,33 @@ private:
     AudioFormat determineFormat(const std::string& path);
     
     /**
-     * Load WAV file
-     * @return true if the file was loaded successfully
+     * Parse a WAV file
+     * @param fileData File contents
+     * @param fileSize Size of the contents
+     * @param decoded Receives the PCM data and format
+     * @return true if the file was parsed successfully
      */
-    bool loadWAV();
+    bool parseWAV(const uint8_t* fileData, size_t fileSize, DecodedAudio& decoded);
     
     /**
      * Load OGG file
+     * @param decoded Receives the PCM data and format
      * @return true if the file was loaded successfully
      */
-    bool loadOGG();
+    bool loadOGG(DecodedAudio& decoded);
     
     /**
      * Load MP3 file
+     * @param decoded Receives the PCM data and format
      * @return true if the file was loaded successfully
      */
-    bool loadMP3();
+    bool loadMP3(DecodedAudio& decoded);
+    
+    /**
+     * Make decoded audio the live data and create its buffer
+     * @param decoded Decoded audio, moved from
+     */
+    void commitDecoded(DecodedAudio& decoded);
     
     AudioFormat m_format;           // Audio format
     float m_duration;               // Audio duration in seconds
@@ -129,6 +163,7 @@ private:
     bool m_streaming;               // Whether to stream the audio
     std::vector<uint8_t> m_data;    // Audio data
     unsigned int m_bufferHandle;    // Audio buffer handle
+    DecodedAudio m_decoded;         // Staged data waiting for upload()
 };
 
 } // namespace Resources
@@ -0,0 +1,252 @@
+#include "ContentCooker.h"
+#include <iostream>
+#include <fstream>
+#include <algorithm>
+
+namespace RPGEngine {
+namespace Resources {
+
+void ContentCooker::addDialogueTree(const Components::DialogueTree& tree) {
+    if (tree.id.empty()) {
+        std::cerr << "Warning: Cannot cook dialogue tree with empty ID" << std::endl;
+        return;
+    }
+    if (tree.nodeSource) {
+        std::cerr << "Warning: Cannot cook lazily loaded dialogue tree: " << tree.id << std::endl;
+        return;
+    }
+
+    m_trees[tree.id] = tree;
+}
+
+void ContentCooker::addQuestDefinition(const Components::QuestDefinition& definition) {
+    if (definition.id.empty()) {
+        std::cerr << "Warning: Cannot cook quest with empty ID" << std::endl;
+        return;
+    }
+
+    m_quests[definition.id] = definition;
+}
+
+bool ContentCooker::write(const std::string& outputPath) {
+    m_strings.clear();
+    m_chars.clear();
+    m_stringIndex.clear();
+    m_words.clear();
+    m_stats = ContentCookerStats();
+
+    std::vector<ContentTree> trees;
+    std::vector<ContentNode> nodes;
+    std::vector<ContentQuest> quests;
+
+    for (const auto& treePair : m_trees) {
+        const Components::DialogueTree& tree = treePair.second;
+
+        ContentTree entry = {};
+        entry.idHash = hashAssetPath(tree.id);
+        entry.id = addString(tree.id);
+        entry.name = addString(tree.name);
+        entry.description = addString(tree.description);
+        entry.startNode = addString(tree.startNodeId);
+        entry.variables = static_cast<uint32_t>(m_words.size());
+        writePairs(tree.variables);
+
+        // Nodes sorted by hash within the tree, for binary search
+        std::vector<const Components::DialogueNode*> sorted;
+        for (const auto& nodePair : tree.nodes) {
+            sorted.push_back(&nodePair.second);
+        }
+        std::sort(sorted.begin(), sorted.end(), [](const Components::DialogueNode* a, const Components::DialogueNode* b) {
+            uint64_t hashA = hashAssetPath(a->id);
+            uint64_t hashB = hashAssetPath(b->id);
+            return hashA != hashB ? hashA < hashB : a->id < b->id;
+        });
+
+        entry.firstNode = static_cast<uint32_t>(nodes.size());
+        entry.nodeCount = static_cast<uint32_t>(sorted.size());
+        for (const Components::DialogueNode* node : sorted) {
+            ContentNode nodeEntry = {};
+            nodeEntry.idHash = hashAssetPath(node->id);
+            nodeEntry.id = addString(node->id);
+            nodeEntry.record = writeNode(*node);
+            nodeEntry.recordWords = static_cast<uint32_t>(m_words.size()) - nodeEntry.record;
+            nodes.push_back(nodeEntry);
+        }
+        trees.push_back(entry);
+    }
+
+    for (const auto& questPair : m_quests) {
+        ContentQuest entry = {};
+        entry.idHash = hashAssetPath(questPair.first);
+        entry.id = addString(questPair.first);
+        entry.record = writeQuest(questPair.second);
+        entry.recordWords = static_cast<uint32_t>(m_words.size()) - entry.record;
+        quests.push_back(entry);
+    }
+
+    // Stable sorts keep hash collisions in ID order
+    std::stable_sort(trees.begin(), trees.end(), [](const ContentTree& a, const ContentTree& b) {
+        return a.idHash < b.idHash;
+    });
+    std::stable_sort(quests.begin(), quests.end(), [](const ContentQuest& a, const ContentQuest& b) {
+        return a.idHash < b.idHash;
+    });
+
+    ContentHeader header = {};
+    std::copy(CONTENT_DATABASE_MAGIC, CONTENT_DATABASE_MAGIC + 4, header.magic);
+    header.version = CONTENT_DATABASE_VERSION;
+    header.treeCount = static_cast<uint32_t>(trees.size());
+    header.nodeCount = static_cast<uint32_t>(nodes.size());
+    header.questCount = static_cast<uint32_t>(quests.size());
+    header.stringCount = static_cast<uint32_t>(m_strings.size());
+    header.treesOffset = sizeof(ContentHeader);
+    header.nodesOffset = header.treesOffset + trees.size() * sizeof(ContentTree);
+    header.questsOffset = header.nodesOffset + nodes.size() * sizeof(ContentNode);
+    header.stringsOffset = header.questsOffset + quests.size() * sizeof(ContentQuest);
+    header.wordsOffset = header.stringsOffset + m_strings.size() * sizeof(ContentString);
+    header.wordCount = m_words.size();
+    header.charsOffset = header.wordsOffset + m_words.size() * sizeof(uint32_t);
+    header.charsSize = m_chars.size();
+
+    std::ofstream file(outputPath, std::ios::binary | std::ios::trunc);
+    if (!file.is_open()) {
+        std::cerr << "Failed to open content database for writing: " << outputPath << std::endl;
+        return false;
+    }
+
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.write(reinterpret_cast<const char*>(trees.data()), trees.size() * sizeof(ContentTree));
+    file.write(reinterpret_cast<const char*>(nodes.data()), nodes.size() * sizeof(ContentNode));
+    file.write(reinterpret_cast<const char*>(quests.data()), quests.size() * sizeof(ContentQuest));
+    file.write(reinterpret_cast<const char*>(m_strings.data()), m_strings.size() * sizeof(ContentString));
+    file.write(reinterpret_cast<const char*>(m_words.data()), m_words.size() * sizeof(uint32_t));
+    file.write(m_chars.data(), m_chars.size());
+    if (!file) {
+        std::cerr << "Failed to write content database: " << outputPath << std::endl;
+        return false;
+    }
+
+    m_stats.trees = trees.size();
+    m_stats.nodes = nodes.size();
+    m_stats.quests = quests.size();
+    m_stats.strings = m_strings.size();
+    m_stats.stringBytes = m_chars.size();
+    m_stats.recordBytes = m_words.size() * sizeof(uint32_t);
+    m_stats.databaseBytes = header.charsOffset + header.charsSize;
+    return true;
+}
+
+uint32_t ContentCooker::addString(const std::string& text) {
+    m_stats.stringReferences++;
+
+    auto it = m_stringIndex.find(text);
+    if (it != m_stringIndex.end()) {
+        return it->second;
+    }
+
+    ContentString string;
+    string.offset = static_cast<uint32_t>(m_chars.size());
+    string.length = static_cast<uint32_t>(text.size());
+    m_chars += text;
+
+    uint32_t index = static_cast<uint32_t>(m_strings.size());
+    m_strings.push_back(string);
+    m_stringIndex.emplace(text, index);
+    return index;
+}
+
+void ContentCooker::writeConditions(const std::vector<Components::DialogueCondition>& conditions) {
+    m_words.push_back(static_cast<uint32_t>(conditions.size()));
+    for (const auto& condition : conditions) {
+        m_words.push_back(addString(condition.type));
+        m_words.push_back(addString(condition.target));
+        m_words.push_back(addString(condition.operation));
+        m_words.push_back(addString(condition.value));
+        m_words.push_back(condition.negate ? 1 : 0);
+    }
+}
+
+void ContentCooker::writeActions(const std::vector<Components::DialogueAction>& actions) {
+    m_words.push_back(static_cast<uint32_t>(actions.size()));
+    for (const auto& action : actions) {
+        m_words.push_back(addString(action.type));
+        m_words.push_back(addString(action.target));
+        m_words.push_back(addString(action.value));
+        writePairs(action.parameters);
+    }
+}
+
+void ContentCooker::writePairs(const std::unordered_map<std::string, std::string>& pairs) {
+    // Sorted so the same content cooks to the same bytes
+    std::map<std::string, std::string> sorted(pairs.begin(), pairs.end());
+    m_words.push_back(static_cast<uint32_t>(sorted.size()));
+    for (const auto& pair : sorted) {
+        m_words.push_back(addString(pair.first));
+        m_words.push_back(addString(pair.second));
+    }
+}
+
+uint32_t ContentCooker::writeNode(const Components::DialogueNode& node) {
+    uint32_t record = static_cast<uint32_t>(m_words.size());
+
+    m_words.push_back(static_cast<uint32_t>(node.type));
+    m_words.push_back(addString(node.speaker));
+    m_words.push_back(addString(node.text));
+    m_words.push_back(addString(node.nextNodeId));
+    writeConditions(node.conditions);
+    writeActions(node.actions);
+    writePairs(node.metadata);
+
+    m_words.push_back(static_cast<uint32_t>(node.choices.size()));
+    for (const auto& choice : node.choices) {
+        m_words.push_back(addString(choice.id));
+        m_words.push_back(addString(choice.text));
+        m_words.push_back(addString(choice.nextNodeId));
+        m_words.push_back((choice.enabled ? 1u : 0u) | (choice.visible ? 2u : 0u));
+        writeConditions(choice.conditions);
+        writeActions(choice.actions);
+    }
+
+    return record;
+}
+
+uint32_t ContentCooker::writeQuest(const Components::QuestDefinition& definition) {
+    uint32_t record = static_cast<uint32_t>(m_words.size());
+
+    m_words.push_back(addString(definition.name));
+    m_words.push_back(addString(definition.description));
+    m_words.push_back(addString(definition.category));
+    m_words.push_back(static_cast<uint32_t>(definition.level));
+    m_words.push_back((definition.isRepeatable ? 1u : 0u) | (definition.isAutoComplete ? 2u : 0u));
+    m_words.push_back(static_cast<uint32_t>(definition.timeLimit));
+
+    m_words.push_back(static_cast<uint32_t>(definition.prerequisites.size()));
+    for (const auto& prerequisite : definition.prerequisites) {
+        m_words.push_back(addString(prerequisite));
+    }
+
+    m_words.push_back(static_cast<uint32_t>(definition.objectives.size()));
+    for (const auto& objective : definition.objectives) {
+        m_words.push_back(addString(objective.id));
+        m_words.push_back(addString(objective.description));
+        m_words.push_back(static_cast<uint32_t>(objective.type));
+        m_words.push_back(addString(objective.target));
+        m_words.push_back(static_cast<uint32_t>(objective.requiredCount));
+        m_words.push_back((objective.isOptional ? 1u : 0u) | (objective.isHidden ? 2u : 0u));
+        writePairs(objective.parameters);
+    }
+
+    m_words.push_back(static_cast<uint32_t>(definition.rewards.size()));
+    for (const auto& reward : definition.rewards) {
+        m_words.push_back(addString(reward.type));
+        m_words.push_back(addString(reward.target));
+        m_words.push_back(static_cast<uint32_t>(reward.amount));
+        writePairs(reward.parameters);
+    }
+
+    writePairs(definition.metadata);
+    return record;
+}
+
+} // namespace Resources
+} // namespace RPGEngine
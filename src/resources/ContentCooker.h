@@ -0,0 +1,82 @@
+#pragma once
+
+#include "ContentDatabase.h"
+#include <string>
+#include <vector>
+#include <map>
+#include <unordered_map>
+#include <cstdint>
+
+namespace RPGEngine {
+namespace Resources {
+
+/**
+ * Cooker statistics
+ */
+struct ContentCookerStats {
+    size_t trees = 0;
+    size_t nodes = 0;
+    size_t quests = 0;
+    size_t strings = 0;             // Unique strings stored
+    size_t stringReferences = 0;    // Strings referenced by records, before deduplication
+    uint64_t stringBytes = 0;       // Characters written
+    uint64_t recordBytes = 0;       // Record words written
+    uint64_t databaseBytes = 0;     // Whole database
+};
+
+/**
+ * Content database builder
+ * Collects dialogue trees and quest definitions and writes a database for
+ * ContentDatabase to map. Adding a tree or quest with an ID that was
+ * already added replaces it.
+ */
+class ContentCooker {
+public:
+    /**
+     * Add a dialogue tree
+     * @param tree Tree
+     */
+    void addDialogueTree(const Components::DialogueTree& tree);
+
+    /**
+     * Add a quest definition
+     * @param definition Definition
+     */
+    void addQuestDefinition(const Components::QuestDefinition& definition);
+
+    /**
+     * Write the database
+     * @param outputPath Database path
+     * @return true if written
+     */
+    bool write(const std::string& outputPath);
+
+    const ContentCookerStats& getStats() const { return m_stats; }
+
+private:
+    /**
+     * Get the index of a string, adding it if new
+     */
+    uint32_t addString(const std::string& text);
+
+    void writeConditions(const std::vector<Components::DialogueCondition>& conditions);
+    void writeActions(const std::vector<Components::DialogueAction>& actions);
+    void writePairs(const std::unordered_map<std::string, std::string>& pairs);
+    uint32_t writeNode(const Components::DialogueNode& node);
+    uint32_t writeQuest(const Components::QuestDefinition& definition);
+
+    // Sorted by ID so the same content cooks to the same bytes
+    std::map<std::string, Components::DialogueTree> m_trees;
+    std::map<std::string, Components::QuestDefinition> m_quests;
+
+    // Built by write()
+    std::vector<ContentString> m_strings;
+    std::string m_chars;
+    std::unordered_map<std::string, uint32_t> m_stringIndex;
+    std::vector<uint32_t> m_words;
+
+    ContentCookerStats m_stats;
+};
+
+} // namespace Resources
+} // namespace RPGEngine
@@ -0,0 +1,445 @@
+#include "ContentDatabase.h"
+#include <iostream>
+#include <algorithm>
+#include <cstring>
+
+namespace RPGEngine {
+namespace Resources {
+
+namespace {
+
+/**
+ * Bounds-checked reader over one record's words
+ * Any read past the record or of an invalid string index marks the record
+ * as corrupt and returns empty values from then on.
+ */
+class RecordReader {
+public:
+    RecordReader(const uint32_t* words, uint32_t count, const ContentString* strings, uint32_t stringCount, const char* chars)
+        : m_word(words), m_end(words + count), m_strings(strings), m_stringCount(stringCount), m_chars(chars), m_ok(true) {}
+
+    uint32_t word() {
+        if (m_word >= m_end) {
+            m_ok = false;
+            return 0;
+        }
+        return *m_word++;
+    }
+
+    std::string string() {
+        uint32_t index = word();
+        if (index >= m_stringCount) {
+            m_ok = false;
+            return std::string();
+        }
+        return std::string(m_chars + m_strings[index].offset, m_strings[index].length);
+    }
+
+    /**
+     * Read a count, rejecting counts the rest of the record can't hold
+     * @param wordsPerItem Minimum words each item takes
+     */
+    uint32_t count(uint32_t wordsPerItem) {
+        uint32_t value = word();
+        if (uint64_t(value) * wordsPerItem > static_cast<uint64_t>(m_end - m_word)) {
+            m_ok = false;
+            return 0;
+        }
+        return value;
+    }
+
+    void pairs(std::unordered_map<std::string, std::string>& outPairs) {
+        uint32_t pairCount = count(2);
+        for (uint32_t i = 0; i < pairCount && m_ok; ++i) {
+            std::string key = string();
+            outPairs[key] = string();
+        }
+    }
+
+    void conditions(std::vector<Components::DialogueCondition>& outConditions) {
+        uint32_t conditionCount = count(5);
+        outConditions.reserve(conditionCount);
+        for (uint32_t i = 0; i < conditionCount && m_ok; ++i) {
+            Components::DialogueCondition condition;
+            condition.type = string();
+            condition.target = string();
+            condition.operation = string();
+            condition.value = string();
+            condition.negate = word() != 0;
+            outConditions.push_back(std::move(condition));
+        }
+    }
+
+    void actions(std::vector<Components::DialogueAction>& outActions) {
+        uint32_t actionCount = count(4);
+        outActions.reserve(actionCount);
+        for (uint32_t i = 0; i < actionCount && m_ok; ++i) {
+            Components::DialogueAction action;
+            action.type = string();
+            action.target = string();
+            action.value = string();
+            pairs(action.parameters);
+            outActions.push_back(std::move(action));
+        }
+    }
+
+    void fail() { m_ok = false; }
+    bool ok() const { return m_ok; }
+
+private:
+    const uint32_t* m_word;
+    const uint32_t* m_end;
+    const ContentString* m_strings;
+    uint32_t m_stringCount;
+    const char* m_chars;
+    bool m_ok;
+};
+
+} // namespace
+
+/**
+ * Node source decoding nodes of one tree from the database
+ * Holds the database, and with it the mapping, for as long as the tree lives.
+ */
+class ContentNodeSource : public Components::DialogueNodeSource {
+public:
+    ContentNodeSource(std::shared_ptr<const ContentDatabase> database, const ContentTree& tree)
+        : m_database(std::move(database)), m_tree(tree) {}
+
+    bool loadNode(const std::string& nodeId, Components::DialogueNode& outNode) const override {
+        const ContentNode* node = m_database->findNode(m_tree, nodeId);
+        return node && m_database->decodeNode(*node, outNode);
+    }
+
+    bool hasNode(const std::string& nodeId) const override {
+        return m_database->findNode(m_tree, nodeId) != nullptr;
+    }
+
+    size_t getNodeCount() const override {
+        return m_tree.nodeCount;
+    }
+
+private:
+    std::shared_ptr<const ContentDatabase> m_database;
+    const ContentTree& m_tree;
+};
+
+std::shared_ptr<ContentDatabase> ContentDatabase::open(const std::string& path) {
+    std::shared_ptr<ContentDatabase> database(new ContentDatabase());
+    database->m_path = path;
+    database->m_file = MappedFile::open(path);
+    if (!database->m_file) {
+        std::cerr << "Failed to open content database: " << path << std::endl;
+        return nullptr;
+    }
+
+    if (!database->validate()) {
+        std::cerr << "Invalid content database: " << path << std::endl;
+        return nullptr;
+    }
+
+    return database;
+}
+
+bool ContentDatabase::validate() {
+    const uint8_t* base = m_file->data();
+    const size_t size = m_file->size();
+
+    if (size < sizeof(ContentHeader)) {
+        return false;
+    }
+
+    m_header = reinterpret_cast<const ContentHeader*>(base);
+    if (std::memcmp(m_header->magic, CONTENT_DATABASE_MAGIC, 4) != 0 || m_header->version != CONTENT_DATABASE_VERSION) {
+        return false;
+    }
+
+    auto fits = [size](uint64_t offset, uint64_t bytes) {
+        return offset <= size && bytes <= size - offset;
+    };
+
+    // Tables are read in place, so they must be aligned
+    if (m_header->treesOffset % 8 != 0 || m_header->nodesOffset % 8 != 0 || m_header->questsOffset % 8 != 0 ||
+        m_header->stringsOffset % 4 != 0 || m_header->wordsOffset % 4 != 0 || m_header->wordCount > UINT32_MAX) {
+        return false;
+    }
+
+    if (!fits(m_header->treesOffset, uint64_t(m_header->treeCount) * sizeof(ContentTree)) ||
+        !fits(m_header->nodesOffset, uint64_t(m_header->nodeCount) * sizeof(ContentNode)) ||
+        !fits(m_header->questsOffset, uint64_t(m_header->questCount) * sizeof(ContentQuest)) ||
+        !fits(m_header->stringsOffset, uint64_t(m_header->stringCount) * sizeof(ContentString)) ||
+        !fits(m_header->wordsOffset, m_header->wordCount * sizeof(uint32_t)) ||
+        !fits(m_header->charsOffset, m_header->charsSize)) {
+        return false;
+    }
+
+    m_trees = reinterpret_cast<const ContentTree*>(base + m_header->treesOffset);
+    m_nodes = reinterpret_cast<const ContentNode*>(base + m_header->nodesOffset);
+    m_quests = reinterpret_cast<const ContentQuest*>(base + m_header->questsOffset);
+    m_strings = reinterpret_cast<const ContentString*>(base + m_header->stringsOffset);
+    m_words = reinterpret_cast<const uint32_t*>(base + m_header->wordsOffset);
+    m_chars = reinterpret_cast<const char*>(base + m_header->charsOffset);
+
+    // Check every reference once so lookups don't have to; records are
+    // checked word by word as they are decoded
+    auto validString = [this](uint32_t string) {
+        return string < m_header->stringCount;
+    };
+    auto validRecord = [this](uint32_t record, uint32_t words) {
+        return uint64_t(record) + words <= m_header->wordCount;
+    };
+
+    for (uint32_t i = 0; i < m_header->stringCount; ++i) {
+        if (uint64_t(m_strings[i].offset) + m_strings[i].length > m_header->charsSize) {
+            return false;
+        }
+    }
+    for (uint32_t i = 0; i < m_header->treeCount; ++i) {
+        const ContentTree& tree = m_trees[i];
+        if (!validString(tree.id) || !validString(tree.name) || !validString(tree.description) ||
+            !validString(tree.startNode) || tree.variables >= m_header->wordCount ||
+            uint64_t(tree.firstNode) + tree.nodeCount > m_header->nodeCount) {
+            return false;
+        }
+    }
+    for (uint32_t i = 0; i < m_header->nodeCount; ++i) {
+        if (!validString(m_nodes[i].id) || !validRecord(m_nodes[i].record, m_nodes[i].recordWords)) {
+            return false;
+        }
+    }
+    for (uint32_t i = 0; i < m_header->questCount; ++i) {
+        if (!validString(m_quests[i].id) || !validRecord(m_quests[i].record, m_quests[i].recordWords)) {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+std::shared_ptr<const Components::DialogueTree> ContentDatabase::getDialogueTree(const std::string& treeId) {
+    const ContentTree* entry = findTree(treeId);
+    if (!entry) {
+        return nullptr;
+    }
+
+    uint32_t index = static_cast<uint32_t>(entry - m_trees);
+    std::lock_guard<std::mutex> lock(m_treeMutex);
+
+    auto live = m_liveTrees.find(index);
+    if (live != m_liveTrees.end()) {
+        if (auto tree = live->second.lock()) {
+            return tree;
+        }
+    }
+
+    auto tree = std::make_shared<Components::DialogueTree>(getString(entry->id), getString(entry->name));
+    tree->description = getString(entry->description);
+    tree->startNodeId = getString(entry->startNode);
+
+    RecordReader reader(m_words + entry->variables, static_cast<uint32_t>(m_header->wordCount - entry->variables),
+                        m_strings, m_header->stringCount, m_chars);
+    reader.pairs(tree->variables);
+    if (!reader.ok()) {
+        std::cerr << "Corrupt dialogue tree: " << treeId << " in " << m_path << std::endl;
+        return nullptr;
+    }
+
+    tree->nodeSource = std::make_shared<ContentNodeSource>(shared_from_this(), *entry);
+    m_liveTrees[index] = tree;
+    return tree;
+}
+
+bool ContentDatabase::loadDialogueNode(const std::string& treeId, const std::string& nodeId, Components::DialogueNode& outNode) const {
+    const ContentTree* tree = findTree(treeId);
+    const ContentNode* node = tree ? findNode(*tree, nodeId) : nullptr;
+    return node && decodeNode(*node, outNode);
+}
+
+bool ContentDatabase::loadQuestDefinition(const std::string& questId, Components::QuestDefinition& outDefinition) const {
+    const ContentQuest* quest = findQuest(questId);
+    if (!quest) {
+        return false;
+    }
+
+    RecordReader reader(m_words + quest->record, quest->recordWords, m_strings, m_header->stringCount, m_chars);
+    Components::QuestDefinition definition(getString(quest->id));
+    definition.name = reader.string();
+    definition.description = reader.string();
+    definition.category = reader.string();
+    definition.level = static_cast<int>(reader.word());
+    uint32_t flags = reader.word();
+    definition.isRepeatable = (flags & 1u) != 0;
+    definition.isAutoComplete = (flags & 2u) != 0;
+    definition.timeLimit = static_cast<int>(reader.word());
+
+    uint32_t prerequisiteCount = reader.count(1);
+    for (uint32_t i = 0; i < prerequisiteCount && reader.ok(); ++i) {
+        definition.prerequisites.push_back(reader.string());
+    }
+
+    uint32_t objectiveCount = reader.count(7);
+    for (uint32_t i = 0; i < objectiveCount && reader.ok(); ++i) {
+        std::string id = reader.string();
+        std::string description = reader.string();
+        uint32_t type = reader.word();
+        std::string target = reader.string();
+        int required = static_cast<int>(reader.word());
+        if (type > static_cast<uint32_t>(Components::ObjectiveType::Custom)) {
+            reader.fail();
+            break;
+        }
+        Components::QuestObjective objective(id, description, static_cast<Components::ObjectiveType>(type), target, required);
+        uint32_t objectiveFlags = reader.word();
+        objective.isOptional = (objectiveFlags & 1u) != 0;
+        objective.isHidden = (objectiveFlags & 2u) != 0;
+        reader.pairs(objective.parameters);
+        definition.objectives.push_back(std::move(objective));
+    }
+
+    uint32_t rewardCount = reader.count(4);
+    for (uint32_t i = 0; i < rewardCount && reader.ok(); ++i) {
+        std::string type = reader.string();
+        std::string target = reader.string();
+        Components::QuestReward reward(type, target, static_cast<int>(reader.word()));
+        reader.pairs(reward.parameters);
+        definition.rewards.push_back(std::move(reward));
+    }
+
+    reader.pairs(definition.metadata);
+    if (!reader.ok()) {
+        std::cerr << "Corrupt quest definition: " << questId << " in " << m_path << std::endl;
+        return false;
+    }
+
+    outDefinition = std::move(definition);
+    return true;
+}
+
+void ContentDatabase::installQuestDefinitionSource() {
+    std::weak_ptr<const ContentDatabase> database = shared_from_this();
+    Components::QuestComponent::setQuestDefinitionSource(
+        [database](const std::string& questId, Components::QuestDefinition& outDefinition) {
+            auto locked = database.lock();
+            return locked && locked->loadQuestDefinition(questId, outDefinition);
+        });
+}
+
+std::vector<std::string> ContentDatabase::listDialogueTrees() const {
+    std::vector<std::string> ids;
+    ids.reserve(m_header->treeCount);
+    for (uint32_t i = 0; i < m_header->treeCount; ++i) {
+        ids.push_back(getString(m_trees[i].id));
+    }
+    return ids;
+}
+
+size_t ContentDatabase::getLiveTreeCount() const {
+    std::lock_guard<std::mutex> lock(m_treeMutex);
+    size_t count = 0;
+    for (const auto& pair : m_liveTrees) {
+        count += pair.second.expired() ? 0 : 1;
+    }
+    return count;
+}
+
+const ContentTree* ContentDatabase::findTree(const std::string& treeId) const {
+    const uint64_t hash = hashAssetPath(treeId);
+    const ContentTree* end = m_trees + m_header->treeCount;
+    const ContentTree* it = std::lower_bound(m_trees, end, hash, [](const ContentTree& tree, uint64_t value) {
+        return tree.idHash < value;
+    });
+
+    // Compare the strings in case two IDs share a hash
+    for (; it != end && it->idHash == hash; ++it) {
+        if (equals(it->id, treeId)) {
+            return it;
+        }
+    }
+
+    return nullptr;
+}
+
+const ContentNode* ContentDatabase::findNode(const ContentTree& tree, const std::string& nodeId) const {
+    const uint64_t hash = hashAssetPath(nodeId);
+    const ContentNode* begin = m_nodes + tree.firstNode;
+    const ContentNode* end = begin + tree.nodeCount;
+    const ContentNode* it = std::lower_bound(begin, end, hash, [](const ContentNode& node, uint64_t value) {
+        return node.idHash < value;
+    });
+
+    for (; it != end && it->idHash == hash; ++it) {
+        if (equals(it->id, nodeId)) {
+            return it;
+        }
+    }
+
+    return nullptr;
+}
+
+const ContentQuest* ContentDatabase::findQuest(const std::string& questId) const {
+    const uint64_t hash = hashAssetPath(questId);
+    const ContentQuest* end = m_quests + m_header->questCount;
+    const ContentQuest* it = std::lower_bound(m_quests, end, hash, [](const ContentQuest& quest, uint64_t value) {
+        return quest.idHash < value;
+    });
+
+    for (; it != end && it->idHash == hash; ++it) {
+        if (equals(it->id, questId)) {
+            return it;
+        }
+    }
+
+    return nullptr;
+}
+
+bool ContentDatabase::decodeNode(const ContentNode& node, Components::DialogueNode& outNode) const {
+    RecordReader reader(m_words + node.record, node.recordWords, m_strings, m_header->stringCount, m_chars);
+
+    uint32_t type = reader.word();
+    if (type > static_cast<uint32_t>(Components::DialogueNodeType::End)) {
+        std::cerr << "Corrupt dialogue node: " << getString(node.id) << " in " << m_path << std::endl;
+        return false;
+    }
+
+    Components::DialogueNode decoded(getString(node.id), static_cast<Components::DialogueNodeType>(type));
+    decoded.speaker = reader.string();
+    decoded.text = reader.string();
+    decoded.nextNodeId = reader.string();
+    reader.conditions(decoded.conditions);
+    reader.actions(decoded.actions);
+    reader.pairs(decoded.metadata);
+
+    uint32_t choiceCount = reader.count(6);
+    decoded.choices.reserve(choiceCount);
+    for (uint32_t i = 0; i < choiceCount && reader.ok(); ++i) {
+        std::string id = reader.string();
+        std::string text = reader.string();
+        Components::DialogueChoice choice(id, text, reader.string());
+        uint32_t flags = reader.word();
+        choice.enabled = (flags & 1u) != 0;
+        choice.visible = (flags & 2u) != 0;
+        reader.conditions(choice.conditions);
+        reader.actions(choice.actions);
+        decoded.choices.push_back(std::move(choice));
+    }
+
+    if (!reader.ok()) {
+        std::cerr << "Corrupt dialogue node: " << decoded.id << " in " << m_path << std::endl;
+        return false;
+    }
+
+    outNode = std::move(decoded);
+    return true;
+}
+
+bool ContentDatabase::equals(uint32_t string, const std::string& text) const {
+    const ContentString& stored = m_strings[string];
+    return stored.length == text.size() && std::memcmp(m_chars + stored.offset, text.data(), text.size()) == 0;
+}
+
+std::string ContentDatabase::getString(uint32_t string) const {
+    return std::string(m_chars + m_strings[string].offset, m_strings[string].length);
+}
+
+} // namespace Resources
+} // namespace RPGEngine
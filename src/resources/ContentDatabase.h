@@ -0,0 +1,212 @@
+#pragma once
+
+#include "AssetArchive.h"
+#include "../components/DialogueComponent.h"
+#include "../components/QuestComponent.h"
+#include <string>
+#include <vector>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <cstdint>
+
+namespace RPGEngine {
+namespace Resources {
+
+/**
+ * Cooked content database layout (little endian)
+ *
+ *   ContentHeader
+ *   ContentTree[treeCount]       sorted by idHash
+ *   ContentNode[nodeCount]       grouped by tree, sorted by idHash within a tree
+ *   ContentQuest[questCount]     sorted by idHash
+ *   ContentString[stringCount]
+ *   record words                 uint32 words, referenced by trees, nodes and quests
+ *   characters                   not terminated, referenced by strings
+ *
+ * Strings are deduplicated, so text shared by many nodes is stored once.
+ * Records encode a node or quest definition as counts and string indices,
+ * decoded only when the node or quest is first used.
+ */
+const char CONTENT_DATABASE_MAGIC[4] = {'R', 'P', 'D', 'B'};
+const uint32_t CONTENT_DATABASE_VERSION = 1;
+
+struct ContentHeader {
+    char magic[4];
+    uint32_t version;
+    uint32_t treeCount;
+    uint32_t nodeCount;
+    uint32_t questCount;
+    uint32_t stringCount;
+    uint64_t treesOffset;
+    uint64_t nodesOffset;
+    uint64_t questsOffset;
+    uint64_t stringsOffset;
+    uint64_t wordsOffset;
+    uint64_t wordCount;
+    uint64_t charsOffset;
+    uint64_t charsSize;
+};
+
+struct ContentString {
+    uint32_t offset;            // Into the characters
+    uint32_t length;
+};
+
+struct ContentTree {
+    uint64_t idHash;            // hashAssetPath() of the tree ID
+    uint32_t id;                // String index
+    uint32_t name;
+    uint32_t description;
+    uint32_t startNode;
+    uint32_t firstNode;         // Index of the tree's first ContentNode
+    uint32_t nodeCount;
+    uint32_t variables;         // Record word offset of the variable pairs
+    uint32_t reserved;
+};
+
+struct ContentNode {
+    uint64_t idHash;            // hashAssetPath() of the node ID
+    uint32_t id;                // String index
+    uint32_t record;            // Record word offset
+    uint32_t recordWords;
+    uint32_t reserved;
+};
+
+struct ContentQuest {
+    uint64_t idHash;            // hashAssetPath() of the quest ID
+    uint32_t id;                // String index
+    uint32_t record;            // Record word offset
+    uint32_t recordWords;
+    uint32_t reserved;
+};
+
+/**
+ * Memory-mapped cooked dialogue and quest database (read side)
+ * Shared by every component: trees are materialized once, without nodes,
+ * and handed out as shared read-only trees whose nodes are decoded on
+ * first use. Quest definitions are decoded when first asked for.
+ */
+class ContentDatabase : public std::enable_shared_from_this<ContentDatabase> {
+public:
+    /**
+     * Open a database
+     * @param path Database path
+     * @return Database, or nullptr if the file is missing or invalid
+     */
+    static std::shared_ptr<ContentDatabase> open(const std::string& path);
+
+    /**
+     * Get a shared dialogue tree
+     * Every caller gets the same tree while any of them holds it.
+     * @param treeId Tree ID
+     * @return Tree with lazily decoded nodes, or nullptr if not found
+     */
+    std::shared_ptr<const Components::DialogueTree> getDialogueTree(const std::string& treeId);
+
+    /**
+     * Check if the database has a dialogue tree
+     * @param treeId Tree ID
+     * @return true if found
+     */
+    bool hasDialogueTree(const std::string& treeId) const { return findTree(treeId) != nullptr; }
+
+    /**
+     * Decode one dialogue node
+     * @param treeId Tree ID
+     * @param nodeId Node ID
+     * @param outNode Receives the node, uncompiled
+     * @return true if found and intact
+     */
+    bool loadDialogueNode(const std::string& treeId, const std::string& nodeId, Components::DialogueNode& outNode) const;
+
+    /**
+     * Decode a quest definition
+     * @param questId Quest ID
+     * @param outDefinition Receives the definition
+     * @return true if found and intact
+     */
+    bool loadQuestDefinition(const std::string& questId, Components::QuestDefinition& outDefinition) const;
+
+    /**
+     * Check if the database has a quest definition
+     * @param questId Quest ID
+     * @return true if found
+     */
+    bool hasQuestDefinition(const std::string& questId) const { return findQuest(questId) != nullptr; }
+
+    /**
+     * Make QuestComponent load quest definitions from this database
+     * Definitions are decoded on first use and kept in the quest registry.
+     */
+    void installQuestDefinitionSource();
+
+    /**
+     * List the IDs of the dialogue trees
+     * @return Tree IDs in index order
+     */
+    std::vector<std::string> listDialogueTrees() const;
+
+    size_t getTreeCount() const { return m_header->treeCount; }
+    size_t getNodeCount() const { return m_header->nodeCount; }
+    size_t getQuestCount() const { return m_header->questCount; }
+    size_t getStringCount() const { return m_header->stringCount; }
+    size_t getMappedSize() const { return m_file->size(); }
+    const std::string& getPath() const { return m_path; }
+
+    /**
+     * Get the number of trees currently materialized
+     * @return Trees held by at least one caller
+     */
+    size_t getLiveTreeCount() const;
+
+private:
+    friend class ContentNodeSource;
+
+    ContentDatabase() = default;
+
+    /**
+     * Check the header, tables, strings and record ranges fit the file
+     * @return true if the database is usable
+     */
+    bool validate();
+
+    const ContentTree* findTree(const std::string& treeId) const;
+    const ContentNode* findNode(const ContentTree& tree, const std::string& nodeId) const;
+    const ContentQuest* findQuest(const std::string& questId) const;
+
+    /**
+     * Decode a node record
+     * @param node Node entry
+     * @param outNode Receives the node
+     * @return true if the record is intact
+     */
+    bool decodeNode(const ContentNode& node, Components::DialogueNode& outNode) const;
+
+    /**
+     * Compare a stored string with a name
+     */
+    bool equals(uint32_t string, const std::string& text) const;
+
+    /**
+     * Copy a stored string
+     */
+    std::string getString(uint32_t string) const;
+
+    std::string m_path;
+    std::shared_ptr<MappedFile> m_file;
+    const ContentHeader* m_header = nullptr;
+    const ContentTree* m_trees = nullptr;
+    const ContentNode* m_nodes = nullptr;
+    const ContentQuest* m_quests = nullptr;
+    const ContentString* m_strings = nullptr;
+    const char* m_chars = nullptr;
+    const uint32_t* m_words = nullptr;
+
+    // Materialized trees, by tree index
+    mutable std::mutex m_treeMutex;
+    std::unordered_map<uint32_t, std::weak_ptr<const Components::DialogueTree>> m_liveTrees;
+};
+
+} // namespace Resources
+} // namespace RPGEngine
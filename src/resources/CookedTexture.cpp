@@ -0,0 +1,113 @@
+#include "CookedTexture.h"
+#include "GLFunctions.h"
+#include <cstring>
+
+namespace RPGEngine {
+namespace Resources {
+
+size_t CookedTexture::getDataSize() const {
+    size_t total = 0;
+    for (const auto& level : levels) {
+        total += level.size;
+    }
+    return total;
+}
+
+bool isCookedTexture(const uint8_t* data, size_t size) {
+    return size >= sizeof(CookedTextureHeader) && std::memcmp(data, COOKED_TEXTURE_MAGIC, 4) == 0;
+}
+
+bool parseCookedTexture(const uint8_t* data, size_t size, CookedTexture& texture) {
+    if (!isCookedTexture(data, size)) {
+        return false;
+    }
+
+    CookedTextureHeader header;
+    std::memcpy(&header, data, sizeof(header));
+    if (header.version != COOKED_TEXTURE_VERSION || header.format > static_cast<uint32_t>(CookedTextureFormat::ETC2_RGBA8) ||
+        header.width == 0 || header.height == 0 || header.levelCount == 0 || header.levelCount > 32) {
+        return false;
+    }
+
+    const size_t tableEnd = sizeof(header) + header.levelCount * sizeof(CookedTextureLevel);
+    if (tableEnd > size) {
+        return false;
+    }
+
+    texture.format = static_cast<CookedTextureFormat>(header.format);
+    texture.flags = header.flags;
+    texture.width = static_cast<int>(header.width);
+    texture.height = static_cast<int>(header.height);
+    texture.levels.clear();
+    texture.levels.reserve(header.levelCount);
+
+    for (uint32_t i = 0; i < header.levelCount; ++i) {
+        CookedTextureLevel level;
+        std::memcpy(&level, data + sizeof(header) + i * sizeof(level), sizeof(level));
+
+        if (level.width == 0 || level.height == 0 || level.offset < tableEnd || level.offset > size ||
+            level.size > size - level.offset ||
+            level.size != cookedLevelSize(texture.format, static_cast<int>(level.width), static_cast<int>(level.height))) {
+            return false;
+        }
+
+        CookedTexture::Level parsed;
+        parsed.width = static_cast<int>(level.width);
+        parsed.height = static_cast<int>(level.height);
+        parsed.data = data + level.offset;
+        parsed.size = static_cast<size_t>(level.size);
+        texture.levels.push_back(parsed);
+    }
+
+    return true;
+}
+
+size_t cookedLevelSize(CookedTextureFormat format, int width, int height) {
+    const size_t blocks = static_cast<size_t>((width + 3) / 4) * static_cast<size_t>((height + 3) / 4);
+    switch (format) {
+        case CookedTextureFormat::BC1:
+        case CookedTextureFormat::ETC2_RGB8:
+            return blocks * 8;
+        case CookedTextureFormat::BC3:
+        case CookedTextureFormat::ETC2_RGBA8:
+            return blocks * 16;
+        default:
+            return static_cast<size_t>(width) * height * 4;
+    }
+}
+
+bool isCompressedFormat(CookedTextureFormat format) {
+    return format != CookedTextureFormat::RGBA8;
+}
+
+unsigned int cookedGLInternalFormat(CookedTextureFormat format) {
+    switch (format) {
+        case CookedTextureFormat::BC1: return GL_COMPRESSED_RGB_S3TC_DXT1_EXT;
+        case CookedTextureFormat::BC3: return GL_COMPRESSED_RGBA_S3TC_DXT5_EXT;
+        case CookedTextureFormat::ETC2_RGB8: return GL_COMPRESSED_RGB8_ETC2;
+        case CookedTextureFormat::ETC2_RGBA8: return GL_COMPRESSED_RGBA8_ETC2_EAC;
+        default: return GL_RGBA8;
+    }
+}
+
+const char* cookedFormatName(CookedTextureFormat format) {
+    switch (format) {
+        case CookedTextureFormat::BC1: return "bc1";
+        case CookedTextureFormat::BC3: return "bc3";
+        case CookedTextureFormat::ETC2_RGB8: return "etc2_rgb8";
+        case CookedTextureFormat::ETC2_RGBA8: return "etc2_rgba8";
+        default: return "rgba8";
+    }
+}
+
+std::string cookedTexturePath(const std::string& path) {
+    size_t slash = path.find_last_of("/\\");
+    size_t dot = path.find_last_of('.');
+    if (dot == std::string::npos || (slash != std::string::npos && dot < slash)) {
+        return path + COOKED_TEXTURE_EXTENSION;
+    }
+    return path.substr(0, dot) + COOKED_TEXTURE_EXTENSION;
+}
+
+} // namespace Resources
+} // namespace RPGEngine
@@ -0,0 +1,157 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+
+namespace RPGEngine {
+namespace Resources {
+
+/**
+ * Cooked texture layout (little endian)
+ *
+ *   CookedTextureHeader
+ *   CookedTextureLevel[levelCount]   mip 0 (full size) first
+ *   level data                       each level 16-byte aligned
+ *
+ * Written by TextureCooker. The level data is exactly what the GPU takes,
+ * so loading is a parse of the header and one upload call per level.
+ */
+const char COOKED_TEXTURE_MAGIC[4] = {'R', 'T', 'E', 'X'};
+const uint32_t COOKED_TEXTURE_VERSION = 1;
+
+/**
+ * Extension of cooked textures; TextureResource loads "x.rtex" in place of
+ * "x.png" when it exists
+ */
+const char COOKED_TEXTURE_EXTENSION[] = ".rtex";
+
+/**
+ * Pixel format of cooked texture data
+ */
+enum class CookedTextureFormat : uint32_t {
+    RGBA8 = 0,          // Uncompressed, 4 bytes per pixel
+    BC1 = 1,            // S3TC DXT1, opaque, 8 bytes per 4x4 block
+    BC3 = 2,            // S3TC DXT5, 16 bytes per 4x4 block
+    ETC2_RGB8 = 3,      // ETC2, opaque, 8 bytes per 4x4 block
+    ETC2_RGBA8 = 4      // ETC2 with EAC alpha, 16 bytes per 4x4 block
+};
+
+/**
+ * Cooked texture flags
+ */
+enum CookedTextureFlags : uint32_t {
+    COOKED_TEXTURE_PREMULTIPLIED = 1 << 0     // Color is premultiplied by alpha
+};
+
+struct CookedTextureHeader {
+    char magic[4];
+    uint32_t version;
+    uint32_t format;            // CookedTextureFormat
+    uint32_t flags;             // CookedTextureFlags
+    uint32_t width;
+    uint32_t height;
+    uint32_t levelCount;
+    uint32_t reserved;
+};
+
+struct CookedTextureLevel {
+    uint32_t width;
+    uint32_t height;
+    uint64_t offset;            // From the start of the file
+    uint64_t size;
+};
+
+/**
+ * Parsed cooked texture
+ * Levels point into the buffer that was parsed; they are valid as long as it is.
+ */
+struct CookedTexture {
+    /**
+     * Mip level
+     */
+    struct Level {
+        int width = 0;
+        int height = 0;
+        const uint8_t* data = nullptr;
+        size_t size = 0;
+    };
+
+    CookedTextureFormat format = CookedTextureFormat::RGBA8;
+    uint32_t flags = 0;
+    int width = 0;
+    int height = 0;
+    std::vector<Level> levels;
+
+    /**
+     * Check if the color is premultiplied by alpha
+     * @return true if premultiplied
+     */
+    bool isPremultiplied() const { return (flags & COOKED_TEXTURE_PREMULTIPLIED) != 0; }
+
+    /**
+     * Get the bytes of all levels
+     * @return Size of the texture in GPU memory
+     */
+    size_t getDataSize() const;
+};
+
+/**
+ * Check if data starts like a cooked texture
+ * @param data File data
+ * @param size File size
+ * @return true if the magic matches
+ */
+bool isCookedTexture(const uint8_t* data, size_t size);
+
+/**
+ * Parse a cooked texture
+ * Checks the header and that every level lies inside the data and has the
+ * size its format and dimensions call for.
+ * @param data File data
+ * @param size File size
+ * @param texture Receives the texture
+ * @return true if the data is a valid cooked texture
+ */
+bool parseCookedTexture(const uint8_t* data, size_t size, CookedTexture& texture);
+
+/**
+ * Get the byte size of one level
+ * @param format Format
+ * @param width Level width
+ * @param height Level height
+ * @return Bytes (compressed formats round up to whole 4x4 blocks)
+ */
+size_t cookedLevelSize(CookedTextureFormat format, int width, int height);
+
+/**
+ * Check if a format is block compressed
+ * @param format Format
+ * @return true for the BC and ETC2 formats
+ */
+bool isCompressedFormat(CookedTextureFormat format);
+
+/**
+ * Get the OpenGL internal format of a cooked format
+ * @param format Format
+ * @return GL internal format (e.g. GL_COMPRESSED_RGBA_S3TC_DXT5_EXT)
+ */
+unsigned int cookedGLInternalFormat(CookedTextureFormat format);
+
+/**
+ * Get the name of a format
+ * @param format Format
+ * @return Name ("rgba8", "bc1", "bc3", "etc2_rgb8" or "etc2_rgba8")
+ */
+const char* cookedFormatName(CookedTextureFormat format);
+
+/**
+ * Get the cooked path of a source texture
+ * @param path Source path (e.g. "tiles.png")
+ * @return Path with the extension replaced by COOKED_TEXTURE_EXTENSION
+ */
+std::string cookedTexturePath(const std::string& path);
+
+} // namespace Resources
+} // namespace RPGEngine
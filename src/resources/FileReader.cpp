@@ -0,0 +1,369 @@
+#include "FileReader.h"
+#include "../core/ThreadPool.h"
+#include <iostream>
+#include <fstream>
+#include <future>
+#include <cstring>
+#include <cerrno>
+#include <algorithm>
+#include <chrono>
+#include <thread>
+
+#ifdef RPG_HAS_IO_URING
+#include <linux/io_uring.h>
+#include <sys/syscall.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace RPGEngine {
+namespace Resources {
+
+namespace {
+    /**
+     * Read a whole file with blocking I/O
+     * @param path File path
+     * @param result Receives the contents
+     */
+    void readWholeFile(const std::string& path, FileReadResult& result) {
+        std::ifstream file(path, std::ios::binary | std::ios::ate);
+        if (!file.is_open()) {
+            result.success = false;
+            return;
+        }
+
+        std::streamsize size = file.tellg();
+        file.seekg(0, std::ios::beg);
+        result.data.resize(static_cast<size_t>(size));
+        result.success = size == 0 || static_cast<bool>(file.read(reinterpret_cast<char*>(result.data.data()), size));
+    }
+}
+
+ThreadPoolFileReader::ThreadPoolFileReader(std::shared_ptr<Core::ThreadPool> jobSystem)
+    : m_jobSystem(jobSystem)
+{
+}
+
+void ThreadPoolFileReader::readBatch(const std::vector<std::string>& paths, std::vector<FileReadResult>& results) {
+    results.clear();
+    results.resize(paths.size());
+
+    if (!m_jobSystem || paths.size() == 1) {
+        for (size_t i = 0; i < paths.size(); ++i) {
+            readWholeFile(paths[i], results[i]);
+        }
+        return;
+    }
+
+    std::vector<std::future<void>> reads;
+    reads.reserve(paths.size());
+    for (size_t i = 0; i < paths.size(); ++i) {
+        reads.push_back(m_jobSystem->submit([&paths, &results, i]() {
+            readWholeFile(paths[i], results[i]);
+        }));
+    }
+
+    for (auto& read : reads) {
+        read.wait();
+    }
+}
+
+#ifdef RPG_HAS_IO_URING
+
+namespace {
+    // How long a failed ring gets to hand back reads already submitted
+    const std::chrono::milliseconds DRAIN_TIMEOUT(2000);
+
+    int ioUringSetup(unsigned entries, io_uring_params* params) {
+        return static_cast<int>(syscall(__NR_io_uring_setup, entries, params));
+    }
+
+    int ioUringEnter(int fd, unsigned toSubmit, unsigned minComplete, unsigned flags) {
+        return static_cast<int>(syscall(__NR_io_uring_enter, fd, toSubmit, minComplete, flags, nullptr, 0));
+    }
+
+    /**
+     * Per-file state of a batch in flight
+     */
+    struct UringRead {
+        int fd = -1;
+        size_t offset = 0;
+        bool done = false;
+        bool inFlight = false;      // Submitted and not yet completed
+        iovec iov;
+    };
+
+    /**
+     * Give up on reads a failed ring never completed
+     * @param ringFd Ring to close (set to -1)
+     * @param reads Reads of the batch (the requests' iovecs are leaked)
+     * @param results Results of the batch (in-flight buffers are leaked)
+     * @param inFlight Number of reads still submitted
+     */
+    void abandonReads(int& ringFd, std::vector<UringRead>& reads, std::vector<FileReadResult>& results, unsigned inFlight) {
+        std::cerr << "io_uring: " << inFlight << " reads did not complete, cancelling them" << std::endl;
+
+        // Closing the ring cancels what is left, but the kernel may still be
+        // writing into those reads' buffers; leak them rather than free them
+        // under it. The files are read again with blocking I/O.
+        close(ringFd);
+        ringFd = -1;
+
+        auto* orphans = new std::vector<std::vector<uint8_t>>();
+        for (size_t i = 0; i < reads.size(); ++i) {
+            if (reads[i].inFlight) {
+                orphans->push_back(std::move(results[i].data));
+                results[i].data.clear();
+            }
+        }
+        // Moving keeps the iovecs the requests point at where they are
+        auto* orphanedReads = new std::vector<UringRead>(std::move(reads));
+        reads = *orphanedReads;
+    }
+}
+
+std::unique_ptr<IoUringFileReader> IoUringFileReader::create(unsigned entries) {
+    std::unique_ptr<IoUringFileReader> reader(new IoUringFileReader());
+    if (!reader->setup(entries)) {
+        return nullptr;
+    }
+    return reader;
+}
+
+bool IoUringFileReader::setup(unsigned entries) {
+    io_uring_params params;
+    std::memset(&params, 0, sizeof(params));
+
+    m_ringFd = ioUringSetup(entries, &params);
+    if (m_ringFd < 0) {
+        // Old kernel, or io_uring disabled by seccomp/sysctl
+        m_ringFd = -1;
+        return false;
+    }
+
+    m_sqEntries = params.sq_entries;
+    m_sqRingSize = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    m_cqRingSize = params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+
+    bool singleMmap = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+    if (singleMmap) {
+        m_sqRingSize = m_cqRingSize = std::max(m_sqRingSize, m_cqRingSize);
+    }
+
+    m_sqRing = mmap(nullptr, m_sqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_ringFd, IORING_OFF_SQ_RING);
+    if (m_sqRing == MAP_FAILED) {
+        m_sqRing = nullptr;
+        return false;
+    }
+
+    if (singleMmap) {
+        m_cqRing = m_sqRing;
+    } else {
+        m_cqRing = mmap(nullptr, m_cqRingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_ringFd, IORING_OFF_CQ_RING);
+        if (m_cqRing == MAP_FAILED) {
+            m_cqRing = nullptr;
+            return false;
+        }
+    }
+
+    m_sqesSize = params.sq_entries * sizeof(io_uring_sqe);
+    m_sqes = mmap(nullptr, m_sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, m_ringFd, IORING_OFF_SQES);
+    if (m_sqes == MAP_FAILED) {
+        m_sqes = nullptr;
+        return false;
+    }
+
+    char* sq = static_cast<char*>(m_sqRing);
+    m_sqHead = reinterpret_cast<unsigned*>(sq + params.sq_off.head);
+    m_sqTail = reinterpret_cast<unsigned*>(sq + params.sq_off.tail);
+    m_sqMask = reinterpret_cast<unsigned*>(sq + params.sq_off.ring_mask);
+    m_sqArray = reinterpret_cast<unsigned*>(sq + params.sq_off.array);
+
+    char* cq = static_cast<char*>(m_cqRing);
+    m_cqHead = reinterpret_cast<unsigned*>(cq + params.cq_off.head);
+    m_cqTail = reinterpret_cast<unsigned*>(cq + params.cq_off.tail);
+    m_cqMask = reinterpret_cast<unsigned*>(cq + params.cq_off.ring_mask);
+    m_cqes = cq + params.cq_off.cqes;
+
+    return true;
+}
+
+IoUringFileReader::~IoUringFileReader() {
+    if (m_sqes) {
+        munmap(m_sqes, m_sqesSize);
+    }
+    if (m_cqRing && m_cqRing != m_sqRing) {
+        munmap(m_cqRing, m_cqRingSize);
+    }
+    if (m_sqRing) {
+        munmap(m_sqRing, m_sqRingSize);
+    }
+    if (m_ringFd >= 0) {
+        close(m_ringFd);
+    }
+}
+
+void IoUringFileReader::readBatch(const std::vector<std::string>& paths, std::vector<FileReadResult>& results) {
+    results.clear();
+    results.resize(paths.size());
+
+    if (m_broken) {
+        for (size_t i = 0; i < paths.size(); ++i) {
+            readWholeFile(paths[i], results[i]);
+        }
+        return;
+    }
+
+    // Open and size every file up front so each read is a single request
+    std::vector<UringRead> reads(paths.size());
+    std::vector<size_t> pending;
+    pending.reserve(paths.size());
+
+    for (size_t i = 0; i < paths.size(); ++i) {
+        reads[i].fd = open(paths[i].c_str(), O_RDONLY | O_CLOEXEC);
+        struct stat info;
+        if (reads[i].fd < 0 || fstat(reads[i].fd, &info) != 0) {
+            reads[i].done = true;
+            continue;
+        }
+
+        results[i].data.resize(static_cast<size_t>(info.st_size));
+        if (info.st_size == 0) {
+            results[i].success = true;
+            reads[i].done = true;
+            continue;
+        }
+        pending.push_back(i);
+    }
+
+    size_t next = 0;
+    unsigned inFlight = 0;
+
+    // Take every completion the kernel has posted
+    auto reap = [&]() {
+        unsigned head = __atomic_load_n(m_cqHead, __ATOMIC_RELAXED);
+        unsigned cqTail = __atomic_load_n(m_cqTail, __ATOMIC_ACQUIRE);
+        unsigned cqMask = *m_cqMask;
+        while (head != cqTail) {
+            const io_uring_cqe* cqe = static_cast<const io_uring_cqe*>(m_cqes) + (head & cqMask);
+            size_t index = static_cast<size_t>(cqe->user_data);
+            int res = cqe->res;
+            ++head;
+            --inFlight;
+
+            UringRead& read = reads[index];
+            read.inFlight = false;
+            if (res == -EAGAIN || res == -EINTR) {
+                pending.push_back(index);
+            } else if (res < 0) {
+                read.done = true;
+            } else if (res == 0) {
+                // File shrank since fstat
+                results[index].data.resize(read.offset);
+                results[index].success = true;
+                read.done = true;
+            } else {
+                read.offset += static_cast<size_t>(res);
+                if (read.offset < results[index].data.size()) {
+                    pending.push_back(index);
+                } else {
+                    results[index].success = true;
+                    read.done = true;
+                }
+            }
+        }
+        __atomic_store_n(m_cqHead, head, __ATOMIC_RELEASE);
+    };
+
+    while (next < pending.size() || inFlight > 0) {
+        // Queue as many reads as the ring has room for
+        unsigned tail = __atomic_load_n(m_sqTail, __ATOMIC_RELAXED);
+        unsigned mask = *m_sqMask;
+        unsigned queued = 0;
+        while (next < pending.size() && inFlight + queued < m_sqEntries) {
+            size_t index = pending[next++];
+            UringRead& read = reads[index];
+            read.iov.iov_base = results[index].data.data() + read.offset;
+            read.iov.iov_len = results[index].data.size() - read.offset;
+
+            io_uring_sqe* sqe = static_cast<io_uring_sqe*>(m_sqes) + (tail & mask);
+            std::memset(sqe, 0, sizeof(*sqe));
+            sqe->opcode = IORING_OP_READV;
+            sqe->fd = read.fd;
+            sqe->addr = reinterpret_cast<uint64_t>(&read.iov);
+            sqe->len = 1;
+            sqe->off = read.offset;
+            sqe->user_data = index;
+            read.inFlight = true;
+
+            m_sqArray[tail & mask] = tail & mask;
+            ++tail;
+            ++queued;
+        }
+        __atomic_store_n(m_sqTail, tail, __ATOMIC_RELEASE);
+
+        int entered;
+        do {
+            entered = ioUringEnter(m_ringFd, queued, 1, IORING_ENTER_GETEVENTS);
+        } while (entered < 0 && errno == EINTR);
+
+        if (entered < 0) {
+            std::cerr << "io_uring_enter failed (" << std::strerror(errno) << "), falling back to blocking reads" << std::endl;
+            m_broken = true;
+
+            // Take back requests the kernel did not consume, so the ring never
+            // sees them after this batch's buffers are gone
+            unsigned consumed = std::min(__atomic_load_n(m_sqHead, __ATOMIC_ACQUIRE) - (tail - queued), queued);
+            inFlight += consumed;
+            __atomic_store_n(m_sqTail, tail - (queued - consumed), __ATOMIC_RELEASE);
+            for (size_t k = next - (queued - consumed); k < next; ++k) {
+                reads[pending[k]].inFlight = false;
+            }
+
+            // Submitted requests still point into reads and results; wait for
+            // them before either goes away, but only for so long
+            auto deadline = std::chrono::steady_clock::now() + DRAIN_TIMEOUT;
+            while (inFlight > 0 && std::chrono::steady_clock::now() < deadline) {
+                if (ioUringEnter(m_ringFd, 0, 1, IORING_ENTER_GETEVENTS) < 0 && errno != EINTR) {
+                    std::this_thread::sleep_for(std::chrono::milliseconds(1));
+                }
+                reap();
+            }
+            if (inFlight > 0) {
+                abandonReads(m_ringFd, reads, results, inFlight);
+            }
+            break;
+        }
+        inFlight += queued;
+
+        reap();
+    }
+
+    for (size_t i = 0; i < paths.size(); ++i) {
+        if (reads[i].fd >= 0) {
+            close(reads[i].fd);
+        }
+        // Reads the ring did not finish before it failed
+        if (m_broken && !reads[i].done) {
+            readWholeFile(paths[i], results[i]);
+        }
+    }
+}
+
+#endif
+
+std::unique_ptr<IFileReader> createFileReader(std::shared_ptr<Core::ThreadPool> jobSystem) {
+#ifdef RPG_HAS_IO_URING
+    if (auto reader = IoUringFileReader::create()) {
+        return reader;
+    }
+    std::cout << "io_uring unavailable, reading resources on the job system" << std::endl;
+#endif
+    return std::make_unique<ThreadPoolFileReader>(jobSystem);
+}
+
+} // namespace Resources
+} // namespace RPGEngine
@@ -0,0 +1,130 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <memory>
+#include <cstdint>
+
+#if defined(__linux__) && defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#define RPG_HAS_IO_URING 1
+#endif
+#endif
+
+namespace RPGEngine {
+namespace Core {
+class ThreadPool;
+}
+
+namespace Resources {
+
+/**
+ * Result of reading one file
+ */
+struct FileReadResult {
+    bool success = false;
+    std::vector<uint8_t> data;
+};
+
+/**
+ * Batched whole-file reader used by the resource load pipeline
+ */
+class IFileReader {
+public:
+    virtual ~IFileReader() = default;
+
+    /**
+     * Read several files, blocking until all are done
+     * @param paths Files to read
+     * @param results Receives one result per path, in order
+     */
+    virtual void readBatch(const std::vector<std::string>& paths, std::vector<FileReadResult>& results) = 0;
+
+    /**
+     * Get the reader name (for logs and stats)
+     * @return Name
+     */
+    virtual const char* getName() const = 0;
+};
+
+/**
+ * File reader that runs blocking reads as job system tasks
+ * Used where io_uring is unavailable.
+ */
+class ThreadPoolFileReader : public IFileReader {
+public:
+    /**
+     * Constructor
+     * @param jobSystem Thread pool to read on (nullptr reads on the calling thread)
+     */
+    explicit ThreadPoolFileReader(std::shared_ptr<Core::ThreadPool> jobSystem);
+
+    void readBatch(const std::vector<std::string>& paths, std::vector<FileReadResult>& results) override;
+    const char* getName() const override { return "threadpool"; }
+
+private:
+    std::shared_ptr<Core::ThreadPool> m_jobSystem;
+};
+
+#ifdef RPG_HAS_IO_URING
+/**
+ * File reader that submits a whole batch to an io_uring
+ * Talks to the kernel through the raw syscalls, so it needs no liburing.
+ * Each file is one READV request; short reads are resubmitted.
+ */
+class IoUringFileReader : public IFileReader {
+public:
+    /**
+     * Set up a ring
+     * @param entries Submission queue size (the most reads in flight)
+     * @return Reader, or nullptr if the kernel refuses io_uring
+     */
+    static std::unique_ptr<IoUringFileReader> create(unsigned entries = 64);
+
+    ~IoUringFileReader();
+
+    void readBatch(const std::vector<std::string>& paths, std::vector<FileReadResult>& results) override;
+    const char* getName() const override { return "io_uring"; }
+
+private:
+    IoUringFileReader() = default;
+
+    /**
+     * Map the rings of a freshly created io_uring
+     * @param entries Submission queue size
+     * @return true if the ring is usable
+     */
+    bool setup(unsigned entries);
+
+    int m_ringFd = -1;
+    bool m_broken = false;          // Set when io_uring_enter fails; later batches use pread
+
+    void* m_sqRing = nullptr;
+    size_t m_sqRingSize = 0;
+    void* m_cqRing = nullptr;
+    size_t m_cqRingSize = 0;
+    void* m_sqes = nullptr;
+    size_t m_sqesSize = 0;
+    unsigned m_sqEntries = 0;
+
+    unsigned* m_sqHead = nullptr;
+    unsigned* m_sqTail = nullptr;
+    unsigned* m_sqMask = nullptr;
+    unsigned* m_sqArray = nullptr;
+    unsigned* m_cqHead = nullptr;
+    unsigned* m_cqTail = nullptr;
+    unsigned* m_cqMask = nullptr;
+    void* m_cqes = nullptr;
+};
+#endif
+
+/**
+ * Create the best file reader available
+ * Prefers io_uring and falls back to the thread pool reader at runtime.
+ * @param jobSystem Thread pool for the fallback reader
+ * @return File reader
+ */
+std::unique_ptr<IFileReader> createFileReader(std::shared_ptr<Core::ThreadPool> jobSystem);
+
+} // namespace Resources
+} // namespace RPGEngine
@@ -25,6 +25,10 @@ void glTexImage2D(unsigned int target, int level, int internalformat, int width,
     // Mock implementation
 }
 
+void glCompressedTexImage2D(unsigned int, int, unsigned int, int, int, int, int, const void*) {
+    // Mock implementation
+}
+
 void glGenerateMipmap(unsigned int target) {
     // Mock implementation
 }
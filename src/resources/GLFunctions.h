@@ -6,11 +6,74 @@
 #ifndef GL_FUNCTIONS_H
 #define GL_FUNCTIONS_H
 
+// OpenGL enums used by TextureResource (guarded in case real GL headers define them)
+#ifndef GL_TEXTURE_2D
+#define GL_TEXTURE_2D                       0x0DE1
+#endif
+#ifndef GL_UNSIGNED_BYTE
+#define GL_UNSIGNED_BYTE                    0x1401
+#endif
+#ifndef GL_RED
+#define GL_RED                              0x1903
+#endif
+#ifndef GL_RGB
+#define GL_RGB                              0x1907
+#endif
+#ifndef GL_RGBA
+#define GL_RGBA                             0x1908
+#endif
+#ifndef GL_RG
+#define GL_RG                               0x8227
+#endif
+#ifndef GL_RGBA8
+#define GL_RGBA8                            0x8058
+#endif
+#ifndef GL_NEAREST
+#define GL_NEAREST                          0x2600
+#endif
+#ifndef GL_LINEAR
+#define GL_LINEAR                           0x2601
+#endif
+#ifndef GL_LINEAR_MIPMAP_LINEAR
+#define GL_LINEAR_MIPMAP_LINEAR             0x2703
+#endif
+#ifndef GL_TEXTURE_MAG_FILTER
+#define GL_TEXTURE_MAG_FILTER               0x2800
+#endif
+#ifndef GL_TEXTURE_MIN_FILTER
+#define GL_TEXTURE_MIN_FILTER               0x2801
+#endif
+#ifndef GL_TEXTURE_WRAP_S
+#define GL_TEXTURE_WRAP_S                   0x2802
+#endif
+#ifndef GL_TEXTURE_WRAP_T
+#define GL_TEXTURE_WRAP_T                   0x2803
+#endif
+#ifndef GL_CLAMP_TO_EDGE
+#define GL_CLAMP_TO_EDGE                    0x812F
+#endif
+#ifndef GL_TEXTURE_MAX_LEVEL
+#define GL_TEXTURE_MAX_LEVEL                0x813D
+#endif
+#ifndef GL_COMPRESSED_RGB_S3TC_DXT1_EXT
+#define GL_COMPRESSED_RGB_S3TC_DXT1_EXT     0x83F0
+#endif
+#ifndef GL_COMPRESSED_RGBA_S3TC_DXT5_EXT
+#define GL_COMPRESSED_RGBA_S3TC_DXT5_EXT    0x83F3
+#endif
+#ifndef GL_COMPRESSED_RGB8_ETC2
+#define GL_COMPRESSED_RGB8_ETC2             0x9274
+#endif
+#ifndef GL_COMPRESSED_RGBA8_ETC2_EAC
+#define GL_COMPRESSED_RGBA8_ETC2_EAC        0x9278
+#endif
+
 // OpenGL function declarations
 void glGenTextures(int n, unsigned int* textures);
 void glBindTexture(unsigned int target, unsigned int texture);
 void glTexParameteri(unsigned int target, unsigned int pname, int param);
 void glTexImage2D(unsigned int target, int level, int internalformat, int width, int height, int border, unsigned int format, unsigned int type, const void* data);
+void glCompressedTexImage2D(unsigned int target, int level, unsigned int internalformat, int width, int height, int border, int imageSize, const void* data);
 void glGenerateMipmap(unsigned int target);
 void glDeleteTextures(int n, const unsigned int* textures);
 
@@ -0,0 +1,107 @@
+#include "PreloadManifest.h"
+#include "VirtualFileSystem.h"
+#include <iostream>
+#include <fstream>
+#include <sstream>
+
+namespace RPGEngine {
+namespace Resources {
+
+PreloadManifest::PreloadManifest(const std::string& name)
+    : m_name(name)
+{
+}
+
+bool PreloadManifest::add(const PreloadEntry& entry) {
+    if (entry.id.empty() || contains(entry.id)) {
+        return false;
+    }
+
+    m_index[entry.id] = m_entries.size();
+    m_entries.push_back(entry);
+    return true;
+}
+
+size_t PreloadManifest::merge(const PreloadManifest& other) {
+    size_t added = 0;
+    for (const auto& entry : other.m_entries) {
+        if (add(entry)) {
+            added++;
+        }
+    }
+    return added;
+}
+
+void PreloadManifest::clear() {
+    m_entries.clear();
+    m_index.clear();
+}
+
+bool PreloadManifest::loadFromFile(const std::string& path) {
+    std::string text;
+    if (!VirtualFileSystem::getInstance().readText(path, text)) {
+        return false;
+    }
+
+    clear();
+    std::istringstream stream(text);
+    std::string line;
+    while (std::getline(stream, line)) {
+        if (!line.empty() && line.back() == '\r') {
+            line.pop_back();
+        }
+        if (line.empty() || line[0] == '#') {
+            continue;
+        }
+
+        // category \t id \t path (path may be empty)
+        size_t firstTab = line.find('\t');
+        size_t secondTab = firstTab == std::string::npos ? std::string::npos : line.find('\t', firstTab + 1);
+        if (firstTab == std::string::npos) {
+            std::cerr << "Invalid preload manifest line in " << path << ": " << line << std::endl;
+            continue;
+        }
+
+        PreloadEntry entry;
+        entry.category = parseCategory(line.substr(0, firstTab));
+        entry.id = line.substr(firstTab + 1, secondTab == std::string::npos ? std::string::npos : secondTab - firstTab - 1);
+        if (secondTab != std::string::npos) {
+            entry.path = line.substr(secondTab + 1);
+        }
+        add(entry);
+    }
+
+    return true;
+}
+
+bool PreloadManifest::saveToFile(const std::string& path) const {
+    std::ofstream file(path, std::ios::trunc);
+    if (!file.is_open()) {
+        std::cerr << "Failed to write preload manifest: " << path << std::endl;
+        return false;
+    }
+
+    file << "# Preload manifest: " << m_name << "\n";
+    for (const auto& entry : m_entries) {
+        file << categoryName(entry.category) << '\t' << entry.id << '\t' << entry.path << '\n';
+    }
+
+    return static_cast<bool>(file);
+}
+
+const char* PreloadManifest::categoryName(ResourceCategory category) {
+    switch (category) {
+        case ResourceCategory::Texture: return "texture";
+        case ResourceCategory::Audio: return "audio";
+        default: return "other";
+    }
+}
+
+ResourceCategory PreloadManifest::parseCategory(const std::string& name) {
+    if (name == "texture") return ResourceCategory::Texture;
+    if (name == "audio") return ResourceCategory::Audio;
+    return ResourceCategory::Other;
+}
+
+} // namespace Resources
+} // namespace RPGEngine
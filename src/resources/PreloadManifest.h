@@ -0,0 +1,124 @@
+#pragma once
+
+#include "Resource.h"
+#include <string>
+#include <vector>
+#include <unordered_map>
+
+namespace RPGEngine {
+namespace Resources {
+
+/**
+ * Resource listed in a preload manifest
+ */
+struct PreloadEntry {
+    std::string id;
+    ResourceCategory category = ResourceCategory::Other;
+    std::string path;       // Lets the resource be created if nothing registered it yet
+};
+
+/**
+ * Preload manifest
+ * Lists the resources a scene or map needs, so they can be requested
+ * through the async loader before anything touches them. Manifests are
+ * built at cook time (e.g. MapLoader::buildManifest()) or recorded from a
+ * previous run (ResourceManager::beginManifestRecording()).
+ *
+ * Saved as text, one "category<TAB>id<TAB>path" line per resource;
+ * lines starting with '#' are comments.
+ */
+class PreloadManifest {
+public:
+    /**
+     * Constructor
+     * @param name Manifest name (e.g. the scene ID)
+     */
+    explicit PreloadManifest(const std::string& name = "");
+
+    /**
+     * Add a resource (ignored if the ID is listed already)
+     * @param entry Resource
+     * @return true if added
+     */
+    bool add(const PreloadEntry& entry);
+
+    /**
+     * Add every resource of another manifest
+     * @param other Manifest to merge
+     * @return Number of resources added
+     */
+    size_t merge(const PreloadManifest& other);
+
+    /**
+     * Check if a resource is listed
+     * @param id Resource ID
+     * @return true if listed
+     */
+    bool contains(const std::string& id) const { return m_index.count(id) != 0; }
+
+    /**
+     * Get the listed resources, in the order they were added
+     * @return Entries
+     */
+    const std::vector<PreloadEntry>& getEntries() const { return m_entries; }
+
+    /**
+     * Get the number of listed resources
+     * @return Entry count
+     */
+    size_t size() const { return m_entries.size(); }
+
+    /**
+     * Check if the manifest is empty
+     * @return true if nothing is listed
+     */
+    bool empty() const { return m_entries.empty(); }
+
+    /**
+     * Get the manifest name
+     * @return Name
+     */
+    const std::string& getName() const { return m_name; }
+
+    /**
+     * Remove all resources
+     */
+    void clear();
+
+    /**
+     * Load a manifest (through the VirtualFileSystem, so it may be packed)
+     * Replaces the current entries.
+     * @param path Manifest path
+     * @return true if the file was read
+     */
+    bool loadFromFile(const std::string& path);
+
+    /**
+     * Save the manifest
+     * @param path Manifest path
+     * @return true if the file was written
+     */
+    bool saveToFile(const std::string& path) const;
+
+    /**
+     * Get the manifest name of a category
+     * @param category Category
+     * @return Name ("texture", "audio" or "other")
+     */
+    static const char* categoryName(ResourceCategory category);
+
+    /**
+     * Parse a category name
+     * @param name Name from categoryName()
+     * @return Category (Other if unknown)
+     */
+    static ResourceCategory parseCategory(const std::string& name);
+
+private:
+    std::string m_name;
+    std::vector<PreloadEntry> m_entries;
+    std::unordered_map<std::string, size_t> m_index;
+};
+
+} // namespace Resources
+} // namespace RPGEngine
@@ -3,6 +3,9 @@
 #include <string>
 #include <atomic>
 #include <memory>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
 
 namespace RPGEngine {
 namespace Resources {
@@ -17,6 +20,31 @@ enum class ResourceState {
     Failed      // Resource failed to load
 };
 
+/**
+ * Resource budget category
+ * Maps are owned by the WorldManager rather than loaded as resources; their
+ * tileset textures count against Texture.
+ */
+enum class ResourceCategory {
+    Texture,
+    Audio,
+    Other,
+    Count
+};
+
+/**
+ * Residency priority
+ * Under memory pressure, unreferenced resources are evicted lowest
+ * priority first, least recently used first within a priority.
+ */
+enum class ResourcePriority {
+    Streaming,  // Evicted first
+    Scene,      // Evicted once streaming resources are gone
+    Pinned      // Never evicted
+};
+
+class ResourceLoadPipeline;
+
 /**
  * Base resource class
  * Represents a loadable resource such as a texture, sound, or model
@@ -33,6 +61,9 @@ public:
         , m_path(path)
         , m_state(ResourceState::Unloaded)
         , m_refCount(0)
+        , m_memorySize(0)
+        , m_priority(ResourcePriority::Scene)
+        , m_lastUsedFrame(0)
     {}
     
     /**
@@ -52,6 +83,13 @@ public:
      */
     const std::string& getPath() const { return m_path; }
     
+    /**
+     * Get the file a load reads
+     * Lets resources substitute a cooked version of their source file.
+     * @return Path to read (the resource path by default)
+     */
+    virtual std::string getLoadPath() const { return m_path; }
+    
     /**
      * Get the resource state
      * @return Resource state
@@ -94,6 +132,47 @@ public:
      */
     int removeReference() { return --m_refCount; }
     
+    /**
+     * Get the memory held by the loaded resource
+     * @return Size in bytes (0 while unloaded)
+     */
+    size_t getMemorySize() const { return m_memorySize; }
+    
+    /**
+     * Get the budget category
+     * @return Category the resource's memory is counted against
+     */
+    virtual ResourceCategory getCategory() const { return ResourceCategory::Other; }
+    
+    /**
+     * Set the residency priority
+     * @param priority Priority
+     */
+    void setPriority(ResourcePriority priority) { m_priority = priority; }
+    
+    /**
+     * Get the residency priority
+     * @return Priority
+     */
+    ResourcePriority getPriority() const { return m_priority; }
+    
+    /**
+     * Record a use of the resource
+     * @param frame Current resource manager frame
+     */
+    void touch(uint64_t frame) {
+        // Skip the store when already current so hot lookups stay read-only
+        if (m_lastUsedFrame.load(std::memory_order_relaxed) != frame) {
+            m_lastUsedFrame.store(frame, std::memory_order_relaxed);
+        }
+    }
+    
+    /**
+     * Get the frame the resource was last used in
+     * @return Frame number
+     */
+    uint64_t getLastUsedFrame() const { return m_lastUsedFrame.load(std::memory_order_relaxed); }
+    
     /**
      * Load the resource
      * @return true if the resource was loaded successfully
@@ -114,18 +193,60 @@ public:
         return load();
     }
     
+    /**
+     * Check if the resource can be loaded in stages
+     * Staged resources are read by the load pipeline's I/O stage, decoded
+     * on a worker with decode() and finished on the main thread with
+     * upload(). Other resources are loaded with load() on a worker.
+     * @return true if decode() and upload() are implemented
+     */
+    virtual bool supportsStagedLoad() const { return false; }
+    
+    /**
+     * Decode file contents into staging memory (worker thread)
+     * Must not touch data that is in use while the resource is loaded, so
+     * reloads can decode while the old version is still being drawn.
+     * @param fileData Contents of getPath()
+     * @return true if decoding succeeded (set ResourceState::Failed otherwise)
+     */
+    virtual bool decode(std::vector<uint8_t>& fileData) { (void)fileData; return false; }
+    
+    /**
+     * Finish a staged load from the decoded data (main thread)
+     * Replaces the loaded version if there is one.
+     * @return true if the resource is now loaded
+     */
+    virtual bool upload() { return false; }
+    
+    /**
+     * Drop decoded data of a cancelled staged load
+     */
+    virtual void discardDecoded() {}
+    
 protected:
+    friend class ResourceLoadPipeline;
+    
     /**
      * Set the resource state
      * @param state New resource state
      */
     void setState(ResourceState state) { m_state = state; }
     
+    /**
+     * Set the memory held by the loaded resource
+     * Call from load() and reset to 0 in unload().
+     * @param bytes Size in bytes
+     */
+    void setMemorySize(size_t bytes) { m_memorySize = bytes; }
+    
 private:
     std::string m_id;                // Resource ID
     std::string m_path;              // Resource path
-    ResourceState m_state;           // Resource state
+    std::atomic<ResourceState> m_state;  // Resource state (read by workers)
     std::atomic<int> m_refCount;     // Reference count
+    std::atomic<size_t> m_memorySize;            // Bytes held while loaded
+    std::atomic<ResourcePriority> m_priority;    // Residency priority
+    std::atomic<uint64_t> m_lastUsedFrame;       // For LRU eviction
 };
 
 } // namespace Resources
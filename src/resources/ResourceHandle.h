@@ -0,0 +1,36 @@
+#pragma once
+
+#include <cstdint>
+
+namespace RPGEngine {
+namespace Resources {
+
+/**
+ * Typed, generational resource handle
+ * Refers to a slot in the resource manager's table. Removing the resource
+ * bumps the slot's generation, so stale handles resolve to nullptr instead
+ * of whatever resource reuses the slot.
+ * @tparam T Resource type the handle was resolved for
+ */
+template<typename T>
+struct ResourceHandle {
+    uint32_t index = 0;
+    uint32_t generation = 0;    // 0 means null
+
+    /**
+     * Check if the handle was ever resolved
+     * @return true if the handle is null
+     */
+    bool isNull() const { return generation == 0; }
+
+    bool operator==(const ResourceHandle& other) const {
+        return index == other.index && generation == other.generation;
+    }
+
+    bool operator!=(const ResourceHandle& other) const {
+        return !(*this == other);
+    }
+};
+
+} // namespace Resources
+} // namespace RPGEngine
@@ -0,0 +1,416 @@
+#include "ResourceLoadPipeline.h"
+#include "VirtualFileSystem.h"
+#include "../core/ThreadPool.h"
+#include <iostream>
+
+namespace RPGEngine {
+namespace Resources {
+
+ResourceLoadPipeline::ResourceLoadPipeline(std::shared_ptr<Core::ThreadPool> jobSystem, std::unique_ptr<IFileReader> fileReader)
+    : m_jobSystem(jobSystem)
+    , m_fileReader(std::move(fileReader))
+    , m_running(false)
+    , m_pendingJobs(0)
+    , m_nextId(1)
+    , m_nextSequence(0)
+    , m_uploadBudgetMs(2.0f)
+    , m_ioBatchSize(16)
+{
+    if (!m_fileReader) {
+        m_fileReader = createFileReader(m_jobSystem);
+    }
+}
+
+ResourceLoadPipeline::~ResourceLoadPipeline() {
+    stop();
+}
+
+void ResourceLoadPipeline::start() {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_running) {
+        return;
+    }
+
+    m_running = true;
+    m_ioThread = std::thread(&ResourceLoadPipeline::ioThreadFunc, this);
+}
+
+void ResourceLoadPipeline::stop() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!m_running) {
+            return;
+        }
+        m_running = false;
+    }
+    m_ioCondition.notify_all();
+
+    if (m_ioThread.joinable()) {
+        m_ioThread.join();
+    }
+
+    // Decode jobs hold this pipeline, so they must finish before it goes away
+    std::vector<RequestPtr> dropped;
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_jobsDone.wait(lock, [this] { return m_pendingJobs == 0; });
+
+        for (const auto& entry : m_requests) {
+            dropped.push_back(entry.second);
+        }
+        for (const auto& request : m_finished) {
+            dropped.push_back(request);
+        }
+        m_readQueue.clear();
+        m_decodeQueue.clear();
+        m_uploadQueue.clear();
+        m_finished.clear();
+        m_requests.clear();
+        m_requestsByResource.clear();
+    }
+
+    for (const auto& request : dropped) {
+        request->resource->discardDecoded();
+        if (!request->reload && request->resource->isLoading()) {
+            request->resource->setState(request->previousState);
+        }
+    }
+}
+
+LoadRequestId ResourceLoadPipeline::request(std::shared_ptr<Resource> resource, const LoadOptions& options,
+                                            ResourceCallback callback, bool reload) {
+    if (!resource) {
+        return 0;
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    // Merge into the request already in flight, taking the more urgent options
+    auto existing = m_requestsByResource.find(resource.get());
+    if (existing != m_requestsByResource.end()) {
+        RequestPtr request = existing->second;
+        request->cancelled = false;     // Still running, so a cancel can be taken back
+        if (callback) {
+            request->callbacks.push_back(callback);
+        }
+
+        bool morePressing = options.priority > request->options.priority ||
+                            options.deadline < request->options.deadline;
+        if (morePressing) {
+            RequestQueue* queue = queueForStage(request->stage);
+            if (queue) {
+                queue->erase(request);
+            }
+            if (options.priority > request->options.priority) {
+                request->options.priority = options.priority;
+            }
+            if (options.deadline < request->options.deadline) {
+                request->options.deadline = options.deadline;
+            }
+            if (queue) {
+                queue->insert(request);
+            }
+        }
+
+        m_stats.coalesced++;
+        return request->id;
+    }
+
+    auto request = std::make_shared<Request>();
+    request->id = m_nextId++;
+    request->resource = resource;
+    request->options = options;
+    request->sequence = m_nextSequence++;
+    request->reload = reload;
+    request->staged = resource->supportsStagedLoad();
+    request->previousState = resource->getState();
+    if (callback) {
+        request->callbacks.push_back(callback);
+    }
+
+    // A reload keeps the old version usable until its replacement is uploaded
+    if (!reload) {
+        resource->setState(ResourceState::Loading);
+    }
+
+    m_requests[request->id] = request;
+    m_requestsByResource[resource.get()] = request;
+    m_stats.requested++;
+
+    if (request->staged) {
+        request->stage = Stage::ReadQueued;
+        m_readQueue.insert(request);
+        m_ioCondition.notify_one();
+    } else {
+        queueDecodeLocked(request);
+    }
+
+    return request->id;
+}
+
+bool ResourceLoadPipeline::cancel(LoadRequestId id) {
+    std::lock_guard<std::mutex> lock(m_mutex);
+
+    auto it = m_requests.find(id);
+    if (it == m_requests.end()) {
+        return false;
+    }
+
+    RequestPtr request = it->second;
+    request->cancelled = true;
+
+    // Queued requests are dropped now; running ones when their stage ends
+    RequestQueue* queue = queueForStage(request->stage);
+    if (queue) {
+        queue->erase(request);
+        finishLocked(request, false);
+    }
+
+    return true;
+}
+
+void ResourceLoadPipeline::update(uint64_t frame) {
+    std::vector<RequestPtr> finished;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        finished.swap(m_finished);
+    }
+
+    for (const auto& request : finished) {
+        deliver(request, frame);
+    }
+
+    // Upload until the budget is spent. The first upload always runs so
+    // the queue drains, as do critical and overdue ones.
+    auto start = std::chrono::steady_clock::now();
+    const double budgetMs = m_uploadBudgetMs.load();
+    size_t uploaded = 0;
+
+    while (true) {
+        RequestPtr request;
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (m_uploadQueue.empty()) {
+                break;
+            }
+
+            auto now = std::chrono::steady_clock::now();
+            double elapsedMs = std::chrono::duration<double, std::milli>(now - start).count();
+            const RequestPtr& best = *m_uploadQueue.begin();
+            bool urgent = best->options.priority == LoadPriority::Critical || now > best->options.deadline;
+            if (uploaded > 0 && elapsedMs >= budgetMs && !urgent) {
+                m_stats.uploadsDeferred += m_uploadQueue.size();
+                break;
+            }
+
+            request = best;
+            m_uploadQueue.erase(m_uploadQueue.begin());
+            request->stage = Stage::Finished;
+            m_requests.erase(request->id);
+            m_requestsByResource.erase(request->resource.get());
+        }
+
+        request->success = request->resource->upload();
+        if (!request->success) {
+            request->resource->discardDecoded();
+        }
+        uploaded++;
+        deliver(request, frame);
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_stats.uploads += uploaded;
+    m_stats.lastUploadMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+size_t ResourceLoadPipeline::getInFlightCount() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_requests.size() + m_finished.size();
+}
+
+ResourcePipelineStats ResourceLoadPipeline::getStats() const {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    return m_stats;
+}
+
+void ResourceLoadPipeline::ioThreadFunc() {
+    std::vector<RequestPtr> batch;
+    std::vector<std::string> paths;
+    std::vector<FileReadResult> results;
+    std::vector<std::string> diskPaths;
+    std::vector<size_t> diskIndices;
+    std::vector<FileReadResult> diskResults;
+    VirtualFileSystem& vfs = VirtualFileSystem::getInstance();
+
+    while (true) {
+        batch.clear();
+        paths.clear();
+        diskPaths.clear();
+        diskIndices.clear();
+
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_ioCondition.wait(lock, [this] { return !m_running || !m_readQueue.empty(); });
+            if (!m_running) {
+                break;
+            }
+
+            const size_t batchSize = m_ioBatchSize.load();
+            while (!m_readQueue.empty() && batch.size() < batchSize) {
+                RequestPtr request = *m_readQueue.begin();
+                m_readQueue.erase(m_readQueue.begin());
+                request->stage = Stage::Reading;
+                batch.push_back(request);
+                paths.push_back(request->resource->getLoadPath());
+            }
+        }
+
+        // Files in a mounted archive are copied out of the mapping; only
+        // loose files go to the file reader
+        results.clear();
+        results.resize(batch.size());
+        for (size_t i = 0; i < paths.size(); ++i) {
+            if (vfs.isArchived(paths[i])) {
+                AssetView view = vfs.open(paths[i]);
+                results[i].success = view.isValid();
+                results[i].data.assign(view.data(), view.data() + view.size());
+            } else if (vfs.isLooseFilesEnabled()) {
+                diskPaths.push_back(paths[i]);
+                diskIndices.push_back(i);
+            }
+        }
+
+        if (!diskPaths.empty()) {
+            m_fileReader->readBatch(diskPaths, diskResults);
+            for (size_t i = 0; i < diskIndices.size(); ++i) {
+                results[diskIndices[i]] = std::move(diskResults[i]);
+            }
+        }
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!diskPaths.empty()) {
+            m_stats.ioBatches++;
+        }
+        for (size_t i = 0; i < batch.size(); ++i) {
+            const RequestPtr& request = batch[i];
+            if (request->cancelled) {
+                finishLocked(request, false);
+            } else if (!results[i].success) {
+                std::cerr << "Failed to read resource file: " << paths[i] << std::endl;
+                finishLocked(request, false);
+            } else {
+                m_stats.bytesRead += results[i].data.size();
+                request->fileData = std::move(results[i].data);
+                queueDecodeLocked(request);
+            }
+        }
+    }
+}
+
+void ResourceLoadPipeline::runDecodeJob() {
+    RequestPtr request;
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!m_decodeQueue.empty()) {
+            request = *m_decodeQueue.begin();
+            m_decodeQueue.erase(m_decodeQueue.begin());
+            request->stage = Stage::Decoding;
+        }
+    }
+
+    // Jobs are submitted one per request but each takes the best one
+    // waiting, so the FIFO pool still serves the highest priority first
+    if (request) {
+        bool success;
+        if (request->staged) {
+            success = request->resource->decode(request->fileData);
+            request->fileData.clear();
+            request->fileData.shrink_to_fit();
+        } else {
+            success = request->reload ? request->resource->reload() : request->resource->load();
+        }
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (request->staged && success && !request->cancelled) {
+            request->stage = Stage::UploadQueued;
+            m_uploadQueue.insert(request);
+        } else {
+            finishLocked(request, success);
+        }
+    }
+
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (--m_pendingJobs == 0) {
+        m_jobsDone.notify_all();
+    }
+}
+
+void ResourceLoadPipeline::queueDecodeLocked(const RequestPtr& request) {
+    request->stage = Stage::DecodeQueued;
+    m_decodeQueue.insert(request);
+    m_pendingJobs++;
+    m_jobSystem->submit([this]() { runDecodeJob(); });
+}
+
+ResourceLoadPipeline::RequestQueue* ResourceLoadPipeline::queueForStage(Stage stage) {
+    switch (stage) {
+        case Stage::ReadQueued:
+            return &m_readQueue;
+        case Stage::DecodeQueued:
+            return &m_decodeQueue;
+        case Stage::UploadQueued:
+            return &m_uploadQueue;
+        default:
+            return nullptr;
+    }
+}
+
+void ResourceLoadPipeline::finishLocked(const RequestPtr& request, bool success) {
+    request->stage = Stage::Finished;
+    request->success = success;
+    request->fileData.clear();
+    m_requests.erase(request->id);
+    m_requestsByResource.erase(request->resource.get());
+    m_finished.push_back(request);
+}
+
+void ResourceLoadPipeline::deliver(const RequestPtr& request, uint64_t frame) {
+    auto& resource = request->resource;
+
+    if (request->cancelled) {
+        resource->discardDecoded();
+        if (!request->reload && resource->isLoading()) {
+            resource->setState(request->previousState);
+        }
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stats.cancelled++;
+        return;
+    }
+
+    if (!request->success && request->staged && !request->reload) {
+        resource->setState(ResourceState::Failed);
+    }
+
+    if (request->success && frame != 0) {
+        resource->touch(frame);
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (request->success) {
+            m_stats.completed++;
+            if (std::chrono::steady_clock::now() > request->options.deadline) {
+                m_stats.deadlineMisses++;
+            }
+        } else {
+            m_stats.failed++;
+        }
+    }
+
+    for (const auto& callback : request->callbacks) {
+        callback(resource);
+    }
+}
+
+} // namespace Resources
+} // namespace RPGEngine
@@ -0,0 +1,289 @@
+#pragma once
+
+#include "Resource.h"
+#include "FileReader.h"
+#include <string>
+#include <memory>
+#include <functional>
+#include <vector>
+#include <set>
+#include <unordered_map>
+#include <mutex>
+#include <thread>
+#include <condition_variable>
+#include <atomic>
+#include <chrono>
+
+namespace RPGEngine {
+namespace Core {
+class ThreadPool;
+}
+
+namespace Resources {
+
+/**
+ * Resource loading callback function type
+ */
+using ResourceCallback = std::function<void(std::shared_ptr<Resource>)>;
+
+/**
+ * Load request priority
+ * Higher priorities are read, decoded and uploaded first.
+ */
+enum class LoadPriority {
+    Background,     // Prefetch, may wait
+    Normal,
+    High,           // Needed soon (e.g. the next room)
+    Critical        // Needed this frame; uploaded even past the upload budget
+};
+
+/**
+ * Options of a load request
+ */
+struct LoadOptions {
+    LoadPriority priority = LoadPriority::Normal;
+
+    // Requests with the same priority are served earliest deadline first.
+    // Past its deadline a request is uploaded even past the upload budget.
+    std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::time_point::max();
+};
+
+/**
+ * Load request identifier (0 = none)
+ */
+using LoadRequestId = uint64_t;
+
+/**
+ * Load pipeline statistics
+ */
+struct ResourcePipelineStats {
+    uint64_t requested = 0;         // Requests accepted
+    uint64_t coalesced = 0;         // Requests merged into one already in flight
+    uint64_t completed = 0;
+    uint64_t failed = 0;
+    uint64_t cancelled = 0;
+    uint64_t deadlineMisses = 0;    // Completed after their deadline
+    uint64_t ioBatches = 0;         // File reader batches submitted
+    uint64_t bytesRead = 0;
+    uint64_t uploads = 0;           // Main-thread uploads done
+    uint64_t uploadsDeferred = 0;   // Uploads left waiting at the end of an update
+    double lastUploadMs = 0.0;      // Upload time spent in the last update
+};
+
+/**
+ * Prioritized asynchronous resource loading pipeline
+ *
+ * Requests pass through three stages:
+ *  - I/O: a dedicated thread reads files in batches through an IFileReader
+ *    (io_uring where available), or copies them out of a mounted archive;
+ *  - decode: jobs on the engine thread pool decode the file contents, or
+ *    call load() for resources without staged loading;
+ *  - upload: update() finishes staged loads on the main thread, spending
+ *    at most the upload budget per frame.
+ * Each stage takes the highest priority, earliest deadline request first.
+ * Requests for a resource already in flight are merged into that request.
+ */
+class ResourceLoadPipeline {
+public:
+    /**
+     * Constructor
+     * @param jobSystem Thread pool that runs decode jobs
+     * @param fileReader File reader for the I/O stage
+     */
+    ResourceLoadPipeline(std::shared_ptr<Core::ThreadPool> jobSystem, std::unique_ptr<IFileReader> fileReader);
+
+    /**
+     * Destructor
+     */
+    ~ResourceLoadPipeline();
+
+    /**
+     * Start the I/O thread
+     */
+    void start();
+
+    /**
+     * Stop the I/O thread and wait for running decode jobs
+     * Requests that have not finished are dropped and their resources
+     * returned to the state they had before the request.
+     */
+    void stop();
+
+    /**
+     * Request a load
+     * @param resource Resource to load
+     * @param options Priority and deadline
+     * @param callback Called on the main thread when the load succeeds or fails (not when cancelled)
+     * @param reload Whether to reload a loaded resource (the old version stays usable until upload)
+     * @return Request ID (the existing one if the resource is already in flight)
+     */
+    LoadRequestId request(std::shared_ptr<Resource> resource, const LoadOptions& options,
+                          ResourceCallback callback = nullptr, bool reload = false);
+
+    /**
+     * Cancel a request
+     * Work already started is finished and thrown away.
+     * @param id Request ID
+     * @return true if the request was in flight
+     */
+    bool cancel(LoadRequestId id);
+
+    /**
+     * Finish completed requests and run uploads (main thread, once per frame)
+     * @param frame Frame to mark finished resources as used on (0 = don't), so
+     *              budget eviction doesn't drop them before anyone sees them
+     */
+    void update(uint64_t frame = 0);
+
+    /**
+     * Set the time update() may spend on uploads
+     * At least one upload runs per update, however long it takes.
+     * @param milliseconds Budget per update
+     */
+    void setUploadBudget(float milliseconds) { m_uploadBudgetMs = milliseconds; }
+
+    /**
+     * Get the upload budget
+     * @return Budget per update in milliseconds
+     */
+    float getUploadBudget() const { return m_uploadBudgetMs; }
+
+    /**
+     * Set the most files the I/O stage reads per batch
+     * @param batchSize Files per batch
+     */
+    void setIOBatchSize(size_t batchSize) { m_ioBatchSize = batchSize > 0 ? batchSize : 1; }
+
+    /**
+     * Get the number of requests in flight
+     * @return Requests not yet finished
+     */
+    size_t getInFlightCount() const;
+
+    /**
+     * Get the pipeline statistics
+     * @return Statistics
+     */
+    ResourcePipelineStats getStats() const;
+
+    /**
+     * Get the name of the file reader in use
+     * @return Reader name
+     */
+    const char* getFileReaderName() const { return m_fileReader->getName(); }
+
+private:
+    /**
+     * Request stage
+     */
+    enum class Stage {
+        ReadQueued,
+        Reading,
+        DecodeQueued,
+        Decoding,
+        UploadQueued,
+        Finished
+    };
+
+    /**
+     * Request in flight
+     */
+    struct Request {
+        LoadRequestId id = 0;
+        std::shared_ptr<Resource> resource;
+        LoadOptions options;
+        uint64_t sequence = 0;
+        bool reload = false;
+        bool staged = false;
+        bool cancelled = false;
+        bool success = false;
+        Stage stage = Stage::ReadQueued;
+        ResourceState previousState = ResourceState::Unloaded;
+        std::vector<ResourceCallback> callbacks;
+        std::vector<uint8_t> fileData;
+    };
+
+    using RequestPtr = std::shared_ptr<Request>;
+
+    /**
+     * Queue order: priority, then deadline, then arrival
+     */
+    struct RequestOrder {
+        bool operator()(const RequestPtr& a, const RequestPtr& b) const {
+            if (a->options.priority != b->options.priority) {
+                return a->options.priority > b->options.priority;
+            }
+            if (a->options.deadline != b->options.deadline) {
+                return a->options.deadline < b->options.deadline;
+            }
+            return a->sequence < b->sequence;
+        }
+    };
+
+    using RequestQueue = std::set<RequestPtr, RequestOrder>;
+
+    /**
+     * I/O thread function
+     */
+    void ioThreadFunc();
+
+    /**
+     * Decode job: runs the best request waiting for the decode stage
+     */
+    void runDecodeJob();
+
+    /**
+     * Queue a request for decoding and submit a job for it
+     * Must be called with m_mutex held.
+     * @param request Request
+     */
+    void queueDecodeLocked(const RequestPtr& request);
+
+    /**
+     * Get the queue holding a request's current stage
+     * @param stage Stage
+     * @return Queue, or nullptr if the request is being worked on
+     */
+    RequestQueue* queueForStage(Stage stage);
+
+    /**
+     * Move a request to the finished list
+     * Must be called with m_mutex held.
+     * @param request Request
+     * @param success Whether the load succeeded
+     */
+    void finishLocked(const RequestPtr& request, bool success);
+
+    /**
+     * Restore state, update stats and call callbacks (main thread)
+     * @param request Finished request
+     * @param frame Frame to mark the resource used on (0 = don't)
+     */
+    void deliver(const RequestPtr& request, uint64_t frame);
+
+    std::shared_ptr<Core::ThreadPool> m_jobSystem;
+    std::unique_ptr<IFileReader> m_fileReader;
+
+    mutable std::mutex m_mutex;
+    std::condition_variable m_ioCondition;
+    std::condition_variable m_jobsDone;
+    std::thread m_ioThread;
+    bool m_running;
+    size_t m_pendingJobs;
+
+    RequestQueue m_readQueue;
+    RequestQueue m_decodeQueue;
+    RequestQueue m_uploadQueue;
+    std::vector<RequestPtr> m_finished;
+    std::unordered_map<LoadRequestId, RequestPtr> m_requests;
+    std::unordered_map<const Resource*, RequestPtr> m_requestsByResource;
+    LoadRequestId m_nextId;
+    uint64_t m_nextSequence;
+
+    std::atomic<float> m_uploadBudgetMs;
+    std::atomic<size_t> m_ioBatchSize;
+    ResourcePipelineStats m_stats;  // Guarded by m_mutex
+};
+
+} // namespace Resources
+} // namespace RPGEngine
@@ -1,4 +1,6 @@
 #include "ResourceManager.h"
+#include "../core/ThreadPool.h"
+#include "../core/FileWatcher.h"
 #include <iostream>
 #include <algorithm>
 #include <chrono>
@@ -9,28 +11,49 @@ namespace Resources {
 ResourceManager::ResourceManager(bool asyncLoadingEnabled, int maxAsyncLoads)
     : m_asyncLoadingEnabled(asyncLoadingEnabled)
     , m_maxAsyncLoads(maxAsyncLoads)
-    , m_shutdownThreads(false)
-    , m_activeAsyncLoads(0)
+    , m_ownsJobSystem(false)
+    , m_uploadBudgetMs(2.0f)
+    , m_hotReloadingEnabled(false)
+    , m_watchedTableVersion(0)
     , m_basePath("")
 {
+    m_table = new ResourceTable();
+    m_tableVersion = 1;
+    m_firstUseHitches = 0;
+    m_recordingManifest = false;
+    m_activeReaders = 0;
+    m_frame = 1;
 }
 
 ResourceManager::~ResourceManager() {
+    enableHotReloading(false);
+    
     if (m_asyncLoadingEnabled) {
         shutdown();
     }
     
     clearResources();
+    
+    for (const ResourceTable* table : m_retiredTables) {
+        delete table;
+    }
+    delete m_table.load();
 }
 
 bool ResourceManager::initialize() {
-    if (m_asyncLoadingEnabled) {
-        // Create worker threads
-        m_shutdownThreads = false;
-        
-        for (int i = 0; i < m_maxAsyncLoads; ++i) {
-            m_workerThreads.emplace_back(&ResourceManager::workerThreadFunc, this);
+    if (m_asyncLoadingEnabled && !m_pipeline) {
+        // Create a job system unless one is shared with us
+        if (!m_jobSystem) {
+            m_jobSystem = std::make_shared<Core::ThreadPool>(static_cast<size_t>(m_maxAsyncLoads));
+            m_ownsJobSystem = true;
         }
+        
+        m_pipeline = std::make_unique<ResourceLoadPipeline>(m_jobSystem, createFileReader(m_jobSystem));
+        m_pipeline->setUploadBudget(m_uploadBudgetMs);
+        m_pipeline->start();
+        
+        std::cout << "ResourceManager async loading: " << m_jobSystem->getThreadCount() << " jobs, "
+                  << m_pipeline->getFileReaderName() << " reads" << std::endl;
     }
     
     std::cout << "ResourceManager initialized" << std::endl;
@@ -38,45 +61,60 @@ bool ResourceManager::initialize() {
 }
 
 void ResourceManager::shutdown() {
-    if (m_asyncLoadingEnabled) {
-        // Signal worker threads to shut down
-        m_shutdownThreads = true;
-        m_taskQueueCondition.notify_all();
+    if (m_pipeline) {
+        // Drop unfinished loads and wait for running decode jobs
+        m_pipeline->stop();
+        m_pipeline.reset();
         
-        // Wait for worker threads to finish
-        for (auto& thread : m_workerThreads) {
-            if (thread.joinable()) {
-                thread.join();
-            }
+        if (m_ownsJobSystem) {
+            m_jobSystem.reset();
+            m_ownsJobSystem = false;
         }
-        
-        m_workerThreads.clear();
     }
     
     std::cout << "ResourceManager shutdown" << std::endl;
 }
 
 void ResourceManager::update() {
-    if (m_asyncLoadingEnabled) {
-        // Process completed async loads
-        processCompletedAsyncLoads();
+    {
+        std::lock_guard<std::mutex> lock(m_resourceMutex);
+        reclaimRetiredTables();
     }
+    
+    if (m_hotReloadingEnabled) {
+        syncFileWatches();
+    }
+    if (m_fileWatcher) {
+        // Also serves other systems sharing the watcher; reloads requested
+        // here are picked up by the pipeline below
+        m_fileWatcher->update();
+    }
+    
+    if (m_pipeline) {
+        // Finish async loads before measuring, marking them used this frame
+        m_pipeline->update(m_frame.load(std::memory_order_relaxed));
+    }
+    
+    enforceBudgets();
+    m_frame.fetch_add(1, std::memory_order_relaxed);
 }
 
 std::shared_ptr<Resource> ResourceManager::getResource(const std::string& id) const {
-    std::lock_guard<std::mutex> lock(m_resourceMutex);
+    TableReader reader(*this);
     
-    auto it = m_resources.find(id);
-    if (it != m_resources.end()) {
-        return it->second;
+    auto it = reader.table->slotsById.find(id);
+    if (it != reader.table->slotsById.end()) {
+        const std::shared_ptr<Resource>& resource = reader.table->slots[it->second].resource;
+        resource->touch(m_frame.load(std::memory_order_relaxed));
+        return resource;
     }
     
     return nullptr;
 }
 
 bool ResourceManager::hasResource(const std::string& id) const {
-    std::lock_guard<std::mutex> lock(m_resourceMutex);
-    return m_resources.find(id) != m_resources.end();
+    TableReader reader(*this);
+    return reader.table->slotsById.find(id) != reader.table->slotsById.end();
 }
 
 bool ResourceManager::addResource(std::shared_ptr<Resource> resource) {
@@ -86,31 +124,58 @@ bool ResourceManager::addResource(std::shared_ptr<Resource> resource) {
     
     std::lock_guard<std::mutex> lock(m_resourceMutex);
     
-    const std::string& id = resource->getId();
-    
     // Check if resource already exists
-    if (m_resources.find(id) != m_resources.end()) {
+    const ResourceTable* current = m_table.load();
+    if (current->slotsById.find(resource->getId()) != current->slotsById.end()) {
         return false;
     }
     
     // Add resource
-    m_resources[id] = resource;
+    ResourceTable* table = new ResourceTable(*current);
+    insertResource(*table, resource);
+    publishTable(table);
     
     return true;
 }
 
+size_t ResourceManager::addResources(const std::vector<std::shared_ptr<Resource>>& resources) {
+    std::lock_guard<std::mutex> lock(m_resourceMutex);
+    
+    ResourceTable* table = new ResourceTable(*m_table.load());
+    
+    size_t count = 0;
+    for (const auto& resource : resources) {
+        if (resource && insertResource(*table, resource)) {
+            ++count;
+        }
+    }
+    
+    if (count == 0) {
+        delete table;
+        return 0;
+    }
+    
+    publishTable(table);
+    return count;
+}
+
 bool ResourceManager::removeResource(const std::string& id) {
     std::lock_guard<std::mutex> lock(m_resourceMutex);
     
-    auto it = m_resources.find(id);
-    if (it != m_resources.end()) {
+    const ResourceTable* current = m_table.load();
+    auto it = current->slotsById.find(id);
+    if (it != current->slotsById.end()) {
+        const std::shared_ptr<Resource>& resource = current->slots[it->second].resource;
+        
         // Unload resource if loaded
-        if (it->second->isLoaded()) {
-            it->second->unload();
+        if (resource->isLoaded()) {
+            resource->unload();
         }
         
         // Remove resource
-        m_resources.erase(it);
+        ResourceTable* table = new ResourceTable(*current);
+        eraseSlot(*table, it->second);
+        publishTable(table);
         
         return true;
     }
@@ -123,6 +188,7 @@ bool ResourceManager::loadResource(const std::string& id, ResourceCallback callb
     if (!resource) {
         return false;
     }
+    recordUse(*resource);
     
     // Check if already loaded
     if (resource->isLoaded()) {
@@ -132,19 +198,18 @@ bool ResourceManager::loadResource(const std::string& id, ResourceCallback callb
         return true;
     }
     
-    // Load resource
-    bool success = resource->load();
-    
-    // Call callback
-    if (callback) {
-        callback(resource);
+    // The caller waits for the load: a hitch a preload manifest should have avoided
+    m_firstUseHitches.fetch_add(1, std::memory_order_relaxed);
+    {
+        std::lock_guard<std::mutex> lock(m_usageMutex);
+        m_hitchIds.push_back(id);
     }
     
-    return success;
+    return loadNow(resource, callback);
 }
 
 bool ResourceManager::loadResourceAsync(const std::string& id, ResourceCallback callback) {
-    if (!m_asyncLoadingEnabled) {
+    if (!m_pipeline) {
         return loadResource(id, callback);
     }
     
@@ -152,6 +217,7 @@ bool ResourceManager::loadResourceAsync(const std::string& id, ResourceCallback
     if (!resource) {
         return false;
     }
+    recordUse(*resource);
     
     // Check if already loaded
     if (resource->isLoaded()) {
@@ -161,19 +227,80 @@ bool ResourceManager::loadResourceAsync(const std::string& id, ResourceCallback
         return true;
     }
     
-    // Check if already loading
-    if (resource->isLoading()) {
-        if (callback) {
-            // Queue callback to be called when loading is complete
-            queueAsyncLoadTask(AsyncLoadTask(id, callback));
+    // Loads already in flight are merged by the pipeline
+    m_pipeline->request(resource, LoadOptions(), callback);
+    
+    return true;
+}
+
+LoadRequestId ResourceManager::requestLoad(const std::string& id, const LoadOptions& options, ResourceCallback callback) {
+    auto resource = getResource(id);
+    if (!resource) {
+        return 0;
+    }
+    
+    if (!m_pipeline || resource->isLoaded()) {
+        loadResource(id, callback);
+        return 0;
+    }
+    
+    recordUse(*resource);
+    return m_pipeline->request(resource, options, callback);
+}
+
+std::vector<std::shared_ptr<Resource>> ResourceManager::preload(const PreloadManifest& manifest, const LoadOptions& options) {
+    std::vector<std::shared_ptr<Resource>> resources;
+    resources.reserve(manifest.size());
+    
+    for (const auto& entry : manifest.getEntries()) {
+        auto resource = getResource(entry.id);
+        if (!resource) {
+            continue;
+        }
+        recordUse(*resource);
+        resources.push_back(resource);
+        
+        if (resource->isLoaded() || resource->isLoading()) {
+            continue;
+        }
+        if (m_pipeline) {
+            m_pipeline->request(resource, options);
+        } else {
+            loadNow(resource, nullptr);
         }
-        return true;
     }
     
-    // Queue async load task
-    queueAsyncLoadTask(AsyncLoadTask(id, callback));
+    return resources;
+}
+
+void ResourceManager::beginManifestRecording(const std::string& name) {
+    std::lock_guard<std::mutex> lock(m_usageMutex);
+    m_recording = PreloadManifest(name);
+    m_recordingManifest = true;
+}
+
+PreloadManifest ResourceManager::endManifestRecording() {
+    std::lock_guard<std::mutex> lock(m_usageMutex);
+    m_recordingManifest = false;
     
-    return true;
+    PreloadManifest manifest = std::move(m_recording);
+    m_recording = PreloadManifest();
+    return manifest;
+}
+
+std::vector<std::string> ResourceManager::getFirstUseHitches() const {
+    std::lock_guard<std::mutex> lock(m_usageMutex);
+    return m_hitchIds;
+}
+
+void ResourceManager::resetFirstUseHitches() {
+    std::lock_guard<std::mutex> lock(m_usageMutex);
+    m_firstUseHitches = 0;
+    m_hitchIds.clear();
+}
+
+bool ResourceManager::cancelLoad(LoadRequestId requestId) {
+    return m_pipeline && m_pipeline->cancel(requestId);
 }
 
 bool ResourceManager::unloadResource(const std::string& id) {
@@ -211,7 +338,7 @@ bool ResourceManager::reloadResource(const std::string& id, ResourceCallback cal
 }
 
 bool ResourceManager::reloadResourceAsync(const std::string& id, ResourceCallback callback) {
-    if (!m_asyncLoadingEnabled) {
+    if (!m_pipeline) {
         return reloadResource(id, callback);
     }
     
@@ -220,23 +347,14 @@ bool ResourceManager::reloadResourceAsync(const std::string& id, ResourceCallbac
         return false;
     }
     
-    // Queue async reload task
-    queueAsyncLoadTask(AsyncLoadTask(id, callback, true));
+    // The loaded version stays usable until the new one is uploaded
+    m_pipeline->request(resource, LoadOptions(), callback, true);
     
     return true;
 }
 
 std::vector<std::shared_ptr<Resource>> ResourceManager::getAllResources() const {
-    std::vector<std::shared_ptr<Resource>> result;
-    
-    std::lock_guard<std::mutex> lock(m_resourceMutex);
-    result.reserve(m_resources.size());
-    
-    for (const auto& pair : m_resources) {
-        result.push_back(pair.second);
-    }
-    
-    return result;
+    return getResourcesOfType<Resource>();
 }
 
 void ResourceManager::setAsyncLoadingEnabled(bool enabled) {
@@ -276,17 +394,75 @@ void ResourceManager::setMaxAsyncLoads(int maxLoads) {
     }
 }
 
+void ResourceManager::setJobSystem(std::shared_ptr<Core::ThreadPool> jobSystem) {
+    if (m_jobSystem == jobSystem) {
+        return;
+    }
+    
+    // Restart a running pipeline on the new job system
+    bool running = m_pipeline != nullptr;
+    if (running) {
+        shutdown();
+    }
+    
+    m_jobSystem = jobSystem;
+    m_ownsJobSystem = false;
+    
+    if (running) {
+        initialize();
+    }
+}
+
+void ResourceManager::setUploadBudget(float milliseconds) {
+    m_uploadBudgetMs = milliseconds;
+    if (m_pipeline) {
+        m_pipeline->setUploadBudget(milliseconds);
+    }
+}
+
+void ResourceManager::setFileWatcher(std::shared_ptr<Core::FileWatcher> watcher) {
+    bool enabled = m_hotReloadingEnabled;
+    enableHotReloading(false);
+    m_fileWatcher = watcher;
+    enableHotReloading(enabled);
+}
+
+void ResourceManager::enableHotReloading(bool enable) {
+    if (enable == m_hotReloadingEnabled) {
+        return;
+    }
+    
+    m_hotReloadingEnabled = enable;
+    if (enable) {
+        if (!m_fileWatcher) {
+            m_fileWatcher = std::make_shared<Core::FileWatcher>();
+        }
+        m_watchedTableVersion = 0;
+        syncFileWatches();
+        return;
+    }
+    
+    for (const auto& pair : m_resourceWatches) {
+        m_fileWatcher->unwatch(pair.second.watchId);
+    }
+    m_resourceWatches.clear();
+}
+
+ResourcePipelineStats ResourceManager::getPipelineStats() const {
+    return m_pipeline ? m_pipeline->getStats() : ResourcePipelineStats();
+}
+
 size_t ResourceManager::getResourceCount() const {
-    std::lock_guard<std::mutex> lock(m_resourceMutex);
-    return m_resources.size();
+    TableReader reader(*this);
+    return reader.table->slotsById.size();
 }
 
 size_t ResourceManager::getLoadedResourceCount() const {
-    std::lock_guard<std::mutex> lock(m_resourceMutex);
+    TableReader reader(*this);
     
     size_t count = 0;
-    for (const auto& pair : m_resources) {
-        if (pair.second->isLoaded()) {
+    for (const auto& slot : reader.table->slots) {
+        if (slot.resource && slot.resource->isLoaded()) {
             ++count;
         }
     }
@@ -295,11 +471,11 @@ size_t ResourceManager::getLoadedResourceCount() const {
 }
 
 size_t ResourceManager::getLoadingResourceCount() const {
-    std::lock_guard<std::mutex> lock(m_resourceMutex);
+    TableReader reader(*this);
     
     size_t count = 0;
-    for (const auto& pair : m_resources) {
-        if (pair.second->isLoading()) {
+    for (const auto& slot : reader.table->slots) {
+        if (slot.resource && slot.resource->isLoading()) {
             ++count;
         }
     }
@@ -308,11 +484,11 @@ size_t ResourceManager::getLoadingResourceCount() const {
 }
 
 size_t ResourceManager::getFailedResourceCount() const {
-    std::lock_guard<std::mutex> lock(m_resourceMutex);
+    TableReader reader(*this);
     
     size_t count = 0;
-    for (const auto& pair : m_resources) {
-        if (pair.second->isFailed()) {
+    for (const auto& slot : reader.table->slots) {
+        if (slot.resource && slot.resource->isFailed()) {
             ++count;
         }
     }
@@ -323,116 +499,280 @@ size_t ResourceManager::getFailedResourceCount() const {
 void ResourceManager::clearResources() {
     std::lock_guard<std::mutex> lock(m_resourceMutex);
     
+    const ResourceTable* current = m_table.load();
+    if (current->slotsById.empty()) {
+        return;
+    }
+    
     // Unload all resources
-    for (auto& pair : m_resources) {
-        if (pair.second->isLoaded()) {
-            pair.second->unload();
+    ResourceTable* table = new ResourceTable(*current);
+    for (uint32_t index = 0; index < table->slots.size(); ++index) {
+        if (table->slots[index].resource) {
+            if (table->slots[index].resource->isLoaded()) {
+                table->slots[index].resource->unload();
+            }
+            eraseSlot(*table, index);
         }
     }
     
     // Clear resources
-    m_resources.clear();
+    publishTable(table);
 }
 
 size_t ResourceManager::clearUnusedResources() {
     std::lock_guard<std::mutex> lock(m_resourceMutex);
     
+    ResourceTable* table = new ResourceTable(*m_table.load());
+    
     size_t count = 0;
-    auto it = m_resources.begin();
-    while (it != m_resources.end()) {
-        if (it->second->getRefCount() <= 0) {
+    for (uint32_t index = 0; index < table->slots.size(); ++index) {
+        const std::shared_ptr<Resource>& resource = table->slots[index].resource;
+        if (resource && resource->getRefCount() <= 0) {
             // Unload resource if loaded
-            if (it->second->isLoaded()) {
-                it->second->unload();
+            if (resource->isLoaded()) {
+                resource->unload();
             }
             
             // Remove resource
-            it = m_resources.erase(it);
+            eraseSlot(*table, index);
             ++count;
-        } else {
-            ++it;
         }
     }
     
+    if (count == 0) {
+        delete table;
+        return 0;
+    }
+    
+    publishTable(table);
     return count;
 }
 
-void ResourceManager::workerThreadFunc() {
-    while (!m_shutdownThreads) {
-        AsyncLoadTask task("", nullptr);
+void ResourceManager::setBudget(ResourceCategory category, size_t bytes) {
+    std::lock_guard<std::mutex> lock(m_resourceMutex);
+    m_budgets[static_cast<size_t>(category)].budget = bytes;
+}
+
+size_t ResourceManager::getBudget(ResourceCategory category) const {
+    std::lock_guard<std::mutex> lock(m_resourceMutex);
+    return m_budgets[static_cast<size_t>(category)].budget;
+}
+
+ResourceBudgetStats ResourceManager::getBudgetStats(ResourceCategory category) const {
+    std::lock_guard<std::mutex> lock(m_resourceMutex);
+    return m_budgets[static_cast<size_t>(category)];
+}
+
+size_t ResourceManager::enforceBudgets() {
+    const size_t categoryCount = static_cast<size_t>(ResourceCategory::Count);
+    const uint64_t frame = m_frame.load(std::memory_order_relaxed);
+    
+    std::lock_guard<std::mutex> lock(m_resourceMutex);
+    reclaimRetiredTables();
+    const ResourceTable* table = m_table.load();
+    
+    // Measure
+    size_t used[categoryCount] = {};
+    for (const auto& slot : table->slots) {
+        if (slot.resource && slot.resource->isLoaded()) {
+            used[static_cast<size_t>(slot.resource->getCategory())] += slot.resource->getMemorySize();
+        }
+    }
+    
+    size_t evicted = 0;
+    for (size_t category = 0; category < categoryCount; ++category) {
+        ResourceBudgetStats& stats = m_budgets[category];
+        stats.peak = std::max(stats.peak, used[category]);
         
-        // Wait for a task
-        {
-            std::unique_lock<std::mutex> lock(m_taskQueueMutex);
-            m_taskQueueCondition.wait(lock, [this] {
-                return m_shutdownThreads || !m_taskQueue.empty();
-            });
-            
-            if (m_shutdownThreads) {
-                break;
+        if (stats.budget > 0 && used[category] > stats.budget) {
+            // Collect eviction candidates
+            std::vector<Resource*> candidates;
+            for (const auto& slot : table->slots) {
+                Resource* resource = slot.resource.get();
+                if (resource && resource->isLoaded() &&
+                    static_cast<size_t>(resource->getCategory()) == category &&
+                    resource->getRefCount() <= 0 &&
+                    resource->getPriority() != ResourcePriority::Pinned &&
+                    resource->getLastUsedFrame() < frame &&
+                    !hasOutsideOwners(slot.resource)) {
+                    candidates.push_back(resource);
+                }
             }
             
-            if (m_taskQueue.empty()) {
-                continue;
-            }
+            std::sort(candidates.begin(), candidates.end(), [](const Resource* a, const Resource* b) {
+                if (a->getPriority() != b->getPriority()) {
+                    return a->getPriority() < b->getPriority();
+                }
+                return a->getLastUsedFrame() < b->getLastUsedFrame();
+            });
             
-            task = m_taskQueue.front();
-            m_taskQueue.pop();
+            // Evict until the category fits
+            for (Resource* resource : candidates) {
+                if (used[category] <= stats.budget) {
+                    break;
+                }
+                
+                size_t bytes = resource->getMemorySize();
+                resource->unload();
+                used[category] -= std::min(bytes, used[category]);
+                stats.evictions++;
+                stats.evictedBytes += bytes;
+                ++evicted;
+            }
             
-            // Increment active async loads counter
-            ++m_activeAsyncLoads;
+            // Whatever remains over budget is referenced, pinned or in use
         }
         
-        // Get the resource
-        auto resource = getResource(task.resourceId);
-        if (!resource) {
-            // Resource not found, decrement counter and continue
-            --m_activeAsyncLoads;
-            continue;
+        stats.used = used[category];
+    }
+    
+    return evicted;
+}
+
+bool ResourceManager::insertResource(ResourceTable& table, std::shared_ptr<Resource> resource) {
+    if (table.slotsById.find(resource->getId()) != table.slotsById.end()) {
+        return false;
+    }
+    
+    // Reuse a removed slot; its generation was bumped on removal
+    uint32_t index;
+    if (!m_freeSlots.empty()) {
+        index = m_freeSlots.back();
+        m_freeSlots.pop_back();
+    } else {
+        index = static_cast<uint32_t>(table.slots.size());
+        table.slots.emplace_back();
+    }
+    
+    const Resource& object = *resource;
+    table.slotsByType[std::type_index(typeid(object))].push_back(index);
+    table.slotsById[resource->getId()] = index;
+    table.slots[index].resource = std::move(resource);
+    return true;
+}
+
+void ResourceManager::eraseSlot(ResourceTable& table, uint32_t index) {
+    ResourceSlot& slot = table.slots[index];
+    
+    const Resource& object = *slot.resource;
+    auto typeIt = table.slotsByType.find(std::type_index(typeid(object)));
+    if (typeIt != table.slotsByType.end()) {
+        auto& indices = typeIt->second;
+        indices.erase(std::remove(indices.begin(), indices.end(), index), indices.end());
+        if (indices.empty()) {
+            table.slotsByType.erase(typeIt);
         }
-        
-        // Load or reload the resource
-        bool success = task.isReload ? resource->reload() : resource->load();
-        
-        // Queue the result
-        {
-            std::lock_guard<std::mutex> lock(m_resultQueueMutex);
-            m_resultQueue.emplace(task.resourceId, success, task.callback);
+    }
+    
+    table.slotsById.erase(slot.resource->getId());
+    slot.resource.reset();
+    
+    // Invalidate outstanding handles (0 is reserved for null handles)
+    if (++slot.generation == 0) {
+        slot.generation = 1;
+    }
+    m_freeSlots.push_back(index);
+}
+
+bool ResourceManager::hasOutsideOwners(const std::shared_ptr<Resource>& resource) const {
+    // One copy lives in the current table and one in each retired table
+    // that still lists the resource; anything beyond that is held elsewhere
+    // (e.g. a tileset drawing the texture every frame)
+    long tableOwners = 1;
+    for (const ResourceTable* table : m_retiredTables) {
+        auto it = table->slotsById.find(resource->getId());
+        if (it != table->slotsById.end() && table->slots[it->second].resource == resource) {
+            ++tableOwners;
         }
-        
-        // Decrement active async loads counter
-        --m_activeAsyncLoads;
     }
+    
+    return resource.use_count() > tableOwners;
 }
 
-void ResourceManager::processCompletedAsyncLoads() {
-    std::queue<AsyncLoadResult> results;
+void ResourceManager::recordUse(const Resource& resource) {
+    if (!m_recordingManifest.load(std::memory_order_relaxed)) {
+        return;
+    }
     
-    // Get all completed async loads
-    {
-        std::lock_guard<std::mutex> lock(m_resultQueueMutex);
-        std::swap(results, m_resultQueue);
+    std::lock_guard<std::mutex> lock(m_usageMutex);
+    if (m_recordingManifest) {
+        m_recording.add({resource.getId(), resource.getCategory(), resource.getPath()});
     }
+}
+
+bool ResourceManager::loadNow(const std::shared_ptr<Resource>& resource, const ResourceCallback& callback) {
+    bool success = resource->load();
     
-    // Process completed async loads
-    while (!results.empty()) {
-        const auto& result = results.front();
-        
-        // Get the resource
-        auto resource = getResource(result.resourceId);
-        if (resource && result.callback) {
-            // Call the callback
-            result.callback(resource);
+    if (callback) {
+        callback(resource);
+    }
+    
+    return success;
+}
+
+void ResourceManager::syncFileWatches() {
+    uint64_t version = m_tableVersion.load();
+    if (version == m_watchedTableVersion) {
+        return;
+    }
+    m_watchedTableVersion = version;
+    
+    TableReader reader(*this);
+    const ResourceTable& table = *reader.table;
+    
+    // Stop watching removed resources (or a new resource under the same ID)
+    for (auto it = m_resourceWatches.begin(); it != m_resourceWatches.end();) {
+        auto slotIt = table.slotsById.find(it->first);
+        if (slotIt == table.slotsById.end() || table.slots[slotIt->second].resource->getPath() != it->second.path) {
+            m_fileWatcher->unwatch(it->second.watchId);
+            it = m_resourceWatches.erase(it);
+        } else {
+            ++it;
+        }
+    }
+    
+    for (const auto& pair : table.slotsById) {
+        const std::string& path = table.slots[pair.second].resource->getPath();
+        if (path.empty() || m_resourceWatches.count(pair.first) != 0) {
+            continue;
         }
         
-        results.pop();
+        // Unloaded resources read the new file when next loaded
+        std::string id = pair.first;
+        uint64_t watchId = m_fileWatcher->watch(path, [this, id](const std::string& changedPath) {
+            auto resource = getResource(id);
+            if (resource && resource->isLoaded()) {
+                std::cout << "Resource file changed, reloading: " << changedPath << std::endl;
+                reloadResourceAsync(id);
+            }
+        });
+        m_resourceWatches[id] = {path, watchId};
     }
 }
 
-void ResourceManager::queueAsyncLoadTask(const AsyncLoadTask& task) {
-    std::lock_guard<std::mutex> lock(m_taskQueueMutex);
-    m_taskQueue.push(task);
-    m_taskQueueCondition.notify_one();
+void ResourceManager::publishTable(ResourceTable* table) {
+    const ResourceTable* previous = m_table.exchange(table);
+    m_tableVersion.fetch_add(1);
+    m_retiredTables.push_back(previous);
+    reclaimRetiredTables();
+}
+
+void ResourceManager::reclaimRetiredTables() {
+    if (m_retiredTables.empty()) {
+        return;
+    }
+    
+    // Every retired table was unpublished before this check. A reader that
+    // arrives later loads the current table, so with no reader inside a
+    // lookup right now, nobody can hold a retired one.
+    if (m_activeReaders.load() != 0) {
+        return;
+    }
+    
+    for (const ResourceTable* table : m_retiredTables) {
+        delete table;
+    }
+    m_retiredTables.clear();
 }
 
 } // namespace Resources
@@ -1,35 +1,65 @@
 #pragma once
 
 #include "Resource.h"
+#include "ResourceHandle.h"
+#include "ResourceLoadPipeline.h"
+#include "PreloadManifest.h"
 #include <string>
 #include <unordered_map>
 #include <memory>
 #include <functional>
-#include <future>
 #include <vector>
 #include <mutex>
-#include <queue>
-#include <thread>
-#include <condition_variable>
+#include <atomic>
+#include <typeindex>
+#include <type_traits>
 
 namespace RPGEngine {
+namespace Core {
+class ThreadPool;
+class FileWatcher;
+}
+
 namespace Resources {
 
 /**
- * Resource loading callback function type
+ * Memory budget statistics for one resource category
  */
-using ResourceCallback = std::function<void(std::shared_ptr<Resource>)>;
+struct ResourceBudgetStats {
+    size_t budget = 0;          // Bytes allowed (0 = unlimited)
+    size_t used = 0;            // Bytes held by loaded resources at the last update
+    size_t peak = 0;            // Highest use measured, before eviction
+    uint64_t evictions = 0;     // Resources unloaded to meet the budget
+    uint64_t evictedBytes = 0;
+};
 
 /**
  * Resource manager
  * Manages resource loading, caching, and reference counting
+ *
+ * Lookups read an immutable table published through an atomic pointer and
+ * take no lock. Adding or removing resources copies the table under
+ * m_resourceMutex and swaps it in; old tables are freed once no reader is
+ * inside a lookup. Writes are O(n), so register resources in bulk during
+ * loading (see addResources()) rather than per frame.
+ *
+ * Asynchronous loads go through a ResourceLoadPipeline running on the
+ * engine job system; see requestLoad() for priorities and deadlines.
+ *
+ * With hot reloading enabled, update() watches the file of every resource
+ * and reloads loaded resources asynchronously when their file changes.
+ *
+ * loadResource() on a resource that isn't loaded yet stalls the caller;
+ * these are counted as first-use hitches. Preloading a complete manifest
+ * (see preload()) before a scene starts keeps the count at zero.
  */
 class ResourceManager {
 public:
     /**
      * Constructor
      * @param asyncLoadingEnabled Whether to enable asynchronous loading
-     * @param maxAsyncLoads Maximum number of concurrent asynchronous loads
+     * @param maxAsyncLoads Worker threads of the job system created for loading
+     *                      (unused if one is shared with setJobSystem())
      */
     ResourceManager(bool asyncLoadingEnabled = true, int maxAsyncLoads = 4);
     
@@ -51,7 +81,8 @@ public:
     
     /**
      * Update the resource manager
-     * Processes completed async loads and invokes callbacks
+     * Dispatches file changes (if hot reloading), finishes completed async
+     * loads within the upload budget and invokes callbacks
      */
     void update();
     
@@ -76,6 +107,77 @@ public:
      */
     bool addResource(std::shared_ptr<Resource> resource);
     
+    /**
+     * Add several resources with a single table update
+     * @param resources Resources to add
+     * @return Number of resources added (existing IDs are skipped)
+     */
+    size_t addResources(const std::vector<std::shared_ptr<Resource>>& resources);
+    
+    /**
+     * Resolve a resource ID to a handle
+     * Do this once (e.g. when a scene loads) and keep the handle; resolving
+     * hashes the ID and checks the type, get() does neither.
+     * @tparam T Resource type
+     * @param id Resource ID
+     * @return Handle, or a null handle if not found or of the wrong type
+     */
+    template<typename T>
+    ResourceHandle<T> getHandle(const std::string& id) const {
+        ResourceHandle<T> handle;
+        
+        TableReader reader(*this);
+        auto it = reader.table->slotsById.find(id);
+        if (it != reader.table->slotsById.end()) {
+            const ResourceSlot& slot = reader.table->slots[it->second];
+            if (std::is_same<T, Resource>::value || dynamic_cast<T*>(slot.resource.get())) {
+                slot.resource->touch(m_frame.load(std::memory_order_relaxed));
+                handle.index = it->second;
+                handle.generation = slot.generation;
+            }
+        }
+        
+        return handle;
+    }
+    
+    /**
+     * Get a resource by handle
+     * @tparam T Resource type
+     * @param handle Handle from getHandle()
+     * @return Resource, or nullptr if the handle is null or stale
+     */
+    template<typename T>
+    std::shared_ptr<T> get(ResourceHandle<T> handle) const {
+        TableReader reader(*this);
+        if (handle.index >= reader.table->slots.size()) {
+            return nullptr;
+        }
+        
+        const ResourceSlot& slot = reader.table->slots[handle.index];
+        if (slot.generation != handle.generation || !slot.resource) {
+            return nullptr;
+        }
+        
+        // The type was checked when the handle was resolved, and the slot
+        // still holds that resource
+        slot.resource->touch(m_frame.load(std::memory_order_relaxed));
+        return std::static_pointer_cast<T>(slot.resource);
+    }
+    
+    /**
+     * Check if a handle still refers to a resource
+     * @tparam T Resource type
+     * @param handle Handle from getHandle()
+     * @return true if the resource has not been removed
+     */
+    template<typename T>
+    bool isValid(ResourceHandle<T> handle) const {
+        TableReader reader(*this);
+        return handle.index < reader.table->slots.size() &&
+               reader.table->slots[handle.index].generation == handle.generation &&
+               reader.table->slots[handle.index].resource != nullptr;
+    }
+    
     /**
      * Remove a resource
      * @param id Resource ID
@@ -99,6 +201,71 @@ public:
      */
     bool loadResourceAsync(const std::string& id, ResourceCallback callback = nullptr);
     
+    /**
+     * Request an asynchronous load with a priority and deadline
+     * Requests for a resource already loading are merged, keeping the more
+     * urgent options. Without async loading the resource loads immediately.
+     * @param id Resource ID
+     * @param options Priority and deadline
+     * @param callback Callback function to call when the resource is loaded (not if cancelled)
+     * @return Request ID for cancelLoad(), or 0 if not found or finished immediately
+     */
+    LoadRequestId requestLoad(const std::string& id, const LoadOptions& options, ResourceCallback callback = nullptr);
+    
+    /**
+     * Cancel an asynchronous load
+     * @param requestId Request ID from requestLoad()
+     * @return true if the request was still in flight
+     */
+    bool cancelLoad(LoadRequestId requestId);
+    
+    /**
+     * Request every resource of a manifest that isn't loaded
+     * Resources the manager doesn't have are skipped; register them first.
+     * Without async loading they load immediately (not counted as hitches).
+     * @param manifest Resources to load
+     * @param options Priority and deadline of the requests
+     * @return Listed resources the manager has, to track progress with
+     */
+    std::vector<std::shared_ptr<Resource>> preload(const PreloadManifest& manifest, const LoadOptions& options = LoadOptions());
+    
+    /**
+     * Start recording the resources that load calls ask for
+     * Every loadResource(), loadResourceAsync(), requestLoad() and preload()
+     * adds its resource, loaded or not, until endManifestRecording().
+     * @param name Manifest name
+     */
+    void beginManifestRecording(const std::string& name);
+    
+    /**
+     * Check if a manifest is being recorded
+     * @return true between beginManifestRecording() and endManifestRecording()
+     */
+    bool isRecordingManifest() const { return m_recordingManifest.load(std::memory_order_relaxed); }
+    
+    /**
+     * Stop recording
+     * @return Recorded manifest (empty if not recording)
+     */
+    PreloadManifest endManifestRecording();
+    
+    /**
+     * Get the number of first-use hitches
+     * @return Synchronous loads through loadResource() since the last reset
+     */
+    uint64_t getFirstUseHitchCount() const { return m_firstUseHitches.load(std::memory_order_relaxed); }
+    
+    /**
+     * Get the resources that caused first-use hitches
+     * @return Resource IDs, in order, since the last reset
+     */
+    std::vector<std::string> getFirstUseHitches() const;
+    
+    /**
+     * Reset the first-use hitch count (e.g. after a scene transition)
+     */
+    void resetFirstUseHitches();
+    
     /**
      * Unload a resource
      * @param id Resource ID
@@ -130,6 +297,8 @@ public:
     
     /**
      * Get all resources of a specific type
+     * Resources are indexed by concrete type; each type's list is included
+     * when its resources derive from T, so base classes match subclasses.
      * @tparam T Resource type
      * @return Vector of resources of the specified type
      */
@@ -137,11 +306,26 @@ public:
     std::vector<std::shared_ptr<T>> getResourcesOfType() const {
         std::vector<std::shared_ptr<T>> result;
         
-        std::lock_guard<std::mutex> lock(m_resourceMutex);
-        for (const auto& pair : m_resources) {
-            auto resource = std::dynamic_pointer_cast<T>(pair.second);
-            if (resource) {
-                result.push_back(resource);
+        TableReader reader(*this);
+        if (std::is_same<T, Resource>::value) {
+            result.reserve(reader.table->slotsById.size());
+            for (const auto& slot : reader.table->slots) {
+                if (slot.resource) {
+                    result.push_back(std::static_pointer_cast<T>(slot.resource));
+                }
+            }
+            return result;
+        }
+        
+        // Every resource in a list has the same concrete type, so the first
+        // one decides whether the list matches
+        for (const auto& entry : reader.table->slotsByType) {
+            const auto& indices = entry.second;
+            if (indices.empty() || !std::dynamic_pointer_cast<T>(reader.table->slots[indices.front()].resource)) {
+                continue;
+            }
+            for (uint32_t index : indices) {
+                result.push_back(std::static_pointer_cast<T>(reader.table->slots[index].resource));
             }
         }
         
@@ -199,6 +383,58 @@ public:
      */
     int getMaxAsyncLoads() const { return m_maxAsyncLoads; }
     
+    /**
+     * Share a job system for decode jobs instead of creating one
+     * SceneManager passes the engine's (SystemManager::getJobSystem()). A
+     * running pipeline is restarted on it, dropping unfinished loads.
+     * @param jobSystem Thread pool (nullptr to create one)
+     */
+    void setJobSystem(std::shared_ptr<Core::ThreadPool> jobSystem);
+    
+    /**
+     * Set the time update() may spend uploading finished loads
+     * @param milliseconds Budget per update
+     */
+    void setUploadBudget(float milliseconds);
+    
+    /**
+     * Get the upload budget
+     * @return Budget per update in milliseconds
+     */
+    float getUploadBudget() const { return m_uploadBudgetMs; }
+    
+    /**
+     * Share a file watcher for hot reloading instead of creating one
+     * Its update() is called from update(), even while hot reloading is
+     * disabled, for every system sharing it.
+     * @param watcher File watcher (nullptr to create one when hot reloading is enabled)
+     */
+    void setFileWatcher(std::shared_ptr<Core::FileWatcher> watcher);
+    
+    /**
+     * Get the file watcher
+     * @return File watcher, or nullptr if hot reloading was never enabled
+     */
+    std::shared_ptr<Core::FileWatcher> getFileWatcher() const { return m_fileWatcher; }
+    
+    /**
+     * Set whether resources reload when their files change (main thread)
+     * @param enable Whether to watch resource files
+     */
+    void enableHotReloading(bool enable);
+    
+    /**
+     * Check if hot reloading is enabled
+     * @return true if resource files are watched
+     */
+    bool isHotReloadingEnabled() const { return m_hotReloadingEnabled; }
+    
+    /**
+     * Get async load pipeline statistics
+     * @return Statistics (empty if async loading is disabled)
+     */
+    ResourcePipelineStats getPipelineStats() const;
+    
     /**
      * Get the number of resources
      * @return Number of resources
@@ -223,6 +459,44 @@ public:
      */
     size_t getFailedResourceCount() const;
     
+    /**
+     * Set the memory budget of a category
+     * Enforced on update(): while a category is over budget, loaded resources
+     * that have no references, are not pinned, were not used this frame and
+     * are not held outside the manager (a shared_ptr kept by e.g. a tileset)
+     * are unloaded, lowest priority and least recently used first.
+     * @param category Resource category
+     * @param bytes Budget in bytes (0 = unlimited)
+     */
+    void setBudget(ResourceCategory category, size_t bytes);
+    
+    /**
+     * Get the memory budget of a category
+     * @param category Resource category
+     * @return Budget in bytes (0 = unlimited)
+     */
+    size_t getBudget(ResourceCategory category) const;
+    
+    /**
+     * Get budget use and eviction counts of a category
+     * @param category Resource category
+     * @return Statistics as of the last update
+     */
+    ResourceBudgetStats getBudgetStats(ResourceCategory category) const;
+    
+    /**
+     * Measure memory use and evict resources from categories over budget
+     * Called by update(); call directly after a burst of loads.
+     * @return Number of resources evicted
+     */
+    size_t enforceBudgets();
+    
+    /**
+     * Get the current frame (advanced by update(), used for LRU ordering)
+     * @return Frame number
+     */
+    uint64_t getFrame() const { return m_frame.load(std::memory_order_relaxed); }
+    
     /**
      * Clear all resources
      */
@@ -236,60 +510,138 @@ public:
     
 private:
     /**
-     * Async load task structure
+     * Resource table slot
      */
-    struct AsyncLoadTask {
-        std::string resourceId;
-        ResourceCallback callback;
-        bool isReload;
-        
-        AsyncLoadTask(const std::string& id, ResourceCallback cb, bool reload = false)
-            : resourceId(id), callback(cb), isReload(reload) {}
+    struct ResourceSlot {
+        std::shared_ptr<Resource> resource;
+        uint32_t generation = 1;
+    };
+    
+    /**
+     * Immutable snapshot of all resources
+     */
+    struct ResourceTable {
+        std::vector<ResourceSlot> slots;
+        std::unordered_map<std::string, uint32_t> slotsById;
+        std::unordered_map<std::type_index, std::vector<uint32_t>> slotsByType;
     };
     
     /**
-     * Async load result structure
+     * Pins the current table for the duration of a lookup
      */
-    struct AsyncLoadResult {
-        std::string resourceId;
-        bool success;
-        ResourceCallback callback;
+    struct TableReader {
+        const ResourceManager& manager;
+        const ResourceTable* table;
+        
+        explicit TableReader(const ResourceManager& owner)
+            : manager(owner)
+        {
+            // Announce the reader before loading the pointer, so a writer
+            // that sees no readers knows nobody holds a retired table
+            manager.m_activeReaders.fetch_add(1);
+            table = manager.m_table.load();
+        }
         
-        AsyncLoadResult(const std::string& id, bool success, ResourceCallback cb)
-            : resourceId(id), success(success), callback(cb) {}
+        ~TableReader() {
+            manager.m_activeReaders.fetch_sub(1);
+        }
+        
+        TableReader(const TableReader&) = delete;
+        TableReader& operator=(const TableReader&) = delete;
     };
     
     /**
-     * Worker thread function
+     * Insert a resource into a table being built
+     * @param table Table copy
+     * @param resource Resource to insert
+     * @return true if inserted (false if the ID exists)
+     */
+    bool insertResource(ResourceTable& table, std::shared_ptr<Resource> resource);
+    
+    /**
+     * Remove a slot from a table being built
+     * @param table Table copy
+     * @param index Slot index
+     */
+    void eraseSlot(ResourceTable& table, uint32_t index);
+    
+    /**
+     * Swap in a new table and retire the old one
+     * Must be called with m_resourceMutex held.
+     * @param table New table (ownership is taken)
+     */
+    void publishTable(ResourceTable* table);
+    
+    /**
+     * Check if anything besides the resource tables holds a resource
+     * Must be called with m_resourceMutex held.
+     * @param resource Resource from the current table
+     * @return true if a shared_ptr to it is kept outside the manager
+     */
+    bool hasOutsideOwners(const std::shared_ptr<Resource>& resource) const;
+    
+    /**
+     * Add a resource to the manifest being recorded, if any
+     * @param resource Resource a load call asked for
+     */
+    void recordUse(const Resource& resource);
+    
+    /**
+     * Load a resource on the calling thread
+     * @param resource Resource
+     * @param callback Callback function to call when the resource is loaded
+     * @return true if the resource loaded
      */
-    void workerThreadFunc();
+    bool loadNow(const std::shared_ptr<Resource>& resource, const ResourceCallback& callback);
     
     /**
-     * Process completed async loads
+     * Watch files of added resources and stop watching removed ones
+     * Only runs when the table changed since the last call.
      */
-    void processCompletedAsyncLoads();
+    void syncFileWatches();
     
     /**
-     * Queue an async load task
-     * @param task Async load task
+     * Free retired tables if no lookup is in progress
+     * Must be called with m_resourceMutex held.
      */
-    void queueAsyncLoadTask(const AsyncLoadTask& task);
+    void reclaimRetiredTables();
     
     // Resources
-    mutable std::mutex m_resourceMutex;
-    std::unordered_map<std::string, std::shared_ptr<Resource>> m_resources;
+    mutable std::mutex m_resourceMutex;   // Serializes writers
+    std::atomic<const ResourceTable*> m_table;
+    std::atomic<uint64_t> m_tableVersion;   // Bumped by publishTable()
+    mutable std::atomic<int> m_activeReaders;
+    std::vector<const ResourceTable*> m_retiredTables;
+    std::vector<uint32_t> m_freeSlots;
+    
+    // Memory budgets (guarded by m_resourceMutex)
+    ResourceBudgetStats m_budgets[static_cast<size_t>(ResourceCategory::Count)];
+    std::atomic<uint64_t> m_frame;
     
     // Async loading
     bool m_asyncLoadingEnabled;
     int m_maxAsyncLoads;
-    std::atomic<bool> m_shutdownThreads;
-    std::vector<std::thread> m_workerThreads;
-    std::mutex m_taskQueueMutex;
-    std::condition_variable m_taskQueueCondition;
-    std::queue<AsyncLoadTask> m_taskQueue;
-    std::mutex m_resultQueueMutex;
-    std::queue<AsyncLoadResult> m_resultQueue;
-    std::atomic<int> m_activeAsyncLoads;
+    std::shared_ptr<Core::ThreadPool> m_jobSystem;
+    bool m_ownsJobSystem;
+    std::unique_ptr<ResourceLoadPipeline> m_pipeline;
+    float m_uploadBudgetMs;
+    
+    // Hot reloading (main thread)
+    struct ResourceWatch {
+        std::string path;
+        uint64_t watchId = 0;
+    };
+    std::shared_ptr<Core::FileWatcher> m_fileWatcher;
+    bool m_hotReloadingEnabled;
+    std::unordered_map<std::string, ResourceWatch> m_resourceWatches;
+    uint64_t m_watchedTableVersion;
+    
+    // First-use hitches and manifest recording
+    mutable std::mutex m_usageMutex;
+    std::atomic<uint64_t> m_firstUseHitches;
+    std::vector<std::string> m_hitchIds;            // Guarded by m_usageMutex
+    std::atomic<bool> m_recordingManifest;
+    PreloadManifest m_recording;                    // Guarded by m_usageMutex
     
     // Base path
     std::string m_basePath;
@@ -0,0 +1,698 @@
+#include "TextureCooker.h"
+#include "../third_party/stb_image.h"
+#include <iostream>
+#include <fstream>
+#include <algorithm>
+#include <cstring>
+#include <cmath>
+
+namespace RPGEngine {
+namespace Resources {
+
+namespace {
+
+// ETC1/ETC2 intensity modifiers: {small, large} per table
+const int ETC_MODIFIERS[8][2] = {
+    {2, 8}, {5, 17}, {9, 29}, {13, 42}, {18, 60}, {24, 80}, {33, 106}, {47, 183}
+};
+
+// EAC alpha modifiers per table, indexed by the 3-bit pixel index
+const int EAC_MODIFIERS[16][8] = {
+    {-3, -6, -9, -15, 2, 5, 8, 14}, {-3, -7, -10, -13, 2, 6, 9, 12},
+    {-2, -5, -8, -13, 1, 4, 7, 12}, {-2, -4, -6, -13, 1, 3, 5, 12},
+    {-3, -6, -8, -12, 2, 5, 7, 11}, {-3, -7, -9, -11, 2, 6, 8, 10},
+    {-4, -7, -8, -11, 3, 6, 7, 10}, {-3, -5, -8, -11, 2, 4, 7, 10},
+    {-2, -6, -8, -10, 1, 5, 7, 9}, {-2, -5, -8, -10, 1, 4, 7, 9},
+    {-2, -4, -8, -10, 1, 3, 7, 9}, {-2, -5, -7, -10, 1, 4, 6, 9},
+    {-3, -4, -7, -10, 2, 3, 6, 9}, {-1, -2, -3, -10, 0, 1, 2, 9},
+    {-4, -6, -8, -9, 3, 5, 7, 8}, {-3, -5, -7, -9, 2, 4, 6, 8}
+};
+
+// 4x4 block of RGBA pixels, row by row
+using Block = uint8_t[16][4];
+
+int clampByte(int value) {
+    return value < 0 ? 0 : (value > 255 ? 255 : value);
+}
+
+void fetchBlock(const uint8_t* rgba, int width, int height, int bx, int by, Block block) {
+    for (int y = 0; y < 4; ++y) {
+        for (int x = 0; x < 4; ++x) {
+            // Edge blocks repeat the last row and column
+            int sx = std::min(bx * 4 + x, width - 1);
+            int sy = std::min(by * 4 + y, height - 1);
+            std::memcpy(block[y * 4 + x], rgba + (static_cast<size_t>(sy) * width + sx) * 4, 4);
+        }
+    }
+}
+
+void storeBlock(uint8_t* rgba, int width, int height, int bx, int by, const Block block) {
+    for (int y = 0; y < 4; ++y) {
+        for (int x = 0; x < 4; ++x) {
+            int dx = bx * 4 + x;
+            int dy = by * 4 + y;
+            if (dx < width && dy < height) {
+                std::memcpy(rgba + (static_cast<size_t>(dy) * width + dx) * 4, block[y * 4 + x], 4);
+            }
+        }
+    }
+}
+
+int colorError(const uint8_t* a, const int* b) {
+    int dr = a[0] - b[0];
+    int dg = a[1] - b[1];
+    int db = a[2] - b[2];
+    return dr * dr + dg * dg + db * db;
+}
+
+// --- BC1 / BC3 ---
+
+uint16_t to565(const float* color) {
+    int r = clampByte(static_cast<int>(color[0] + 0.5f));
+    int g = clampByte(static_cast<int>(color[1] + 0.5f));
+    int b = clampByte(static_cast<int>(color[2] + 0.5f));
+    return static_cast<uint16_t>(((r * 31 + 127) / 255) << 11 | ((g * 63 + 127) / 255) << 5 | ((b * 31 + 127) / 255));
+}
+
+void from565(uint16_t color, int* out) {
+    int r = (color >> 11) & 31;
+    int g = (color >> 5) & 63;
+    int b = color & 31;
+    out[0] = (r << 3) | (r >> 2);
+    out[1] = (g << 2) | (g >> 4);
+    out[2] = (b << 3) | (b >> 2);
+}
+
+void bcPalette(uint16_t c0, uint16_t c1, bool fourColor, int palette[4][3]) {
+    from565(c0, palette[0]);
+    from565(c1, palette[1]);
+    for (int c = 0; c < 3; ++c) {
+        if (fourColor) {
+            palette[2][c] = (2 * palette[0][c] + palette[1][c]) / 3;
+            palette[3][c] = (palette[0][c] + 2 * palette[1][c]) / 3;
+        } else {
+            palette[2][c] = (palette[0][c] + palette[1][c]) / 2;
+            palette[3][c] = 0;
+        }
+    }
+}
+
+void encodeBCColor(const Block block, uint8_t* out) {
+    // Endpoints at the extremes of the block along its principal axis
+    float mean[3] = {0, 0, 0};
+    for (int i = 0; i < 16; ++i) {
+        for (int c = 0; c < 3; ++c) {
+            mean[c] += block[i][c] / 16.0f;
+        }
+    }
+    float cov[6] = {0, 0, 0, 0, 0, 0};
+    for (int i = 0; i < 16; ++i) {
+        float r = block[i][0] - mean[0];
+        float g = block[i][1] - mean[1];
+        float b = block[i][2] - mean[2];
+        cov[0] += r * r; cov[1] += r * g; cov[2] += r * b;
+        cov[3] += g * g; cov[4] += g * b; cov[5] += b * b;
+    }
+    float axis[3] = {1, 1, 1};
+    for (int iteration = 0; iteration < 4; ++iteration) {
+        float x = cov[0] * axis[0] + cov[1] * axis[1] + cov[2] * axis[2];
+        float y = cov[1] * axis[0] + cov[3] * axis[1] + cov[4] * axis[2];
+        float z = cov[2] * axis[0] + cov[4] * axis[1] + cov[5] * axis[2];
+        float length = std::max(std::max(std::fabs(x), std::fabs(y)), std::fabs(z));
+        if (length < 1e-6f) {
+            break;
+        }
+        axis[0] = x / length; axis[1] = y / length; axis[2] = z / length;
+    }
+    float lengthSq = axis[0] * axis[0] + axis[1] * axis[1] + axis[2] * axis[2];
+
+    float minT = 0, maxT = 0;
+    for (int i = 0; i < 16; ++i) {
+        float t = ((block[i][0] - mean[0]) * axis[0] + (block[i][1] - mean[1]) * axis[1] +
+                   (block[i][2] - mean[2]) * axis[2]) / lengthSq;
+        minT = std::min(minT, t);
+        maxT = std::max(maxT, t);
+    }
+    float high[3], low[3];
+    for (int c = 0; c < 3; ++c) {
+        high[c] = mean[c] + axis[c] * maxT;
+        low[c] = mean[c] + axis[c] * minT;
+    }
+
+    uint16_t c0 = to565(high);
+    uint16_t c1 = to565(low);
+    if (c0 < c1) {
+        std::swap(c0, c1);
+    }
+
+    // c0 > c1 selects the four color mode; equal endpoints only need index 0
+    uint32_t indices = 0;
+    if (c0 != c1) {
+        int palette[4][3];
+        bcPalette(c0, c1, true, palette);
+        for (int i = 0; i < 16; ++i) {
+            int best = 0;
+            int bestError = colorError(block[i], palette[0]);
+            for (int p = 1; p < 4; ++p) {
+                int error = colorError(block[i], palette[p]);
+                if (error < bestError) {
+                    bestError = error;
+                    best = p;
+                }
+            }
+            indices |= static_cast<uint32_t>(best) << (i * 2);
+        }
+    }
+
+    out[0] = static_cast<uint8_t>(c0); out[1] = static_cast<uint8_t>(c0 >> 8);
+    out[2] = static_cast<uint8_t>(c1); out[3] = static_cast<uint8_t>(c1 >> 8);
+    for (int i = 0; i < 4; ++i) {
+        out[4 + i] = static_cast<uint8_t>(indices >> (i * 8));
+    }
+}
+
+void decodeBCColor(const uint8_t* in, Block block, bool alwaysFourColor) {
+    uint16_t c0 = static_cast<uint16_t>(in[0] | in[1] << 8);
+    uint16_t c1 = static_cast<uint16_t>(in[2] | in[3] << 8);
+    uint32_t indices = in[4] | in[5] << 8 | in[6] << 16 | static_cast<uint32_t>(in[7]) << 24;
+
+    int palette[4][3];
+    bool fourColor = alwaysFourColor || c0 > c1;
+    bcPalette(c0, c1, fourColor, palette);
+    for (int i = 0; i < 16; ++i) {
+        int index = (indices >> (i * 2)) & 3;
+        for (int c = 0; c < 3; ++c) {
+            block[i][c] = static_cast<uint8_t>(palette[index][c]);
+        }
+        block[i][3] = (!fourColor && index == 3) ? 0 : 255;
+    }
+}
+
+void bcAlphaPalette(int a0, int a1, int palette[8]) {
+    palette[0] = a0;
+    palette[1] = a1;
+    if (a0 > a1) {
+        for (int i = 1; i < 7; ++i) {
+            palette[i + 1] = ((7 - i) * a0 + i * a1) / 7;
+        }
+    } else {
+        for (int i = 1; i < 5; ++i) {
+            palette[i + 1] = ((5 - i) * a0 + i * a1) / 5;
+        }
+        palette[6] = 0;
+        palette[7] = 255;
+    }
+}
+
+void encodeBCAlpha(const Block block, uint8_t* out) {
+    int a0 = 0, a1 = 255;
+    for (int i = 0; i < 16; ++i) {
+        a0 = std::max(a0, static_cast<int>(block[i][3]));
+        a1 = std::min(a1, static_cast<int>(block[i][3]));
+    }
+
+    uint64_t indices = 0;
+    if (a0 != a1) {
+        int palette[8];
+        bcAlphaPalette(a0, a1, palette);
+        for (int i = 0; i < 16; ++i) {
+            int best = 0;
+            for (int p = 1; p < 8; ++p) {
+                if (std::abs(palette[p] - block[i][3]) < std::abs(palette[best] - block[i][3])) {
+                    best = p;
+                }
+            }
+            indices |= static_cast<uint64_t>(best) << (i * 3);
+        }
+    }
+
+    out[0] = static_cast<uint8_t>(a0);
+    out[1] = static_cast<uint8_t>(a1);
+    for (int i = 0; i < 6; ++i) {
+        out[2 + i] = static_cast<uint8_t>(indices >> (i * 8));
+    }
+}
+
+void decodeBCAlpha(const uint8_t* in, Block block) {
+    int palette[8];
+    bcAlphaPalette(in[0], in[1], palette);
+    uint64_t indices = 0;
+    for (int i = 0; i < 6; ++i) {
+        indices |= static_cast<uint64_t>(in[2 + i]) << (i * 8);
+    }
+    for (int i = 0; i < 16; ++i) {
+        block[i][3] = static_cast<uint8_t>(palette[(indices >> (i * 3)) & 7]);
+    }
+}
+
+// --- ETC2 (individual and differential modes) and EAC alpha ---
+
+// ETC orders pixels column by column; block[] is row by row
+int etcPixel(int i) {
+    return (i & 3) * 4 + (i >> 2);
+}
+
+bool inSubblock(int i, bool flip, int subblock) {
+    int x = i >> 2;
+    int y = i & 3;
+    return (flip ? y / 2 : x / 2) == subblock;
+}
+
+/**
+ * Pick the modifier table of a subblock
+ * @return Squared error with that table; indices receives the pixel indices
+ */
+int fitEtcSubblock(const Block block, bool flip, int subblock, const int* base, int& table, uint32_t& indices) {
+    int bestTotal = -1;
+    uint32_t bestIndices = 0;
+    for (int t = 0; t < 8; ++t) {
+        const int modifiers[4] = {ETC_MODIFIERS[t][0], ETC_MODIFIERS[t][1], -ETC_MODIFIERS[t][0], -ETC_MODIFIERS[t][1]};
+        int total = 0;
+        uint32_t tableIndices = 0;
+        for (int i = 0; i < 16; ++i) {
+            if (!inSubblock(i, flip, subblock)) {
+                continue;
+            }
+            const uint8_t* pixel = block[etcPixel(i)];
+            int bestError = -1;
+            int bestIndex = 0;
+            for (int m = 0; m < 4; ++m) {
+                int candidate[3] = {clampByte(base[0] + modifiers[m]), clampByte(base[1] + modifiers[m]),
+                                    clampByte(base[2] + modifiers[m])};
+                int error = colorError(pixel, candidate);
+                if (bestError < 0 || error < bestError) {
+                    bestError = error;
+                    bestIndex = m;
+                }
+            }
+            total += bestError;
+            tableIndices |= static_cast<uint32_t>(bestIndex >> 1) << (16 + i) | static_cast<uint32_t>(bestIndex & 1) << i;
+        }
+        if (bestTotal < 0 || total < bestTotal) {
+            bestTotal = total;
+            table = t;
+            bestIndices = tableIndices;
+        }
+    }
+    indices |= bestIndices;
+    return bestTotal;
+}
+
+void encodeEtcColor(const Block block, uint8_t* out) {
+    uint64_t bestWord = 0;
+    int bestError = -1;
+
+    for (int flip = 0; flip < 2; ++flip) {
+        float average[2][3] = {{0, 0, 0}, {0, 0, 0}};
+        for (int i = 0; i < 16; ++i) {
+            int subblock = inSubblock(i, flip != 0, 0) ? 0 : 1;
+            for (int c = 0; c < 3; ++c) {
+                average[subblock][c] += block[etcPixel(i)][c] / 8.0f;
+            }
+        }
+
+        for (int differential = 0; differential < 2; ++differential) {
+            int quantized[2][3];
+            int base[2][3];
+            for (int s = 0; s < 2; ++s) {
+                for (int c = 0; c < 3; ++c) {
+                    if (differential) {
+                        quantized[s][c] = static_cast<int>(average[s][c] * 31.0f / 255.0f + 0.5f);
+                        base[s][c] = (quantized[s][c] << 3) | (quantized[s][c] >> 2);
+                    } else {
+                        quantized[s][c] = static_cast<int>(average[s][c] * 15.0f / 255.0f + 0.5f);
+                        base[s][c] = quantized[s][c] * 17;
+                    }
+                }
+            }
+            if (differential) {
+                bool fits = true;
+                for (int c = 0; c < 3; ++c) {
+                    int delta = quantized[1][c] - quantized[0][c];
+                    fits &= delta >= -4 && delta <= 3;
+                }
+                if (!fits) {
+                    continue;
+                }
+            }
+
+            int table[2] = {0, 0};
+            uint32_t indices = 0;
+            int error = fitEtcSubblock(block, flip != 0, 0, base[0], table[0], indices) +
+                        fitEtcSubblock(block, flip != 0, 1, base[1], table[1], indices);
+            if (bestError >= 0 && error >= bestError) {
+                continue;
+            }
+
+            uint64_t word = 0;
+            for (int c = 0; c < 3; ++c) {
+                int shift = 56 - c * 8;
+                if (differential) {
+                    int delta = (quantized[1][c] - quantized[0][c]) & 7;
+                    word |= static_cast<uint64_t>(quantized[0][c] << 3 | delta) << shift;
+                } else {
+                    word |= static_cast<uint64_t>(quantized[0][c] << 4 | quantized[1][c]) << shift;
+                }
+            }
+            word |= static_cast<uint64_t>(table[0]) << 37 | static_cast<uint64_t>(table[1]) << 34;
+            word |= static_cast<uint64_t>(differential) << 33 | static_cast<uint64_t>(flip) << 32;
+            word |= indices;
+
+            bestError = error;
+            bestWord = word;
+        }
+    }
+
+    for (int i = 0; i < 8; ++i) {
+        out[i] = static_cast<uint8_t>(bestWord >> (56 - i * 8));
+    }
+}
+
+void decodeEtcColor(const uint8_t* in, Block block) {
+    uint64_t word = 0;
+    for (int i = 0; i < 8; ++i) {
+        word = word << 8 | in[i];
+    }
+    bool differential = (word >> 33) & 1;
+    bool flip = (word >> 32) & 1;
+
+    int base[2][3];
+    for (int c = 0; c < 3; ++c) {
+        int bits = static_cast<int>((word >> (56 - c * 8)) & 0xFF);
+        if (differential) {
+            int first = bits >> 3;
+            int delta = bits & 7;
+            int second = first + (delta >= 4 ? delta - 8 : delta);
+            base[0][c] = (first << 3) | (first >> 2);
+            base[1][c] = (second << 3) | (second >> 2);
+        } else {
+            base[0][c] = (bits >> 4) * 17;
+            base[1][c] = (bits & 15) * 17;
+        }
+    }
+    int table[2] = {static_cast<int>((word >> 37) & 7), static_cast<int>((word >> 34) & 7)};
+
+    for (int i = 0; i < 16; ++i) {
+        int subblock = inSubblock(i, flip, 0) ? 0 : 1;
+        int index = static_cast<int>(((word >> (16 + i)) & 1) << 1 | ((word >> i) & 1));
+        int modifier = ETC_MODIFIERS[table[subblock]][index & 1];
+        if (index & 2) {
+            modifier = -modifier;
+        }
+        uint8_t* pixel = block[etcPixel(i)];
+        for (int c = 0; c < 3; ++c) {
+            pixel[c] = static_cast<uint8_t>(clampByte(base[subblock][c] + modifier));
+        }
+        pixel[3] = 255;
+    }
+}
+
+void encodeEacAlpha(const Block block, uint8_t* out) {
+    int minAlpha = 255, maxAlpha = 0;
+    for (int i = 0; i < 16; ++i) {
+        minAlpha = std::min(minAlpha, static_cast<int>(block[i][3]));
+        maxAlpha = std::max(maxAlpha, static_cast<int>(block[i][3]));
+    }
+
+    uint64_t bestWord = 0;
+    int bestError = -1;
+    for (int t = 0; t < 16; ++t) {
+        const int* modifiers = EAC_MODIFIERS[t];
+        int low = modifiers[3];
+        int high = modifiers[7];
+
+        // Spread the table over the block's range, trying neighbouring multipliers too
+        int fitted = (maxAlpha - minAlpha + (high - low) - 1) / (high - low);
+        for (int multiplier = std::max(1, fitted - 1); multiplier <= std::min(15, fitted + 1); ++multiplier) {
+            int base = clampByte(minAlpha - low * multiplier);
+            if (maxAlpha == minAlpha) {
+                base = minAlpha;
+            }
+
+            int error = 0;
+            uint64_t indices = 0;
+            for (int i = 0; i < 16; ++i) {
+                int alpha = block[etcPixel(i)][3];
+                int bestIndex = 0;
+                int bestPixelError = -1;
+                for (int m = 0; m < 8; ++m) {
+                    int diff = clampByte(base + modifiers[m] * multiplier) - alpha;
+                    if (bestPixelError < 0 || diff * diff < bestPixelError) {
+                        bestPixelError = diff * diff;
+                        bestIndex = m;
+                    }
+                }
+                error += bestPixelError;
+                indices |= static_cast<uint64_t>(bestIndex) << (45 - i * 3);
+            }
+
+            if (bestError < 0 || error < bestError) {
+                bestError = error;
+                bestWord = static_cast<uint64_t>(base) << 56 | static_cast<uint64_t>(multiplier) << 52 |
+                           static_cast<uint64_t>(t) << 48 | indices;
+            }
+        }
+        if (bestError == 0) {
+            break;
+        }
+    }
+
+    for (int i = 0; i < 8; ++i) {
+        out[i] = static_cast<uint8_t>(bestWord >> (56 - i * 8));
+    }
+}
+
+void decodeEacAlpha(const uint8_t* in, Block block) {
+    uint64_t word = 0;
+    for (int i = 0; i < 8; ++i) {
+        word = word << 8 | in[i];
+    }
+    int base = static_cast<int>(word >> 56);
+    int multiplier = static_cast<int>((word >> 52) & 15);
+    const int* modifiers = EAC_MODIFIERS[(word >> 48) & 15];
+    for (int i = 0; i < 16; ++i) {
+        int index = static_cast<int>((word >> (45 - i * 3)) & 7);
+        block[etcPixel(i)][3] = static_cast<uint8_t>(clampByte(base + modifiers[index] * multiplier));
+    }
+}
+
+bool isOpaque(const std::vector<uint8_t>& rgba) {
+    for (size_t i = 3; i < rgba.size(); i += 4) {
+        if (rgba[i] != 255) {
+            return false;
+        }
+    }
+    return true;
+}
+
+double computePsnr(const std::vector<uint8_t>& a, const std::vector<uint8_t>& b) {
+    double sum = 0.0;
+    for (size_t i = 0; i < a.size(); ++i) {
+        double diff = static_cast<double>(a[i]) - b[i];
+        sum += diff * diff;
+    }
+    if (sum == 0.0) {
+        return 0.0;
+    }
+    double mse = sum / static_cast<double>(a.size());
+    return 10.0 * std::log10(255.0 * 255.0 / mse);
+}
+
+} // anonymous namespace
+
+TextureCooker::TextureCooker(const TextureCookOptions& options)
+    : m_options(options)
+{
+}
+
+bool TextureCooker::cook(const uint8_t* rgba, int width, int height, std::vector<uint8_t>& output) {
+    if (!rgba || width <= 0 || height <= 0) {
+        std::cerr << "Cannot cook an empty texture" << std::endl;
+        return false;
+    }
+
+    std::vector<uint8_t> pixels(rgba, rgba + static_cast<size_t>(width) * height * 4);
+    if (m_options.premultiplyAlpha) {
+        premultiplyAlpha(pixels);
+    }
+
+    CookedTextureFormat format = CookedTextureFormat::RGBA8;
+    bool opaque = isOpaque(pixels);
+    if (m_options.format == TextureCookFormat::BC) {
+        format = opaque ? CookedTextureFormat::BC1 : CookedTextureFormat::BC3;
+    } else if (m_options.format == TextureCookFormat::ETC2) {
+        format = opaque ? CookedTextureFormat::ETC2_RGB8 : CookedTextureFormat::ETC2_RGBA8;
+    }
+
+    m_stats = TextureCookStats();
+    m_stats.width = width;
+    m_stats.height = height;
+    m_stats.format = format;
+
+    // Encode every level, halving until 1x1
+    std::vector<CookedTextureLevel> levels;
+    std::vector<std::vector<uint8_t>> levelData;
+    int levelWidth = width;
+    int levelHeight = height;
+    while (true) {
+        levelData.push_back(encode(format, pixels.data(), levelWidth, levelHeight));
+        levels.push_back({static_cast<uint32_t>(levelWidth), static_cast<uint32_t>(levelHeight), 0, levelData.back().size()});
+        m_stats.uncompressedBytes += static_cast<uint64_t>(levelWidth) * levelHeight * 4;
+        m_stats.cookedBytes += levelData.back().size();
+
+        if (levels.size() == 1 && isCompressedFormat(format)) {
+            m_stats.psnr = computePsnr(pixels, decode(format, levelData.back().data(), levelWidth, levelHeight));
+        }
+        if (!m_options.generateMipmaps || (levelWidth == 1 && levelHeight == 1)) {
+            break;
+        }
+        pixels = downsample(pixels, levelWidth, levelHeight);
+    }
+    m_stats.levels = static_cast<int>(levels.size());
+
+    // Header, level table, then 16-byte aligned level data
+    size_t offset = sizeof(CookedTextureHeader) + levels.size() * sizeof(CookedTextureLevel);
+    for (auto& level : levels) {
+        offset = (offset + 15) & ~static_cast<size_t>(15);
+        level.offset = offset;
+        offset += static_cast<size_t>(level.size);
+    }
+
+    CookedTextureHeader header;
+    std::memcpy(header.magic, COOKED_TEXTURE_MAGIC, 4);
+    header.version = COOKED_TEXTURE_VERSION;
+    header.format = static_cast<uint32_t>(format);
+    header.flags = m_options.premultiplyAlpha ? static_cast<uint32_t>(COOKED_TEXTURE_PREMULTIPLIED) : 0;
+    header.width = static_cast<uint32_t>(width);
+    header.height = static_cast<uint32_t>(height);
+    header.levelCount = static_cast<uint32_t>(levels.size());
+    header.reserved = 0;
+
+    output.assign(offset, 0);
+    std::memcpy(output.data(), &header, sizeof(header));
+    std::memcpy(output.data() + sizeof(header), levels.data(), levels.size() * sizeof(CookedTextureLevel));
+    for (size_t i = 0; i < levels.size(); ++i) {
+        std::memcpy(output.data() + levels[i].offset, levelData[i].data(), levelData[i].size());
+    }
+    return true;
+}
+
+bool TextureCooker::cookFile(const std::string& inputPath, const std::string& outputPath) {
+    std::ifstream input(inputPath, std::ios::binary);
+    if (!input.is_open()) {
+        std::cerr << "Failed to open image: " << inputPath << std::endl;
+        return false;
+    }
+    std::vector<uint8_t> file((std::istreambuf_iterator<char>(input)), std::istreambuf_iterator<char>());
+
+    int width, height, channels;
+    unsigned char* rgba = stbi_load_from_memory(file.data(), static_cast<int>(file.size()), &width, &height, &channels, 4);
+    if (!rgba) {
+        std::cerr << "Failed to decode image: " << inputPath << " (" << stbi_failure_reason() << ")" << std::endl;
+        return false;
+    }
+
+    std::vector<uint8_t> cooked;
+    bool success = cook(rgba, width, height, cooked);
+    stbi_image_free(rgba);
+    if (!success) {
+        return false;
+    }
+
+    std::ofstream output(outputPath, std::ios::binary | std::ios::trunc);
+    if (!output.is_open() || !output.write(reinterpret_cast<const char*>(cooked.data()), static_cast<std::streamsize>(cooked.size()))) {
+        std::cerr << "Failed to write cooked texture: " << outputPath << std::endl;
+        return false;
+    }
+    return true;
+}
+
+void TextureCooker::premultiplyAlpha(std::vector<uint8_t>& rgba) {
+    for (size_t i = 0; i + 3 < rgba.size(); i += 4) {
+        int alpha = rgba[i + 3];
+        for (int c = 0; c < 3; ++c) {
+            rgba[i + c] = static_cast<uint8_t>((rgba[i + c] * alpha + 127) / 255);
+        }
+    }
+}
+
+std::vector<uint8_t> TextureCooker::downsample(const std::vector<uint8_t>& rgba, int& width, int& height) {
+    int newWidth = std::max(1, width / 2);
+    int newHeight = std::max(1, height / 2);
+    std::vector<uint8_t> result(static_cast<size_t>(newWidth) * newHeight * 4);
+
+    for (int y = 0; y < newHeight; ++y) {
+        int y0 = std::min(y * 2, height - 1);
+        int y1 = std::min(y * 2 + 1, height - 1);
+        for (int x = 0; x < newWidth; ++x) {
+            int x0 = std::min(x * 2, width - 1);
+            int x1 = std::min(x * 2 + 1, width - 1);
+            for (int c = 0; c < 4; ++c) {
+                int sum = rgba[(static_cast<size_t>(y0) * width + x0) * 4 + c] + rgba[(static_cast<size_t>(y0) * width + x1) * 4 + c] +
+                          rgba[(static_cast<size_t>(y1) * width + x0) * 4 + c] + rgba[(static_cast<size_t>(y1) * width + x1) * 4 + c];
+                result[(static_cast<size_t>(y) * newWidth + x) * 4 + c] = static_cast<uint8_t>((sum + 2) / 4);
+            }
+        }
+    }
+
+    width = newWidth;
+    height = newHeight;
+    return result;
+}
+
+std::vector<uint8_t> TextureCooker::encode(CookedTextureFormat format, const uint8_t* rgba, int width, int height) {
+    if (format == CookedTextureFormat::RGBA8) {
+        return std::vector<uint8_t>(rgba, rgba + static_cast<size_t>(width) * height * 4);
+    }
+
+    std::vector<uint8_t> data(cookedLevelSize(format, width, height));
+    const int blocksX = (width + 3) / 4;
+    const int blocksY = (height + 3) / 4;
+    const size_t blockSize = (format == CookedTextureFormat::BC1 || format == CookedTextureFormat::ETC2_RGB8) ? 8 : 16;
+
+    Block block;
+    for (int by = 0; by < blocksY; ++by) {
+        for (int bx = 0; bx < blocksX; ++bx) {
+            fetchBlock(rgba, width, height, bx, by, block);
+            uint8_t* out = data.data() + (static_cast<size_t>(by) * blocksX + bx) * blockSize;
+            switch (format) {
+                case CookedTextureFormat::BC1: encodeBCColor(block, out); break;
+                case CookedTextureFormat::BC3: encodeBCAlpha(block, out); encodeBCColor(block, out + 8); break;
+                case CookedTextureFormat::ETC2_RGB8: encodeEtcColor(block, out); break;
+                case CookedTextureFormat::ETC2_RGBA8: encodeEacAlpha(block, out); encodeEtcColor(block, out + 8); break;
+                default: break;
+            }
+        }
+    }
+    return data;
+}
+
+std::vector<uint8_t> TextureCooker::decode(CookedTextureFormat format, const uint8_t* data, int width, int height) {
+    if (format == CookedTextureFormat::RGBA8) {
+        return std::vector<uint8_t>(data, data + static_cast<size_t>(width) * height * 4);
+    }
+
+    std::vector<uint8_t> rgba(static_cast<size_t>(width) * height * 4);
+    const int blocksX = (width + 3) / 4;
+    const int blocksY = (height + 3) / 4;
+    const size_t blockSize = (format == CookedTextureFormat::BC1 || format == CookedTextureFormat::ETC2_RGB8) ? 8 : 16;
+
+    Block block;
+    for (int by = 0; by < blocksY; ++by) {
+        for (int bx = 0; bx < blocksX; ++bx) {
+            const uint8_t* in = data + (static_cast<size_t>(by) * blocksX + bx) * blockSize;
+            switch (format) {
+                case CookedTextureFormat::BC1: decodeBCColor(in, block, false); break;
+                case CookedTextureFormat::BC3: decodeBCColor(in + 8, block, true); decodeBCAlpha(in, block); break;
+                case CookedTextureFormat::ETC2_RGB8: decodeEtcColor(in, block); break;
+                case CookedTextureFormat::ETC2_RGBA8: decodeEtcColor(in + 8, block); decodeEacAlpha(in, block); break;
+                default: break;
+            }
+            storeBlock(rgba.data(), width, height, bx, by, block);
+        }
+    }
+    return rgba;
+}
+
+} // namespace Resources
+} // namespace RPGEngine
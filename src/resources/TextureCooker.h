@@ -0,0 +1,127 @@
+#pragma once
+
+#include "CookedTexture.h"
+#include <string>
+#include <vector>
+#include <cstdint>
+
+namespace RPGEngine {
+namespace Resources {
+
+/**
+ * Output format family
+ * BC and ETC2 pick their opaque format (BC1, ETC2_RGB8) when every pixel
+ * is opaque and their alpha format (BC3, ETC2_RGBA8) otherwise.
+ */
+enum class TextureCookFormat {
+    RGBA8,      // Uncompressed
+    BC,         // Desktop GPUs
+    ETC2        // Mobile and GLES 3 GPUs
+};
+
+/**
+ * Texture cooking options
+ */
+struct TextureCookOptions {
+    TextureCookFormat format = TextureCookFormat::RGBA8;
+    bool premultiplyAlpha = true;       // Also makes mip filtering correct at transparent edges
+    bool generateMipmaps = true;
+};
+
+/**
+ * Statistics of the last cook
+ */
+struct TextureCookStats {
+    int width = 0;
+    int height = 0;
+    int levels = 0;
+    CookedTextureFormat format = CookedTextureFormat::RGBA8;
+    uint64_t uncompressedBytes = 0;     // RGBA8 with the same mip chain
+    uint64_t cookedBytes = 0;           // Level data written
+    double psnr = 0.0;                  // Of the full-size level after compression (dB, 0 if lossless)
+};
+
+/**
+ * Offline texture cooker
+ * Turns decoded images into cooked textures (see CookedTexture.h):
+ * premultiplied alpha, a box-filtered mip chain and, optionally, BC or
+ * ETC2 block compression, so the runtime uploads without decoding.
+ *
+ * The block encoders favour speed over quality: endpoints along the
+ * principal axis for BC, average colors with the best modifier table for
+ * ETC2 (individual and differential modes only).
+ */
+class TextureCooker {
+public:
+    /**
+     * Constructor
+     * @param options Cooking options
+     */
+    explicit TextureCooker(const TextureCookOptions& options = TextureCookOptions());
+
+    /**
+     * Cook RGBA8 pixels
+     * @param rgba Pixels, row by row, 4 bytes each (straight alpha)
+     * @param width Width
+     * @param height Height
+     * @param output Receives the cooked texture file
+     * @return true if the texture was cooked
+     */
+    bool cook(const uint8_t* rgba, int width, int height, std::vector<uint8_t>& output);
+
+    /**
+     * Cook an image file (any format stb_image reads)
+     * @param inputPath Image to read
+     * @param outputPath Cooked texture to write
+     * @return true if the texture was written
+     */
+    bool cookFile(const std::string& inputPath, const std::string& outputPath);
+
+    /**
+     * Get statistics of the last cook
+     * @return Statistics
+     */
+    const TextureCookStats& getStats() const { return m_stats; }
+
+    /**
+     * Premultiply color by alpha in place
+     * @param rgba Pixels
+     */
+    static void premultiplyAlpha(std::vector<uint8_t>& rgba);
+
+    /**
+     * Halve an image with a 2x2 box filter
+     * @param rgba Pixels
+     * @param width Width (receives the new width)
+     * @param height Height (receives the new height)
+     * @return Downsampled pixels
+     */
+    static std::vector<uint8_t> downsample(const std::vector<uint8_t>& rgba, int& width, int& height);
+
+    /**
+     * Encode one level
+     * @param format Output format
+     * @param rgba Pixels
+     * @param width Width
+     * @param height Height
+     * @return Encoded data, cookedLevelSize() bytes
+     */
+    static std::vector<uint8_t> encode(CookedTextureFormat format, const uint8_t* rgba, int width, int height);
+
+    /**
+     * Decode one level back to RGBA8 (for quality checks)
+     * @param format Data format
+     * @param data Encoded data
+     * @param width Width
+     * @param height Height
+     * @return Pixels
+     */
+    static std::vector<uint8_t> decode(CookedTextureFormat format, const uint8_t* data, int width, int height);
+
+private:
+    TextureCookOptions m_options;
+    TextureCookStats m_stats;
+};
+
+} // namespace Resources
+} // namespace RPGEngine
@@ -1,5 +1,6 @@
 #include "TextureResource.h"
 #include "GLFunctions.h"
+#include "VirtualFileSystem.h"
 #include <iostream>
 
 // Include stb_image for image loading
@@ -9,12 +10,47 @@
 namespace RPGEngine {
 namespace Resources {
 
+namespace {
+
+/**
+ * Bytes of a texture with a full mipmap chain
+ */
+size_t textureMemorySize(int width, int height, int bytesPerPixel) {
+    size_t total = 0;
+    while (true) {
+        total += static_cast<size_t>(width) * height * bytesPerPixel;
+        if (width == 1 && height == 1) {
+            break;
+        }
+        width = width > 1 ? width / 2 : 1;
+        height = height > 1 ? height / 2 : 1;
+    }
+    return total;
+}
+
+int formatBytesPerPixel(int format) {
+    switch (format) {
+        case GL_RED: return 1;
+        case GL_RG: return 2;
+        case GL_RGB: return 3;
+        default: return 4;     // GL_RGBA and unknown formats
+    }
+}
+
+} // anonymous namespace
+
 TextureResource::TextureResource(const std::string& id, const std::string& path)
     : Resource(id, path)
     , m_width(0)
     , m_height(0)
     , m_format(0)
     , m_handle(0)
+    , m_ownsHandle(true)
+    , m_premultiplied(false)
+    , m_levelCount(0)
+    , m_decodedWidth(0)
+    , m_decodedHeight(0)
+    , m_decodedChannels(0)
 {
 }
 
@@ -33,9 +69,34 @@ bool TextureResource::load() {
     // Set state to loading
     setState(ResourceState::Loading);
     
-    // Load image data using stb_image
+    // Read through the VFS (zero-copy from a packed archive)
+    const std::string loadPath = getLoadPath();
+    AssetView file = VirtualFileSystem::getInstance().open(loadPath);
+    if (!file.isValid()) {
+        std::cerr << "Failed to open texture: " << loadPath << std::endl;
+        setState(ResourceState::Failed);
+        return false;
+    }
+    
+    // Cooked textures upload straight from the file
+    if (isCookedTexture(file.data(), file.size())) {
+        CookedTexture cooked;
+        if (!parseCookedTexture(file.data(), file.size(), cooked)) {
+            std::cerr << "Invalid cooked texture: " << loadPath << std::endl;
+            setState(ResourceState::Failed);
+            return false;
+        }
+        createCookedTexture(cooked);
+        setState(ResourceState::Loaded);
+        
+        std::cout << "Loaded texture: " << loadPath << " (" << cooked.width << "x" << cooked.height << ", "
+                  << cookedFormatName(cooked.format) << ", " << cooked.levels.size() << " levels)" << std::endl;
+        return true;
+    }
+    
     int width, height, channels;
-    unsigned char* data = stbi_load(getPath().c_str(), &width, &height, &channels, 0);
+    unsigned char* data = stbi_load_from_memory(file.data(), static_cast<int>(file.size()),
+                                                &width, &height, &channels, 0);
     
     if (!data) {
         std::cerr << "Failed to load texture: " << getPath() << std::endl;
@@ -44,51 +105,164 @@ bool TextureResource::load() {
         return false;
     }
     
+    createTexture(data, width, height, channels);
+    
+    // Free image data
+    stbi_image_free(data);
+    
+    // Set state to loaded
+    setState(ResourceState::Loaded);
+    
+    std::cout << "Loaded texture: " << getPath() << " (" << width << "x" << height << ", " << channels << " channels)" << std::endl;
+    
+    return true;
+}
+
+std::string TextureResource::getLoadPath() const {
+    std::string cookedPath = cookedTexturePath(getPath());
+    if (cookedPath != getPath() && VirtualFileSystem::getInstance().exists(cookedPath)) {
+        return cookedPath;
+    }
+    return getPath();
+}
+
+bool TextureResource::decode(std::vector<uint8_t>& fileData) {
+    // Cooked textures need no decoding; keep the file for upload()
+    if (isCookedTexture(fileData.data(), fileData.size())) {
+        m_cookedData.swap(fileData);
+        if (!parseCookedTexture(m_cookedData.data(), m_cookedData.size(), m_cooked)) {
+            std::cerr << "Invalid cooked texture: " << getLoadPath() << std::endl;
+            discardDecoded();
+            return false;
+        }
+        return true;
+    }
+    
+    int width, height, channels;
+    unsigned char* data = stbi_load_from_memory(fileData.data(), static_cast<int>(fileData.size()),
+                                                &width, &height, &channels, 0);
+    
+    if (!data) {
+        std::cerr << "Failed to decode texture: " << getPath() << std::endl;
+        std::cerr << "Error: " << stbi_failure_reason() << std::endl;
+        return false;
+    }
+    
+    m_decodedPixels.assign(data, data + static_cast<size_t>(width) * height * channels);
+    m_decodedWidth = width;
+    m_decodedHeight = height;
+    m_decodedChannels = channels;
+    stbi_image_free(data);
+    return true;
+}
+
+bool TextureResource::upload() {
+    if (m_decodedPixels.empty() && m_cooked.levels.empty()) {
+        return false;
+    }
+    
+    // Replace the version being reloaded
+    if (isLoaded()) {
+        unload();
+    }
+    
+    if (!m_cooked.levels.empty()) {
+        createCookedTexture(m_cooked);
+    } else {
+        createTexture(m_decodedPixels.data(), m_decodedWidth, m_decodedHeight, m_decodedChannels);
+    }
+    discardDecoded();
+    
+    setState(ResourceState::Loaded);
+    return true;
+}
+
+void TextureResource::discardDecoded() {
+    m_decodedPixels.clear();
+    m_decodedPixels.shrink_to_fit();
+    m_cooked.levels.clear();
+    m_cookedData.clear();
+    m_cookedData.shrink_to_fit();
+}
+
+void TextureResource::createTexture(const unsigned char* data, int width, int height, int channels) {
     // Determine format based on channels
     int format;
     switch (channels) {
-        case 1: format = 0x1909; break; // GL_RED
-        case 2: format = 0x190A; break; // GL_RG
-        case 3: format = 0x1907; break; // GL_RGB
-        case 4: format = 0x1908; break; // GL_RGBA
-        default: format = 0x1907; break; // GL_RGB
+        case 1: format = GL_RED; break;
+        case 2: format = GL_RG; break;
+        case 3: format = GL_RGB; break;
+        case 4: format = GL_RGBA; break;
+        default: format = GL_RGB; break;
     }
     
     // Generate OpenGL texture
     unsigned int handle;
     glGenTextures(1, &handle);
-    glBindTexture(0x0DE1, handle); // GL_TEXTURE_2D
+    glBindTexture(GL_TEXTURE_2D, handle);
     
     // Set texture parameters
-    glTexParameteri(0x0DE1, 0x2801, 0x2601); // GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR
-    glTexParameteri(0x0DE1, 0x2800, 0x2601); // GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR
-    glTexParameteri(0x0DE1, 0x2802, 0x812F); // GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE
-    glTexParameteri(0x0DE1, 0x2803, 0x812F); // GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
     
     // Upload texture data
-    glTexImage2D(0x0DE1, 0, format, width, height, 0, format, 0x1401, data); // GL_TEXTURE_2D, format, width, height, format, GL_UNSIGNED_BYTE, data
+    glTexImage2D(GL_TEXTURE_2D, 0, format, width, height, 0, format, GL_UNSIGNED_BYTE, data);
     
     // Generate mipmaps
-    glGenerateMipmap(0x0DE1); // GL_TEXTURE_2D
+    glGenerateMipmap(GL_TEXTURE_2D);
     
     // Unbind texture
-    glBindTexture(0x0DE1, 0); // GL_TEXTURE_2D
-    
-    // Free image data
-    stbi_image_free(data);
+    glBindTexture(GL_TEXTURE_2D, 0);
     
     // Store texture information
     m_width = width;
     m_height = height;
     m_format = format;
     m_handle = handle;
+    m_ownsHandle = true;
+    m_premultiplied = false;
+    m_levelCount = 1;
+    setMemorySize(textureMemorySize(width, height, formatBytesPerPixel(format)));
+}
+
+void TextureResource::createCookedTexture(const CookedTexture& texture) {
+    const unsigned int internalFormat = cookedGLInternalFormat(texture.format);
+    const int levelCount = static_cast<int>(texture.levels.size());
     
-    // Set state to loaded
-    setState(ResourceState::Loaded);
+    unsigned int handle;
+    glGenTextures(1, &handle);
+    glBindTexture(GL_TEXTURE_2D, handle);
     
-    std::cout << "Loaded texture: " << getPath() << " (" << width << "x" << height << ", " << channels << " channels)" << std::endl;
+    // The mip chain is precomputed; sample it only if there is one
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, levelCount > 1 ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
+    glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, levelCount - 1);
     
-    return true;
+    for (int level = 0; level < levelCount; ++level) {
+        const CookedTexture::Level& data = texture.levels[level];
+        if (isCompressedFormat(texture.format)) {
+            glCompressedTexImage2D(GL_TEXTURE_2D, level, internalFormat, data.width, data.height, 0,
+                                   static_cast<int>(data.size), data.data);
+        } else {
+            glTexImage2D(GL_TEXTURE_2D, level, static_cast<int>(internalFormat), data.width, data.height, 0,
+                         GL_RGBA, GL_UNSIGNED_BYTE, data.data);
+        }
+    }
+    
+    glBindTexture(GL_TEXTURE_2D, 0);
+    
+    m_width = texture.width;
+    m_height = texture.height;
+    m_format = static_cast<int>(internalFormat);
+    m_handle = handle;
+    m_ownsHandle = true;
+    m_premultiplied = texture.isPremultiplied();
+    m_levelCount = levelCount;
+    setMemorySize(texture.getDataSize());
 }
 
 void TextureResource::unload() {
@@ -98,15 +272,18 @@ void TextureResource::unload() {
     }
     
     // Delete OpenGL texture
-    if (m_handle != 0) {
+    if (m_handle != 0 && m_ownsHandle) {
         glDeleteTextures(1, &m_handle);
-        m_handle = 0;
     }
+    m_handle = 0;
     
     // Reset texture information
     m_width = 0;
     m_height = 0;
     m_format = 0;
+    m_premultiplied = false;
+    m_levelCount = 0;
+    setMemorySize(0);
     
     // Set state to unloaded
     setState(ResourceState::Unloaded);
@@ -114,5 +291,26 @@ void TextureResource::unload() {
     std::cout << "Unloaded texture: " << getPath() << std::endl;
 }
 
+bool TextureResource::adoptHandle(unsigned int handle, int width, int height, int format) {
+    if (isLoaded() || handle == 0 || width <= 0 || height <= 0) {
+        return false;
+    }
+    
+    m_width = width;
+    m_height = height;
+    m_format = format;
+    m_handle = handle;
+    m_ownsHandle = false;
+    m_premultiplied = false;
+    m_levelCount = 1;
+    
+    // Adopted textures count against the budget even though the creator
+    // frees them; they were created without mipmaps
+    setMemorySize(static_cast<size_t>(width) * height * formatBytesPerPixel(format));
+    
+    setState(ResourceState::Loaded);
+    return true;
+}
+
 } // namespace Resources
 } // namespace RPGEngine
\ No newline at end of file
@@ -1,8 +1,10 @@
 #pragma once
 
 #include "Resource.h"
+#include "CookedTexture.h"
 #include <string>
 #include <memory>
+#include <vector>
 
 namespace RPGEngine {
 namespace Resources {
@@ -10,6 +12,12 @@ namespace Resources {
 /**
  * Texture resource
  * Represents a loadable texture
+ *
+ * Loads the cooked version of its image ("x.rtex" next to "x.png", see
+ * TextureCooker) when the VirtualFileSystem has one: its levels are
+ * uploaded as stored, with no image decoding or mipmap generation.
+ * Otherwise the image is decoded with stb_image. Re-cook after editing
+ * the source image; hot reload reads the cooked file when there is one.
  */
 class TextureResource : public Resource {
 public:
@@ -36,6 +44,36 @@ public:
      */
     void unload() override;
     
+    /**
+     * Get the budget category
+     * @return ResourceCategory::Texture
+     */
+    ResourceCategory getCategory() const override { return ResourceCategory::Texture; }
+    
+    /**
+     * Get the file a load reads
+     * @return Cooked texture path if the VirtualFileSystem has it, the image path otherwise
+     */
+    std::string getLoadPath() const override;
+    
+    // Staged loading: decode() parses the cooked texture or runs stb_image on
+    // a worker, upload() creates the GL texture
+    bool supportsStagedLoad() const override { return true; }
+    bool decode(std::vector<uint8_t>& fileData) override;
+    bool upload() override;
+    void discardDecoded() override;
+    
+    /**
+     * Wrap a texture that was created elsewhere (e.g. through IGraphicsAPI)
+     * The resource does not delete adopted handles when it is unloaded.
+     * @param handle Texture handle
+     * @param width Texture width
+     * @param height Texture height
+     * @param format Texture format
+     * @return true if the texture was adopted
+     */
+    bool adoptHandle(unsigned int handle, int width, int height, int format);
+    
     /**
      * Get the texture width
      * @return Texture width
@@ -60,11 +98,52 @@ public:
      */
     unsigned int getHandle() const { return m_handle; }
     
+    /**
+     * Check if the texture's color is premultiplied by alpha
+     * Premultiplied textures are drawn with BlendMode::PremultipliedAlpha.
+     * @return true if loaded from a premultiplied cooked texture
+     */
+    bool isPremultipliedAlpha() const { return m_premultiplied; }
+    
+    /**
+     * Get the number of mip levels
+     * @return Level count (1 for images without mipmaps)
+     */
+    int getLevelCount() const { return m_levelCount; }
+    
 private:
+    /**
+     * Create the GL texture from decoded pixels
+     * @param data Pixel data
+     * @param width Width
+     * @param height Height
+     * @param channels Channels per pixel
+     */
+    void createTexture(const unsigned char* data, int width, int height, int channels);
+    
+    /**
+     * Create the GL texture from a cooked texture, one upload per level
+     * @param texture Parsed cooked texture
+     */
+    void createCookedTexture(const CookedTexture& texture);
+    
     int m_width;           // Texture width
     int m_height;          // Texture height
     int m_format;          // Texture format
     unsigned int m_handle; // Texture handle
+    bool m_ownsHandle;     // Whether unload() deletes the handle
+    bool m_premultiplied;  // Whether color is premultiplied by alpha
+    int m_levelCount;      // Mip levels
+    
+    // Decoded pixels waiting for upload()
+    std::vector<unsigned char> m_decodedPixels;
+    int m_decodedWidth;
+    int m_decodedHeight;
+    int m_decodedChannels;
+    
+    // Cooked file waiting for upload() (levels point into m_cookedData)
+    std::vector<uint8_t> m_cookedData;
+    CookedTexture m_cooked;
 };
 
 } // namespace Resources
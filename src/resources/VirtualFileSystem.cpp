@@ -0,0 +1,184 @@
+#include "VirtualFileSystem.h"
+#include <iostream>
+#include <fstream>
+#include <mutex>
+
+namespace RPGEngine {
+namespace Resources {
+
+VirtualFileSystem& VirtualFileSystem::getInstance() {
+    static VirtualFileSystem instance;
+    return instance;
+}
+
+VirtualFileSystem::VirtualFileSystem()
+    : m_archiveReads(0)
+    , m_zeroCopyReads(0)
+    , m_looseReads(0)
+    , m_misses(0)
+{
+#ifdef RPG_SHIPPING_BUILD
+    m_looseFilesEnabled = false;
+#else
+    m_looseFilesEnabled = true;
+#endif
+}
+
+bool VirtualFileSystem::mountArchive(const std::string& path) {
+    auto archive = AssetArchive::open(path);
+    if (!archive) {
+        return false;
+    }
+
+    std::unique_lock<std::shared_mutex> lock(m_mutex);
+    m_archives.push_back(archive);
+
+    std::cout << "Mounted asset archive: " << path << " (" << archive->getEntryCount() << " files, "
+              << archive->getBlobCount() << " unique)" << std::endl;
+    return true;
+}
+
+bool VirtualFileSystem::unmountArchive(const std::string& path) {
+    std::unique_lock<std::shared_mutex> lock(m_mutex);
+    for (auto it = m_archives.begin(); it != m_archives.end(); ++it) {
+        if ((*it)->getPath() == path) {
+            m_archives.erase(it);
+            return true;
+        }
+    }
+    return false;
+}
+
+void VirtualFileSystem::unmountAll() {
+    std::unique_lock<std::shared_mutex> lock(m_mutex);
+    m_archives.clear();
+}
+
+size_t VirtualFileSystem::getArchiveCount() const {
+    std::shared_lock<std::shared_mutex> lock(m_mutex);
+    return m_archives.size();
+}
+
+bool VirtualFileSystem::exists(const std::string& path) const {
+    if (isArchived(path)) {
+        return true;
+    }
+    return m_looseFilesEnabled && std::ifstream(path).good();
+}
+
+bool VirtualFileSystem::isArchived(const std::string& path) const {
+    const std::string normalized = normalizePath(path);
+
+    std::shared_lock<std::shared_mutex> lock(m_mutex);
+    for (auto it = m_archives.rbegin(); it != m_archives.rend(); ++it) {
+        if ((*it)->contains(normalized)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+AssetView VirtualFileSystem::open(const std::string& path) const {
+    {
+        const std::string normalized = normalizePath(path);
+
+        std::shared_lock<std::shared_mutex> lock(m_mutex);
+        for (auto it = m_archives.rbegin(); it != m_archives.rend(); ++it) {
+            AssetView view = (*it)->view(normalized);
+            if (view.isValid()) {
+                m_archiveReads++;
+                if (view.isZeroCopy()) {
+                    m_zeroCopyReads++;
+                }
+                return view;
+            }
+        }
+    }
+
+    if (m_looseFilesEnabled) {
+        std::ifstream file(path, std::ios::binary | std::ios::ate);
+        if (file.is_open()) {
+            std::vector<uint8_t> data(static_cast<size_t>(file.tellg()));
+            file.seekg(0, std::ios::beg);
+            if (data.empty() || file.read(reinterpret_cast<char*>(data.data()), data.size())) {
+                m_looseReads++;
+                return AssetView::fromBuffer(std::move(data));
+            }
+        }
+    }
+
+    m_misses++;
+    return AssetView();
+}
+
+bool VirtualFileSystem::readFile(const std::string& path, std::vector<uint8_t>& data) const {
+    AssetView view = open(path);
+    if (!view.isValid()) {
+        return false;
+    }
+    data.assign(view.data(), view.data() + view.size());
+    return true;
+}
+
+bool VirtualFileSystem::readText(const std::string& path, std::string& text) const {
+    AssetView view = open(path);
+    if (!view.isValid()) {
+        return false;
+    }
+    text = view.toString();
+    return true;
+}
+
+VirtualFileSystemStats VirtualFileSystem::getStats() const {
+    VirtualFileSystemStats stats;
+    stats.archiveReads = m_archiveReads;
+    stats.zeroCopyReads = m_zeroCopyReads;
+    stats.looseReads = m_looseReads;
+    stats.misses = m_misses;
+    return stats;
+}
+
+void VirtualFileSystem::resetStats() {
+    m_archiveReads = 0;
+    m_zeroCopyReads = 0;
+    m_looseReads = 0;
+    m_misses = 0;
+}
+
+std::string VirtualFileSystem::normalizePath(const std::string& path) {
+    std::vector<std::string> segments;
+    const bool absolute = !path.empty() && (path[0] == '/' || path[0] == '\\');
+
+    size_t start = 0;
+    while (start <= path.size()) {
+        size_t end = path.find_first_of("/\\", start);
+        if (end == std::string::npos) {
+            end = path.size();
+        }
+
+        std::string segment = path.substr(start, end - start);
+        if (segment == "..") {
+            // Resolve against the previous segment, keeping leading ".." of relative paths
+            if (!segments.empty() && segments.back() != "..") {
+                segments.pop_back();
+            } else if (!absolute) {
+                segments.push_back(segment);
+            }
+        } else if (!segment.empty() && segment != ".") {
+            segments.push_back(segment);
+        }
+        start = end + 1;
+    }
+
+    std::string result = absolute ? "/" : "";
+    for (size_t i = 0; i < segments.size(); ++i) {
+        if (i > 0) {
+            result += '/';
+        }
+        result += segments[i];
+    }
+    return result;
+}
+
+} // namespace Resources
+} // namespace RPGEngine
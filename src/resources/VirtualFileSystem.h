@@ -0,0 +1,150 @@
+#pragma once
+
+#include "AssetArchive.h"
+#include <string>
+#include <vector>
+#include <memory>
+#include <shared_mutex>
+#include <atomic>
+
+namespace RPGEngine {
+namespace Resources {
+
+/**
+ * Virtual file system statistics
+ */
+struct VirtualFileSystemStats {
+    uint64_t archiveReads = 0;      // Served from a mounted archive
+    uint64_t zeroCopyReads = 0;     // ...without copying
+    uint64_t looseReads = 0;        // Served from loose files
+    uint64_t misses = 0;
+};
+
+/**
+ * Virtual file system
+ * Serves asset files from mounted archives, falling back to loose files on
+ * disk. Resources, the map loader and the load pipeline read through it, so
+ * packing the assets needs no code changes. Loose files are on by default
+ * and off in shipping builds (RPG_SHIPPING_BUILD).
+ *
+ * Paths are normalized (backslashes become '/', "." and ".." are resolved), so the
+ * archive must be packed with the same prefix the game uses, e.g.
+ * "assets/maps/town.tmx".
+ */
+class VirtualFileSystem {
+public:
+    /**
+     * Get the process-wide file system
+     * @return File system
+     */
+    static VirtualFileSystem& getInstance();
+
+    /**
+     * Mount an archive
+     * Archives mounted later take precedence over earlier ones.
+     * @param path Archive path
+     * @return true if the archive was opened
+     */
+    bool mountArchive(const std::string& path);
+
+    /**
+     * Unmount an archive
+     * Views already handed out stay valid.
+     * @param path Archive path as passed to mountArchive()
+     * @return true if the archive was mounted
+     */
+    bool unmountArchive(const std::string& path);
+
+    /**
+     * Unmount all archives
+     */
+    void unmountAll();
+
+    /**
+     * Get the number of mounted archives
+     * @return Archive count
+     */
+    size_t getArchiveCount() const;
+
+    /**
+     * Set whether files missing from the archives are read from disk
+     * @param enabled Whether to fall back to loose files
+     */
+    void setLooseFilesEnabled(bool enabled) { m_looseFilesEnabled = enabled; }
+
+    /**
+     * Check if loose files are read
+     * @return true if loose files are enabled
+     */
+    bool isLooseFilesEnabled() const { return m_looseFilesEnabled; }
+
+    /**
+     * Check if a file exists
+     * @param path File path
+     * @return true if an archive or (with loose files enabled) the disk has it
+     */
+    bool exists(const std::string& path) const;
+
+    /**
+     * Check if a file is served from an archive
+     * @param path File path
+     * @return true if a mounted archive contains it
+     */
+    bool isArchived(const std::string& path) const;
+
+    /**
+     * Open a file
+     * @param path File path
+     * @return View of the contents (invalid if not found)
+     */
+    AssetView open(const std::string& path) const;
+
+    /**
+     * Read a file into a buffer
+     * @param path File path
+     * @param data Receives the contents
+     * @return true if the file was found
+     */
+    bool readFile(const std::string& path, std::vector<uint8_t>& data) const;
+
+    /**
+     * Read a text file
+     * @param path File path
+     * @param text Receives the contents
+     * @return true if the file was found
+     */
+    bool readText(const std::string& path, std::string& text) const;
+
+    /**
+     * Get read statistics
+     * @return Statistics
+     */
+    VirtualFileSystemStats getStats() const;
+
+    /**
+     * Reset read statistics
+     */
+    void resetStats();
+
+    /**
+     * Normalize a path for archive lookups
+     * @param path Path
+     * @return Path with '/' separators and "." and ".." resolved
+     */
+    static std::string normalizePath(const std::string& path);
+
+private:
+    VirtualFileSystem();
+
+    mutable std::shared_mutex m_mutex;
+    std::vector<std::shared_ptr<AssetArchive>> m_archives;     // Search order: last first
+    std::atomic<bool> m_looseFilesEnabled;
+
+    mutable std::atomic<uint64_t> m_archiveReads;
+    mutable std::atomic<uint64_t> m_zeroCopyReads;
+    mutable std::atomic<uint64_t> m_looseReads;
+    mutable std::atomic<uint64_t> m_misses;
+};
+
+} // namespace Resources
+} // namespace RPGEngine
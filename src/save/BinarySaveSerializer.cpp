@@ -0,0 +1,650 @@
+#include "BinarySaveSerializer.h"
+#include <cstring>
+
+namespace Engine {
+    namespace Save {
+
+        namespace {
+
+            // Top-level fields
+            enum SaveField : uint32_t {
+                SaveVersion = 1,
+                SaveTimestamp = 2,
+                SavePlayer = 3,
+                SaveWorld = 4,
+                SaveCustomData = 5
+            };
+
+            // PlayerData fields
+            enum PlayerField : uint32_t {
+                PlayerX = 1,
+                PlayerY = 2,
+                PlayerHp = 3,
+                PlayerMaxHp = 4,
+                PlayerMp = 5,
+                PlayerMaxMp = 6,
+                PlayerLevel = 7,
+                PlayerExperience = 8,
+                PlayerExperienceToNext = 9,
+                PlayerInventoryItem = 10,
+                PlayerEquipment = 11
+            };
+
+            // WorldData fields
+            enum WorldField : uint32_t {
+                WorldCurrentMap = 1,
+                WorldCompletedQuest = 2,
+                WorldGameFlag = 3,
+                WorldNpcState = 4,
+                WorldDiscoveredLocation = 5
+            };
+
+            // SaveDelta fields (journal records)
+            enum DeltaField : uint32_t {
+                DeltaTimestamp = 1,
+                DeltaGameFlag = 2,
+                DeltaNpcState = 3,
+                DeltaDiscoveredLocation = 4,
+                DeltaCompletedQuest = 5,
+                DeltaCustomData = 6,
+                DeltaCurrentMap = 7,
+                DeltaPlayer = 8
+            };
+
+            // Map entries and inventory items are {1: key, 2: value} messages
+            const uint32_t ENTRY_KEY = 1;
+            const uint32_t ENTRY_VALUE = 2;
+
+            void writeStringEntry(BinarySaveWriter& writer, uint32_t field, const std::string& key, const std::string& value) {
+                size_t marker = writer.beginMessage(field);
+                writer.writeString(ENTRY_KEY, key);
+                writer.writeString(ENTRY_VALUE, value);
+                writer.endMessage(marker);
+            }
+
+            void writeBoolEntry(BinarySaveWriter& writer, uint32_t field, const std::string& key, bool value) {
+                size_t marker = writer.beginMessage(field);
+                writer.writeString(ENTRY_KEY, key);
+                writer.writeBool(ENTRY_VALUE, value);
+                writer.endMessage(marker);
+            }
+
+            // Each field number has one wire type. Anything else is corrupt data,
+            // and the field's other members still hold an earlier field's value.
+            bool readString(const BinarySaveReader::Field& field, std::string& outValue) {
+                if (field.type != BinaryWireType::LengthDelimited) {
+                    return false;
+                }
+                outValue.assign(field.bytes.data(), field.bytes.size());
+                return true;
+            }
+
+            bool readInt(const BinarySaveReader::Field& field, int& outValue) {
+                if (field.type != BinaryWireType::Varint) {
+                    return false;
+                }
+                outValue = static_cast<int>(field.asInt());
+                return true;
+            }
+
+            bool readFloat(const BinarySaveReader::Field& field, float& outValue) {
+                if (field.type != BinaryWireType::Fixed32) {
+                    return false;
+                }
+                outValue = field.asFloat();
+                return true;
+            }
+
+            bool readStringEntry(const BinarySaveReader::Field& field, std::unordered_map<std::string, std::string>& outMap) {
+                if (field.type != BinaryWireType::LengthDelimited) {
+                    return false;
+                }
+
+                BinarySaveReader reader = field.asMessage();
+                BinarySaveReader::Field entry;
+                std::string_view key;
+                std::string_view value;
+                while (reader.next(entry)) {
+                    if (entry.number != ENTRY_KEY && entry.number != ENTRY_VALUE) {
+                        continue;
+                    }
+                    if (entry.type != BinaryWireType::LengthDelimited) {
+                        return false;
+                    }
+                    if (entry.number == ENTRY_KEY) {
+                        key = entry.bytes;
+                    } else {
+                        value = entry.bytes;
+                    }
+                }
+
+                outMap[std::string(key)] = std::string(value);
+                return !reader.hasError();
+            }
+
+            bool readBoolEntry(const BinarySaveReader::Field& field, std::unordered_map<std::string, bool>& outMap) {
+                if (field.type != BinaryWireType::LengthDelimited) {
+                    return false;
+                }
+
+                BinarySaveReader reader = field.asMessage();
+                BinarySaveReader::Field entry;
+                std::string_view key;
+                bool value = false;
+                while (reader.next(entry)) {
+                    if (entry.number == ENTRY_KEY) {
+                        if (entry.type != BinaryWireType::LengthDelimited) {
+                            return false;
+                        }
+                        key = entry.bytes;
+                    } else if (entry.number == ENTRY_VALUE) {
+                        if (entry.type != BinaryWireType::Varint) {
+                            return false;
+                        }
+                        value = entry.asBool();
+                    }
+                }
+
+                outMap[std::string(key)] = value;
+                return !reader.hasError();
+            }
+
+            uint16_t readUInt16(const char* data) {
+                return static_cast<uint16_t>(static_cast<uint8_t>(data[0]) | (static_cast<uint8_t>(data[1]) << 8));
+            }
+
+        } // namespace
+
+        // BinarySaveWriter
+
+        void BinarySaveWriter::writeVarint(uint64_t value) {
+            while (value >= 0x80) {
+                m_output.push_back(static_cast<char>((value & 0x7F) | 0x80));
+                value >>= 7;
+            }
+            m_output.push_back(static_cast<char>(value));
+        }
+
+        void BinarySaveWriter::writeKey(uint32_t field, BinaryWireType type) {
+            writeVarint((static_cast<uint64_t>(field) << 3) | static_cast<uint8_t>(type));
+        }
+
+        void BinarySaveWriter::writeUInt(uint32_t field, uint64_t value) {
+            writeKey(field, BinaryWireType::Varint);
+            writeVarint(value);
+        }
+
+        void BinarySaveWriter::writeInt(uint32_t field, int64_t value) {
+            // Zigzag keeps small negative numbers short
+            writeUInt(field, (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63));
+        }
+
+        void BinarySaveWriter::writeBool(uint32_t field, bool value) {
+            writeUInt(field, value ? 1 : 0);
+        }
+
+        void BinarySaveWriter::writeFloat(uint32_t field, float value) {
+            uint32_t bits;
+            std::memcpy(&bits, &value, sizeof(bits));
+
+            writeKey(field, BinaryWireType::Fixed32);
+            for (int i = 0; i < 4; ++i) {
+                m_output.push_back(static_cast<char>((bits >> (i * 8)) & 0xFF));
+            }
+        }
+
+        void BinarySaveWriter::writeString(uint32_t field, std::string_view value) {
+            writeKey(field, BinaryWireType::LengthDelimited);
+            writeVarint(value.size());
+            m_output.append(value.data(), value.size());
+        }
+
+        size_t BinarySaveWriter::beginMessage(uint32_t field) {
+            writeKey(field, BinaryWireType::LengthDelimited);
+
+            // One byte covers most messages; endMessage widens it if needed
+            m_output.push_back(0);
+            return m_output.size();
+        }
+
+        void BinarySaveWriter::endMessage(size_t marker) {
+            uint64_t length = m_output.size() - marker;
+            if (length < 0x80) {
+                m_output[marker - 1] = static_cast<char>(length);
+                return;
+            }
+
+            std::string prefix;
+            BinarySaveWriter(prefix).writeVarint(length);
+            m_output.replace(marker - 1, 1, prefix);
+        }
+
+        // BinarySaveReader
+
+        int64_t BinarySaveReader::Field::asInt() const {
+            return static_cast<int64_t>(varint >> 1) ^ -static_cast<int64_t>(varint & 1);
+        }
+
+        float BinarySaveReader::Field::asFloat() const {
+            float value;
+            std::memcpy(&value, &fixed32, sizeof(value));
+            return value;
+        }
+
+        bool BinarySaveReader::readVarint(uint64_t& outValue) {
+            outValue = 0;
+            for (int shift = 0; shift < 64; shift += 7) {
+                if (m_pos >= m_size) {
+                    return false;
+                }
+
+                uint8_t byte = static_cast<uint8_t>(m_data[m_pos++]);
+                outValue |= static_cast<uint64_t>(byte & 0x7F) << shift;
+                if ((byte & 0x80) == 0) {
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        bool BinarySaveReader::next(Field& outField) {
+            if (m_error || m_pos >= m_size) {
+                return false;
+            }
+
+            uint64_t key;
+            if (!readVarint(key) || (key >> 3) == 0 || (key >> 3) > UINT32_MAX) {
+                m_error = true;
+                return false;
+            }
+
+            outField.number = static_cast<uint32_t>(key >> 3);
+            outField.type = static_cast<BinaryWireType>(key & 0x7);
+
+            switch (outField.type) {
+                case BinaryWireType::Varint:
+                    if (!readVarint(outField.varint)) {
+                        m_error = true;
+                        return false;
+                    }
+                    return true;
+
+                case BinaryWireType::Fixed32:
+                    if (m_size - m_pos < 4) {
+                        m_error = true;
+                        return false;
+                    }
+                    outField.fixed32 = 0;
+                    for (int i = 0; i < 4; ++i) {
+                        outField.fixed32 |= static_cast<uint32_t>(static_cast<uint8_t>(m_data[m_pos + i])) << (i * 8);
+                    }
+                    m_pos += 4;
+                    return true;
+
+                case BinaryWireType::LengthDelimited: {
+                    uint64_t length;
+                    if (!readVarint(length) || length > m_size - m_pos) {
+                        m_error = true;
+                        return false;
+                    }
+                    outField.bytes = std::string_view(m_data + m_pos, static_cast<size_t>(length));
+                    m_pos += static_cast<size_t>(length);
+                    return true;
+                }
+
+                default:
+                    // Unknown wire types can't be skipped
+                    m_error = true;
+                    return false;
+            }
+        }
+
+        // BinarySaveSerializer
+
+        std::string BinarySaveSerializer::serialize(const SaveData& data) {
+            std::string output;
+            output.reserve(4096);
+
+            output.append(BINARY_SAVE_MAGIC, 4);
+            output.push_back(static_cast<char>(BINARY_SAVE_SCHEMA_VERSION & 0xFF));
+            output.push_back(static_cast<char>(BINARY_SAVE_SCHEMA_VERSION >> 8));
+            output.push_back(0);
+            output.push_back(0);
+
+            BinarySaveWriter writer(output);
+
+            // Version first so peekVersion stops after one field
+            writer.writeString(SaveVersion, data.version);
+            writer.writeString(SaveTimestamp, data.timestamp);
+
+            size_t marker = writer.beginMessage(SavePlayer);
+            writePlayerData(writer, data.player);
+            writer.endMessage(marker);
+
+            marker = writer.beginMessage(SaveWorld);
+            writeWorldData(writer, data.world);
+            writer.endMessage(marker);
+
+            for (const auto& [key, value] : data.customData) {
+                writeStringEntry(writer, SaveCustomData, key, value);
+            }
+
+            return output;
+        }
+
+        bool BinarySaveSerializer::deserialize(const std::string& data, SaveData& outData) {
+            uint16_t schema;
+            if (!readSchemaVersion(data, schema) || schema > BINARY_SAVE_SCHEMA_VERSION) {
+                return false;
+            }
+
+            BinarySaveReader reader(data.data() + BINARY_SAVE_HEADER_SIZE, data.size() - BINARY_SAVE_HEADER_SIZE);
+            BinarySaveReader::Field field;
+            bool hasVersion = false;
+
+            outData.customData.clear();
+
+            while (reader.next(field)) {
+                switch (field.number) {
+                    case SaveVersion:
+                        if (!readString(field, outData.version)) {
+                            return false;
+                        }
+                        hasVersion = true;
+                        break;
+                    case SaveTimestamp:
+                        if (!readString(field, outData.timestamp)) {
+                            return false;
+                        }
+                        break;
+                    case SavePlayer:
+                        if (field.type != BinaryWireType::LengthDelimited || !readPlayerData(field.asMessage(), outData.player)) {
+                            return false;
+                        }
+                        break;
+                    case SaveWorld:
+                        if (field.type != BinaryWireType::LengthDelimited || !readWorldData(field.asMessage(), outData.world)) {
+                            return false;
+                        }
+                        break;
+                    case SaveCustomData:
+                        if (!readStringEntry(field, outData.customData)) {
+                            return false;
+                        }
+                        break;
+                    default:
+                        // Field from a newer build
+                        break;
+                }
+            }
+
+            return hasVersion && !reader.hasError();
+        }
+
+        bool BinarySaveSerializer::isBinarySave(std::string_view data) {
+            return data.size() >= BINARY_SAVE_HEADER_SIZE && std::memcmp(data.data(), BINARY_SAVE_MAGIC, 4) == 0;
+        }
+
+        bool BinarySaveSerializer::readSchemaVersion(std::string_view data, uint16_t& outSchema) {
+            if (!isBinarySave(data)) {
+                return false;
+            }
+
+            outSchema = readUInt16(data.data() + 4);
+            return outSchema != 0;
+        }
+
+        bool BinarySaveSerializer::peekVersion(std::string_view data, std::string& outVersion) {
+            if (!isBinarySave(data)) {
+                return false;
+            }
+
+            BinarySaveReader reader(data.data() + BINARY_SAVE_HEADER_SIZE, data.size() - BINARY_SAVE_HEADER_SIZE);
+            BinarySaveReader::Field field;
+            while (reader.next(field)) {
+                if (field.number == SaveVersion && field.type == BinaryWireType::LengthDelimited) {
+                    outVersion.assign(field.bytes.data(), field.bytes.size());
+                    return true;
+                }
+            }
+
+            return false;
+        }
+
+        std::string BinarySaveSerializer::serializeDelta(const SaveDelta& delta) {
+            std::string output;
+            BinarySaveWriter writer(output);
+
+            writer.writeString(DeltaTimestamp, delta.timestamp);
+
+            for (const auto& [flag, value] : delta.gameFlags) {
+                writeBoolEntry(writer, DeltaGameFlag, flag, value);
+            }
+
+            for (const auto& [npc, state] : delta.npcStates) {
+                writeStringEntry(writer, DeltaNpcState, npc, state);
+            }
+
+            for (const auto& [location, discovered] : delta.discoveredLocations) {
+                writeBoolEntry(writer, DeltaDiscoveredLocation, location, discovered);
+            }
+
+            for (const auto& quest : delta.completedQuests) {
+                writer.writeString(DeltaCompletedQuest, quest);
+            }
+
+            for (const auto& [key, value] : delta.customData) {
+                writeStringEntry(writer, DeltaCustomData, key, value);
+            }
+
+            if (!delta.currentMap.empty()) {
+                writer.writeString(DeltaCurrentMap, delta.currentMap);
+            }
+
+            if (delta.hasPlayer) {
+                size_t marker = writer.beginMessage(DeltaPlayer);
+                writePlayerData(writer, delta.player);
+                writer.endMessage(marker);
+            }
+
+            return output;
+        }
+
+        bool BinarySaveSerializer::deserializeDelta(std::string_view data, SaveDelta& outDelta) {
+            outDelta = SaveDelta();
+
+            BinarySaveReader reader(data.data(), data.size());
+            BinarySaveReader::Field field;
+            while (reader.next(field)) {
+                switch (field.number) {
+                    case DeltaTimestamp:
+                        if (!readString(field, outDelta.timestamp)) {
+                            return false;
+                        }
+                        break;
+                    case DeltaGameFlag:
+                        if (!readBoolEntry(field, outDelta.gameFlags)) {
+                            return false;
+                        }
+                        break;
+                    case DeltaNpcState:
+                        if (!readStringEntry(field, outDelta.npcStates)) {
+                            return false;
+                        }
+                        break;
+                    case DeltaDiscoveredLocation:
+                        if (!readBoolEntry(field, outDelta.discoveredLocations)) {
+                            return false;
+                        }
+                        break;
+                    case DeltaCompletedQuest:
+                        outDelta.completedQuests.emplace_back();
+                        if (!readString(field, outDelta.completedQuests.back())) {
+                            return false;
+                        }
+                        break;
+                    case DeltaCustomData:
+                        if (!readStringEntry(field, outDelta.customData)) {
+                            return false;
+                        }
+                        break;
+                    case DeltaCurrentMap:
+                        if (!readString(field, outDelta.currentMap)) {
+                            return false;
+                        }
+                        break;
+                    case DeltaPlayer:
+                        if (field.type != BinaryWireType::LengthDelimited || !readPlayerData(field.asMessage(), outDelta.player)) {
+                            return false;
+                        }
+                        outDelta.hasPlayer = true;
+                        break;
+                    default:
+                        // Field from a newer build
+                        break;
+                }
+            }
+
+            return !reader.hasError();
+        }
+
+        void BinarySaveSerializer::writePlayerData(BinarySaveWriter& writer, const PlayerData& player) {
+            writer.writeFloat(PlayerX, player.position.x);
+            writer.writeFloat(PlayerY, player.position.y);
+
+            writer.writeInt(PlayerHp, player.stats.hp);
+            writer.writeInt(PlayerMaxHp, player.stats.maxHp);
+            writer.writeInt(PlayerMp, player.stats.mp);
+            writer.writeInt(PlayerMaxMp, player.stats.maxMp);
+            writer.writeInt(PlayerLevel, player.stats.level);
+            writer.writeInt(PlayerExperience, player.stats.experience);
+            writer.writeInt(PlayerExperienceToNext, player.stats.experienceToNext);
+
+            for (const auto& item : player.inventory) {
+                size_t marker = writer.beginMessage(PlayerInventoryItem);
+                writer.writeString(ENTRY_KEY, item.id);
+                writer.writeInt(ENTRY_VALUE, item.quantity);
+                writer.endMessage(marker);
+            }
+
+            for (const auto& [slot, itemId] : player.equipment) {
+                writeStringEntry(writer, PlayerEquipment, slot, itemId);
+            }
+        }
+
+        void BinarySaveSerializer::writeWorldData(BinarySaveWriter& writer, const WorldData& world) {
+            writer.writeString(WorldCurrentMap, world.currentMap);
+
+            for (const auto& quest : world.completedQuests) {
+                writer.writeString(WorldCompletedQuest, quest);
+            }
+
+            for (const auto& [flag, value] : world.gameFlags) {
+                writeBoolEntry(writer, WorldGameFlag, flag, value);
+            }
+
+            for (const auto& [npc, state] : world.npcStates) {
+                writeStringEntry(writer, WorldNpcState, npc, state);
+            }
+
+            for (const auto& [location, discovered] : world.discoveredLocations) {
+                writeBoolEntry(writer, WorldDiscoveredLocation, location, discovered);
+            }
+        }
+
+        bool BinarySaveSerializer::readPlayerData(BinarySaveReader reader, PlayerData& outPlayer) {
+            outPlayer = PlayerData();
+
+            BinarySaveReader::Field field;
+            bool valid = true;
+            while (valid && reader.next(field)) {
+                switch (field.number) {
+                    case PlayerX: valid = readFloat(field, outPlayer.position.x); break;
+                    case PlayerY: valid = readFloat(field, outPlayer.position.y); break;
+                    case PlayerHp: valid = readInt(field, outPlayer.stats.hp); break;
+                    case PlayerMaxHp: valid = readInt(field, outPlayer.stats.maxHp); break;
+                    case PlayerMp: valid = readInt(field, outPlayer.stats.mp); break;
+                    case PlayerMaxMp: valid = readInt(field, outPlayer.stats.maxMp); break;
+                    case PlayerLevel: valid = readInt(field, outPlayer.stats.level); break;
+                    case PlayerExperience: valid = readInt(field, outPlayer.stats.experience); break;
+                    case PlayerExperienceToNext: valid = readInt(field, outPlayer.stats.experienceToNext); break;
+
+                    case PlayerInventoryItem: {
+                        if (field.type != BinaryWireType::LengthDelimited) {
+                            return false;
+                        }
+
+                        PlayerData::InventoryItem item;
+                        BinarySaveReader itemReader = field.asMessage();
+                        BinarySaveReader::Field itemField;
+                        bool itemValid = true;
+                        while (itemValid && itemReader.next(itemField)) {
+                            if (itemField.number == ENTRY_KEY) {
+                                itemValid = readString(itemField, item.id);
+                            } else if (itemField.number == ENTRY_VALUE) {
+                                itemValid = readInt(itemField, item.quantity);
+                            }
+                        }
+                        if (!itemValid || itemReader.hasError()) {
+                            return false;
+                        }
+                        outPlayer.inventory.push_back(std::move(item));
+                        break;
+                    }
+
+                    case PlayerEquipment:
+                        if (!readStringEntry(field, outPlayer.equipment)) {
+                            return false;
+                        }
+                        break;
+
+                    default:
+                        break;
+                }
+            }
+
+            return valid && !reader.hasError();
+        }
+
+        bool BinarySaveSerializer::readWorldData(BinarySaveReader reader, WorldData& outWorld) {
+            outWorld = WorldData();
+
+            BinarySaveReader::Field field;
+            while (reader.next(field)) {
+                switch (field.number) {
+                    case WorldCurrentMap:
+                        if (!readString(field, outWorld.currentMap)) {
+                            return false;
+                        }
+                        break;
+                    case WorldCompletedQuest:
+                        outWorld.completedQuests.emplace_back();
+                        if (!readString(field, outWorld.completedQuests.back())) {
+                            return false;
+                        }
+                        break;
+                    case WorldGameFlag:
+                        if (!readBoolEntry(field, outWorld.gameFlags)) {
+                            return false;
+                        }
+                        break;
+                    case WorldNpcState:
+                        if (!readStringEntry(field, outWorld.npcStates)) {
+                            return false;
+                        }
+                        break;
+                    case WorldDiscoveredLocation:
+                        if (!readBoolEntry(field, outWorld.discoveredLocations)) {
+                            return false;
+                        }
+                        break;
+                    default:
+                        break;
+                }
+            }
+
+            return !reader.hasError();
+        }
+
+    } // namespace Save
+} // namespace Engine
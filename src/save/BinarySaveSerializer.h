@@ -0,0 +1,174 @@
+#pragma once
+
+#include "SaveManager.h"
+#include <string>
+#include <string_view>
+#include <cstdint>
+#include <cstddef>
+
+namespace Engine {
+    namespace Save {
+
+        /**
+         * Binary save format
+         *
+         * An 8 byte header ("RSAV" magic, uint16 schema version, uint16
+         * flags, little endian) followed by tagged fields. Each field starts
+         * with a varint key (field number << 3 | wire type); integers are
+         * zigzag varints, floats fixed 32-bit and strings and nested
+         * messages length-delimited. Readers skip fields they do not know,
+         * so fields can be added without breaking older builds, and fields
+         * missing from older files keep their defaults.
+         */
+        const char BINARY_SAVE_MAGIC[4] = {'R', 'S', 'A', 'V'};
+        const uint16_t BINARY_SAVE_SCHEMA_VERSION = 1;
+        const size_t BINARY_SAVE_HEADER_SIZE = 8;
+
+        /**
+         * Field wire types
+         */
+        enum class BinaryWireType : uint8_t {
+            Varint = 0,
+            LengthDelimited = 2,
+            Fixed32 = 5
+        };
+
+        /**
+         * Appends tagged fields to a string
+         */
+        class BinarySaveWriter {
+        public:
+            explicit BinarySaveWriter(std::string& output) : m_output(output) {}
+
+            void writeVarint(uint64_t value);
+            void writeKey(uint32_t field, BinaryWireType type);
+
+            void writeUInt(uint32_t field, uint64_t value);
+            void writeInt(uint32_t field, int64_t value);
+            void writeBool(uint32_t field, bool value);
+            void writeFloat(uint32_t field, float value);
+            void writeString(uint32_t field, std::string_view value);
+
+            /**
+             * Start a nested message
+             * @param field Field number
+             * @return Marker to pass to endMessage
+             */
+            size_t beginMessage(uint32_t field);
+
+            /**
+             * Finish a nested message and patch its length
+             * @param marker Marker from beginMessage
+             */
+            void endMessage(size_t marker);
+
+        private:
+            std::string& m_output;
+        };
+
+        /**
+         * Zero-copy field reader
+         * Walks tagged fields in place; string and message fields are views
+         * into the input, which must outlive the reader.
+         */
+        class BinarySaveReader {
+        public:
+            struct Field {
+                uint32_t number = 0;
+                BinaryWireType type = BinaryWireType::Varint;
+                uint64_t varint = 0;
+                uint32_t fixed32 = 0;
+                std::string_view bytes;
+
+                int64_t asInt() const;
+                bool asBool() const { return varint != 0; }
+                float asFloat() const;
+                BinarySaveReader asMessage() const { return BinarySaveReader(bytes.data(), bytes.size()); }
+            };
+
+            BinarySaveReader(const char* data, size_t size) : m_data(data), m_size(size), m_pos(0), m_error(false) {}
+
+            /**
+             * Read the next field
+             * @param outField Receives the field
+             * @return false at the end of the input or on malformed data
+             */
+            bool next(Field& outField);
+
+            /**
+             * Check whether reading stopped on malformed data
+             * @return true if the input was malformed
+             */
+            bool hasError() const { return m_error; }
+
+        private:
+            bool readVarint(uint64_t& outValue);
+
+            const char* m_data;
+            size_t m_size;
+            size_t m_pos;
+            bool m_error;
+        };
+
+        /**
+         * Binary save serializer
+         * Compact, DOM-free alternative to JsonSaveSerializer for large saves.
+         */
+        class BinarySaveSerializer : public ISaveSerializer {
+        public:
+            BinarySaveSerializer() = default;
+            ~BinarySaveSerializer() override = default;
+
+            std::string serialize(const SaveData& data) override;
+            bool deserialize(const std::string& data, SaveData& outData) override;
+
+            /**
+             * Check whether data is in the binary save format
+             * @param data Serialized data
+             * @return true if the data starts with the binary save header
+             */
+            static bool isBinarySave(std::string_view data);
+
+            /**
+             * Read the schema version from the header
+             * @param data Serialized data
+             * @param outSchema Receives the schema version
+             * @return true if the header is valid
+             */
+            static bool readSchemaVersion(std::string_view data, uint16_t& outSchema);
+
+            /**
+             * Read the save data version without decoding the rest of the save,
+             * e.g. to decide on migrateSaveData before a full load
+             * @param data Serialized data
+             * @param outVersion Receives SaveData::version
+             * @return true if the version field was found
+             */
+            static bool peekVersion(std::string_view data, std::string& outVersion);
+
+            /**
+             * Encode a journal delta as tagged fields (no file header, the
+             * journal frames each record itself)
+             * @param delta Recorded changes
+             * @return Encoded record payload
+             */
+            std::string serializeDelta(const SaveDelta& delta);
+
+            /**
+             * Decode a journal delta
+             * @param data Record payload
+             * @param outDelta Receives the changes
+             * @return true if the record decoded
+             */
+            bool deserializeDelta(std::string_view data, SaveDelta& outDelta);
+
+        private:
+            void writePlayerData(BinarySaveWriter& writer, const PlayerData& player);
+            void writeWorldData(BinarySaveWriter& writer, const WorldData& world);
+
+            bool readPlayerData(BinarySaveReader reader, PlayerData& outPlayer);
+            bool readWorldData(BinarySaveReader reader, WorldData& outWorld);
+        };
+
+    } // namespace Save
+} // namespace Engine
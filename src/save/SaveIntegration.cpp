@@ -8,6 +8,7 @@
 #include <nlohmann/json.hpp>
 #include <fstream>
 #include <sstream>
+#include <unordered_set>
 
 // Forward declarations to avoid circular dependencies
 namespace RPGEngine {
@@ -35,8 +36,99 @@ namespace RPGEngine {
 namespace Engine {
     namespace Save {
         
+        namespace {
+            
+            bool samePlayer(const PlayerData& a, const PlayerData& b) {
+                if (a.position.x != b.position.x || a.position.y != b.position.y ||
+                    a.stats.hp != b.stats.hp || a.stats.maxHp != b.stats.maxHp ||
+                    a.stats.mp != b.stats.mp || a.stats.maxMp != b.stats.maxMp ||
+                    a.stats.level != b.stats.level || a.stats.experience != b.stats.experience ||
+                    a.stats.experienceToNext != b.stats.experienceToNext ||
+                    a.inventory.size() != b.inventory.size() || a.equipment != b.equipment) {
+                    return false;
+                }
+                
+                for (size_t i = 0; i < a.inventory.size(); ++i) {
+                    if (a.inventory[i].id != b.inventory[i].id || a.inventory[i].quantity != b.inventory[i].quantity) {
+                        return false;
+                    }
+                }
+                return true;
+            }
+            
+            // Record changed and added entries; false if one was removed
+            template<typename Map, typename Setter>
+            bool recordMapChanges(const Map& saved, const Map& current, Setter set) {
+                for (const auto& pair : saved) {
+                    if (current.find(pair.first) == current.end()) {
+                        return false;
+                    }
+                }
+                for (const auto& pair : current) {
+                    auto it = saved.find(pair.first);
+                    if (it == saved.end() || it->second != pair.second) {
+                        set(pair.first, pair.second);
+                    }
+                }
+                return true;
+            }
+            
+            /**
+             * Record the changes between two captures as a delta
+             * @param saved State the journaled slot holds
+             * @param current State just captured
+             * @param outDelta Receives the changes
+             * @return false if the changes need a full save (something was removed)
+             */
+            bool recordChanges(const SaveData& saved, const SaveData& current, SaveDelta& outDelta) {
+                const WorldData& before = saved.world;
+                const WorldData& after = current.world;
+                
+                if (!recordMapChanges(before.gameFlags, after.gameFlags,
+                                      [&outDelta](const std::string& key, bool value) { outDelta.setFlag(key, value); }) ||
+                    !recordMapChanges(before.npcStates, after.npcStates,
+                                      [&outDelta](const std::string& key, const std::string& value) { outDelta.setNpcState(key, value); }) ||
+                    !recordMapChanges(before.discoveredLocations, after.discoveredLocations,
+                                      [&outDelta](const std::string& key, bool value) { outDelta.setLocationDiscovered(key, value); }) ||
+                    !recordMapChanges(saved.customData, current.customData,
+                                      [&outDelta](const std::string& key, const std::string& value) { outDelta.setCustomData(key, value); })) {
+                    return false;
+                }
+                
+                // A delta can only add completed quests
+                std::unordered_set<std::string> completedNow(after.completedQuests.begin(), after.completedQuests.end());
+                for (const auto& quest : before.completedQuests) {
+                    if (completedNow.find(quest) == completedNow.end()) {
+                        return false;
+                    }
+                }
+                std::unordered_set<std::string> completedBefore(before.completedQuests.begin(), before.completedQuests.end());
+                for (const auto& quest : after.completedQuests) {
+                    if (completedBefore.insert(quest).second) {
+                        outDelta.completeQuest(quest);
+                    }
+                }
+                
+                if (after.currentMap != before.currentMap) {
+                    if (after.currentMap.empty()) {
+                        return false;
+                    }
+                    outDelta.setCurrentMap(after.currentMap);
+                }
+                
+                if (!samePlayer(saved.player, current.player)) {
+                    outDelta.setPlayer(current.player);
+                }
+                return true;
+            }
+            
+        } // namespace
+        
         SaveIntegration::SaveIntegration()
             : m_forceAutoSave(false)
+            , m_autoSaveIndex(0)
+            , m_lastCaptureTime(0.0f)
+            , m_deltasSinceCheckpoint(0)
             , m_initialized(false)
         {
             m_lastAutoSave = std::chrono::steady_clock::now();
@@ -82,6 +174,8 @@ namespace Engine {
         }
         
         void SaveIntegration::shutdown() {
+            waitForSaves();
+            
             m_saveManager.reset();
             m_entityManager.reset();
             m_componentManager.reset();
@@ -93,24 +187,36 @@ namespace Engine {
             
             m_systemSerializers.clear();
             m_systemDeserializers.clear();
+            resetAutoSaveJournal();
             
             m_initialized = false;
         }
         
         void SaveIntegration::update(float deltaTime) {
-            if (!m_initialized || !m_autoSaveConfig.enabled) {
+            if (!m_initialized) {
                 return;
             }
             
-            if (shouldAutoSave() || m_forceAutoSave) {
-                SaveIntegrationResult result = autoSave();
-                
-                if (m_callbacks.onAutoSave) {
-                    if (result == SaveIntegrationResult::Success) {
-                        m_callbacks.onAutoSave("Auto-save completed successfully");
-                    } else {
-                        m_callbacks.onAutoSave("Auto-save failed: " + getLastError());
+            // Deliver finished background saves
+            m_saveManager->update();
+            
+            if (!m_autoSaveConfig.enabled) {
+                return;
+            }
+            
+            if ((shouldAutoSave() || m_forceAutoSave) && !m_saveManager->isSaveInProgress()) {
+                auto report = [this](SaveIntegrationResult result) {
+                    if (m_callbacks.onAutoSave) {
+                        if (result == SaveIntegrationResult::Success) {
+                            m_callbacks.onAutoSave("Auto-save completed successfully");
+                        } else {
+                            m_callbacks.onAutoSave("Auto-save failed: " + getLastError());
+                        }
                     }
+                };
+                
+                if (!autoSaveAsync(report)) {
+                    report(SaveIntegrationResult::DataError);
                 }
                 
                 m_forceAutoSave = false;
@@ -130,21 +236,11 @@ namespace Engine {
             }
             
             SaveResult result = m_saveManager->saveGame(gameState.saveData, slotName);
+            SaveIntegrationResult integrationResult = toIntegrationResult(result);
             
-            SaveIntegrationResult integrationResult;
-            switch (result) {
-                case SaveResult::Success:
-                    integrationResult = SaveIntegrationResult::Success;
-                    break;
-                case SaveResult::ValidationError:
-                    integrationResult = SaveIntegrationResult::ValidationError;
-                    break;
-                case SaveResult::FileError:
-                    integrationResult = SaveIntegrationResult::FileError;
-                    break;
-                default:
-                    integrationResult = SaveIntegrationResult::SystemError;
-                    break;
+            // A full save starts the slot's journal over
+            if (slotName == m_journalSlot) {
+                resetAutoSaveJournal();
             }
             
             if (m_callbacks.onSaveComplete) {
@@ -154,6 +250,157 @@ namespace Engine {
             return integrationResult;
         }
         
+        bool SaveIntegration::saveGameStateAsync(const std::string& slotName,
+                                                 std::function<void(SaveIntegrationResult)> callback) {
+            if (!m_initialized) {
+                setError("SaveIntegration not initialized");
+                return false;
+            }
+            
+            // Capture: copy player and world data, the only state SaveManager
+            // writes. Everything else happens on the save worker.
+            auto captureStart = std::chrono::steady_clock::now();
+            
+            SaveData snapshot;
+            if (!captureSaveData(snapshot)) {
+                return false;
+            }
+            
+            if (slotName == m_journalSlot) {
+                resetAutoSaveJournal();
+            }
+            
+            bool queued = m_saveManager->saveGameAsync(std::move(snapshot), slotName,
+                [this, callback](SaveResult result, const std::string&) {
+                    finishSave(result, callback);
+                });
+            
+            m_lastCaptureTime = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - captureStart).count();
+            
+            if (!queued) {
+                setError(m_saveManager->getLastError());
+                return false;
+            }
+            
+            clearError();
+            return true;
+        }
+        
+        bool SaveIntegration::autoSaveAsync(std::function<void(SaveIntegrationResult)> callback) {
+            if (!m_autoSaveConfig.enabled) {
+                setError("Auto-save is disabled");
+                return false;
+            }
+            
+            if (!m_initialized) {
+                setError("SaveIntegration not initialized");
+                return false;
+            }
+            
+            auto captureStart = std::chrono::steady_clock::now();
+            
+            auto snapshot = std::make_shared<SaveData>();
+            if (!captureSaveData(*snapshot)) {
+                return false;
+            }
+            
+            // Journal what changed since the last auto-save into its slot
+            SaveDelta delta;
+            bool queued = false;
+            if (m_journalBaseline && m_deltasSinceCheckpoint < m_autoSaveConfig.deltaSavesPerCheckpoint &&
+                recordChanges(*m_journalBaseline, *snapshot, delta)) {
+                queued = m_saveManager->saveDeltaAsync(std::move(delta), m_journalSlot,
+                    [this, snapshot, callback](SaveResult result, const std::string&) {
+                        if (result == SaveResult::Success) {
+                            m_journalBaseline = snapshot;
+                        } else {
+                            resetAutoSaveJournal();
+                        }
+                        finishSave(result, callback);
+                    });
+                if (queued) {
+                    ++m_deltasSinceCheckpoint;
+                }
+            } else {
+                // Checkpoint: a full save to the next rotating slot
+                std::string autoSaveSlot = "autosave_" + std::to_string(m_autoSaveIndex);
+                resetAutoSaveJournal();
+                queued = m_saveManager->saveGameAsync(*snapshot, autoSaveSlot,
+                    [this, snapshot, callback](SaveResult result, const std::string& slot) {
+                        if (result == SaveResult::Success) {
+                            m_journalSlot = slot;
+                            m_journalBaseline = snapshot;
+                            m_deltasSinceCheckpoint = 0;
+                            m_autoSaveIndex = (m_autoSaveIndex + 1) % m_autoSaveConfig.maxAutoSaves;
+                        }
+                        finishSave(result, callback);
+                    });
+            }
+            
+            m_lastCaptureTime = std::chrono::duration<float, std::milli>(std::chrono::steady_clock::now() - captureStart).count();
+            
+            if (!queued) {
+                setError(m_saveManager->getLastError());
+                return false;
+            }
+            
+            clearError();
+            return true;
+        }
+        
+        bool SaveIntegration::captureSaveData(SaveData& outData) {
+            outData.version = "1.0";
+            if (!collectPlayerData(outData.player)) {
+                setError("Failed to collect player data");
+                return false;
+            }
+            if (!collectWorldData(outData.world)) {
+                setError("Failed to collect world data");
+                return false;
+            }
+            return true;
+        }
+        
+        void SaveIntegration::finishSave(SaveResult result, const std::function<void(SaveIntegrationResult)>& callback) {
+            SaveIntegrationResult integrationResult = toIntegrationResult(result);
+            if (integrationResult != SaveIntegrationResult::Success) {
+                setError(m_saveManager->getLastError());
+            }
+            
+            if (m_callbacks.onSaveComplete) {
+                m_callbacks.onSaveComplete(integrationResult);
+            }
+            if (callback) {
+                callback(integrationResult);
+            }
+        }
+        
+        void SaveIntegration::resetAutoSaveJournal() {
+            m_journalSlot.clear();
+            m_journalBaseline.reset();
+            m_deltasSinceCheckpoint = 0;
+        }
+        
+        void SaveIntegration::waitForSaves() {
+            if (m_saveManager) {
+                m_saveManager->waitForSaves();
+                m_saveManager->update();
+            }
+        }
+        
+        SaveIntegrationResult SaveIntegration::toIntegrationResult(SaveResult result) {
+            switch (result) {
+                case SaveResult::Success:
+                    return SaveIntegrationResult::Success;
+                case SaveResult::ValidationError:
+                    return SaveIntegrationResult::ValidationError;
+                case SaveResult::FileError:
+                    return SaveIntegrationResult::FileError;
+                default:
+                    return SaveIntegrationResult::SystemError;
+            }
+        }
+        
         SaveIntegrationResult SaveIntegration::saveGameState(int slotNumber) {
             return saveGameState("slot_" + std::to_string(slotNumber));
         }
@@ -198,14 +445,15 @@ namespace Engine {
                 return SaveIntegrationResult::SystemError;
             }
             
-            // Use rotating auto-save slots
-            static int autoSaveIndex = 0;
-            std::string autoSaveSlot = "autosave_" + std::to_string(autoSaveIndex);
+            // Use rotating auto-save slots; a synchronous auto-save is always a
+            // checkpoint, so background auto-saves start a new journal after it
+            std::string autoSaveSlot = "autosave_" + std::to_string(m_autoSaveIndex);
+            resetAutoSaveJournal();
             
             SaveIntegrationResult result = saveGameState(autoSaveSlot);
             
             if (result == SaveIntegrationResult::Success) {
-                autoSaveIndex = (autoSaveIndex + 1) % m_autoSaveConfig.maxAutoSaves;
+                m_autoSaveIndex = (m_autoSaveIndex + 1) % m_autoSaveConfig.maxAutoSaves;
             }
             
             return result;
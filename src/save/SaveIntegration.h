@@ -37,6 +37,7 @@ namespace Engine {
             bool saveOnLevelUp = true;
             bool saveOnQuestComplete = true;
             bool saveOnCombatEnd = true;
+            int deltaSavesPerCheckpoint = 10;   // Journaled auto-saves between full saves (0 = always full)
         };
         
         /**
@@ -151,6 +152,41 @@ namespace Engine {
              */
             SaveIntegrationResult autoSave();
             
+            /**
+             * Save game state in the background
+             * Captures player and world data on this thread, then serialization,
+             * compression and the file write run on the save worker. The
+             * callback and onSaveComplete run from update().
+             * @param slotName Save slot name
+             * @param callback Optional completion callback
+             * @return false if capture or validation failed and nothing was queued
+             */
+            bool saveGameStateAsync(const std::string& slotName,
+                                    std::function<void(SaveIntegrationResult)> callback = nullptr);
+            
+            /**
+             * Auto save in the background
+             * Writes a full save (checkpoint) to the next rotating auto-save
+             * slot, then appends only what changed since the previous auto-save
+             * to that slot's journal, for deltaSavesPerCheckpoint auto-saves.
+             * Changes a journal can't express (e.g. a removed flag) force a
+             * new checkpoint.
+             * @param callback Optional completion callback
+             * @return false if nothing was queued
+             */
+            bool autoSaveAsync(std::function<void(SaveIntegrationResult)> callback = nullptr);
+            
+            /**
+             * Finish background saves and run their callbacks
+             */
+            void waitForSaves();
+            
+            /**
+             * Get the game thread time of the last background save capture
+             * @return Capture time in milliseconds
+             */
+            float getLastCaptureTime() const { return m_lastCaptureTime; }
+            
             /**
              * Set audio managers for save integration
              * @param musicManager Music manager
@@ -236,6 +272,32 @@ namespace Engine {
              */
             bool collectGameState(GameStateData& outGameState);
             
+            /**
+             * Capture the player and world data SaveManager writes
+             * @param outData Output save data
+             * @return true if capture was successful
+             */
+            bool captureSaveData(SaveData& outData);
+            
+            /**
+             * Report a finished background save
+             * @param result Save result
+             * @param callback Optional completion callback
+             */
+            void finishSave(SaveResult result, const std::function<void(SaveIntegrationResult)>& callback);
+            
+            /**
+             * Forget the journaled auto-save slot (the next auto-save is a checkpoint)
+             */
+            void resetAutoSaveJournal();
+            
+            /**
+             * Convert a save manager result
+             * @param result Save result
+             * @return Save integration result
+             */
+            static SaveIntegrationResult toIntegrationResult(SaveResult result);
+            
             /**
              * Restore complete game state
              * @param gameState Game state data to restore
@@ -335,6 +397,14 @@ namespace Engine {
             AutoSaveConfig m_autoSaveConfig;
             std::chrono::steady_clock::time_point m_lastAutoSave;
             bool m_forceAutoSave;
+            int m_autoSaveIndex;
+            float m_lastCaptureTime;
+            
+            // Journaled auto-saves: the slot deltas are appended to and the
+            // state it holds once queued saves are written
+            std::string m_journalSlot;
+            std::shared_ptr<const SaveData> m_journalBaseline;
+            int m_deltasSinceCheckpoint;
             
             // System state serializers
             std::unordered_map<std::string, std::function<std::string()>> m_systemSerializers;
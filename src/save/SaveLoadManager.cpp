@@ -92,6 +92,11 @@ namespace Engine {
         }
         
         void SaveLoadManager::shutdown() {
+            // Deliver pending save callbacks while the UI still exists
+            if (m_initialized && m_saveIntegration) {
+                m_saveIntegration->waitForSaves();
+            }
+            
             if (m_ui) {
                 m_ui->shutdown();
                 m_ui.reset();
@@ -127,41 +132,15 @@ namespace Engine {
         }
         
         void SaveLoadManager::saveGame(int slotNumber, std::function<void(bool, const std::string&)> callback) {
-            if (!m_initialized || m_isSaving) {
-                if (callback) callback(false, "Save operation already in progress");
-                return;
-            }
-            
-            m_isSaving = true;
-            clearError();
-            
-            // Send save started event
-            SaveLoadEventData eventData;
-            eventData.type = SaveLoadEventType::SaveStarted;
-            eventData.slotNumber = slotNumber;
-            eventData.slotName = "slot_" + std::to_string(slotNumber);
-            sendEvent(eventData);
-            
-            auto startTime = std::chrono::steady_clock::now();
-            
-            SaveIntegrationResult result = m_saveIntegration->saveGameState(slotNumber);
-            
-            auto endTime = std::chrono::steady_clock::now();
-            float duration = std::chrono::duration<float>(endTime - startTime).count();
-            
-            handleSaveCompletion(result, "slot_" + std::to_string(slotNumber), callback);
-            
-            // Send completion event
-            eventData.type = (result == SaveIntegrationResult::Success) ? 
-                SaveLoadEventType::SaveCompleted : SaveLoadEventType::SaveFailed;
-            eventData.duration = duration;
-            if (result != SaveIntegrationResult::Success) {
-                eventData.errorMessage = getLastError();
-            }
-            sendEvent(eventData);
+            startSave("slot_" + std::to_string(slotNumber), slotNumber, callback);
         }
         
         void SaveLoadManager::saveGame(const std::string& slotName, std::function<void(bool, const std::string&)> callback) {
+            startSave(slotName, -1, callback);
+        }
+        
+        void SaveLoadManager::startSave(const std::string& slotName, int slotNumber,
+                                        std::function<void(bool, const std::string&)> callback) {
             if (!m_initialized || m_isSaving) {
                 if (callback) callback(false, "Save operation already in progress");
                 return;
@@ -173,26 +152,32 @@ namespace Engine {
             // Send save started event
             SaveLoadEventData eventData;
             eventData.type = SaveLoadEventType::SaveStarted;
+            eventData.slotNumber = slotNumber;
             eventData.slotName = slotName;
             sendEvent(eventData);
             
             auto startTime = std::chrono::steady_clock::now();
             
-            SaveIntegrationResult result = m_saveIntegration->saveGameState(slotName);
-            
-            auto endTime = std::chrono::steady_clock::now();
-            float duration = std::chrono::duration<float>(endTime - startTime).count();
-            
-            handleSaveCompletion(result, slotName, callback);
+            // Only the capture happens this frame; completion arrives via update()
+            auto onComplete = [this, eventData, startTime, slotName, callback](SaveIntegrationResult result) mutable {
+                auto endTime = std::chrono::steady_clock::now();
+                float duration = std::chrono::duration<float>(endTime - startTime).count();
+                
+                handleSaveCompletion(result, slotName, callback);
+                
+                // Send completion event
+                eventData.type = (result == SaveIntegrationResult::Success) ? 
+                    SaveLoadEventType::SaveCompleted : SaveLoadEventType::SaveFailed;
+                eventData.duration = duration;
+                if (result != SaveIntegrationResult::Success) {
+                    eventData.errorMessage = getLastError();
+                }
+                sendEvent(eventData);
+            };
             
-            // Send completion event
-            eventData.type = (result == SaveIntegrationResult::Success) ? 
-                SaveLoadEventType::SaveCompleted : SaveLoadEventType::SaveFailed;
-            eventData.duration = duration;
-            if (result != SaveIntegrationResult::Success) {
-                eventData.errorMessage = getLastError();
+            if (!m_saveIntegration->saveGameStateAsync(slotName, onComplete)) {
+                onComplete(SaveIntegrationResult::DataError);
             }
-            sendEvent(eventData);
         }
         
         void SaveLoadManager::loadGame(int slotNumber, std::function<void(bool, const std::string&)> callback) {
@@ -290,13 +275,23 @@ namespace Engine {
                 return;
             }
             
-            SaveIntegrationResult result = m_saveIntegration->autoSave();
+            if (m_isSaving || m_saveIntegration->getSaveManager()->isSaveInProgress()) {
+                if (callback) callback(false, "Save operation already in progress");
+                return;
+            }
             
-            bool success = (result == SaveIntegrationResult::Success);
-            std::string message = success ? "Auto-save completed" : getLastError();
+            // Written in the background; the callback runs from update()
+            auto onComplete = [this, callback](SaveIntegrationResult result) {
+                bool success = (result == SaveIntegrationResult::Success);
+                std::string message = success ? "Auto-save completed" : m_saveIntegration->getLastError();
+                
+                if (callback) {
+                    callback(success, message);
+                }
+            };
             
-            if (callback) {
-                callback(success, message);
+            if (!m_saveIntegration->autoSaveAsync(onComplete)) {
+                onComplete(SaveIntegrationResult::DataError);
             }
         }
         
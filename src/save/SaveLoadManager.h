@@ -102,6 +102,7 @@ namespace Engine {
             
             /**
              * Save game to specific slot
+             * The save is written in the background; the callback runs from update().
              * @param slotNumber Slot number (0-based)
              * @param callback Optional completion callback
              */
@@ -109,6 +110,7 @@ namespace Engine {
             
             /**
              * Save game to named slot
+             * The save is written in the background; the callback runs from update().
              * @param slotName Slot name
              * @param callback Optional completion callback
              */
@@ -268,6 +270,15 @@ namespace Engine {
             std::vector<RPGEngine::UI::SaveSlotInfo> getSaveSlots() const;
             
         private:
+            /**
+             * Start a background save
+             * @param slotName Slot name
+             * @param slotNumber Slot number for events (-1 for named slots)
+             * @param callback Completion callback
+             */
+            void startSave(const std::string& slotName, int slotNumber,
+                           std::function<void(bool, const std::string&)> callback);
+            
             /**
              * Handle save completion
              * @param result Save result
@@ -5,8 +5,16 @@
 #include <functional>
 #include <vector>
 #include <unordered_map>
+#include <cstdint>
+#include <mutex>
 #include "../core/Types.h"
 
+namespace RPGEngine {
+namespace Core {
+class ThreadPool;
+}
+}
+
 namespace Engine {
     namespace Save {
         
@@ -34,9 +42,20 @@ namespace Engine {
             VersionMismatch
         };
         
+        // Save payload compression codec (stored in each save file's header)
+        enum class SaveCompression : uint8_t {
+            None = 0,
+            LZ4 = 1,        // In-tree, always available
+            Zlib = 2,       // Requires RPG_HAVE_ZLIB
+            Zstd = 3        // Requires RPG_HAVE_ZSTD
+        };
+        
         // Save data validation callback
         using ValidationCallback = std::function<bool(const SaveData&)>;
         
+        // Background save completion callback (called from SaveManager::update)
+        using SaveCompletionCallback = std::function<void(SaveResult, const std::string& slotName)>;
+        
         // Save data serialization interface
         class ISaveSerializer {
         public:
@@ -82,6 +101,16 @@ namespace Engine {
             std::unordered_map<std::string, bool> discoveredLocations;
         };
         
+        // Save slot screenshot, stored in the save file header rather than
+        // the serialized payload so the load menu can show it without a load
+        struct SaveThumbnail {
+            int width = 0;
+            int height = 0;
+            std::vector<uint8_t> pixels;    // RGBA8, row-major
+            
+            bool isEmpty() const { return pixels.empty(); }
+        };
+        
         // Complete save data structure
         struct SaveData {
             std::string version = "1.0";
@@ -89,6 +118,35 @@ namespace Engine {
             PlayerData player;
             WorldData world;
             std::unordered_map<std::string, std::string> customData;
+            SaveThumbnail thumbnail;
+        };
+        
+        // State changes recorded by gameplay since the last save, appended to
+        // the slot's journal by SaveManager::saveDelta instead of rewriting
+        // the whole save. A later change to the same key replaces the earlier
+        // one, so a delta stays as small as the set of keys that changed.
+        struct SaveDelta {
+            std::string timestamp;          // Stamped by SaveManager
+            std::unordered_map<std::string, bool> gameFlags;
+            std::unordered_map<std::string, std::string> npcStates;
+            std::unordered_map<std::string, bool> discoveredLocations;
+            std::vector<std::string> completedQuests;
+            std::unordered_map<std::string, std::string> customData;
+            std::string currentMap;         // Empty when unchanged
+            bool hasPlayer = false;
+            PlayerData player;              // Small, so recorded whole
+            
+            void setFlag(const std::string& flag, bool value) { gameFlags[flag] = value; }
+            void setNpcState(const std::string& npc, const std::string& state) { npcStates[npc] = state; }
+            void setLocationDiscovered(const std::string& location, bool discovered) { discoveredLocations[location] = discovered; }
+            void completeQuest(const std::string& quest) { completedQuests.push_back(quest); }
+            void setCustomData(const std::string& key, const std::string& value) { customData[key] = value; }
+            void setCurrentMap(const std::string& map) { currentMap = map; }
+            void setPlayer(const PlayerData& data) { player = data; hasPlayer = true; }
+            
+            bool isEmpty() const;
+            void clear() { *this = SaveDelta(); }
+            void applyTo(SaveData& data) const;
         };
         
         // Main SaveManager class
@@ -106,6 +164,29 @@ namespace Engine {
             SaveResult saveGame(const SaveData& data, int slotNumber);
             SaveResult autoSave(const SaveData& data);
             
+            // Background save operations. The data is validated and stamped on
+            // the calling thread, then serialized, compressed and written on a
+            // save worker; callbacks run from update() on the calling thread.
+            // Saves are written in submission order.
+            bool saveGameAsync(SaveData data, const std::string& slotName, SaveCompletionCallback callback = nullptr);
+            void update();
+            bool isSaveInProgress() const { return m_pendingSaves > 0; }
+            void waitForSaves() const;
+            
+            // Journaled saves. A delta is appended to the journal next to the
+            // slot's last full save (its checkpoint), so the cost follows the
+            // amount of change rather than the world size; loads replay the
+            // journal over the checkpoint. A record torn by a crash mid-append
+            // ends the replay and is cut off by the next append. Loads wait
+            // for queued saves first. A journal that outgrows the
+            // journal limit is folded into a new checkpoint. Full saves to the
+            // slot start a new, empty journal.
+            SaveResult saveDelta(const SaveDelta& delta, const std::string& slotName = "quicksave");
+            bool saveDeltaAsync(SaveDelta delta, const std::string& slotName, SaveCompletionCallback callback = nullptr);
+            SaveResult compactJournal(const std::string& slotName);
+            void setMaxJournalSize(size_t bytes) { m_maxJournalSize = bytes; }
+            size_t getMaxJournalSize() const { return m_maxJournalSize; }
+            
             // Load operations
             LoadResult loadGame(SaveData& outData, const std::string& slotName = "quicksave");
             LoadResult loadGame(SaveData& outData, int slotNumber);
@@ -126,11 +207,24 @@ namespace Engine {
                 int playerLevel;
                 std::string currentMap;
                 size_t fileSize;
+                int thumbnailWidth = 0;
+                int thumbnailHeight = 0;
+                
+                bool hasThumbnail() const { return thumbnailWidth > 0 && thumbnailHeight > 0; }
             };
             
+            // Listing reads only the fixed-size metadata header of each save
+            // (older files without one are fully loaded once), reuses entries
+            // from the slot index file while a save's size and write time are
+            // unchanged, and reads headers on the job system when one is set.
             std::vector<SaveInfo> getSaveList() const;
             bool getSaveInfo(const std::string& slotName, SaveInfo& outInfo) const;
             bool getSaveInfo(int slotNumber, SaveInfo& outInfo) const;
+            bool loadThumbnail(const std::string& slotName, SaveThumbnail& outThumbnail) const;
+            
+            void setJobSystem(std::shared_ptr<RPGEngine::Core::ThreadPool> jobSystem) { m_jobSystem = jobSystem; }
+            void setSaveIndexEnabled(bool enabled) { m_saveIndexEnabled = enabled; }
+            bool isSaveIndexEnabled() const { return m_saveIndexEnabled; }
             
             // Configuration
             void setMaxSaveSlots(int maxSlots) { m_maxSaveSlots = maxSlots; }
@@ -159,6 +253,9 @@ namespace Engine {
             // Compression and security
             void setCompressionEnabled(bool enabled) { m_compressionEnabled = enabled; }
             bool isCompressionEnabled() const { return m_compressionEnabled; }
+            bool setCompression(SaveCompression compression);
+            SaveCompression getCompression() const { return m_compression; }
+            static bool isCompressionSupported(SaveCompression compression);
             void setChecksumValidation(bool enabled) { m_checksumValidation = enabled; }
             bool isChecksumValidationEnabled() const { return m_checksumValidation; }
             
@@ -172,21 +269,74 @@ namespace Engine {
             std::string getBackupFileName(const std::string& originalFile, int backupIndex) const;
             
             bool validateSaveData(const SaveData& data);
-            bool createBackup(const std::string& filePath);
+            bool validatePlayerData(const PlayerData& player);
+            bool validateSaveDelta(const SaveDelta& delta);
+            std::string makeTimestamp() const;
+            bool createBackup(const std::string& filePath, int maxBackups, std::string& outError) const;
             void cleanupOldBackups(const std::string& baseFileName);
             
             // Data processing helpers
-            std::string compressData(const std::string& data);
-            std::string decompressData(const std::string& compressedData) const;
-            std::string calculateChecksum(const std::string& data) const;
-            bool verifyChecksum(const std::string& data, const std::string& expectedChecksum) const;
+            bool compressData(const std::string& data, SaveCompression compression, std::string& outData) const;
+            bool decompressData(const std::string& compressedData, SaveCompression compression,
+                                size_t rawSize, std::string& outData) const;
+            uint32_t calculateChecksum(const std::string& data) const;
+            std::string calculateLegacyChecksum(const std::string& data) const;
+            bool verifyLegacyChecksum(const std::string& data, const std::string& expectedChecksum) const;
+            LoadResult readLegacyPayload(const std::string& fileContent, std::string& outData, std::string& outError) const;
             
             // Version migration helpers
             bool migrateFromV1ToV2(SaveData& data);
             bool isVersionSupported(const std::string& version);
             
-            SaveResult writeToFile(const std::string& filePath, const SaveData& data);
+            // Settings captured when a save is submitted, so the worker never
+            // reads members the game thread may change
+            struct WriteSettings {
+                SaveCompression compression;
+                bool checksum;
+                bool backup;
+                int maxBackups;
+                size_t maxJournalSize;
+            };
+            
+            struct CompletedSave {
+                std::string slotName;
+                SaveResult result;
+                std::string error;
+                SaveCompletionCallback callback;
+            };
+            
+            // Slot index entry, valid while the file's size and write time match
+            struct SaveIndexEntry {
+                uint64_t fileSize;
+                int64_t writeTime;
+                SaveInfo info;
+            };
+            
+            enum class HeaderReadResult {
+                Success,
+                NoMetadata,     // Format version 1 or text header, needs a full read
+                Corrupted
+            };
+            
+            static HeaderReadResult readSaveHeader(const std::string& filePath, uint64_t fileSize, SaveInfo& outInfo);
+            bool readFullSaveInfo(const std::string& filePath, SaveInfo& outInfo) const;
+            void loadSaveIndex() const;
+            void writeSaveIndex() const;
+            std::string getSaveIndexFileName() const;
+            
+            WriteSettings getWriteSettings() const;
+            SaveResult writeToFile(const std::string& filePath, const SaveData& data,
+                                   const WriteSettings& settings, std::string& outError) const;
             LoadResult readFromFile(const std::string& filePath, SaveData& outData) const;
+            LoadResult decodeSaveFile(const std::string& filePath, SaveData& outData,
+                                      uint32_t& outCheckpointId, std::string& outError) const;
+            
+            // Journal helpers, safe to run on the save worker
+            std::string getJournalFileName(const std::string& saveFile) const;
+            SaveResult appendJournal(const std::string& filePath, const SaveDelta& delta,
+                                     const WriteSettings& settings, std::string& outError) const;
+            SaveResult foldJournal(const std::string& filePath, const WriteSettings& settings, std::string& outError) const;
+            void replayJournal(const std::string& filePath, uint32_t checkpointId, SaveData& data) const;
             
             void setError(const std::string& error) const { m_lastError = error; }
             void clearError() const { m_lastError.clear(); }
@@ -202,10 +352,24 @@ namespace Engine {
             bool m_backupEnabled;
             int m_maxBackups;
             bool m_compressionEnabled;
+            SaveCompression m_compression;
             bool m_checksumValidation;
+            size_t m_maxJournalSize;
             
             mutable std::string m_lastError;
             bool m_initialized;
+            
+            // Background saves
+            std::unique_ptr<RPGEngine::Core::ThreadPool> m_saveWorker;
+            std::mutex m_completedMutex;
+            std::vector<CompletedSave> m_completedSaves;
+            int m_pendingSaves;
+            
+            // Save listing
+            std::shared_ptr<RPGEngine::Core::ThreadPool> m_jobSystem;
+            bool m_saveIndexEnabled;
+            mutable bool m_saveIndexLoaded;
+            mutable std::unordered_map<std::string, SaveIndexEntry> m_saveIndex;
         };
         
     } // namespace Save
@@ -40,6 +40,13 @@ bool GameScene::loadMap(const std::string& mapId) {
     return true;
 }
 
+void GameScene::collectDependencies(Resources::PreloadManifest& manifest) {
+    std::string mapId = m_currentMapId.empty() ? getProperty("current_map") : m_currentMapId;
+    if (m_worldManager && !mapId.empty()) {
+        m_worldManager->buildMapManifest(mapId, manifest);
+    }
+}
+
 Entity GameScene::createPlayer(const std::string& name, float x, float y) {
     // Create player entity
     m_playerEntity = getEntityManager()->createEntity("Player_" + name);
@@ -76,6 +76,12 @@ public:
      */
     bool loadMap(const std::string& mapId);
     
+    /**
+     * List the resources of the current map (or the "current_map" property)
+     * @param manifest Manifest to add the resources to
+     */
+    void collectDependencies(Resources::PreloadManifest& manifest) override;
+    
     /**
      * Get current map ID
      * @return Current map ID
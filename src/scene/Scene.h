@@ -121,6 +121,14 @@ public:
      */
     virtual void handleInput(const std::string& event);
     
+    /**
+     * List resources the scene needs before it loads
+     * SceneManager preloads these (with its saved manifest) during the
+     * transition into the scene. The default lists nothing.
+     * @param manifest Manifest to add the resources to
+     */
+    virtual void collectDependencies(Resources::PreloadManifest& /*manifest*/) {}
+    
     /**
      * Get scene ID
      * @return Scene ID
@@ -1,6 +1,9 @@
 #include "SceneManager.h"
+#include "../resources/TextureResource.h"
+#include "../resources/AudioResource.h"
 #include <iostream>
 #include <algorithm>
+#include <filesystem>
 
 namespace RPGEngine {
 namespace Scene {
@@ -13,7 +16,12 @@ SceneManager::SceneManager(std::shared_ptr<EntityManager> entityManager,
     , m_componentManager(componentManager)
     , m_systemManager(systemManager)
     , m_resourceManager(resourceManager)
+    , m_manifestRecording(false)
 {
+    // Decode jobs run on the engine job system rather than a pool of their own
+    if (m_systemManager && m_resourceManager) {
+        m_resourceManager->setJobSystem(m_systemManager->getJobSystem());
+    }
 }
 
 SceneManager::~SceneManager() {
@@ -178,16 +186,30 @@ bool SceneManager::switchToScene(const std::string& sceneId, SceneTransitionType
         return false;
     }
     
+    // Preload the target's manifest while the transition plays; the scene
+    // itself loads when both are done
+    std::vector<std::shared_ptr<Resources::Resource>> preloading;
+    if (!targetScene->isLoaded() && m_resourceManager && !m_manifestDirectory.empty()) {
+        Resources::PreloadManifest manifest(sceneId);
+        buildManifest(targetScene, manifest);
+        if (!manifest.empty()) {
+            auto deadline = std::chrono::steady_clock::now() +
+                            std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<float>(transitionDuration));
+            preloading = preloadManifest(manifest, deadline);
+        }
+    }
+    bool loadPending = !targetScene->isLoaded() && !preloading.empty();
+    
     // Load target scene if not loaded
-    if (!targetScene->isLoaded()) {
-        if (!targetScene->load()) {
+    if (!targetScene->isLoaded() && !loadPending) {
+        if (!loadTargetScene(targetScene)) {
             std::cerr << "Failed to load target scene: " << sceneId << std::endl;
             return false;
         }
     }
     
     // If no current scene, just activate the target
-    if (m_currentSceneId.empty()) {
+    if (m_currentSceneId.empty() && !loadPending) {
         m_currentSceneId = sceneId;
         targetScene->activate();
         
@@ -198,9 +220,12 @@ bool SceneManager::switchToScene(const std::string& sceneId, SceneTransitionType
         return true;
     }
     
-    // Start transition
-    m_currentTransition = std::make_unique<SceneTransition>(m_currentSceneId, sceneId, transitionType, transitionDuration);
+    // Start transition (with no current scene, it lasts until the preload is done)
+    m_currentTransition = std::make_unique<SceneTransition>(m_currentSceneId, sceneId, transitionType,
+                                                            m_currentSceneId.empty() ? 0.0f : transitionDuration);
     m_currentTransition->onComplete = onComplete;
+    m_currentTransition->preloading = std::move(preloading);
+    m_currentTransition->loadPending = loadPending;
     
     std::cout << "Starting scene transition: " << m_currentSceneId << " -> " << sceneId << std::endl;
     
@@ -306,6 +331,21 @@ float SceneManager::getTransitionProgress() const {
     return m_currentTransition ? m_currentTransition->progress : 0.0f;
 }
 
+float SceneManager::getLoadProgress() const {
+    if (!m_currentTransition || m_currentTransition->preloading.empty()) {
+        return 1.0f;
+    }
+    
+    size_t done = 0;
+    for (const auto& resource : m_currentTransition->preloading) {
+        auto state = resource->getState();
+        if (state == Resources::ResourceState::Loaded || state == Resources::ResourceState::Failed) {
+            done++;
+        }
+    }
+    return static_cast<float>(done) / static_cast<float>(m_currentTransition->preloading.size());
+}
+
 SceneData SceneManager::saveSceneState(const std::string& sceneId) {
     auto scene = getScene(sceneId);
     if (!scene) {
@@ -355,6 +395,7 @@ bool SceneManager::loadAllSceneStates(const std::unordered_map<std::string, Scen
 void SceneManager::clearAllScenes() {
     // Clear current transition
     m_currentTransition.reset();
+    saveRecordedManifest(m_recordingSceneId);
     
     // Unload all scenes
     for (auto& pair : m_scenes) {
@@ -382,14 +423,127 @@ void SceneManager::updateTransition(float deltaTime) {
         return;
     }
     
+    if (m_currentTransition->loadPending) {
+        keepPreloadResident();
+    }
+    
     m_currentTransition->progress += deltaTime / m_currentTransition->duration;
     
-    if (m_currentTransition->progress >= 1.0f) {
+    if (m_currentTransition->duration <= 0.0f || m_currentTransition->progress >= 1.0f) {
         m_currentTransition->progress = 1.0f;
+        
+        // Hold the end of the transition until the target scene has loaded
+        if (m_currentTransition->loadPending) {
+            if (getLoadProgress() < 1.0f || !finishPendingLoad()) {
+                return;
+            }
+        }
         completeTransition();
     }
 }
 
+void SceneManager::keepPreloadResident() {
+    // Mark the preloaded set as used so budget eviction leaves it alone, and
+    // request again anything that was unloaded anyway (e.g. unloadResource())
+    uint64_t frame = m_resourceManager->getFrame();
+    Resources::PreloadManifest dropped(m_currentTransition->toSceneId);
+    for (const auto& resource : m_currentTransition->preloading) {
+        resource->touch(frame);
+        if (resource->getState() == Resources::ResourceState::Unloaded) {
+            dropped.add({resource->getId(), resource->getCategory(), resource->getPath()});
+        }
+    }
+    
+    if (!dropped.empty()) {
+        Resources::LoadOptions options;
+        options.priority = Resources::LoadPriority::High;
+        m_resourceManager->preload(dropped, options);
+    }
+}
+
+bool SceneManager::finishPendingLoad() {
+    auto targetScene = getScene(m_currentTransition->toSceneId);
+    m_currentTransition->loadPending = false;
+    m_currentTransition->preloading.clear();
+    
+    if (!targetScene || (!targetScene->isLoaded() && !loadTargetScene(targetScene))) {
+        std::cerr << "Failed to load target scene: " << m_currentTransition->toSceneId << std::endl;
+        m_currentTransition.reset();
+        return false;
+    }
+    return true;
+}
+
+std::string SceneManager::getManifestPath(const std::string& sceneId) const {
+    return (std::filesystem::path(m_manifestDirectory) / (sceneId + ".manifest")).string();
+}
+
+void SceneManager::buildManifest(const std::shared_ptr<Scene>& scene, Resources::PreloadManifest& manifest) {
+    // A missing manifest just means the scene hasn't been recorded yet
+    manifest.loadFromFile(getManifestPath(scene->getSceneId()));
+    scene->collectDependencies(manifest);
+}
+
+std::vector<std::shared_ptr<Resources::Resource>> SceneManager::preloadManifest(const Resources::PreloadManifest& manifest,
+                                                                                std::chrono::steady_clock::time_point deadline) {
+    // Register what loading the scene would create, with the same IDs, in
+    // one table update
+    std::vector<std::shared_ptr<Resources::Resource>> missing;
+    for (const auto& entry : manifest.getEntries()) {
+        if (m_resourceManager->hasResource(entry.id) || entry.path.empty()) {
+            continue;
+        }
+        
+        if (entry.category == Resources::ResourceCategory::Texture) {
+            missing.push_back(std::make_shared<Resources::TextureResource>(entry.id, entry.path));
+        } else if (entry.category == Resources::ResourceCategory::Audio) {
+            missing.push_back(std::make_shared<Resources::AudioResource>(entry.id, entry.path));
+        }
+    }
+    m_resourceManager->addResources(missing);
+    
+    Resources::LoadOptions options;
+    options.priority = Resources::LoadPriority::High;
+    options.deadline = deadline;
+    return m_resourceManager->preload(manifest, options);
+}
+
+bool SceneManager::loadTargetScene(const std::shared_ptr<Scene>& scene) {
+    if (m_manifestRecording && m_resourceManager && !m_manifestDirectory.empty()) {
+        // The scene being left has loaded what it needs by now
+        saveRecordedManifest(m_recordingSceneId);
+        m_recordingSceneId = scene->getSceneId();
+        m_resourceManager->beginManifestRecording(m_recordingSceneId);
+    }
+    
+    bool success = scene->load();
+    if (!success && m_recordingSceneId == scene->getSceneId()) {
+        m_resourceManager->endManifestRecording();
+        m_recordingSceneId.clear();
+    }
+    return success;
+}
+
+void SceneManager::saveRecordedManifest(const std::string& sceneId) {
+    if (m_recordingSceneId.empty() || m_recordingSceneId != sceneId) {
+        return;
+    }
+    m_recordingSceneId.clear();
+    
+    // Keep what earlier runs recorded; a scene doesn't always load everything
+    Resources::PreloadManifest recorded = m_resourceManager->endManifestRecording();
+    Resources::PreloadManifest manifest(sceneId);
+    std::string path = getManifestPath(sceneId);
+    manifest.loadFromFile(path);
+    if (manifest.merge(recorded) > 0 || !std::filesystem::exists(path)) {
+        std::error_code error;
+        std::filesystem::create_directories(m_manifestDirectory, error);
+        if (manifest.saveToFile(path)) {
+            std::cout << "Recorded preload manifest: " << path << " (" << manifest.size() << " resources)" << std::endl;
+        }
+    }
+}
+
 void SceneManager::completeTransition() {
     if (!m_currentTransition) {
         return;
@@ -399,6 +553,7 @@ void SceneManager::completeTransition() {
     auto currentScene = getScene(m_currentTransition->fromSceneId);
     if (currentScene) {
         currentScene->deactivate();
+        saveRecordedManifest(m_currentTransition->fromSceneId);
     }
     
     // Activate target scene
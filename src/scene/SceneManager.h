@@ -6,6 +6,7 @@
 #include <unordered_map>
 #include <stack>
 #include <functional>
+#include <vector>
 
 namespace RPGEngine {
 namespace Scene {
@@ -22,6 +23,10 @@ struct SceneTransition {
     bool isComplete;
     std::function<void()> onComplete;
     
+    // Resources requested for the target scene; it loads once they're done
+    std::vector<std::shared_ptr<Resources::Resource>> preloading;
+    bool loadPending = false;
+    
     SceneTransition(const std::string& from, const std::string& to, 
                    SceneTransitionType transitionType, float dur = 1.0f)
         : fromSceneId(from), toSceneId(to), type(transitionType), 
@@ -31,6 +36,12 @@ struct SceneTransition {
 /**
  * Scene manager
  * Manages scene lifecycle, transitions, and state persistence
+ *
+ * With a manifest directory set, switching to an unloaded scene preloads
+ * its manifest (the saved <directory>/<sceneId>.manifest plus
+ * Scene::collectDependencies()) asynchronously while the transition plays,
+ * and loads the scene once both are done. Manifest recording saves what
+ * each scene actually loaded when it is left, so the next run preloads it.
  */
 class SceneManager {
 public:
@@ -39,7 +50,7 @@ public:
      * @param entityManager Entity manager
      * @param componentManager Component manager
      * @param systemManager System manager
-     * @param resourceManager Resource manager
+     * @param resourceManager Resource manager (given the system manager's job system)
      */
     SceneManager(std::shared_ptr<EntityManager> entityManager,
                 std::shared_ptr<ComponentManager> componentManager,
@@ -170,6 +181,37 @@ public:
      */
     float getTransitionProgress() const;
     
+    /**
+     * Get how much of the target scene's preload has finished (0.0 to 1.0)
+     * For loading indicators; 1.0 when nothing is being preloaded.
+     * @return Fraction of preloaded resources that are loaded or failed
+     */
+    float getLoadProgress() const;
+    
+    /**
+     * Set the directory preload manifests are read from and recorded to
+     * @param directory Manifest directory (empty to disable preloading)
+     */
+    void setManifestDirectory(const std::string& directory) { m_manifestDirectory = directory; }
+    
+    /**
+     * Get the manifest directory
+     * @return Manifest directory
+     */
+    const std::string& getManifestDirectory() const { return m_manifestDirectory; }
+    
+    /**
+     * Set whether scenes record the resources they load into their manifests
+     * @param enable Whether to record
+     */
+    void setManifestRecording(bool enable) { m_manifestRecording = enable; }
+    
+    /**
+     * Check if manifest recording is enabled
+     * @return true if recording
+     */
+    bool isManifestRecording() const { return m_manifestRecording; }
+    
     /**
      * Save scene state
      * @param sceneId Scene ID
@@ -235,6 +277,56 @@ private:
      */
     void completeTransition();
     
+    /**
+     * Load the target scene of the transition once its preload is done
+     * Cancels the transition if the scene fails to load.
+     * @return true if the scene is loaded
+     */
+    bool finishPendingLoad();
+    
+    /**
+     * Keep the transition's preloaded resources loaded until the scene loads
+     * Touches them every frame and re-requests any that were unloaded.
+     */
+    void keepPreloadResident();
+    
+    /**
+     * Get the manifest path of a scene
+     * @param sceneId Scene ID
+     * @return Manifest path
+     */
+    std::string getManifestPath(const std::string& sceneId) const;
+    
+    /**
+     * Build the preload manifest of a scene
+     * @param scene Scene
+     * @param manifest Receives the saved manifest and the scene's dependencies
+     */
+    void buildManifest(const std::shared_ptr<Scene>& scene, Resources::PreloadManifest& manifest);
+    
+    /**
+     * Start preloading a manifest
+     * Registers listed textures and audio the resource manager doesn't have.
+     * @param manifest Resources to preload
+     * @param deadline When the resources are needed
+     * @return Resources being preloaded
+     */
+    std::vector<std::shared_ptr<Resources::Resource>> preloadManifest(const Resources::PreloadManifest& manifest,
+                                                                      std::chrono::steady_clock::time_point deadline);
+    
+    /**
+     * Load a scene, recording its manifest if recording is enabled
+     * @param scene Scene
+     * @return true if the scene loaded
+     */
+    bool loadTargetScene(const std::shared_ptr<Scene>& scene);
+    
+    /**
+     * Save the manifest being recorded for a scene that is being left
+     * @param sceneId Scene ID
+     */
+    void saveRecordedManifest(const std::string& sceneId);
+    
     // Managers
     std::shared_ptr<EntityManager> m_entityManager;
     std::shared_ptr<ComponentManager> m_componentManager;
@@ -249,6 +341,11 @@ private:
     // Transition management
     std::unique_ptr<SceneTransition> m_currentTransition;
     std::function<void(const SceneTransition&)> m_transitionEffectCallback;
+    
+    // Preload manifests
+    std::string m_manifestDirectory;
+    bool m_manifestRecording;
+    std::string m_recordingSceneId;
 };
 
 } // namespace Scene
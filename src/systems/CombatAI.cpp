@@ -0,0 +1,352 @@
+#include "CombatAI.h"
+#include "CombatSystem.h"
+#include <algorithm>
+#include <cmath>
+
+namespace RPGEngine {
+namespace Systems {
+
+namespace {
+
+inline float clampUnit(float value) {
+    return std::min(std::max(value, 0.0f), 1.0f);
+}
+
+inline uint32_t statusBit(Components::StatusEffectType type) {
+    return 1u << static_cast<uint32_t>(type);
+}
+
+uint32_t getStatusMask(const Components::CombatComponent* combat) {
+    uint32_t mask = 0;
+    if (combat) {
+        for (const auto& effect : combat->getStatusEffects()) {
+            mask |= statusBit(effect.type);
+        }
+    }
+    return mask;
+}
+
+uint32_t getEffectMask(const Components::CombatSkill& skill) {
+    uint32_t mask = 0;
+    for (const auto& effect : skill.statusEffects) {
+        mask |= statusBit(effect.type);
+    }
+    return mask;
+}
+
+bool isOffensive(const Components::CombatSkill& skill) {
+    // Same split as CombatSystem::getValidTargets
+    return skill.type == Components::CombatActionType::Attack ||
+           skill.type == Components::CombatActionType::Magic;
+}
+
+void normalizeThreat(CombatTargetGroup& group) {
+    float strongest = 0.0f;
+    for (float threat : group.threat) {
+        strongest = std::max(strongest, threat);
+    }
+    float scale = strongest > 0.0f ? 1.0f / strongest : 0.0f;
+    for (float& threat : group.threat) {
+        threat *= scale;
+    }
+}
+
+} // namespace
+
+float ResponseCurve::evaluate(float x) const {
+    float y = 0.0f;
+    evaluate(&x, &y, 1);
+    return y;
+}
+
+void ResponseCurve::evaluate(const float* inputs, float* outputs, size_t count) const {
+    switch (type) {
+        case ResponseCurveType::Polynomial:
+            if (exponent == 1.0f) {
+                for (size_t i = 0; i < count; ++i) {
+                    outputs[i] = clampUnit(slope * (clampUnit(inputs[i]) - xShift) + yShift);
+                }
+            } else {
+                for (size_t i = 0; i < count; ++i) {
+                    float x = std::max(clampUnit(inputs[i]) - xShift, 0.0f);
+                    outputs[i] = clampUnit(slope * std::pow(x, exponent) + yShift);
+                }
+            }
+            break;
+        case ResponseCurveType::Logistic:
+            for (size_t i = 0; i < count; ++i) {
+                float x = clampUnit(inputs[i]) - xShift;
+                outputs[i] = clampUnit(slope / (1.0f + std::exp(-exponent * x)) + yShift);
+            }
+            break;
+    }
+}
+
+CombatAIProfile::CombatAIProfile()
+    : damage(ResponseCurve::linear(0.75f, 0.25f))       // Any damage is worth something, kills most
+    , hitChance(ResponseCurve::linear(1.0f, 0.0f))
+    , targetHealth(ResponseCurve::linear(-0.5f, 1.0f))  // Prefer weakened targets
+    , threat(ResponseCurve::linear(0.5f, 0.5f))
+    , allyHealth(ResponseCurve::linear(-0.3f, 0.3f))
+    , mpCost(ResponseCurve::linear(-0.5f, 1.0f))
+    , redundantEffectScale(0.25f)
+    , defend(ResponseCurve::constant(0.0f))             // Only when nothing else is usable
+{
+}
+
+void CombatTargetGroup::clear() {
+    entities.clear();
+    hp.clear();
+    hpFraction.clear();
+    defense.clear();
+    evasion.clear();
+    threat.clear();
+    statusMask.clear();
+    bestScore.clear();
+}
+
+void CombatTargetGroup::add(EntityId entity, const Components::StatsComponent& stats,
+                            const Components::CombatComponent* combat) {
+    float defenseModifier = combat ? combat->getDefenseModifier() : 1.0f;
+    float damageModifier = combat ? combat->getAttackPowerModifier() : 1.0f;
+
+    entities.push_back(entity);
+    hp.push_back(stats.getCurrentHP());
+    hpFraction.push_back(stats.getHPPercentage());
+    defense.push_back(static_cast<float>(stats.getDefense()) * defenseModifier);
+    evasion.push_back(static_cast<float>(stats.getEvasion()));
+    threat.push_back(static_cast<float>(std::max(stats.getAttackPower(), stats.getMagicPower())) * damageModifier);
+    statusMask.push_back(getStatusMask(combat));
+    bestScore.push_back(0.0f);
+}
+
+CombatAI::CombatAI() {
+    m_profiles["default"] = CombatAIProfile();
+
+    // Goes for kills and ignores risk and cost
+    CombatAIProfile aggressive;
+    aggressive.damage = ResponseCurve(ResponseCurveType::Polynomial, 0.8f, 2.0f, 0.0f, 0.2f);
+    aggressive.hitChance = ResponseCurve::linear(0.5f, 0.5f);
+    aggressive.targetHealth = ResponseCurve::constant(1.0f);
+    aggressive.threat = ResponseCurve::constant(1.0f);
+    aggressive.mpCost = ResponseCurve::constant(1.0f);
+    m_profiles["aggressive"] = aggressive;
+
+    // Focuses the most dangerous enemy, only takes sure hits and guards when hurt
+    CombatAIProfile defensive;
+    defensive.hitChance = ResponseCurve(ResponseCurveType::Polynomial, 1.0f, 2.0f, 0.0f, 0.0f);
+    defensive.threat = ResponseCurve::linear(1.0f, 0.0f);
+    defensive.allyHealth = ResponseCurve::linear(-0.6f, 0.6f);
+    defensive.defend = ResponseCurve::logistic(-15.0f, 0.3f, 0.8f);
+    m_profiles["defensive"] = defensive;
+
+    // Looks after injured allies first
+    CombatAIProfile support;
+    support.allyHealth = ResponseCurve::linear(-1.0f, 1.0f);
+    support.mpCost = ResponseCurve::linear(-0.25f, 1.0f);
+    support.redundantEffectScale = 0.0f;
+    m_profiles["support"] = support;
+}
+
+void CombatAI::setProfile(const std::string& behavior, const CombatAIProfile& profile) {
+    m_profiles[behavior] = profile;
+}
+
+const CombatAIProfile& CombatAI::getProfile(const std::string& behavior) const {
+    auto it = m_profiles.find(behavior);
+    if (it == m_profiles.end()) {
+        it = m_profiles.find("default");
+    }
+    return it->second;
+}
+
+const Components::CombatComponent* CombatAI::buildBlackboard(const ComponentManager& components,
+                                                             const std::vector<CombatParticipant>& participants,
+                                                             EntityId actor) {
+    CombatBlackboard& board = m_blackboard;
+    board.actor = actor;
+    board.enemies.clear();
+    board.allies.clear();
+
+    auto self = std::find_if(participants.begin(), participants.end(),
+                             [actor](const CombatParticipant& p) { return p.entity == actor; });
+    if (self == participants.end()) {
+        return nullptr;
+    }
+
+    auto actorStats = components.getComponent<Components::StatsComponent>(Entity(actor));
+    auto actorCombat = components.getComponent<Components::CombatComponent>(Entity(actor));
+    if (!actorStats || !actorCombat) {
+        return nullptr;
+    }
+
+    board.actorHPFraction = actorStats->getHPPercentage();
+    board.actorMP = actorStats->getCurrentMP();
+    board.actorAccuracy = static_cast<float>(actorStats->getAccuracy()) * actorCombat->getAccuracyModifier();
+    board.actorAttackPower = static_cast<float>(actorStats->getAttackPower());
+    board.actorMagicPower = static_cast<float>(actorStats->getMagicPower());
+    board.actorDamageModifier = actorCombat->getAttackPowerModifier();
+    board.actorStatusMask = getStatusMask(actorCombat.get());
+
+    for (const auto& participant : participants) {
+        if (!participant.isAlive || participant.entity == actor) {
+            continue;
+        }
+
+        auto stats = components.getComponent<Components::StatsComponent>(Entity(participant.entity));
+        if (!stats) {
+            continue;
+        }
+        auto combat = components.getComponent<Components::CombatComponent>(Entity(participant.entity));
+
+        CombatTargetGroup& group = participant.isPlayer != self->isPlayer ? board.enemies : board.allies;
+        group.add(participant.entity, *stats, combat.get());
+    }
+
+    normalizeThreat(board.enemies);
+    normalizeThreat(board.allies);
+
+    size_t largest = std::max(board.enemies.size(), board.allies.size());
+    board.hitChance.resize(largest);
+    board.damageShare.resize(largest);
+    board.utility.resize(largest);
+    board.score.resize(largest);
+
+    return actorCombat.get();
+}
+
+int CombatAI::scoreSkill(const Components::CombatSkill& skill, CombatTargetGroup& group,
+                         const CombatAIProfile& profile, float weight) {
+    const size_t count = group.size();
+    if (count == 0) {
+        return -1;
+    }
+
+    CombatBlackboard& board = m_blackboard;
+    float* hit = board.hitChance.data();
+    float* share = board.damageShare.data();
+    float* utility = board.utility.data();
+    float* score = board.score.data();
+
+    if (isOffensive(skill)) {
+        // Same formulas as CombatSystem::calculateHitChance and calculateDamage, without the rolls
+        const float accuracy = board.actorAccuracy;
+        const float power = skill.type == Components::CombatActionType::Attack ? board.actorAttackPower : board.actorMagicPower;
+        const float baseDamage = (skill.damage + power) * board.actorDamageModifier;
+        const float* evasion = group.evasion.data();
+        const float* defense = group.defense.data();
+        const float* hp = group.hp.data();
+
+        for (size_t i = 0; i < count; ++i) {
+            float chance = skill.accuracy * accuracy / std::max(accuracy + evasion[i], 1.0f);
+            hit[i] = std::min(std::max(chance, 0.05f), 0.95f);
+        }
+        for (size_t i = 0; i < count; ++i) {
+            float damage = std::max(1.0f, baseDamage - defense[i] * 0.5f);
+            share[i] = std::min(damage / std::max(hp[i], 1.0f), 1.0f);
+        }
+
+        profile.damage.evaluate(share, score, count);
+        profile.hitChance.evaluate(hit, utility, count);
+        for (size_t i = 0; i < count; ++i) {
+            score[i] *= utility[i];
+        }
+        profile.targetHealth.evaluate(group.hpFraction.data(), utility, count);
+        for (size_t i = 0; i < count; ++i) {
+            score[i] *= utility[i];
+        }
+        profile.threat.evaluate(group.threat.data(), utility, count);
+        for (size_t i = 0; i < count; ++i) {
+            score[i] = std::sqrt(std::sqrt(score[i] * utility[i]));
+        }
+    } else {
+        profile.allyHealth.evaluate(group.hpFraction.data(), score, count);
+    }
+
+    const uint32_t effectMask = getEffectMask(skill);
+    const uint32_t* statusMask = group.statusMask.data();
+    for (size_t i = 0; i < count; ++i) {
+        bool redundant = effectMask != 0 && (statusMask[i] & effectMask) == effectMask;
+        score[i] *= weight * (redundant ? profile.redundantEffectScale : 1.0f);
+    }
+
+    int best = 0;
+    for (size_t i = 0; i < count; ++i) {
+        group.bestScore[i] = std::max(group.bestScore[i], score[i]);
+        if (score[i] > score[best]) {
+            best = static_cast<int>(i);
+        }
+    }
+    return best;
+}
+
+Components::CombatAction CombatAI::chooseAction(const ComponentManager& components,
+                                                const std::vector<CombatParticipant>& participants,
+                                                EntityId actor) {
+    Components::CombatAction defend(actor, actor, Components::CombatActionType::Defend);
+
+    const Components::CombatComponent* combat = buildBlackboard(components, participants, actor);
+    if (!combat) {
+        return defend;
+    }
+
+    const CombatBlackboard& board = m_blackboard;
+    const CombatAIProfile& profile = getProfile(combat->getAIBehavior());
+    float aggression = clampUnit(combat->getAggression());
+    float offensiveWeight = 0.5f + aggression;
+    float defensiveWeight = 1.5f - aggression;
+
+    Components::CombatAction best = defend;
+    float bestScore = profile.defend.evaluate(board.actorHPFraction) * defensiveWeight;
+
+    for (const auto& skill : combat->getSkills()) {
+        if (skill.type == Components::CombatActionType::Magic && !combat->canUseMagic()) {
+            continue;
+        }
+        if (skill.mpCost > board.actorMP) {
+            continue;
+        }
+
+        float cost = board.actorMP > 0.0f ? skill.mpCost / board.actorMP : 0.0f;
+        float costUtility = profile.mpCost.evaluate(cost);
+
+        EntityId target = actor;
+        float score = 0.0f;
+        if (skill.targetsSelf) {
+            uint32_t effectMask = getEffectMask(skill);
+            bool redundant = effectMask != 0 && (board.actorStatusMask & effectMask) == effectMask;
+            score = profile.allyHealth.evaluate(board.actorHPFraction) * costUtility * defensiveWeight *
+                    (redundant ? profile.redundantEffectScale : 1.0f);
+        } else {
+            bool offensive = isOffensive(skill);
+            CombatTargetGroup& group = offensive ? m_blackboard.enemies : m_blackboard.allies;
+            int index = scoreSkill(skill, group, profile, costUtility * (offensive ? offensiveWeight : defensiveWeight));
+            if (index < 0) {
+                continue;
+            }
+            target = group.entities[index];
+            score = m_blackboard.score[index];
+        }
+
+        if (score > bestScore) {
+            bestScore = score;
+            best = Components::CombatAction(actor, target, skill.type, skill.id);
+        }
+    }
+
+    return best;
+}
+
+float CombatAI::getTargetScore(EntityId target) const {
+    for (const CombatTargetGroup* group : {&m_blackboard.enemies, &m_blackboard.allies}) {
+        for (size_t i = 0; i < group->size(); ++i) {
+            if (group->entities[i] == target) {
+                return group->bestScore[i];
+            }
+        }
+    }
+    return 0.0f;
+}
+
+} // namespace Systems
+} // namespace RPGEngine
@@ -0,0 +1,214 @@
+#pragma once
+
+#include "../components/CombatComponent.h"
+#include "../components/StatsComponent.h"
+#include "../components/ComponentManager.h"
+#include <string>
+#include <vector>
+#include <unordered_map>
+#include <cstdint>
+
+namespace RPGEngine {
+namespace Systems {
+
+struct CombatParticipant;
+
+/**
+ * Response curve shape
+ * Polynomial curves with an exponent other than 1 treat x below xShift as
+ * xShift.
+ */
+enum class ResponseCurveType {
+    Polynomial,     // slope * (x - xShift)^exponent + yShift
+    Logistic        // slope / (1 + e^(-exponent * (x - xShift))) + yShift
+};
+
+/**
+ * Response curve
+ * Maps a consideration input in [0, 1] to a utility in [0, 1].
+ */
+struct ResponseCurve {
+    ResponseCurveType type;
+    float slope;
+    float exponent;
+    float xShift;
+    float yShift;
+
+    ResponseCurve(ResponseCurveType curveType = ResponseCurveType::Polynomial, float m = 1.0f,
+                  float k = 1.0f, float c = 0.0f, float b = 0.0f)
+        : type(curveType), slope(m), exponent(k), xShift(c), yShift(b) {}
+
+    static ResponseCurve constant(float value) {
+        return ResponseCurve(ResponseCurveType::Polynomial, 0.0f, 1.0f, 0.0f, value);
+    }
+
+    static ResponseCurve linear(float m, float b) {
+        return ResponseCurve(ResponseCurveType::Polynomial, m, 1.0f, 0.0f, b);
+    }
+
+    static ResponseCurve logistic(float steepness, float midpoint, float m = 1.0f, float b = 0.0f) {
+        return ResponseCurve(ResponseCurveType::Logistic, m, steepness, midpoint, b);
+    }
+
+    /**
+     * Evaluate the curve
+     * @param x Input (0.0 to 1.0)
+     * @return Utility (0.0 to 1.0)
+     */
+    float evaluate(float x) const;
+
+    /**
+     * Evaluate the curve for a batch of inputs
+     * The curve type is resolved once, so the loop has no branches.
+     * @param inputs Inputs (0.0 to 1.0)
+     * @param outputs Utilities (0.0 to 1.0), may alias inputs
+     * @param count Number of inputs
+     */
+    void evaluate(const float* inputs, float* outputs, size_t count) const;
+};
+
+/**
+ * Utility AI behavior profile
+ * An action's score is the geometric mean of its considerations' utilities,
+ * scaled by the MP cost utility, so actions with more considerations are
+ * not penalized and any consideration near zero still vetoes the action.
+ */
+struct CombatAIProfile {
+    // Offensive skills, per target
+    ResponseCurve damage;           // Expected damage as a share of the target's HP (1 = kill)
+    ResponseCurve hitChance;        // Chance to hit
+    ResponseCurve targetHealth;     // Target HP fraction
+    ResponseCurve threat;           // Target attack or magic power relative to the strongest enemy
+
+    // Support skills, per ally
+    ResponseCurve allyHealth;       // Ally HP fraction
+
+    // Any skill
+    ResponseCurve mpCost;           // Share of the actor's current MP the skill costs
+    float redundantEffectScale;     // Scale when the target already has all of the skill's effects
+
+    // Defending
+    ResponseCurve defend;           // Actor HP fraction
+
+    CombatAIProfile();
+};
+
+/**
+ * Target group of the AI blackboard
+ * Participant state in flat arrays, one entry per living target.
+ */
+struct CombatTargetGroup {
+    std::vector<EntityId> entities;
+    std::vector<float> hp;
+    std::vector<float> hpFraction;
+    std::vector<float> defense;         // Defense with status modifiers
+    std::vector<float> evasion;
+    std::vector<float> threat;          // Relative to the strongest in the group (0.0 to 1.0)
+    std::vector<uint32_t> statusMask;   // Bit per StatusEffectType
+    std::vector<float> bestScore;       // Best action score against each target this decision
+
+    size_t size() const { return entities.size(); }
+    void clear();
+    void add(EntityId entity, const Components::StatsComponent& stats, const Components::CombatComponent* combat);
+};
+
+/**
+ * Per-turn AI blackboard
+ * Everything a decision reads from components, gathered once so scoring
+ * every (skill, target) pair does no component lookups.
+ */
+struct CombatBlackboard {
+    EntityId actor = 0;
+    float actorHPFraction = 0.0f;
+    float actorMP = 0.0f;
+    float actorAccuracy = 0.0f;         // With status modifiers
+    float actorAttackPower = 0.0f;
+    float actorMagicPower = 0.0f;
+    float actorDamageModifier = 1.0f;   // From status effects
+    uint32_t actorStatusMask = 0;
+
+    CombatTargetGroup enemies;
+    CombatTargetGroup allies;           // Living allies other than the actor
+
+    // Scratch arrays reused for every skill
+    std::vector<float> hitChance;
+    std::vector<float> damageShare;
+    std::vector<float> utility;
+    std::vector<float> score;
+};
+
+/**
+ * Utility AI for combat
+ * Builds a blackboard for the acting participant, then scores every usable
+ * (skill, target) pair and defending with the response curves of the
+ * actor's AI behavior. Aggression shifts weight from defending to
+ * offensive skills.
+ */
+class CombatAI {
+public:
+    /**
+     * Constructor
+     * Registers the "default", "aggressive", "defensive" and "support" profiles.
+     */
+    CombatAI();
+
+    /**
+     * Set the profile for an AI behavior
+     * @param behavior Behavior name, as set with CombatComponent::setAIBehavior
+     * @param profile Response curves
+     */
+    void setProfile(const std::string& behavior, const CombatAIProfile& profile);
+
+    /**
+     * Get the profile for an AI behavior
+     * @param behavior Behavior name
+     * @return Profile, or the default profile for unknown behaviors
+     */
+    const CombatAIProfile& getProfile(const std::string& behavior) const;
+
+    /**
+     * Choose an action for a participant
+     * @param components Component manager
+     * @param participants Encounter participants
+     * @param actor Acting entity
+     * @return Best scoring action, or Defend if nothing is usable
+     */
+    Components::CombatAction chooseAction(const ComponentManager& components,
+                                          const std::vector<CombatParticipant>& participants,
+                                          EntityId actor);
+
+    /**
+     * Get the best score of the last decision against a target
+     * @param target Target entity
+     * @return Score, or 0 if the target could not be chosen
+     */
+    float getTargetScore(EntityId target) const;
+
+    /**
+     * Get the blackboard of the last decision
+     * @return Blackboard
+     */
+    const CombatBlackboard& getBlackboard() const { return m_blackboard; }
+
+private:
+    /**
+     * Gather participant state for a decision
+     * @return Actor's combat component, or nullptr if the actor cannot decide
+     */
+    const Components::CombatComponent* buildBlackboard(const ComponentManager& components,
+                                                       const std::vector<CombatParticipant>& participants,
+                                                       EntityId actor);
+
+    /**
+     * Score a skill against every target in a group
+     * @return Index of the best target, or -1 if the group is empty
+     */
+    int scoreSkill(const Components::CombatSkill& skill, CombatTargetGroup& group,
+                   const CombatAIProfile& profile, float weight);
+
+    std::unordered_map<std::string, CombatAIProfile> m_profiles;
+    CombatBlackboard m_blackboard;
+};
+
+} // namespace Systems
+} // namespace RPGEngine
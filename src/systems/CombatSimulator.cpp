@@ -0,0 +1,323 @@
+#include "CombatSimulator.h"
+#include "CombatSystem.h"
+#include "../core/ThreadPool.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <functional>
+#include <thread>
+
+namespace RPGEngine {
+namespace Systems {
+
+namespace {
+
+// Encounters per result block; blocks are merged in order so totals do not
+// depend on which thread ran which block
+const uint64_t ENCOUNTERS_PER_BLOCK = 256;
+
+CombatSimulationResult makeResult(const CombatSimulationConfig& config) {
+    CombatSimulationResult result;
+    result.roundHistogram.assign(static_cast<size_t>(std::max(0, config.maxRounds)) + 2, 0);
+    result.damageBucketSize = config.damageBucketSize;
+    result.damageHistogram.assign(std::max<size_t>(1, config.damageBuckets), 0);
+    return result;
+}
+
+void addHistogram(std::vector<uint64_t>& target, const std::vector<uint64_t>& source) {
+    if (target.size() < source.size()) {
+        target.resize(source.size(), 0);
+    }
+    for (size_t i = 0; i < source.size(); ++i) {
+        target[i] += source[i];
+    }
+}
+
+} // namespace
+
+float CombatSimulationResult::getDamagePercentile(float percentile) const {
+    uint64_t total = 0;
+    for (uint64_t count : damageHistogram) {
+        total += count;
+    }
+    if (total == 0) {
+        return 0.0f;
+    }
+
+    uint64_t threshold = static_cast<uint64_t>(std::clamp(percentile, 0.0f, 1.0f) * static_cast<float>(total));
+    uint64_t seen = 0;
+    for (size_t i = 0; i < damageHistogram.size(); ++i) {
+        seen += damageHistogram[i];
+        if (seen >= threshold && seen > 0) {
+            return static_cast<float>(i + 1) * damageBucketSize;
+        }
+    }
+    return static_cast<float>(damageHistogram.size()) * damageBucketSize;
+}
+
+void CombatSimulationResult::merge(const CombatSimulationResult& other) {
+    if (other.encounters > 0) {
+        minRounds = encounters > 0 ? std::min(minRounds, other.minRounds) : other.minRounds;
+        maxRounds = std::max(maxRounds, other.maxRounds);
+    }
+
+    encounters += other.encounters;
+    victories += other.victories;
+    defeats += other.defeats;
+    escapes += other.escapes;
+    timeouts += other.timeouts;
+    totalRounds += other.totalRounds;
+    addHistogram(roundHistogram, other.roundHistogram);
+
+    actions += other.actions;
+    hits += other.hits;
+    misses += other.misses;
+    criticals += other.criticals;
+    playerDamage += other.playerDamage;
+    enemyDamage += other.enemyDamage;
+    addHistogram(damageHistogram, other.damageHistogram);
+}
+
+/**
+ * Simulation world owned by one thread
+ * Holds its own copies of the participants' components and a headless
+ * CombatSystem, reset from the snapshot before every encounter.
+ */
+class CombatSimulator::Worker {
+public:
+    Worker(const std::vector<Participant>& participants, const CombatSimulationConfig& config)
+        : m_components(std::make_shared<ComponentManager>())
+        , m_config(config)
+    {
+        m_components->initialize();
+        m_combat.setComponentManager(m_components);
+        m_combat.setHeadless(true);
+
+        for (const auto& participant : participants) {
+            Live live;
+            live.source = &participant;
+            live.stats = std::make_shared<Components::StatsComponent>(participant.stats);
+            live.combat = std::make_shared<Components::CombatComponent>(participant.combat);
+            m_components->addComponent(Entity(participant.entity), live.stats);
+            m_components->addComponent(Entity(participant.entity), live.combat);
+            m_live.push_back(live);
+
+            (participant.isPlayer ? m_players : m_enemies).push_back(participant.entity);
+        }
+
+        m_combat.setActionExecutedCallback([this](const Components::CombatAction& action) {
+            recordAction(action);
+        });
+        m_combat.setTurnStartCallback([this](EntityId, int turnNumber) {
+            m_round = turnNumber;
+        });
+        m_combat.setCombatEndCallback([this](bool victory, bool escaped) {
+            m_victory = victory;
+            m_escaped = escaped;
+        });
+    }
+
+    void runEncounter(uint64_t encounterIndex, CombatSimulationResult& result) {
+        for (auto& live : m_live) {
+            *live.stats = live.source->stats;
+            *live.combat = live.source->combat;
+        }
+
+        m_result = &result;
+        m_round = 1;
+        m_victory = false;
+        m_escaped = false;
+        m_combat.setRandomSeed(getEncounterSeed(m_config.seed, encounterIndex));
+
+        if (!m_combat.startCombat("simulation", m_players, m_enemies)) {
+            m_result = nullptr;
+            return;
+        }
+
+        bool timedOut = false;
+        while (m_combat.isCombatActive()) {
+            if (m_round > m_config.maxRounds) {
+                timedOut = true;
+                m_combat.endCombat(false);
+                break;
+            }
+            m_combat.stepTurn();
+        }
+
+        int rounds = std::min(m_round, m_config.maxRounds + 1);
+        result.minRounds = result.encounters > 0 ? std::min(result.minRounds, rounds) : rounds;
+        result.maxRounds = std::max(result.maxRounds, rounds);
+        result.encounters++;
+        result.totalRounds += static_cast<uint64_t>(rounds);
+        result.roundHistogram[static_cast<size_t>(std::max(0, rounds))]++;
+
+        if (timedOut) {
+            result.timeouts++;
+        } else if (m_escaped) {
+            result.escapes++;
+        } else if (m_victory) {
+            result.victories++;
+        } else {
+            result.defeats++;
+        }
+
+        m_result = nullptr;
+    }
+
+private:
+    struct Live {
+        const Participant* source;
+        std::shared_ptr<Components::StatsComponent> stats;
+        std::shared_ptr<Components::CombatComponent> combat;
+    };
+
+    void recordAction(const Components::CombatAction& action) {
+        if (!m_result) {
+            return;
+        }
+        m_result->actions++;
+
+        bool offensive = action.type == Components::CombatActionType::Attack ||
+                         action.type == Components::CombatActionType::Magic ||
+                         action.type == Components::CombatActionType::Skill;
+        if (!offensive) {
+            return;
+        }
+        if (!action.hit) {
+            m_result->misses++;
+            return;
+        }
+
+        m_result->hits++;
+        if (action.critical) {
+            m_result->criticals++;
+        }
+        if (action.damage > 0.0f) {
+            bool playerSide = std::find(m_players.begin(), m_players.end(), action.actor) != m_players.end();
+            (playerSide ? m_result->playerDamage : m_result->enemyDamage) += action.damage;
+
+            size_t bucket = static_cast<size_t>(action.damage / m_result->damageBucketSize);
+            m_result->damageHistogram[std::min(bucket, m_result->damageHistogram.size() - 1)]++;
+        }
+    }
+
+    std::shared_ptr<ComponentManager> m_components;
+    CombatSystem m_combat;
+    const CombatSimulationConfig& m_config;
+    std::vector<Live> m_live;
+    std::vector<EntityId> m_players;
+    std::vector<EntityId> m_enemies;
+
+    // Encounter being run
+    CombatSimulationResult* m_result = nullptr;
+    int m_round = 1;
+    bool m_victory = false;
+    bool m_escaped = false;
+};
+
+bool CombatSimulator::addParticipant(const ComponentManager& components, EntityId entity, bool isPlayer) {
+    auto stats = components.getComponent<Components::StatsComponent>(Entity(entity));
+    auto combat = components.getComponent<Components::CombatComponent>(Entity(entity));
+    if (!stats || !combat) {
+        std::cerr << "Combat simulation participant " << entity << " needs stats and combat components" << std::endl;
+        return false;
+    }
+
+    return addParticipant(entity, isPlayer, *stats, *combat);
+}
+
+bool CombatSimulator::addParticipant(EntityId entity, bool isPlayer,
+                                     const Components::StatsComponent& stats,
+                                     const Components::CombatComponent& combat) {
+    for (const auto& participant : m_participants) {
+        if (participant.entity == entity) {
+            std::cerr << "Combat simulation participant " << entity << " already added" << std::endl;
+            return false;
+        }
+    }
+
+    Participant participant{entity, isPlayer, stats, combat};
+
+    // Game callbacks must not run from simulation threads
+    participant.stats.setLevelUpCallback(nullptr);
+    participant.stats.setDeathCallback(nullptr);
+    participant.stats.setStatChangeCallback(nullptr);
+    participant.stats.setVerbose(false);
+    participant.combat.setActionCallback(nullptr);
+    participant.combat.setStatusEffectCallback(nullptr);
+    participant.combat.setInCombat(false);
+    participant.combat.setMyTurn(false);
+    participant.combat.setHasActed(false);
+
+    m_participants.push_back(participant);
+    return true;
+}
+
+CombatSimulationResult CombatSimulator::run(const CombatSimulationConfig& config) const {
+    auto start = std::chrono::steady_clock::now();
+    CombatSimulationResult total = makeResult(config);
+    if (m_participants.empty() || config.encounters == 0) {
+        return total;
+    }
+
+    uint64_t blockCount = (config.encounters + ENCOUNTERS_PER_BLOCK - 1) / ENCOUNTERS_PER_BLOCK;
+    size_t threads = config.threads > 0 ? config.threads : std::max(1u, std::thread::hardware_concurrency());
+    threads = static_cast<size_t>(std::min<uint64_t>(threads, blockCount));
+
+    std::vector<CombatSimulationResult> blocks(blockCount);
+    std::atomic<uint64_t> nextBlock(0);
+
+    std::vector<std::function<void()>> tasks;
+    for (size_t t = 0; t < threads; ++t) {
+        tasks.push_back([this, &config, &blocks, &nextBlock, blockCount]() {
+            Worker worker(m_participants, config);
+            for (uint64_t block = nextBlock++; block < blockCount; block = nextBlock++) {
+                CombatSimulationResult result = makeResult(config);
+                uint64_t first = block * ENCOUNTERS_PER_BLOCK;
+                uint64_t last = std::min(config.encounters, first + ENCOUNTERS_PER_BLOCK);
+                for (uint64_t i = first; i < last; ++i) {
+                    worker.runEncounter(i, result);
+                }
+                blocks[block] = std::move(result);
+            }
+        });
+    }
+
+    Core::ThreadPool pool(threads);
+    pool.submitAndWait(tasks);
+
+    for (const auto& block : blocks) {
+        total.merge(block);
+    }
+
+    total.threads = threads;
+    total.elapsedMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    return total;
+}
+
+CombatSimulationResult CombatSimulator::runEncounter(const CombatSimulationConfig& config, uint64_t encounterIndex) const {
+    auto start = std::chrono::steady_clock::now();
+    CombatSimulationResult result = makeResult(config);
+    if (m_participants.empty()) {
+        return result;
+    }
+
+    Worker worker(m_participants, config);
+    worker.runEncounter(encounterIndex, result);
+
+    result.threads = 1;
+    result.elapsedMs = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+    return result;
+}
+
+uint32_t CombatSimulator::getEncounterSeed(uint64_t seed, uint64_t encounterIndex) {
+    // SplitMix64, so neighbouring encounters get unrelated seeds
+    uint64_t z = seed + (encounterIndex + 1) * 0x9E3779B97F4A7C15ull;
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    z ^= z >> 31;
+    return static_cast<uint32_t>(z ^ (z >> 32));
+}
+
+} // namespace Systems
+} // namespace RPGEngine
@@ -0,0 +1,151 @@
+#pragma once
+
+#include "../components/CombatComponent.h"
+#include "../components/StatsComponent.h"
+#include "../components/ComponentManager.h"
+#include <vector>
+#include <cstdint>
+
+namespace RPGEngine {
+namespace Systems {
+
+/**
+ * Combat simulation settings
+ */
+struct CombatSimulationConfig {
+    uint64_t encounters = 1000;     // Encounters to simulate
+    uint64_t seed = 1;              // Base seed; encounter i always gets the same seed for it
+    size_t threads = 0;             // Worker threads (0 = one per core)
+    int maxRounds = 100;            // Rounds before an encounter is stopped as a timeout
+    float damageBucketSize = 5.0f;  // Width of the damage histogram buckets
+    size_t damageBuckets = 64;      // Buckets; the last one also counts larger hits
+};
+
+/**
+ * Aggregated combat simulation results
+ * Identical for the same participants, seed and encounter count, whatever
+ * the thread count.
+ */
+struct CombatSimulationResult {
+    uint64_t encounters = 0;
+    uint64_t victories = 0;             // Players won
+    uint64_t defeats = 0;               // Enemies won
+    uint64_t escapes = 0;
+    uint64_t timeouts = 0;              // Stopped at maxRounds
+
+    uint64_t totalRounds = 0;
+    int minRounds = 0;
+    int maxRounds = 0;
+    std::vector<uint64_t> roundHistogram;   // Encounters by rounds taken
+
+    uint64_t actions = 0;
+    uint64_t hits = 0;
+    uint64_t misses = 0;
+    uint64_t criticals = 0;
+    double playerDamage = 0.0;          // Damage dealt by players
+    double enemyDamage = 0.0;           // Damage dealt by enemies
+    float damageBucketSize = 0.0f;
+    std::vector<uint64_t> damageHistogram;  // Damaging hits by damage bucket
+
+    double elapsedMs = 0.0;
+    size_t threads = 0;
+
+    float getWinRate() const {
+        return encounters > 0 ? static_cast<float>(victories) / static_cast<float>(encounters) : 0.0f;
+    }
+
+    float getAverageRounds() const {
+        return encounters > 0 ? static_cast<float>(totalRounds) / static_cast<float>(encounters) : 0.0f;
+    }
+
+    /**
+     * Get the damage below which a share of damaging hits fall
+     * @param percentile Share (0.0 to 1.0)
+     * @return Upper edge of the bucket reaching the share
+     */
+    float getDamagePercentile(float percentile) const;
+
+    /**
+     * Add another result's counts
+     * @param other Result to add
+     */
+    void merge(const CombatSimulationResult& other);
+};
+
+/**
+ * Monte-Carlo combat simulator
+ * Snapshots participants' stats and combat components, then runs many
+ * independent headless encounters from the snapshot with the AI playing
+ * both sides. Every worker thread has its own component manager and
+ * CombatSystem; encounter i is seeded from the base seed and i, so any
+ * encounter can be replayed on its own.
+ */
+class CombatSimulator {
+public:
+    /**
+     * Add a participant by copying its components
+     * Callbacks are not copied, and the copies do not print.
+     * @param components Component manager holding the entity's components
+     * @param entity Entity with StatsComponent and CombatComponent
+     * @param isPlayer true for the player side
+     * @return true if the entity has both components and was not added yet
+     */
+    bool addParticipant(const ComponentManager& components, EntityId entity, bool isPlayer);
+
+    /**
+     * Add a participant from component copies
+     * @param entity Entity ID used inside the simulation
+     * @param isPlayer true for the player side
+     * @param stats Stats to start every encounter with
+     * @param combat Combat state and skills to start every encounter with
+     * @return true if added
+     */
+    bool addParticipant(EntityId entity, bool isPlayer,
+                        const Components::StatsComponent& stats,
+                        const Components::CombatComponent& combat);
+
+    /**
+     * Remove all participants
+     */
+    void clearParticipants() { m_participants.clear(); }
+
+    size_t getParticipantCount() const { return m_participants.size(); }
+
+    /**
+     * Simulate encounters across worker threads
+     * @param config Simulation settings
+     * @return Aggregated results
+     */
+    CombatSimulationResult run(const CombatSimulationConfig& config) const;
+
+    /**
+     * Simulate a single encounter on the calling thread
+     * @param config Simulation settings (seed, limits and histogram layout)
+     * @param encounterIndex Encounter to replay
+     * @return Results of that encounter alone
+     */
+    CombatSimulationResult runEncounter(const CombatSimulationConfig& config, uint64_t encounterIndex) const;
+
+    /**
+     * Get the random seed of an encounter
+     * @param seed Base seed
+     * @param encounterIndex Encounter index
+     * @return Encounter seed
+     */
+    static uint32_t getEncounterSeed(uint64_t seed, uint64_t encounterIndex);
+
+private:
+    struct Participant {
+        EntityId entity;
+        bool isPlayer;
+        Components::StatsComponent stats;
+        Components::CombatComponent combat;
+    };
+
+    class Worker;
+
+    std::vector<Participant> m_participants;
+};
+
+} // namespace Systems
+} // namespace RPGEngine
@@ -13,6 +13,7 @@ CombatSystem::CombatSystem()
     , m_turnTimeLimit(0.0f)
     , m_autoEndTurn(false)
     , m_actionDelay(1.0f)
+    , m_headless(false)
 {
     // Set system priority (combat should run after physics but before rendering)
     setPriority(300);
@@ -169,8 +170,8 @@ void CombatSystem::nextTurn() {
                     m_turnStartCallback(participant.entity, m_currentEncounter->turnNumber);
                 }
                 
-                // Process AI turn if it's an enemy
-                if (!participant.isPlayer) {
+                // Process AI turn if it's an enemy, or for everyone when headless
+                if (!participant.isPlayer || m_headless) {
                     processAITurn(participant.entity);
                 }
                 
@@ -217,9 +218,23 @@ void CombatSystem::endTurn() {
             auto combatComp = m_componentManager->getComponent<Components::CombatComponent>(Entity(participant.entity));
             if (combatComp) {
                 combatComp->setHasActed(false);
+                
+                // Without frame updates, status effects last a number of rounds
+                if (m_headless && participant.isAlive) {
+                    applyStatusEffects(participant.entity);
+                    combatComp->updateStatusEffects(1.0f);
+                }
             }
         }
         
+        // Damage over time may have decided the fight, leaving nobody to act
+        if (m_headless) {
+            checkCombatEndConditions();
+            if (!isCombatActive()) {
+                return;
+            }
+        }
+
         // Recalculate turn order (in case speed changed)
         calculateTurnOrder(m_currentEncounter->participants);
         m_currentEncounter->currentTurnIndex = -1;
@@ -229,6 +244,17 @@ void CombatSystem::endTurn() {
     nextTurn();
 }
 
+bool CombatSystem::stepTurn() {
+    if (!isCombatActive()) {
+        return false;
+    }
+    
+    endTurn();
+    checkCombatEndConditions();
+    
+    return isCombatActive();
+}
+
 std::vector<const CombatParticipant*> CombatSystem::getTurnOrder() const {
     std::vector<const CombatParticipant*> turnOrder;
     
@@ -260,7 +286,8 @@ void CombatSystem::processActionQueue() {
         return;
     }
     
-    while (!m_currentEncounter->actionQueue.empty()) {
+    // A successful escape ends combat while the queue is processed
+    while (m_currentEncounter && !m_currentEncounter->actionQueue.empty()) {
         auto action = m_currentEncounter->actionQueue.front();
         m_currentEncounter->actionQueue.pop();
         
@@ -504,8 +531,9 @@ bool CombatSystem::executeAttackAction(Components::CombatAction& action) {
     }
     
     // Calculate hit chance
-    float hitChance = weaponAccuracy * (actorStats->getAccuracy() / 
-        (actorStats->getAccuracy() + m_componentManager->getComponent<Components::StatsComponent>(Entity(action.target))->getEvasion()));
+    float actorAccuracy = static_cast<float>(actorStats->getAccuracy());
+    float targetEvasion = static_cast<float>(m_componentManager->getComponent<Components::StatsComponent>(Entity(action.target))->getEvasion());
+    float hitChance = weaponAccuracy * (actorAccuracy / (actorAccuracy + targetEvasion));
     action.hit = (randomFloat(0.0f, 1.0f) <= hitChance);
     
     if (action.hit) {
@@ -808,52 +836,31 @@ void CombatSystem::processAITurn(EntityId entity) {
     auto action = getAIAction(entity);
     queueAction(action);
     processActionQueue();
+    
+    // Defend if the chosen action could not be used, e.g. not enough MP,
+    // so the turn is not offered to the same participant again
+    const auto* participant = getParticipant(entity);
+    if (participant && participant->isAlive && !participant->hasActed) {
+        queueAction(Components::CombatAction(entity, entity, Components::CombatActionType::Defend));
+        processActionQueue();
+    }
 }
 
 Components::CombatAction CombatSystem::getAIAction(EntityId entity) const {
-    auto combatComp = m_componentManager->getComponent<Components::CombatComponent>(Entity(entity));
-    if (!combatComp) {
-        return Components::CombatAction(entity, entity, Components::CombatActionType::Defend);
-    }
-    
-    // Get available skills
-    auto availableSkills = combatComp->getAvailableSkills();
-    if (availableSkills.empty()) {
-        return Components::CombatAction(entity, entity, Components::CombatActionType::Defend);
-    }
-    
-    // Simple AI: choose random skill and target
-    const auto* skill = availableSkills[const_cast<CombatSystem*>(this)->randomInt(0, availableSkills.size() - 1)];
-    auto validTargets = getValidTargets(entity, *skill);
-    
-    if (validTargets.empty()) {
+    if (!m_currentEncounter) {
         return Components::CombatAction(entity, entity, Components::CombatActionType::Defend);
     }
     
-    // Choose target with highest priority
-    EntityId bestTarget = validTargets[0];
-    float bestPriority = evaluateTargetPriority(entity, bestTarget);
-    
-    for (EntityId target : validTargets) {
-        float priority = evaluateTargetPriority(entity, target);
-        if (priority > bestPriority) {
-            bestPriority = priority;
-            bestTarget = target;
-        }
-    }
-    
-    return Components::CombatAction(entity, bestTarget, skill->type, skill->id);
+    return m_ai.chooseAction(*m_componentManager, m_currentEncounter->participants, entity);
 }
 
 float CombatSystem::evaluateTargetPriority(EntityId aiEntity, EntityId target) const {
-    auto targetStats = m_componentManager->getComponent<Components::StatsComponent>(Entity(target));
-    if (!targetStats) {
+    if (!m_currentEncounter) {
         return 0.0f;
     }
     
-    // Simple priority: target with lowest HP percentage
-    float hpPercentage = targetStats->getHPPercentage();
-    return 1.0f - hpPercentage; // Lower HP = higher priority
+    m_ai.chooseAction(*m_componentManager, m_currentEncounter->participants, aiEntity);
+    return m_ai.getTargetScore(target);
 }
 
 void CombatSystem::initializeEncounter(CombatEncounter& encounter) {
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "System.h"
+#include "CombatAI.h"
 #include "../components/CombatComponent.h"
 #include "../components/StatsComponent.h"
 #include "../entities/EntityManager.h"
@@ -133,6 +134,28 @@ public:
      */
     const CombatEncounter* getCurrentEncounter() const { return m_currentEncounter.get(); }
     
+    /**
+     * Seed the random number generator
+     * Hit, critical, damage, turn order and AI rolls repeat for the same seed.
+     * @param seed Random seed
+     */
+    void setRandomSeed(uint32_t seed) { m_randomGenerator.seed(seed); }
+    
+    /**
+     * Set headless mode
+     * Headless combat runs without input or frame updates: the AI also acts
+     * for players, and status effects tick once per round instead of on
+     * every update. Used to simulate encounters.
+     * @param headless true to run headless
+     */
+    void setHeadless(bool headless) { m_headless = headless; }
+    
+    /**
+     * Check if headless mode is enabled
+     * @return true if headless
+     */
+    bool isHeadless() const { return m_headless; }
+    
     // Turn management
     
     /**
@@ -151,6 +174,13 @@ public:
      */
     void endTurn();
     
+    /**
+     * End the current turn, let the next participant act and check whether
+     * combat is over, without waiting for update()
+     * @return true if combat is still active
+     */
+    bool stepTurn();
+    
     /**
      * Get turn order
      * @return Vector of participants in turn order
@@ -280,6 +310,8 @@ public:
     
     /**
      * Get AI action for entity
+     * Scores every usable skill against every valid target, and defending,
+     * with the response curves of the entity's AI behavior.
      * @param entity AI entity
      * @return AI-selected combat action
      */
@@ -289,10 +321,17 @@ public:
      * Evaluate target priority for AI
      * @param aiEntity AI entity
      * @param target Potential target
-     * @return Priority score (higher = more priority)
+     * @return Best action score against the target (higher = more priority)
      */
     float evaluateTargetPriority(EntityId aiEntity, EntityId target) const;
     
+    /**
+     * Get the utility AI, e.g. to set behavior profiles
+     * @return Combat AI
+     */
+    CombatAI& getAI() { return m_ai; }
+    const CombatAI& getAI() const { return m_ai; }
+    
     // Events and callbacks
     
     /**
@@ -421,6 +460,9 @@ private:
     // Combat state
     std::unique_ptr<CombatEncounter> m_currentEncounter;
     
+    // AI; reuses its blackboard between decisions
+    mutable CombatAI m_ai;
+    
     // Random number generation
     std::random_device m_randomDevice;
     std::mt19937 m_randomGenerator;
@@ -435,6 +477,7 @@ private:
     float m_turnTimeLimit;      // Time limit per turn (0 = no limit)
     bool m_autoEndTurn;         // Automatically end turn when time limit reached
     float m_actionDelay;        // Delay between actions for visual effects
+    bool m_headless;            // AI plays every side, status effects tick per round
 };
 
 } // namespace Systems
@@ -6,7 +6,7 @@ namespace RPGEngine {
 namespace Systems {
 
 QuestDialogueIntegration::QuestDialogueIntegration(std::shared_ptr<RPGEngine::EntityManager> entityManager)
-    : m_entityManager(entityManager), m_initialized(false) {
+    : m_entityManager(entityManager), m_questRegistrationVersion(0), m_initialized(false) {
 }
 
 QuestDialogueIntegration::~QuestDialogueIntegration() {
@@ -30,6 +30,8 @@ void QuestDialogueIntegration::shutdown() {
     
     m_questComponents.clear();
     m_dialogueComponents.clear();
+    m_statsComponents.clear();
+    m_inventoryComponents.clear();
     
     std::cout << "Quest-Dialogue Integration shutdown" << std::endl;
     m_initialized = false;
@@ -42,6 +44,7 @@ void QuestDialogueIntegration::registerQuestComponent(Components::EntityId entit
     }
     
     m_questComponents[entityId] = questComponent;
+    ++m_questRegistrationVersion;
     setupQuestDialogueCallbacks(questComponent);
     
     std::cout << "Registered quest component for entity " << entityId << std::endl;
@@ -59,10 +62,25 @@ void QuestDialogueIntegration::registerDialogueComponent(Components::EntityId en
     std::cout << "Registered dialogue component for entity " << entityId << std::endl;
 }
 
+void QuestDialogueIntegration::registerStatsComponent(Components::EntityId entityId,
+                                                     std::shared_ptr<Components::StatsComponent> statsComponent) {
+    if (statsComponent) {
+        m_statsComponents[entityId] = statsComponent;
+    }
+}
+
+void QuestDialogueIntegration::registerInventoryComponent(Components::EntityId entityId,
+                                                         std::shared_ptr<Components::InventoryComponent> inventoryComponent) {
+    if (inventoryComponent) {
+        m_inventoryComponents[entityId] = inventoryComponent;
+    }
+}
+
 void QuestDialogueIntegration::unregisterQuestComponent(Components::EntityId entityId) {
     auto it = m_questComponents.find(entityId);
     if (it != m_questComponents.end()) {
         m_questComponents.erase(it);
+        ++m_questRegistrationVersion;
         std::cout << "Unregistered quest component for entity " << entityId << std::endl;
     }
 }
@@ -75,6 +93,14 @@ void QuestDialogueIntegration::unregisterDialogueComponent(Components::EntityId
     }
 }
 
+void QuestDialogueIntegration::unregisterStatsComponent(Components::EntityId entityId) {
+    m_statsComponents.erase(entityId);
+}
+
+void QuestDialogueIntegration::unregisterInventoryComponent(Components::EntityId entityId) {
+    m_inventoryComponents.erase(entityId);
+}
+
 void QuestDialogueIntegration::setupDialogueQuestActions(std::shared_ptr<Components::DialogueComponent> dialogueComponent) {
     if (!dialogueComponent) {
         return;
@@ -97,6 +123,35 @@ void QuestDialogueIntegration::setupDialogueQuestActions(std::shared_ptr<Compone
         return false;
     });
     
+    // Compiled quest conditions skip re-parsing targets and operations
+    dialogueComponent->setCompiledConditionEvaluator([this, dialogueComponent](const Components::DialogueInstruction& instruction,
+                                                                                const Components::DialogueProgram& program) {
+        Components::EntityId entityId = 0;
+        for (const auto& pair : m_dialogueComponents) {
+            if (pair.second == dialogueComponent) {
+                entityId = pair.first;
+                break;
+            }
+        }
+        
+        return entityId != 0 && handleCompiledCondition(entityId, instruction, program);
+    });
+    
+    // Cached quest condition results stay valid until quest state or registration changes
+    dialogueComponent->setExternalConditionVersion([this, dialogueComponent]() {
+        uint64_t version = m_questRegistrationVersion << 32;
+        for (const auto& pair : m_dialogueComponents) {
+            if (pair.second == dialogueComponent) {
+                auto questComponent = getQuestComponent(pair.first);
+                if (questComponent) {
+                    version += questComponent->getStateVersion();
+                }
+                break;
+            }
+        }
+        return version;
+    });
+    
     // Set up external action executor
     dialogueComponent->setExternalActionExecutor([this, dialogueComponent](const Components::DialogueAction& action) {
         // Find the entity ID for this dialogue component
@@ -238,52 +293,16 @@ bool QuestDialogueIntegration::handleDialogueAction(Components::EntityId entityI
 }
 
 bool QuestDialogueIntegration::handleDialogueCondition(Components::EntityId entityId, const Components::DialogueCondition& condition) {
-    auto questComponent = getQuestComponent(entityId);
-    if (!questComponent) {
-        return false;
-    }
+    // Compile through the same path as dialogue trees
+    Components::DialogueProgram program;
+    program.compileConditions({condition});
+    const Components::DialogueInstruction& instruction = program.getInstruction(0);
     
     bool result = false;
-    
-    // Handle quest-related dialogue conditions
-    if (condition.type == "quest_active") {
-        result = isQuestActiveForDialogue(entityId, condition.target);
-    }
-    else if (condition.type == "quest_completed") {
-        result = isQuestCompletedForDialogue(entityId, condition.target);
-    }
-    else if (condition.type == "objective_completed") {
-        // Parse quest ID and objective ID from target (format: "questId:objectiveId")
-        size_t colonPos = condition.target.find(':');
-        if (colonPos != std::string::npos) {
-            std::string questId = condition.target.substr(0, colonPos);
-            std::string objectiveId = condition.target.substr(colonPos + 1);
-            result = isObjectiveCompletedForDialogue(entityId, questId, objectiveId);
-        }
-    }
-    else if (condition.type == "quest_variable") {
-        // Parse quest ID and variable key from target (format: "questId:variableKey")
-        size_t colonPos = condition.target.find(':');
-        if (colonPos != std::string::npos) {
-            std::string questId = condition.target.substr(0, colonPos);
-            std::string variableKey = condition.target.substr(colonPos + 1);
-            std::string variableValue = getQuestVariableForDialogue(entityId, questId, variableKey);
-            
-            // Compare with condition value
-            if (condition.operation == "==") {
-                result = (variableValue == condition.value);
-            } else if (condition.operation == "!=") {
-                result = (variableValue != condition.value);
-            } else if (condition.operation == ">") {
-                result = (std::stoi(variableValue) > std::stoi(condition.value));
-            } else if (condition.operation == "<") {
-                result = (std::stoi(variableValue) < std::stoi(condition.value));
-            } else if (condition.operation == ">=") {
-                result = (std::stoi(variableValue) >= std::stoi(condition.value));
-            } else if (condition.operation == "<=") {
-                result = (std::stoi(variableValue) <= std::stoi(condition.value));
-            }
-        }
+    if (instruction.opcode == Components::DialogueOpcode::Constant) {
+        result = instruction.value != 0;
+    } else {
+        result = handleCompiledCondition(entityId, instruction, program);
     }
     
     // Apply negation if specified
@@ -294,6 +313,70 @@ bool QuestDialogueIntegration::handleDialogueCondition(Components::EntityId enti
     return result;
 }
 
+bool QuestDialogueIntegration::handleCompiledCondition(Components::EntityId entityId, const Components::DialogueInstruction& instruction,
+                                                       const Components::DialogueProgram& program) const {
+    if (instruction.opcode == Components::DialogueOpcode::Stat) {
+        auto it = m_statsComponents.find(entityId);
+        if (it == m_statsComponents.end()) {
+            return false;
+        }
+        
+        const Components::StatsComponent& stats = *it->second;
+        double value = 0.0;
+        switch (instruction.name) {
+            case Components::DialogueProgram::STAT_CURRENT_HP: value = stats.getCurrentHP(); break;
+            case Components::DialogueProgram::STAT_CURRENT_MP: value = stats.getCurrentMP(); break;
+            case Components::DialogueProgram::STAT_LEVEL: value = stats.getLevel(); break;
+            case Components::DialogueProgram::STAT_EXPERIENCE: value = stats.getCurrentExperience(); break;
+            default: value = stats.getStat(static_cast<Components::StatType>(instruction.name)); break;
+        }
+        return Components::DialogueValue::compare(value, instruction.compare, program.getConstant(instruction.value));
+    }
+    
+    if (instruction.opcode == Components::DialogueOpcode::Item) {
+        auto it = m_inventoryComponents.find(entityId);
+        int quantity = (it != m_inventoryComponents.end()) ? it->second->getItemQuantity(program.getConstant(instruction.name).text) : 0;
+        return Components::DialogueValue::compare(static_cast<double>(quantity), instruction.compare,
+                                                  program.getConstant(instruction.value));
+    }
+    
+    auto questComponent = getQuestComponent(entityId);
+    if (!questComponent) {
+        return false;
+    }
+    
+    const std::string& questId = program.getConstant(instruction.name).text;
+    
+    switch (instruction.opcode) {
+        case Components::DialogueOpcode::QuestActive:
+            return questComponent->isQuestActive(questId);
+            
+        case Components::DialogueOpcode::QuestCompleted:
+            return questComponent->isQuestCompleted(questId);
+            
+        case Components::DialogueOpcode::ObjectiveCompleted:
+            return questComponent->isObjectiveCompleted(questId, program.getConstant(instruction.subName).text);
+            
+        case Components::DialogueOpcode::QuestVariable: {
+            static const std::string emptyValue;
+            const Components::ActiveQuest* activeQuest = questComponent->getActiveQuest(questId);
+            const std::string* variableValue = &emptyValue;
+            if (activeQuest) {
+                auto it = activeQuest->variables.find(program.getConstant(instruction.subName).text);
+                if (it != activeQuest->variables.end()) {
+                    variableValue = &it->second;
+                }
+            }
+            
+            // Compare with condition value
+            return Components::DialogueValue::compare(*variableValue, instruction.compare, program.getConstant(instruction.value));
+        }
+        
+        default:
+            return false;
+    }
+}
+
 bool QuestDialogueIntegration::startQuestFromDialogue(Components::EntityId entityId, const std::string& questId, const std::string& startedBy) {
     auto questComponent = getQuestComponent(entityId);
     if (!questComponent) {
@@ -2,6 +2,8 @@
 
 #include "../components/QuestComponent.h"
 #include "../components/DialogueComponent.h"
+#include "../components/StatsComponent.h"
+#include "../components/InventoryComponent.h"
 #include "../entities/EntityManager.h"
 #include <memory>
 #include <functional>
@@ -54,6 +56,22 @@ public:
     void registerDialogueComponent(Components::EntityId entityId, 
                                   std::shared_ptr<Components::DialogueComponent> dialogueComponent);
     
+    /**
+     * Register stats component for dialogue stat conditions
+     * @param entityId Entity ID
+     * @param statsComponent Stats component
+     */
+    void registerStatsComponent(Components::EntityId entityId,
+                                std::shared_ptr<Components::StatsComponent> statsComponent);
+    
+    /**
+     * Register inventory component for dialogue item conditions
+     * @param entityId Entity ID
+     * @param inventoryComponent Inventory component
+     */
+    void registerInventoryComponent(Components::EntityId entityId,
+                                    std::shared_ptr<Components::InventoryComponent> inventoryComponent);
+    
     /**
      * Unregister quest component
      * @param entityId Entity ID
@@ -66,6 +84,18 @@ public:
      */
     void unregisterDialogueComponent(Components::EntityId entityId);
     
+    /**
+     * Unregister stats component
+     * @param entityId Entity ID
+     */
+    void unregisterStatsComponent(Components::EntityId entityId);
+    
+    /**
+     * Unregister inventory component
+     * @param entityId Entity ID
+     */
+    void unregisterInventoryComponent(Components::EntityId entityId);
+    
     /**
      * Setup dialogue actions for quest integration
      * @param dialogueComponent Dialogue component to setup
@@ -94,6 +124,16 @@ public:
      */
     bool handleDialogueCondition(Components::EntityId entityId, const Components::DialogueCondition& condition);
     
+    /**
+     * Handle compiled dialogue condition evaluation
+     * @param entityId Entity ID
+     * @param instruction Compiled quest, stat or item condition
+     * @param program Program holding the condition's constants
+     * @return true if condition is met, before negation
+     */
+    bool handleCompiledCondition(Components::EntityId entityId, const Components::DialogueInstruction& instruction,
+                                 const Components::DialogueProgram& program) const;
+    
     /**
      * Start quest from dialogue
      * @param entityId Entity ID
@@ -238,12 +278,17 @@ private:
     // Component registries
     std::unordered_map<Components::EntityId, std::shared_ptr<Components::QuestComponent>> m_questComponents;
     std::unordered_map<Components::EntityId, std::shared_ptr<Components::DialogueComponent>> m_dialogueComponents;
+    std::unordered_map<Components::EntityId, std::shared_ptr<Components::StatsComponent>> m_statsComponents;
+    std::unordered_map<Components::EntityId, std::shared_ptr<Components::InventoryComponent>> m_inventoryComponents;
     
     // Event callbacks
     std::function<void(Components::EntityId, const std::string&, const std::string&)> m_questEventCallback;
     std::function<void(Components::EntityId, const std::string&, const std::string&)> m_dialogueEventCallback;
     std::function<void(const std::string&, const std::string&, Components::EntityId)> m_worldEventHandler;
     
+    // Changes whenever a quest component is registered or unregistered
+    uint64_t m_questRegistrationVersion;
+    
     bool m_initialized;
 };
 
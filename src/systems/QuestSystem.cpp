@@ -36,12 +36,15 @@ void QuestSystem::update(float deltaTime) {
 }
 
 void QuestSystem::onUpdate(float deltaTime) {
-    // For now, we'll implement a simple update mechanism
-    // In a full implementation, this would iterate through all entities with QuestComponent
-    // and update their quest timers
+    // Count down time-limited quests; timed out quests fail here
+    if (m_componentManager) {
+        m_componentManager->forEachComponent<Components::QuestComponent>(
+            [deltaTime](Entity, std::shared_ptr<Components::QuestComponent> questComponent) {
+                questComponent->updateQuestTimers(deltaTime);
+            });
+    }
     
-    // TODO: Integrate with ComponentManager when available
-    // This is a placeholder implementation for the quest management functionality
+    flushObjectiveEvents();
 }
 
 void QuestSystem::shutdown() {
@@ -130,29 +133,47 @@ void QuestSystem::registerQuestDefinition(const Components::QuestDefinition& def
 // Global quest tracking
 
 void QuestSystem::trackKillGlobal(const std::string& enemyType, int count) {
-    // TODO: Implement global tracking when ComponentManager integration is available
-    // For now, this is a placeholder
-    std::cout << "Global kill tracking: " << enemyType << " x" << count << std::endl;
+    queueObjectiveEvent(Components::ObjectiveEventKey(Components::ObjectiveType::Kill, Utils::StringId(enemyType)), count);
 }
 
 void QuestSystem::trackItemCollectionGlobal(const std::string& itemId, int count) {
-    // TODO: Implement global tracking when ComponentManager integration is available
-    std::cout << "Global item collection tracking: " << itemId << " x" << count << std::endl;
+    queueObjectiveEvent(Components::ObjectiveEventKey(Components::ObjectiveType::Collect, Utils::StringId(itemId)), count);
 }
 
 void QuestSystem::trackNPCInteractionGlobal(const std::string& npcId) {
-    // TODO: Implement global tracking when ComponentManager integration is available
-    std::cout << "Global NPC interaction tracking: " << npcId << std::endl;
+    queueObjectiveEvent(Components::ObjectiveEventKey(Components::ObjectiveType::Talk, Utils::StringId(npcId)), 1);
 }
 
 void QuestSystem::trackLocationVisitGlobal(const std::string& locationId) {
-    // TODO: Implement global tracking when ComponentManager integration is available
-    std::cout << "Global location visit tracking: " << locationId << std::endl;
+    queueObjectiveEvent(Components::ObjectiveEventKey(Components::ObjectiveType::Reach, Utils::StringId(locationId)), 1);
 }
 
 void QuestSystem::trackCustomObjectiveGlobal(const std::string& objectiveType, const std::string& target, int count) {
-    // TODO: Implement global tracking when ComponentManager integration is available
-    std::cout << "Global custom objective tracking: " << objectiveType << " -> " << target << " x" << count << std::endl;
+    queueObjectiveEvent(Components::ObjectiveEventKey(Components::ObjectiveType::Custom, Utils::StringId(target),
+                                                      Utils::StringId(objectiveType)), count);
+}
+
+int QuestSystem::flushObjectiveEvents() {
+    if (m_pendingEvents.empty()) {
+        return 0;
+    }
+    
+    // Callbacks may queue more events; those wait for the next frame
+    std::vector<PendingObjectiveEvent> events;
+    events.swap(m_pendingEvents);
+    m_pendingEventIndex.clear();
+    
+    m_progressUpdates.clear();
+    int advanced = 0;
+    for (const auto& event : events) {
+        advanced += Components::QuestComponent::dispatchObjectiveEvent(event.key, event.count, &m_progressUpdates);
+    }
+    
+    if (!m_progressUpdates.empty() && m_objectiveProgressCallback) {
+        m_objectiveProgressCallback(m_progressUpdates);
+    }
+    
+    return advanced;
 }
 
 // Quest validation and integrity
@@ -193,6 +214,17 @@ std::string QuestSystem::getQuestStatistics() const {
 
 // Private helper methods
 
+void QuestSystem::queueObjectiveEvent(const Components::ObjectiveEventKey& key, int count) {
+    auto it = m_pendingEventIndex.find(key);
+    if (it != m_pendingEventIndex.end()) {
+        m_pendingEvents[it->second].count += count;
+        return;
+    }
+    
+    m_pendingEventIndex[key] = m_pendingEvents.size();
+    m_pendingEvents.push_back({key, count});
+}
+
 void QuestSystem::setupQuestCallbacks(EntityId entityId, Components::QuestComponent* questComponent) {
     if (!questComponent) return;
     
@@ -2,10 +2,13 @@
 
 #include "System.h"
 #include "../components/QuestComponent.h"
+#include "../components/ComponentManager.h"
 #include "../entities/EntityManager.h"
 #include "../entities/Entity.h"
 #include <memory>
 #include <functional>
+#include <unordered_map>
+#include <vector>
 
 namespace RPGEngine {
 namespace Systems {
@@ -46,6 +49,15 @@ public:
      */
     void shutdown() override;
     
+    /**
+     * Set component manager
+     * Quest timers of every QuestComponent it holds are updated each frame.
+     * @param componentManager Component manager
+     */
+    void setComponentManager(std::shared_ptr<RPGEngine::ComponentManager> componentManager) {
+        m_componentManager = componentManager;
+    }
+    
     // Quest management helpers
     
     /**
@@ -80,6 +92,8 @@ public:
     void registerQuestDefinition(const Components::QuestDefinition& definition);
     
     // Global quest tracking
+    // Events are queued and applied once per frame in update(), through the
+    // objective index, to every quest component with an objective waiting on them.
     
     /**
      * Track kill globally (for all entities with QuestComponent)
@@ -115,6 +129,20 @@ public:
      */
     void trackCustomObjectiveGlobal(const std::string& objectiveType, const std::string& target, int count = 1);
     
+    /**
+     * Apply the queued tracking events now
+     * Called from update(); the progress made is reported to the objective
+     * progress callback in one batch.
+     * @return Number of objectives advanced
+     */
+    int flushObjectiveEvents();
+    
+    /**
+     * Get number of queued tracking events
+     * @return Queued events, with repeats of an event merged
+     */
+    size_t getPendingObjectiveEventCount() const { return m_pendingEvents.size(); }
+    
     // Quest validation and integrity
     
     /**
@@ -177,6 +205,15 @@ public:
         m_globalRewardGivenCallback = callback;
     }
     
+    /**
+     * Set objective progress callback
+     * @param callback Function called once per frame with all objective progress
+     *                 from tracking events, e.g. QuestUI::showObjectiveProgress
+     */
+    void setObjectiveProgressCallback(std::function<void(const std::vector<Components::ObjectiveProgressUpdate>&)> callback) {
+        m_objectiveProgressCallback = callback;
+    }
+    
 protected:
     /**
      * Called during update
@@ -206,7 +243,15 @@ private:
      */
     std::string questDefinitionToJson(const Components::QuestDefinition& definition);
     
+    /**
+     * Queue a tracking event, merging it with a queued repeat
+     * @param key Event
+     * @param count Progress amount
+     */
+    void queueObjectiveEvent(const Components::ObjectiveEventKey& key, int count);
+    
     std::shared_ptr<RPGEngine::EntityManager> m_entityManager;
+    std::shared_ptr<RPGEngine::ComponentManager> m_componentManager;
     
     // Global callbacks
     std::function<void(EntityId, const std::string&)> m_globalQuestStartedCallback;
@@ -214,11 +259,19 @@ private:
     std::function<void(EntityId, const std::string&, const std::string&)> m_globalQuestFailedCallback;
     std::function<void(EntityId, const std::string&, const std::string&)> m_globalObjectiveCompletedCallback;
     std::function<void(EntityId, const Components::QuestReward&)> m_globalRewardGivenCallback;
+    std::function<void(const std::vector<Components::ObjectiveProgressUpdate>&)> m_objectiveProgressCallback;
+    
+    // Tracking events queued for the next update
+    struct PendingObjectiveEvent {
+        Components::ObjectiveEventKey key;
+        int count;
+    };
+    std::vector<PendingObjectiveEvent> m_pendingEvents;
+    std::unordered_map<Components::ObjectiveEventKey, size_t, Components::ObjectiveEventKeyHash> m_pendingEventIndex;
+    std::vector<Components::ObjectiveProgressUpdate> m_progressUpdates;
     
     // Quest validation data
     std::vector<std::string> m_validationErrors;
-    
-    bool m_initialized;
 };
 
 } // namespace Systems
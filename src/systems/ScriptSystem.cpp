@@ -1,7 +1,6 @@
 #include "ScriptSystem.h"
 #include "../scripting/LuaScriptEngine.h"
 #include <iostream>
-#include <sys/stat.h>
 
 namespace RPGEngine {
     namespace Systems {
@@ -9,6 +8,10 @@ namespace RPGEngine {
         ScriptSystem::ScriptSystem() : System("ScriptSystem"), hotReloadingEnabled(false) {
         }
 
+        ScriptSystem::~ScriptSystem() {
+            enableHotReloading(false);
+        }
+
         bool ScriptSystem::initialize() {
             // Create default Lua script engine if none provided
             if (!scriptEngine) {
@@ -108,7 +111,10 @@ namespace RPGEngine {
                 std::cerr << "Script file execution error: " << scriptEngine->getLastError() << std::endl;
             } else {
                 // Track file for hot reloading
-                scriptFileTimestamps[filename] = getFileModificationTime(filename);
+                Core::FileWatchId& watch = scriptFileWatches[filename];
+                if (hotReloadingEnabled && watch == 0) {
+                    watch = watchScriptFile(filename);
+                }
             }
             return result;
         }
@@ -143,20 +149,42 @@ namespace RPGEngine {
             }
         }
 
-        void ScriptSystem::checkForScriptChanges() {
-            for (auto& pair : scriptFileTimestamps) {
-                const std::string& filename = pair.first;
-                std::time_t& lastModified = pair.second;
-                
-                std::time_t currentModified = getFileModificationTime(filename);
-                if (currentModified > lastModified) {
-                    std::cout << "Script file changed, reloading: " << filename << std::endl;
-                    executeScriptFile(filename);
-                    lastModified = currentModified;
+        void ScriptSystem::enableHotReloading(bool enable) {
+            if (enable == hotReloadingEnabled) {
+                return;
+            }
+
+            hotReloadingEnabled = enable;
+            if (enable && !fileWatcher) {
+                fileWatcher = std::make_shared<Core::FileWatcher>();
+                ownsFileWatcher = true;
+            }
+
+            for (auto& pair : scriptFileWatches) {
+                if (enable) {
+                    pair.second = watchScriptFile(pair.first);
+                } else if (pair.second != 0) {
+                    fileWatcher->unwatch(pair.second);
+                    pair.second = 0;
                 }
             }
         }
 
+        void ScriptSystem::setFileWatcher(std::shared_ptr<Core::FileWatcher> watcher) {
+            bool enabled = hotReloadingEnabled;
+            enableHotReloading(false);
+            fileWatcher = watcher;
+            ownsFileWatcher = false;
+            enableHotReloading(enabled);
+        }
+
+        void ScriptSystem::checkForScriptChanges() {
+            // Changed files are re-executed from the watcher callbacks
+            if (fileWatcher && ownsFileWatcher) {
+                fileWatcher->update();
+            }
+        }
+
         void ScriptSystem::setupEngineAPI() {
             if (!scriptEngine) {
                 return;
@@ -201,12 +229,11 @@ namespace RPGEngine {
             }
         }
 
-        std::time_t ScriptSystem::getFileModificationTime(const std::string& filename) {
-            struct stat fileInfo;
-            if (stat(filename.c_str(), &fileInfo) == 0) {
-                return fileInfo.st_mtime;
-            }
-            return 0;
+        Core::FileWatchId ScriptSystem::watchScriptFile(const std::string& filename) {
+            return fileWatcher->watch(filename, [this](const std::string& path) {
+                std::cout << "Script file changed, reloading: " << path << std::endl;
+                executeScriptFile(path);
+            });
         }
 
     } // namespace Systems
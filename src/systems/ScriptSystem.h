@@ -4,10 +4,10 @@
 #include "../scripting/IScriptEngine.h"
 #include "../components/ScriptComponent.h"
 #include "../components/Component.h"
+#include "../core/FileWatcher.h"
 #include <memory>
 #include <unordered_map>
 #include <string>
-#include <ctime>
 
 namespace RPGEngine {
     namespace Systems {
@@ -18,7 +18,7 @@ namespace RPGEngine {
         class ScriptSystem : public System {
         public:
             ScriptSystem();
-            ~ScriptSystem() override = default;
+            ~ScriptSystem() override;
 
             // System lifecycle
             bool initialize() override;
@@ -46,19 +46,22 @@ namespace RPGEngine {
             void onComponentAdded(Components::EntityId entityId, std::shared_ptr<Components::ScriptComponent> component);
             void onComponentRemoved(Components::EntityId entityId);
 
-            // Hot reloading support
-            void enableHotReloading(bool enable) { hotReloadingEnabled = enable; }
+            // Hot reloading support (executed script files re-run when they change)
+            void enableHotReloading(bool enable);
+            void setFileWatcher(std::shared_ptr<Core::FileWatcher> watcher);
             void checkForScriptChanges();
 
         private:
             std::shared_ptr<Scripting::IScriptEngine> scriptEngine;
             std::unordered_map<Components::EntityId, std::shared_ptr<Components::ScriptComponent>> scriptComponents;
-            std::unordered_map<std::string, std::time_t> scriptFileTimestamps; // For hot reloading
+            std::unordered_map<std::string, Core::FileWatchId> scriptFileWatches; // For hot reloading (0 = not watched)
+            std::shared_ptr<Core::FileWatcher> fileWatcher;
+            bool ownsFileWatcher = false;
             bool hotReloadingEnabled = false;
 
             void setupEngineAPI();
             void updateScriptComponents(float deltaTime);
-            std::time_t getFileModificationTime(const std::string& filename);
+            Core::FileWatchId watchScriptFile(const std::string& filename);
         };
 
     } // namespace Systems
@@ -10,7 +10,7 @@ namespace RPGEngine {
     SystemManager::SystemManager() 
         : m_initialized(false)
         , m_parallelUpdatesEnabled(false)
-        , m_threadPool(std::make_unique<Core::ThreadPool>())
+        , m_threadPool(std::make_shared<Core::ThreadPool>())
     {
     }
     
@@ -202,6 +202,14 @@ namespace RPGEngine {
          */
         bool isParallelUpdatesEnabled() const { return m_parallelUpdatesEnabled; }
         
+        /**
+         * Get the engine job system
+         * Runs parallel system updates; other subsystems share it for their
+         * background jobs instead of starting threads of their own.
+         * @return Thread pool
+         */
+        std::shared_ptr<Core::ThreadPool> getJobSystem() const { return m_threadPool; }
+        
     private:
         struct SystemEntry {
             std::shared_ptr<ISystem> system;
@@ -226,7 +234,7 @@ namespace RPGEngine {
         bool m_initialized;
         bool m_parallelUpdatesEnabled;
         EventDispatcher m_eventDispatcher;
-        std::unique_ptr<Core::ThreadPool> m_threadPool;
+        std::shared_ptr<Core::ThreadPool> m_threadPool;
         
         /**
          * Update the execution order based on dependencies and priorities
@@ -17,6 +17,7 @@ extern "C" {
 
 // Primary API
 extern unsigned char *stbi_load(char const *filename, int *x, int *y, int *channels_in_file, int desired_channels);
+extern unsigned char *stbi_load_from_memory(unsigned char const *buffer, int len, int *x, int *y, int *channels_in_file, int desired_channels);
 extern void stbi_image_free(void *retval_from_stbi_load);
 extern char *stbi_failure_reason(void);
 
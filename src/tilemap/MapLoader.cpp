@@ -2,6 +2,7 @@
 #include "../utils/Base64.h"
 #include "../utils/Zlib.h"
 #include "../resources/TextureResource.h"
+#include "../resources/VirtualFileSystem.h"
 #include <iostream>
 #include <sstream>
 #include <algorithm>
@@ -20,8 +21,13 @@ MapLoader::~MapLoader() {
 }
 
 std::shared_ptr<Tilemap> MapLoader::loadMap(const std::string& filename) {
-    // Parse TMX file
-    auto rootNode = m_xmlParser.parseFile(filename);
+    // Parse TMX file (from a packed archive if one has it)
+    std::string xml;
+    if (!Resources::VirtualFileSystem::getInstance().readText(filename, xml)) {
+        std::cerr << "Failed to open TMX file: " << filename << std::endl;
+        return nullptr;
+    }
+    auto rootNode = m_xmlParser.parseString(xml);
     if (!rootNode || rootNode->getName() != "map") {
         std::cerr << "Failed to parse TMX file: " << filename << std::endl;
         return nullptr;
@@ -38,15 +44,22 @@ std::shared_ptr<Tilemap> MapLoader::loadMap(const std::string& filename) {
     std::string basePath = filename.substr(0, filename.find_last_of("/\\") + 1);
     
     // Parse tilesets
+    std::vector<std::shared_ptr<Resources::Resource>> newTextures;
     auto tilesetNodes = rootNode->getChildrenByName("tileset");
     for (const auto& tilesetNode : tilesetNodes) {
         uint32_t firstGid = tilesetNode->getAttributeInt("firstgid", 1);
-        auto tileset = parseTileset(tilesetNode, firstGid, basePath);
+        auto tileset = parseTileset(tilesetNode, firstGid, basePath, newTextures);
         if (tileset) {
             map->addTileset(tileset);
         }
     }
     
+    // Register the map's new textures with one table update, then load them
+    m_resourceManager->addResources(newTextures);
+    for (const auto& texture : newTextures) {
+        m_resourceManager->loadResource(texture->getId());
+    }
+    
     // Parse layers
     auto layerNodes = rootNode->getChildrenByName("layer");
     for (const auto& layerNode : layerNodes) {
@@ -59,6 +72,51 @@ std::shared_ptr<Tilemap> MapLoader::loadMap(const std::string& filename) {
     return map;
 }
 
+bool MapLoader::buildManifest(const std::string& filename, Resources::PreloadManifest& manifest) {
+    std::string xml;
+    if (!Resources::VirtualFileSystem::getInstance().readText(filename, xml)) {
+        std::cerr << "Failed to open TMX file: " << filename << std::endl;
+        return false;
+    }
+    auto rootNode = m_xmlParser.parseString(xml);
+    if (!rootNode || rootNode->getName() != "map") {
+        std::cerr << "Failed to parse TMX file: " << filename << std::endl;
+        return false;
+    }
+    
+    std::string basePath = filename.substr(0, filename.find_last_of("/\\") + 1);
+    for (const auto& tilesetNode : rootNode->getChildrenByName("tileset")) {
+        collectTilesetDependencies(tilesetNode, basePath, manifest);
+    }
+    
+    return true;
+}
+
+void MapLoader::collectTilesetDependencies(std::shared_ptr<Utils::XMLNode> tilesetNode, const std::string& basePath, Resources::PreloadManifest& manifest) {
+    std::string source = tilesetNode->getAttribute("source");
+    if (!source.empty()) {
+        std::string tilesetPath = basePath + source;
+        std::string xml;
+        std::shared_ptr<Utils::XMLNode> externalTilesetNode;
+        if (Resources::VirtualFileSystem::getInstance().readText(tilesetPath, xml)) {
+            externalTilesetNode = m_xmlParser.parseString(xml);
+        }
+        if (!externalTilesetNode || externalTilesetNode->getName() != "tileset") {
+            std::cerr << "Failed to parse external tileset: " << tilesetPath << std::endl;
+            return;
+        }
+        collectTilesetDependencies(externalTilesetNode, basePath, manifest);
+        return;
+    }
+    
+    // Same ID and path as parseTileset() gives the texture
+    auto imageNode = tilesetNode->getChild("image");
+    if (imageNode && !imageNode->getAttribute("source").empty()) {
+        std::string name = tilesetNode->getAttribute("name", "Unnamed Tileset");
+        manifest.add({"tileset_" + name, Resources::ResourceCategory::Texture, basePath + imageNode->getAttribute("source")});
+    }
+}
+
 std::shared_ptr<Tilemap> MapLoader::parseMap(std::shared_ptr<Utils::XMLNode> mapNode) {
     // Parse map properties
     MapProperties properties;
@@ -110,20 +168,25 @@ std::shared_ptr<Tilemap> MapLoader::parseMap(std::shared_ptr<Utils::XMLNode> map
     return std::make_shared<Tilemap>(properties);
 }
 
-std::shared_ptr<Tileset> MapLoader::parseTileset(std::shared_ptr<Utils::XMLNode> tilesetNode, uint32_t firstGid, const std::string& basePath) {
+std::shared_ptr<Tileset> MapLoader::parseTileset(std::shared_ptr<Utils::XMLNode> tilesetNode, uint32_t firstGid, const std::string& basePath,
+                                                 std::vector<std::shared_ptr<Resources::Resource>>& newTextures) {
     // Check if this is an external tileset
     std::string source = tilesetNode->getAttribute("source");
     if (!source.empty()) {
         // Load external tileset
         std::string tilesetPath = basePath + source;
-        auto externalTilesetNode = m_xmlParser.parseFile(tilesetPath);
+        std::string xml;
+        std::shared_ptr<Utils::XMLNode> externalTilesetNode;
+        if (Resources::VirtualFileSystem::getInstance().readText(tilesetPath, xml)) {
+            externalTilesetNode = m_xmlParser.parseString(xml);
+        }
         if (!externalTilesetNode || externalTilesetNode->getName() != "tileset") {
             std::cerr << "Failed to parse external tileset: " << tilesetPath << std::endl;
             return nullptr;
         }
         
         // Parse external tileset
-        return parseTileset(externalTilesetNode, firstGid, basePath);
+        return parseTileset(externalTilesetNode, firstGid, basePath, newTextures);
     }
     
     // Parse tileset properties
@@ -148,9 +211,20 @@ std::shared_ptr<Tileset> MapLoader::parseTileset(std::shared_ptr<Utils::XMLNode>
             // Check if texture already exists
             auto texture = m_resourceManager->getResourceOfType<Resources::TextureResource>(textureId);
             if (!texture) {
-                // Create and load texture
+                // Another tileset of this map may have created it already
+                for (const auto& pending : newTextures) {
+                    if (pending->getId() == textureId) {
+                        texture = std::static_pointer_cast<Resources::TextureResource>(pending);
+                        break;
+                    }
+                }
+            }
+            if (!texture) {
+                // Created here, registered and loaded by loadMap()
                 texture = std::make_shared<Resources::TextureResource>(textureId, texturePath);
-                m_resourceManager->addResource(texture);
+                newTextures.push_back(texture);
+            } else if (!texture->isLoaded() && m_resourceManager->hasResource(textureId)) {
+                // Registered by a preload manifest but not loaded (yet)
                 m_resourceManager->loadResource(textureId);
             }
             
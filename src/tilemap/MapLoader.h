@@ -5,6 +5,7 @@
 #include "../utils/XMLParser.h"
 #include <string>
 #include <memory>
+#include <vector>
 
 namespace RPGEngine {
 namespace Tilemap {
@@ -33,6 +34,15 @@ public:
      */
     std::shared_ptr<Tilemap> loadMap(const std::string& filename);
     
+    /**
+     * List the resources a TMX file needs, without loading anything
+     * Adds a texture entry per tileset image, with the IDs loadMap() uses.
+     * @param filename TMX file path
+     * @param manifest Manifest to add the resources to
+     * @return true if the map was parsed
+     */
+    bool buildManifest(const std::string& filename, Resources::PreloadManifest& manifest);
+    
     /**
      * Get the resource manager
      * @return Resource manager
@@ -52,9 +62,19 @@ private:
      * @param tilesetNode Tileset node
      * @param firstGid First global tile ID
      * @param basePath Base path for relative paths
+     * @param newTextures Receives textures created for the tileset, for the caller to register in bulk
      * @return Parsed tileset, or nullptr if parsing failed
      */
-    std::shared_ptr<Tileset> parseTileset(std::shared_ptr<Utils::XMLNode> tilesetNode, uint32_t firstGid, const std::string& basePath);
+    std::shared_ptr<Tileset> parseTileset(std::shared_ptr<Utils::XMLNode> tilesetNode, uint32_t firstGid, const std::string& basePath,
+                                          std::vector<std::shared_ptr<Resources::Resource>>& newTextures);
+    
+    /**
+     * Add the texture of a tileset node to a manifest
+     * @param tilesetNode Tileset node (may reference an external tileset)
+     * @param basePath Base path for relative paths
+     * @param manifest Manifest to add the texture to
+     */
+    void collectTilesetDependencies(std::shared_ptr<Utils::XMLNode> tilesetNode, const std::string& basePath, Resources::PreloadManifest& manifest);
     
     /**
      * Parse a layer node
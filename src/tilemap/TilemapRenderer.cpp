@@ -1,5 +1,7 @@
 #include "TilemapRenderer.h"
+#include "../graphics/SpriteSoABuffer.h"
 #include <iostream>
+#include <algorithm>
 
 namespace RPGEngine {
 namespace Tilemap {
@@ -7,6 +9,7 @@ namespace Tilemap {
 TilemapRenderer::TilemapRenderer(std::shared_ptr<Graphics::IGraphicsAPI> graphics)
     : System("TilemapRenderer")
     , m_graphics(graphics)
+    , m_commandQueue(graphics)
     , m_useFrustumCulling(true)
     , m_renderColliders(false)
     , m_colliderColor(0xFF0000FF) // Red with full alpha
@@ -25,6 +28,19 @@ bool TilemapRenderer::onInitialize() {
         return false;
     }
     
+    if (!m_commandQueue.initialize()) {
+        std::cerr << "Failed to initialize TilemapRenderer command queue" << std::endl;
+        return false;
+    }
+    
+    // 1x1 white texture for solid-colour collider outlines
+    const uint8_t white[4] = { 255, 255, 255, 255 };
+    m_whiteTexture = std::make_shared<Graphics::Texture>(m_graphics);
+    if (!m_whiteTexture->createFromData(1, 1, Graphics::TextureFormat::RGBA, white)) {
+        std::cerr << "Failed to create TilemapRenderer white texture" << std::endl;
+        return false;
+    }
+    
     std::cout << "TilemapRenderer initialized" << std::endl;
     return true;
 }
@@ -37,24 +53,35 @@ void TilemapRenderer::onUpdate(float deltaTime) {
     // Update animations
     updateAnimations(deltaTime);
     
-    // Render each layer
+    // Record each visible layer into its own list and submit them in layer order.
+    // The shader program and view matrices bound by the caller stay in effect.
+    m_commandQueue.beginRecording();
     for (size_t i = 0; i < m_tilemap->getLayerCount(); ++i) {
         auto layer = m_tilemap->getLayer(i);
         if (layer && layer->getProperties().visible) {
-            renderLayer(layer);
+            Graphics::RenderCommandList& list = m_commandQueue.acquireList(i);
+            recordLayerRows(i, 0, layer->getHeight(), list);
             
             // Render colliders if enabled
             if (m_renderColliders) {
-                renderColliders(layer);
+                recordColliders(i, list);
             }
         }
     }
+    if (!m_decorations.empty()) {
+        recordDecorations(m_commandQueue.acquireList(m_tilemap->getLayerCount()));
+    }
+    m_commandQueue.endRecording();
+    m_commandQueue.submit();
 }
 
 void TilemapRenderer::onShutdown() {
     // Clear animation states
     m_animationStates.clear();
     
+    m_whiteTexture.reset();
+    m_commandQueue.shutdown();
+    
     std::cout << "TilemapRenderer shutdown" << std::endl;
 }
 
@@ -106,193 +133,269 @@ void TilemapRenderer::updateAnimations(float deltaTime) {
     }
 }
 
-void TilemapRenderer::renderLayer(std::shared_ptr<TileLayer> layer) {
-    if (!layer || !m_tilemap) {
+void TilemapRenderer::recordColliders(size_t layerIndex, Graphics::RenderCommandList& list) const {
+    auto layer = m_tilemap ? m_tilemap->getLayer(layerIndex) : nullptr;
+    if (!layer || !m_whiteTexture) {
         return;
     }
     
     const auto& properties = m_tilemap->getProperties();
     const auto& layerProps = layer->getProperties();
     
-    // Calculate layer offset
+    // Calculate layer offset including parallax
     float offsetX = layerProps.offsetX;
     float offsetY = layerProps.offsetY;
     
-    // Apply parallax if camera is available
-    if (m_camera) {
-        offsetX += m_camera->getPosition().x * (1.0f - layerProps.parallaxX);
-        offsetY += m_camera->getPosition().y * (1.0f - layerProps.parallaxY);
-    }
-    
-    // Calculate visible tile range if using frustum culling
     int startX = 0;
     int startY = 0;
     int endX = layer->getWidth();
     int endY = layer->getHeight();
     
-    if (m_useFrustumCulling && m_camera) {
-        // Calculate visible tile range based on camera frustum
-        float viewLeft = m_camera->getPosition().x - m_camera->getViewport().width * 0.5f;
-        float viewRight = m_camera->getPosition().x + m_camera->getViewport().width * 0.5f;
-        float viewTop = m_camera->getPosition().y - m_camera->getViewport().height * 0.5f;
-        float viewBottom = m_camera->getPosition().y + m_camera->getViewport().height * 0.5f;
-        
-        // Convert to tile coordinates
-        startX = static_cast<int>((viewLeft - offsetX) / properties.tileWidth) - 1;
-        startY = static_cast<int>((viewTop - offsetY) / properties.tileHeight) - 1;
-        endX = static_cast<int>((viewRight - offsetX) / properties.tileWidth) + 2;
-        endY = static_cast<int>((viewBottom - offsetY) / properties.tileHeight) + 2;
+    if (m_camera) {
+        float cameraX = 0.0f;
+        float cameraY = 0.0f;
+        m_camera->getPosition(cameraX, cameraY);
+        offsetX += cameraX * (1.0f - layerProps.parallaxX);
+        offsetY += cameraY * (1.0f - layerProps.parallaxY);
         
-        // Clamp to layer bounds
-        startX = std::max(0, std::min(startX, layer->getWidth()));
-        startY = std::max(0, std::min(startY, layer->getHeight()));
-        endX = std::max(0, std::min(endX, layer->getWidth()));
-        endY = std::max(0, std::min(endY, layer->getHeight()));
+        if (m_useFrustumCulling) {
+            Graphics::Rect view = m_camera->getBounds();
+            startX = std::max(startX, static_cast<int>((view.x - offsetX) / properties.tileWidth) - 1);
+            endX = std::min(endX, static_cast<int>((view.x + view.width - offsetX) / properties.tileWidth) + 2);
+            startY = std::max(startY, static_cast<int>((view.y - offsetY) / properties.tileHeight) - 1);
+            endY = std::min(endY, static_cast<int>((view.y + view.height - offsetY) / properties.tileHeight) + 2);
+        }
     }
     
-    // Render visible tiles
+    // Collider color is packed as 0xRRGGBBAA
+    const float r = ((m_colliderColor >> 24) & 0xFF) / 255.0f;
+    const float g = ((m_colliderColor >> 16) & 0xFF) / 255.0f;
+    const float b = ((m_colliderColor >> 8) & 0xFF) / 255.0f;
+    const float a = (m_colliderColor & 0xFF) / 255.0f;
+    const float thickness = 1.0f;
+    
+    // Outlines are drawn as four thin quads per solid tile, sampling white
     for (int y = startY; y < endY; ++y) {
         for (int x = startX; x < endX; ++x) {
             const Tile* tile = layer->getTile(x, y);
-            if (tile && tile->id != 0) {
-                renderTile(x, y, *tile, layer);
+            if (!tile || tile->id == 0 || !tile->isSolid()) {
+                continue;
+            }
+            
+            float left = x * properties.tileWidth + offsetX;
+            float top = y * properties.tileHeight + offsetY;
+            float width = static_cast<float>(properties.tileWidth);
+            float height = static_cast<float>(properties.tileHeight);
+            
+            const float edges[4][4] = {
+                { left, top, width, thickness },
+                { left, top + height - thickness, width, thickness },
+                { left, top, thickness, height },
+                { left + width - thickness, top, thickness, height }
+            };
+            
+            float* out = list.allocateQuads(m_whiteTexture->getHandle(), 4);
+            for (const auto& edge : edges) {
+                const float px[4] = { edge[0], edge[0] + edge[2], edge[0] + edge[2], edge[0] };
+                const float py[4] = { edge[1], edge[1], edge[1] + edge[3], edge[1] + edge[3] };
+                for (int corner = 0; corner < 4; ++corner) {
+                    *out++ = px[corner];
+                    *out++ = py[corner];
+                    *out++ = 0.0f;
+                    *out++ = r;
+                    *out++ = g;
+                    *out++ = b;
+                    *out++ = a;
+                    *out++ = 0.0f;
+                    *out++ = 0.0f;
+                }
             }
         }
     }
 }
 
-void TilemapRenderer::renderTile(int x, int y, const Tile& tile, std::shared_ptr<TileLayer> layer) {
+void TilemapRenderer::recordLayerRows(size_t layerIndex, int firstRow, int rowCount, Graphics::RenderCommandList& list) const {
     if (!m_tilemap) {
         return;
     }
     
-    const auto& properties = m_tilemap->getProperties();
-    const auto& layerProps = layer->getProperties();
-    
-    // Find tileset and local tile ID
-    std::shared_ptr<Tileset> tileset;
-    uint32_t localTileId;
-    
-    if (!m_tilemap->findTilesetAndLocalId(tile.id, tileset, localTileId)) {
-        return;
-    }
-    
-    // Check if tile is animated
-    if (tileset->getAnimation(localTileId)) {
-        localTileId = getCurrentAnimationFrame(tile.id, tileset);
-    }
-    
-    // Get tile source rectangle
-    int srcX, srcY, srcWidth, srcHeight;
-    if (!tileset->getTileSourceRect(localTileId, srcX, srcY, srcWidth, srcHeight)) {
-        return;
-    }
-    
-    // Calculate destination rectangle
-    float destX = x * properties.tileWidth + layerProps.offsetX;
-    float destY = y * properties.tileHeight + layerProps.offsetY;
-    float destWidth = properties.tileWidth;
-    float destHeight = properties.tileHeight;
-    
-    // Apply parallax if camera is available
-    if (m_camera) {
-        destX += m_camera->getPosition().x * (1.0f - layerProps.parallaxX);
-        destY += m_camera->getPosition().y * (1.0f - layerProps.parallaxY);
-    }
-    
-    // Apply flip and rotation
-    bool flipX = tile.isFlippedH();
-    bool flipY = tile.isFlippedV();
-    float rotation = 0.0f;
-    
-    if (tile.isRotated90()) {
-        rotation = 90.0f;
-    } else if (tile.isRotated180()) {
-        rotation = 180.0f;
-    } else if (tile.isRotated270()) {
-        rotation = 270.0f;
-    }
-    
-    // Draw tile
-    m_graphics->drawTexture(
-        tileset->getTexture()->getHandle(),
-        destX, destY, destWidth, destHeight,
-        srcX, srcY, srcWidth, srcHeight,
-        rotation, flipX, flipY,
-        0xFFFFFFFF, // White with full alpha
-        layerProps.opacity
-    );
-}
-
-void TilemapRenderer::renderColliders(std::shared_ptr<TileLayer> layer) {
-    if (!layer || !m_tilemap) {
+    auto layer = m_tilemap->getLayer(layerIndex);
+    if (!layer || !layer->getProperties().visible) {
         return;
     }
     
     const auto& properties = m_tilemap->getProperties();
     const auto& layerProps = layer->getProperties();
     
-    // Calculate layer offset
+    // Calculate layer offset including parallax
     float offsetX = layerProps.offsetX;
     float offsetY = layerProps.offsetY;
     
-    // Apply parallax if camera is available
+    float cameraX = 0.0f;
+    float cameraY = 0.0f;
     if (m_camera) {
-        offsetX += m_camera->getPosition().x * (1.0f - layerProps.parallaxX);
-        offsetY += m_camera->getPosition().y * (1.0f - layerProps.parallaxY);
+        m_camera->getPosition(cameraX, cameraY);
+        offsetX += cameraX * (1.0f - layerProps.parallaxX);
+        offsetY += cameraY * (1.0f - layerProps.parallaxY);
     }
     
-    // Calculate visible tile range if using frustum culling
     int startX = 0;
-    int startY = 0;
     int endX = layer->getWidth();
-    int endY = layer->getHeight();
+    int startY = std::max(0, firstRow);
+    int endY = std::min(layer->getHeight(), firstRow + rowCount);
     
     if (m_useFrustumCulling && m_camera) {
-        // Calculate visible tile range based on camera frustum
-        float viewLeft = m_camera->getPosition().x - m_camera->getViewport().width * 0.5f;
-        float viewRight = m_camera->getPosition().x + m_camera->getViewport().width * 0.5f;
-        float viewTop = m_camera->getPosition().y - m_camera->getViewport().height * 0.5f;
-        float viewBottom = m_camera->getPosition().y + m_camera->getViewport().height * 0.5f;
-        
-        // Convert to tile coordinates
-        startX = static_cast<int>((viewLeft - offsetX) / properties.tileWidth) - 1;
-        startY = static_cast<int>((viewTop - offsetY) / properties.tileHeight) - 1;
-        endX = static_cast<int>((viewRight - offsetX) / properties.tileWidth) + 2;
-        endY = static_cast<int>((viewBottom - offsetY) / properties.tileHeight) + 2;
+        Graphics::Rect view = m_camera->getBounds();
         
-        // Clamp to layer bounds
-        startX = std::max(0, std::min(startX, layer->getWidth()));
-        startY = std::max(0, std::min(startY, layer->getHeight()));
-        endX = std::max(0, std::min(endX, layer->getWidth()));
-        endY = std::max(0, std::min(endY, layer->getHeight()));
+        startX = std::max(startX, static_cast<int>((view.x - offsetX) / properties.tileWidth) - 1);
+        endX = std::min(endX, static_cast<int>((view.x + view.width - offsetX) / properties.tileWidth) + 2);
+        startY = std::max(startY, static_cast<int>((view.y - offsetY) / properties.tileHeight) - 1);
+        endY = std::min(endY, static_cast<int>((view.y + view.height - offsetY) / properties.tileHeight) + 2);
     }
     
-    // Render colliders for solid tiles
+    const Graphics::Color tint(1.0f, 1.0f, 1.0f, layerProps.opacity);
+    
     for (int y = startY; y < endY; ++y) {
         for (int x = startX; x < endX; ++x) {
             const Tile* tile = layer->getTile(x, y);
-            if (tile && tile->id != 0 && tile->isSolid()) {
-                // Calculate destination rectangle
-                float destX = x * properties.tileWidth + layerProps.offsetX;
-                float destY = y * properties.tileHeight + layerProps.offsetY;
-                float destWidth = properties.tileWidth;
-                float destHeight = properties.tileHeight;
-                
-                // Apply parallax if camera is available
-                if (m_camera) {
-                    destX += m_camera->getPosition().x * (1.0f - layerProps.parallaxX);
-                    destY += m_camera->getPosition().y * (1.0f - layerProps.parallaxY);
+            if (!tile || tile->id == 0) {
+                continue;
+            }
+            
+            std::shared_ptr<Tileset> tileset;
+            uint32_t localTileId;
+            if (!m_tilemap->findTilesetAndLocalId(tile->id, tileset, localTileId)) {
+                continue;
+            }
+            
+            auto texture = tileset->getTexture();
+            if (!texture || texture->getWidth() <= 0 || texture->getHeight() <= 0) {
+                continue;
+            }
+            
+            if (tileset->getAnimation(localTileId)) {
+                uint32_t frameId = getCurrentAnimationFrame(tile->id, tileset);
+                std::shared_ptr<Tileset> frameTileset;
+                if (!m_tilemap->findTilesetAndLocalId(frameId, frameTileset, localTileId)) {
+                    continue;
                 }
-                
-                // Draw collider outline
-                m_graphics->drawRectangleOutline(destX, destY, destWidth, destHeight, m_colliderColor);
+            }
+            
+            int srcX, srcY, srcWidth, srcHeight;
+            if (!tileset->getTileSourceRect(localTileId, srcX, srcY, srcWidth, srcHeight)) {
+                continue;
+            }
+            
+            float texW = static_cast<float>(texture->getWidth());
+            float texH = static_cast<float>(texture->getHeight());
+            float u0 = srcX / texW;
+            float v0 = srcY / texH;
+            float u1 = (srcX + srcWidth) / texW;
+            float v1 = (srcY + srcHeight) / texH;
+            
+            if (tile->isFlippedH()) {
+                std::swap(u0, u1);
+            }
+            if (tile->isFlippedV()) {
+                std::swap(v0, v1);
+            }
+            
+            // Rotation is applied by rotating the texture coordinates around the quad
+            float us[4] = { u0, u1, u1, u0 };
+            float vs[4] = { v0, v0, v1, v1 };
+            int steps = tile->isRotated90() ? 1 : tile->isRotated180() ? 2 : tile->isRotated270() ? 3 : 0;
+            
+            float left = x * properties.tileWidth + offsetX;
+            float top = y * properties.tileHeight + offsetY;
+            float right = left + properties.tileWidth;
+            float bottom = top + properties.tileHeight;
+            const float px[4] = { left, right, right, left };
+            const float py[4] = { top, top, bottom, bottom };
+            
+            float* out = list.allocateQuads(texture->getHandle(), 1);
+            for (int corner = 0; corner < 4; ++corner) {
+                int uv = (corner + 4 - steps) % 4;
+                *out++ = px[corner];
+                *out++ = py[corner];
+                *out++ = 0.0f;
+                *out++ = tint.r;
+                *out++ = tint.g;
+                *out++ = tint.b;
+                *out++ = tint.a;
+                *out++ = us[uv];
+                *out++ = vs[uv];
             }
         }
     }
 }
 
-uint32_t TilemapRenderer::getCurrentAnimationFrame(uint32_t tileId, std::shared_ptr<Tileset> tileset) {
+void TilemapRenderer::appendRecordJobs(std::vector<Graphics::RenderRecordJob>& jobs, uint32_t baseLayer, int rowsPerChunk) const {
+    if (!m_tilemap || rowsPerChunk <= 0) {
+        return;
+    }
+    
+    for (size_t i = 0; i < m_tilemap->getLayerCount(); ++i) {
+        auto layer = m_tilemap->getLayer(i);
+        if (!layer || !layer->getProperties().visible) {
+            continue;
+        }
+        
+        uint64_t layerKey = static_cast<uint64_t>(baseLayer + i) << 32;
+        uint32_t chunk = 0;
+        for (int row = 0; row < layer->getHeight(); row += rowsPerChunk) {
+            jobs.emplace_back(layerKey | chunk++, [this, i, row, rowsPerChunk](Graphics::RenderCommandList& list) {
+                recordLayerRows(i, row, rowsPerChunk, list);
+            });
+        }
+    }
+    
+    if (!m_decorations.empty()) {
+        uint64_t decorationKey = static_cast<uint64_t>(baseLayer + m_tilemap->getLayerCount()) << 32;
+        jobs.emplace_back(decorationKey, [this](Graphics::RenderCommandList& list) {
+            recordDecorations(list);
+        });
+    }
+}
+
+void TilemapRenderer::setDecorations(std::vector<Graphics::Sprite> decorations) {
+    m_decorations = std::move(decorations);
+    m_decorationIndex.buildFromSprites(m_decorations);
+}
+
+void TilemapRenderer::recordDecorations(Graphics::RenderCommandList& list) const {
+    if (m_decorations.empty()) {
+        return;
+    }
+    
+    // Only the grid cells around the view are visited. Record jobs may run
+    // this on any worker, so the scratch buffers are per thread.
+    static thread_local std::vector<uint32_t> visible;
+    static thread_local Graphics::SpriteSoABuffer soa;
+    visible.clear();
+    soa.clear();
+    if (m_useFrustumCulling && m_camera) {
+        m_decorationIndex.query(m_camera->getBounds(), visible);
+    } else {
+        visible.resize(m_decorations.size());
+        for (size_t i = 0; i < visible.size(); ++i) {
+            visible[i] = static_cast<uint32_t>(i);
+        }
+    }
+    
+    soa.reserve(visible.size());
+    for (uint32_t i : visible) {
+        const Graphics::Sprite& sprite = m_decorations[i];
+        std::shared_ptr<Graphics::Texture> texture = sprite.getTexture();
+        if (!sprite.isVisible() || !texture || !texture->isValid()) {
+            continue;
+        }
+        soa.push(sprite, *texture);
+    }
+    
+    soa.record(list);
+}
+
+uint32_t TilemapRenderer::getCurrentAnimationFrame(uint32_t tileId, std::shared_ptr<Tileset> tileset) const {
     // Find tileset and local tile ID
     std::shared_ptr<Tileset> animTileset;
     uint32_t localTileId;
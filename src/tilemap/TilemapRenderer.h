@@ -4,6 +4,9 @@
 #include "../graphics/IGraphicsAPI.h"
 #include "../systems/System.h"
 #include "../graphics/Camera.h"
+#include "../graphics/RenderCommandBuffer.h"
+#include "../graphics/Texture.h"
+#include "../graphics/SpatialCuller.h"
 #include <memory>
 #include <unordered_map>
 
@@ -92,51 +95,103 @@ public:
      */
     uint32_t getColliderColor() const { return m_colliderColor; }
     
+    /**
+     * Set the decorative props drawn over the tile layers
+     * Props are indexed in a loose grid here, so each frame only visits
+     * those near the view, however many the map has.
+     * @param decorations Prop sprites
+     */
+    void setDecorations(std::vector<Graphics::Sprite> decorations);
+    
+    /**
+     * Get the decorative props
+     * @return Prop sprites
+     */
+    const std::vector<Graphics::Sprite>& getDecorations() const { return m_decorations; }
+    
+    /**
+     * Record the decorative props in view into a command list
+     * @param list Command list to record into
+     */
+    void recordDecorations(Graphics::RenderCommandList& list) const;
+    
     /**
      * Update tile animations
      * @param deltaTime Time since last update
      */
     void updateAnimations(float deltaTime);
     
-private:
     /**
-     * Render a tile layer
-     * @param layer Tile layer to render
+     * Record a range of rows of a tile layer into a command list
+     * Does not touch the graphics API, so chunks can be recorded in parallel.
+     * @param layerIndex Index of the layer in the tilemap
+     * @param firstRow First tile row to record
+     * @param rowCount Number of rows to record
+     * @param list Command list to record into
      */
-    void renderLayer(std::shared_ptr<TileLayer> layer);
+    void recordLayerRows(size_t layerIndex, int firstRow, int rowCount, Graphics::RenderCommandList& list) const;
     
     /**
-     * Render a tile
-     * @param x X position in tiles
-     * @param y Y position in tiles
-     * @param tile Tile to render
-     * @param layer Layer being rendered
+     * Append one recording job per visible layer chunk, then one for the props
+     * Sort keys are (baseLayer + layer index) << 32 | chunk index; props
+     * follow the last layer.
+     * @param jobs Job list to append to
+     * @param baseLayer Draw order of the first tilemap layer
+     * @param rowsPerChunk Number of tile rows per job
      */
-    void renderTile(int x, int y, const Tile& tile, std::shared_ptr<TileLayer> layer);
+    void appendRecordJobs(std::vector<Graphics::RenderRecordJob>& jobs, uint32_t baseLayer, int rowsPerChunk = 32) const;
     
     /**
-     * Render tile colliders
-     * @param layer Tile layer to render colliders for
+     * Get statistics for the last frame rendered by onUpdate
+     * @return Queue statistics
      */
-    void renderColliders(std::shared_ptr<TileLayer> layer);
+    const Graphics::RenderQueueStats& getRenderStats() const { return m_commandQueue.getStats(); }
     
+    /**
+     * Record outlines for the solid tiles of a layer
+     * Drawn with the collider color over a white texture created by
+     * initialize(); nothing is recorded before that.
+     * @param layerIndex Index of the layer in the tilemap
+     * @param list Command list to record into
+     */
+    void recordColliders(size_t layerIndex, Graphics::RenderCommandList& list) const;
+    
+    /**
+     * Get the texture collider outlines are drawn with
+     * @return White texture handle (INVALID_HANDLE before initialize())
+     */
+    Graphics::TextureHandle getColliderTexture() const {
+        return m_whiteTexture ? m_whiteTexture->getHandle() : Graphics::INVALID_HANDLE;
+    }
+    
+private:
     /**
      * Get the current animation frame for a tile
      * @param tileId Tile ID
      * @param tileset Tileset
      * @return Current animation frame tile ID, or the original tile ID if not animated
      */
-    uint32_t getCurrentAnimationFrame(uint32_t tileId, std::shared_ptr<Tileset> tileset);
+    uint32_t getCurrentAnimationFrame(uint32_t tileId, std::shared_ptr<Tileset> tileset) const;
     
     // Graphics API
     std::shared_ptr<Graphics::IGraphicsAPI> m_graphics;
     
+    // Command queue used by onUpdate
+    Graphics::RenderCommandQueue m_commandQueue;
+    
+    // White texture for collider outlines
+    std::shared_ptr<Graphics::Texture> m_whiteTexture;
+    
     // Tilemap
     std::shared_ptr<Tilemap> m_tilemap;
     
     // Camera
     std::shared_ptr<Graphics::Camera> m_camera;
     
+    // Decorative props and their culling grid
+    std::vector<Graphics::Sprite> m_decorations;
+    Graphics::SpatialCuller m_decorationIndex;
+    
     // Rendering options
     bool m_useFrustumCulling;
     bool m_renderColliders;
@@ -1,4 +1,5 @@
 #include "DialogueEditor.h"
+#include "../resources/ContentCooker.h"
 #include <fstream>
 #include <algorithm>
 #include <sstream>
@@ -723,6 +724,49 @@ namespace Engine {
             return true;
         }
 
+        bool DialogueEditor::exportContentDatabase(const std::string& filepath) {
+            using namespace RPGEngine::Components;
+            RPGEngine::Resources::ContentCooker cooker;
+            
+            for (const auto& tree : m_dialogueTrees) {
+                // Trees are referenced by name at runtime
+                RPGEngine::Components::DialogueTree cooked(tree.name, tree.name);
+                cooked.startNodeId = tree.startNodeId;
+                cooked.variables = tree.variables;
+                
+                for (const auto& nodePair : tree.nodes) {
+                    const auto& node = nodePair.second;
+                    DialogueNodeType type = node.isEndNode ? DialogueNodeType::End
+                        : (node.choices.empty() ? DialogueNodeType::Text : DialogueNodeType::Choice);
+                    RPGEngine::Components::DialogueNode cookedNode(node.id, type);
+                    cookedNode.speaker = node.speakerName;
+                    cookedNode.text = node.text;
+                    cookedNode.nextNodeId = node.nextNodeId;
+                    
+                    // Scripts have no runtime equivalent yet; keep them as metadata
+                    if (!node.script.empty()) {
+                        cookedNode.metadata["script"] = node.script;
+                    }
+                    
+                    for (size_t i = 0; i < node.choices.size(); ++i) {
+                        const auto& choice = node.choices[i];
+                        RPGEngine::Components::DialogueChoice cookedChoice("choice_" + std::to_string(i), choice.text, choice.targetNodeId);
+                        cookedChoice.enabled = choice.enabled;
+                        if (!choice.condition.empty()) {
+                            cookedNode.metadata["condition:" + cookedChoice.id] = choice.condition;
+                        }
+                        cookedNode.choices.push_back(cookedChoice);
+                    }
+                    
+                    cooked.addNode(cookedNode);
+                }
+                
+                cooker.addDialogueTree(cooked);
+            }
+            
+            return cooker.write(filepath);
+        }
+
         void DialogueEditor::startPreview(const std::string& treeName) {
             const auto* tree = findDialogueTree(treeName);
             if (tree && !tree->startNodeId.empty()) {
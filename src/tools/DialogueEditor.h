@@ -97,6 +97,7 @@ namespace Engine {
             // Export
             bool exportDialogueTree(const std::string& treeName, const std::string& filepath);
             bool exportAllDialogueTrees(const std::string& directory);
+            bool exportContentDatabase(const std::string& filepath); // Cooked .rpdb for ContentDatabase
 
             // Preview and testing
             void startPreview(const std::string& treeName);
@@ -3,10 +3,22 @@
 #include <algorithm>
 #include <sstream>
 #include <iomanip>
+#include <cstdio>
 
 namespace RPGEngine {
 namespace UI {
 
+namespace {
+
+// Format "<label><current>/<max>" into a reused string without a stream
+void formatRatio(std::string& out, const char* label, int current, int max) {
+    char buffer[48];
+    int length = std::snprintf(buffer, sizeof(buffer), "%s%d/%d", label, current, max);
+    out.assign(buffer, length > 0 ? std::min<size_t>(length, sizeof(buffer) - 1) : 0);
+}
+
+} // namespace
+
 // Static constants
 const float CombatUI::INPUT_COOLDOWN_TIME = 0.15f;
 const std::string CombatUI::ACTION_UP = "ui_up";
@@ -19,6 +31,7 @@ CombatUI::CombatUI(std::shared_ptr<Graphics::SpriteRenderer> spriteRenderer,
                    std::shared_ptr<Input::InputManager> inputManager)
     : System("CombatUI")
     , m_spriteRenderer(spriteRenderer)
+    , m_ownsTextRenderer(false)
     , m_inputManager(inputManager)
     , m_state(CombatUIState::Hidden)
     , m_visible(false)
@@ -40,6 +53,16 @@ bool CombatUI::onInitialize() {
         return false;
     }
     
+    // Without a shared text renderer, use a private one with the built-in font
+    if (!m_textRenderer && m_spriteRenderer) {
+        m_textRenderer = std::make_shared<Graphics::TextRenderer>(m_spriteRenderer);
+        m_ownsTextRenderer = true;
+    }
+    
+    if (m_textRenderer) {
+        m_textRenderer->initialize();
+    }
+    
     // Register input actions
     // Note: In a real implementation, these would be registered with the input manager
     
@@ -89,6 +112,11 @@ void CombatUI::setStyle(const CombatUIStyle& style) {
     m_style = style;
 }
 
+void CombatUI::setTextRenderer(std::shared_ptr<Graphics::TextRenderer> textRenderer) {
+    m_textRenderer = textRenderer;
+    m_ownsTextRenderer = false;
+}
+
 void CombatUI::showDamageText(float damage, float x, float y, bool isCritical, bool isHealing) {
     std::ostringstream oss;
     
@@ -174,6 +202,10 @@ void CombatUI::render() {
         return;
     }
     
+    if (m_ownsTextRenderer && m_textRenderer) {
+        m_textRenderer->nextFrame();
+    }
+    
     // Render HP/MP bars for player
     if (m_playerEntity != 0) {
         renderHealthBars(m_playerEntity, m_style.hpBarX, m_style.hpBarY, m_style.hpBarWidth);
@@ -229,10 +261,9 @@ void CombatUI::renderHealthBars(EntityId entity, float x, float y, float width)
     renderRectangle(x, y, width, m_style.hpBarHeight, m_style.barBorderColor, false);
     
     // HP text
-    std::ostringstream hpText;
-    hpText << "HP: " << static_cast<int>(statsComp->getCurrentHP()) 
-           << "/" << static_cast<int>(statsComp->getMaxHP());
-    renderText(hpText.str(), x + 5, y + 2, m_style.textColor, 12.0f);
+    formatRatio(m_textScratch, "HP: ", static_cast<int>(statsComp->getCurrentHP()),
+                static_cast<int>(statsComp->getMaxHP()));
+    renderText(m_textScratch, x + 5, y + 2, m_style.textColor, 12.0f);
     
     // Render MP bar
     float mpPercentage = statsComp->getMPPercentage();
@@ -248,10 +279,9 @@ void CombatUI::renderHealthBars(EntityId entity, float x, float y, float width)
     renderRectangle(x, mpY, width, m_style.hpBarHeight, m_style.barBorderColor, false);
     
     // MP text
-    std::ostringstream mpText;
-    mpText << "MP: " << static_cast<int>(statsComp->getCurrentMP()) 
-           << "/" << static_cast<int>(statsComp->getMaxMP());
-    renderText(mpText.str(), x + 5, mpY + 2, m_style.textColor, 12.0f);
+    formatRatio(m_textScratch, "MP: ", static_cast<int>(statsComp->getCurrentMP()),
+                static_cast<int>(statsComp->getMaxMP()));
+    renderText(m_textScratch, x + 5, mpY + 2, m_style.textColor, 12.0f);
 }
 
 void CombatUI::renderStatusEffects(EntityId entity, float x, float y) {
@@ -284,9 +314,8 @@ void CombatUI::renderStatusEffects(EntityId entity, float x, float y) {
         
         // Show duration if not permanent
         if (effect.duration > 0.0f) {
-            std::ostringstream durationText;
-            durationText << static_cast<int>(effect.duration);
-            renderText(durationText.str(), currentX + 2, y + 14, effectColor, 8.0f);
+            m_textScratch = std::to_string(static_cast<int>(effect.duration));
+            renderText(m_textScratch, currentX + 2, y + 14, effectColor, 8.0f);
         }
         
         currentX += m_style.statusEffectSpacing;
@@ -467,13 +496,24 @@ void CombatUI::renderMenu(const std::vector<std::string>& items, int selectedInd
 
 void CombatUI::renderRectangle(float x, float y, float width, float height, 
                               const Graphics::Color& color, bool filled) {
-    // This is a placeholder implementation
-    // In a real implementation, this would use the sprite renderer to draw rectangles
-    // For now, we'll just log the rectangle drawing
+    if (!m_spriteRenderer) {
+        return;
+    }
+    
+    // Filled rectangles come from the font atlas so they batch with the text
+    if (filled && m_textRenderer && m_textRenderer->drawRectangle(x, y, width, height, color)) {
+        return;
+    }
+    
+    m_spriteRenderer->drawRectangle(x, y, width, height, color, filled);
 }
 
 float CombatUI::renderText(const std::string& text, float x, float y, 
                           const Graphics::Color& color, float size) {
+    if (m_textRenderer && m_textRenderer->isReady()) {
+        return m_textRenderer->drawText(text, x, y, size, color);
+    }
+    
     // This is a placeholder implementation
     // In a real implementation, this would use the sprite renderer to draw text
     // For now, we'll just return an estimated height
@@ -481,6 +521,10 @@ float CombatUI::renderText(const std::string& text, float x, float y,
 }
 
 float CombatUI::getTextWidth(const std::string& text, float size) {
+    if (m_textRenderer && m_textRenderer->isReady()) {
+        return m_textRenderer->measureText(text, size).first;
+    }
+    
     // Simple approximation: assume each character is 0.6 * size wide
     return text.length() * size * 0.6f;
 }
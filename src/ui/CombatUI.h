@@ -1,6 +1,7 @@
 #pragma once
 
 #include "../graphics/SpriteRenderer.h"
+#include "../graphics/TextRenderer.h"
 #include "../input/InputManager.h"
 #include "../systems/CombatSystem.h"
 #include "../components/CombatComponent.h"
@@ -216,6 +217,13 @@ public:
      */
     const CombatUIStyle& getStyle() const { return m_style; }
     
+    /**
+     * Set the text renderer
+     * Pass the UIRenderer's text renderer so all UI text shares one atlas.
+     * @param textRenderer Text renderer to use
+     */
+    void setTextRenderer(std::shared_ptr<Graphics::TextRenderer> textRenderer);
+    
     /**
      * Show damage text at position
      * @param damage Damage amount
@@ -450,6 +458,8 @@ private:
     
     // Dependencies
     std::shared_ptr<Graphics::SpriteRenderer> m_spriteRenderer;
+    std::shared_ptr<Graphics::TextRenderer> m_textRenderer;
+    bool m_ownsTextRenderer;
     std::shared_ptr<Input::InputManager> m_inputManager;
     std::shared_ptr<Systems::CombatSystem> m_combatSystem;
     std::shared_ptr<ComponentManager> m_componentManager;
@@ -458,6 +468,7 @@ private:
     CombatUIState m_state;
     CombatUIStyle m_style;
     bool m_visible;
+    std::string m_textScratch; // Reused for per-frame labels
     EntityId m_playerEntity;
     
     // Menu state
@@ -20,6 +20,7 @@ DialogueUI::DialogueUI(std::shared_ptr<Graphics::SpriteRenderer> spriteRenderer,
                        std::shared_ptr<Input::InputManager> inputManager)
     : System("DialogueUI")
     , m_spriteRenderer(spriteRenderer)
+    , m_ownsTextRenderer(false)
     , m_inputManager(inputManager)
     , m_dialogueComponent(nullptr)
     , m_state(DialogueUIState::Hidden)
@@ -43,6 +44,16 @@ bool DialogueUI::onInitialize() {
         return false;
     }
     
+    // Without a shared text renderer, use a private one with the built-in font
+    if (!m_textRenderer && m_spriteRenderer) {
+        m_textRenderer = std::make_shared<Graphics::TextRenderer>(m_spriteRenderer);
+        m_ownsTextRenderer = true;
+    }
+    
+    if (m_textRenderer) {
+        m_textRenderer->initialize();
+    }
+    
     // Create input actions for dialogue UI
     m_inputManager->createAction(ACTION_ADVANCE);
     m_inputManager->createAction(ACTION_CHOICE_UP);
@@ -188,6 +199,11 @@ void DialogueUI::setStyle(const DialogueUIStyle& style) {
     m_style = style;
 }
 
+void DialogueUI::setTextRenderer(std::shared_ptr<Graphics::TextRenderer> textRenderer) {
+    m_textRenderer = textRenderer;
+    m_ownsTextRenderer = false;
+}
+
 void DialogueUI::setTypewriterEnabled(bool enabled) {
     m_style.enableTypewriter = enabled;
     
@@ -277,6 +293,10 @@ void DialogueUI::render() {
         return;
     }
     
+    if (m_ownsTextRenderer && m_textRenderer) {
+        m_textRenderer->nextFrame();
+    }
+    
     if (m_state == DialogueUIState::ShowingHistory) {
         renderDialogueHistory();
     } else {
@@ -437,6 +457,10 @@ void DialogueUI::renderDialogueHistory() {
 }
 
 float DialogueUI::renderText(const std::string& text, float x, float y, const Graphics::Color& color, float size) {
+    if (m_textRenderer && m_textRenderer->isReady()) {
+        return m_textRenderer->drawText(text, x, y, size, color);
+    }
+    
     if (!m_spriteRenderer || text.empty()) {
         return 0.0f;
     }
@@ -469,10 +493,19 @@ void DialogueUI::renderRectangle(float x, float y, float width, float height, co
         return;
     }
     
+    // Filled rectangles come from the font atlas so they batch with the text
+    if (filled && m_textRenderer && m_textRenderer->drawRectangle(x, y, width, height, color)) {
+        return;
+    }
+    
     m_spriteRenderer->drawRectangle(x, y, width, height, color, filled);
 }
 
 float DialogueUI::getTextWidth(const std::string& text, float size) {
+    if (m_textRenderer && m_textRenderer->isReady()) {
+        return m_textRenderer->measureText(text, size).first;
+    }
+    
     return text.length() * size * 0.6f; // Approximate character width
 }
 
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "../graphics/SpriteRenderer.h"
+#include "../graphics/TextRenderer.h"
 #include "../input/InputManager.h"
 #include "../components/DialogueComponent.h"
 #include "../systems/System.h"
@@ -141,6 +142,13 @@ public:
      */
     const DialogueUIStyle& getStyle() const { return m_style; }
     
+    /**
+     * Set the text renderer
+     * Pass the UIRenderer's text renderer so all UI text shares one atlas.
+     * @param textRenderer Text renderer to use
+     */
+    void setTextRenderer(std::shared_ptr<Graphics::TextRenderer> textRenderer);
+    
     /**
      * Set typewriter effect enabled
      * @param enabled Whether to enable typewriter effect
@@ -293,6 +301,8 @@ private:
     
     // Dependencies
     std::shared_ptr<Graphics::SpriteRenderer> m_spriteRenderer;
+    std::shared_ptr<Graphics::TextRenderer> m_textRenderer;
+    bool m_ownsTextRenderer;
     std::shared_ptr<Input::InputManager> m_inputManager;
     std::shared_ptr<Components::DialogueComponent> m_dialogueComponent;
     
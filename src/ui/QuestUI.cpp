@@ -17,6 +17,7 @@ QuestUI::QuestUI(std::shared_ptr<Graphics::SpriteRenderer> spriteRenderer,
                  std::shared_ptr<Input::InputManager> inputManager)
     : System("QuestUI")
     , m_spriteRenderer(spriteRenderer)
+    , m_ownsTextRenderer(false)
     , m_inputManager(inputManager)
     , m_questComponent(nullptr)
     , m_state(QuestUIState::TrackerOnly)
@@ -36,6 +37,16 @@ bool QuestUI::onInitialize() {
         return false;
     }
     
+    // Without a shared text renderer, use a private one with the built-in font
+    if (!m_textRenderer && m_spriteRenderer) {
+        m_textRenderer = std::make_shared<Graphics::TextRenderer>(m_spriteRenderer);
+        m_ownsTextRenderer = true;
+    }
+    
+    if (m_textRenderer) {
+        m_textRenderer->initialize();
+    }
+    
     // Create input actions for quest UI
     m_inputManager->createAction(ACTION_TOGGLE_QUEST_LOG);
     m_inputManager->createAction(ACTION_QUEST_LOG_UP);
@@ -146,6 +157,11 @@ void QuestUI::setStyle(const QuestUIStyle& style) {
     m_style = style;
 }
 
+void QuestUI::setTextRenderer(std::shared_ptr<Graphics::TextRenderer> textRenderer) {
+    m_textRenderer = textRenderer;
+    m_ownsTextRenderer = false;
+}
+
 void QuestUI::addNotification(const std::string& type, const std::string& title, 
                              const std::string& message, const Graphics::Color& color) {
     QuestNotification notification(type, title, message, color);
@@ -286,6 +302,26 @@ void QuestUI::showQuestProgressNotification(const std::string& questId, const st
     }
 }
 
+void QuestUI::showObjectiveProgress(const std::vector<Components::ObjectiveProgressUpdate>& updates) {
+    if (!m_questComponent) return;
+    
+    const Components::ObjectiveProgressUpdate* last = nullptr;
+    int inProgress = 0;
+    for (const auto& update : updates) {
+        if (update.entityId == m_questComponent->getEntityId() && !update.completed) {
+            last = &update;
+            inProgress++;
+        }
+    }
+    
+    if (inProgress == 1) {
+        showQuestProgressNotification(last->questId, last->objectiveId, last->currentCount, last->requiredCount);
+    } else if (inProgress > 1) {
+        Graphics::Color color = Graphics::Color(0.8f, 0.8f, 1.0f, 1.0f); // Light blue for progress
+        addNotification("quest_progress", "Quest Progress", std::to_string(inProgress) + " objectives updated", color);
+    }
+}
+
 void QuestUI::showQuestFailedNotification(const std::string& questId, const std::string& reason) {
     if (!m_questComponent) return;
     
@@ -340,6 +376,10 @@ void QuestUI::render() {
         return;
     }
     
+    if (m_ownsTextRenderer && m_textRenderer) {
+        m_textRenderer->nextFrame();
+    }
+    
     // Render quest tracker
     if (isTrackerVisible()) {
         renderQuestTracker();
@@ -622,6 +662,10 @@ float QuestUI::renderObjective(const Components::QuestObjective& objective, floa
 }
 
 float QuestUI::renderText(const std::string& text, float x, float y, const Graphics::Color& color, float size) {
+    if (m_textRenderer && m_textRenderer->isReady()) {
+        return m_textRenderer->drawText(text, x, y, size, color);
+    }
+    
     if (!m_spriteRenderer || text.empty()) {
         return 0.0f;
     }
@@ -653,10 +697,19 @@ void QuestUI::renderRectangle(float x, float y, float width, float height, const
         return;
     }
     
+    // Filled rectangles come from the font atlas so they batch with the text
+    if (filled && m_textRenderer && m_textRenderer->drawRectangle(x, y, width, height, color)) {
+        return;
+    }
+    
     m_spriteRenderer->drawRectangle(x, y, width, height, color, filled);
 }
 
 float QuestUI::getTextWidth(const std::string& text, float size) {
+    if (m_textRenderer && m_textRenderer->isReady()) {
+        return m_textRenderer->measureText(text, size).first;
+    }
+    
     return text.length() * size * 0.6f;
 }
 
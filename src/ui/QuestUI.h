@@ -1,6 +1,7 @@
 #pragma once
 
 #include "../graphics/SpriteRenderer.h"
+#include "../graphics/TextRenderer.h"
 #include "../input/InputManager.h"
 #include "../components/QuestComponent.h"
 #include "../systems/System.h"
@@ -176,6 +177,13 @@ public:
      */
     const QuestUIStyle& getStyle() const { return m_style; }
     
+    /**
+     * Set the text renderer
+     * Pass the UIRenderer's text renderer so all UI text shares one atlas.
+     * @param textRenderer Text renderer to use
+     */
+    void setTextRenderer(std::shared_ptr<Graphics::TextRenderer> textRenderer);
+    
     /**
      * Add quest notification
      * @param type Notification type
@@ -268,6 +276,15 @@ public:
     void showQuestProgressNotification(const std::string& questId, const std::string& objectiveId, 
                                       int progress, int maxProgress);
     
+    /**
+     * Show one frame's objective progress
+     * Takes the batch from QuestSystem::setObjectiveProgressCallback and adds
+     * at most one progress notification for the quest component's entity.
+     * Completed objectives are left to the objective completed notification.
+     * @param updates Objective progress made this frame
+     */
+    void showObjectiveProgress(const std::vector<Components::ObjectiveProgressUpdate>& updates);
+    
     /**
      * Show quest failed notification
      * @param questId Quest ID
@@ -417,6 +434,8 @@ private:
     
     // Dependencies
     std::shared_ptr<Graphics::SpriteRenderer> m_spriteRenderer;
+    std::shared_ptr<Graphics::TextRenderer> m_textRenderer;
+    bool m_ownsTextRenderer;
     std::shared_ptr<Input::InputManager> m_inputManager;
     std::shared_ptr<Components::QuestComponent> m_questComponent;
     
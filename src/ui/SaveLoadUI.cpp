@@ -490,6 +490,7 @@ namespace RPGEngine {
             slot.isEmpty = false;
             slot.isAutoSave = saveInfo.slotName.find("autosave_") == 0;
             slot.isQuickSave = saveInfo.slotName == "quicksave";
+            slot.hasThumbnail = saveInfo.hasThumbnail();
             
             return slot;
         }
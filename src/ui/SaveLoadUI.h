@@ -26,9 +26,10 @@ namespace RPGEngine {
             bool isEmpty;
             bool isAutoSave;
             bool isQuickSave;
+            bool hasThumbnail;      // Load with SaveManager::loadThumbnail when shown
             
             SaveSlotInfo() : slotNumber(-1), playerLevel(1), fileSize(0), 
-                           isEmpty(true), isAutoSave(false), isQuickSave(false) {}
+                           isEmpty(true), isAutoSave(false), isQuickSave(false), hasThumbnail(false) {}
         };
         
         /**
@@ -1,6 +1,8 @@
 #include "UIRenderer.h"
+#include "UITree.h"
 #include <algorithm>
 #include <cmath>
+#include <iostream>
 
 namespace RPGEngine {
 namespace UI {
@@ -11,7 +13,8 @@ const std::string UIRenderer::ACTION_MOUSE_RIGHT = "mouse_right";
 
 UIRenderer::UIRenderer(std::shared_ptr<Graphics::SpriteRenderer> spriteRenderer,
                        std::shared_ptr<Input::InputManager> inputManager)
-    : m_spriteRenderer(spriteRenderer)
+    : System("UIRenderer")
+    , m_spriteRenderer(spriteRenderer)
     , m_inputManager(inputManager)
     , m_frameActive(false)
     , m_mouseX(0.0f)
@@ -26,6 +29,14 @@ UIRenderer::~UIRenderer() {
 }
 
 bool UIRenderer::onInitialize() {
+    if (!m_textRenderer && m_spriteRenderer) {
+        m_textRenderer = std::make_shared<Graphics::TextRenderer>(m_spriteRenderer);
+    }
+    
+    if (m_textRenderer && !m_textRenderer->initialize()) {
+        std::cerr << "UIRenderer: text renderer unavailable, text will not be drawn" << std::endl;
+    }
+    
     return true;
 }
 
@@ -38,6 +49,10 @@ void UIRenderer::onShutdown() {
 }
 
 void UIRenderer::beginFrame() {
+    if (m_textRenderer) {
+        m_textRenderer->nextFrame();
+    }
+    
     m_frameActive = true;
     m_elements.clear();
     m_hotElementId.clear();
@@ -51,6 +66,15 @@ void UIRenderer::setStyle(const UIStyle& style) {
     m_style = style;
 }
 
+std::shared_ptr<UITree> UIRenderer::createTree() {
+    return std::make_shared<UITree>(m_spriteRenderer, m_textRenderer, m_style);
+}
+
+void UIRenderer::drawTree(UITree& tree) {
+    tree.updateInput(m_mouseX, m_mouseY, m_mousePressed);
+    tree.render();
+}
+
 std::shared_ptr<UIPanel> UIRenderer::drawPanel(const UIRect& bounds, const std::string& id) {
     auto panel = std::make_shared<UIPanel>(id);
     panel->bounds = bounds;
@@ -292,55 +316,63 @@ void UIRenderer::updateInput(float deltaTime) {
         m_mouseY = 0.0f; // m_inputManager->getMouseY();
         
         m_previousMousePressed = m_mousePressed;
-        m_mousePressed = m_inputManager->isActionPressed(ACTION_MOUSE_LEFT);
+        m_mousePressed = m_inputManager->isActionActive(ACTION_MOUSE_LEFT);
         m_mouseClicked = m_mousePressed && !m_previousMousePressed;
     }
 }
 
 void UIRenderer::renderRectangle(const UIRect& bounds, const Graphics::Color& color, bool filled, 
                                 float borderWidth, const Graphics::Color& borderColor) {
+    // Drawing from the font atlas keeps panels and their text in one batch
+    auto fill = [this](float x, float y, float width, float height, const Graphics::Color& fillColor) {
+        if (!m_textRenderer || !m_textRenderer->drawRectangle(x, y, width, height, fillColor)) {
+            m_spriteRenderer->drawRectangle(x, y, width, height, fillColor, true);
+        }
+    };
+    
     if (filled) {
-        m_spriteRenderer->drawRectangle(bounds.x, bounds.y, bounds.width, bounds.height, color, true);
+        fill(bounds.x, bounds.y, bounds.width, bounds.height, color);
     } else {
         // Draw border as four rectangles
         // Top
-        m_spriteRenderer->drawRectangle(bounds.x, bounds.y, bounds.width, borderWidth, borderColor, true);
+        fill(bounds.x, bounds.y, bounds.width, borderWidth, borderColor);
         // Bottom
-        m_spriteRenderer->drawRectangle(bounds.x, bounds.y + bounds.height - borderWidth, bounds.width, borderWidth, borderColor, true);
+        fill(bounds.x, bounds.y + bounds.height - borderWidth, bounds.width, borderWidth, borderColor);
         // Left
-        m_spriteRenderer->drawRectangle(bounds.x, bounds.y, borderWidth, bounds.height, borderColor, true);
+        fill(bounds.x, bounds.y, borderWidth, bounds.height, borderColor);
         // Right
-        m_spriteRenderer->drawRectangle(bounds.x + bounds.width - borderWidth, bounds.y, borderWidth, bounds.height, borderColor, true);
+        fill(bounds.x + bounds.width - borderWidth, bounds.y, borderWidth, bounds.height, borderColor);
     }
 }
 
 float UIRenderer::renderText(const std::string& text, float x, float y, const Graphics::Color& color, 
                             float fontSize, UIAlignment alignment, const UIRect* bounds) {
-    // This is a simplified text rendering implementation
-    // In a real implementation, you'd use a proper font rendering system
+    if (!m_textRenderer || !m_textRenderer->isReady()) {
+        return 0.0f;
+    }
+    
+    const Graphics::TextMesh& mesh = m_textRenderer->layoutText(text, fontSize);
     
     float textX = x;
     float textY = y;
     
     if (bounds && alignment != UIAlignment::TopLeft) {
-        auto textDims = getTextDimensions(text, fontSize);
-        auto alignedPos = UILayout::calculateAlignedPosition(*bounds, textDims.first, textDims.second, alignment);
+        auto alignedPos = UILayout::calculateAlignedPosition(*bounds, mesh.width, mesh.height, alignment);
         textX = alignedPos.first;
         textY = alignedPos.second;
     }
     
-    // For now, just draw a simple rectangle to represent text
-    // In a real implementation, you'd render actual text glyphs
-    auto textDims = getTextDimensions(text, fontSize);
-    m_spriteRenderer->drawRectangle(textX, textY, textDims.first, textDims.second, color, true);
-    
-    return textDims.second;
+    m_textRenderer->drawMesh(mesh, textX, textY, color);
+    return mesh.height;
 }
 
 std::pair<float, float> UIRenderer::getTextDimensions(const std::string& text, float fontSize) {
-    // Simplified text dimension calculation
-    // In a real implementation, you'd measure actual font metrics
-    float width = text.length() * fontSize * 0.6f; // Approximate character width
+    if (m_textRenderer && m_textRenderer->isReady()) {
+        return m_textRenderer->measureText(text, fontSize);
+    }
+    
+    // Approximation when no font is available
+    float width = text.length() * fontSize * 0.6f;
     float height = fontSize;
     return std::make_pair(width, height);
 }
@@ -418,58 +450,50 @@ std::pair<float, float> UILayout::calculateAlignedPosition(const UIRect& bounds,
 }
 
 void UILayout::layoutVertical(std::vector<std::shared_ptr<UIElement>>& elements, const UIRect& bounds, float spacing) {
-    if (elements.empty()) return;
-    
-    float currentY = bounds.y;
-    float elementWidth = bounds.width;
-    float elementHeight = (bounds.height - spacing * (elements.size() - 1)) / elements.size();
-    
-    for (auto& element : elements) {
-        element->bounds.x = bounds.x;
-        element->bounds.y = currentY;
-        element->bounds.width = elementWidth;
-        element->bounds.height = elementHeight;
-        
-        currentY += elementHeight + spacing;
+    for (size_t i = 0; i < elements.size(); ++i) {
+        elements[i]->bounds = getVerticalSlot(bounds, i, elements.size(), spacing);
     }
 }
 
 void UILayout::layoutHorizontal(std::vector<std::shared_ptr<UIElement>>& elements, const UIRect& bounds, float spacing) {
-    if (elements.empty()) return;
-    
-    float currentX = bounds.x;
-    float elementWidth = (bounds.width - spacing * (elements.size() - 1)) / elements.size();
-    float elementHeight = bounds.height;
-    
-    for (auto& element : elements) {
-        element->bounds.x = currentX;
-        element->bounds.y = bounds.y;
-        element->bounds.width = elementWidth;
-        element->bounds.height = elementHeight;
-        
-        currentX += elementWidth + spacing;
+    for (size_t i = 0; i < elements.size(); ++i) {
+        elements[i]->bounds = getHorizontalSlot(bounds, i, elements.size(), spacing);
     }
 }
 
 void UILayout::layoutGrid(std::vector<std::shared_ptr<UIElement>>& elements, const UIRect& bounds, int columns, float spacing) {
-    if (elements.empty() || columns <= 0) return;
+    if (columns <= 0) return;
+    
+    for (size_t i = 0; i < elements.size(); ++i) {
+        elements[i]->bounds = getGridSlot(bounds, i, elements.size(), columns, spacing);
+    }
+}
+
+UIRect UILayout::getVerticalSlot(const UIRect& bounds, size_t index, size_t count, float spacing) {
+    if (count == 0) return bounds;
     
-    int rows = (elements.size() + columns - 1) / columns;
+    float elementHeight = (bounds.height - spacing * (count - 1)) / count;
+    return UIRect(bounds.x, bounds.y + index * (elementHeight + spacing), bounds.width, elementHeight);
+}
+
+UIRect UILayout::getHorizontalSlot(const UIRect& bounds, size_t index, size_t count, float spacing) {
+    if (count == 0) return bounds;
+    
+    float elementWidth = (bounds.width - spacing * (count - 1)) / count;
+    return UIRect(bounds.x + index * (elementWidth + spacing), bounds.y, elementWidth, bounds.height);
+}
+
+UIRect UILayout::getGridSlot(const UIRect& bounds, size_t index, size_t count, int columns, float spacing) {
+    if (count == 0 || columns <= 0) return bounds;
+    
+    size_t rows = (count + columns - 1) / columns;
     float elementWidth = (bounds.width - spacing * (columns - 1)) / columns;
     float elementHeight = (bounds.height - spacing * (rows - 1)) / rows;
     
-    for (size_t i = 0; i < elements.size(); ++i) {
-        int row = i / columns;
-        int col = i % columns;
-        
-        float x = bounds.x + col * (elementWidth + spacing);
-        float y = bounds.y + row * (elementHeight + spacing);
-        
-        elements[i]->bounds.x = x;
-        elements[i]->bounds.y = y;
-        elements[i]->bounds.width = elementWidth;
-        elements[i]->bounds.height = elementHeight;
-    }
+    size_t row = index / columns;
+    size_t col = index % columns;
+    return UIRect(bounds.x + col * (elementWidth + spacing), bounds.y + row * (elementHeight + spacing),
+                  elementWidth, elementHeight);
 }
 
 } // namespace UI
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "../graphics/SpriteRenderer.h"
+#include "../graphics/TextRenderer.h"
 #include "../input/InputManager.h"
 #include "../systems/System.h"
 #include "../core/Types.h"
@@ -13,6 +14,8 @@
 namespace RPGEngine {
 namespace UI {
 
+class UITree;
+
 /**
  * UI element types
  */
@@ -240,6 +243,37 @@ public:
      * @param spacing Spacing between elements
      */
     static void layoutGrid(std::vector<std::shared_ptr<UIElement>>& elements, const UIRect& bounds, int columns, float spacing = 5.0f);
+    
+    /**
+     * Get the bounds of one slot of a vertical layout
+     * @param bounds Container bounds
+     * @param index Slot index
+     * @param count Number of slots
+     * @param spacing Spacing between slots
+     * @return Slot bounds
+     */
+    static UIRect getVerticalSlot(const UIRect& bounds, size_t index, size_t count, float spacing = 5.0f);
+    
+    /**
+     * Get the bounds of one slot of a horizontal layout
+     * @param bounds Container bounds
+     * @param index Slot index
+     * @param count Number of slots
+     * @param spacing Spacing between slots
+     * @return Slot bounds
+     */
+    static UIRect getHorizontalSlot(const UIRect& bounds, size_t index, size_t count, float spacing = 5.0f);
+    
+    /**
+     * Get the bounds of one cell of a grid layout
+     * @param bounds Container bounds
+     * @param index Cell index
+     * @param count Number of cells
+     * @param columns Number of columns
+     * @param spacing Spacing between cells
+     * @return Cell bounds
+     */
+    static UIRect getGridSlot(const UIRect& bounds, size_t index, size_t count, int columns, float spacing = 5.0f);
 };
 
 /**
@@ -290,6 +324,31 @@ public:
      */
     const UIStyle& getStyle() const { return m_style; }
     
+    /**
+     * Set the text renderer
+     * Share one text renderer between UIs so their text uses one atlas.
+     * @param textRenderer Text renderer to use
+     */
+    void setTextRenderer(std::shared_ptr<Graphics::TextRenderer> textRenderer) { m_textRenderer = textRenderer; }
+    
+    /**
+     * Get the text renderer
+     * @return Text renderer (created with the built-in font on initialize if none was set)
+     */
+    std::shared_ptr<Graphics::TextRenderer> getTextRenderer() const { return m_textRenderer; }
+    
+    /**
+     * Create a retained UI tree drawing with this renderer's style and text renderer
+     * @return New tree
+     */
+    std::shared_ptr<UITree> createTree();
+    
+    /**
+     * Feed this frame's mouse state to a retained tree and draw it
+     * @param tree Tree to draw
+     */
+    void drawTree(UITree& tree);
+    
     // Immediate mode UI functions
     
     /**
@@ -419,7 +478,7 @@ private:
                     float fontSize, UIAlignment alignment = UIAlignment::TopLeft, const UIRect* bounds = nullptr);
     
     /**
-     * Get text dimensions (approximation)
+     * Get text dimensions
      * @param text Text to measure
      * @param fontSize Font size
      * @return Text dimensions (width, height)
@@ -450,6 +509,7 @@ private:
     // Dependencies
     std::shared_ptr<Graphics::SpriteRenderer> m_spriteRenderer;
     std::shared_ptr<Input::InputManager> m_inputManager;
+    std::shared_ptr<Graphics::TextRenderer> m_textRenderer;
     
     // UI state
     UIStyle m_style;
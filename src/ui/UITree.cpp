@@ -0,0 +1,640 @@
+#include "UITree.h"
+#include <algorithm>
+
+namespace RPGEngine {
+namespace UI {
+
+namespace {
+
+const size_t FLOATS_PER_QUAD = Graphics::SpriteRenderer::VERTICES_PER_SPRITE * Graphics::SpriteRenderer::VERTEX_SIZE;
+
+bool sameRect(const UIRect& a, const UIRect& b) {
+    return a.x == b.x && a.y == b.y && a.width == b.width && a.height == b.height;
+}
+
+bool isInteractive(UIElementType type) {
+    return type == UIElementType::Button || type == UIElementType::Checkbox || type == UIElementType::Slider;
+}
+
+} // anonymous namespace
+
+// UIWidget implementation
+UIWidget::UIWidget(UIElementType type, const std::string& id)
+    : m_type(type)
+    , m_id(id)
+    , m_parent(nullptr)
+    , m_fontSize(0.0f)
+    , m_alignment(type == UIElementType::Button ? UIAlignment::Center : UIAlignment::TopLeft)
+    , m_value(0.0f)
+    , m_minValue(0.0f)
+    , m_maxValue(1.0f)
+    , m_checked(false)
+    , m_visible(true)
+    , m_enabled(true)
+    , m_state(UIElementState::Normal)
+    , m_childLayout(UIChildLayout::None)
+    , m_spacing(5.0f)
+    , m_padding(0.0f)
+    , m_columns(1)
+    , m_layoutDirty(false)
+    , m_subtreeLayoutDirty(false)
+    , m_cacheGeometry(type == UIElementType::Panel)
+    , m_geometryDirty(true)
+    , m_quadCount(0)
+{
+}
+
+UIWidget::~UIWidget() {
+    for (auto& child : m_children) {
+        child->m_parent = nullptr;
+    }
+}
+
+void UIWidget::addChild(std::shared_ptr<UIWidget> child) {
+    if (!child || child.get() == this) {
+        return;
+    }
+
+    if (child->m_parent) {
+        // Keep the child alive while it moves between parents
+        std::shared_ptr<UIWidget> keepAlive = child;
+        child->m_parent->removeChild(keepAlive);
+    }
+
+    child->m_parent = this;
+    m_children.push_back(child);
+
+    markLayoutDirty();
+    markGeometryDirty();
+
+    // Layout state below the child may be pending from before it was attached
+    if (child->m_layoutDirty || child->m_subtreeLayoutDirty) {
+        child->markLayoutDirty();
+    }
+}
+
+void UIWidget::removeChild(const std::shared_ptr<UIWidget>& child) {
+    auto it = std::find(m_children.begin(), m_children.end(), child);
+    if (it == m_children.end()) {
+        return;
+    }
+
+    (*it)->m_parent = nullptr;
+    m_children.erase(it);
+
+    markLayoutDirty();
+    markGeometryDirty();
+}
+
+void UIWidget::clearChildren() {
+    if (m_children.empty()) {
+        return;
+    }
+
+    for (auto& child : m_children) {
+        child->m_parent = nullptr;
+    }
+    m_children.clear();
+
+    markLayoutDirty();
+    markGeometryDirty();
+}
+
+UIWidget* UIWidget::findWidget(const std::string& id) {
+    if (m_id == id) {
+        return this;
+    }
+
+    for (auto& child : m_children) {
+        if (UIWidget* found = child->findWidget(id)) {
+            return found;
+        }
+    }
+
+    return nullptr;
+}
+
+void UIWidget::setChildLayout(UIChildLayout layout, float spacing, float padding, int columns) {
+    if (m_childLayout == layout && m_spacing == spacing && m_padding == padding && m_columns == columns) {
+        return;
+    }
+
+    m_childLayout = layout;
+    m_spacing = spacing;
+    m_padding = padding;
+    m_columns = std::max(1, columns);
+    markLayoutDirty();
+}
+
+void UIWidget::setBounds(const UIRect& bounds) {
+    if (sameRect(m_bounds, bounds)) {
+        return;
+    }
+
+    m_bounds = bounds;
+    markLayoutDirty();
+    markGeometryDirty();
+}
+
+void UIWidget::setText(const std::string& text) {
+    if (m_text == text) {
+        return;
+    }
+
+    m_text = text;
+    markGeometryDirty();
+}
+
+void UIWidget::setFontSize(float fontSize) {
+    if (m_fontSize == fontSize) {
+        return;
+    }
+
+    m_fontSize = fontSize;
+    markGeometryDirty();
+}
+
+void UIWidget::setAlignment(UIAlignment alignment) {
+    if (m_alignment == alignment) {
+        return;
+    }
+
+    m_alignment = alignment;
+    markGeometryDirty();
+}
+
+void UIWidget::setValue(float value) {
+    value = std::max(m_minValue, std::min(m_maxValue, value));
+    if (m_value == value) {
+        return;
+    }
+
+    m_value = value;
+    markGeometryDirty();
+}
+
+void UIWidget::setRange(float minValue, float maxValue) {
+    if (m_minValue == minValue && m_maxValue == maxValue) {
+        return;
+    }
+
+    m_minValue = minValue;
+    m_maxValue = maxValue;
+    m_value = std::max(m_minValue, std::min(m_maxValue, m_value));
+    markGeometryDirty();
+}
+
+void UIWidget::setChecked(bool checked) {
+    if (m_checked == checked) {
+        return;
+    }
+
+    m_checked = checked;
+    markGeometryDirty();
+}
+
+void UIWidget::setVisible(bool visible) {
+    if (m_visible == visible) {
+        return;
+    }
+
+    m_visible = visible;
+
+    // A caching widget is skipped at submit time; anything else lives in
+    // its parent's cache
+    if (!m_cacheGeometry) {
+        markGeometryDirty();
+    }
+}
+
+void UIWidget::setEnabled(bool enabled) {
+    if (m_enabled == enabled) {
+        return;
+    }
+
+    m_enabled = enabled;
+    m_state = enabled ? UIElementState::Normal : UIElementState::Disabled;
+    markGeometryDirty();
+}
+
+void UIWidget::setCacheGeometry(bool cache) {
+    if (m_cacheGeometry == cache) {
+        return;
+    }
+
+    // The enclosing cache gains or loses this subtree either way
+    if (m_parent) {
+        m_parent->markGeometryDirty();
+    }
+
+    m_cacheGeometry = cache;
+    m_geometryDirty = true;
+    m_vertices.clear();
+    m_quadCount = 0;
+    m_nestedCaches.clear();
+}
+
+void UIWidget::markLayoutDirty() {
+    m_layoutDirty = true;
+
+    // Stop at the first ancestor that already knows about a dirty descendant
+    for (UIWidget* ancestor = m_parent; ancestor && !ancestor->m_subtreeLayoutDirty; ancestor = ancestor->m_parent) {
+        ancestor->m_subtreeLayoutDirty = true;
+    }
+}
+
+void UIWidget::markGeometryDirty() {
+    getCacheOwner()->m_geometryDirty = true;
+}
+
+UIWidget* UIWidget::getCacheOwner() {
+    UIWidget* widget = this;
+    while (!widget->m_cacheGeometry && widget->m_parent) {
+        widget = widget->m_parent;
+    }
+    return widget;
+}
+
+void UIWidget::setState(UIElementState state) {
+    if (m_state == state) {
+        return;
+    }
+
+    m_state = state;
+    markGeometryDirty();
+}
+
+// UITree implementation
+UITree::UITree(std::shared_ptr<Graphics::SpriteRenderer> spriteRenderer,
+               std::shared_ptr<Graphics::TextRenderer> textRenderer,
+               const UIStyle& style)
+    : m_spriteRenderer(spriteRenderer)
+    , m_textRenderer(textRenderer)
+    , m_root(std::make_shared<UIWidget>(UIElementType::Panel, "root"))
+    , m_style(style)
+    , m_mouseX(0.0f)
+    , m_mouseY(0.0f)
+    , m_mousePressed(false)
+    , m_hasInput(false)
+{
+    m_root->m_cacheGeometry = true;
+
+    if (m_spriteRenderer && m_spriteRenderer->getGraphicsAPI()) {
+        auto graphicsAPI = m_spriteRenderer->getGraphicsAPI();
+        m_root->setBounds(UIRect(0.0f, 0.0f,
+                                 static_cast<float>(graphicsAPI->getWindowWidth()),
+                                 static_cast<float>(graphicsAPI->getWindowHeight())));
+    }
+}
+
+UITree::~UITree() {
+}
+
+UIWidget* UITree::findWidget(const std::string& id) const {
+    return m_root->findWidget(id);
+}
+
+void UITree::setStyle(const UIStyle& style) {
+    m_style = style;
+    invalidate();
+}
+
+void UITree::updateInput(float mouseX, float mouseY, bool mousePressed) {
+    bool moved = !m_hasInput || mouseX != m_mouseX || mouseY != m_mouseY;
+    bool justPressed = mousePressed && (!m_hasInput || !m_mousePressed);
+    bool buttonChanged = !m_hasInput || mousePressed != m_mousePressed;
+
+    m_mouseX = mouseX;
+    m_mouseY = mouseY;
+    m_mousePressed = mousePressed;
+    m_hasInput = true;
+
+    if (!moved && !buttonChanged) {
+        return;
+    }
+
+    // Widgets only move during layout, so hover can only change with the mouse
+    std::shared_ptr<UIWidget> previous = m_hoveredWidget.lock();
+    std::shared_ptr<UIWidget> hovered = moved ? hitTest(*m_root, mouseX, mouseY) : previous;
+    std::shared_ptr<UIWidget> pressed = m_pressedWidget.lock();
+
+    if (hovered != previous) {
+        if (previous && previous->m_enabled && previous != pressed) {
+            previous->setState(UIElementState::Normal);
+        }
+        if (hovered && !pressed) {
+            hovered->setState(UIElementState::Hovered);
+        }
+        m_hoveredWidget = hovered;
+    }
+
+    if (justPressed && hovered) {
+        pressed = hovered;
+        m_pressedWidget = pressed;
+        pressed->setState(UIElementState::Pressed);
+
+        if (pressed->m_type == UIElementType::Button) {
+            if (pressed->onClick) {
+                pressed->onClick();
+            }
+        } else if (pressed->m_type == UIElementType::Checkbox) {
+            pressed->setChecked(!pressed->m_checked);
+            if (pressed->onToggled) {
+                pressed->onToggled(pressed->m_checked);
+            }
+        }
+    }
+
+    if (pressed && mousePressed && pressed->m_type == UIElementType::Slider && pressed->m_bounds.width > 0.0f) {
+        float progress = (mouseX - pressed->m_bounds.x) / pressed->m_bounds.width;
+        progress = std::max(0.0f, std::min(1.0f, progress));
+
+        float oldValue = pressed->m_value;
+        pressed->setValue(pressed->m_minValue + progress * (pressed->m_maxValue - pressed->m_minValue));
+        if (pressed->m_value != oldValue && pressed->onChanged) {
+            pressed->onChanged(pressed->m_value);
+        }
+    }
+
+    if (pressed && !mousePressed) {
+        if (pressed->m_enabled) {
+            pressed->setState(pressed == hovered ? UIElementState::Hovered : UIElementState::Normal);
+        }
+        m_pressedWidget.reset();
+    }
+}
+
+void UITree::updateLayout() {
+    if (m_root->m_layoutDirty || m_root->m_subtreeLayoutDirty) {
+        layoutSubtree(*m_root);
+    }
+}
+
+void UITree::render() {
+    if (!m_spriteRenderer || !m_textRenderer || !m_textRenderer->isReady()) {
+        return;
+    }
+
+    updateLayout();
+    renderCache(*m_root);
+}
+
+void UITree::invalidate() {
+    invalidateSubtree(*m_root);
+}
+
+void UITree::layoutSubtree(UIWidget& widget) {
+    if (widget.m_layoutDirty) {
+        widget.m_layoutDirty = false;
+
+        if (widget.m_childLayout != UIChildLayout::None && !widget.m_children.empty()) {
+            UIRect content(widget.m_bounds.x + widget.m_padding, widget.m_bounds.y + widget.m_padding,
+                           std::max(0.0f, widget.m_bounds.width - widget.m_padding * 2.0f),
+                           std::max(0.0f, widget.m_bounds.height - widget.m_padding * 2.0f));
+            const size_t count = widget.m_children.size();
+
+            for (size_t i = 0; i < count; ++i) {
+                UIRect slot;
+                switch (widget.m_childLayout) {
+                    case UIChildLayout::Vertical:
+                        slot = UILayout::getVerticalSlot(content, i, count, widget.m_spacing);
+                        break;
+                    case UIChildLayout::Horizontal:
+                        slot = UILayout::getHorizontalSlot(content, i, count, widget.m_spacing);
+                        break;
+                    default:
+                        slot = UILayout::getGridSlot(content, i, count, widget.m_columns, widget.m_spacing);
+                        break;
+                }
+
+                // Marks the child (and its subtree) dirty only if it moved
+                widget.m_children[i]->setBounds(slot);
+            }
+
+            m_stats.widgetsLaidOut++;
+        }
+    }
+
+    // Repositioned children flagged this widget through setBounds()
+    if (widget.m_subtreeLayoutDirty) {
+        for (auto& child : widget.m_children) {
+            if (child->m_layoutDirty || child->m_subtreeLayoutDirty) {
+                layoutSubtree(*child);
+            }
+        }
+    }
+
+    widget.m_subtreeLayoutDirty = false;
+}
+
+void UITree::renderCache(UIWidget& owner) {
+    if (!owner.m_visible) {
+        return;
+    }
+
+    if (owner.m_geometryDirty) {
+        owner.m_vertices.clear();
+        owner.m_quadCount = 0;
+        owner.m_nestedCaches.clear();
+        buildGeometry(owner, owner);
+        owner.m_geometryDirty = false;
+        m_stats.geometryRebuilds++;
+        m_stats.quadsBuilt += owner.m_quadCount;
+    } else {
+        m_stats.cacheReuses++;
+    }
+
+    if (owner.m_quadCount > 0) {
+        m_spriteRenderer->drawQuadVertices(m_textRenderer->getFont()->getTexture(),
+                                           owner.m_vertices.data(), owner.m_quadCount);
+        m_stats.quadsSubmitted += owner.m_quadCount;
+    }
+
+    for (UIWidget* nested : owner.m_nestedCaches) {
+        renderCache(*nested);
+    }
+}
+
+void UITree::buildGeometry(UIWidget& widget, UIWidget& owner) {
+    if (&widget != &owner && widget.m_cacheGeometry) {
+        // Drawn from its own cache after this one; visibility is checked then
+        owner.m_nestedCaches.push_back(&widget);
+        return;
+    }
+
+    if (!widget.m_visible) {
+        return;
+    }
+
+    if (&widget != m_root.get()) {
+        buildWidget(widget, owner);
+    }
+
+    for (auto& child : widget.m_children) {
+        buildGeometry(*child, owner);
+    }
+}
+
+void UITree::buildWidget(UIWidget& widget, UIWidget& owner) {
+    const UIRect& bounds = widget.m_bounds;
+    const float fontSize = widget.m_fontSize > 0.0f ? widget.m_fontSize : m_style.textSize;
+    const Graphics::Color& textColor = widget.m_enabled ? m_style.textColor : m_style.textDisabledColor;
+
+    switch (widget.m_type) {
+        case UIElementType::Panel:
+            addQuad(owner, bounds.x, bounds.y, bounds.width, bounds.height, m_style.panelBackgroundColor);
+            addBorder(owner, bounds, m_style.panelBorderWidth, m_style.panelBorderColor);
+            break;
+
+        case UIElementType::Button: {
+            Graphics::Color background = m_style.buttonNormalColor;
+            switch (widget.m_state) {
+                case UIElementState::Hovered: background = m_style.buttonHoverColor; break;
+                case UIElementState::Pressed: background = m_style.buttonPressedColor; break;
+                case UIElementState::Disabled: background = m_style.buttonDisabledColor; break;
+                default: break;
+            }
+
+            addQuad(owner, bounds.x, bounds.y, bounds.width, bounds.height, background);
+            addBorder(owner, bounds, m_style.buttonBorderWidth, m_style.buttonBorderColor);
+            addText(owner, widget.m_text, bounds, fontSize, widget.m_alignment,
+                    widget.m_enabled ? m_style.buttonTextColor : m_style.buttonDisabledTextColor);
+            break;
+        }
+
+        case UIElementType::Text:
+            addText(owner, widget.m_text, bounds, fontSize, widget.m_alignment, textColor);
+            break;
+
+        case UIElementType::ProgressBar: {
+            float range = widget.m_maxValue - widget.m_minValue;
+            float progress = range > 0.0f ? (widget.m_value - widget.m_minValue) / range : 0.0f;
+
+            addQuad(owner, bounds.x, bounds.y, bounds.width, bounds.height, m_style.progressBarBackgroundColor);
+            if (progress > 0.0f) {
+                addQuad(owner, bounds.x, bounds.y, bounds.width * progress, bounds.height, m_style.progressBarForegroundColor);
+            }
+            addBorder(owner, bounds, m_style.progressBarBorderWidth, m_style.progressBarBorderColor);
+            break;
+        }
+
+        case UIElementType::Checkbox: {
+            const float boxSize = m_style.checkboxSize;
+            UIRect box(bounds.x, bounds.y + (bounds.height - boxSize) * 0.5f, boxSize, boxSize);
+
+            addQuad(owner, box.x, box.y, box.width, box.height, m_style.checkboxBackgroundColor);
+            if (widget.m_checked) {
+                addQuad(owner, box.x + 2.0f, box.y + 2.0f, box.width - 4.0f, box.height - 4.0f, m_style.checkboxCheckedColor);
+            }
+            addBorder(owner, box, m_style.checkboxBorderWidth, m_style.checkboxBorderColor);
+
+            UIRect label(box.x + box.width + 5.0f, bounds.y, std::max(0.0f, bounds.width - box.width - 5.0f), bounds.height);
+            addText(owner, widget.m_text, label, fontSize, UIAlignment::CenterLeft, textColor);
+            break;
+        }
+
+        case UIElementType::Slider: {
+            float range = widget.m_maxValue - widget.m_minValue;
+            float progress = range > 0.0f ? (widget.m_value - widget.m_minValue) / range : 0.0f;
+            const float handleSize = m_style.sliderHandleSize;
+
+            UIRect track(bounds.x, bounds.y + (bounds.height - m_style.sliderTrackHeight) * 0.5f,
+                         bounds.width, m_style.sliderTrackHeight);
+            addQuad(owner, track.x, track.y, track.width, track.height, m_style.sliderTrackColor);
+            addBorder(owner, track, m_style.sliderBorderWidth, m_style.sliderBorderColor);
+
+            UIRect handle(bounds.x + (bounds.width - handleSize) * progress,
+                          bounds.y + (bounds.height - handleSize) * 0.5f, handleSize, handleSize);
+            bool active = widget.m_state == UIElementState::Hovered || widget.m_state == UIElementState::Pressed;
+            addQuad(owner, handle.x, handle.y, handle.width, handle.height,
+                    active ? m_style.sliderHandleHoverColor : m_style.sliderHandleColor);
+            addBorder(owner, handle, m_style.sliderBorderWidth, m_style.sliderBorderColor);
+            break;
+        }
+
+        case UIElementType::Image:
+            // Images need their own texture and cannot share the atlas batch
+            break;
+    }
+}
+
+void UITree::addQuad(UIWidget& owner, float x, float y, float width, float height, const Graphics::Color& color) {
+    float u0, v0, u1, v1;
+    if (width <= 0.0f || height <= 0.0f || !m_textRenderer->getFont()->getWhiteRegion(u0, v0, u1, v1)) {
+        return;
+    }
+
+    owner.m_vertices.resize(owner.m_vertices.size() + FLOATS_PER_QUAD);
+    Graphics::SpriteRenderer::writeQuadVertices(owner.m_vertices.data() + owner.m_quadCount * FLOATS_PER_QUAD,
+                                                x, y, width, height, u0, v0, u1, v1, color, 0.0f, 0.0f, 0.0f);
+    owner.m_quadCount++;
+}
+
+void UITree::addBorder(UIWidget& owner, const UIRect& bounds, float width, const Graphics::Color& color) {
+    if (width <= 0.0f) {
+        return;
+    }
+
+    addQuad(owner, bounds.x, bounds.y, bounds.width, width, color);
+    addQuad(owner, bounds.x, bounds.y + bounds.height - width, bounds.width, width, color);
+    addQuad(owner, bounds.x, bounds.y, width, bounds.height, color);
+    addQuad(owner, bounds.x + bounds.width - width, bounds.y, width, bounds.height, color);
+}
+
+void UITree::addText(UIWidget& owner, const std::string& text, const UIRect& bounds, float fontSize,
+                     UIAlignment alignment, const Graphics::Color& color) {
+    if (text.empty()) {
+        return;
+    }
+
+    const Graphics::TextMesh& mesh = m_textRenderer->layoutText(text, fontSize);
+    if (mesh.quads.empty()) {
+        return;
+    }
+
+    auto position = UILayout::calculateAlignedPosition(bounds, mesh.width, mesh.height, alignment);
+
+    owner.m_vertices.resize(owner.m_vertices.size() + mesh.quads.size() * FLOATS_PER_QUAD);
+    float* out = owner.m_vertices.data() + owner.m_quadCount * FLOATS_PER_QUAD;
+    for (const auto& quad : mesh.quads) {
+        Graphics::SpriteRenderer::writeQuadVertices(out, position.first + quad.x, position.second + quad.y,
+                                                    quad.width, quad.height, quad.u0, quad.v0, quad.u1, quad.v1,
+                                                    color, 0.0f, 0.0f, 0.0f);
+        out += FLOATS_PER_QUAD;
+    }
+    owner.m_quadCount += mesh.quads.size();
+}
+
+void UITree::invalidateSubtree(UIWidget& widget) {
+    if (widget.m_cacheGeometry) {
+        widget.m_geometryDirty = true;
+    }
+
+    for (auto& child : widget.m_children) {
+        invalidateSubtree(*child);
+    }
+}
+
+std::shared_ptr<UIWidget> UITree::hitTest(const UIWidget& widget, float x, float y) const {
+    // Later children are drawn on top, so they are tested first. Containers
+    // are not clipped to their bounds, so grouping widgets needs no bounds.
+    for (auto it = widget.m_children.rbegin(); it != widget.m_children.rend(); ++it) {
+        const std::shared_ptr<UIWidget>& child = *it;
+        if (!child->m_visible) {
+            continue;
+        }
+
+        if (auto found = hitTest(*child, x, y)) {
+            return found;
+        }
+
+        if (child->m_enabled && isInteractive(child->m_type) && child->m_bounds.contains(x, y)) {
+            return child;
+        }
+    }
+
+    return nullptr;
+}
+
+} // namespace UI
+} // namespace RPGEngine
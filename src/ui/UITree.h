@@ -0,0 +1,322 @@
+#pragma once
+
+#include "UIRenderer.h"
+#include "../graphics/SpriteRenderer.h"
+#include "../graphics/TextRenderer.h"
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace RPGEngine {
+namespace UI {
+
+class UITree;
+
+/**
+ * How a widget arranges its children
+ */
+enum class UIChildLayout {
+    None,       // Children keep the bounds they were given
+    Vertical,
+    Horizontal,
+    Grid
+};
+
+/**
+ * Retained UI widget
+ * Setters only mark the widget dirty when a value actually changes. Bounds,
+ * child list and layout settings mark the layout dirty; everything else
+ * only marks the cached geometry of the enclosing panel dirty.
+ */
+class UIWidget {
+public:
+    /**
+     * Constructor
+     * @param type Widget type (Image is not supported by the retained tree)
+     * @param id Widget ID
+     */
+    UIWidget(UIElementType type, const std::string& id = "");
+
+    /**
+     * Destructor
+     */
+    ~UIWidget();
+
+    UIWidget(const UIWidget&) = delete;
+    UIWidget& operator=(const UIWidget&) = delete;
+
+    /**
+     * Add a child widget
+     * @param child Child to add (removed from its previous parent)
+     */
+    void addChild(std::shared_ptr<UIWidget> child);
+
+    /**
+     * Remove a child widget
+     * @param child Child to remove
+     */
+    void removeChild(const std::shared_ptr<UIWidget>& child);
+
+    /**
+     * Remove all children
+     */
+    void clearChildren();
+
+    /**
+     * Get the children
+     * @return Children in draw order
+     */
+    const std::vector<std::shared_ptr<UIWidget>>& getChildren() const { return m_children; }
+
+    /**
+     * Get the parent
+     * @return Parent widget, or nullptr for a root
+     */
+    UIWidget* getParent() const { return m_parent; }
+
+    /**
+     * Find a widget in this subtree
+     * @param id Widget ID
+     * @return Widget, or nullptr if not found
+     */
+    UIWidget* findWidget(const std::string& id);
+
+    /**
+     * Arrange children automatically
+     * @param layout Layout mode
+     * @param spacing Spacing between children
+     * @param padding Inset from this widget's bounds
+     * @param columns Column count for grid layouts
+     */
+    void setChildLayout(UIChildLayout layout, float spacing = 5.0f, float padding = 0.0f, int columns = 1);
+
+    void setBounds(const UIRect& bounds);
+    void setText(const std::string& text);
+    void setFontSize(float fontSize);
+    void setAlignment(UIAlignment alignment);
+    void setValue(float value);
+    void setRange(float minValue, float maxValue);
+    void setChecked(bool checked);
+    void setVisible(bool visible);
+    void setEnabled(bool enabled);
+
+    /**
+     * Give this widget its own geometry cache
+     * Panels cache by default. A change inside a cached widget only rebuilds
+     * that widget's geometry, not its parent's.
+     * @param cache Whether to cache
+     */
+    void setCacheGeometry(bool cache);
+
+    UIElementType getType() const { return m_type; }
+    const std::string& getId() const { return m_id; }
+    const UIRect& getBounds() const { return m_bounds; }
+    const std::string& getText() const { return m_text; }
+    float getFontSize() const { return m_fontSize; }
+    UIAlignment getAlignment() const { return m_alignment; }
+    float getValue() const { return m_value; }
+    float getMinValue() const { return m_minValue; }
+    float getMaxValue() const { return m_maxValue; }
+    bool isChecked() const { return m_checked; }
+    bool isVisible() const { return m_visible; }
+    bool isEnabled() const { return m_enabled; }
+    UIElementState getState() const { return m_state; }
+    bool cachesGeometry() const { return m_cacheGeometry; }
+
+    // Callbacks
+    std::function<void()> onClick;          // Buttons
+    std::function<void(bool)> onToggled;    // Checkboxes
+    std::function<void(float)> onChanged;   // Sliders
+
+private:
+    friend class UITree;
+
+    /**
+     * Mark the children of this widget for layout
+     */
+    void markLayoutDirty();
+
+    /**
+     * Mark the geometry cache that holds this widget for rebuild
+     */
+    void markGeometryDirty();
+
+    /**
+     * Get the widget whose cache holds this widget's geometry
+     * @return Cache owner (this widget if it caches)
+     */
+    UIWidget* getCacheOwner();
+
+    /**
+     * Set the interaction state
+     * @param state New state
+     */
+    void setState(UIElementState state);
+
+    UIElementType m_type;
+    std::string m_id;
+    UIWidget* m_parent;
+    std::vector<std::shared_ptr<UIWidget>> m_children;
+
+    // Content
+    UIRect m_bounds;
+    std::string m_text;
+    float m_fontSize;
+    UIAlignment m_alignment;
+    float m_value;
+    float m_minValue;
+    float m_maxValue;
+    bool m_checked;
+    bool m_visible;
+    bool m_enabled;
+    UIElementState m_state;
+
+    // Child layout
+    UIChildLayout m_childLayout;
+    float m_spacing;
+    float m_padding;
+    int m_columns;
+
+    // Dirty tracking
+    bool m_layoutDirty;         // Children need new bounds
+    bool m_subtreeLayoutDirty;  // Some descendant needs layout
+    bool m_cacheGeometry;
+    bool m_geometryDirty;       // Cache needs rebuilding (cache owners only)
+
+    // Cached quads of this widget and its non-caching descendants, and the
+    // caching descendants drawn on top of them
+    std::vector<float> m_vertices;
+    size_t m_quadCount;
+    std::vector<UIWidget*> m_nestedCaches;
+};
+
+/**
+ * Retained UI tree statistics
+ */
+struct UITreeStats {
+    uint64_t widgetsLaidOut = 0;     // Containers whose children were repositioned
+    uint64_t geometryRebuilds = 0;   // Caches regenerated
+    uint64_t cacheReuses = 0;        // Caches submitted unchanged
+    uint64_t quadsBuilt = 0;
+    uint64_t quadsSubmitted = 0;
+};
+
+/**
+ * Retained-mode UI tree
+ * Keeps widgets between frames, lays out only subtrees whose bounds or
+ * children changed and caches the vertex data of each panel, so unchanged
+ * screens cost one memcpy per panel. Everything is drawn from the text
+ * renderer's font atlas and lands in a single sprite batch.
+ *
+ * Paint order: each cache is drawn before the caches nested in it, so a
+ * panel's own widgets are always beneath its child panels.
+ */
+class UITree {
+public:
+    /**
+     * Constructor
+     * @param spriteRenderer Sprite renderer to submit geometry to
+     * @param textRenderer Text renderer providing the font atlas
+     * @param style Style used to build geometry
+     */
+    UITree(std::shared_ptr<Graphics::SpriteRenderer> spriteRenderer,
+           std::shared_ptr<Graphics::TextRenderer> textRenderer,
+           const UIStyle& style = UIStyle());
+
+    /**
+     * Destructor
+     */
+    ~UITree();
+
+    /**
+     * Get the root widget
+     * The root is a transparent container covering the screen.
+     * @return Root widget
+     */
+    std::shared_ptr<UIWidget> getRoot() const { return m_root; }
+
+    /**
+     * Find a widget by ID
+     * @param id Widget ID
+     * @return Widget, or nullptr if not found
+     */
+    UIWidget* findWidget(const std::string& id) const;
+
+    /**
+     * Set the style and rebuild all geometry
+     * @param style New style
+     */
+    void setStyle(const UIStyle& style);
+
+    /**
+     * Get the style
+     * @return Style
+     */
+    const UIStyle& getStyle() const { return m_style; }
+
+    /**
+     * Feed mouse input
+     * Does nothing when the mouse neither moved nor changed button state.
+     * @param mouseX Mouse X
+     * @param mouseY Mouse Y
+     * @param mousePressed Whether the left button is held
+     */
+    void updateInput(float mouseX, float mouseY, bool mousePressed);
+
+    /**
+     * Recompute bounds of subtrees whose layout is dirty
+     */
+    void updateLayout();
+
+    /**
+     * Lay out, rebuild dirty caches and submit all geometry
+     * Call between SpriteRenderer::begin() and end().
+     */
+    void render();
+
+    /**
+     * Drop all cached geometry (e.g. after changing the font)
+     */
+    void invalidate();
+
+    /**
+     * Get the statistics
+     * @return Statistics
+     */
+    const UITreeStats& getStats() const { return m_stats; }
+
+    /**
+     * Reset the statistics
+     */
+    void resetStats() { m_stats = UITreeStats(); }
+
+private:
+    void layoutSubtree(UIWidget& widget);
+    void renderCache(UIWidget& owner);
+    void buildGeometry(UIWidget& widget, UIWidget& owner);
+    void buildWidget(UIWidget& widget, UIWidget& owner);
+    void addQuad(UIWidget& owner, float x, float y, float width, float height, const Graphics::Color& color);
+    void addBorder(UIWidget& owner, const UIRect& bounds, float width, const Graphics::Color& color);
+    void addText(UIWidget& owner, const std::string& text, const UIRect& bounds, float fontSize,
+                 UIAlignment alignment, const Graphics::Color& color);
+    void invalidateSubtree(UIWidget& widget);
+    std::shared_ptr<UIWidget> hitTest(const UIWidget& widget, float x, float y) const;
+
+    std::shared_ptr<Graphics::SpriteRenderer> m_spriteRenderer;
+    std::shared_ptr<Graphics::TextRenderer> m_textRenderer;
+    std::shared_ptr<UIWidget> m_root;
+    UIStyle m_style;
+    UITreeStats m_stats;
+
+    // Input state
+    float m_mouseX;
+    float m_mouseY;
+    bool m_mousePressed;
+    bool m_hasInput;
+    std::weak_ptr<UIWidget> m_hoveredWidget;
+    std::weak_ptr<UIWidget> m_pressedWidget;
+};
+
+} // namespace UI
+} // namespace RPGEngine
@@ -0,0 +1,160 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || defined(__i386__))
+#include <nmmintrin.h>
+#define RPG_CRC32C_X86 1
+#elif defined(__ARM_FEATURE_CRC32)
+#include <arm_acle.h>
+#define RPG_CRC32C_ARM 1
+#endif
+
+namespace RPGEngine {
+namespace Utils {
+
+/**
+ * CRC-32C (Castagnoli)
+ * Uses the SSE4.2 or ARMv8 CRC instructions when the CPU has them and
+ * slicing-by-8 tables otherwise. The polynomial is fixed, so checksums are
+ * identical across compilers, platforms and code paths.
+ */
+class Crc32c {
+public:
+    /**
+     * Compute the checksum of a buffer
+     * @param data Data
+     * @param size Size of the data
+     * @param crc Checksum of the preceding data, to continue a running checksum
+     * @return Checksum
+     */
+    static uint32_t compute(const void* data, size_t size, uint32_t crc = 0) {
+        const uint8_t* bytes = static_cast<const uint8_t*>(data);
+#if defined(RPG_CRC32C_X86)
+        static const bool hardware = __builtin_cpu_supports("sse4.2");
+        if (hardware) {
+            return computeHardware(bytes, size, crc);
+        }
+#elif defined(RPG_CRC32C_ARM)
+        return computeHardware(bytes, size, crc);
+#endif
+        return computeSoftware(bytes, size, crc);
+    }
+
+    /**
+     * Compute the checksum with the table implementation only
+     * @param data Data
+     * @param size Size of the data
+     * @param crc Checksum of the preceding data
+     * @return Checksum
+     */
+    static uint32_t computeSoftware(const uint8_t* data, size_t size, uint32_t crc = 0) {
+        const Tables& tables = getTables();
+        crc = ~crc;
+
+        while (size >= 8) {
+            uint32_t low;
+            uint32_t high;
+            std::memcpy(&low, data, 4);
+            std::memcpy(&high, data + 4, 4);
+            low = toLittleEndian(low) ^ crc;
+            high = toLittleEndian(high);
+
+            crc = tables.t[7][low & 0xFF] ^ tables.t[6][(low >> 8) & 0xFF] ^
+                  tables.t[5][(low >> 16) & 0xFF] ^ tables.t[4][low >> 24] ^
+                  tables.t[3][high & 0xFF] ^ tables.t[2][(high >> 8) & 0xFF] ^
+                  tables.t[1][(high >> 16) & 0xFF] ^ tables.t[0][high >> 24];
+            data += 8;
+            size -= 8;
+        }
+
+        while (size-- > 0) {
+            crc = tables.t[0][(crc ^ *data++) & 0xFF] ^ (crc >> 8);
+        }
+
+        return ~crc;
+    }
+
+private:
+    struct Tables {
+        uint32_t t[8][256];
+    };
+
+    static const Tables& getTables() {
+        static const Tables tables = []() {
+            Tables result;
+            for (uint32_t i = 0; i < 256; ++i) {
+                uint32_t crc = i;
+                for (int bit = 0; bit < 8; ++bit) {
+                    crc = (crc >> 1) ^ (0x82F63B78u & (0u - (crc & 1u)));
+                }
+                result.t[0][i] = crc;
+            }
+            for (uint32_t i = 0; i < 256; ++i) {
+                for (int slice = 1; slice < 8; ++slice) {
+                    uint32_t previous = result.t[slice - 1][i];
+                    result.t[slice][i] = (previous >> 8) ^ result.t[0][previous & 0xFF];
+                }
+            }
+            return result;
+        }();
+        return tables;
+    }
+
+    static uint32_t toLittleEndian(uint32_t value) {
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+        return __builtin_bswap32(value);
+#else
+        return value;
+#endif
+    }
+
+#if defined(RPG_CRC32C_X86)
+    __attribute__((target("sse4.2")))
+    static uint32_t computeHardware(const uint8_t* data, size_t size, uint32_t crc) {
+        crc = ~crc;
+#if defined(__x86_64__)
+        uint64_t crc64 = crc;
+        while (size >= 8) {
+            uint64_t value;
+            std::memcpy(&value, data, 8);
+            crc64 = _mm_crc32_u64(crc64, value);
+            data += 8;
+            size -= 8;
+        }
+        crc = static_cast<uint32_t>(crc64);
+#endif
+        while (size >= 4) {
+            uint32_t value;
+            std::memcpy(&value, data, 4);
+            crc = _mm_crc32_u32(crc, value);
+            data += 4;
+            size -= 4;
+        }
+        while (size-- > 0) {
+            crc = _mm_crc32_u8(crc, *data++);
+        }
+        return ~crc;
+    }
+#elif defined(RPG_CRC32C_ARM)
+    static uint32_t computeHardware(const uint8_t* data, size_t size, uint32_t crc) {
+        crc = ~crc;
+        while (size >= 8) {
+            uint64_t value;
+            std::memcpy(&value, data, 8);
+            crc = __crc32cd(crc, value);
+            data += 8;
+            size -= 8;
+        }
+        while (size-- > 0) {
+            crc = __crc32cb(crc, *data++);
+        }
+        return ~crc;
+    }
+#endif
+};
+
+} // namespace Utils
+} // namespace RPGEngine
@@ -0,0 +1,210 @@
+#pragma once
+
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+
+namespace RPGEngine {
+namespace Utils {
+
+/**
+ * LZ4 block codec
+ * Greedy single-pass compressor and bounds-checked decompressor for the
+ * LZ4 block format. Favors decode speed over ratio, which suits assets and
+ * saves that are written once and read often.
+ */
+class Lz4 {
+public:
+    /**
+     * Compress a block
+     * @param input Data to compress
+     * @param size Size of the data
+     * @return Compressed block (may be larger than the input for random data)
+     */
+    static std::vector<uint8_t> compress(const uint8_t* input, size_t size) {
+        std::vector<uint8_t> output;
+        output.reserve(size + size / 255 + 16);
+
+        const size_t lastLiterals = 5;     // The block must end with literals
+        const size_t matchFindLimit = 12;  // No match may start this close to the end
+
+        size_t anchor = 0;
+        size_t pos = 0;
+
+        if (size > matchFindLimit) {
+            // Hash table of recent positions (+1, so 0 means empty)
+            std::vector<uint32_t> table(1 << HASH_BITS, 0);
+            const size_t matchLimit = size - lastLiterals;
+            const size_t searchEnd = size - matchFindLimit;
+
+            while (pos < searchEnd) {
+                uint32_t sequence = read32(input + pos);
+                uint32_t hash = (sequence * 2654435761u) >> (32 - HASH_BITS);
+                size_t candidate = table[hash];
+                table[hash] = static_cast<uint32_t>(pos + 1);
+
+                if (candidate == 0 || pos - (candidate - 1) > MAX_OFFSET ||
+                    read32(input + candidate - 1) != sequence) {
+                    pos++;
+                    continue;
+                }
+
+                size_t match = candidate - 1;
+                size_t length = MIN_MATCH;
+                while (pos + length < matchLimit && input[match + length] == input[pos + length]) {
+                    length++;
+                }
+
+                writeSequence(output, input + anchor, pos - anchor, pos - match, length);
+                pos += length;
+                anchor = pos;
+            }
+        }
+
+        // Trailing literals
+        writeSequence(output, input + anchor, size - anchor, 0, 0);
+        return output;
+    }
+
+    /**
+     * Decompress a block
+     * @param input Compressed block
+     * @param inputSize Size of the block
+     * @param output Destination buffer
+     * @param outputSize Exact decompressed size
+     * @return true if the block was valid and filled the buffer exactly
+     */
+    static bool decompress(const uint8_t* input, size_t inputSize, uint8_t* output, size_t outputSize) {
+        size_t in = 0;
+        size_t out = 0;
+
+        while (in < inputSize) {
+            uint8_t token = input[in++];
+
+            // Literals
+            size_t literals = token >> 4;
+            if (literals == 15 && !readLength(input, inputSize, in, literals)) {
+                return false;
+            }
+            if (literals > inputSize - in || literals > outputSize - out) {
+                return false;
+            }
+            if (literals > 0) {
+                std::memcpy(output + out, input + in, literals);
+            }
+            in += literals;
+            out += literals;
+
+            // The last sequence has no match
+            if (in == inputSize) {
+                break;
+            }
+
+            // Match
+            if (inputSize - in < 2) {
+                return false;
+            }
+            size_t offset = input[in] | (input[in + 1] << 8);
+            in += 2;
+            if (offset == 0 || offset > out) {
+                return false;
+            }
+
+            size_t length = token & 0x0F;
+            if (length == 15 && !readLength(input, inputSize, in, length)) {
+                return false;
+            }
+            length += MIN_MATCH;
+            if (length > outputSize - out) {
+                return false;
+            }
+
+            // Matches may overlap their own output, so copy forwards byte by byte
+            const uint8_t* source = output + out - offset;
+            for (size_t i = 0; i < length; ++i) {
+                output[out + i] = source[i];
+            }
+            out += length;
+        }
+
+        return out == outputSize;
+    }
+
+    /**
+     * Decompress a block into a vector
+     * @param input Compressed block
+     * @param inputSize Size of the block
+     * @param outputSize Exact decompressed size
+     * @param output Receives the data
+     * @return true if the block was valid
+     */
+    static bool decompress(const uint8_t* input, size_t inputSize, size_t outputSize, std::vector<uint8_t>& output) {
+        output.resize(outputSize);
+        if (!decompress(input, inputSize, output.data(), outputSize)) {
+            output.clear();
+            return false;
+        }
+        return true;
+    }
+
+private:
+    static const int HASH_BITS = 16;
+    static const size_t MIN_MATCH = 4;
+    static const size_t MAX_OFFSET = 65535;
+
+    static uint32_t read32(const uint8_t* data) {
+        uint32_t value;
+        std::memcpy(&value, data, sizeof(value));
+        return value;
+    }
+
+    static void writeLength(std::vector<uint8_t>& output, size_t length) {
+        while (length >= 255) {
+            output.push_back(255);
+            length -= 255;
+        }
+        output.push_back(static_cast<uint8_t>(length));
+    }
+
+    static bool readLength(const uint8_t* input, size_t inputSize, size_t& in, size_t& length) {
+        uint8_t byte;
+        do {
+            if (in >= inputSize) {
+                return false;
+            }
+            byte = input[in++];
+            length += byte;
+        } while (byte == 255);
+        return true;
+    }
+
+    /**
+     * Append one sequence (literals, then a match unless matchLength is 0)
+     */
+    static void writeSequence(std::vector<uint8_t>& output, const uint8_t* literals, size_t literalCount,
+                              size_t offset, size_t matchLength) {
+        size_t matchCode = matchLength ? matchLength - MIN_MATCH : 0;
+        uint8_t token = static_cast<uint8_t>((literalCount < 15 ? literalCount : 15) << 4);
+        if (matchLength) {
+            token |= static_cast<uint8_t>(matchCode < 15 ? matchCode : 15);
+        }
+        output.push_back(token);
+
+        if (literalCount >= 15) {
+            writeLength(output, literalCount - 15);
+        }
+        output.insert(output.end(), literals, literals + literalCount);
+
+        if (matchLength) {
+            output.push_back(static_cast<uint8_t>(offset & 0xFF));
+            output.push_back(static_cast<uint8_t>(offset >> 8));
+            if (matchCode >= 15) {
+                writeLength(output, matchCode - 15);
+            }
+        }
+    }
+};
+
+} // namespace Utils
+} // namespace RPGEngine
@@ -0,0 +1,186 @@
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <cstdio>
+#include <functional>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace RPGEngine {
+namespace Utils {
+
+/**
+ * 32-bit FNV-1a hash, usable in constant expressions
+ * @param text Characters to hash
+ * @param length Number of characters
+ * @return Hash
+ */
+constexpr uint32_t fnv1a32(const char* text, size_t length) {
+    uint32_t hash = 2166136261u;
+    for (size_t i = 0; i < length; ++i) {
+        hash = (hash ^ static_cast<uint8_t>(text[i])) * 16777619u;
+    }
+    return hash;
+}
+
+/**
+ * Interned string ID
+ * The FNV-1a hash of a name, compared and hashed as a 32-bit integer.
+ * Literals hash at compile time ("goblin"_sid). Building an ID from a
+ * runtime string only hashes it; StringId::intern also records the name for
+ * reverse lookup and reports a collision if another name already has the
+ * same ID. Register names once where they enter the game (definitions,
+ * bindings, loaded data) and use IDs on per-frame paths. 0 is the invalid ID
+ * and the ID of the empty string.
+ */
+class StringId {
+public:
+    constexpr StringId() : m_value(0) {}
+    constexpr explicit StringId(std::string_view text)
+        : m_value(text.empty() ? 0 : fnv1a32(text.data(), text.size())) {}
+
+    /**
+     * Hash a name and register it with the StringIdRegistry
+     * @param text Name
+     * @return ID of the name
+     */
+    static StringId intern(std::string_view text);
+
+    /**
+     * Wrap a raw ID value, e.g. one read back from serialized data
+     * @param value ID value
+     * @return ID
+     */
+    static constexpr StringId fromValue(uint32_t value) {
+        StringId id;
+        id.m_value = value;
+        return id;
+    }
+
+    constexpr uint32_t value() const { return m_value; }
+    constexpr bool isValid() const { return m_value != 0; }
+
+    /**
+     * Reverse lookup through the registry
+     * @return The registered name, or "#" and the hex ID if it was never interned
+     */
+    std::string str() const;
+
+    constexpr bool operator==(StringId other) const { return m_value == other.m_value; }
+    constexpr bool operator!=(StringId other) const { return m_value != other.m_value; }
+    constexpr bool operator<(StringId other) const { return m_value < other.m_value; }
+
+private:
+    uint32_t m_value;
+};
+
+/**
+ * Names of interned string IDs
+ * Thread safe; only registration and reverse lookup take the lock.
+ */
+class StringIdRegistry {
+public:
+    static StringIdRegistry& getInstance() {
+        static StringIdRegistry registry;
+        return registry;
+    }
+
+    /**
+     * Register a name
+     * @param text Name
+     * @return ID of the name
+     */
+    StringId intern(std::string_view text) {
+        StringId id(text);
+        if (!id.isValid()) {
+            return id;
+        }
+
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto result = m_names.try_emplace(id.value(), text);
+        if (!result.second && result.first->second != text) {
+            ++m_collisionCount;
+            std::cerr << "StringId collision: '" << text << "' and '" << result.first->second
+                      << "' both hash to " << id.value() << std::endl;
+        }
+        return id;
+    }
+
+    /**
+     * Look up the name of an ID
+     * @param id ID
+     * @param outName Receives the name
+     * @return true if the ID was registered
+     */
+    bool lookup(StringId id, std::string& outName) const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        auto it = m_names.find(id.value());
+        if (it == m_names.end()) {
+            return false;
+        }
+        outName = it->second;
+        return true;
+    }
+
+    size_t getNameCount() const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_names.size();
+    }
+
+    size_t getCollisionCount() const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_collisionCount;
+    }
+
+private:
+    StringIdRegistry() : m_collisionCount(0) {}
+
+    mutable std::mutex m_mutex;
+    std::unordered_map<uint32_t, std::string> m_names;
+    size_t m_collisionCount;
+};
+
+inline StringId StringId::intern(std::string_view text) {
+    return StringIdRegistry::getInstance().intern(text);
+}
+
+inline std::string StringId::str() const {
+    std::string name;
+    if (m_value == 0 || StringIdRegistry::getInstance().lookup(*this, name)) {
+        return name;
+    }
+
+    char hex[16];
+    std::snprintf(hex, sizeof(hex), "#%08x", m_value);
+    return hex;
+}
+
+namespace StringIdLiterals {
+
+/**
+ * Compile-time string ID literal: "hp"_sid
+ */
+constexpr StringId operator""_sid(const char* text, size_t length) {
+    return StringId(std::string_view(text, length));
+}
+
+} // namespace StringIdLiterals
+
+} // namespace Utils
+} // namespace RPGEngine
+
+namespace std {
+
+template<>
+struct hash<RPGEngine::Utils::StringId> {
+    size_t operator()(RPGEngine::Utils::StringId id) const noexcept {
+        // Already a well-mixed hash
+        return id.value();
+    }
+};
+
+} // namespace std
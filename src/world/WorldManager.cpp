@@ -14,6 +14,7 @@ WorldManager::WorldManager(std::shared_ptr<Resources::ResourceManager> resourceM
     , m_resourceManager(resourceManager)
     , m_entityManager(entityManager)
     , m_componentManager(componentManager)
+    , m_hotReloadingEnabled(false)
     , m_mapDirectory("assets/maps/")
     , m_isTransitioning(false)
     , m_transitionTime(0.0f)
@@ -27,6 +28,8 @@ WorldManager::WorldManager(std::shared_ptr<Resources::ResourceManager> resourceM
 }
 
 WorldManager::~WorldManager() {
+    enableHotReloading(false);
+    
     if (isInitialized()) {
         shutdown();
     }
@@ -53,6 +56,11 @@ bool WorldManager::onInitialize() {
 }
 
 void WorldManager::onUpdate(float deltaTime) {
+    // Reload changed map files
+    if (m_hotReloadingEnabled && m_ownsFileWatcher) {
+        m_fileWatcher->update();
+    }
+    
     // Update map transition
     if (m_isTransitioning) {
         updateTransition(deltaTime);
@@ -61,6 +69,8 @@ void WorldManager::onUpdate(float deltaTime) {
 
 void WorldManager::onShutdown() {
     // Unload all maps
+    enableHotReloading(false);
+    m_mapFiles.clear();
     m_maps.clear();
     m_activeMap = nullptr;
     
@@ -98,6 +108,7 @@ std::shared_ptr<Map> WorldManager::loadMap(const std::string& filename, uint32_t
     
     // Add map to maps
     m_maps[id] = map;
+    m_mapFiles[id] = {mapPath, m_hotReloadingEnabled ? watchMapFile(id, mapPath) : 0};
     
     // Create entities from map objects
     createEntitiesFromObjects(map);
@@ -113,6 +124,10 @@ std::shared_ptr<Map> WorldManager::loadMap(const std::string& filename, uint32_t
     return map;
 }
 
+bool WorldManager::buildMapManifest(const std::string& filename, Resources::PreloadManifest& manifest) {
+    return m_mapLoader->buildManifest(m_mapDirectory + filename, manifest);
+}
+
 bool WorldManager::unloadMap(uint32_t id) {
     auto it = m_maps.find(id);
     if (it == m_maps.end()) {
@@ -130,6 +145,14 @@ bool WorldManager::unloadMap(uint32_t id) {
     // Remove map
     m_maps.erase(it);
     
+    auto fileIt = m_mapFiles.find(id);
+    if (fileIt != m_mapFiles.end()) {
+        if (fileIt->second.watchId != 0) {
+            m_fileWatcher->unwatch(fileIt->second.watchId);
+        }
+        m_mapFiles.erase(fileIt);
+    }
+    
     // Fire map unloaded event
     MapUnloadedEvent event(id, mapName);
     for (const auto& pair : m_mapUnloadedCallbacks) {
@@ -141,6 +164,63 @@ bool WorldManager::unloadMap(uint32_t id) {
     return true;
 }
 
+bool WorldManager::reloadMap(uint32_t id) {
+    auto mapIt = m_maps.find(id);
+    auto fileIt = m_mapFiles.find(id);
+    if (mapIt == m_maps.end() || fileIt == m_mapFiles.end()) {
+        return false;
+    }
+    
+    // Keep the old tilemap if the new file doesn't load (e.g. saved half-way)
+    auto tilemap = m_mapLoader->loadMap(fileIt->second.path);
+    if (!tilemap) {
+        std::cerr << "Failed to reload map: " << fileIt->second.path << std::endl;
+        return false;
+    }
+    
+    std::shared_ptr<Map> map = mapIt->second;
+    map->setTilemap(tilemap);
+    
+    // Fire map loaded event
+    MapLoadedEvent event(id, map->getName());
+    for (const auto& pair : m_mapLoadedCallbacks) {
+        pair.second(event);
+    }
+    
+    std::cout << "Reloaded map: " << map->getName() << " (ID: " << id << ")" << std::endl;
+    
+    return true;
+}
+
+void WorldManager::enableHotReloading(bool enable) {
+    if (enable == m_hotReloadingEnabled) {
+        return;
+    }
+    
+    m_hotReloadingEnabled = enable;
+    if (enable && !m_fileWatcher) {
+        m_fileWatcher = std::make_shared<Core::FileWatcher>();
+        m_ownsFileWatcher = true;
+    }
+    
+    for (auto& pair : m_mapFiles) {
+        if (enable) {
+            pair.second.watchId = watchMapFile(pair.first, pair.second.path);
+        } else if (pair.second.watchId != 0) {
+            m_fileWatcher->unwatch(pair.second.watchId);
+            pair.second.watchId = 0;
+        }
+    }
+}
+
+void WorldManager::setFileWatcher(std::shared_ptr<Core::FileWatcher> watcher) {
+    bool enabled = m_hotReloadingEnabled;
+    enableHotReloading(false);
+    m_fileWatcher = watcher;
+    m_ownsFileWatcher = false;
+    enableHotReloading(enabled);
+}
+
 std::shared_ptr<Map> WorldManager::getMap(uint32_t id) const {
     auto it = m_maps.find(id);
     if (it != m_maps.end()) {
@@ -417,5 +497,12 @@ void WorldManager::updateTransition(float deltaTime) {
     }
 }
 
+Core::FileWatchId WorldManager::watchMapFile(uint32_t id, const std::string& path) {
+    return m_fileWatcher->watch(path, [this, id](const std::string& changedPath) {
+        std::cout << "Map file changed, reloading: " << changedPath << std::endl;
+        reloadMap(id);
+    });
+}
+
 } // namespace World
 } // namespace RPGEngine
\ No newline at end of file
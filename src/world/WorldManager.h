@@ -8,6 +8,7 @@
 #include "../components/ComponentManager.h"
 #include "../graphics/Camera.h"
 #include "../core/Event.h"
+#include "../core/FileWatcher.h"
 #include <string>
 #include <memory>
 #include <unordered_map>
@@ -87,6 +88,14 @@ public:
      */
     std::shared_ptr<Map> loadMap(const std::string& filename, uint32_t id = 0);
     
+    /**
+     * List the resources a map file needs, without loading it
+     * @param filename Map file path (relative to the map directory, as for loadMap())
+     * @param manifest Manifest to add the resources to
+     * @return true if the map was parsed
+     */
+    bool buildMapManifest(const std::string& filename, Resources::PreloadManifest& manifest);
+    
     /**
      * Unload a map
      * @param id Map ID
@@ -94,6 +103,34 @@ public:
      */
     bool unloadMap(uint32_t id);
     
+    /**
+     * Reload a map's tilemap from its file
+     * The map keeps its ID and entities; map loaded callbacks run again.
+     * @param id Map ID
+     * @return true if the map was reloaded
+     */
+    bool reloadMap(uint32_t id);
+    
+    /**
+     * Set whether loaded maps reload when their files change
+     * Changes are dispatched from update().
+     * @param enable Whether to watch map files
+     */
+    void enableHotReloading(bool enable);
+    
+    /**
+     * Check if hot reloading is enabled
+     * @return true if map files are watched
+     */
+    bool isHotReloadingEnabled() const { return m_hotReloadingEnabled; }
+    
+    /**
+     * Share a file watcher for hot reloading instead of creating one
+     * A shared watcher is not updated from onUpdate().
+     * @param watcher File watcher (nullptr to create one when hot reloading is enabled)
+     */
+    void setFileWatcher(std::shared_ptr<Core::FileWatcher> watcher);
+    
     /**
      * Get a map by ID
      * @param id Map ID
@@ -230,6 +267,14 @@ private:
      */
     void updateTransition(float deltaTime);
     
+    /**
+     * Watch a map file
+     * @param id Map ID
+     * @param path Map file path
+     * @return Watch ID
+     */
+    Core::FileWatchId watchMapFile(uint32_t id, const std::string& path);
+    
     // Managers
     std::shared_ptr<Resources::ResourceManager> m_resourceManager;
     std::shared_ptr<EntityManager> m_entityManager;
@@ -242,6 +287,16 @@ private:
     std::unordered_map<uint32_t, std::shared_ptr<Map>> m_maps;
     std::shared_ptr<Map> m_activeMap;
     
+    // Map files (for reloading)
+    struct MapFile {
+        std::string path;
+        Core::FileWatchId watchId = 0;
+    };
+    std::unordered_map<uint32_t, MapFile> m_mapFiles;
+    std::shared_ptr<Core::FileWatcher> m_fileWatcher;
+    bool m_ownsFileWatcher = false;
+    bool m_hotReloadingEnabled;
+    
     // Camera
     std::shared_ptr<Graphics::Camera> m_camera;
     